@@ -55,16 +55,31 @@
 #include "app_i2c_eeprom.h"
 #include "app_i2c_temp_sensor.h"
 #include "system/console/sys_console.h"
+#if defined(APP_I2C_DMA_BENCHMARK_ENABLE)
+#include "system/time/sys_time.h"
+#endif
 
 // *****************************************************************************
 // *****************************************************************************
 // Section: Global Data Definitions
 // *****************************************************************************
 // *****************************************************************************
-#define APP_EEPROM_I2C_CLOCK_SPEED                  400000
-#define APP_EEPROM_SLAVE_ADDR                       0x0057
 #define APP_EEPROM_START_MEMORY_ADDR                0x00
 
+/* When APP_I2C_DMA_BENCHMARK_ENABLE is defined (see app_i2c_eeprom.h), the
+ * application first reads the whole EEPROM and writes it back page by page,
+ * APP_I2C_BENCHMARK_ROUNDS times. The reads are long enough to be moved by
+ * the DMA; the page writes are sent from the SERCOM interrupt, one byte per
+ * interrupt. While each transfer runs the CPU spins in an idle loop whose cost
+ * per turn is measured first; the cycles not spent in the loop are the CPU
+ * time of the transfer. The CPU cycles per KB and the CPU load of each kind of
+ * transfer are printed on the console. The cycles are read from SysTick,
+ * which is started free running at the CPU clock if nothing else runs it. */
+#if defined(APP_I2C_DMA_BENCHMARK_ENABLE)
+/* Length of the idle loop calibration */
+#define APP_I2C_BENCHMARK_CALIBRATION_MS            (10U)
+#endif
+
 // *****************************************************************************
 /* Application Data
 
@@ -96,20 +111,173 @@ void APP_EEPROM_Notify(uint8_t temperature)
 /* TODO:  Add any necessary callback functions.
 */
 
+#if defined(APP_I2C_DMA_BENCHMARK_ENABLE)
+/* Ends the idle loop calibration */
+static void APP_EEPROM_CalibrationTimerHandler(uintptr_t context)
+{
+    appEEPROMData.transferStatus = DRV_I2C_EEPROM_TRANSFER_COMPLETED;
+}
+#endif
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: Application Local Functions
 // *****************************************************************************
 // *****************************************************************************
 static void APP_I2C_EEPROM_EventHandler(
-    DRV_I2C_TRANSFER_EVENT event,
-    DRV_I2C_TRANSFER_HANDLE transferHandle,
+    DRV_I2C_EEPROM_TRANSFER_STATUS event,
     uintptr_t context
 )
 {
     appEEPROMData.transferStatus = event;
 }
 
+#if defined(APP_I2C_DMA_BENCHMARK_ENABLE)
+/* Returns the number of CPU cycles since startCount was read from SysTick */
+static uint32_t APP_EEPROM_CyclesElapsed(uint32_t startCount)
+{
+    return (startCount - SysTick->VAL) & SysTick_LOAD_RELOAD_Msk;
+}
+
+/* Spins until the transfer status leaves BUSY and returns the number of turns.
+ * The calibration and the timed transfers use this same loop. */
+static uint32_t APP_EEPROM_IdleLoop(void)
+{
+    uint32_t nTurns = 0U;
+
+    while (appEEPROMData.transferStatus == DRV_I2C_EEPROM_TRANSFER_BUSY)
+    {
+        nTurns++;
+    }
+
+    return nTurns;
+}
+
+/* Times the idle loop against a SYS_TIME timer, nothing else using the CPU */
+static bool APP_EEPROM_BenchmarkCalibrate(void)
+{
+    uint32_t startCount;
+    uint32_t nTurns;
+    uint32_t cycles;
+
+    /* A SysTick already running is left as it is. The spans timed must then
+     * be shorter than its period. */
+    if ((SysTick->CTRL & SysTick_CTRL_ENABLE_Msk) == 0U)
+    {
+        SysTick->LOAD = SysTick_LOAD_RELOAD_Msk;
+        SysTick->VAL = 0U;
+        SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+    }
+
+    appEEPROMData.transferStatus = DRV_I2C_EEPROM_TRANSFER_BUSY;
+    startCount = SysTick->VAL;
+
+    if (SYS_TIME_CallbackRegisterMS(APP_EEPROM_CalibrationTimerHandler, 0,
+        APP_I2C_BENCHMARK_CALIBRATION_MS, SYS_TIME_SINGLE) == SYS_TIME_HANDLE_INVALID)
+    {
+        return false;
+    }
+
+    nTurns = APP_EEPROM_IdleLoop();
+    cycles = APP_EEPROM_CyclesElapsed(startCount);
+
+    if (nTurns == 0U)
+    {
+        return false;
+    }
+
+    appEEPROMData.idleTurnCycles = (cycles << 8) / nTurns;
+    appEEPROMData.benchmarkStep = 0U;
+    appEEPROMData.readBytes = 0U;
+    appEEPROMData.readCycles = 0U;
+    appEEPROMData.readCpuCycles = 0U;
+    appEEPROMData.writeBytes = 0U;
+    appEEPROMData.writeCycles = 0U;
+    appEEPROMData.writeCpuCycles = 0U;
+
+    return true;
+}
+
+/* Runs the next read or page write of the benchmark and adds up its elapsed
+ * and busy CPU cycles. The EEPROM must not be in a write cycle, so that the
+ * transfer starts at once and ends from the I2C interrupt. */
+static bool APP_EEPROM_BenchmarkTransfer(void)
+{
+    uint32_t step = appEEPROMData.benchmarkStep % (APP_I2C_BENCHMARK_PAGES + 1U);
+    uint32_t address = 0U;
+    uint32_t nBytes = DRV_I2C_EEPROM_SIZE_IDX0;
+    uint32_t startCount;
+    uint32_t nTurns;
+    uint32_t cycles;
+    uint32_t idleCycles;
+    bool isQueued;
+
+    appEEPROMData.transferStatus = DRV_I2C_EEPROM_TRANSFER_BUSY;
+    startCount = SysTick->VAL;
+
+    if (step == 0U)
+    {
+        isQueued = DRV_I2C_EEPROM_Read(appEEPROMData.eepromHandle,
+            (void *)appEEPROMData.benchmarkBuffer, nBytes, address);
+    }
+    else
+    {
+        address = (step - 1U) * DRV_I2C_EEPROM_PAGE_SIZE_IDX0;
+        nBytes = DRV_I2C_EEPROM_PAGE_SIZE_IDX0;
+
+        isQueued = DRV_I2C_EEPROM_Write(appEEPROMData.eepromHandle,
+            (void *)&appEEPROMData.benchmarkBuffer[address], nBytes, address);
+    }
+
+    if (isQueued == false)
+    {
+        return false;
+    }
+
+    nTurns = APP_EEPROM_IdleLoop();
+    cycles = APP_EEPROM_CyclesElapsed(startCount);
+
+    if (appEEPROMData.transferStatus != DRV_I2C_EEPROM_TRANSFER_COMPLETED)
+    {
+        return false;
+    }
+
+    idleCycles = (nTurns * appEEPROMData.idleTurnCycles) >> 8;
+
+    if (idleCycles > cycles)
+    {
+        idleCycles = cycles;
+    }
+
+    if (step == 0U)
+    {
+        appEEPROMData.readBytes += nBytes;
+        appEEPROMData.readCycles += cycles;
+        appEEPROMData.readCpuCycles += (cycles - idleCycles);
+    }
+    else
+    {
+        appEEPROMData.writeBytes += nBytes;
+        appEEPROMData.writeCycles += cycles;
+        appEEPROMData.writeCpuCycles += (cycles - idleCycles);
+    }
+
+    appEEPROMData.benchmarkStep++;
+
+    return true;
+}
+
+/* Prints the CPU cycles per KB and the CPU load of one kind of transfer */
+static void APP_EEPROM_BenchmarkPrint(const char *name, uint32_t nBytes, uint32_t cycles, uint32_t cpuCycles)
+{
+    uint32_t cyclesPerKB = (uint32_t)(((uint64_t)cpuCycles * 1024U) / nBytes);
+    uint32_t load = (uint32_t)(((uint64_t)cpuCycles * 100U) / cycles);
+
+    SYS_CONSOLE_PRINT("%s: %u bytes, %u CPU cycles per KB, %u%% CPU load\r\n",
+        name, (unsigned int)nBytes, (unsigned int)cyclesPerKB, (unsigned int)load);
+}
+#endif
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: Application Initialization and State Machine Functions
@@ -128,8 +296,7 @@ void APP_I2C_EEPROM_Initialize ( void )
 {
     /* Initialize the EEPROM Sensor Application data */
     appEEPROMData.state                     = APP_EEPROM_STATE_INIT;
-    appEEPROMData.i2cHandle                 = DRV_HANDLE_INVALID;
-    appEEPROMData.transferHandle            = DRV_I2C_TRANSFER_HANDLE_INVALID;
+    appEEPROMData.eepromHandle              = DRV_HANDLE_INVALID;
     appEEPROMData.currentWriteIndex         = 0;
     appEEPROMData.isTemperatureReady        = false;    
 }
@@ -151,20 +318,24 @@ void APP_I2C_EEPROM_Tasks ( void )
     {
         case APP_EEPROM_STATE_INIT:
 
-            /* Open I2C driver client */
-            appEEPROMData.i2cHandle = DRV_I2C_Open( DRV_I2C_INDEX_0, DRV_IO_INTENT_READWRITE);             
+            /* Open I2C EEPROM driver client */
+            appEEPROMData.eepromHandle = DRV_I2C_EEPROM_Open( DRV_I2C_EEPROM_INDEX_0, DRV_IO_INTENT_READWRITE);
 
-            if(appEEPROMData.i2cHandle != DRV_HANDLE_INVALID)
+            if(appEEPROMData.eepromHandle != DRV_HANDLE_INVALID)
             {
-                /* Register the I2C Driver client event callback */
-                DRV_I2C_TransferEventHandlerSet(appEEPROMData.i2cHandle, APP_I2C_EEPROM_EventHandler, 0);       
+                /* Register the I2C EEPROM Driver client event callback */
+                DRV_I2C_EEPROM_EventHandlerSet(appEEPROMData.eepromHandle, APP_I2C_EEPROM_EventHandler, 0);
                 
                 /* Get a handle to the console instance */
                 appEEPROMData.consoleHandle = SYS_CONSOLE_HandleGet(SYS_CONSOLE_INDEX_0);
                 
                 if (appEEPROMData.consoleHandle != SYS_CONSOLE_HANDLE_INVALID)
                 {
+#if defined(APP_I2C_DMA_BENCHMARK_ENABLE)
+                    appEEPROMData.state = APP_EEPROM_STATE_BENCHMARK_CALIBRATE;
+#else
                     appEEPROMData.state = APP_EEPROM_STATE_WRITE;            
+#endif
                 }
                 else
                 {
@@ -177,62 +348,89 @@ void APP_I2C_EEPROM_Tasks ( void )
             }
             break;
 
+#if defined(APP_I2C_DMA_BENCHMARK_ENABLE)
+        case APP_EEPROM_STATE_BENCHMARK_CALIBRATE:
 
-        case APP_EEPROM_STATE_WRITE:
-
-            /* Check if temperature data is ready to be written to EEPROM */
-            if (appEEPROMData.isTemperatureReady == true)
+            if (APP_EEPROM_BenchmarkCalibrate() == true)
             {
-                SYS_CONSOLE_PRINT("Writing temperature to EEPROM...");
+                appEEPROMData.state = APP_EEPROM_STATE_BENCHMARK_FLUSH;
+            }
+            else
+            {
+                appEEPROMData.state = APP_EEPROM_STATE_ERROR;
+            }
+            break;
 
-                appEEPROMData.isTemperatureReady = false;
-                appEEPROMData.transferStatus = DRV_I2C_TRANSFER_EVENT_PENDING;
+        case APP_EEPROM_STATE_BENCHMARK_FLUSH:
 
-                appEEPROMData.txBuffer[0] = APP_EEPROM_START_MEMORY_ADDR + appEEPROMData.currentWriteIndex;
-                appEEPROMData.txBuffer[1] = appEEPROMData.temperature;
+            appEEPROMData.transferStatus = DRV_I2C_EEPROM_TRANSFER_BUSY;
 
-                appEEPROMData.currentWriteIndex++;
-                if (appEEPROMData.currentWriteIndex >= APP_EEPROM_NUM_TEMP_VALUES_TO_SAVE)
-                {
-                    /* Only last 5 values are saved in EEPROM and then over-written again */
-                    appEEPROMData.currentWriteIndex = 0;
-                }
+            /* Completes once the EEPROM acknowledges its address */
+            if (DRV_I2C_EEPROM_Flush(appEEPROMData.eepromHandle) == true)
+            {
+                appEEPROMData.state = APP_EEPROM_STATE_BENCHMARK_WAIT_FLUSH;
+            }
+            else
+            {
+                appEEPROMData.state = APP_EEPROM_STATE_ERROR;
+            }
+            break;
 
-                /* Write temperature data to EEPROM */
-                DRV_I2C_WriteTransferAdd(appEEPROMData.i2cHandle,
-                    APP_EEPROM_SLAVE_ADDR,
-                    (void *)appEEPROMData.txBuffer,
-                    2,
-                    &appEEPROMData.transferHandle
-                );
+        case APP_EEPROM_STATE_BENCHMARK_WAIT_FLUSH:
 
-                if (appEEPROMData.transferHandle == DRV_I2C_TRANSFER_HANDLE_INVALID)
-                {
-                    appEEPROMData.state = APP_EEPROM_STATE_ERROR;
-                }
-                else
-                {
-                    appEEPROMData.state = APP_EEPROM_STATE_WAIT_TRANSFER_COMPLETE;
-                }
+            if (appEEPROMData.transferStatus == DRV_I2C_EEPROM_TRANSFER_COMPLETED)
+            {
+                appEEPROMData.state = APP_EEPROM_STATE_BENCHMARK_TRANSFER;
+            }
+            else if (appEEPROMData.transferStatus == DRV_I2C_EEPROM_TRANSFER_ERROR_UNKNOWN)
+            {
+                appEEPROMData.state = APP_EEPROM_STATE_ERROR;
+            }
+            break;
+
+        case APP_EEPROM_STATE_BENCHMARK_TRANSFER:
+
+            if (APP_EEPROM_BenchmarkTransfer() == false)
+            {
+                appEEPROMData.state = APP_EEPROM_STATE_ERROR;
+            }
+            else if (appEEPROMData.benchmarkStep < APP_I2C_BENCHMARK_STEPS)
+            {
+                appEEPROMData.state = APP_EEPROM_STATE_BENCHMARK_FLUSH;
+            }
+            else
+            {
+                appEEPROMData.state = APP_EEPROM_STATE_BENCHMARK_REPORT;
             }
             break;
 
-        case APP_EEPROM_STATE_WAIT_TRANSFER_COMPLETE:
+        case APP_EEPROM_STATE_BENCHMARK_REPORT:
+
+            APP_EEPROM_BenchmarkPrint("I2C reads (DMA)", appEEPROMData.readBytes,
+                appEEPROMData.readCycles, appEEPROMData.readCpuCycles);
+            APP_EEPROM_BenchmarkPrint("I2C page writes (interrupt)", appEEPROMData.writeBytes,
+                appEEPROMData.writeCycles, appEEPROMData.writeCpuCycles);
+
+            appEEPROMData.state = APP_EEPROM_STATE_WRITE;
+            break;
+#endif
+
+        case APP_EEPROM_STATE_WRITE:
 
-            if (appEEPROMData.transferStatus == DRV_I2C_TRANSFER_EVENT_COMPLETE)
+            /* Check if temperature data is ready to be written to EEPROM */
+            if (appEEPROMData.isTemperatureReady == true)
             {
-                /* Add a dummy write to verify whether transfer is complete
-                 * If EEPROM is busy, it will NACK the I2C transfer */
-                appEEPROMData.transferStatus = DRV_I2C_TRANSFER_EVENT_PENDING;
+                SYS_CONSOLE_PRINT("Writing temperature to EEPROM...");
 
-                DRV_I2C_WriteTransferAdd(appEEPROMData.i2cHandle,
-                    APP_EEPROM_SLAVE_ADDR,
-                    (void *)&appEEPROMData.dummyData,
-                    1,
-                    &appEEPROMData.transferHandle
-                );
+                appEEPROMData.isTemperatureReady = false;
+                appEEPROMData.transferStatus = DRV_I2C_EEPROM_TRANSFER_BUSY;
 
-                if (appEEPROMData.transferHandle == DRV_I2C_TRANSFER_HANDLE_INVALID)
+                /* Write temperature data to EEPROM. The driver waits for the
+                 * write cycle of the previous write before sending it. */
+                if (DRV_I2C_EEPROM_Write(appEEPROMData.eepromHandle,
+                    (void *)&appEEPROMData.temperature,
+                    1,
+                    APP_EEPROM_START_MEMORY_ADDR + appEEPROMData.currentWriteIndex) == false)
                 {
                     appEEPROMData.state = APP_EEPROM_STATE_ERROR;
                 }
@@ -240,36 +438,26 @@ void APP_I2C_EEPROM_Tasks ( void )
                 {
                     appEEPROMData.state = APP_EEPROM_STATE_WAIT_WRITE_COMPLETE;
                 }
-            }
-            else if (appEEPROMData.transferStatus == DRV_I2C_TRANSFER_EVENT_ERROR)
-            {
-                appEEPROMData.state = APP_EEPROM_STATE_ERROR;
+
+                appEEPROMData.currentWriteIndex++;
+                if (appEEPROMData.currentWriteIndex >= APP_EEPROM_NUM_TEMP_VALUES_TO_SAVE)
+                {
+                    /* Only last 5 values are saved in EEPROM and then over-written again */
+                    appEEPROMData.currentWriteIndex = 0;
+                }
             }
             break;
 
         case APP_EEPROM_STATE_WAIT_WRITE_COMPLETE:
 
-            if (appEEPROMData.transferStatus == DRV_I2C_TRANSFER_EVENT_COMPLETE)
+            if (appEEPROMData.transferStatus == DRV_I2C_EEPROM_TRANSFER_COMPLETED)
             {
                 SYS_CONSOLE_PRINT("Done!!!\r\n\r\n");
                 appEEPROMData.state = APP_EEPROM_STATE_CHECK_READ_REQ;
             }
-            else if (appEEPROMData.transferStatus == DRV_I2C_TRANSFER_EVENT_ERROR)
+            else if (appEEPROMData.transferStatus == DRV_I2C_EEPROM_TRANSFER_ERROR_UNKNOWN)
             {
-                /* Add a dummy write to verify whether write cycle is complete */
-                appEEPROMData.transferStatus = DRV_I2C_TRANSFER_EVENT_PENDING;
-
-                DRV_I2C_WriteTransferAdd(appEEPROMData.i2cHandle,
-                    APP_EEPROM_SLAVE_ADDR,
-                    (void *)&appEEPROMData.dummyData,
-                    1,
-                    &appEEPROMData.transferHandle
-                );
-
-                if (appEEPROMData.transferHandle == DRV_I2C_TRANSFER_HANDLE_INVALID)
-                {
-                    appEEPROMData.state = APP_EEPROM_STATE_ERROR;
-                }
+                appEEPROMData.state = APP_EEPROM_STATE_ERROR;
             }
             break;
 
@@ -287,21 +475,13 @@ void APP_I2C_EEPROM_Tasks ( void )
 
         case APP_EEPROM_STATE_READ:
 
-            /* Add read transfer to read data from EEPROM */
-            appEEPROMData.txBuffer[0] = APP_EEPROM_START_MEMORY_ADDR;
+            appEEPROMData.transferStatus = DRV_I2C_EEPROM_TRANSFER_BUSY;
 
-            appEEPROMData.transferStatus = DRV_I2C_TRANSFER_EVENT_PENDING;
-
-            DRV_I2C_WriteReadTransferAdd(appEEPROMData.i2cHandle,
-                APP_EEPROM_SLAVE_ADDR,
-                (void *)&appEEPROMData.txBuffer[0],
-                1,
+            /* Read data from EEPROM, once the last write cycle has ended */
+            if (DRV_I2C_EEPROM_Read(appEEPROMData.eepromHandle,
                 (void *)&appEEPROMData.rxBuffer[0],
                 APP_EEPROM_NUM_TEMP_VALUES_TO_SAVE,
-                &appEEPROMData.transferHandle
-            );
-
-            if (appEEPROMData.transferHandle == DRV_I2C_TRANSFER_HANDLE_INVALID)
+                APP_EEPROM_START_MEMORY_ADDR) == false)
             {
                 appEEPROMData.state = APP_EEPROM_STATE_ERROR;
             }
@@ -314,7 +494,7 @@ void APP_I2C_EEPROM_Tasks ( void )
         case APP_EEPROM_STATE_WAIT_READ_COMPLETE:
 
             /* Print the results */
-            if (appEEPROMData.transferStatus == DRV_I2C_TRANSFER_EVENT_COMPLETE)
+            if (appEEPROMData.transferStatus == DRV_I2C_EEPROM_TRANSFER_COMPLETED)
             {
                 /* Print the read values - oldest value first, latest value last*/
                 for (nTempDataPrinted = 0, i = appEEPROMData.currentWriteIndex; \
@@ -327,7 +507,7 @@ void APP_I2C_EEPROM_Tasks ( void )
                 /* Go back waiting for a temperature write request */
                 appEEPROMData.state = APP_EEPROM_STATE_WRITE;               
             }
-            else if (appEEPROMData.transferStatus == DRV_I2C_TRANSFER_EVENT_ERROR)
+            else if (appEEPROMData.transferStatus == DRV_I2C_EEPROM_TRANSFER_ERROR_UNKNOWN)
             {
                 appEEPROMData.state = APP_EEPROM_STATE_ERROR;
             }
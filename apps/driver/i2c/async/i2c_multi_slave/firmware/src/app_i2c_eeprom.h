@@ -58,7 +58,7 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include "configuration.h"
-#include "driver/i2c/drv_i2c.h"
+#include "driver/i2c_eeprom/drv_i2c_eeprom.h"
 #include "system/console/sys_console.h"
 
 // DOM-IGNORE-BEGIN
@@ -75,6 +75,21 @@ extern "C" {
 // *****************************************************************************
 // *****************************************************************************
 #define APP_EEPROM_NUM_TEMP_VALUES_TO_SAVE          5
+
+/* Define APP_I2C_DMA_BENCHMARK_ENABLE, here or in the project settings, to
+ * measure the CPU time taken by the I2C transfers before the demo starts. The
+ * EEPROM is read back and rewritten with its own contents, which costs
+ * APP_I2C_BENCHMARK_ROUNDS write cycles per page at each start-up. */
+/* #define APP_I2C_DMA_BENCHMARK_ENABLE */
+
+#if defined(APP_I2C_DMA_BENCHMARK_ENABLE)
+/* Reads and rewrites of the whole EEPROM timed by the benchmark */
+#define APP_I2C_BENCHMARK_ROUNDS                    (4U)
+
+/* Transfers of one round: the read of the EEPROM, then one write per page */
+#define APP_I2C_BENCHMARK_PAGES                     (DRV_I2C_EEPROM_SIZE_IDX0 / DRV_I2C_EEPROM_PAGE_SIZE_IDX0)
+#define APP_I2C_BENCHMARK_STEPS                     (APP_I2C_BENCHMARK_ROUNDS * (APP_I2C_BENCHMARK_PAGES + 1U))
+#endif
 // *****************************************************************************
 /* Application states
 
@@ -91,13 +106,25 @@ typedef enum
     /* Initial state. */
     APP_EEPROM_STATE_INIT,
 
+#if defined(APP_I2C_DMA_BENCHMARK_ENABLE)
+    /* Time the idle loop used to measure the CPU time of the transfers */
+    APP_EEPROM_STATE_BENCHMARK_CALIBRATE,
+
+    /* Wait for the write cycle of the previous page to end */
+    APP_EEPROM_STATE_BENCHMARK_FLUSH,
+    APP_EEPROM_STATE_BENCHMARK_WAIT_FLUSH,
+
+    /* Time the next read or page write */
+    APP_EEPROM_STATE_BENCHMARK_TRANSFER,
+
+    /* Print the results */
+    APP_EEPROM_STATE_BENCHMARK_REPORT,
+#endif
+
     /* Write temperature data to EERPOM */
     APP_EEPROM_STATE_WRITE,
 
-    /* Wait for EEPROM write transfer to complete */
-    APP_EEPROM_STATE_WAIT_TRANSFER_COMPLETE,
-
-    /* Wait for EEPROM's internal write cycle to complete */
+    /* Wait for the EEPROM to accept the write */
     APP_EEPROM_STATE_WAIT_WRITE_COMPLETE,
 
     /* Check if user requested to read the temperature data from EEPROM */
@@ -135,20 +162,14 @@ typedef struct
     /* Application's current state */
     APP_EEPROM_STATES  state;
 
-    /* I2C driver client handle */
-    DRV_HANDLE i2cHandle;
+    /* I2C EEPROM driver client handle */
+    DRV_HANDLE eepromHandle;
     
     SYS_CONSOLE_HANDLE consoleHandle;
 
-    /* I2C driver transfer handle */
-    DRV_I2C_TRANSFER_HANDLE transferHandle;
-
     /* Variable to hold the character entered on the console */
     uint8_t consoleData;
 
-    /* Buffer to hold temperature data to be written to EEPROM */
-    uint8_t txBuffer[2];
-
     /* Buffer to hold temperature data read from EEPROM */
     uint8_t rxBuffer[APP_EEPROM_NUM_TEMP_VALUES_TO_SAVE];
 
@@ -156,14 +177,32 @@ typedef struct
     uint8_t temperature;
 
     /* Variable to hold transfer status of every transfer */
-    volatile DRV_I2C_TRANSFER_EVENT transferStatus;
+    volatile DRV_I2C_EEPROM_TRANSFER_STATUS transferStatus;
 
     /* Flag to indicate whether temperature is read from the temperature sensor */
     volatile bool isTemperatureReady;
       
     uint32_t currentWriteIndex;
 
-    uint8_t dummyData;
+#if defined(APP_I2C_DMA_BENCHMARK_ENABLE)
+    /* Copy of the EEPROM, written back page by page */
+    uint8_t benchmarkBuffer[DRV_I2C_EEPROM_SIZE_IDX0];
+
+    /* CPU cycles of one turn of the idle loop, 8 fractional bits */
+    uint32_t idleTurnCycles;
+
+    /* Next transfer of the benchmark, 0 to APP_I2C_BENCHMARK_STEPS */
+    uint32_t benchmarkStep;
+
+    /* Bytes moved, elapsed and busy CPU cycles of the reads (DMA) and of the
+     * page writes (interrupt per byte) */
+    uint32_t readBytes;
+    uint32_t readCycles;
+    uint32_t readCpuCycles;
+    uint32_t writeBytes;
+    uint32_t writeCycles;
+    uint32_t writeCpuCycles;
+#endif
 
 } APP_EEPROM_DATA;
 
@@ -54,15 +54,19 @@
 
 #include "app_i2c_temp_sensor.h"
 #include "system/console/sys_console.h"
+#include "definitions.h"
 // *****************************************************************************
 // *****************************************************************************
 // Section: Global Data Definitions
 // *****************************************************************************
 // *****************************************************************************
-#define APP_TEMP_I2C_CLOCK_SPEED                    400000
-#define APP_TEMP_SLAVE_ADDR                         0x004F
-#define APP_TEMP_TEMPERATURE_REG_ADDR               0x00
-#define APP_TEMP_SAMPLING_TIME                      1000
+/* Index of the temperature sensor in the I2C sampler sensor table. The sensor
+ * address, register and sampling period are set in initialization.c. */
+#define APP_TEMP_SAMPLER_SENSOR_INDEX               0U
+
+/* Number of temperature readings between two dumps of the I2C driver
+ * statistics */
+#define APP_TEMP_STATISTICS_PRINT_PERIOD            10U
 
 // *****************************************************************************
 /* Application Data
@@ -112,29 +116,6 @@ APP_TEMP_DATA appTempData;
 // *****************************************************************************
 // *****************************************************************************
 
-static void APP_I2C_TEMP_SENSOR_TimerCallback ( uintptr_t context )
-{
-    appTempData.tmrExpired = true;
-}
-
-static void APP_I2C_TEMP_SENSOR_EventHandler(
-    DRV_I2C_TRANSFER_EVENT event,
-    DRV_I2C_TRANSFER_HANDLE transferHandle,
-    uintptr_t context
-)
-{
-    switch(event)
-    {
-        case DRV_I2C_TRANSFER_EVENT_COMPLETE:
-            appTempData.isTransferDone = true;
-            break;
-        case DRV_I2C_TRANSFER_EVENT_ERROR:
-            appTempData.state = APP_TEMP_STATE_ERROR;
-            break;
-        default:
-            break;
-    }
-}
 /*******************************************************************************
   Function:
     void APP_I2C_TEMP_SENSOR_Initialize ( void )
@@ -147,9 +128,9 @@ void APP_I2C_TEMP_SENSOR_Initialize ( void )
 {
     /* Initialize the Temperature Sensor Application data */
     appTempData.state          = APP_TEMP_STATE_INIT;
-    appTempData.i2cHandle      = DRV_HANDLE_INVALID;
-    appTempData.transferHandle = DRV_I2C_TRANSFER_HANDLE_INVALID;
-    appTempData.tmrExpired     = false;
+    appTempData.sampleCursor   = 0;
+    appTempData.errorCount     = 0;
+    appTempData.nReadings      = 0;
 }
 
 /******************************************************************************
@@ -162,6 +143,8 @@ void APP_I2C_TEMP_SENSOR_Initialize ( void )
 
 void APP_I2C_TEMP_SENSOR_Tasks ( void )
 {
+    SYS_I2C_SAMPLER_SAMPLE sample;
+    uint32_t errorCount;
     int16_t temp;
 
     /* Check the application's current state. */
@@ -169,74 +152,60 @@ void APP_I2C_TEMP_SENSOR_Tasks ( void )
     {
         case APP_TEMP_STATE_INIT:
 
-            /* Open I2C driver client */
-            appTempData.i2cHandle = DRV_I2C_Open( DRV_I2C_INDEX_0, DRV_IO_INTENT_READWRITE );
-            if (appTempData.i2cHandle != DRV_HANDLE_INVALID)
+            /* The I2C sampler reads the sensor, wait for it to be running */
+            switch (SYS_I2C_SAMPLER_Status(sysObj.sysI2CSampler0))
             {
-                /* Register the I2C Driver client event callback */
-                DRV_I2C_TransferEventHandlerSet(appTempData.i2cHandle, APP_I2C_TEMP_SENSOR_EventHandler, 0);
+                case SYS_STATUS_READY:
+                    appTempData.sampleCursor = SYS_I2C_SAMPLER_SampleCursorGet(sysObj.sysI2CSampler0);
+                    appTempData.state = APP_TEMP_STATE_READ_TEMPERATURE;
+                    break;
 
-                /* Register the Periodic Timer callback */
-                appTempData.tmrHandle = SYS_TIME_CallbackRegisterMS(APP_I2C_TEMP_SENSOR_TimerCallback, 0, APP_TEMP_SAMPLING_TIME, SYS_TIME_PERIODIC);
-                if (appTempData.tmrHandle == SYS_TIME_HANDLE_INVALID)
-                {
-                    /* Could not start a periodic timer */
+                case SYS_STATUS_BUSY:
+                    break;
+
+                default:
                     appTempData.state = APP_TEMP_STATE_ERROR;
-                }
-                else
-                {
-                    appTempData.state = APP_TEMP_STATE_READ_TEMPERATURE;
-                }                                
-            }
-            else
-            {
-                appTempData.state = APP_TEMP_STATE_ERROR;
+                    break;
             }
             break;
 
         case APP_TEMP_STATE_READ_TEMPERATURE:
 
-            if (appTempData.tmrExpired == true)
-            {
-                appTempData.tmrExpired = false;
-
-                SYS_CONSOLE_PRINT("Reading temperature from sensor...");
-
-                /* Initiate a read transfer to read temperature value from temperature sensor */
-                appTempData.registerAddr = APP_TEMP_TEMPERATURE_REG_ADDR;
-
-                DRV_I2C_WriteReadTransferAdd(appTempData.i2cHandle, APP_TEMP_SLAVE_ADDR, (void*)&appTempData.registerAddr, 1, (void *)appTempData.rxBuffer, 2, &appTempData.transferHandle );
+            errorCount = SYS_I2C_SAMPLER_SensorErrorCountGet(sysObj.sysI2CSampler0, APP_TEMP_SAMPLER_SENSOR_INDEX);
 
-                if (appTempData.transferHandle != DRV_I2C_TRANSFER_HANDLE_INVALID)
-                {
-                    appTempData.state = APP_TEMP_STATE_WAIT_TRANSFER_COMPLETE;
-                }
-                else
-                {
-                    appTempData.state = APP_TEMP_STATE_ERROR;
-                }
+            if (errorCount != appTempData.errorCount)
+            {
+                appTempData.errorCount = errorCount;
+                SYS_CONSOLE_PRINT("Temperature Sensor Read Error \r\n");
             }
-            break;
 
-        case APP_TEMP_STATE_WAIT_TRANSFER_COMPLETE:
-
-            if (appTempData.isTransferDone == true)
+            while (SYS_I2C_SAMPLER_SampleGet(sysObj.sysI2CSampler0, &appTempData.sampleCursor, &sample) == true)
             {
-                appTempData.isTransferDone = false;
+                if (sample.sensorIndex != APP_TEMP_SAMPLER_SENSOR_INDEX)
+                {
+                    continue;
+                }
 
                 // Convert the temperature value read from sensor to readable format (Degree Celsius)
                 // For demonstration purpose, temperature value is assumed to be positive.
                 // The maximum positive temperature measured by sensor is +125 C
-                temp = (appTempData.rxBuffer[0] << 8) | appTempData.rxBuffer[1];
+                temp = (sample.data[0] << 8) | sample.data[1];
                 temp = (temp >> 7) * 0.5;
                 appTempData.temperature = (uint8_t)temp;
 
-                SYS_CONSOLE_PRINT("%d C\r\n", appTempData.temperature);
+                SYS_CONSOLE_PRINT("Temperature: %d C\r\n", appTempData.temperature);
 
                 /* Notify EEPROM application that temperature data is available */
                 APP_EEPROM_Notify(appTempData.temperature);
 
-                appTempData.state = APP_TEMP_STATE_READ_TEMPERATURE;
+                appTempData.nReadings++;
+
+#if defined(DRV_I2C_STATISTICS_ENABLE)
+                if ((appTempData.nReadings % APP_TEMP_STATISTICS_PRINT_PERIOD) == 0U)
+                {
+                    DRV_I2C_StatisticsPrint(DRV_I2C_INDEX_0);
+                }
+#endif
             }
             break;
 
@@ -57,8 +57,7 @@
 #include <stddef.h>
 #include <stdlib.h>
 #include "configuration.h"
-#include "driver/i2c/drv_i2c.h"
-#include "system/time/sys_time.h"
+#include "system/i2c_sampler/sys_i2c_sampler.h"
 
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus  // Provide C++ Compatibility
@@ -94,9 +93,6 @@ typedef enum
     /* Read Temperature state */
     APP_TEMP_STATE_READ_TEMPERATURE,
 
-    /* Wait for read transfer to complete state */
-    APP_TEMP_STATE_WAIT_TRANSFER_COMPLETE,
-
     /* Error state */
     APP_TEMP_STATE_ERROR,
 
@@ -123,28 +119,17 @@ typedef struct
     /* Application's current state */
     APP_TEMP_STATES  state;
 
-    /* I2C driver client handle */
-    DRV_HANDLE i2cHandle;
-
-    /* I2C driver transfer handle */
-    DRV_I2C_TRANSFER_HANDLE transferHandle;
-    
-    /* Handle to periodic system timer */
-    SYS_TIME_HANDLE tmrHandle;
+    /* Read cursor in the I2C sampler ring buffer */
+    uint32_t sampleCursor;
 
-    /* buffer to hold temperature queried from sensor */
-    uint8_t rxBuffer[2];
-
-    /* flag to check whether read transfer is done */
-    volatile bool isTransferDone;
+    /* Number of failed temperature sensor reads already reported */
+    uint32_t errorCount;
 
     /* temperature value in degree celcius */
     uint8_t temperature;
 
-    /* flag to indicate timer expiry*/
-    volatile bool tmrExpired;
-
-    uint8_t registerAddr;
+    /* Number of temperature readings received */
+    uint32_t nReadings;
 } APP_TEMP_DATA;
 
 // *****************************************************************************
@@ -96,6 +96,17 @@ extern "C" {
 
 #define SYS_CONSOLE_INDEX_0                       0
 
+/* I2C Sampler System Service Instance 0 Configuration Options */
+#define SYS_I2C_SAMPLER_INDEX_0                       0
+#define SYS_I2C_SAMPLER_CLOCK_SPEED_IDX0              400000
+#define SYS_I2C_SAMPLER_TICK_PERIOD_MS_IDX0           100U
+#define SYS_I2C_SAMPLER_RING_SIZE_IDX0                8U
+
+/* I2C Sampler System Service Common Configuration Options */
+#define SYS_I2C_SAMPLER_INSTANCES_NUMBER              (1U)
+#define SYS_I2C_SAMPLER_SENSORS_MAX                   (4U)
+#define SYS_I2C_SAMPLER_DATA_SIZE_MAX                 (4U)
+
 
 
 
@@ -114,6 +125,23 @@ extern "C" {
 
 /* I2C Driver Common Configuration Options */
 #define DRV_I2C_INSTANCES_NUMBER              (1U)
+#define DRV_I2C_STATISTICS_ENABLE
+#define DRV_I2C_STATISTICS_SLAVES_MAX         (4U)
+
+/* I2C EEPROM Driver Instance 0 Configuration Options */
+#define DRV_I2C_EEPROM_INDEX_0                        0
+#define DRV_I2C_EEPROM_SLAVE_ADDR_IDX0                0x0057
+#define DRV_I2C_EEPROM_CLOCK_SPEED_IDX0               400000
+#define DRV_I2C_EEPROM_SIZE_IDX0                      256U
+#define DRV_I2C_EEPROM_PAGE_SIZE_IDX0                 16U
+#define DRV_I2C_EEPROM_ADDRESS_BYTES_IDX0             1U
+#define DRV_I2C_EEPROM_WRITE_CYCLE_TIME_US_IDX0       5000U
+#define DRV_I2C_EEPROM_ACK_POLL_DELAY_US_IDX0         3000U
+#define DRV_I2C_EEPROM_ACK_POLL_INTERVAL_MIN_US_IDX0  250U
+#define DRV_I2C_EEPROM_ACK_POLL_INTERVAL_MAX_US_IDX0  1000U
+
+/* I2C EEPROM Driver Common Configuration Options */
+#define DRV_I2C_EEPROM_INSTANCES_NUMBER               (1U)
 
 
 
@@ -53,12 +53,15 @@
 #include "peripheral/port/plib_port.h"
 #include "peripheral/clock/plib_clock.h"
 #include "peripheral/nvic/plib_nvic.h"
+#include "peripheral/dmac/plib_dmac.h"
 #include "peripheral/pm/plib_pm.h"
 #include "peripheral/sercom/i2c_master/plib_sercom5_i2c_master.h"
 #include "peripheral/sercom/usart/plib_sercom4_usart.h"
 #include "peripheral/tc/plib_tc0.h"
 #include "driver/i2c/drv_i2c.h"
+#include "driver/i2c_eeprom/drv_i2c_eeprom.h"
 #include "system/time/sys_time.h"
+#include "system/i2c_sampler/sys_i2c_sampler.h"
 #include "system/console/sys_console.h"
 #include "system/console/src/sys_console_uart_definitions.h"
 #include "bsp/bsp.h"
@@ -200,8 +203,12 @@ typedef struct
     /* I2C0 Driver Object */
     SYS_MODULE_OBJ drvI2C0;
 
+    /* I2C EEPROM Driver Object */
+    SYS_MODULE_OBJ drvI2CEEPROM0;
+
     SYS_MODULE_OBJ  sysTime;
     SYS_MODULE_OBJ  sysConsole0;
+    SYS_MODULE_OBJ  sysI2CSampler0;
 
 
 } SYSTEM_OBJECTS;
@@ -111,6 +111,22 @@ typedef uintptr_t DRV_I2C_TRANSFER_HANDLE;
 
 #define DRV_I2C_TRANSFER_HANDLE_INVALID  ((DRV_I2C_TRANSFER_HANDLE)(-1))
 
+// *****************************************************************************
+/* I2C Driver Invalid Segment Index
+
+  Summary:
+    Definition of an invalid segment index.
+
+  Description:
+    Returned by DRV_I2C_TransactionFailedSegmentGet when the failed segment of
+    a transaction is not known.
+
+  Remarks:
+    None
+*/
+
+#define DRV_I2C_SEGMENT_INDEX_INVALID    ((uint32_t)0xFFFFFFFFU)
+
 // *****************************************************************************
 /* I2C Driver Transfer Events
 
@@ -478,6 +494,13 @@ void DRV_I2C_Close( const DRV_HANDLE handle );
     setup like clock speed. The DRV_I2C_TransferSetup function must be called
     before submitting any I2C driver read/write requests.
 
+    The peripheral settings of the clock speed are computed here, once, and
+    kept with the client. When the queue moves from a transfer of a client to
+    a transfer of a client using another speed, the driver only writes these
+    settings to the peripheral. Speeds above 400 kHz select the Fast-mode Plus
+    (up to 1 MHz) or the High-speed mode (up to 3.4 MHz) if the peripheral
+    library supports them.
+
   Preconditions:
     DRV_I2C_Open must have been called to obtain a valid opened device handle.
     In case of asynchronous driver, all transfer requests from the queue must
@@ -489,7 +512,8 @@ void DRV_I2C_Close( const DRV_HANDLE handle );
     setup       - Pointer to the structure containing the new configuration settings
 
   Returns:
-    None.
+    true  - The setup was saved
+    false - The handle is invalid or the clock speed is not supported
 
   Example:
     <code>
@@ -501,7 +525,8 @@ void DRV_I2C_Close( const DRV_HANDLE handle );
     </code>
 
   Remarks:
-    None.
+    High-speed transfers start with a master code sent at 400 kHz. Their reads
+    are limited to 255 bytes and must end with a STOP.
 */
 
 bool DRV_I2C_TransferSetup( const DRV_HANDLE handle, DRV_I2C_TRANSFER_SETUP* setup);
@@ -543,6 +568,51 @@ bool DRV_I2C_TransferSetup( const DRV_HANDLE handle, DRV_I2C_TRANSFER_SETUP* set
 
 DRV_I2C_ERROR DRV_I2C_ErrorGet( const DRV_I2C_TRANSFER_HANDLE transferHandle );
 
+// *****************************************************************************
+/* Function:
+    uint32_t DRV_I2C_TransactionFailedSegmentGet( const DRV_I2C_TRANSFER_HANDLE transferHandle )
+
+   Summary:
+    Gets the segment on which a failed transaction stopped.
+
+   Description:
+    This function returns the index, in the segment array given to
+    DRV_I2C_TransactionAdd, of the segment that was on the bus when the
+    transaction failed. The segments before it have completed, the segments
+    after it have not been sent.
+
+   Precondition:
+    DRV_I2C_Open must have been called to obtain a valid opened device handle.
+
+   Parameters:
+    transferHandle - A valid handle to a transaction request.
+
+   Returns:
+    Index of the failed segment. DRV_I2C_SEGMENT_INDEX_INVALID if the handle
+    is not valid or not the handle of a transaction, if the transaction has not
+    failed, or if the PLib does not report the segment index.
+
+  Example:
+    <code>
+    void APP_I2CEventHandler(DRV_I2C_TRANSFER_EVENT event,
+        DRV_I2C_TRANSFER_HANDLE transferHandle, uintptr_t context)
+    {
+        uint32_t failedSegment;
+
+        if (event == DRV_I2C_TRANSFER_EVENT_ERROR)
+        {
+            failedSegment = DRV_I2C_TransactionFailedSegmentGet(transferHandle);
+        }
+    }
+    </code>
+
+  Remarks:
+    The handle is only valid until the transfer object is reused. Call this
+    function from the transfer event handler, before queueing a new request.
+*/
+
+uint32_t DRV_I2C_TransactionFailedSegmentGet( const DRV_I2C_TRANSFER_HANDLE transferHandle );
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: I2C Driver Asynchronous(Queuing Model) Transfer Interface Routines
@@ -899,6 +969,108 @@ void DRV_I2C_WriteReadTransferAdd (
     DRV_I2C_TRANSFER_HANDLE * const transferHandle
 );
 
+// *****************************************************************************
+/* Function:
+    void DRV_I2C_TransactionAdd (
+        const DRV_HANDLE handle,
+        const uint16_t address,
+        DRV_I2C_SEGMENT * const segments,
+        const size_t nSegments,
+        DRV_I2C_TRANSFER_HANDLE * const transferHandle
+    )
+
+  Summary:
+    Queues a transaction made of several write and read segments.
+
+  Description:
+    This function schedules a non-blocking transaction made of an array of
+    write and read segments. The segments address the given slave, unless
+    DRV_I2C_SEGMENT_FLAG_ADDRESS selects another slave for a segment. They are
+    executed back to back as one entry of the driver transfer queue, with the
+    START, repeated START and STOP conditions selected by the flags of each
+    segment (see DRV_I2C_SEGMENT_FLAGS). A transaction is completed, or fails,
+    as a whole and gives a single event.
+
+    This covers the device protocols that the fixed read, write and
+    write-read shapes cannot express, for example a register pointer write
+    followed by a separate data write without a repeated START, or several
+    reads under one repeated START sequence.
+
+    On returning, the transferHandle parameter may be
+    DRV_I2C_TRANSFER_HANDLE_INVALID for the following reasons:
+    - if a buffer could not be allocated to the request
+    - if the segments pointer is NULL or nSegments is 0
+    - if a segment has a NULL buffer or a size of 0
+    - if DRV_I2C_SEGMENT_FLAG_NO_START is set on the first segment, on a read
+      segment, on a segment with DRV_I2C_SEGMENT_FLAG_ADDRESS or after a read
+      segment or a segment ending with a STOP
+    - if the peripheral library does not support multi-segment transfers
+
+    If the requesting client registered an event callback with the driver, the
+    driver will issue a DRV_I2C_TRANSFER_EVENT_COMPLETE event if all the
+    segments were processed successfully or a DRV_I2C_TRANSFER_EVENT_ERROR event
+    otherwise.
+
+  Precondition:
+    DRV_I2C_Open must have been called to obtain a valid opened device handle.
+
+  Parameters:
+    handle - A valid open-instance handle, returned from the driver's open routine
+    DRV_I2C_Open function.
+
+    address - Slave address of the segments without
+    DRV_I2C_SEGMENT_FLAG_ADDRESS
+
+    segments - Array of segments. The array and the segment buffers are owned
+    by the driver until the transaction completes.
+
+    nSegments - Number of segments in the array.
+
+    transferHandle - Pointer to an argument that will contain the return
+    transfer handle. This will be DRV_I2C_TRANSFER_HANDLE_INVALID if the
+    function was not successful.
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+    uint8_t regAddr = MY_REGISTER;
+    uint8_t myTxBuffer[MY_TX_BUFFER_SIZE];
+    DRV_I2C_TRANSFER_HANDLE transferHandle;
+
+    DRV_I2C_SEGMENT segments[2] =
+    {
+        { &regAddr, 1, DRV_I2C_SEGMENT_FLAG_WRITE },
+        { myTxBuffer, MY_TX_BUFFER_SIZE, DRV_I2C_SEGMENT_FLAG_WRITE | DRV_I2C_SEGMENT_FLAG_NO_START },
+    };
+
+    DRV_I2C_TransactionAdd(myI2CHandle, slaveAddress, segments, 2, &transferHandle);
+
+    if(transferHandle == DRV_I2C_TRANSFER_HANDLE_INVALID)
+    {
+
+    }
+
+    </code>
+
+  Remarks:
+    This function is thread safe in a RTOS application. It can be called from
+    within the I2C Driver Transfer Event Handler that is registered by this
+    client. It should not be called in the event handler associated with another
+    I2C driver instance. It should not otherwise be called directly in an ISR.
+    This function is available only in the asynchronous mode.
+
+*/
+
+void DRV_I2C_TransactionAdd (
+    const DRV_HANDLE handle,
+    const uint16_t address,
+    DRV_I2C_SEGMENT * const segments,
+    const size_t nSegments,
+    DRV_I2C_TRANSFER_HANDLE * const transferHandle
+);
+
 // *****************************************************************************
 /* Function:
     void DRV_I2C_TransferEventHandlerSet
@@ -1359,6 +1531,210 @@ bool DRV_I2C_WriteReadTransfer (
 */
 void DRV_I2C_QueuePurge(const DRV_HANDLE handle);
 
+#if defined(DRV_I2C_STATISTICS_ENABLE)
+// *****************************************************************************
+// *****************************************************************************
+// Section: I2C Driver Statistics Interface
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* Function:
+    bool DRV_I2C_StatisticsGet(const SYS_MODULE_INDEX drvIndex, DRV_I2C_STATISTICS* stats)
+
+  Summary:
+    Returns the transfer statistics of a driver instance.
+
+  Description:
+    This function returns the statistics of all the transfers completed by the
+    driver instance since it was initialized or since the last call to
+    DRV_I2C_StatisticsReset, whichever client queued them.
+
+  Precondition:
+    DRV_I2C_Initialize must have been called for the specified I2C driver
+    instance.
+
+  Parameters:
+    drvIndex - Identifier for the instance of the I2C driver
+
+    stats - Pointer to the structure receiving the statistics
+
+  Returns:
+    true - stats has been updated
+
+    false - the driver instance is not ready or stats is NULL
+
+  Example:
+    <code>
+    DRV_I2C_STATISTICS stats;
+
+    if (DRV_I2C_StatisticsGet(DRV_I2C_INDEX_0, &stats) == true)
+    {
+        // stats.busTimeAvgUs holds the average time on the bus
+    }
+    </code>
+
+  Remarks:
+    Available when DRV_I2C_STATISTICS_ENABLE is defined.
+*/
+bool DRV_I2C_StatisticsGet(const SYS_MODULE_INDEX drvIndex, DRV_I2C_STATISTICS* stats);
+
+// *****************************************************************************
+/* Function:
+    bool DRV_I2C_ClientStatisticsGet(const DRV_HANDLE handle, DRV_I2C_STATISTICS* stats)
+
+  Summary:
+    Returns the transfer statistics of a client.
+
+  Description:
+    This function returns the statistics of the transfers queued by the client
+    since it opened the driver or since the last call to
+    DRV_I2C_StatisticsReset.
+
+  Precondition:
+    DRV_I2C_Open must have been called to obtain a valid opened device handle.
+
+  Parameters:
+    handle - A valid open-instance handle, returned from the driver's open
+    routine
+
+    stats - Pointer to the structure receiving the statistics
+
+  Returns:
+    true - stats has been updated
+
+    false - the handle is not valid or stats is NULL
+
+  Example:
+    <code>
+    DRV_I2C_STATISTICS stats;
+
+    if (DRV_I2C_ClientStatisticsGet(myI2CHandle, &stats) == true)
+    {
+        // stats.queueTimeMaxUs holds the longest wait behind other clients
+    }
+    </code>
+
+  Remarks:
+    Available when DRV_I2C_STATISTICS_ENABLE is defined.
+*/
+bool DRV_I2C_ClientStatisticsGet(const DRV_HANDLE handle, DRV_I2C_STATISTICS* stats);
+
+// *****************************************************************************
+/* Function:
+    bool DRV_I2C_SlaveStatisticsGet(const SYS_MODULE_INDEX drvIndex,
+        const uint16_t address, DRV_I2C_STATISTICS* stats)
+
+  Summary:
+    Returns the transfer statistics of a slave.
+
+  Description:
+    This function returns the statistics of the transfers addressed to a slave
+    since the first transfer to it after initialization or after the last call
+    to DRV_I2C_StatisticsReset. The segments of a transaction queued with
+    DRV_I2C_TransactionAdd are accounted to the slave each segment addresses:
+    every slave visited counts one transfer with the bytes of its segments and
+    a share of the bus time in proportion to them, and an error counts against
+    the slave of the segment that failed only. Segments not reached because
+    of the error are not accounted. The driver tracks up to DRV_I2C_STATISTICS_SLAVES_MAX slave
+    addresses, in the order they are first seen.
+
+  Precondition:
+    DRV_I2C_Initialize must have been called for the specified I2C driver
+    instance.
+
+  Parameters:
+    drvIndex - Identifier for the instance of the I2C driver
+
+    address - Slave address
+
+    stats - Pointer to the structure receiving the statistics
+
+  Returns:
+    true - stats has been updated
+
+    false - the slave is not tracked, the driver instance is not ready or stats
+    is NULL
+
+  Example:
+    <code>
+    DRV_I2C_STATISTICS stats;
+
+    if (DRV_I2C_SlaveStatisticsGet(DRV_I2C_INDEX_0, 0x57, &stats) == true)
+    {
+        // stats.nNackErrors holds the number of transfers NACKed by the slave
+    }
+    </code>
+
+  Remarks:
+    Available when DRV_I2C_STATISTICS_ENABLE is defined.
+*/
+bool DRV_I2C_SlaveStatisticsGet(const SYS_MODULE_INDEX drvIndex, const uint16_t address, DRV_I2C_STATISTICS* stats);
+
+// *****************************************************************************
+/* Function:
+    void DRV_I2C_StatisticsReset(const SYS_MODULE_INDEX drvIndex)
+
+  Summary:
+    Clears the transfer statistics of a driver instance.
+
+  Description:
+    This function clears the statistics of the driver instance, of its clients
+    and of its slaves, and restarts the time base of the bus utilization.
+
+  Precondition:
+    DRV_I2C_Initialize must have been called for the specified I2C driver
+    instance.
+
+  Parameters:
+    drvIndex - Identifier for the instance of the I2C driver
+
+  Returns:
+    None
+
+  Example:
+    <code>
+    DRV_I2C_StatisticsReset(DRV_I2C_INDEX_0);
+    </code>
+
+  Remarks:
+    Available when DRV_I2C_STATISTICS_ENABLE is defined.
+*/
+void DRV_I2C_StatisticsReset(const SYS_MODULE_INDEX drvIndex);
+
+// *****************************************************************************
+/* Function:
+    void DRV_I2C_StatisticsPrint(const SYS_MODULE_INDEX drvIndex)
+
+  Summary:
+    Prints the transfer statistics of a driver instance on the console.
+
+  Description:
+    This function prints the statistics of the driver instance followed by the
+    statistics of each tracked slave, using SYS_CONSOLE_PRINT.
+
+  Precondition:
+    DRV_I2C_Initialize must have been called for the specified I2C driver
+    instance. The console system service must be initialized.
+
+  Parameters:
+    drvIndex - Identifier for the instance of the I2C driver
+
+  Returns:
+    None
+
+  Example:
+    <code>
+    DRV_I2C_StatisticsPrint(DRV_I2C_INDEX_0);
+    </code>
+
+  Remarks:
+    Available when DRV_I2C_STATISTICS_ENABLE is defined.
+    This function should not be called from an interrupt context.
+*/
+void DRV_I2C_StatisticsPrint(const SYS_MODULE_INDEX drvIndex);
+#endif
+
 /* MISRAC 2012 deviation block end */
 
 //DOM-IGNORE-BEGIN
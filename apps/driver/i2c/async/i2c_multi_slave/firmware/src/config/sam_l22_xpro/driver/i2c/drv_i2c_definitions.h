@@ -91,6 +91,31 @@ typedef struct
 
 } DRV_I2C_TRANSFER_SETUP;
 
+// *****************************************************************************
+/* I2C Driver Baud Setup
+
+  Summary:
+    Holds the peripheral settings of one bus speed
+
+  Description:
+    This data type holds the register settings computed by the PLIB for the
+    clock speed of a client. The driver computes them once per client and
+    applies them as they are when the bus switches to the client's speed.
+
+  Remarks:
+    The content is PLIB specific.
+*/
+
+typedef struct
+{
+    /* Baud register value */
+    uint32_t baud;
+
+    /* Speed mode settings */
+    uint32_t mode;
+
+} DRV_I2C_BAUD_SETUP;
+
 // *****************************************************************************
 /* I2C Driver Error
 
@@ -117,6 +142,125 @@ typedef enum
 
 } DRV_I2C_ERROR;
 
+// *****************************************************************************
+/* I2C Driver Transaction Segment Flags
+
+  Summary:
+    Defines the flags controlling a transaction segment
+
+  Description:
+    This data type defines the flags of one segment of a transaction queued
+    with DRV_I2C_TransactionAdd. A segment starts with a START (a repeated
+    START if the previous segment did not end with a STOP) followed by the
+    slave address, unless DRV_I2C_SEGMENT_FLAG_NO_START continues the write of
+    the previous segment. The last segment always ends with a STOP.
+
+  Remarks:
+    None.
+*/
+
+typedef enum
+{
+    /* Segment writes to the slave */
+    DRV_I2C_SEGMENT_FLAG_WRITE = 0,
+
+    /* Segment reads from the slave */
+    DRV_I2C_SEGMENT_FLAG_READ = 1 << 0,
+
+    /* Send a STOP after the segment */
+    DRV_I2C_SEGMENT_FLAG_STOP = 1 << 1,
+
+    /* Write segment sent right after the previous write segment, without a
+     * repeated START and slave address. The previous segment must be a write
+     * without DRV_I2C_SEGMENT_FLAG_STOP. */
+    DRV_I2C_SEGMENT_FLAG_NO_START = 1 << 2,
+
+    /* Segment addresses the slave given in its address field instead of the
+     * slave address passed to DRV_I2C_TransactionAdd. Lets one transaction
+     * visit several slaves. Not allowed with DRV_I2C_SEGMENT_FLAG_NO_START. */
+    DRV_I2C_SEGMENT_FLAG_ADDRESS = 1 << 3,
+
+} DRV_I2C_SEGMENT_FLAGS;
+
+// *****************************************************************************
+/* I2C Driver Transaction Segment
+
+  Summary:
+    Defines one segment of a transaction
+
+  Description:
+    This data type defines one data phase of a transaction queued with
+    DRV_I2C_TransactionAdd.
+
+  Remarks:
+    None.
+*/
+
+typedef struct
+{
+    /* Data to be written or buffer where the read data is stored */
+    void*                           buffer;
+
+    /* Number of bytes, at least one */
+    size_t                          size;
+
+    /* Any combination of DRV_I2C_SEGMENT_FLAGS */
+    uint32_t                        flags;
+
+    /* Slave address used with DRV_I2C_SEGMENT_FLAG_ADDRESS */
+    uint16_t                        address;
+
+} DRV_I2C_SEGMENT;
+
+// *****************************************************************************
+/* I2C Driver Transfer Statistics
+
+  Summary:
+    Holds the transfer statistics of a driver instance, client or slave
+
+  Description:
+    This data type holds the statistics returned by DRV_I2C_StatisticsGet,
+    DRV_I2C_ClientStatisticsGet and DRV_I2C_SlaveStatisticsGet. The queue time
+    of a transfer runs from the call of the transfer add function to the start
+    of the transfer on the bus, the bus time from the start of the transfer to
+    its completion.
+
+  Remarks:
+    Available when DRV_I2C_STATISTICS_ENABLE is defined.
+*/
+
+typedef struct
+{
+    /* Number of completed transfers, including the failed ones */
+    uint32_t                        nTransfers;
+
+    /* Number of transfers that failed with DRV_I2C_ERROR_NACK */
+    uint32_t                        nNackErrors;
+
+    /* Number of transfers that failed with DRV_I2C_ERROR_BUS */
+    uint32_t                        nBusErrors;
+
+    /* Number of bytes of the successful transfers */
+    uint32_t                        nBytes;
+
+    /* Time spent in the driver queue, in microseconds */
+    uint32_t                        queueTimeMinUs;
+    uint32_t                        queueTimeAvgUs;
+    uint32_t                        queueTimeMaxUs;
+
+    /* Time spent on the bus, in microseconds */
+    uint32_t                        busTimeMinUs;
+    uint32_t                        busTimeAvgUs;
+    uint32_t                        busTimeMaxUs;
+
+    /* Throughput of the successful transfers while on the bus */
+    uint32_t                        bytesPerSecond;
+
+    /* Share of the time since the last reset spent on the bus, in percent */
+    uint32_t                        busUtilization;
+
+} DRV_I2C_STATISTICS;
+
 
 typedef void (* DRV_I2C_PLIB_CALLBACK)( uintptr_t contextHandle);
 
@@ -127,12 +271,20 @@ typedef bool (* DRV_I2C_PLIB_WRITE)( uint16_t address, uint8_t *pdata, uint32_t
 
 typedef bool (* DRV_I2C_PLIB_WRITE_READ)( uint16_t address, uint8_t *wdata, uint32_t wlength, uint8_t *rdata, uint32_t rlength );
 
+typedef bool (* DRV_I2C_PLIB_TRANSFER_SEGMENTS)( uint16_t address, DRV_I2C_SEGMENT *segments, uint32_t nSegments );
+
+typedef uint32_t (* DRV_I2C_PLIB_SEGMENT_INDEX_GET)(void);
+
 typedef void (* DRV_I2C_PLIB_TRANSFER_ABORT) (void);
 
 typedef DRV_I2C_ERROR (* DRV_I2C_PLIB_ERROR_GET)( void );
 
 typedef bool (* DRV_I2C_PLIB_TRANSFER_SETUP)(DRV_I2C_TRANSFER_SETUP* setup, uint32_t srcClkFreq);
 
+typedef bool (* DRV_I2C_PLIB_BAUD_CALCULATE)(DRV_I2C_TRANSFER_SETUP* setup, uint32_t srcClkFreq, DRV_I2C_BAUD_SETUP* baudSetup);
+
+typedef void (* DRV_I2C_PLIB_BAUD_SET)(DRV_I2C_BAUD_SETUP* baudSetup);
+
 typedef void (* DRV_I2C_PLIB_CALLBACK_REGISTER)(DRV_I2C_PLIB_CALLBACK callback, uintptr_t contextHandle);
 
 typedef struct
@@ -195,6 +347,19 @@ typedef struct
     /* I2C PLib callback register API */
     DRV_I2C_PLIB_CALLBACK_REGISTER              callbackRegister;
 
+    /* I2C PLib multi-segment transfer API, NULL if not supported */
+    DRV_I2C_PLIB_TRANSFER_SEGMENTS              transferSegments;
+
+    /* I2C PLib segment in progress, or failed, NULL if not supported.
+     * Without it a failed transaction is accounted to its first segment. */
+    DRV_I2C_PLIB_SEGMENT_INDEX_GET              segmentIndexGet;
+
+    /* I2C PLib baud calculation and baud set APIs, NULL if not supported.
+     * Without them the speed is recomputed on every client switch. */
+    DRV_I2C_PLIB_BAUD_CALCULATE                 baudCalculate;
+
+    DRV_I2C_PLIB_BAUD_SET                       baudSet;
+
 } DRV_I2C_PLIB_INTERFACE;
 
 // *****************************************************************************
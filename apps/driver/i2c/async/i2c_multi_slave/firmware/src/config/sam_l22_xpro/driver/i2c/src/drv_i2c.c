@@ -48,6 +48,10 @@
 #include "configuration.h"
 #include "driver/i2c/drv_i2c.h"
 #include "system/debug/sys_debug.h"
+#if defined(DRV_I2C_STATISTICS_ENABLE)
+#include <string.h>
+#include "system/console/sys_console.h"
+#endif
 
 // *****************************************************************************
 // *****************************************************************************
@@ -345,12 +349,305 @@ static void lDRV_I2C_RemoveClientTransfersFromList(
     }
 }
 
+#if defined(DRV_I2C_STATISTICS_ENABLE)
+/* Returns the number of bytes moved by a transfer */
+static uint32_t lDRV_I2C_TransferSizeGet(const DRV_I2C_TRANSFER_OBJ* transferObj)
+{
+    size_t nBytes = transferObj->writeSize + transferObj->readSize;
+    size_t i;
+
+    if (transferObj->flag == DRV_I2C_TRANSFER_OBJ_FLAG_SEGMENTS)
+    {
+        for (i = 0U; i < transferObj->nSegments; i++)
+        {
+            nBytes += transferObj->segments[i].size;
+        }
+    }
+
+    return (uint32_t)nBytes;
+}
+
+/* Returns the statistics entry of a slave address, allocating a free entry
+ * on the first transfer to the address if allocate is true */
+static DRV_I2C_STATISTICS_DATA* lDRV_I2C_SlaveStatisticsDataGet(DRV_I2C_OBJ* dObj, uint16_t address, bool allocate)
+{
+    DRV_I2C_SLAVE_STATISTICS* freeEntry = NULL;
+    uint32_t i;
+
+    for (i = 0U; i < DRV_I2C_STATISTICS_SLAVES_MAX; i++)
+    {
+        if (dObj->slaveStatistics[i].inUse == false)
+        {
+            if (freeEntry == NULL)
+            {
+                freeEntry = &dObj->slaveStatistics[i];
+            }
+        }
+        else if (dObj->slaveStatistics[i].address == address)
+        {
+            return &dObj->slaveStatistics[i].data;
+        }
+        else
+        {
+            /* Entry of another slave */
+        }
+    }
+
+    if ((allocate == false) || (freeEntry == NULL))
+    {
+        /* Unknown slave or no entry left */
+        return NULL;
+    }
+
+    (void) memset(freeEntry, 0, sizeof(DRV_I2C_SLAVE_STATISTICS));
+    freeEntry->inUse = true;
+    freeEntry->address = address;
+
+    return &freeEntry->data;
+}
+
+static void lDRV_I2C_StatisticsDataUpdate(
+    DRV_I2C_STATISTICS_DATA* data,
+    DRV_I2C_ERROR errors,
+    uint32_t nBytes,
+    uint32_t queueCount,
+    uint32_t busCount
+)
+{
+    if ((data->nTransfers == 0U) || (queueCount < data->queueCountMin))
+    {
+        data->queueCountMin = queueCount;
+    }
+    if (queueCount > data->queueCountMax)
+    {
+        data->queueCountMax = queueCount;
+    }
+    if ((data->nTransfers == 0U) || (busCount < data->busCountMin))
+    {
+        data->busCountMin = busCount;
+    }
+    if (busCount > data->busCountMax)
+    {
+        data->busCountMax = busCount;
+    }
+
+    data->queueCountTotal += queueCount;
+    data->busCountTotal += busCount;
+    data->nTransfers++;
+
+    if (errors == DRV_I2C_ERROR_NACK)
+    {
+        data->nNackErrors++;
+    }
+    else if (errors == DRV_I2C_ERROR_BUS)
+    {
+        data->nBusErrors++;
+    }
+    else
+    {
+        data->nBytes += nBytes;
+    }
+}
+
+/* Slave address of a segment of a transaction */
+static uint16_t lDRV_I2C_SegmentAddressGet(const DRV_I2C_TRANSFER_OBJ* transferObj, size_t index)
+{
+    const DRV_I2C_SEGMENT* segment = &transferObj->segments[index];
+
+    if ((segment->flags & (uint32_t)DRV_I2C_SEGMENT_FLAG_ADDRESS) != 0U)
+    {
+        return segment->address;
+    }
+
+    return transferObj->slaveAddress;
+}
+
+/* Accounts a finished transaction to each slave its segments address. Each
+ * slave counts one transfer with the bytes of its segments and the share of
+ * the bus time of its segments, weighted by their size plus the address byte.
+ * An error is accounted to the slave of the failed segment only; the segments
+ * after it did not run. */
+static void lDRV_I2C_SegmentsStatisticsUpdate(
+    DRV_I2C_OBJ* dObj,
+    const DRV_I2C_TRANSFER_OBJ* transferObj,
+    uint32_t queueCount,
+    uint32_t busCount
+)
+{
+    DRV_I2C_STATISTICS_DATA* slaveData;
+    DRV_I2C_ERROR errors;
+    size_t nSegments = transferObj->nSegments;
+    size_t failedIndex = transferObj->nSegments;
+    size_t i;
+    size_t j;
+    uint32_t totalWeight = 0U;
+    uint32_t weight;
+    uint32_t nBytes;
+    uint16_t address;
+    bool isVisited;
+
+    if (transferObj->errors != DRV_I2C_ERROR_NONE)
+    {
+        failedIndex = 0U;
+
+        if (transferObj->failedSegment != DRV_I2C_SEGMENT_INDEX_INVALID)
+        {
+            failedIndex = (size_t)transferObj->failedSegment;
+        }
+
+        nSegments = failedIndex + 1U;
+    }
+
+    for (i = 0U; i < nSegments; i++)
+    {
+        totalWeight += (uint32_t)transferObj->segments[i].size + 1U;
+    }
+
+    for (i = 0U; i < nSegments; i++)
+    {
+        address = lDRV_I2C_SegmentAddressGet(transferObj, i);
+        isVisited = false;
+
+        /* Each slave is accounted once, at its first segment */
+        for (j = 0U; j < i; j++)
+        {
+            if (lDRV_I2C_SegmentAddressGet(transferObj, j) == address)
+            {
+                isVisited = true;
+                break;
+            }
+        }
+
+        if (isVisited == true)
+        {
+            continue;
+        }
+
+        errors = DRV_I2C_ERROR_NONE;
+        weight = 0U;
+        nBytes = 0U;
+
+        for (j = i; j < nSegments; j++)
+        {
+            if (lDRV_I2C_SegmentAddressGet(transferObj, j) == address)
+            {
+                nBytes += (uint32_t)transferObj->segments[j].size;
+                weight += (uint32_t)transferObj->segments[j].size + 1U;
+
+                if (j == failedIndex)
+                {
+                    errors = transferObj->errors;
+                }
+            }
+        }
+
+        slaveData = lDRV_I2C_SlaveStatisticsDataGet(dObj, address, true);
+
+        if (slaveData != NULL)
+        {
+            lDRV_I2C_StatisticsDataUpdate(slaveData, errors, nBytes, queueCount,
+                (uint32_t)(((uint64_t)busCount * weight) / totalWeight));
+        }
+    }
+}
+
+/* Accounts a finished transfer to the instance, the client (if still open)
+ * and the slave. Called with the transfer errors already updated. */
+static void lDRV_I2C_StatisticsUpdate(DRV_I2C_OBJ* dObj, DRV_I2C_CLIENT_OBJ* clientObj, const DRV_I2C_TRANSFER_OBJ* transferObj)
+{
+    DRV_I2C_STATISTICS_DATA* slaveData;
+    uint32_t completedCount = SYS_TIME_CounterGet();
+    uint32_t queueCount = transferObj->startedCount - transferObj->queuedCount;
+    uint32_t busCount = completedCount - transferObj->startedCount;
+    uint32_t nBytes = lDRV_I2C_TransferSizeGet(transferObj);
+
+    lDRV_I2C_StatisticsDataUpdate(&dObj->statistics, transferObj->errors, nBytes, queueCount, busCount);
+
+    if (clientObj != NULL)
+    {
+        lDRV_I2C_StatisticsDataUpdate(&clientObj->statistics, transferObj->errors, nBytes, queueCount, busCount);
+    }
+
+    if (transferObj->flag == DRV_I2C_TRANSFER_OBJ_FLAG_SEGMENTS)
+    {
+        lDRV_I2C_SegmentsStatisticsUpdate(dObj, transferObj, queueCount, busCount);
+    }
+    else
+    {
+        slaveData = lDRV_I2C_SlaveStatisticsDataGet(dObj, transferObj->slaveAddress, true);
+
+        if (slaveData != NULL)
+        {
+            lDRV_I2C_StatisticsDataUpdate(slaveData, transferObj->errors, nBytes, queueCount, busCount);
+        }
+    }
+}
+
+/* Converts the raw statistics to the format returned to the application */
+static void lDRV_I2C_StatisticsConvert(
+    const DRV_I2C_STATISTICS_DATA* data,
+    uint64_t elapsedCount,
+    DRV_I2C_STATISTICS* stats
+)
+{
+    (void) memset(stats, 0, sizeof(DRV_I2C_STATISTICS));
+
+    stats->nTransfers  = data->nTransfers;
+    stats->nNackErrors = data->nNackErrors;
+    stats->nBusErrors  = data->nBusErrors;
+    stats->nBytes      = data->nBytes;
+
+    if (data->nTransfers == 0U)
+    {
+        return;
+    }
+
+    stats->queueTimeMinUs = SYS_TIME_CountToUS(data->queueCountMin);
+    stats->queueTimeAvgUs = SYS_TIME_CountToUS((uint32_t)(data->queueCountTotal / data->nTransfers));
+    stats->queueTimeMaxUs = SYS_TIME_CountToUS(data->queueCountMax);
+    stats->busTimeMinUs   = SYS_TIME_CountToUS(data->busCountMin);
+    stats->busTimeAvgUs   = SYS_TIME_CountToUS((uint32_t)(data->busCountTotal / data->nTransfers));
+    stats->busTimeMaxUs   = SYS_TIME_CountToUS(data->busCountMax);
+
+    if (data->busCountTotal != 0U)
+    {
+        stats->bytesPerSecond = (uint32_t)(((uint64_t)data->nBytes * SYS_TIME_FrequencyGet()) / data->busCountTotal);
+    }
+
+    if (elapsedCount != 0U)
+    {
+        stats->busUtilization = (uint32_t)((data->busCountTotal * 100U) / elapsedCount);
+    }
+}
+#endif
+
+/* Records the segment a failed transaction stopped on. Called with the
+ * transfer errors already updated. */
+static void lDRV_I2C_FailedSegmentUpdate(const DRV_I2C_OBJ* dObj, DRV_I2C_TRANSFER_OBJ* transferObj)
+{
+    uint32_t failedIndex = DRV_I2C_SEGMENT_INDEX_INVALID;
+
+    if ((transferObj->flag == DRV_I2C_TRANSFER_OBJ_FLAG_SEGMENTS) &&
+        (transferObj->errors != DRV_I2C_ERROR_NONE) && (dObj->i2cPlib->segmentIndexGet != NULL))
+    {
+        failedIndex = dObj->i2cPlib->segmentIndexGet();
+
+        if (failedIndex >= (uint32_t)transferObj->nSegments)
+        {
+            failedIndex = (uint32_t)transferObj->nSegments - 1U;
+        }
+    }
+
+    transferObj->failedSegment = failedIndex;
+}
+
 static void lDRV_I2C_ClientCallback(DRV_I2C_OBJ* dObj, DRV_I2C_CLIENT_OBJ* clientObj, DRV_I2C_TRANSFER_OBJ* transferObj)
 {
     DRV_I2C_TRANSFER_EVENT event;
     DRV_I2C_TRANSFER_HANDLE transferHandle;
 
     transferObj->errors = dObj->i2cPlib->errorGet();
+    lDRV_I2C_FailedSegmentUpdate(dObj, transferObj);
 
     if(transferObj->errors == DRV_I2C_ERROR_NONE)
     {
@@ -361,6 +658,10 @@ static void lDRV_I2C_ClientCallback(DRV_I2C_OBJ* dObj, DRV_I2C_CLIENT_OBJ* clien
         transferObj->event = DRV_I2C_TRANSFER_EVENT_ERROR;
     }
 
+#if defined(DRV_I2C_STATISTICS_ENABLE)
+    lDRV_I2C_StatisticsUpdate(dObj, clientObj, transferObj);
+#endif
+
     /* Save the transfer handle and event locally before freeing the transfer object*/
     event = transferObj->event;
     transferHandle = transferObj->transferHandle;
@@ -381,6 +682,76 @@ static void lDRV_I2C_ClientCallback(DRV_I2C_OBJ* dObj, DRV_I2C_CLIENT_OBJ* clien
     }
 }
 
+/* Computes the peripheral settings of the client's transfer setup */
+static void lDRV_I2C_ClientBaudSetupUpdate(DRV_I2C_OBJ* dObj, DRV_I2C_CLIENT_OBJ* clientObj)
+{
+    clientObj->isBaudSetupValid = false;
+
+    if (dObj->i2cPlib->baudCalculate != NULL)
+    {
+        clientObj->isBaudSetupValid = dObj->i2cPlib->baudCalculate(&clientObj->transferSetup, 0, &clientObj->baudSetup);
+    }
+}
+
+/* Switches the bus to the client's speed if the previous transfer ran at
+ * another speed */
+static void lDRV_I2C_ClientTransferSetupApply(DRV_I2C_OBJ* dObj, DRV_I2C_CLIENT_OBJ* clientObj)
+{
+    if (dObj->currentTransferSetup.clockSpeed == clientObj->transferSetup.clockSpeed)
+    {
+        return;
+    }
+
+    if ((dObj->i2cPlib->baudSet != NULL) && (clientObj->isBaudSetupValid == true))
+    {
+        /* Apply the settings computed when the client set its speed */
+        dObj->i2cPlib->baudSet(&clientObj->baudSetup);
+    }
+    else
+    {
+        /* Set the new transfer setup */
+        (void) dObj->i2cPlib->transferSetup(&clientObj->transferSetup, 0);
+    }
+
+    dObj->currentTransferSetup.clockSpeed = clientObj->transferSetup.clockSpeed;
+}
+
+static bool lDRV_I2C_TransferStart(DRV_I2C_OBJ* dObj, DRV_I2C_TRANSFER_OBJ* transferObj)
+{
+    bool transferStatus = true;
+
+    transferObj->currentState = DRV_I2C_TRANSFER_OBJ_IS_PROCESSING;
+
+#if defined(DRV_I2C_STATISTICS_ENABLE)
+    transferObj->startedCount = SYS_TIME_CounterGet();
+#endif
+
+    switch(transferObj->flag)
+    {
+        case DRV_I2C_TRANSFER_OBJ_FLAG_RD:
+            transferStatus = dObj->i2cPlib->read_t(transferObj->slaveAddress, transferObj->readBuffer, transferObj->readSize);
+            break;
+
+        case DRV_I2C_TRANSFER_OBJ_FLAG_WR:
+            transferStatus = dObj->i2cPlib->write_t(transferObj->slaveAddress, transferObj->writeBuffer, transferObj->writeSize);
+            break;
+
+        case DRV_I2C_TRANSFER_OBJ_FLAG_WR_RD:
+            transferStatus = dObj->i2cPlib->writeRead(transferObj->slaveAddress, transferObj->writeBuffer, transferObj->writeSize, transferObj->readBuffer, transferObj->readSize);
+            break;
+
+        case DRV_I2C_TRANSFER_OBJ_FLAG_SEGMENTS:
+            transferStatus = dObj->i2cPlib->transferSegments(transferObj->slaveAddress, transferObj->segments, (uint32_t)transferObj->nSegments);
+            break;
+
+        default:
+            /* Execution should never enter the default case */
+            break;
+    }
+
+    return transferStatus;
+}
+
 static void lDRV_I2C_NextTransferInitiate(DRV_I2C_OBJ* dObj, DRV_I2C_CLIENT_OBJ* clientObj)
 {
     DRV_I2C_TRANSFER_OBJ* transferObj = NULL;
@@ -400,34 +771,10 @@ static void lDRV_I2C_NextTransferInitiate(DRV_I2C_OBJ* dObj, DRV_I2C_CLIENT_OBJ*
             clientObj = &((DRV_I2C_CLIENT_OBJ *)gDrvI2CObj[((transferObj->clientHandle & DRV_I2C_INSTANCE_MASK) >> 8)].clientObjPool)
                         [transferObj->clientHandle & DRV_I2C_INDEX_MASK];
 
-            /* Check if the transfer setup for this client is different than the current transfer setup */
-            if (dObj->currentTransferSetup.clockSpeed != clientObj->transferSetup.clockSpeed)
-            {
-                /* Set the new transfer setup */
-                (void) dObj->i2cPlib->transferSetup(&clientObj->transferSetup, 0);
+            lDRV_I2C_ClientTransferSetupApply(dObj, clientObj);
 
-                dObj->currentTransferSetup.clockSpeed = clientObj->transferSetup.clockSpeed;
-            }
+            transferStatus = lDRV_I2C_TransferStart(dObj, transferObj);
 
-            switch(transferObj->flag)
-            {
-                case DRV_I2C_TRANSFER_OBJ_FLAG_RD:
-                    transferObj->currentState = DRV_I2C_TRANSFER_OBJ_IS_PROCESSING;
-                    transferStatus = dObj->i2cPlib->read_t(transferObj->slaveAddress, transferObj->readBuffer, transferObj->readSize);
-                    break;
-
-                case DRV_I2C_TRANSFER_OBJ_FLAG_WR:
-                    transferObj->currentState = DRV_I2C_TRANSFER_OBJ_IS_PROCESSING;
-                    transferStatus = dObj->i2cPlib->write_t(transferObj->slaveAddress, transferObj->writeBuffer, transferObj->writeSize);
-                    break;
-                    case DRV_I2C_TRANSFER_OBJ_FLAG_WR_RD:
-                    transferObj->currentState = DRV_I2C_TRANSFER_OBJ_IS_PROCESSING;
-                    transferStatus = dObj->i2cPlib->writeRead(transferObj->slaveAddress, transferObj->writeBuffer, transferObj->writeSize, transferObj->readBuffer, transferObj->readSize);
-                    break;
-                default:
-                    /* Execution should never enter the default case */
-                    break;
-            }
             if (transferStatus == false)
             {
                 lDRV_I2C_ClientCallback(dObj, clientObj, transferObj);
@@ -464,6 +811,11 @@ static void lDRV_I2C_PLibCallbackHandler( uintptr_t contextHandle )
     else
     {
         /* The client has probably closed the driver. Free the completed buffer */
+#if defined(DRV_I2C_STATISTICS_ENABLE)
+        transferObj->errors = dObj->i2cPlib->errorGet();
+        lDRV_I2C_FailedSegmentUpdate(dObj, transferObj);
+        lDRV_I2C_StatisticsUpdate(dObj, NULL, transferObj);
+#endif
         lDRV_I2C_RemoveTransferObjFromList(dObj);
     }
 
@@ -625,8 +977,12 @@ DRV_HANDLE DRV_I2C_Open(
             tempioIntent = (uint32_t)ioIntent | (uint32_t)DRV_IO_INTENT_NONBLOCKING;
             clientObj->ioIntent                 = (DRV_IO_INTENT)(tempioIntent);
             clientObj->transferSetup.clockSpeed = dObj->initI2CClockSpeed;
+            lDRV_I2C_ClientBaudSetupUpdate(dObj, clientObj);
             clientObj->eventHandler             = NULL;
             clientObj->context                  = 0U;
+#if defined(DRV_I2C_STATISTICS_ENABLE)
+            (void) memset(&clientObj->statistics, 0, sizeof(DRV_I2C_STATISTICS_DATA));
+#endif
 
             return ((DRV_HANDLE) clientObj->clientHandle );
         }
@@ -727,6 +1083,8 @@ void DRV_I2C_TransferEventHandlerSet(
 bool DRV_I2C_TransferSetup( const DRV_HANDLE handle, DRV_I2C_TRANSFER_SETUP* setup )
 {
     DRV_I2C_CLIENT_OBJ* clientObj = NULL;
+    DRV_I2C_OBJ* dObj = NULL;
+    DRV_I2C_BAUD_SETUP baudSetup = {0};
 
     if(setup == NULL)
     {
@@ -741,8 +1099,32 @@ bool DRV_I2C_TransferSetup( const DRV_HANDLE handle, DRV_I2C_TRANSFER_SETUP* set
         return false;
     }
 
+    dObj = &gDrvI2CObj[clientObj->drvIndex];
+
+    /* Compute the peripheral settings once here rather than on every switch
+     * to this client's speed */
+    if (dObj->i2cPlib->baudCalculate != NULL)
+    {
+        if (dObj->i2cPlib->baudCalculate(setup, 0, &baudSetup) == false)
+        {
+            /* Speed not supported by the peripheral */
+            return false;
+        }
+    }
+
+    /* The settings are applied from the PLIB interrupt when the queue moves
+     * to a transfer of this client */
+    if(lDRV_I2C_ResourceLock(dObj) == false)
+    {
+        return false;
+    }
+
     /* Save the client specific transfer setup */
     clientObj->transferSetup = *setup;
+    clientObj->baudSetup = baudSetup;
+    clientObj->isBaudSetupValid = (dObj->i2cPlib->baudCalculate != NULL);
+
+    lDRV_I2C_ResourceUnlock(dObj);
 
     return true;
 }
@@ -787,6 +1169,89 @@ DRV_I2C_ERROR DRV_I2C_ErrorGet( const DRV_I2C_TRANSFER_HANDLE transferHandle )
     return errors;
 }
 
+uint32_t DRV_I2C_TransactionFailedSegmentGet( const DRV_I2C_TRANSFER_HANDLE transferHandle )
+{
+    DRV_I2C_OBJ* dObj = NULL;
+    uint32_t drvInstance = 0;
+    uint8_t transferIndex;
+    uint32_t failedSegment = DRV_I2C_SEGMENT_INDEX_INVALID;
+
+    /* Extract driver instance value from the transfer handle */
+    drvInstance = ((transferHandle & DRV_I2C_INSTANCE_MASK) >> 8);
+
+    if(drvInstance >= DRV_I2C_INSTANCES_NUMBER)
+    {
+        return failedSegment;
+    }
+
+    dObj = (DRV_I2C_OBJ*)&gDrvI2CObj[drvInstance];
+
+    if(lDRV_I2C_ResourceLock(dObj) == false)
+    {
+        return failedSegment;
+    }
+
+    /* Extract transfer buffer index value from the transfer handle */
+    transferIndex = (uint8_t)(transferHandle & DRV_I2C_INDEX_MASK);
+
+    /* Validate the transferIndex and corresponding request */
+    if(transferIndex < dObj->transferObjPoolSize)
+    {
+        if(transferHandle == dObj->transferObjPool[transferIndex].transferHandle)
+        {
+            failedSegment = dObj->transferObjPool[transferIndex].failedSegment;
+        }
+    }
+
+    lDRV_I2C_ResourceUnlock(dObj);
+
+    return failedSegment;
+}
+
+static void lDRV_I2C_TransferObjSubmit(
+    DRV_I2C_OBJ* dObj,
+    DRV_I2C_CLIENT_OBJ* clientObj,
+    DRV_I2C_TRANSFER_OBJ* transferObj,
+    DRV_I2C_TRANSFER_HANDLE* const transferHandle
+)
+{
+    *transferHandle = transferObj->transferHandle;
+
+#if defined(DRV_I2C_STATISTICS_ENABLE)
+    transferObj->queuedCount = SYS_TIME_CounterGet();
+#endif
+
+    /* Add the buffer object to the transfer buffer list */
+    if (lDRV_I2C_TransferObjAddToList(dObj, transferObj) == true)
+    {
+        /* This is the first request in the queue, hence initiate a PLIB transfer */
+
+        lDRV_I2C_ClientTransferSetupApply(dObj, clientObj);
+
+        if (lDRV_I2C_TransferStart(dObj, transferObj) == false)
+        {
+            *transferHandle = DRV_I2C_TRANSFER_HANDLE_INVALID;
+            transferObj->errors = dObj->i2cPlib->errorGet();
+            lDRV_I2C_FailedSegmentUpdate(dObj, transferObj);
+
+            if(transferObj->errors == DRV_I2C_ERROR_NONE)
+            {
+                transferObj->event = DRV_I2C_TRANSFER_EVENT_COMPLETE;
+            }
+            else
+            {
+                transferObj->event = DRV_I2C_TRANSFER_EVENT_ERROR;
+            }
+
+#if defined(DRV_I2C_STATISTICS_ENABLE)
+            lDRV_I2C_StatisticsUpdate(dObj, clientObj, transferObj);
+#endif
+
+            lDRV_I2C_RemoveTransferObjFromList(dObj);
+        }
+    }
+}
+
 static void lDRV_I2C_WriteReadTransferAdd (
     const DRV_HANDLE handle,
     const uint16_t address,
@@ -801,7 +1266,6 @@ static void lDRV_I2C_WriteReadTransferAdd (
     DRV_I2C_CLIENT_OBJ* clientObj = NULL;
     DRV_I2C_OBJ* dObj = NULL;
     DRV_I2C_TRANSFER_OBJ* transferObj = NULL;
-    bool transferError = false;
 
     /* Validate the transfer handle */
     if (transferHandle == NULL)
@@ -864,83 +1328,15 @@ static void lDRV_I2C_WriteReadTransferAdd (
     transferObj->readSize     = readSize;
     transferObj->writeBuffer  = ( uint8_t *)writeBuffer;
     transferObj->writeSize    = writeSize;
+    transferObj->segments     = NULL;
+    transferObj->nSegments    = 0U;
     transferObj->clientHandle = handle;
     transferObj->errors       = DRV_I2C_ERROR_NONE;
     transferObj->currentState = DRV_I2C_TRANSFER_OBJ_IS_IN_QUEUE;
     transferObj->event        = DRV_I2C_TRANSFER_EVENT_PENDING;
     transferObj->flag         = transferFlags;
 
-    *transferHandle = transferObj->transferHandle;
-
-    /* Add the buffer object to the transfer buffer list */
-    if (lDRV_I2C_TransferObjAddToList(dObj, transferObj) == true)
-    {
-        /* This is the first request in the queue, hence initiate a PLIB transfer */
-
-        /* Check if the transfer setup for this client is different than the current transfer setup */
-        if (dObj->currentTransferSetup.clockSpeed != clientObj->transferSetup.clockSpeed)
-        {
-            /* Set the new transfer setup */
-            (void) dObj->i2cPlib->transferSetup(&clientObj->transferSetup, 0);
-
-            dObj->currentTransferSetup.clockSpeed = clientObj->transferSetup.clockSpeed;
-        }
-
-        transferObj->currentState = DRV_I2C_TRANSFER_OBJ_IS_PROCESSING;
-
-        if (transferFlags == DRV_I2C_TRANSFER_OBJ_FLAG_RD)
-        {
-            if (dObj->i2cPlib->read_t(
-                transferObj->slaveAddress,
-                transferObj->readBuffer,
-                transferObj->readSize
-            ) == false)
-            {
-                transferError = true;
-            }
-        }
-        else if (transferFlags == DRV_I2C_TRANSFER_OBJ_FLAG_WR)
-        {
-            if (dObj->i2cPlib->write_t(
-                transferObj->slaveAddress,
-                transferObj->writeBuffer,
-                transferObj->writeSize
-            ) == false)
-            {
-                transferError = true;
-            }
-        }
-        else
-        {
-            if (dObj->i2cPlib->writeRead(
-                transferObj->slaveAddress,
-                transferObj->writeBuffer,
-                transferObj->writeSize,
-                transferObj->readBuffer,
-                transferObj->readSize
-            ) == false)
-            {
-                transferError = true;
-            }
-        }
-
-        if (transferError == true)
-        {
-            *transferHandle = DRV_I2C_TRANSFER_HANDLE_INVALID;
-            transferObj->errors = dObj->i2cPlib->errorGet();
-
-            if(transferObj->errors == DRV_I2C_ERROR_NONE)
-            {
-                transferObj->event = DRV_I2C_TRANSFER_EVENT_COMPLETE;
-            }
-            else
-            {
-                transferObj->event = DRV_I2C_TRANSFER_EVENT_ERROR;
-            }
-
-            lDRV_I2C_RemoveTransferObjFromList(dObj);
-        }
-    }
+    lDRV_I2C_TransferObjSubmit(dObj, clientObj, transferObj, transferHandle);
 
     lDRV_I2C_ResourceUnlock(dObj);
 }
@@ -983,6 +1379,113 @@ void DRV_I2C_WriteReadTransferAdd (
         readBuffer, readSize, transferHandle, DRV_I2C_TRANSFER_OBJ_FLAG_WR_RD);
 }
 
+static bool lDRV_I2C_SegmentsValidate(const DRV_I2C_SEGMENT* segments, const size_t nSegments)
+{
+    size_t index;
+    uint32_t prevFlags = 0U;
+
+    if((segments == NULL) || (nSegments == 0U))
+    {
+        return false;
+    }
+
+    for(index = 0; index < nSegments; index++)
+    {
+        if((segments[index].buffer == NULL) || (segments[index].size == 0U))
+        {
+            return false;
+        }
+
+        /* A segment without START only extends the write of the previous segment */
+        if((segments[index].flags & (uint32_t)DRV_I2C_SEGMENT_FLAG_NO_START) != 0U)
+        {
+            if((index == 0U) ||
+               ((segments[index].flags & ((uint32_t)DRV_I2C_SEGMENT_FLAG_READ | (uint32_t)DRV_I2C_SEGMENT_FLAG_ADDRESS)) != 0U) ||
+               ((prevFlags & ((uint32_t)DRV_I2C_SEGMENT_FLAG_READ | (uint32_t)DRV_I2C_SEGMENT_FLAG_STOP)) != 0U))
+            {
+                return false;
+            }
+        }
+
+        prevFlags = segments[index].flags;
+    }
+
+    return true;
+}
+
+void DRV_I2C_TransactionAdd (
+    const DRV_HANDLE handle,
+    const uint16_t address,
+    DRV_I2C_SEGMENT* const segments,
+    const size_t nSegments,
+    DRV_I2C_TRANSFER_HANDLE* const transferHandle
+)
+{
+    DRV_I2C_CLIENT_OBJ* clientObj = NULL;
+    DRV_I2C_OBJ* dObj = NULL;
+    DRV_I2C_TRANSFER_OBJ* transferObj = NULL;
+
+    /* Validate the transfer handle */
+    if (transferHandle == NULL)
+    {
+        return;
+    }
+
+    *transferHandle = DRV_I2C_TRANSFER_HANDLE_INVALID;
+
+    /* Validate the driver handle */
+    clientObj = lDRV_I2C_DriverHandleValidate(handle);
+    if(clientObj == NULL)
+    {
+        return;
+    }
+
+    if (lDRV_I2C_SegmentsValidate(segments, nSegments) == false)
+    {
+        return;
+    }
+
+    /* Get the driver object from the client handle */
+    dObj = &gDrvI2CObj[clientObj->drvIndex];
+
+    if (dObj->i2cPlib->transferSegments == NULL)
+    {
+        return;
+    }
+
+    if(lDRV_I2C_ResourceLock(dObj) == false)
+    {
+        return;
+    }
+
+    /* Get a free transfer object */
+    transferObj = lDRV_I2C_FreeTransferObjGet(clientObj);
+
+    if(transferObj == NULL)
+    {
+        lDRV_I2C_ResourceUnlock(dObj);
+        return;
+    }
+
+    /* Configure the transfer object */
+    transferObj->slaveAddress = address;
+    transferObj->readBuffer   = NULL;
+    transferObj->readSize     = 0U;
+    transferObj->writeBuffer  = NULL;
+    transferObj->writeSize    = 0U;
+    transferObj->segments     = segments;
+    transferObj->nSegments    = nSegments;
+    transferObj->clientHandle = handle;
+    transferObj->errors       = DRV_I2C_ERROR_NONE;
+    transferObj->currentState = DRV_I2C_TRANSFER_OBJ_IS_IN_QUEUE;
+    transferObj->event        = DRV_I2C_TRANSFER_EVENT_PENDING;
+    transferObj->flag         = DRV_I2C_TRANSFER_OBJ_FLAG_SEGMENTS;
+
+    lDRV_I2C_TransferObjSubmit(dObj, clientObj, transferObj, transferHandle);
+
+    lDRV_I2C_ResourceUnlock(dObj);
+}
+
 void DRV_I2C_QueuePurge(const DRV_HANDLE handle)
 {
     DRV_I2C_TRANSFER_OBJ* transferObj = NULL;
@@ -1076,3 +1579,203 @@ DRV_I2C_TRANSFER_EVENT DRV_I2C_TransferStatusGet(
 
     return event;
 }
+
+#if defined(DRV_I2C_STATISTICS_ENABLE)
+bool DRV_I2C_StatisticsGet(const SYS_MODULE_INDEX drvIndex, DRV_I2C_STATISTICS* stats)
+{
+    DRV_I2C_OBJ* dObj = NULL;
+    DRV_I2C_STATISTICS_DATA data;
+    uint64_t elapsedCount;
+
+    if ((drvIndex >= DRV_I2C_INSTANCES_NUMBER) || (stats == NULL))
+    {
+        return false;
+    }
+
+    dObj = &gDrvI2CObj[drvIndex];
+
+    if (dObj->status != SYS_STATUS_READY)
+    {
+        return false;
+    }
+
+    if (lDRV_I2C_ResourceLock(dObj) == false)
+    {
+        return false;
+    }
+
+    data = dObj->statistics;
+    elapsedCount = SYS_TIME_Counter64Get() - dObj->statisticsResetCount;
+
+    lDRV_I2C_ResourceUnlock(dObj);
+
+    lDRV_I2C_StatisticsConvert(&data, elapsedCount, stats);
+
+    return true;
+}
+
+bool DRV_I2C_ClientStatisticsGet(const DRV_HANDLE handle, DRV_I2C_STATISTICS* stats)
+{
+    DRV_I2C_CLIENT_OBJ* clientObj = NULL;
+    DRV_I2C_OBJ* dObj = NULL;
+    DRV_I2C_STATISTICS_DATA data;
+    uint64_t elapsedCount;
+
+    if (stats == NULL)
+    {
+        return false;
+    }
+
+    clientObj = lDRV_I2C_DriverHandleValidate(handle);
+
+    if (clientObj == NULL)
+    {
+        return false;
+    }
+
+    dObj = &gDrvI2CObj[clientObj->drvIndex];
+
+    if (lDRV_I2C_ResourceLock(dObj) == false)
+    {
+        return false;
+    }
+
+    data = clientObj->statistics;
+    elapsedCount = SYS_TIME_Counter64Get() - dObj->statisticsResetCount;
+
+    lDRV_I2C_ResourceUnlock(dObj);
+
+    lDRV_I2C_StatisticsConvert(&data, elapsedCount, stats);
+
+    return true;
+}
+
+bool DRV_I2C_SlaveStatisticsGet(const SYS_MODULE_INDEX drvIndex, const uint16_t address, DRV_I2C_STATISTICS* stats)
+{
+    DRV_I2C_OBJ* dObj = NULL;
+    DRV_I2C_STATISTICS_DATA* slaveData;
+    DRV_I2C_STATISTICS_DATA data = {0};
+    uint64_t elapsedCount;
+
+    if ((drvIndex >= DRV_I2C_INSTANCES_NUMBER) || (stats == NULL))
+    {
+        return false;
+    }
+
+    dObj = &gDrvI2CObj[drvIndex];
+
+    if (dObj->status != SYS_STATUS_READY)
+    {
+        return false;
+    }
+
+    if (lDRV_I2C_ResourceLock(dObj) == false)
+    {
+        return false;
+    }
+
+    slaveData = lDRV_I2C_SlaveStatisticsDataGet(dObj, address, false);
+
+    if (slaveData != NULL)
+    {
+        data = *slaveData;
+    }
+
+    elapsedCount = SYS_TIME_Counter64Get() - dObj->statisticsResetCount;
+
+    lDRV_I2C_ResourceUnlock(dObj);
+
+    if (slaveData == NULL)
+    {
+        /* No transfer to this slave since the last reset */
+        return false;
+    }
+
+    lDRV_I2C_StatisticsConvert(&data, elapsedCount, stats);
+
+    return true;
+}
+
+void DRV_I2C_StatisticsReset(const SYS_MODULE_INDEX drvIndex)
+{
+    DRV_I2C_OBJ* dObj = NULL;
+    DRV_I2C_CLIENT_OBJ* clientObj = NULL;
+    uint32_t iClient;
+
+    if (drvIndex >= DRV_I2C_INSTANCES_NUMBER)
+    {
+        return;
+    }
+
+    dObj = &gDrvI2CObj[drvIndex];
+
+    if (dObj->status != SYS_STATUS_READY)
+    {
+        return;
+    }
+
+    if (lDRV_I2C_ResourceLock(dObj) == false)
+    {
+        return;
+    }
+
+    (void) memset(&dObj->statistics, 0, sizeof(DRV_I2C_STATISTICS_DATA));
+    (void) memset(dObj->slaveStatistics, 0, sizeof(dObj->slaveStatistics));
+
+    for (iClient = 0U; iClient < dObj->nClientsMax; iClient++)
+    {
+        clientObj = &((DRV_I2C_CLIENT_OBJ *)dObj->clientObjPool)[iClient];
+        (void) memset(&clientObj->statistics, 0, sizeof(DRV_I2C_STATISTICS_DATA));
+    }
+
+    dObj->statisticsResetCount = SYS_TIME_Counter64Get();
+
+    lDRV_I2C_ResourceUnlock(dObj);
+}
+
+static void lDRV_I2C_StatisticsLinePrint(const char* name, uint32_t address, const DRV_I2C_STATISTICS* stats)
+{
+    SYS_CONSOLE_PRINT("%s 0x%02x: xfers %u nack %u bus %u bytes %u %u B/s util %u%%\r\n",
+        name, (unsigned int)address, (unsigned int)stats->nTransfers,
+        (unsigned int)stats->nNackErrors, (unsigned int)stats->nBusErrors,
+        (unsigned int)stats->nBytes, (unsigned int)stats->bytesPerSecond,
+        (unsigned int)stats->busUtilization);
+    SYS_CONSOLE_PRINT("  queue us %u/%u/%u bus us %u/%u/%u (min/avg/max)\r\n",
+        (unsigned int)stats->queueTimeMinUs, (unsigned int)stats->queueTimeAvgUs,
+        (unsigned int)stats->queueTimeMaxUs, (unsigned int)stats->busTimeMinUs,
+        (unsigned int)stats->busTimeAvgUs, (unsigned int)stats->busTimeMaxUs);
+}
+
+void DRV_I2C_StatisticsPrint(const SYS_MODULE_INDEX drvIndex)
+{
+    DRV_I2C_STATISTICS stats;
+    uint16_t addresses[DRV_I2C_STATISTICS_SLAVES_MAX];
+    uint32_t nAddresses = 0U;
+    uint32_t i;
+
+    if (DRV_I2C_StatisticsGet(drvIndex, &stats) == false)
+    {
+        return;
+    }
+
+    lDRV_I2C_StatisticsLinePrint("I2C", (uint32_t)drvIndex, &stats);
+
+    /* Snapshot the tracked addresses, the table may change while printing */
+    for (i = 0U; i < DRV_I2C_STATISTICS_SLAVES_MAX; i++)
+    {
+        if (gDrvI2CObj[drvIndex].slaveStatistics[i].inUse == true)
+        {
+            addresses[nAddresses] = gDrvI2CObj[drvIndex].slaveStatistics[i].address;
+            nAddresses++;
+        }
+    }
+
+    for (i = 0U; i < nAddresses; i++)
+    {
+        if (DRV_I2C_SlaveStatisticsGet(drvIndex, addresses[i], &stats) == true)
+        {
+            lDRV_I2C_StatisticsLinePrint(" slave", (uint32_t)addresses[i], &stats);
+        }
+    }
+}
+#endif
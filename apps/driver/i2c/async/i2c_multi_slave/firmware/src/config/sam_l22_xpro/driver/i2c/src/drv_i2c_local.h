@@ -50,6 +50,9 @@
 // *****************************************************************************
 #include "driver/i2c/drv_i2c_definitions.h"
 #include "osal/osal.h"
+#if defined(DRV_I2C_STATISTICS_ENABLE)
+#include "system/time/sys_time.h"
+#endif
 
 // *****************************************************************************
 // *****************************************************************************
@@ -91,6 +94,9 @@ typedef enum
     /* Indicates this buffer was submitted by a force write function */
     DRV_I2C_TRANSFER_OBJ_FLAG_WR_FRCD = 1 << 3,
 
+    /* Indicates this buffer was submitted by the transaction function */
+    DRV_I2C_TRANSFER_OBJ_FLAG_SEGMENTS = 1 << 4,
+
 } DRV_I2C_TRANSFER_OBJ_FLAGS;
 
 // *****************************************************************************
@@ -116,6 +122,70 @@ typedef enum
 
 }DRV_I2C_TRANSFER_OBJ_STATE;
 
+#if defined(DRV_I2C_STATISTICS_ENABLE)
+// *****************************************************************************
+/* I2C Driver Statistics Accumulator
+
+  Summary:
+    Raw transfer statistics of a driver instance, client or slave.
+
+  Description:
+    Times are kept in SYS_TIME counts and converted to microseconds when the
+    statistics are read.
+
+  Remarks:
+    None.
+*/
+
+typedef struct
+{
+    uint32_t                        nTransfers;
+
+    uint32_t                        nNackErrors;
+
+    uint32_t                        nBusErrors;
+
+    uint32_t                        nBytes;
+
+    uint32_t                        queueCountMin;
+
+    uint32_t                        queueCountMax;
+
+    uint64_t                        queueCountTotal;
+
+    uint32_t                        busCountMin;
+
+    uint32_t                        busCountMax;
+
+    uint64_t                        busCountTotal;
+
+} DRV_I2C_STATISTICS_DATA;
+
+// *****************************************************************************
+/* I2C Driver Slave Statistics
+
+  Summary:
+    Transfer statistics of one slave address.
+
+  Description:
+    Entries are assigned to the slave addresses in the order they are first
+    seen on the bus.
+
+  Remarks:
+    None.
+*/
+
+typedef struct
+{
+    bool                            inUse;
+
+    uint16_t                        address;
+
+    DRV_I2C_STATISTICS_DATA         data;
+
+} DRV_I2C_SLAVE_STATISTICS;
+#endif
+
 // *****************************************************************************
 /* I2C Driver Transfer Object
 
@@ -149,6 +219,12 @@ typedef struct DRV_I2C_TRANSFER_OBJ_T
     /* Number of bytes to be written */
     size_t                          writeSize;
 
+    /* Segments of a transaction */
+    DRV_I2C_SEGMENT*                segments;
+
+    /* Number of segments of a transaction */
+    size_t                          nSegments;
+
     /* Transfer Object Flag */
     DRV_I2C_TRANSFER_OBJ_FLAGS      flag;
 
@@ -168,6 +244,17 @@ typedef struct DRV_I2C_TRANSFER_OBJ_T
     /* Errors associated with the I2C transfer */
     volatile DRV_I2C_ERROR          errors;
 
+    /* Index of the failed segment of a transaction,
+     * DRV_I2C_SEGMENT_INDEX_INVALID if none or not known */
+    uint32_t                        failedSegment;
+
+#if defined(DRV_I2C_STATISTICS_ENABLE)
+    /* SYS_TIME counter values at the time the transfer was queued and
+     * started */
+    uint32_t                        queuedCount;
+    uint32_t                        startedCount;
+#endif
+
     /* Next buffer pointer */
     struct DRV_I2C_TRANSFER_OBJ_T*   next;
 
@@ -249,6 +336,17 @@ typedef struct
 
     bool                                    i2cInterruptStatus;
 
+#if defined(DRV_I2C_STATISTICS_ENABLE)
+    /* Statistics of all the transfers of the instance */
+    DRV_I2C_STATISTICS_DATA                 statistics;
+
+    /* Statistics of each slave address */
+    DRV_I2C_SLAVE_STATISTICS                slaveStatistics[DRV_I2C_STATISTICS_SLAVES_MAX];
+
+    /* SYS_TIME counter value at the last statistics reset */
+    uint64_t                                statisticsResetCount;
+#endif
+
 } DRV_I2C_OBJ;
 
 // *****************************************************************************
@@ -288,6 +386,17 @@ typedef struct
     /* Client specific transfer setup */
     DRV_I2C_TRANSFER_SETUP          transferSetup;
 
+    /* Peripheral settings of transferSetup, computed once by the PLIB */
+    DRV_I2C_BAUD_SETUP              baudSetup;
+
+    /* Flag to indicate that baudSetup matches transferSetup */
+    bool                            isBaudSetupValid;
+
+#if defined(DRV_I2C_STATISTICS_ENABLE)
+    /* Statistics of the transfers of this client */
+    DRV_I2C_STATISTICS_DATA         statistics;
+#endif
+
 } DRV_I2C_CLIENT_OBJ;
 
 #endif //#ifndef DRV_I2C_LOCAL_H
@@ -0,0 +1,641 @@
+/*******************************************************************************
+  I2C EEPROM Driver Interface Definition
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    drv_i2c_eeprom.h
+
+  Summary:
+    I2C EEPROM Driver Interface Definition
+
+  Description:
+    The I2C EEPROM driver provides a simple interface to read and write a
+    serial EEPROM (24xx family) connected to a SERCOM I2C through the I2C
+    driver. Writes are split on page boundaries and the self-timed write cycle
+    of the EEPROM is tracked by the driver, so that the bus is shared with the
+    other I2C clients while the EEPROM programs a page.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+#ifndef DRV_I2C_EEPROM_H
+#define DRV_I2C_EEPROM_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File includes
+// *****************************************************************************
+// *****************************************************************************
+
+#include "driver/driver_common.h"
+#include "system/system.h"
+#include "drv_i2c_eeprom_definitions.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* I2C EEPROM Driver Transfer Status
+
+ Summary:
+    Defines the data type for I2C EEPROM Driver transfer status.
+
+ Description:
+    This will be used to indicate the current transfer status of the I2C
+    EEPROM driver operations. It is also passed to the client event handler
+    when an operation ends.
+
+ Remarks:
+    None.
+*/
+
+typedef enum
+{
+    /* Transfer is being processed */
+    DRV_I2C_EEPROM_TRANSFER_BUSY,
+
+    /* Transfer is successfully completed */
+    DRV_I2C_EEPROM_TRANSFER_COMPLETED,
+
+    /* Transfer had error */
+    DRV_I2C_EEPROM_TRANSFER_ERROR_UNKNOWN,
+
+} DRV_I2C_EEPROM_TRANSFER_STATUS;
+
+// *****************************************************************************
+/* I2C EEPROM Driver Event Handler Function Pointer
+
+   Summary:
+    Pointer to an I2C EEPROM driver event handler function
+
+   Description:
+    This data type defines the required function signature for the I2C EEPROM
+    driver event handling callback function. The event is the final status of
+    the read, write or flush operation.
+
+   Remarks:
+    The event handler is called from the I2C driver interrupt context, or from
+    DRV_I2C_EEPROM_Tasks when the operation ends while waiting for the EEPROM.
+    A new operation can be started from within the event handler.
+*/
+
+typedef void (*DRV_I2C_EEPROM_EVENT_HANDLER)( DRV_I2C_EEPROM_TRANSFER_STATUS event, uintptr_t context );
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: I2C EEPROM Driver Module Interface Routines
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* Function:
+    SYS_MODULE_OBJ DRV_I2C_EEPROM_Initialize
+    (
+        const SYS_MODULE_INDEX drvIndex,
+        const SYS_MODULE_INIT *const init
+    );
+
+  Summary:
+    Initializes the I2C EEPROM Driver
+
+  Description:
+    This routine initializes the I2C EEPROM driver making it ready for client
+    to use. The I2C driver instance given in the init data is not opened here;
+    it is opened when a client opens the I2C EEPROM driver.
+
+  Precondition:
+    None.
+
+  Parameters:
+    drvIndex -  Identifier for the instance to be initialized
+
+    init     -  Pointer to a data structure containing any data necessary to
+                initialize the driver.
+
+  Returns:
+    If successful, returns a valid handle to a driver instance object.
+    Otherwise it returns SYS_MODULE_OBJ_INVALID.
+
+  Example:
+    <code>
+    SYS_MODULE_OBJ  objectHandle;
+    static uint8_t pageBuffer[16 + 1];
+
+    const DRV_I2C_EEPROM_INIT drvI2CEEPROMInitData =
+    {
+        .i2cDrvIndex            = DRV_I2C_INDEX_0,
+        .slaveAddress           = 0x57,
+        .clockSpeed             = 400000,
+        .eepromSize             = 256,
+        .pageSize               = 16,
+        .addressBytes           = 1,
+        .pageBuffer             = pageBuffer,
+        .writeCycleTimeUs       = 5000,
+        .ackPollDelayUs         = 3000,
+        .ackPollIntervalMinUs   = 250,
+        .ackPollIntervalMaxUs   = 1000,
+    };
+
+    objectHandle = DRV_I2C_EEPROM_Initialize((SYS_MODULE_INDEX)DRV_I2C_EEPROM_INDEX_0, (SYS_MODULE_INIT *)&drvI2CEEPROMInitData);
+
+    if (SYS_MODULE_OBJ_INVALID == objectHandle)
+    {
+        // Handle error
+    }
+    </code>
+
+  Remarks:
+    This routine must be called after the I2C driver instance it uses has been
+    initialized.
+*/
+
+SYS_MODULE_OBJ DRV_I2C_EEPROM_Initialize
+(
+    const SYS_MODULE_INDEX drvIndex,
+    const SYS_MODULE_INIT *const init
+);
+
+// *************************************************************************
+/* Function:
+    SYS_STATUS DRV_I2C_EEPROM_Status( const SYS_MODULE_INDEX drvIndex );
+
+  Summary:
+    Gets the current status of the I2C EEPROM driver module.
+
+  Description:
+    This routine provides the current status of the I2C EEPROM driver module.
+
+  Precondition:
+    Function DRV_I2C_EEPROM_Initialize should have been called before calling
+    this function.
+
+  Parameters:
+    drvIndex   -  Identifier for the instance used to initialize driver
+
+  Returns:
+    SYS_STATUS_READY - Indicates that the driver is ready and accept requests
+                       for new operations.
+
+    SYS_STATUS_UNINITIALIZED - Indicates the driver is not initialized.
+
+  Example:
+    <code>
+    SYS_STATUS status;
+
+    status = DRV_I2C_EEPROM_Status(DRV_I2C_EEPROM_INDEX_0);
+    </code>
+
+  Remarks:
+    None.
+*/
+
+SYS_STATUS DRV_I2C_EEPROM_Status( const SYS_MODULE_INDEX drvIndex );
+
+// *****************************************************************************
+/* Function:
+    void DRV_I2C_EEPROM_Tasks( SYS_MODULE_OBJ object );
+
+  Summary:
+    Maintains the I2C EEPROM driver's write cycle state machine.
+
+  Description:
+    This routine issues the transfer that was deferred while the EEPROM was
+    busy with its self-timed write cycle, once the SYS_TIME delay of the
+    current ACK poll has expired. The transfer is the next page write, the
+    read or the flush poll, so that no transfer is spent on polling alone
+    while an operation is pending.
+
+  Precondition:
+    The DRV_I2C_EEPROM_Initialize routine must have been called for the
+    specified I2C EEPROM driver instance.
+
+  Parameters:
+    object      - Object handle for the specified driver instance (returned
+                  from DRV_I2C_EEPROM_Initialize)
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+    SYS_MODULE_OBJ object;     // Returned from DRV_I2C_EEPROM_Initialize
+
+    while (true)
+    {
+        DRV_I2C_EEPROM_Tasks (object);
+
+        // Do other tasks
+    }
+    </code>
+
+  Remarks:
+    This routine is normally not called directly by an application. It is
+    called by the system's Tasks routine (SYS_Tasks). The transfers are not
+    queued from the SYS_TIME callback, as the I2C driver cannot be called from
+    the timer interrupt context.
+*/
+
+void DRV_I2C_EEPROM_Tasks( SYS_MODULE_OBJ object );
+
+// *****************************************************************************
+/* Function:
+    DRV_HANDLE DRV_I2C_EEPROM_Open
+    (
+        const SYS_MODULE_INDEX drvIndex,
+        const DRV_IO_INTENT ioIntent
+    );
+
+  Summary:
+    Opens the specified I2C EEPROM driver instance and returns a handle to it
+
+  Description:
+    This routine opens the specified I2C EEPROM driver instance and provides a
+    handle. This handle must be provided to all other client-level operations
+    to identify the caller and the instance of the driver.
+
+    The underlying I2C driver instance is opened in shared mode, so that the
+    other devices on the bus remain accessible.
+
+  Precondition:
+    Function DRV_I2C_EEPROM_Initialize must have been called before calling
+    this function.
+
+  Parameters:
+    drvIndex  -  Identifier for the instance to be opened
+
+    ioIntent  -  Zero or more of the values from the enumeration
+                 DRV_IO_INTENT "ORed" together to indicate the intended use
+                 of the driver
+
+  Returns:
+    If successful, the routine returns a valid open-instance handle (a
+    number identifying both the caller and the module instance).
+
+    If an error occurs, DRV_HANDLE_INVALID is returned. Errors can occur
+    - if the driver is already opened by a client
+    - if the I2C driver instance cannot be opened
+    - if the driver instance being opened is not initialized.
+
+  Example:
+    <code>
+    DRV_HANDLE handle;
+
+    handle = DRV_I2C_EEPROM_Open(DRV_I2C_EEPROM_INDEX_0, DRV_IO_INTENT_READWRITE);
+    if (DRV_HANDLE_INVALID == handle)
+    {
+        // Unable to open the driver
+    }
+    </code>
+
+  Remarks:
+    The driver supports a single client.
+*/
+
+DRV_HANDLE DRV_I2C_EEPROM_Open( const SYS_MODULE_INDEX drvIndex, const DRV_IO_INTENT ioIntent );
+
+// *****************************************************************************
+/* Function:
+    void DRV_I2C_EEPROM_Close( const DRV_HANDLE handle );
+
+  Summary:
+    Closes an opened-instance of the I2C EEPROM driver
+
+  Description:
+    This routine closes an opened-instance of the I2C EEPROM driver,
+    invalidating the handle and releasing the I2C driver client.
+
+  Precondition:
+    DRV_I2C_EEPROM_Open must have been called to obtain a valid opened device
+    handle.
+
+  Parameters:
+    handle       - A valid open-instance handle, returned from the driver's
+                   open routine
+
+  Returns:
+    None
+
+  Example:
+    <code>
+    DRV_HANDLE handle;  // Returned from DRV_I2C_EEPROM_Open
+
+    DRV_I2C_EEPROM_Close(handle);
+    </code>
+
+  Remarks:
+    A write cycle started before the call is not waited for. Call
+    DRV_I2C_EEPROM_Flush first if the data must be programmed when the
+    routine returns.
+*/
+
+void DRV_I2C_EEPROM_Close( const DRV_HANDLE handle );
+
+// *****************************************************************************
+/* Function:
+    void DRV_I2C_EEPROM_EventHandlerSet
+    (
+        const DRV_HANDLE handle,
+        const DRV_I2C_EEPROM_EVENT_HANDLER eventHandler,
+        const uintptr_t context
+    );
+
+  Summary:
+    Allows a client to identify an event handling function for the driver to
+    call back when an operation ends.
+
+  Description:
+    This function allows a client to register an event handling function with
+    the driver to call back when a read, write or flush operation ends. The
+    status of the last operation is also available through
+    DRV_I2C_EEPROM_TransferStatusGet.
+
+  Precondition:
+    DRV_I2C_EEPROM_Open must have been called to obtain a valid opened device
+    handle.
+
+  Parameters:
+    handle       - A valid open-instance handle, returned from the driver's
+                   open routine
+
+    eventHandler - Pointer to the event handler function. NULL disables the
+                   callback.
+
+    context      - The value of parameter will be passed back to the client
+                   unchanged, when the eventHandler function is called.
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+    void APP_EEPROMEventHandler(DRV_I2C_EEPROM_TRANSFER_STATUS event, uintptr_t context)
+    {
+        if (event == DRV_I2C_EEPROM_TRANSFER_COMPLETED)
+        {
+            // Operation completed successfully
+        }
+    }
+
+    DRV_I2C_EEPROM_EventHandlerSet(handle, APP_EEPROMEventHandler, 0);
+    </code>
+
+  Remarks:
+    None.
+*/
+
+void DRV_I2C_EEPROM_EventHandlerSet(
+    const DRV_HANDLE handle,
+    const DRV_I2C_EEPROM_EVENT_HANDLER eventHandler,
+    const uintptr_t context
+);
+
+// *****************************************************************************
+/* Function:
+    bool DRV_I2C_EEPROM_Read
+    (
+        const DRV_HANDLE handle,
+        void *rxData,
+        uint32_t rxDataLength,
+        uint32_t address
+    );
+
+  Summary:
+    Reads rxDataLength bytes of data from the specified address in EEPROM.
+
+  Description:
+    This function schedules a non-blocking sequential read of the EEPROM into
+    rxData, as a single write-read I2C transfer. If the EEPROM is still busy
+    with the write cycle of a previous write, the read also serves as the ACK
+    poll and is retried on the SYS_TIME backoff schedule.
+
+  Precondition:
+    The DRV_I2C_EEPROM_Open() routine must have been called for the specified
+    I2C EEPROM driver instance.
+
+  Parameters:
+    handle       - A valid open-instance handle, returned from the driver's
+                   open routine
+
+    rxData       - Buffer for the read data. It must remain valid until the
+                   operation ends.
+
+    rxDataLength - Number of bytes to be read
+
+    address      - EEPROM address to start reading from
+
+  Returns:
+    false
+    - if the driver is busy, the address range is invalid or the request
+      could not be queued
+
+    true
+    - if the read request was accepted
+
+  Example:
+    <code>
+    DRV_HANDLE handle;  // Returned from DRV_I2C_EEPROM_Open
+    uint8_t readBuffer[16];
+
+    if (DRV_I2C_EEPROM_Read(handle, readBuffer, sizeof(readBuffer), 0) == false)
+    {
+        // Error handling here
+    }
+    </code>
+
+  Remarks:
+    None.
+*/
+
+bool DRV_I2C_EEPROM_Read( const DRV_HANDLE handle, void *rxData, uint32_t rxDataLength, uint32_t address );
+
+// *****************************************************************************
+/* Function:
+    bool DRV_I2C_EEPROM_Write
+    (
+        const DRV_HANDLE handle,
+        void *txData,
+        uint32_t txDataLength,
+        uint32_t address
+    );
+
+  Summary:
+    Writes txDataLength bytes of data to the specified address in EEPROM.
+
+  Description:
+    This function schedules a non-blocking write. The data is split on the
+    page boundaries of the EEPROM and written one page per I2C transfer. Each
+    page write after the first one also serves as the ACK poll of the previous
+    page, so that only the retries of the SYS_TIME backoff schedule use the
+    bus while the EEPROM programs a page.
+
+    The operation completes when the EEPROM has accepted the last page. The
+    write cycle of that page is still running; it is waited for by the next
+    operation or by DRV_I2C_EEPROM_Flush.
+
+  Precondition:
+    The DRV_I2C_EEPROM_Open() routine must have been called for the specified
+    I2C EEPROM driver instance.
+
+  Parameters:
+    handle       - A valid open-instance handle, returned from the driver's
+                   open routine
+
+    txData       - Data to be written. It must remain valid until the
+                   operation ends.
+
+    txDataLength - Number of bytes to be written
+
+    address      - EEPROM address to start writing at
+
+  Returns:
+    false
+    - if the driver is busy, the address range is invalid or the request
+      could not be queued
+
+    true
+    - if the write request was accepted
+
+  Example:
+    <code>
+    DRV_HANDLE handle;  // Returned from DRV_I2C_EEPROM_Open
+    uint8_t writeBuffer[40];
+
+    if (DRV_I2C_EEPROM_Write(handle, writeBuffer, sizeof(writeBuffer), 10) == false)
+    {
+        // Error handling here
+    }
+    </code>
+
+  Remarks:
+    None.
+*/
+
+bool DRV_I2C_EEPROM_Write( const DRV_HANDLE handle, void *txData, uint32_t txDataLength, uint32_t address );
+
+// *****************************************************************************
+/* Function:
+    bool DRV_I2C_EEPROM_Flush( const DRV_HANDLE handle );
+
+  Summary:
+    Waits for the write cycle of the last written page to end.
+
+  Description:
+    This function schedules a non-blocking wait for the end of the write cycle
+    started by the last write. The EEPROM is ACK polled on the SYS_TIME backoff
+    schedule with an address only write. The operation completes immediately
+    if no write cycle is pending.
+
+  Precondition:
+    The DRV_I2C_EEPROM_Open() routine must have been called for the specified
+    I2C EEPROM driver instance.
+
+  Parameters:
+    handle       - A valid open-instance handle, returned from the driver's
+                   open routine
+
+  Returns:
+    false
+    - if the driver is busy or the request could not be queued
+
+    true
+    - if the flush request was accepted
+
+  Example:
+    <code>
+    DRV_HANDLE handle;  // Returned from DRV_I2C_EEPROM_Open
+
+    if (DRV_I2C_EEPROM_Flush(handle) == true)
+    {
+        while (DRV_I2C_EEPROM_TransferStatusGet(handle) == DRV_I2C_EEPROM_TRANSFER_BUSY);
+    }
+    </code>
+
+  Remarks:
+    None.
+*/
+
+bool DRV_I2C_EEPROM_Flush( const DRV_HANDLE handle );
+
+// *************************************************************************
+/* Function:
+    DRV_I2C_EEPROM_TRANSFER_STATUS DRV_I2C_EEPROM_TransferStatusGet( const DRV_HANDLE handle );
+
+  Summary:
+    Gets the current status of the transfer request.
+
+  Description:
+    This routine gets the status of the last read, write or flush operation.
+
+  Preconditions:
+    DRV_I2C_EEPROM_Open must have been called to obtain a valid opened device
+    handle.
+
+  Parameters:
+    handle       - A valid open-instance handle, returned from the driver's
+                   open routine
+
+  Returns:
+    One of the status element from the enum DRV_I2C_EEPROM_TRANSFER_STATUS.
+
+  Example:
+    <code>
+    DRV_HANDLE handle;  // Returned from DRV_I2C_EEPROM_Open
+
+    if (DRV_I2C_EEPROM_TransferStatusGet(handle) == DRV_I2C_EEPROM_TRANSFER_COMPLETED)
+    {
+        // Operation Done
+    }
+    </code>
+
+  Remarks:
+    None.
+*/
+
+DRV_I2C_EEPROM_TRANSFER_STATUS DRV_I2C_EEPROM_TransferStatusGet( const DRV_HANDLE handle );
+
+//DOM-IGNORE-BEGIN
+#ifdef __cplusplus
+}
+#endif
+//DOM-IGNORE-END
+
+#endif // #ifndef DRV_I2C_EEPROM_H
+/*******************************************************************************
+ End of File
+*/
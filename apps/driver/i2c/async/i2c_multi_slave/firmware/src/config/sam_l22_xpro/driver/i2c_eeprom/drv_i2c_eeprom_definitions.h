@@ -0,0 +1,139 @@
+/*******************************************************************************
+  I2C EEPROM Driver Definitions Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    drv_i2c_eeprom_definitions.h
+
+  Summary:
+    I2C EEPROM Driver Definitions Header File
+
+  Description:
+    This file provides implementation-specific definitions for the I2C EEPROM
+    driver's system interface.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+#ifndef DRV_I2C_EEPROM_DEFINITIONS_H
+#define DRV_I2C_EEPROM_DEFINITIONS_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File includes
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "system/system_module.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* I2C EEPROM Driver Initialization Data
+
+  Summary:
+    Defines the data required to initialize the I2C EEPROM driver
+
+  Description:
+    This data type defines the data required to initialize the I2C EEPROM
+    driver. The driver does not own the I2C peripheral; it opens the DRV_I2C
+    instance identified by i2cDrvIndex as one client among others on the bus.
+
+    The EEPROM NACKs its address while it programs a page. Instead of
+    re-addressing the device continuously, the driver paces its ACK polls with
+    SYS_TIME: the first poll is issued ackPollDelayUs after the end of the
+    page write, the following ones ackPollIntervalMinUs apart, doubling up to
+    ackPollIntervalMaxUs.
+
+  Remarks:
+    pageBuffer must hold at least pageSize + addressBytes bytes.
+*/
+
+typedef struct
+{
+    /* Index of the I2C driver instance the EEPROM is connected to */
+    SYS_MODULE_INDEX                i2cDrvIndex;
+
+    /* 7-bit I2C address of the EEPROM */
+    uint16_t                        slaveAddress;
+
+    /* I2C clock speed used to talk to the EEPROM */
+    uint32_t                        clockSpeed;
+
+    /* Size of the EEPROM in bytes */
+    uint32_t                        eepromSize;
+
+    /* Size of the EEPROM write page in bytes */
+    uint32_t                        pageSize;
+
+    /* Number of memory address bytes sent after the slave address (1 or 2).
+     * Address bits above them are carried in the low bits of the slave
+     * address, as done by the 4/8/16 Kbit devices. */
+    uint8_t                         addressBytes;
+
+    /* Buffer holding the memory address and the data of one page write */
+    uint8_t*                        pageBuffer;
+
+    /* Maximum duration of the self-timed write cycle (tWR). The EEPROM is
+     * assumed idle after this time; ACK polling fails after twice this time. */
+    uint32_t                        writeCycleTimeUs;
+
+    /* Delay from the end of a page write to the first ACK poll */
+    uint32_t                        ackPollDelayUs;
+
+    /* Initial and maximum interval between the following ACK polls */
+    uint32_t                        ackPollIntervalMinUs;
+    uint32_t                        ackPollIntervalMaxUs;
+
+} DRV_I2C_EEPROM_INIT;
+
+//DOM-IGNORE-BEGIN
+#ifdef __cplusplus
+}
+#endif
+//DOM-IGNORE-END
+
+#endif // #ifndef DRV_I2C_EEPROM_DEFINITIONS_H
+/*******************************************************************************
+ End of File
+*/
@@ -0,0 +1,600 @@
+/*******************************************************************************
+  I2C EEPROM Driver Implementation
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    drv_i2c_eeprom.c
+
+  Summary:
+    I2C EEPROM driver implementation on top of the I2C driver.
+
+  Description:
+    This file implements the I2C EEPROM driver. Writes are split on page
+    boundaries and each page is queued as one I2C driver transfer. While the
+    EEPROM programs a page it does not acknowledge its address; the next
+    transfer of the operation is then deferred to DRV_I2C_EEPROM_Tasks and
+    issued on a SYS_TIME backoff schedule, so that it also serves as the ACK
+    poll and the bus stays free for the other I2C clients meanwhile.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Include Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <string.h>
+#include "driver/i2c_eeprom/src/drv_i2c_eeprom_local.h"
+#include "system/debug/sys_debug.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global objects
+// *****************************************************************************
+// *****************************************************************************
+
+static DRV_I2C_EEPROM_OBJECT gDrvI2CEEPROMObj[DRV_I2C_EEPROM_INSTANCES_NUMBER];
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: I2C EEPROM Driver Local Functions
+// *****************************************************************************
+// *****************************************************************************
+
+static DRV_I2C_EEPROM_OBJECT * lDRV_I2C_EEPROM_DriverHandleValidate( const DRV_HANDLE handle )
+{
+    DRV_I2C_EEPROM_OBJECT *dObj = NULL;
+
+    if (handle < DRV_I2C_EEPROM_INSTANCES_NUMBER)
+    {
+        dObj = &gDrvI2CEEPROMObj[handle];
+
+        if (dObj->isOpened == false)
+        {
+            dObj = NULL;
+        }
+    }
+
+    return dObj;
+}
+
+static uint32_t lDRV_I2C_EEPROM_WriteCycleElapsedUs( DRV_I2C_EEPROM_OBJECT *dObj )
+{
+    return SYS_TIME_CountToUS(SYS_TIME_CounterGet() - dObj->writeCycleStartCount);
+}
+
+/* Marks the start of the write cycle of the page that has just been written */
+static void lDRV_I2C_EEPROM_WriteCycleStart( DRV_I2C_EEPROM_OBJECT *dObj )
+{
+    dObj->writeCycleStartCount = SYS_TIME_CounterGet();
+    dObj->pollIntervalUs = 0U;
+    dObj->isWriteCyclePending = true;
+}
+
+/* Ends the current operation with the given status and notifies the client */
+static void lDRV_I2C_EEPROM_OperationEnd( DRV_I2C_EEPROM_OBJECT *dObj, DRV_I2C_EEPROM_TRANSFER_STATUS status )
+{
+    dObj->state = DRV_I2C_EEPROM_STATE_IDLE;
+    dObj->transferStatus = status;
+
+    if (dObj->eventHandler != NULL)
+    {
+        dObj->eventHandler(status, dObj->context);
+    }
+}
+
+/* Returns the slave address selecting the memory block of the given address
+ * on the devices with a one byte memory address. The address following the
+ * last written byte may be one past the end of the EEPROM and wraps to 0. */
+static uint16_t lDRV_I2C_EEPROM_SlaveAddressGet( DRV_I2C_EEPROM_OBJECT *dObj, uint32_t address )
+{
+    uint32_t block = ((address % dObj->eepromSize) >> (8U * (uint32_t)dObj->addressBytes)) & DRV_I2C_EEPROM_SLAVE_ADDR_BLOCK_Msk;
+
+    return (uint16_t)((uint32_t)dObj->slaveAddress | block);
+}
+
+/* Queues the I2C transfer of the next step of the current operation. While a
+ * write cycle is pending, this transfer is also the ACK poll of the EEPROM. */
+static bool lDRV_I2C_EEPROM_TransferSubmit( DRV_I2C_EEPROM_OBJECT *dObj )
+{
+    DRV_I2C_TRANSFER_HANDLE transferHandle = DRV_I2C_TRANSFER_HANDLE_INVALID;
+    uint16_t slaveAddress = lDRV_I2C_EEPROM_SlaveAddressGet(dObj, dObj->address);
+    uint32_t nBytes;
+
+    if (dObj->addressBytes == DRV_I2C_EEPROM_ADDRESS_BYTES_MAX)
+    {
+        dObj->pageBuffer[0] = (uint8_t)(dObj->address >> 8);
+        dObj->pageBuffer[1] = (uint8_t)(dObj->address);
+    }
+    else
+    {
+        dObj->pageBuffer[0] = (uint8_t)(dObj->address);
+    }
+
+    switch (dObj->operation)
+    {
+        case DRV_I2C_EEPROM_OPERATION_READ:
+        {
+            dObj->state = DRV_I2C_EEPROM_STATE_READ;
+
+            DRV_I2C_WriteReadTransferAdd(dObj->i2cHandle, slaveAddress, (void *)dObj->pageBuffer, dObj->addressBytes,
+                (void *)dObj->bufferPtr, dObj->nPendingBytes, &transferHandle);
+            break;
+        }
+
+        case DRV_I2C_EEPROM_OPERATION_WRITE:
+        {
+            /* Write up to the end of the current page */
+            nBytes = dObj->pageSize - (dObj->address % dObj->pageSize);
+
+            if (nBytes > dObj->nPendingBytes)
+            {
+                nBytes = dObj->nPendingBytes;
+            }
+
+            (void) memcpy((void *)&dObj->pageBuffer[dObj->addressBytes], (const void *)dObj->bufferPtr, nBytes);
+
+            dObj->nPageBytes = nBytes;
+            dObj->state = DRV_I2C_EEPROM_STATE_WRITE_PAGE;
+
+            DRV_I2C_WriteTransferAdd(dObj->i2cHandle, slaveAddress, (void *)dObj->pageBuffer,
+                ((size_t)dObj->addressBytes + nBytes), &transferHandle);
+            break;
+        }
+
+        default:
+        {
+            /* Address only write, the EEPROM acknowledges it once idle */
+            dObj->state = DRV_I2C_EEPROM_STATE_ACK_POLL;
+
+            DRV_I2C_WriteTransferAdd(dObj->i2cHandle, slaveAddress, (void *)dObj->pageBuffer, dObj->addressBytes, &transferHandle);
+            break;
+        }
+    }
+
+    return (transferHandle != DRV_I2C_TRANSFER_HANDLE_INVALID);
+}
+
+/* Starts the operation set up by the caller. The first transfer is deferred
+ * to the Tasks routine if the EEPROM may still be programming a page. */
+static bool lDRV_I2C_EEPROM_OperationStart( DRV_I2C_EEPROM_OBJECT *dObj )
+{
+    dObj->transferStatus = DRV_I2C_EEPROM_TRANSFER_BUSY;
+
+    if ((dObj->isWriteCyclePending == true) && (lDRV_I2C_EEPROM_WriteCycleElapsedUs(dObj) >= dObj->writeCycleTimeUs))
+    {
+        dObj->isWriteCyclePending = false;
+    }
+
+    if (dObj->isWriteCyclePending == true)
+    {
+        dObj->state = DRV_I2C_EEPROM_STATE_WAIT_WRITE_CYCLE;
+        return true;
+    }
+
+    if (lDRV_I2C_EEPROM_TransferSubmit(dObj) == false)
+    {
+        dObj->state = DRV_I2C_EEPROM_STATE_IDLE;
+        dObj->transferStatus = DRV_I2C_EEPROM_TRANSFER_ERROR_UNKNOWN;
+        return false;
+    }
+
+    return true;
+}
+
+/* Returns the delay to the next ACK poll. The first poll is timed from the end
+ * of the page write, the following ones from the previous poll. */
+static uint32_t lDRV_I2C_EEPROM_PollDelayGet( DRV_I2C_EEPROM_OBJECT *dObj )
+{
+    uint32_t elapsedUs;
+
+    if (dObj->pollIntervalUs != 0U)
+    {
+        return dObj->pollIntervalUs;
+    }
+
+    elapsedUs = lDRV_I2C_EEPROM_WriteCycleElapsedUs(dObj);
+
+    return (elapsedUs < dObj->ackPollDelayUs) ? (dObj->ackPollDelayUs - elapsedUs) : 0U;
+}
+
+/* I2C driver event handler. Runs in the I2C interrupt context. */
+static void lDRV_I2C_EEPROM_EventHandler
+(
+    DRV_I2C_TRANSFER_EVENT event,
+    DRV_I2C_TRANSFER_HANDLE transferHandle,
+    uintptr_t context
+)
+{
+    DRV_I2C_EEPROM_OBJECT *dObj = (DRV_I2C_EEPROM_OBJECT *)context;
+
+    if ((dObj->state == DRV_I2C_EEPROM_STATE_IDLE) || (dObj->state == DRV_I2C_EEPROM_STATE_WAIT_WRITE_CYCLE))
+    {
+        /* Stale completion of an operation that has already ended */
+        return;
+    }
+
+    if (event != DRV_I2C_TRANSFER_EVENT_COMPLETE)
+    {
+        if ((dObj->isWriteCyclePending == true) && (lDRV_I2C_EEPROM_WriteCycleElapsedUs(dObj) < (2U * dObj->writeCycleTimeUs)))
+        {
+            /* NACK from the EEPROM still programming the previous page. Retry
+             * from the Tasks routine, doubling the interval between polls. */
+            if (dObj->pollIntervalUs == 0U)
+            {
+                dObj->pollIntervalUs = dObj->ackPollIntervalMinUs;
+            }
+            else if (dObj->pollIntervalUs < dObj->ackPollIntervalMaxUs)
+            {
+                dObj->pollIntervalUs = (2U * dObj->pollIntervalUs);
+
+                if (dObj->pollIntervalUs > dObj->ackPollIntervalMaxUs)
+                {
+                    dObj->pollIntervalUs = dObj->ackPollIntervalMaxUs;
+                }
+            }
+            else
+            {
+                /* Interval at its maximum */
+            }
+
+            dObj->state = DRV_I2C_EEPROM_STATE_WAIT_WRITE_CYCLE;
+        }
+        else
+        {
+            lDRV_I2C_EEPROM_OperationEnd(dObj, DRV_I2C_EEPROM_TRANSFER_ERROR_UNKNOWN);
+        }
+        return;
+    }
+
+    switch (dObj->state)
+    {
+        case DRV_I2C_EEPROM_STATE_WRITE_PAGE:
+        {
+            /* The page has been latched; the EEPROM programs it from the stop
+             * condition on. */
+            lDRV_I2C_EEPROM_WriteCycleStart(dObj);
+
+            dObj->bufferPtr += dObj->nPageBytes;
+            dObj->address += dObj->nPageBytes;
+            dObj->nPendingBytes -= dObj->nPageBytes;
+
+            if (dObj->nPendingBytes == 0U)
+            {
+                lDRV_I2C_EEPROM_OperationEnd(dObj, DRV_I2C_EEPROM_TRANSFER_COMPLETED);
+            }
+            else
+            {
+                dObj->state = DRV_I2C_EEPROM_STATE_WAIT_WRITE_CYCLE;
+            }
+            break;
+        }
+
+        case DRV_I2C_EEPROM_STATE_READ:
+        case DRV_I2C_EEPROM_STATE_ACK_POLL:
+        {
+            /* The EEPROM acknowledged its address, no write cycle is running */
+            dObj->isWriteCyclePending = false;
+
+            lDRV_I2C_EEPROM_OperationEnd(dObj, DRV_I2C_EEPROM_TRANSFER_COMPLETED);
+            break;
+        }
+
+        default:
+        {
+            /* Nothing to do */
+            break;
+        }
+    }
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: I2C EEPROM Driver Global Functions
+// *****************************************************************************
+// *****************************************************************************
+
+SYS_MODULE_OBJ DRV_I2C_EEPROM_Initialize
+(
+    const SYS_MODULE_INDEX drvIndex,
+    const SYS_MODULE_INIT *const init
+)
+{
+    DRV_I2C_EEPROM_OBJECT *dObj = NULL;
+    const DRV_I2C_EEPROM_INIT *eepromInit = NULL;
+
+    /* Validate the driver index */
+    if (drvIndex >= DRV_I2C_EEPROM_INSTANCES_NUMBER)
+    {
+        return SYS_MODULE_OBJ_INVALID;
+    }
+
+    dObj = &gDrvI2CEEPROMObj[drvIndex];
+
+    /* Check if the instance has already been initialized. */
+    if (dObj->inUse == true)
+    {
+        return SYS_MODULE_OBJ_INVALID;
+    }
+
+    eepromInit = (const DRV_I2C_EEPROM_INIT *)init;
+
+    if ((eepromInit->pageBuffer == NULL) || (eepromInit->pageSize == 0U) || (eepromInit->eepromSize == 0U) ||
+        (eepromInit->addressBytes == 0U) || (eepromInit->addressBytes > DRV_I2C_EEPROM_ADDRESS_BYTES_MAX))
+    {
+        return SYS_MODULE_OBJ_INVALID;
+    }
+
+    dObj->inUse                 = true;
+    dObj->isOpened              = false;
+    dObj->i2cDrvIndex           = eepromInit->i2cDrvIndex;
+    dObj->i2cHandle             = DRV_HANDLE_INVALID;
+    dObj->slaveAddress          = eepromInit->slaveAddress;
+    dObj->clockSpeed            = eepromInit->clockSpeed;
+    dObj->eepromSize            = eepromInit->eepromSize;
+    dObj->pageSize              = eepromInit->pageSize;
+    dObj->addressBytes          = eepromInit->addressBytes;
+    dObj->pageBuffer            = eepromInit->pageBuffer;
+    dObj->writeCycleTimeUs      = eepromInit->writeCycleTimeUs;
+    dObj->ackPollDelayUs        = eepromInit->ackPollDelayUs;
+    dObj->ackPollIntervalMinUs  = eepromInit->ackPollIntervalMinUs;
+    dObj->ackPollIntervalMaxUs  = eepromInit->ackPollIntervalMaxUs;
+    dObj->state                 = DRV_I2C_EEPROM_STATE_IDLE;
+    dObj->transferStatus        = DRV_I2C_EEPROM_TRANSFER_COMPLETED;
+    dObj->isWriteCyclePending   = false;
+    dObj->delayHandle           = SYS_TIME_HANDLE_INVALID;
+    dObj->eventHandler          = NULL;
+    dObj->context               = 0U;
+
+    dObj->status = SYS_STATUS_READY;
+
+    /* Return the driver index */
+    return (SYS_MODULE_OBJ)drvIndex;
+}
+
+SYS_STATUS DRV_I2C_EEPROM_Status( const SYS_MODULE_INDEX drvIndex )
+{
+    if (drvIndex >= DRV_I2C_EEPROM_INSTANCES_NUMBER)
+    {
+        return SYS_STATUS_UNINITIALIZED;
+    }
+
+    /* Return the driver status */
+    return (gDrvI2CEEPROMObj[drvIndex].status);
+}
+
+void DRV_I2C_EEPROM_Tasks( SYS_MODULE_OBJ object )
+{
+    DRV_I2C_EEPROM_OBJECT *dObj = NULL;
+    uint32_t delayUs;
+
+    if (object >= DRV_I2C_EEPROM_INSTANCES_NUMBER)
+    {
+        return;
+    }
+
+    dObj = &gDrvI2CEEPROMObj[object];
+
+    if ((dObj->isOpened == false) || (dObj->state != DRV_I2C_EEPROM_STATE_WAIT_WRITE_CYCLE))
+    {
+        return;
+    }
+
+    if (dObj->delayHandle == SYS_TIME_HANDLE_INVALID)
+    {
+        delayUs = lDRV_I2C_EEPROM_PollDelayGet(dObj);
+
+        if (delayUs != 0U)
+        {
+            /* If no timer is available, the delay is requested again on the
+             * next call rather than polling the EEPROM without a delay. */
+            (void) SYS_TIME_DelayUS(delayUs, &dObj->delayHandle);
+            return;
+        }
+    }
+    else if (SYS_TIME_DelayIsComplete(dObj->delayHandle) == true)
+    {
+        dObj->delayHandle = SYS_TIME_HANDLE_INVALID;
+    }
+    else
+    {
+        return;
+    }
+
+    if (lDRV_I2C_EEPROM_TransferSubmit(dObj) == false)
+    {
+        lDRV_I2C_EEPROM_OperationEnd(dObj, DRV_I2C_EEPROM_TRANSFER_ERROR_UNKNOWN);
+    }
+}
+
+DRV_HANDLE DRV_I2C_EEPROM_Open( const SYS_MODULE_INDEX drvIndex, const DRV_IO_INTENT ioIntent )
+{
+    DRV_I2C_EEPROM_OBJECT *dObj = NULL;
+    DRV_I2C_TRANSFER_SETUP setup;
+
+    if (drvIndex >= DRV_I2C_EEPROM_INSTANCES_NUMBER)
+    {
+        SYS_DEBUG_MESSAGE(SYS_ERROR_ERROR, "Invalid Driver Instance");
+        return DRV_HANDLE_INVALID;
+    }
+
+    dObj = &gDrvI2CEEPROMObj[drvIndex];
+
+    if ((dObj->status != SYS_STATUS_READY) || (dObj->isOpened == true))
+    {
+        return DRV_HANDLE_INVALID;
+    }
+
+    /* The bus is shared with the other devices, open the I2C driver as one
+     * client among others. */
+    dObj->i2cHandle = DRV_I2C_Open(dObj->i2cDrvIndex, DRV_IO_INTENT_READWRITE);
+
+    if (dObj->i2cHandle == DRV_HANDLE_INVALID)
+    {
+        SYS_DEBUG_MESSAGE(SYS_ERROR_ERROR, "I2C EEPROM: Failed to open I2C driver");
+        return DRV_HANDLE_INVALID;
+    }
+
+    setup.clockSpeed = dObj->clockSpeed;
+
+    if (DRV_I2C_TransferSetup(dObj->i2cHandle, &setup) == false)
+    {
+        DRV_I2C_Close(dObj->i2cHandle);
+        dObj->i2cHandle = DRV_HANDLE_INVALID;
+        return DRV_HANDLE_INVALID;
+    }
+
+    DRV_I2C_TransferEventHandlerSet(dObj->i2cHandle, lDRV_I2C_EEPROM_EventHandler, (uintptr_t)dObj);
+
+    dObj->state             = DRV_I2C_EEPROM_STATE_IDLE;
+    dObj->transferStatus    = DRV_I2C_EEPROM_TRANSFER_COMPLETED;
+    dObj->eventHandler      = NULL;
+    dObj->isOpened          = true;
+
+    return ((DRV_HANDLE)drvIndex);
+}
+
+void DRV_I2C_EEPROM_Close( const DRV_HANDLE handle )
+{
+    DRV_I2C_EEPROM_OBJECT *dObj = lDRV_I2C_EEPROM_DriverHandleValidate(handle);
+
+    if (dObj == NULL)
+    {
+        return;
+    }
+
+    if (dObj->delayHandle != SYS_TIME_HANDLE_INVALID)
+    {
+        (void) SYS_TIME_TimerDestroy(dObj->delayHandle);
+        dObj->delayHandle = SYS_TIME_HANDLE_INVALID;
+    }
+
+    DRV_I2C_Close(dObj->i2cHandle);
+
+    dObj->i2cHandle = DRV_HANDLE_INVALID;
+    dObj->state = DRV_I2C_EEPROM_STATE_IDLE;
+    dObj->isOpened = false;
+}
+
+void DRV_I2C_EEPROM_EventHandlerSet(
+    const DRV_HANDLE handle,
+    const DRV_I2C_EEPROM_EVENT_HANDLER eventHandler,
+    const uintptr_t context
+)
+{
+    DRV_I2C_EEPROM_OBJECT *dObj = lDRV_I2C_EEPROM_DriverHandleValidate(handle);
+
+    if (dObj == NULL)
+    {
+        return;
+    }
+
+    dObj->eventHandler = eventHandler;
+    dObj->context = context;
+}
+
+bool DRV_I2C_EEPROM_Read( const DRV_HANDLE handle, void *rxData, uint32_t rxDataLength, uint32_t address )
+{
+    DRV_I2C_EEPROM_OBJECT *dObj = lDRV_I2C_EEPROM_DriverHandleValidate(handle);
+
+    if ((dObj == NULL) || (rxData == NULL) || (rxDataLength == 0U) || (dObj->state != DRV_I2C_EEPROM_STATE_IDLE))
+    {
+        return false;
+    }
+
+    if (((uint64_t)address + rxDataLength) > dObj->eepromSize)
+    {
+        return false;
+    }
+
+    dObj->operation = DRV_I2C_EEPROM_OPERATION_READ;
+    dObj->bufferPtr = (uint8_t *)rxData;
+    dObj->address = address;
+    dObj->nPendingBytes = rxDataLength;
+
+    return lDRV_I2C_EEPROM_OperationStart(dObj);
+}
+
+bool DRV_I2C_EEPROM_Write( const DRV_HANDLE handle, void *txData, uint32_t txDataLength, uint32_t address )
+{
+    DRV_I2C_EEPROM_OBJECT *dObj = lDRV_I2C_EEPROM_DriverHandleValidate(handle);
+
+    if ((dObj == NULL) || (txData == NULL) || (txDataLength == 0U) || (dObj->state != DRV_I2C_EEPROM_STATE_IDLE))
+    {
+        return false;
+    }
+
+    if (((uint64_t)address + txDataLength) > dObj->eepromSize)
+    {
+        return false;
+    }
+
+    dObj->operation = DRV_I2C_EEPROM_OPERATION_WRITE;
+    dObj->bufferPtr = (uint8_t *)txData;
+    dObj->address = address;
+    dObj->nPendingBytes = txDataLength;
+
+    return lDRV_I2C_EEPROM_OperationStart(dObj);
+}
+
+bool DRV_I2C_EEPROM_Flush( const DRV_HANDLE handle )
+{
+    DRV_I2C_EEPROM_OBJECT *dObj = lDRV_I2C_EEPROM_DriverHandleValidate(handle);
+
+    if ((dObj == NULL) || (dObj->state != DRV_I2C_EEPROM_STATE_IDLE))
+    {
+        return false;
+    }
+
+    if (dObj->isWriteCyclePending == false)
+    {
+        lDRV_I2C_EEPROM_OperationEnd(dObj, DRV_I2C_EEPROM_TRANSFER_COMPLETED);
+        return true;
+    }
+
+    /* The poll reuses the address of the last operation; any memory block
+     * address selects the same device. */
+    dObj->operation = DRV_I2C_EEPROM_OPERATION_FLUSH;
+    dObj->nPendingBytes = 0U;
+
+    return lDRV_I2C_EEPROM_OperationStart(dObj);
+}
+
+DRV_I2C_EEPROM_TRANSFER_STATUS DRV_I2C_EEPROM_TransferStatusGet( const DRV_HANDLE handle )
+{
+    DRV_I2C_EEPROM_OBJECT *dObj = lDRV_I2C_EEPROM_DriverHandleValidate(handle);
+
+    if (dObj == NULL)
+    {
+        return DRV_I2C_EEPROM_TRANSFER_ERROR_UNKNOWN;
+    }
+
+    return dObj->transferStatus;
+}
@@ -0,0 +1,178 @@
+/*******************************************************************************
+  I2C EEPROM Driver Local Data Structures
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    drv_i2c_eeprom_local.h
+
+  Summary:
+    I2C EEPROM driver local declarations and definitions
+
+  Description:
+    This file contains the I2C EEPROM driver's local declarations and
+    definitions.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+#ifndef DRV_I2C_EEPROM_LOCAL_H
+#define DRV_I2C_EEPROM_LOCAL_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File includes
+// *****************************************************************************
+// *****************************************************************************
+
+#include "configuration.h"
+#include "driver/i2c/drv_i2c.h"
+#include "driver/i2c_eeprom/drv_i2c_eeprom.h"
+#include "system/time/sys_time.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Data Type Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/* Largest number of memory address bytes of the supported devices */
+#define DRV_I2C_EEPROM_ADDRESS_BYTES_MAX        (2U)
+
+/* Memory address bits carried in the slave address of the devices with a one
+ * byte memory address (A8..A10 of the 4/8/16 Kbit devices) */
+#define DRV_I2C_EEPROM_SLAVE_ADDR_BLOCK_Msk     (0x07U)
+
+/* I2C EEPROM Driver operations */
+typedef enum
+{
+    DRV_I2C_EEPROM_OPERATION_READ = 0,
+
+    DRV_I2C_EEPROM_OPERATION_WRITE,
+
+    DRV_I2C_EEPROM_OPERATION_FLUSH
+
+} DRV_I2C_EEPROM_OPERATION;
+
+/* I2C EEPROM Driver operation states */
+typedef enum
+{
+    /* No operation in progress */
+    DRV_I2C_EEPROM_STATE_IDLE = 0,
+
+    /* Read transfer in progress */
+    DRV_I2C_EEPROM_STATE_READ,
+
+    /* Page write transfer in progress */
+    DRV_I2C_EEPROM_STATE_WRITE_PAGE,
+
+    /* Address only ACK poll of a flush in progress */
+    DRV_I2C_EEPROM_STATE_ACK_POLL,
+
+    /* The EEPROM is programming a page. The next transfer of the operation is
+     * issued by the Tasks routine when the poll delay expires. */
+    DRV_I2C_EEPROM_STATE_WAIT_WRITE_CYCLE
+
+} DRV_I2C_EEPROM_STATE;
+
+/**************************************
+ * I2C EEPROM Driver Hardware Instance Object
+ **************************************/
+typedef struct
+{
+    /* Flag to indicate in use */
+    bool inUse;
+
+    /* Flag to indicate that the driver has been opened */
+    bool isOpened;
+
+    /* The status of the driver */
+    SYS_STATUS status;
+
+    /* Index of the I2C driver instance used by the EEPROM */
+    SYS_MODULE_INDEX i2cDrvIndex;
+
+    /* Handle to the I2C driver instance */
+    DRV_HANDLE i2cHandle;
+
+    /* EEPROM geometry and addressing */
+    uint16_t slaveAddress;
+    uint32_t clockSpeed;
+    uint32_t eepromSize;
+    uint32_t pageSize;
+    uint8_t addressBytes;
+
+    /* Memory address followed by the data of the current page write */
+    uint8_t* pageBuffer;
+
+    /* Write cycle timing and ACK poll schedule, in microseconds */
+    uint32_t writeCycleTimeUs;
+    uint32_t ackPollDelayUs;
+    uint32_t ackPollIntervalMinUs;
+    uint32_t ackPollIntervalMaxUs;
+
+    /* Current operation */
+    DRV_I2C_EEPROM_OPERATION operation;
+
+    /* Current operation state, updated from the I2C driver event handler */
+    volatile DRV_I2C_EEPROM_STATE state;
+
+    /* Status of the last scheduled operation */
+    volatile DRV_I2C_EEPROM_TRANSFER_STATUS transferStatus;
+
+    /* User buffer position, EEPROM address and byte count of the remaining
+     * part of the operation */
+    uint8_t* bufferPtr;
+    uint32_t address;
+    uint32_t nPendingBytes;
+
+    /* Number of data bytes of the page write in progress */
+    uint32_t nPageBytes;
+
+    /* A page write has been accepted and its write cycle may still run */
+    volatile bool isWriteCyclePending;
+
+    /* SYS_TIME counter value at the end of the last page write */
+    volatile uint32_t writeCycleStartCount;
+
+    /* Interval to the next ACK poll, 0 until the first poll has failed */
+    volatile uint32_t pollIntervalUs;
+
+    /* Delay of the ACK poll being waited for */
+    SYS_TIME_HANDLE delayHandle;
+
+    /* Client event handler and context */
+    DRV_I2C_EEPROM_EVENT_HANDLER eventHandler;
+    uintptr_t context;
+
+} DRV_I2C_EEPROM_OBJECT;
+
+#endif //#ifndef DRV_I2C_EEPROM_LOCAL_H
+
+/*******************************************************************************
+ End of File
+*/
@@ -112,16 +112,31 @@ static const DRV_I2C_PLIB_INTERFACE drvI2C0PLibAPI = {
 
     /* I2C PLib Callback Register */
     .callbackRegister = (DRV_I2C_PLIB_CALLBACK_REGISTER)SERCOM5_I2C_CallbackRegister,
+
+    /* I2C PLib Multi-Segment Transfer function */
+    .transferSegments = (DRV_I2C_PLIB_TRANSFER_SEGMENTS)SERCOM5_I2C_TransferSegments,
+
+    .segmentIndexGet = (DRV_I2C_PLIB_SEGMENT_INDEX_GET)SERCOM5_I2C_SegmentIndexGet,
+
+    /* I2C PLib Baud Calculate and Baud Set functions */
+    .baudCalculate = (DRV_I2C_PLIB_BAUD_CALCULATE)SERCOM5_I2C_BaudCalculate,
+
+    .baudSet = (DRV_I2C_PLIB_BAUD_SET)SERCOM5_I2C_BaudSet,
 };
 
 
 static const DRV_I2C_INTERRUPT_SOURCES drvI2C0InterruptSources =
 {
-    /* Peripheral has single interrupt vector */
-    .isSingleIntSrc                        = true,
+    /* The PLib completes DMA transfers from the DMAC interrupt */
+    .isSingleIntSrc                        = false,
 
     /* Peripheral interrupt line */
-    .intSources.i2cInterrupt             = (int32_t)SERCOM5_IRQn,
+    .intSources.multi.i2cInt0              = (int32_t)SERCOM5_IRQn,
+
+    /* DMA interrupt line */
+    .intSources.multi.i2cInt1              = (int32_t)DMAC_IRQn,
+    .intSources.multi.i2cInt2              = -1,
+    .intSources.multi.i2cInt3              = -1,
 };
 
 /* I2C Driver Initialization Data */
@@ -149,6 +164,66 @@ static const DRV_I2C_INIT drvI2C0InitData =
     .clockSpeed = DRV_I2C_CLOCK_SPEED_IDX0,
 };
 // </editor-fold>
+// <editor-fold defaultstate="collapsed" desc="DRV_I2C_EEPROM Instance 0 Initialization Data">
+
+/* I2C EEPROM page write buffer (memory address followed by one page of data) */
+static uint8_t drvI2CEEPROM0PageBuffer[DRV_I2C_EEPROM_ADDRESS_BYTES_IDX0 + DRV_I2C_EEPROM_PAGE_SIZE_IDX0];
+
+static const DRV_I2C_EEPROM_INIT drvI2CEEPROM0InitData =
+{
+    /* I2C driver instance the EEPROM is connected to */
+    .i2cDrvIndex = DRV_I2C_INDEX_0,
+
+    /* EEPROM I2C address and clock speed */
+    .slaveAddress = DRV_I2C_EEPROM_SLAVE_ADDR_IDX0,
+    .clockSpeed = DRV_I2C_EEPROM_CLOCK_SPEED_IDX0,
+
+    /* EEPROM geometry */
+    .eepromSize = DRV_I2C_EEPROM_SIZE_IDX0,
+    .pageSize = DRV_I2C_EEPROM_PAGE_SIZE_IDX0,
+    .addressBytes = DRV_I2C_EEPROM_ADDRESS_BYTES_IDX0,
+    .pageBuffer = drvI2CEEPROM0PageBuffer,
+
+    /* Write cycle time and ACK poll schedule */
+    .writeCycleTimeUs = DRV_I2C_EEPROM_WRITE_CYCLE_TIME_US_IDX0,
+    .ackPollDelayUs = DRV_I2C_EEPROM_ACK_POLL_DELAY_US_IDX0,
+    .ackPollIntervalMinUs = DRV_I2C_EEPROM_ACK_POLL_INTERVAL_MIN_US_IDX0,
+    .ackPollIntervalMaxUs = DRV_I2C_EEPROM_ACK_POLL_INTERVAL_MAX_US_IDX0,
+};
+// </editor-fold>
+// <editor-fold defaultstate="collapsed" desc="SYS_I2C_SAMPLER Instance 0 Initialization Data">
+
+/* Sensors read by the sampler. The index in this table identifies the sensor
+ * in the samples. */
+static const SYS_I2C_SAMPLER_SENSOR sysI2CSampler0Sensors[] =
+{
+    /* Temperature sensor, 2 bytes temperature register */
+    {
+        .slaveAddress = 0x004F,
+        .registerAddress = 0x00,
+        .length = 2,
+        .periodMs = 1000,
+    },
+};
+
+static SYS_I2C_SAMPLER_SAMPLE sysI2CSampler0Ring[SYS_I2C_SAMPLER_RING_SIZE_IDX0];
+
+static const SYS_I2C_SAMPLER_INIT sysI2CSampler0InitData =
+{
+    /* I2C driver instance the sensors are connected to */
+    .i2cDrvIndex = DRV_I2C_INDEX_0,
+    .clockSpeed = SYS_I2C_SAMPLER_CLOCK_SPEED_IDX0,
+
+    /* Sensor table and scheduling tick */
+    .sensors = sysI2CSampler0Sensors,
+    .nSensors = sizeof(sysI2CSampler0Sensors) / sizeof(sysI2CSampler0Sensors[0]),
+    .tickPeriodMs = SYS_I2C_SAMPLER_TICK_PERIOD_MS_IDX0,
+
+    /* Sample ring buffer */
+    .ringBuffer = sysI2CSampler0Ring,
+    .ringSize = SYS_I2C_SAMPLER_RING_SIZE_IDX0,
+};
+// </editor-fold>
 
 
 
@@ -263,6 +338,8 @@ void SYS_Initialize ( void* data )
 
     EVSYS_Initialize();
 
+    DMAC_Initialize();
+
     SERCOM5_I2C_Initialize();
 
     SERCOM4_USART_Initialize();
@@ -279,6 +356,8 @@ void SYS_Initialize ( void* data )
     /* Initialize I2C0 Driver Instance */
     sysObj.drvI2C0 = DRV_I2C_Initialize(DRV_I2C_INDEX_0, (SYS_MODULE_INIT *)&drvI2C0InitData);
 
+    sysObj.drvI2CEEPROM0 = DRV_I2C_EEPROM_Initialize(DRV_I2C_EEPROM_INDEX_0, (SYS_MODULE_INIT *)&drvI2CEEPROM0InitData);
+
 
     /* MISRA C-2012 Rule 11.3, 11.8 deviated below. Deviation record ID -  
     H3_MISRAC_2012_R_11_3_DR_1 & H3_MISRAC_2012_R_11_8_DR_1*/
@@ -291,6 +370,8 @@ void SYS_Initialize ( void* data )
         sysObj.sysConsole0 = SYS_CONSOLE_Initialize(SYS_CONSOLE_INDEX_0, (SYS_MODULE_INIT *)&sysConsole0Init);
    /* MISRAC 2012 deviation block end */
 
+    sysObj.sysI2CSampler0 = SYS_I2C_SAMPLER_Initialize(SYS_I2C_SAMPLER_INDEX_0, (SYS_MODULE_INIT *)&sysI2CSampler0InitData);
+
 
     /* MISRAC 2012 deviation block end */
     APP_I2C_EEPROM_Initialize();
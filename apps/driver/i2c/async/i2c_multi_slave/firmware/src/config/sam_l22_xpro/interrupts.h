@@ -60,6 +60,7 @@
 void Reset_Handler (void);
 void NonMaskableInt_Handler (void);
 void HardFault_Handler (void);
+void DMAC_InterruptHandler (void);
 void SERCOM4_USART_InterruptHandler (void);
 void SERCOM5_I2C_InterruptHandler (void);
 void TC0_TimerInterruptHandler (void);
@@ -57,6 +57,8 @@ void NVIC_Initialize( void )
 
     /* Enable the interrupt sources and configure the priorities as configured
      * from within the "Interrupt Manager" of MHC. */
+    NVIC_SetPriority(DMAC_IRQn, 3);
+    NVIC_EnableIRQ(DMAC_IRQn);
     NVIC_SetPriority(SERCOM4_IRQn, 3);
     NVIC_EnableIRQ(SERCOM4_IRQn);
     NVIC_SetPriority(SERCOM5_IRQn, 3);
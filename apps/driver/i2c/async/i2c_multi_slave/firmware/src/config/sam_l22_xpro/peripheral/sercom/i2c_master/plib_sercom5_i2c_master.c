@@ -50,6 +50,7 @@
 
 #include "interrupts.h"
 #include "plib_sercom5_i2c_master.h"
+#include "peripheral/dmac/plib_dmac.h"
 
 
 // *****************************************************************************
@@ -64,9 +65,37 @@
 /* SERCOM5 I2C baud value */
 #define SERCOM5_I2CM_BAUD_VALUE         (0x21U)
 
+/* SERCOM5 I2C DMA channel, triggered by SERCOM5 RX (SB). Writes stay on the
+ * MB interrupt: the DMA would keep feeding DATA after a data NACK from the
+ * slave, and the NACK would not be reported. */
+#define SERCOM5_I2CM_DMA_RX_CHANNEL     DMAC_CHANNEL_0
+
+/* Read phases of at least this many bytes are moved by the DMA */
+#define SERCOM5_I2CM_DMA_THRESHOLD      (16U)
+
+/* Largest DMA block (DMAC BTCNT) */
+#define SERCOM5_I2CM_DMA_BLOCK_MAX      (0xFFFFU)
+
+/* Largest read whose final NACK and STOP are sent by the peripheral (ADDR.LEN) */
+#define SERCOM5_I2CM_DMA_LEN_MAX        (0xFFU)
+
+/* Highest Fast-mode Plus clock, faster clocks use the High-speed mode */
+#define SERCOM5_I2CM_FASTPLUS_SPEED_HZ_MAX  (1000000U)
+
+/* Highest High-speed mode clock */
+#define SERCOM5_I2CM_HIGHSPEED_SPEED_HZ_MAX (3400000U)
+
+/* Clock of the Fast mode part of High-speed transfers (master code) */
+#define SERCOM5_I2CM_HIGHSPEED_FS_SPEED_HZ  (400000U)
+
+/* Master code (0000 1xxx) sent ahead of High-speed transfers */
+#define SERCOM5_I2CM_MASTER_CODE        (0x0EU)
+
 
 volatile static SERCOM_I2C_OBJ sercom5I2CObj;
 
+static void SERCOM5_I2C_DMARxCallback(DMAC_TRANSFER_EVENT event, uintptr_t contextHandle);
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: SERCOM5 I2C Implementation
@@ -74,6 +103,163 @@ volatile static SERCOM_I2C_OBJ sercom5I2CObj;
 // *****************************************************************************
 // *****************************************************************************
 
+/* Returns the ADDR.HS bit keeping the transfer in High-speed mode */
+static uint32_t SERCOM5_I2C_HighSpeedBitGet(void)
+{
+    return (sercom5I2CObj.isHighSpeed ? SERCOM_I2CM_ADDR_HS_Msk : 0UL);
+}
+
+/* Returns true if the peripheral is set up for High-speed transfers */
+static bool SERCOM5_I2C_IsHighSpeedMode(void)
+{
+    return ((SERCOM5_REGS->I2CM.SERCOM_CTRLA & SERCOM_I2CM_CTRLA_SPEED_Msk) == SERCOM_I2CM_CTRLA_SPEED_HIGH_SPEED_MODE);
+}
+
+/* Returns true if the current data phase ends with a STOP */
+static bool SERCOM5_I2C_SegmentEndsWithStop(void)
+{
+    uint32_t segmentIndex = sercom5I2CObj.segmentIndex;
+
+    if((segmentIndex + 1U) >= sercom5I2CObj.nSegments)
+    {
+        return true;
+    }
+
+    return ((sercom5I2CObj.segments[segmentIndex].flags & (uint32_t)SERCOM_I2C_SEGMENT_FLAG_STOP) != 0U);
+}
+
+/* Loads the current segment as the data phase and returns its direction */
+static bool SERCOM5_I2C_SegmentLoad(void)
+{
+    SERCOM_I2C_SEGMENT* segment = &sercom5I2CObj.segments[sercom5I2CObj.segmentIndex];
+    bool dir = ((segment->flags & (uint32_t)SERCOM_I2C_SEGMENT_FLAG_READ) != 0U);
+
+    if((segment->flags & (uint32_t)SERCOM_I2C_SEGMENT_FLAG_ADDRESS) != 0U)
+    {
+        sercom5I2CObj.address = segment->address;
+    }
+    else
+    {
+        sercom5I2CObj.address = sercom5I2CObj.segmentsAddress;
+    }
+
+    sercom5I2CObj.writeCount = 0U;
+    sercom5I2CObj.readCount = 0U;
+
+    if(dir)
+    {
+        sercom5I2CObj.readBuffer = segment->buffer;
+        sercom5I2CObj.readSize = segment->size;
+        sercom5I2CObj.writeSize = 0U;
+    }
+    else
+    {
+        sercom5I2CObj.writeBuffer = segment->buffer;
+        sercom5I2CObj.writeSize = segment->size;
+        sercom5I2CObj.readSize = 0U;
+    }
+
+    return dir;
+}
+
+/* Selects the way the data of the read phase is received and returns the
+ * length bits to be written to ADDR along with the read address. Long reads
+ * are moved by the DMA with the SB interrupt disabled. */
+static uint32_t SERCOM5_I2C_ReadSetup(void)
+{
+    uint32_t addrLength = 0U;
+    size_t readSize = sercom5I2CObj.readSize;
+
+    /* Next state will be to read data */
+    sercom5I2CObj.state = SERCOM_I2C_STATE_TRANSFER_READ;
+
+    /* In High-speed mode the clock is stretched after the ACK bit (SCLSM),
+     * too late for the interrupt handler to NACK the last byte. All the
+     * reads are then left to the DMA with ADDR.LEN. */
+    if(((readSize >= SERCOM5_I2CM_DMA_THRESHOLD) || (sercom5I2CObj.isHighSpeed == true)) && (readSize <= SERCOM5_I2CM_DMA_BLOCK_MAX) && (DMAC_ChannelIsBusy(SERCOM5_I2CM_DMA_RX_CHANNEL) == false))
+    {
+        if((readSize <= SERCOM5_I2CM_DMA_LEN_MAX) && (SERCOM5_I2C_SegmentEndsWithStop() == true))
+        {
+            /* The peripheral NACKs the last byte and sends STOP by itself */
+            addrLength = SERCOM_I2CM_ADDR_LENEN_Msk | SERCOM_I2CM_ADDR_LEN(readSize);
+        }
+        else
+        {
+            /* The last byte is left to the interrupt handler */
+            readSize -= 1U;
+        }
+
+        SERCOM5_REGS->I2CM.SERCOM_INTENCLR = (uint8_t)SERCOM_I2CM_INTENCLR_SB_Msk;
+
+        sercom5I2CObj.state = SERCOM_I2C_STATE_TRANSFER_READ_DMA;
+
+        (void)DMAC_ChannelTransfer(SERCOM5_I2CM_DMA_RX_CHANNEL, (const void *)&SERCOM5_REGS->I2CM.SERCOM_DATA, sercom5I2CObj.readBuffer, readSize);
+    }
+
+    return addrLength;
+}
+
+static void SERCOM5_I2C_DMAStop(void)
+{
+    DMAC_ChannelDisable(SERCOM5_I2CM_DMA_RX_CHANNEL);
+}
+
+/* Moves to the next segment while the bus is still owned */
+static void SERCOM5_I2C_SegmentNext(void)
+{
+    uint32_t addrLength = 0U;
+    bool dir;
+
+    sercom5I2CObj.segmentIndex++;
+
+    dir = SERCOM5_I2C_SegmentLoad();
+
+    if((sercom5I2CObj.segments[sercom5I2CObj.segmentIndex].flags & (uint32_t)SERCOM_I2C_SEGMENT_FLAG_NO_START) != 0U)
+    {
+        /* Continue the write in progress with the first byte of the segment */
+        sercom5I2CObj.state = SERCOM_I2C_STATE_TRANSFER_WRITE;
+
+        SERCOM5_REGS->I2CM.SERCOM_DATA = sercom5I2CObj.writeBuffer[0];
+
+        /* Wait for synchronization */
+        while((SERCOM5_REGS->I2CM.SERCOM_SYNCBUSY) != 0U)
+        {
+            /* Do nothing */
+        }
+
+        sercom5I2CObj.writeCount = 1U;
+    }
+    else
+    {
+        if(dir)
+        {
+            addrLength = SERCOM5_I2C_ReadSetup();
+        }
+        else
+        {
+            sercom5I2CObj.state = SERCOM_I2C_STATE_TRANSFER_WRITE;
+        }
+
+        /* Repeated start. After a read, the pending NACK is sent first. */
+        SERCOM5_REGS->I2CM.SERCOM_ADDR = ((uint32_t)sercom5I2CObj.address << 1U) | (dir ? 1UL :0UL) | addrLength | SERCOM5_I2C_HighSpeedBitGet();
+
+        /* Wait for synchronization */
+        while((SERCOM5_REGS->I2CM.SERCOM_SYNCBUSY) != 0U)
+        {
+            /* Do nothing */
+        }
+
+        /* Restore the smart mode and the ACK of received bytes */
+        SERCOM5_REGS->I2CM.SERCOM_CTRLB = SERCOM_I2CM_CTRLB_SMEN_Msk;
+
+        /* Wait for synchronization */
+        while((SERCOM5_REGS->I2CM.SERCOM_SYNCBUSY) != 0U)
+        {
+            /* Do nothing */
+        }
+    }
+}
+
 void SERCOM5_I2C_Initialize(void)
 {
     /* Reset the module */
@@ -119,6 +305,8 @@ void SERCOM5_I2C_Initialize(void)
     sercom5I2CObj.error = SERCOM_I2C_ERROR_NONE;
     sercom5I2CObj.state = SERCOM_I2C_STATE_IDLE;
 
+    DMAC_ChannelCallbackRegister(SERCOM5_I2CM_DMA_RX_CHANNEL, SERCOM5_I2C_DMARxCallback, 0);
+
     /* Enable all Interrupts */
     SERCOM5_REGS->I2CM.SERCOM_INTENSET = (uint8_t)SERCOM_I2CM_INTENSET_Msk;
 }
@@ -187,13 +375,36 @@ static bool SERCOM5_I2C_CalculateBaudValue(uint32_t srcClkFreq, uint32_t i2cClkS
     return true;
 }
 
-bool SERCOM5_I2C_TransferSetup(SERCOM_I2C_TRANSFER_SETUP* setup, uint32_t srcClkFreq )
+/* High-speed mode SCL: fSCL = fGCLK / (2 + HSBAUD + HSBAUDLOW) */
+static bool SERCOM5_I2C_CalculateHsBaudValue(uint32_t srcClkFreq, uint32_t i2cClkSpeed, uint32_t* hsBaudVal)
 {
     uint32_t baudValue;
+
+    if ((i2cClkSpeed > SERCOM5_I2CM_HIGHSPEED_SPEED_HZ_MAX) || (srcClkFreq < (4U * i2cClkSpeed)))
+    {
+        return false;
+    }
+
+    baudValue = (srcClkFreq / i2cClkSpeed) - 2U;
+
+    if (baudValue >= 382U)
+    {
+        baudValue = 381U;
+    }
+
+    /* SCL_L:SCL_H of 2:1, as for Fm+ */
+    *hsBaudVal = (((baudValue * 2U) / 3U) << SERCOM_I2CM_BAUD_HSBAUDLOW_Pos) | ((baudValue - ((baudValue * 2U) / 3U)) << SERCOM_I2CM_BAUD_HSBAUD_Pos);
+
+    return true;
+}
+
+bool SERCOM5_I2C_BaudCalculate(SERCOM_I2C_TRANSFER_SETUP* setup, uint32_t srcClkFreq, SERCOM_I2C_BAUD_SETUP* baudSetup)
+{
+    uint32_t baudValue;
+    uint32_t hsBaudValue;
     uint32_t i2cClkSpeed;
-    uint32_t i2cSpeedMode = 0;
 
-    if (setup == NULL)
+    if ((setup == NULL) || (baudSetup == NULL))
     {
         return false;
     }
@@ -205,16 +416,35 @@ bool SERCOM5_I2C_TransferSetup(SERCOM_I2C_TRANSFER_SETUP* setup, uint32_t srcClk
         srcClkFreq = 32000000UL;
     }
 
-    if (SERCOM5_I2C_CalculateBaudValue(srcClkFreq, i2cClkSpeed, &baudValue) == false)
+    if (i2cClkSpeed > SERCOM5_I2CM_FASTPLUS_SPEED_HZ_MAX)
     {
-        return false;
-    }
+        /* The master code is sent in Fast mode, the rest of the transfer in
+         * High-speed mode. High-speed mode requires SCLSM. */
+        if ((SERCOM5_I2C_CalculateBaudValue(srcClkFreq, SERCOM5_I2CM_HIGHSPEED_FS_SPEED_HZ, &baudValue) == false) ||
+            (SERCOM5_I2C_CalculateHsBaudValue(srcClkFreq, i2cClkSpeed, &hsBaudValue) == false))
+        {
+            return false;
+        }
 
-    if (i2cClkSpeed > 400000U)
+        baudSetup->baud = baudValue | hsBaudValue;
+        baudSetup->mode = SERCOM_I2CM_CTRLA_SPEED_HIGH_SPEED_MODE | SERCOM_I2CM_CTRLA_SCLSM_Msk;
+    }
+    else
     {
-        i2cSpeedMode = 1U;
+        if (SERCOM5_I2C_CalculateBaudValue(srcClkFreq, i2cClkSpeed, &baudValue) == false)
+        {
+            return false;
+        }
+
+        baudSetup->baud = baudValue;
+        baudSetup->mode = (i2cClkSpeed > 400000U) ? SERCOM_I2CM_CTRLA_SPEED_FASTPLUS_MODE : SERCOM_I2CM_CTRLA_SPEED_STANDARD_AND_FAST_MODE;
     }
 
+    return true;
+}
+
+void SERCOM5_I2C_BaudSet(SERCOM_I2C_BAUD_SETUP* baudSetup)
+{
     /* Disable the I2C before changing the I2C clock speed */
     SERCOM5_REGS->I2CM.SERCOM_CTRLA &= ~SERCOM_I2CM_CTRLA_ENABLE_Msk;
 
@@ -226,9 +456,10 @@ bool SERCOM5_I2C_TransferSetup(SERCOM_I2C_TRANSFER_SETUP* setup, uint32_t srcClk
 
 
     /* Baud rate - Master Baud Rate*/
-    SERCOM5_REGS->I2CM.SERCOM_BAUD = baudValue;
+    SERCOM5_REGS->I2CM.SERCOM_BAUD = baudSetup->baud;
 
-    SERCOM5_REGS->I2CM.SERCOM_CTRLA  = ((SERCOM5_REGS->I2CM.SERCOM_CTRLA & ~SERCOM_I2CM_CTRLA_SPEED_Msk) | (SERCOM_I2CM_CTRLA_SPEED(i2cSpeedMode)));
+    /* Speed and SCL stretch mode are enable-protected */
+    SERCOM5_REGS->I2CM.SERCOM_CTRLA  = ((SERCOM5_REGS->I2CM.SERCOM_CTRLA & ~(SERCOM_I2CM_CTRLA_SPEED_Msk | SERCOM_I2CM_CTRLA_SCLSM_Msk)) | baudSetup->mode);
 
     /* Re-enable the I2C module */
     SERCOM5_REGS->I2CM.SERCOM_CTRLA |= SERCOM_I2CM_CTRLA_ENABLE_Msk;
@@ -248,6 +479,18 @@ bool SERCOM5_I2C_TransferSetup(SERCOM_I2C_TRANSFER_SETUP* setup, uint32_t srcClk
     {
         /* Do nothing */
     }
+}
+
+bool SERCOM5_I2C_TransferSetup(SERCOM_I2C_TRANSFER_SETUP* setup, uint32_t srcClkFreq )
+{
+    SERCOM_I2C_BAUD_SETUP baudSetup;
+
+    if (SERCOM5_I2C_BaudCalculate(setup, srcClkFreq, &baudSetup) == false)
+    {
+        return false;
+    }
+
+    SERCOM5_I2C_BaudSet(&baudSetup);
 
     return true;
 }
@@ -262,13 +505,15 @@ void SERCOM5_I2C_CallbackRegister(SERCOM_I2C_CALLBACK callback, uintptr_t contex
 
 static void SERCOM5_I2C_SendAddress(uint16_t address, bool dir)
 {
+    uint32_t addrLength = 0U;
+
     /* If operation is I2C read */
     if(dir)
     {
         /* <xxxx-xxxR> <read-data> <P> */
 
         /* Next state will be to read data */
-        sercom5I2CObj.state = SERCOM_I2C_STATE_TRANSFER_READ;
+        addrLength = SERCOM5_I2C_ReadSetup();
     }
     else
     {
@@ -279,7 +524,7 @@ static void SERCOM5_I2C_SendAddress(uint16_t address, bool dir)
     }
 
 
-    SERCOM5_REGS->I2CM.SERCOM_ADDR = ((uint32_t)address << 1U) | (dir ? 1UL :0UL);
+    SERCOM5_REGS->I2CM.SERCOM_ADDR = ((uint32_t)address << 1U) | (dir ? 1UL :0UL) | addrLength | SERCOM5_I2C_HighSpeedBitGet();
 
     /* Wait for synchronization */
     while((SERCOM5_REGS->I2CM.SERCOM_SYNCBUSY) != 0U)
@@ -306,8 +551,125 @@ static void SERCOM5_I2C_InitiateTransfer(uint16_t address, bool dir)
         /* Do nothing */
     }
 
+    if(sercom5I2CObj.isHighSpeed == true)
+    {
+        /* Send the master code in Fast mode first. The slave address follows
+         * with a repeated start in High-speed mode once the master code has
+         * been NACKed (see the interrupt handler). */
+        sercom5I2CObj.txMasterCode = true;
+        sercom5I2CObj.transferDir = dir;
 
-    SERCOM5_I2C_SendAddress(address, dir);
+        SERCOM5_REGS->I2CM.SERCOM_ADDR = (uint32_t)sercom5I2CObj.masterCode;
+
+        /* Wait for synchronization */
+        while((SERCOM5_REGS->I2CM.SERCOM_SYNCBUSY) != 0U)
+        {
+            /* Do nothing */
+        }
+    }
+    else
+    {
+        SERCOM5_I2C_SendAddress(address, dir);
+    }
+}
+
+/* Starts the next segment, if any, once the STOP of the previous one is out */
+static bool SERCOM5_I2C_SegmentStartNext(void)
+{
+    bool dir;
+
+    if((sercom5I2CObj.segmentIndex + 1U) >= sercom5I2CObj.nSegments)
+    {
+        return false;
+    }
+
+    sercom5I2CObj.segmentIndex++;
+
+    /* Loading the segment selects its slave address */
+    dir = SERCOM5_I2C_SegmentLoad();
+
+    SERCOM5_I2C_InitiateTransfer(sercom5I2CObj.address, dir);
+
+    return true;
+}
+
+static void SERCOM5_I2C_DMATransferEnd(void)
+{
+    uintptr_t context = sercom5I2CObj.context;
+
+    if(sercom5I2CObj.state == SERCOM_I2C_STATE_ERROR)
+    {
+        /* Generate STOP condition */
+        SERCOM5_REGS->I2CM.SERCOM_CTRLB |= SERCOM_I2CM_CTRLB_CMD(3UL);
+
+        /* Wait for synchronization */
+        while((SERCOM5_REGS->I2CM.SERCOM_SYNCBUSY) != 0U)
+        {
+            /* Do nothing */
+        }
+    }
+    else
+    {
+        sercom5I2CObj.error = SERCOM_I2C_ERROR_NONE;
+
+        /* Wait for the NAK and STOP bit sent by the peripheral (ADDR.LEN) to be
+         * transmitted out and I2C state machine to rest in IDLE state */
+        while((SERCOM5_REGS->I2CM.SERCOM_STATUS & SERCOM_I2CM_STATUS_BUSSTATE_Msk) != SERCOM_I2CM_STATUS_BUSSTATE(0x01U))
+        {
+            /* Do nothing */
+        }
+    }
+
+    /* Reset the PLib objects and interrupts */
+    sercom5I2CObj.state = SERCOM_I2C_STATE_IDLE;
+
+    SERCOM5_REGS->I2CM.SERCOM_INTFLAG = (uint8_t)SERCOM_I2CM_INTFLAG_Msk;
+    SERCOM5_REGS->I2CM.SERCOM_INTENSET = (uint8_t)SERCOM_I2CM_INTENSET_Msk;
+
+    if(sercom5I2CObj.error == SERCOM_I2C_ERROR_NONE)
+    {
+        if(SERCOM5_I2C_SegmentStartNext() == true)
+        {
+            return;
+        }
+    }
+
+    if(sercom5I2CObj.callback != NULL)
+    {
+        sercom5I2CObj.callback(context);
+    }
+}
+
+static void SERCOM5_I2C_DMARxCallback(DMAC_TRANSFER_EVENT event, uintptr_t contextHandle)
+{
+    /* Ignore the completion of a transfer already ended by an error or an abort */
+    if(sercom5I2CObj.state != SERCOM_I2C_STATE_TRANSFER_READ_DMA)
+    {
+        return;
+    }
+
+    if(event != DMAC_TRANSFER_EVENT_COMPLETE)
+    {
+        sercom5I2CObj.state = SERCOM_I2C_STATE_ERROR;
+        sercom5I2CObj.error = SERCOM_I2C_ERROR_BUS;
+
+        SERCOM5_I2C_DMATransferEnd();
+    }
+    else if((sercom5I2CObj.readSize <= SERCOM5_I2CM_DMA_LEN_MAX) && (SERCOM5_I2C_SegmentEndsWithStop() == true))
+    {
+        /* All bytes received, the peripheral has sent the NACK and STOP */
+        sercom5I2CObj.readCount = sercom5I2CObj.readSize;
+
+        SERCOM5_I2C_DMATransferEnd();
+    }
+    else
+    {
+        /* The interrupt handler reads the last byte, NACKs it and sends STOP */
+        sercom5I2CObj.readCount = sercom5I2CObj.readSize - 1U;
+        sercom5I2CObj.state = SERCOM_I2C_STATE_TRANSFER_READ;
+
+        SERCOM5_REGS->I2CM.SERCOM_INTENSET = (uint8_t)SERCOM_I2CM_INTENSET_SB_Msk;
+    }
 }
 
 static bool SERCOM5_I2C_XferSetup(
@@ -316,16 +678,23 @@ static bool SERCOM5_I2C_XferSetup(
     uint32_t wrLength,
     uint8_t* rdData,
     uint32_t rdLength,
-    bool dir,
-    bool isHighSpeed
+    bool dir
 )
 {
+    bool isHighSpeed = SERCOM5_I2C_IsHighSpeedMode();
+
     /* Check for ongoing transfer */
     if(sercom5I2CObj.state != SERCOM_I2C_STATE_IDLE)
     {
         return false;
     }
 
+    /* High-speed reads end with ADDR.LEN, limited to 255 bytes */
+    if((isHighSpeed == true) && (rdLength > SERCOM5_I2CM_DMA_LEN_MAX))
+    {
+        return false;
+    }
+
     sercom5I2CObj.address        = address;
     sercom5I2CObj.readBuffer     = rdData;
     sercom5I2CObj.readSize       = rdLength;
@@ -333,7 +702,12 @@ static bool SERCOM5_I2C_XferSetup(
     sercom5I2CObj.writeSize      = wrLength;
     sercom5I2CObj.transferDir    = dir;
     sercom5I2CObj.isHighSpeed    = isHighSpeed;
+    sercom5I2CObj.txMasterCode   = false;
+    sercom5I2CObj.masterCode     = SERCOM5_I2CM_MASTER_CODE;
     sercom5I2CObj.error          = SERCOM_I2C_ERROR_NONE;
+    sercom5I2CObj.segments       = NULL;
+    sercom5I2CObj.nSegments      = 0U;
+    sercom5I2CObj.segmentIndex   = 0U;
 
 
     SERCOM5_I2C_InitiateTransfer(address, dir);
@@ -343,17 +717,62 @@ static bool SERCOM5_I2C_XferSetup(
 
 bool SERCOM5_I2C_Read(uint16_t address, uint8_t* rdData, uint32_t rdLength)
 {
-    return SERCOM5_I2C_XferSetup(address, NULL, 0, rdData, rdLength, true, false);
+    return SERCOM5_I2C_XferSetup(address, NULL, 0, rdData, rdLength, true);
 }
 
 bool SERCOM5_I2C_Write(uint16_t address, uint8_t* wrData, uint32_t wrLength)
 {
-    return SERCOM5_I2C_XferSetup(address, wrData, wrLength, NULL, 0, false, false);
+    return SERCOM5_I2C_XferSetup(address, wrData, wrLength, NULL, 0, false);
 }
 
 bool SERCOM5_I2C_WriteRead(uint16_t address, uint8_t* wrData, uint32_t wrLength, uint8_t* rdData, uint32_t rdLength)
 {
-    return SERCOM5_I2C_XferSetup(address, wrData, wrLength, rdData, rdLength, false, false);
+    return SERCOM5_I2C_XferSetup(address, wrData, wrLength, rdData, rdLength, false);
+}
+
+bool SERCOM5_I2C_TransferSegments(uint16_t address, SERCOM_I2C_SEGMENT* segments, uint32_t nSegments)
+{
+    uint32_t index;
+
+    /* Check for ongoing transfer */
+    if(sercom5I2CObj.state != SERCOM_I2C_STATE_IDLE)
+    {
+        return false;
+    }
+
+    if((segments == NULL) || (nSegments == 0U))
+    {
+        return false;
+    }
+
+    /* High-speed reads end with ADDR.LEN: at most 255 bytes followed by STOP */
+    if(SERCOM5_I2C_IsHighSpeedMode() == true)
+    {
+        for(index = 0U; index < nSegments; index++)
+        {
+            if(((segments[index].flags & (uint32_t)SERCOM_I2C_SEGMENT_FLAG_READ) != 0U) &&
+               ((segments[index].size > SERCOM5_I2CM_DMA_LEN_MAX) ||
+                (((segments[index].flags & (uint32_t)SERCOM_I2C_SEGMENT_FLAG_STOP) == 0U) && ((index + 1U) < nSegments))))
+            {
+                return false;
+            }
+        }
+    }
+
+    sercom5I2CObj.segmentsAddress = address;
+    sercom5I2CObj.segments       = segments;
+    sercom5I2CObj.nSegments      = nSegments;
+    sercom5I2CObj.segmentIndex   = 0U;
+    sercom5I2CObj.isHighSpeed    = SERCOM5_I2C_IsHighSpeedMode();
+    sercom5I2CObj.txMasterCode   = false;
+    sercom5I2CObj.masterCode     = SERCOM5_I2CM_MASTER_CODE;
+    sercom5I2CObj.error          = SERCOM_I2C_ERROR_NONE;
+
+    sercom5I2CObj.transferDir    = SERCOM5_I2C_SegmentLoad();
+
+    SERCOM5_I2C_InitiateTransfer(sercom5I2CObj.address, sercom5I2CObj.transferDir);
+
+    return true;
 }
 
 
@@ -446,13 +865,25 @@ SERCOM_I2C_ERROR SERCOM5_I2C_ErrorGet(void)
     return sercom5I2CObj.error;
 }
 
+/* Index of the segment on the bus; after an error, of the segment that failed */
+uint32_t SERCOM5_I2C_SegmentIndexGet(void)
+{
+    return sercom5I2CObj.segmentIndex;
+}
+
 void SERCOM5_I2C_TransferAbort( void )
 {
     sercom5I2CObj.error = SERCOM_I2C_ERROR_NONE;
+    sercom5I2CObj.txMasterCode = false;
 
     // Reset the plib to IDLE state
     sercom5I2CObj.state = SERCOM_I2C_STATE_IDLE;
 
+    SERCOM5_I2C_DMAStop();
+
+    /* Restore the interrupts disabled for the DMA */
+    SERCOM5_REGS->I2CM.SERCOM_INTENSET = (uint8_t)SERCOM_I2CM_INTENSET_Msk;
+
     /* Disable the I2C module */
     SERCOM5_REGS->I2CM.SERCOM_CTRLA &= ~SERCOM_I2CM_CTRLA_ENABLE_Msk;
 
@@ -503,6 +934,13 @@ void __attribute__((used)) SERCOM5_I2C_InterruptHandler(void)
             sercom5I2CObj.error = SERCOM_I2C_ERROR_BUS;
         }
         /* Checks slave acknowledge for address or data */
+        /* No slave acknowledges the master code, continue in High-speed mode */
+        else if(sercom5I2CObj.txMasterCode == true)
+        {
+            sercom5I2CObj.txMasterCode = false;
+
+            SERCOM5_I2C_SendAddress(sercom5I2CObj.address, sercom5I2CObj.transferDir);
+        }
         else if((SERCOM5_REGS->I2CM.SERCOM_STATUS & SERCOM_I2CM_STATUS_RXNACK_Msk) == SERCOM_I2CM_STATUS_RXNACK_Msk)
         {
             sercom5I2CObj.state = SERCOM_I2C_STATE_ERROR;
@@ -540,11 +978,17 @@ void __attribute__((used)) SERCOM5_I2C_InterruptHandler(void)
 
                     if (writeCount == (sercom5I2CObj.writeSize))
                     {
-                        if(sercom5I2CObj.readSize != 0U)
+                        if(SERCOM5_I2C_SegmentEndsWithStop() == false)
+                        {
+                            SERCOM5_I2C_SegmentNext();
+                        }
+                        else if(sercom5I2CObj.readSize != 0U)
                         {
 
+                            uint32_t addrLength = SERCOM5_I2C_ReadSetup();
+
                             /* Write 7bit address with direction (ADDR.ADDR[0]) equal to 1*/
-                            SERCOM5_REGS->I2CM.SERCOM_ADDR =  ((uint32_t)(sercom5I2CObj.address) << 1U) | (uint32_t)I2C_TRANSFER_READ;
+                            SERCOM5_REGS->I2CM.SERCOM_ADDR =  ((uint32_t)(sercom5I2CObj.address) << 1U) | (uint32_t)I2C_TRANSFER_READ | addrLength | SERCOM5_I2C_HighSpeedBitGet();
 
                             /* Wait for synchronization */
                             while((SERCOM5_REGS->I2CM.SERCOM_SYNCBUSY) != 0U)
@@ -552,8 +996,6 @@ void __attribute__((used)) SERCOM5_I2C_InterruptHandler(void)
                                 /* Do nothing */
                             }
 
-                            sercom5I2CObj.state = SERCOM_I2C_STATE_TRANSFER_READ;
-
                         }
                         else
                         {
@@ -588,9 +1030,24 @@ void __attribute__((used)) SERCOM5_I2C_InterruptHandler(void)
                 case SERCOM_I2C_STATE_TRANSFER_READ:
                 {
                     size_t readCount = sercom5I2CObj.readCount;
+                    bool isRestart = false;
 
 
-                    if(readCount == (sercom5I2CObj.readSize - 1U))
+                    if((readCount == (sercom5I2CObj.readSize - 1U)) && (SERCOM5_I2C_SegmentEndsWithStop() == false))
+                    {
+                        /* Leave the smart mode so that reading the last byte does not
+                         * acknowledge it. The NACK is sent with the repeated start. */
+                        SERCOM5_REGS->I2CM.SERCOM_CTRLB = SERCOM_I2CM_CTRLB_ACKACT_Msk;
+
+                        /* Wait for synchronization */
+                        while((SERCOM5_REGS->I2CM.SERCOM_SYNCBUSY) != 0U)
+                        {
+                            /* Do nothing */
+                        }
+
+                        isRestart = true;
+                    }
+                    else if(readCount == (sercom5I2CObj.readSize - 1U))
                     {
                         /* Set NACK and send stop condition to the slave from master */
                         SERCOM5_REGS->I2CM.SERCOM_CTRLB |= SERCOM_I2CM_CTRLB_ACKACT_Msk | SERCOM_I2CM_CTRLB_CMD(3UL);
@@ -615,10 +1072,25 @@ void __attribute__((used)) SERCOM5_I2C_InterruptHandler(void)
                     readCount++;
 
                     sercom5I2CObj.readCount = readCount;
+
+                    if(isRestart == true)
+                    {
+                        SERCOM5_I2C_SegmentNext();
+                    }
                 }
 
                     break;
 
+                case SERCOM_I2C_STATE_TRANSFER_READ_DMA:
+
+                    /* Data is moved by the DMA, only an error ends up here */
+                    if((SERCOM5_REGS->I2CM.SERCOM_INTFLAG & SERCOM_I2CM_INTFLAG_ERROR_Msk) != 0U)
+                    {
+                        sercom5I2CObj.state = SERCOM_I2C_STATE_ERROR;
+                        sercom5I2CObj.error = SERCOM_I2C_ERROR_BUS;
+                    }
+                    break;
+
                 default:
 
                     /* Do nothing */
@@ -632,6 +1104,10 @@ void __attribute__((used)) SERCOM5_I2C_InterruptHandler(void)
             /* Reset the PLib objects and Interrupts */
             sercom5I2CObj.state = SERCOM_I2C_STATE_IDLE;
 
+            SERCOM5_I2C_DMAStop();
+
+            SERCOM5_REGS->I2CM.SERCOM_INTENSET = (uint8_t)SERCOM_I2CM_INTENSET_Msk;
+
             /* Generate STOP condition */
             SERCOM5_REGS->I2CM.SERCOM_CTRLB |= SERCOM_I2CM_CTRLB_CMD(3UL);
 
@@ -664,10 +1140,19 @@ void __attribute__((used)) SERCOM5_I2C_InterruptHandler(void)
                 /* Do nothing */
             }
 
-            if(sercom5I2CObj.callback != NULL)
+            /* A segment ended with STOP, the transaction goes on with a START */
+            if(SERCOM5_I2C_SegmentStartNext() == true)
+            {
+                /* Do nothing */
+            }
+            else if(sercom5I2CObj.callback != NULL)
             {
                 sercom5I2CObj.callback(context);
             }
+            else
+            {
+                /* Do nothing */
+            }
 
         }
         else
@@ -81,14 +81,22 @@ bool SERCOM5_I2C_Write(uint16_t address, uint8_t* wrData, uint32_t wrLength);
 
 bool SERCOM5_I2C_WriteRead(uint16_t address, uint8_t* wrData, uint32_t wrLength, uint8_t* rdData, uint32_t rdLength);
 
+bool SERCOM5_I2C_TransferSegments(uint16_t address, SERCOM_I2C_SEGMENT* segments, uint32_t nSegments);
+
 bool SERCOM5_I2C_IsBusy(void);
 
 SERCOM_I2C_ERROR SERCOM5_I2C_ErrorGet(void);
 
+uint32_t SERCOM5_I2C_SegmentIndexGet(void);
+
 void SERCOM5_I2C_CallbackRegister(SERCOM_I2C_CALLBACK callback, uintptr_t contextHandle);
 
 bool SERCOM5_I2C_TransferSetup(SERCOM_I2C_TRANSFER_SETUP* setup, uint32_t srcClkFreq );
 
+bool SERCOM5_I2C_BaudCalculate(SERCOM_I2C_TRANSFER_SETUP* setup, uint32_t srcClkFreq, SERCOM_I2C_BAUD_SETUP* baudSetup);
+
+void SERCOM5_I2C_BaudSet(SERCOM_I2C_BAUD_SETUP* baudSetup);
+
 
 void SERCOM5_I2C_TransferAbort( void );
 
@@ -156,8 +156,79 @@ typedef enum
     /* SERCOM PLib Task Transfer Done State */
     SERCOM_I2C_STATE_TRANSFER_DONE,
 
+    /* SERCOM PLib Task DMA Read Transfer State */
+    SERCOM_I2C_STATE_TRANSFER_READ_DMA,
+
 } SERCOM_I2C_STATE;
 
+// *****************************************************************************
+/* SERCOM I2C Transaction Segment Flags
+
+   Summary:
+    SERCOM I2C transaction segment flags.
+
+   Description:
+    This data type defines the flags controlling one segment of a
+    SERCOMx_I2C_TransferSegments transaction. A segment starts with a START
+    (a repeated START if the bus is still owned) and the slave address, unless
+    SERCOM_I2C_SEGMENT_FLAG_NO_START continues the write of the previous
+    segment. The last segment always ends with a STOP.
+
+   Remarks:
+    None.
+*/
+
+typedef enum
+{
+    /* Segment writes to the slave */
+    SERCOM_I2C_SEGMENT_FLAG_WRITE = 0,
+
+    /* Segment reads from the slave */
+    SERCOM_I2C_SEGMENT_FLAG_READ = 1 << 0,
+
+    /* Send a STOP after the segment */
+    SERCOM_I2C_SEGMENT_FLAG_STOP = 1 << 1,
+
+    /* Write segment sent right after the previous write segment, without
+     * a repeated START and slave address */
+    SERCOM_I2C_SEGMENT_FLAG_NO_START = 1 << 2,
+
+    /* Segment addresses the slave given in its address field instead of the
+     * slave of the transaction */
+    SERCOM_I2C_SEGMENT_FLAG_ADDRESS = 1 << 3,
+
+} SERCOM_I2C_SEGMENT_FLAGS;
+
+// *****************************************************************************
+/* SERCOM I2C Transaction Segment
+
+   Summary:
+    SERCOM I2C transaction segment.
+
+   Description:
+    This data type defines one data phase of a SERCOMx_I2C_TransferSegments
+    transaction.
+
+   Remarks:
+    None.
+*/
+
+typedef struct
+{
+    /* Data to write or buffer to read into */
+    uint8_t*                    buffer;
+
+    /* Number of bytes, at least one */
+    size_t                      size;
+
+    /* SERCOM_I2C_SEGMENT_FLAGS */
+    uint32_t                    flags;
+
+    /* Slave address used with SERCOM_I2C_SEGMENT_FLAG_ADDRESS */
+    uint16_t                    address;
+
+} SERCOM_I2C_SEGMENT;
+
 // *****************************************************************************
 /* SERCOM I2C Callback
 
@@ -215,6 +286,16 @@ typedef struct
 
     size_t                      readCount;
 
+    /* Segments of a SERCOMx_I2C_TransferSegments transaction, none otherwise */
+    SERCOM_I2C_SEGMENT*         segments;
+
+    uint32_t                    nSegments;
+
+    uint32_t                    segmentIndex;
+
+    /* Slave address of the segments without SERCOM_I2C_SEGMENT_FLAG_ADDRESS */
+    uint16_t                    segmentsAddress;
+
     /* State */
     SERCOM_I2C_STATE            state;
 
@@ -249,6 +330,32 @@ typedef struct
 
 } SERCOM_I2C_TRANSFER_SETUP;
 
+// *****************************************************************************
+/* SERCOM I2C Baud Setup
+
+   Summary:
+    SERCOM I2C bus speed register settings.
+
+   Description:
+    This data structure holds the register settings computed by
+    SERCOMx_I2C_BaudCalculate for one bus speed. It lets a caller switching
+    between a few bus speeds compute each of them once and apply them with
+    SERCOMx_I2C_BaudSet.
+
+   Remarks:
+    None.
+*/
+
+typedef struct
+{
+    /* BAUD register value, including the High-speed mode baud fields */
+    uint32_t baud;
+
+    /* CTRLA speed mode and SCL clock stretch mode bits */
+    uint32_t mode;
+
+} SERCOM_I2C_BAUD_SETUP;
+
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus  // Provide C++ Compatibility
 
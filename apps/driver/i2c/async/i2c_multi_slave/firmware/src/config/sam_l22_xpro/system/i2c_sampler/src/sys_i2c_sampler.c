@@ -0,0 +1,539 @@
+/*******************************************************************************
+  I2C Sampler System Service Implementation
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sys_i2c_sampler.c
+
+  Summary:
+    Periodic sensor sampling on top of the I2C driver.
+
+  Description:
+    This file implements the I2C sampler. A periodic SYS_TIME callback counts
+    ticks; on each new tick SYS_I2C_SAMPLER_Tasks gathers the sensors that are
+    due into a batch. Each sensor of the batch is read by its own
+    DRV_I2C_TransactionAdd, queued from the completion handler of the previous
+    one, so a sensor that does not acknowledge only loses its own sample and
+    only one sampler transfer occupies the driver queue at a time. The
+    completion handler appends the results to a ring buffer that the
+    consumers read without locking.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Include Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <string.h>
+#include "system/i2c_sampler/src/sys_i2c_sampler_local.h"
+#include "system/debug/sys_debug.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global objects
+// *****************************************************************************
+// *****************************************************************************
+
+static SYS_I2C_SAMPLER_OBJECT gSysI2CSamplerObj[SYS_I2C_SAMPLER_INSTANCES_NUMBER];
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: I2C Sampler Local Functions
+// *****************************************************************************
+// *****************************************************************************
+
+static SYS_I2C_SAMPLER_OBJECT * lSYS_I2C_SAMPLER_ObjectGet( SYS_MODULE_OBJ object )
+{
+    if ((object >= SYS_I2C_SAMPLER_INSTANCES_NUMBER) || (gSysI2CSamplerObj[object].inUse == false))
+    {
+        return NULL;
+    }
+
+    return &gSysI2CSamplerObj[object];
+}
+
+static void lSYS_I2C_SAMPLER_TickCallback( uintptr_t context )
+{
+    SYS_I2C_SAMPLER_OBJECT *obj = (SYS_I2C_SAMPLER_OBJECT *)context;
+
+    /* The batch is built in the Tasks routine, the I2C driver must not be
+     * called from the timer interrupt. */
+    obj->tickCount++;
+}
+
+/* Stores the samples of the sensors of the batch from the current position up
+ * to endPosition, whose reads have completed */
+static void lSYS_I2C_SAMPLER_SamplesStore( SYS_I2C_SAMPLER_OBJECT *obj, uint32_t endPosition )
+{
+    SYS_I2C_SAMPLER_SAMPLE *slot;
+    uint32_t sensorIndex;
+
+    while (obj->batchPosition < endPosition)
+    {
+        sensorIndex = obj->batchSensors[obj->batchPosition];
+        slot = &obj->ringBuffer[obj->head % obj->ringSize];
+
+        slot->timestamp = obj->batchTimestamp;
+        slot->sensorIndex = (uint8_t)sensorIndex;
+        slot->length = obj->sensors[sensorIndex].length;
+        (void) memcpy(slot->data, obj->data[sensorIndex], slot->length);
+
+        /* The sample must be complete before the consumers can see it */
+        __DMB();
+
+        obj->head++;
+        obj->batchPosition++;
+    }
+}
+
+/* Counts the reads of the sensors of the batch from the current position up
+ * to endPosition as failed */
+static void lSYS_I2C_SAMPLER_SamplesDrop( SYS_I2C_SAMPLER_OBJECT *obj, uint32_t endPosition )
+{
+    while (obj->batchPosition < endPosition)
+    {
+        obj->sensorErrorCount[obj->batchSensors[obj->batchPosition]]++;
+        obj->errorCount++;
+        obj->batchPosition++;
+    }
+}
+
+/* Queues the sensors of the batch from the current position on as a single
+ * transaction, a register write and a data read per sensor. If it cannot be
+ * queued, the reads of these sensors fail and the batch ends. */
+static void lSYS_I2C_SAMPLER_BatchQueue( SYS_I2C_SAMPLER_OBJECT *obj )
+{
+    const SYS_I2C_SAMPLER_SENSOR *sensor;
+    DRV_I2C_SEGMENT *segment;
+    DRV_I2C_TRANSFER_HANDLE transferHandle;
+    uint32_t position;
+    uint32_t sensorIndex;
+    size_t nSegments = 0U;
+
+    for (position = obj->batchPosition; position < obj->nBatchSensors; position++)
+    {
+        sensorIndex = obj->batchSensors[position];
+        sensor = &obj->sensors[sensorIndex];
+        segment = &obj->segments[nSegments];
+
+        /* Register address, followed by a repeated START and the data read */
+        segment[0].buffer = &obj->registerAddress[sensorIndex];
+        segment[0].size = 1U;
+        segment[0].flags = (uint32_t)DRV_I2C_SEGMENT_FLAG_WRITE | (uint32_t)DRV_I2C_SEGMENT_FLAG_ADDRESS;
+        segment[0].address = sensor->slaveAddress;
+
+        segment[1].buffer = obj->data[sensorIndex];
+        segment[1].size = sensor->length;
+        segment[1].flags = (uint32_t)DRV_I2C_SEGMENT_FLAG_READ | (uint32_t)DRV_I2C_SEGMENT_FLAG_STOP | (uint32_t)DRV_I2C_SEGMENT_FLAG_ADDRESS;
+        segment[1].address = sensor->slaveAddress;
+
+        nSegments += 2U;
+    }
+
+    /* The transaction may end, and the event handler queue the rest of the
+     * batch, before DRV_I2C_TransactionAdd returns. The batch must not be
+     * touched here once the transaction is queued. */
+    DRV_I2C_TransactionAdd(obj->i2cHandle, obj->segments[0].address, obj->segments, nSegments, &transferHandle);
+
+    if (transferHandle != DRV_I2C_TRANSFER_HANDLE_INVALID)
+    {
+        return;
+    }
+
+    lSYS_I2C_SAMPLER_SamplesDrop(obj, obj->nBatchSensors);
+
+    obj->state = SYS_I2C_SAMPLER_STATE_IDLE;
+}
+
+/* Called from the I2C driver interrupt context when the batch transaction
+ * ends. When a sensor fails, the segment the transaction stopped on tells
+ * which: the sensors before it have their samples, the sensor is counted as
+ * failed and the sensors after it are queued again. */
+static void lSYS_I2C_SAMPLER_EventHandler(
+    DRV_I2C_TRANSFER_EVENT event,
+    DRV_I2C_TRANSFER_HANDLE transferHandle,
+    uintptr_t context
+)
+{
+    SYS_I2C_SAMPLER_OBJECT *obj = (SYS_I2C_SAMPLER_OBJECT *)context;
+    uint32_t failedSegment;
+    uint32_t failedPosition;
+
+    if (event == DRV_I2C_TRANSFER_EVENT_COMPLETE)
+    {
+        lSYS_I2C_SAMPLER_SamplesStore(obj, obj->nBatchSensors);
+
+        obj->state = SYS_I2C_SAMPLER_STATE_IDLE;
+        return;
+    }
+
+    failedSegment = DRV_I2C_TransactionFailedSegmentGet(transferHandle);
+
+    if (failedSegment == DRV_I2C_SEGMENT_INDEX_INVALID)
+    {
+        /* Which sensor failed is not known, none of the samples is kept */
+        lSYS_I2C_SAMPLER_SamplesDrop(obj, obj->nBatchSensors);
+
+        obj->state = SYS_I2C_SAMPLER_STATE_IDLE;
+        return;
+    }
+
+    /* Two segments per sensor */
+    failedPosition = obj->batchPosition + (failedSegment / 2U);
+
+    lSYS_I2C_SAMPLER_SamplesStore(obj, failedPosition);
+    lSYS_I2C_SAMPLER_SamplesDrop(obj, failedPosition + 1U);
+
+    if (obj->batchPosition < obj->nBatchSensors)
+    {
+        lSYS_I2C_SAMPLER_BatchQueue(obj);
+    }
+    else
+    {
+        obj->state = SYS_I2C_SAMPLER_STATE_IDLE;
+    }
+}
+
+/* Collects the sensors due at the given tick into the batch and returns their
+ * number */
+static uint32_t lSYS_I2C_SAMPLER_BatchBuild( SYS_I2C_SAMPLER_OBJECT *obj, uint32_t tick )
+{
+    uint32_t nSensors = 0U;
+    uint32_t index;
+
+    for (index = 0U; index < obj->nSensors; index++)
+    {
+        if ((int32_t)(tick - obj->nextDueTick[index]) < 0)
+        {
+            continue;
+        }
+
+        obj->nextDueTick[index] += obj->periodTicks[index];
+
+        /* Ticks were missed while a batch was on the bus, restart the period
+         * from now rather than reading the sensor on several batches in a row */
+        if ((int32_t)(tick - obj->nextDueTick[index]) >= 0)
+        {
+            obj->nextDueTick[index] = tick + obj->periodTicks[index];
+        }
+
+        obj->batchSensors[nSensors] = (uint8_t)index;
+        nSensors++;
+    }
+
+    obj->nBatchSensors = nSensors;
+    obj->batchPosition = 0U;
+
+    return nSensors;
+}
+
+static bool lSYS_I2C_SAMPLER_Start( SYS_I2C_SAMPLER_OBJECT *obj )
+{
+    DRV_I2C_TRANSFER_SETUP setup;
+
+    obj->i2cHandle = DRV_I2C_Open(obj->i2cDrvIndex, DRV_IO_INTENT_READWRITE);
+
+    if (obj->i2cHandle == DRV_HANDLE_INVALID)
+    {
+        SYS_DEBUG_MESSAGE(SYS_ERROR_ERROR, "I2C Sampler: Failed to open I2C driver");
+        return false;
+    }
+
+    setup.clockSpeed = obj->clockSpeed;
+
+    if (DRV_I2C_TransferSetup(obj->i2cHandle, &setup) == false)
+    {
+        SYS_DEBUG_MESSAGE(SYS_ERROR_ERROR, "I2C Sampler: Invalid clock speed");
+        return false;
+    }
+
+    DRV_I2C_TransferEventHandlerSet(obj->i2cHandle, lSYS_I2C_SAMPLER_EventHandler, (uintptr_t)obj);
+
+    obj->tmrHandle = SYS_TIME_CallbackRegisterMS(lSYS_I2C_SAMPLER_TickCallback, (uintptr_t)obj, obj->tickPeriodMs, SYS_TIME_PERIODIC);
+
+    if (obj->tmrHandle == SYS_TIME_HANDLE_INVALID)
+    {
+        SYS_DEBUG_MESSAGE(SYS_ERROR_ERROR, "I2C Sampler: Failed to start the tick timer");
+        return false;
+    }
+
+    return true;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: I2C Sampler Global Functions
+// *****************************************************************************
+// *****************************************************************************
+
+SYS_MODULE_OBJ SYS_I2C_SAMPLER_Initialize
+(
+    const SYS_MODULE_INDEX index,
+    const SYS_MODULE_INIT *const init
+)
+{
+    SYS_I2C_SAMPLER_OBJECT *obj = NULL;
+    const SYS_I2C_SAMPLER_INIT *samplerInit = (const SYS_I2C_SAMPLER_INIT *)init;
+    uint32_t sensorIndex;
+
+    if ((index >= SYS_I2C_SAMPLER_INSTANCES_NUMBER) || (samplerInit == NULL))
+    {
+        return SYS_MODULE_OBJ_INVALID;
+    }
+
+    obj = &gSysI2CSamplerObj[index];
+
+    if (obj->inUse == true)
+    {
+        return SYS_MODULE_OBJ_INVALID;
+    }
+
+    /* One ring entry is kept free for the sample being written */
+    if ((samplerInit->sensors == NULL) || (samplerInit->nSensors == 0U) ||
+        (samplerInit->nSensors > SYS_I2C_SAMPLER_SENSORS_MAX) || (samplerInit->tickPeriodMs == 0U) ||
+        (samplerInit->ringBuffer == NULL) || (samplerInit->ringSize < 2U))
+    {
+        return SYS_MODULE_OBJ_INVALID;
+    }
+
+    for (sensorIndex = 0U; sensorIndex < samplerInit->nSensors; sensorIndex++)
+    {
+        if ((samplerInit->sensors[sensorIndex].length == 0U) ||
+            (samplerInit->sensors[sensorIndex].length > SYS_I2C_SAMPLER_DATA_SIZE_MAX))
+        {
+            return SYS_MODULE_OBJ_INVALID;
+        }
+    }
+
+    (void) memset(obj, 0, sizeof(SYS_I2C_SAMPLER_OBJECT));
+
+    obj->i2cDrvIndex    = samplerInit->i2cDrvIndex;
+    obj->i2cHandle      = DRV_HANDLE_INVALID;
+    obj->clockSpeed     = samplerInit->clockSpeed;
+    obj->sensors        = samplerInit->sensors;
+    obj->nSensors       = samplerInit->nSensors;
+    obj->tickPeriodMs   = samplerInit->tickPeriodMs;
+    obj->tmrHandle      = SYS_TIME_HANDLE_INVALID;
+    obj->ringBuffer     = samplerInit->ringBuffer;
+    obj->ringSize       = samplerInit->ringSize;
+
+    for (sensorIndex = 0U; sensorIndex < obj->nSensors; sensorIndex++)
+    {
+        obj->periodTicks[sensorIndex] = obj->sensors[sensorIndex].periodMs / obj->tickPeriodMs;
+
+        if (obj->periodTicks[sensorIndex] == 0U)
+        {
+            obj->periodTicks[sensorIndex] = 1U;
+        }
+
+        /* All the sensors are due on the first tick. Sensors with the same
+         * period stay aligned on the same batches afterwards. */
+        obj->nextDueTick[sensorIndex] = 0U;
+        obj->registerAddress[sensorIndex] = obj->sensors[sensorIndex].registerAddress;
+    }
+
+    obj->state = SYS_I2C_SAMPLER_STATE_INIT;
+    obj->inUse = true;
+
+    return (SYS_MODULE_OBJ)index;
+}
+
+SYS_STATUS SYS_I2C_SAMPLER_Status( SYS_MODULE_OBJ object )
+{
+    SYS_I2C_SAMPLER_OBJECT *obj = lSYS_I2C_SAMPLER_ObjectGet(object);
+
+    if (obj == NULL)
+    {
+        return SYS_STATUS_UNINITIALIZED;
+    }
+
+    if (obj->state == SYS_I2C_SAMPLER_STATE_INIT)
+    {
+        return SYS_STATUS_BUSY;
+    }
+
+    if (obj->state == SYS_I2C_SAMPLER_STATE_ERROR)
+    {
+        return SYS_STATUS_ERROR;
+    }
+
+    return SYS_STATUS_READY;
+}
+
+void SYS_I2C_SAMPLER_Tasks( SYS_MODULE_OBJ object )
+{
+    SYS_I2C_SAMPLER_OBJECT *obj = lSYS_I2C_SAMPLER_ObjectGet(object);
+    uint32_t tick;
+
+    if (obj == NULL)
+    {
+        return;
+    }
+
+    switch (obj->state)
+    {
+        case SYS_I2C_SAMPLER_STATE_INIT:
+        {
+            if (lSYS_I2C_SAMPLER_Start(obj) == true)
+            {
+                obj->state = SYS_I2C_SAMPLER_STATE_IDLE;
+            }
+            else
+            {
+                obj->state = SYS_I2C_SAMPLER_STATE_ERROR;
+            }
+            break;
+        }
+
+        case SYS_I2C_SAMPLER_STATE_IDLE:
+        {
+            tick = obj->tickCount;
+
+            if (tick == obj->tickProcessed)
+            {
+                break;
+            }
+
+            obj->tickProcessed = tick;
+
+            if (lSYS_I2C_SAMPLER_BatchBuild(obj, tick) == 0U)
+            {
+                break;
+            }
+
+            obj->batchTimestamp = SYS_TIME_CounterGet();
+
+            /* The batch may end before lSYS_I2C_SAMPLER_BatchQueue returns */
+            obj->state = SYS_I2C_SAMPLER_STATE_BATCH;
+
+            lSYS_I2C_SAMPLER_BatchQueue(obj);
+            break;
+        }
+
+        case SYS_I2C_SAMPLER_STATE_BATCH:
+        case SYS_I2C_SAMPLER_STATE_ERROR:
+        default:
+        {
+            /* Nothing to do */
+            break;
+        }
+    }
+}
+
+uint32_t SYS_I2C_SAMPLER_SampleCursorGet( SYS_MODULE_OBJ object )
+{
+    SYS_I2C_SAMPLER_OBJECT *obj = lSYS_I2C_SAMPLER_ObjectGet(object);
+
+    if (obj == NULL)
+    {
+        return 0U;
+    }
+
+    return obj->head;
+}
+
+bool SYS_I2C_SAMPLER_SampleGet
+(
+    SYS_MODULE_OBJ object,
+    uint32_t* cursor,
+    SYS_I2C_SAMPLER_SAMPLE* sample
+)
+{
+    SYS_I2C_SAMPLER_OBJECT *obj = lSYS_I2C_SAMPLER_ObjectGet(object);
+    uint32_t position;
+    uint32_t head;
+
+    if ((obj == NULL) || (cursor == NULL) || (sample == NULL))
+    {
+        return false;
+    }
+
+    position = *cursor;
+    head = obj->head;
+
+    if (position == head)
+    {
+        return false;
+    }
+
+    /* The entry of the sample head - ringSize is the next one to be written,
+     * only the ringSize - 1 newest samples are stable. */
+    if ((head - position) >= obj->ringSize)
+    {
+        position = head - obj->ringSize + 1U;
+    }
+
+    for (;;)
+    {
+        *sample = obj->ringBuffer[position % obj->ringSize];
+
+        /* Read head only after the copy: if the writer moved past the entry
+         * in the meantime the copy may be torn and is taken again. */
+        __DMB();
+
+        head = obj->head;
+
+        if ((head - position) < obj->ringSize)
+        {
+            break;
+        }
+
+        position = head - obj->ringSize + 1U;
+    }
+
+    *cursor = position + 1U;
+
+    return true;
+}
+
+uint32_t SYS_I2C_SAMPLER_ErrorCountGet( SYS_MODULE_OBJ object )
+{
+    SYS_I2C_SAMPLER_OBJECT *obj = lSYS_I2C_SAMPLER_ObjectGet(object);
+
+    if (obj == NULL)
+    {
+        return 0U;
+    }
+
+    return obj->errorCount;
+}
+
+uint32_t SYS_I2C_SAMPLER_SensorErrorCountGet( SYS_MODULE_OBJ object, uint32_t sensorIndex )
+{
+    SYS_I2C_SAMPLER_OBJECT *obj = lSYS_I2C_SAMPLER_ObjectGet(object);
+
+    if ((obj == NULL) || (sensorIndex >= obj->nSensors))
+    {
+        return 0U;
+    }
+
+    return obj->sensorErrorCount[sensorIndex];
+}
@@ -0,0 +1,145 @@
+/*******************************************************************************
+  I2C Sampler System Service Local Data Structures
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sys_i2c_sampler_local.h
+
+  Summary:
+    I2C sampler system service local declarations and definitions
+
+  Description:
+    This file contains the I2C sampler system service's local declarations and
+    definitions.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+#ifndef SYS_I2C_SAMPLER_LOCAL_H
+#define SYS_I2C_SAMPLER_LOCAL_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File includes
+// *****************************************************************************
+// *****************************************************************************
+
+#include "configuration.h"
+#include "device.h"
+#include "driver/i2c/drv_i2c.h"
+#include "system/i2c_sampler/sys_i2c_sampler.h"
+#include "system/time/sys_time.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Data Type Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/* I2C sampler states */
+typedef enum
+{
+    /* The I2C driver is not opened yet */
+    SYS_I2C_SAMPLER_STATE_INIT = 0,
+
+    /* Waiting for the next tick */
+    SYS_I2C_SAMPLER_STATE_IDLE,
+
+    /* The transaction of a batch is on the bus */
+    SYS_I2C_SAMPLER_STATE_BATCH,
+
+    /* The I2C driver or the tick timer could not be started */
+    SYS_I2C_SAMPLER_STATE_ERROR
+
+} SYS_I2C_SAMPLER_STATE;
+
+/**************************************
+ * I2C Sampler Instance Object
+ **************************************/
+typedef struct
+{
+    /* Flag to indicate in use */
+    bool inUse;
+
+    /* Current state, updated from the I2C driver event handler */
+    volatile SYS_I2C_SAMPLER_STATE state;
+
+    /* Index of the I2C driver instance and handle to it */
+    SYS_MODULE_INDEX i2cDrvIndex;
+    DRV_HANDLE i2cHandle;
+    uint32_t clockSpeed;
+
+    /* Sensor table */
+    const SYS_I2C_SAMPLER_SENSOR* sensors;
+    uint32_t nSensors;
+
+    /* Sensor schedule, in ticks */
+    uint32_t periodTicks[SYS_I2C_SAMPLER_SENSORS_MAX];
+    uint32_t nextDueTick[SYS_I2C_SAMPLER_SENSORS_MAX];
+
+    /* Register addresses written before the data reads */
+    uint8_t registerAddress[SYS_I2C_SAMPLER_SENSORS_MAX];
+
+    /* Sensor data received by the batch in progress */
+    uint8_t data[SYS_I2C_SAMPLER_SENSORS_MAX][SYS_I2C_SAMPLER_DATA_SIZE_MAX];
+
+    /* Segments of the batch transaction on the bus, two per sensor */
+    DRV_I2C_SEGMENT segments[2U * SYS_I2C_SAMPLER_SENSORS_MAX];
+
+    /* Sensors of the batch in progress and the position of the first one of
+     * the transaction on the bus, updated from the I2C driver event handler */
+    uint8_t batchSensors[SYS_I2C_SAMPLER_SENSORS_MAX];
+    uint32_t nBatchSensors;
+    volatile uint32_t batchPosition;
+
+    /* SYS_TIME counter value when the batch in progress was issued */
+    uint32_t batchTimestamp;
+
+    /* Tick timer, its period and the number of ticks elapsed and processed */
+    SYS_TIME_HANDLE tmrHandle;
+    uint32_t tickPeriodMs;
+    volatile uint32_t tickCount;
+    uint32_t tickProcessed;
+
+    /* Sample ring buffer. head counts the samples stored since
+     * initialization; the sample n is held in ringBuffer[n % ringSize]. */
+    SYS_I2C_SAMPLER_SAMPLE* ringBuffer;
+    uint32_t ringSize;
+    volatile uint32_t head;
+
+    /* Number of failed sensor reads, in total and per sensor */
+    volatile uint32_t errorCount;
+    volatile uint32_t sensorErrorCount[SYS_I2C_SAMPLER_SENSORS_MAX];
+
+} SYS_I2C_SAMPLER_OBJECT;
+
+#endif //#ifndef SYS_I2C_SAMPLER_LOCAL_H
+
+/*******************************************************************************
+ End of File
+*/
@@ -0,0 +1,355 @@
+/*******************************************************************************
+  I2C Sampler System Service Interface Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sys_i2c_sampler.h
+
+  Summary:
+    I2C Sampler System Service interface definitions.
+
+  Description:
+    The I2C sampler reads a static table of sensor registers over a DRV_I2C
+    instance. The sensors due on the same tick are read as one batch, a single
+    I2C transaction, and the results are stored in a timestamped ring buffer
+    read without locking by the application.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+#ifndef SYS_I2C_SAMPLER_H
+#define SYS_I2C_SAMPLER_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File includes
+// *****************************************************************************
+// *****************************************************************************
+
+#include "system/system.h"
+#include "sys_i2c_sampler_definitions.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: I2C Sampler System Service Module Interface Routines
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* Function:
+    SYS_MODULE_OBJ SYS_I2C_SAMPLER_Initialize
+    (
+        const SYS_MODULE_INDEX index,
+        const SYS_MODULE_INIT *const init
+    );
+
+  Summary:
+    Initializes the I2C Sampler System Service
+
+  Description:
+    This routine initializes an instance of the I2C sampler. The I2C driver
+    is opened and the sampling tick is started by SYS_I2C_SAMPLER_Tasks.
+
+  Precondition:
+    None.
+
+  Parameters:
+    index - Identifier for the instance to be initialized
+
+    init  - Pointer to a SYS_I2C_SAMPLER_INIT structure
+
+  Returns:
+    If successful, returns a valid handle to the service instance object.
+    Otherwise it returns SYS_MODULE_OBJ_INVALID.
+
+  Example:
+    <code>
+    static const SYS_I2C_SAMPLER_SENSOR sensors[] =
+    {
+        { .slaveAddress = 0x4F, .registerAddress = 0x00, .length = 2, .periodMs = 1000 },
+    };
+
+    static SYS_I2C_SAMPLER_SAMPLE ring[8];
+
+    const SYS_I2C_SAMPLER_INIT sysI2CSamplerInitData =
+    {
+        .i2cDrvIndex    = DRV_I2C_INDEX_0,
+        .clockSpeed     = 400000,
+        .sensors        = sensors,
+        .nSensors       = 1,
+        .tickPeriodMs   = 100,
+        .ringBuffer     = ring,
+        .ringSize       = 8,
+    };
+
+    objectHandle = SYS_I2C_SAMPLER_Initialize(SYS_I2C_SAMPLER_INDEX_0, (SYS_MODULE_INIT *)&sysI2CSamplerInitData);
+    </code>
+
+  Remarks:
+    This routine must be called after the I2C driver instance it uses has been
+    initialized.
+*/
+
+SYS_MODULE_OBJ SYS_I2C_SAMPLER_Initialize
+(
+    const SYS_MODULE_INDEX index,
+    const SYS_MODULE_INIT *const init
+);
+
+// *************************************************************************
+/* Function:
+    SYS_STATUS SYS_I2C_SAMPLER_Status( SYS_MODULE_OBJ object );
+
+  Summary:
+    Gets the current status of the I2C sampler.
+
+  Description:
+    Returns SYS_STATUS_READY once the I2C driver has been opened and the
+    sampling tick is running, SYS_STATUS_BUSY before, and SYS_STATUS_ERROR if
+    either failed.
+
+  Precondition:
+    SYS_I2C_SAMPLER_Initialize must have been called.
+
+  Parameters:
+    object - Object handle returned by SYS_I2C_SAMPLER_Initialize
+
+  Returns:
+    The current status of the service.
+
+  Remarks:
+    None.
+*/
+
+SYS_STATUS SYS_I2C_SAMPLER_Status( SYS_MODULE_OBJ object );
+
+// *************************************************************************
+/* Function:
+    void SYS_I2C_SAMPLER_Tasks( SYS_MODULE_OBJ object );
+
+  Summary:
+    Maintains the I2C sampler state machine.
+
+  Description:
+    Opens the I2C driver on the first call, then starts a batch with the
+    sensors that are due each time the sampling tick has elapsed. The batch
+    is queued to the I2C driver as one transaction. If a sensor fails, the
+    sensors after it are queued again as a new transaction from the
+    completion of the failed one. A sensor that falls due while the previous
+    batch is still on the bus is read with the next batch.
+
+  Precondition:
+    SYS_I2C_SAMPLER_Initialize must have been called.
+
+  Parameters:
+    object - Object handle returned by SYS_I2C_SAMPLER_Initialize
+
+  Returns:
+    None.
+
+  Remarks:
+    This routine is called from SYS_Tasks.
+*/
+
+void SYS_I2C_SAMPLER_Tasks( SYS_MODULE_OBJ object );
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: I2C Sampler System Service Client Routines
+// *****************************************************************************
+// *****************************************************************************
+
+// *************************************************************************
+/* Function:
+    uint32_t SYS_I2C_SAMPLER_SampleCursorGet( SYS_MODULE_OBJ object );
+
+  Summary:
+    Returns a read cursor positioned after the newest sample.
+
+  Description:
+    A consumer keeps its own cursor, a running count of the samples stored
+    in the ring buffer. The returned cursor makes SYS_I2C_SAMPLER_SampleGet
+    return only the samples stored from now on.
+
+  Precondition:
+    SYS_I2C_SAMPLER_Initialize must have been called.
+
+  Parameters:
+    object - Object handle returned by SYS_I2C_SAMPLER_Initialize
+
+  Returns:
+    The read cursor. A cursor of 0 starts with the oldest sample still held
+    in the ring buffer.
+
+  Remarks:
+    None.
+*/
+
+uint32_t SYS_I2C_SAMPLER_SampleCursorGet( SYS_MODULE_OBJ object );
+
+// *************************************************************************
+/* Function:
+    bool SYS_I2C_SAMPLER_SampleGet
+    (
+        SYS_MODULE_OBJ object,
+        uint32_t* cursor,
+        SYS_I2C_SAMPLER_SAMPLE* sample
+    );
+
+  Summary:
+    Copies the next sample of the ring buffer.
+
+  Description:
+    Copies the sample at the cursor position and advances the cursor. If the
+    consumer fell behind by more than the ring buffer holds, the cursor first
+    skips to the oldest sample still available; the number of lost samples is
+    the cursor difference minus one.
+
+    The ring buffer is written from the I2C driver interrupt context and read
+    without locking: the copy is discarded and retried if the sample was
+    overwritten while it was copied.
+
+  Precondition:
+    SYS_I2C_SAMPLER_Initialize must have been called.
+
+  Parameters:
+    object - Object handle returned by SYS_I2C_SAMPLER_Initialize
+
+    cursor - Read cursor of the consumer
+
+    sample - Where the sample is copied
+
+  Returns:
+    true  - A sample was copied
+    false - No new sample is available
+
+  Example:
+    <code>
+    static uint32_t cursor;
+    SYS_I2C_SAMPLER_SAMPLE sample;
+
+    while (SYS_I2C_SAMPLER_SampleGet(sysObj.sysI2CSampler0, &cursor, &sample) == true)
+    {
+        // Use sample.data
+    }
+    </code>
+
+  Remarks:
+    Not to be called from an interrupt that may preempt the I2C driver
+    interrupt.
+*/
+
+bool SYS_I2C_SAMPLER_SampleGet
+(
+    SYS_MODULE_OBJ object,
+    uint32_t* cursor,
+    SYS_I2C_SAMPLER_SAMPLE* sample
+);
+
+// *************************************************************************
+/* Function:
+    uint32_t SYS_I2C_SAMPLER_ErrorCountGet( SYS_MODULE_OBJ object );
+
+  Summary:
+    Returns the number of failed sensor reads.
+
+  Description:
+    A sensor read fails when the sensor does not acknowledge or the read
+    cannot be queued to the I2C driver. No sample is stored for it; the other
+    sensors of the same batch are not affected. If the I2C PLib does not
+    report the segment a transaction failed on, the failing sensor is not
+    known and all the reads of the batch left on the bus fail.
+
+  Precondition:
+    SYS_I2C_SAMPLER_Initialize must have been called.
+
+  Parameters:
+    object - Object handle returned by SYS_I2C_SAMPLER_Initialize
+
+  Returns:
+    Number of failed sensor reads since initialization, all sensors together.
+
+  Remarks:
+    Use SYS_I2C_SAMPLER_SensorErrorCountGet to find the failing sensor.
+*/
+
+uint32_t SYS_I2C_SAMPLER_ErrorCountGet( SYS_MODULE_OBJ object );
+
+// *************************************************************************
+/* Function:
+    uint32_t SYS_I2C_SAMPLER_SensorErrorCountGet( SYS_MODULE_OBJ object,
+        uint32_t sensorIndex );
+
+  Summary:
+    Returns the number of failed reads of one sensor.
+
+  Description:
+    Returns the number of reads of the sensor that failed, as counted by
+    SYS_I2C_SAMPLER_ErrorCountGet.
+
+  Precondition:
+    SYS_I2C_SAMPLER_Initialize must have been called.
+
+  Parameters:
+    object - Object handle returned by SYS_I2C_SAMPLER_Initialize
+
+    sensorIndex - Index of the sensor in the sensor table
+
+  Returns:
+    Number of failed reads of the sensor since initialization, 0 for an
+    invalid sensor index.
+
+  Example:
+    <code>
+    uint32_t errorCount = SYS_I2C_SAMPLER_SensorErrorCountGet(sysObj.sysI2CSampler0, 0U);
+    </code>
+
+  Remarks:
+    None.
+*/
+
+uint32_t SYS_I2C_SAMPLER_SensorErrorCountGet( SYS_MODULE_OBJ object, uint32_t sensorIndex );
+
+//DOM-IGNORE-BEGIN
+#ifdef __cplusplus
+}
+#endif
+//DOM-IGNORE-END
+
+#endif // #ifndef SYS_I2C_SAMPLER_H
+/*******************************************************************************
+ End of File
+*/
@@ -0,0 +1,188 @@
+/*******************************************************************************
+  I2C Sampler System Service Definitions Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sys_i2c_sampler_definitions.h
+
+  Summary:
+    I2C Sampler System Service Definitions Header File
+
+  Description:
+    This file provides implementation-specific definitions for the I2C sampler
+    system service's system interface.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+#ifndef SYS_I2C_SAMPLER_DEFINITIONS_H
+#define SYS_I2C_SAMPLER_DEFINITIONS_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File includes
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "configuration.h"
+#include "system/system_module.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* I2C Sampler Sensor
+
+  Summary:
+    Defines one entry of the sensor table of the I2C sampler
+
+  Description:
+    This data type defines a sensor register read periodically by the I2C
+    sampler: the register address is written to the slave, then length bytes
+    are read back, every periodMs milliseconds.
+
+  Remarks:
+    periodMs is rounded down to a multiple of the sampler tick period, with a
+    minimum of one tick.
+*/
+
+typedef struct
+{
+    /* 7-bit I2C address of the sensor */
+    uint16_t                        slaveAddress;
+
+    /* Register read from the sensor */
+    uint8_t                         registerAddress;
+
+    /* Number of bytes read, up to SYS_I2C_SAMPLER_DATA_SIZE_MAX */
+    uint8_t                         length;
+
+    /* Sampling period in milliseconds */
+    uint32_t                        periodMs;
+
+} SYS_I2C_SAMPLER_SENSOR;
+
+// *****************************************************************************
+/* I2C Sampler Sample
+
+  Summary:
+    Defines one entry of the sample ring buffer
+
+  Description:
+    This data type defines a sample stored in the ring buffer of the I2C
+    sampler. All the samples of a batch carry the same timestamp, the
+    SYS_TIME counter value when the batch was issued on the bus.
+
+  Remarks:
+    None.
+*/
+
+typedef struct
+{
+    /* SYS_TIME counter value when the batch of the sample was issued */
+    uint32_t                        timestamp;
+
+    /* Index of the sensor in the sensor table */
+    uint8_t                         sensorIndex;
+
+    /* Number of valid bytes in data */
+    uint8_t                         length;
+
+    /* Register content, as read from the sensor */
+    uint8_t                         data[SYS_I2C_SAMPLER_DATA_SIZE_MAX];
+
+} SYS_I2C_SAMPLER_SAMPLE;
+
+// *****************************************************************************
+/* I2C Sampler Initialization Data
+
+  Summary:
+    Defines the data required to initialize the I2C sampler
+
+  Description:
+    This data type defines the data required to initialize the I2C sampler
+    system service. The sampler opens the DRV_I2C instance identified by
+    i2cDrvIndex as one client among others on the bus.
+
+    On every tick the sensors that are due are read in a single transaction
+    queued to the I2C driver, one segment pair (register write, data read)
+    per sensor. A sensor that does not answer loses its own sample: the
+    sensors after it are queued again. The results are appended to the ring
+    buffer, from which any number of consumers read without locking.
+
+  Remarks:
+    The sensor table and the ring buffer are used in place and must remain
+    valid while the sampler runs. Use one sampler instance per I2C bus.
+*/
+
+typedef struct
+{
+    /* Index of the I2C driver instance the sensors are connected to */
+    SYS_MODULE_INDEX                i2cDrvIndex;
+
+    /* I2C clock speed used to talk to the sensors */
+    uint32_t                        clockSpeed;
+
+    /* Sensor table, up to SYS_I2C_SAMPLER_SENSORS_MAX entries */
+    const SYS_I2C_SAMPLER_SENSOR*   sensors;
+    uint32_t                        nSensors;
+
+    /* Scheduling granularity in milliseconds. Sensors due on the same tick
+     * are read in the same batch. */
+    uint32_t                        tickPeriodMs;
+
+    /* Sample ring buffer and its number of entries, at least two */
+    SYS_I2C_SAMPLER_SAMPLE*         ringBuffer;
+    uint32_t                        ringSize;
+
+} SYS_I2C_SAMPLER_INIT;
+
+//DOM-IGNORE-BEGIN
+#ifdef __cplusplus
+}
+#endif
+//DOM-IGNORE-END
+
+#endif // #ifndef SYS_I2C_SAMPLER_DEFINITIONS_H
+/*******************************************************************************
+ End of File
+*/
@@ -73,11 +73,12 @@
 void SYS_Tasks ( void )
 {
     /* Maintain system services */
-    
+    SYS_I2C_SAMPLER_Tasks(sysObj.sysI2CSampler0);
 
 
     /* Maintain Device Drivers */
-    
+    DRV_I2C_EEPROM_Tasks(sysObj.drvI2CEEPROM0);
+
 
     /* Maintain Middleware & Other Libraries */
     
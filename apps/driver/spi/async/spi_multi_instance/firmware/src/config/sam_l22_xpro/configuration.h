@@ -99,8 +99,17 @@ extern "C" {
 #define DRV_SPI_RCV_DMA_CH_IDX1               SYS_DMA_CHANNEL_0
 #define DRV_SPI_QUEUE_SIZE_IDX1               4
 
+/* Pin routed to the SERCOM1 SS pad (PAD1) for the hardware chip select, or
+ * SYS_PORT_PIN_NONE to drive all chip selects from GPIO. To let the SERCOM
+ * drive the EEPROM 2 chip select, set it to SYS_PORT_PIN_PA17 and move PA17
+ * from GPIO to SERCOM1_PAD1 (with pull-up) in the pin configuration. The
+ * SERCOM is disabled and re-enabled whenever the bus switches between a
+ * hardware and a GPIO chip select client. */
+#define DRV_SPI_HARDWARE_CS_PIN_IDX1          SYS_PORT_PIN_NONE
+
 /* SPI Driver Common Configuration Options */
 #define DRV_SPI_INSTANCES_NUMBER              (2U)
+#define DRV_SPI_PRIORITY_AGING_STEP           (4U)
 
 
 
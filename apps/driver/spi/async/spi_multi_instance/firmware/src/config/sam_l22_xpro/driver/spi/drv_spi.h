@@ -1005,6 +1005,256 @@ void DRV_SPI_TransferEventHandlerSet( const DRV_HANDLE handle, const DRV_SPI_TRA
 
 DRV_SPI_TRANSFER_EVENT DRV_SPI_TransferStatusGet(const DRV_SPI_TRANSFER_HANDLE transferHandle );
 
+// *****************************************************************************
+/* Function:
+    bool DRV_SPI_TransferCRCSetup(const DRV_HANDLE handle, const DRV_SPI_CRC_SETUP* crcSetup)
+
+  Summary:
+    Requests a CRC to be computed by the DMA controller for the client's
+    subsequent transfers.
+
+  Description:
+    This function sets up the DMA CRC engine to compute a CRC16 or CRC32 over
+    the data of each transfer the client queues after this call, as the data
+    streams through the RX or TX DMA channel. This avoids a second pass over
+    the buffer in software or with DMAC_CRCCalculate.
+
+    The CRC covers the payload of the selected direction only: the txSize bytes
+    sent for DRV_SPI_CRC_DIRECTION_TX, the rxSize bytes received for
+    DRV_SPI_CRC_DIRECTION_RX. The dummy data sent or received to make up the
+    larger of txSize and rxSize is left out. The CRC is restarted from the
+    seed for every transfer.
+
+    The computed CRC is available from DRV_SPI_TransferCRCGet once the transfer
+    has completed, including from within the transfer event handler.
+
+    Passing a setup with type DRV_SPI_CRC_TYPE_NONE disables the CRC
+    computation for the client's subsequent transfers.
+
+  Precondition:
+    DRV_SPI_Open must have been called to obtain a valid opened device handle.
+
+  Parameters:
+    handle - A valid open-instance handle, returned from the driver's open
+             routine DRV_SPI_Open function.
+
+    crcSetup - Pointer to the CRC setup.
+
+  Returns:
+    true - If the CRC setup was accepted.
+    false - If the handle is invalid, or the driver instance does not use DMA.
+
+  Example:
+  <code>
+    DRV_SPI_CRC_SETUP crcSetup;
+
+    crcSetup.type = DRV_SPI_CRC_TYPE_16;
+    crcSetup.direction = DRV_SPI_CRC_DIRECTION_RX;
+    crcSetup.seed = 0;
+
+    DRV_SPI_TransferCRCSetup(mySPIHandle, &crcSetup);
+  </code>
+
+  Remarks:
+    The DMA controller has a single CRC engine, shared with the other driver
+    instances and the DMA services through SYS_DMA_CRCEngineAcquire. A
+    transfer that starts while the engine is owned by another user goes ahead
+    without a CRC; DRV_SPI_TransferCRCGet then returns false for it.
+
+    With the hardware chip select, no CRC is computed for a transfer whose
+    selected direction has both payload and dummy data, as the DMA moves them
+    without interruption.
+*/
+
+bool DRV_SPI_TransferCRCSetup( const DRV_HANDLE handle, const DRV_SPI_CRC_SETUP* crcSetup );
+
+// *****************************************************************************
+/* Function:
+    bool DRV_SPI_TransferCRCGet(const DRV_SPI_TRANSFER_HANDLE transferHandle, uint32_t* crc)
+
+  Summary:
+    Returns the CRC computed by the DMA controller for a completed transfer.
+
+  Description:
+    This function returns the CRC computed over the data of the transfer, if
+    a CRC was requested through DRV_SPI_TransferCRCSetup when the transfer was
+    queued. It is intended to be called from the transfer event handler on
+    DRV_SPI_TRANSFER_EVENT_COMPLETE, or after DRV_SPI_TransferStatusGet
+    reports the transfer as complete.
+
+  Precondition:
+    A transfer must have been queued with a CRC requested and a valid transfer
+    handle must have been returned.
+
+  Parameters:
+    transferHandle - Handle of the completed transfer request.
+
+    crc - Pointer to where the CRC is to be stored. Only the lower 16 bits are
+          valid for DRV_SPI_CRC_TYPE_16.
+
+  Returns:
+    true - If the transfer completed and a CRC was computed for it.
+    false - If the handle is invalid or expired, the transfer has not completed,
+            no CRC was requested for it or the DMA CRC engine was owned by
+            another user when the transfer started.
+
+  Example:
+  <code>
+    void APP_SPITransferEventHandler(DRV_SPI_TRANSFER_EVENT event,
+            DRV_SPI_TRANSFER_HANDLE handle, uintptr_t context)
+    {
+        uint32_t crc;
+
+        if ((event == DRV_SPI_TRANSFER_EVENT_COMPLETE) &&
+            (DRV_SPI_TransferCRCGet(handle, &crc) == true))
+        {
+            // Compare crc against the expected value
+        }
+    }
+  </code>
+
+  Remarks:
+    The CRC is held in the transfer object and remains available until the
+    transfer object is re-used for a new request.
+*/
+
+bool DRV_SPI_TransferCRCGet( const DRV_SPI_TRANSFER_HANDLE transferHandle, uint32_t* crc );
+
+// *****************************************************************************
+/* Function:
+    bool DRV_SPI_ClientPrioritySet(const DRV_HANDLE handle, const DRV_SPI_PRIORITY priority)
+
+  Summary:
+    Sets the priority class of the client on the shared SPI bus.
+
+  Description:
+    This function sets the priority class used by the driver to arbitrate
+    between the transfers queued by the clients of a driver instance. When
+    a transfer completes, the queued transfer of the highest priority class is
+    started next. Transfers of the same priority class are started in the order
+    they were queued.
+
+    To bound the wait of lower priority clients, a queued transfer gains one
+    priority class for every DRV_SPI_PRIORITY_AGING_STEP transfers queued after
+    it that are started ahead of it.
+
+    A client is opened with the priority DRV_SPI_PRIORITY_NORMAL.
+
+  Precondition:
+    DRV_SPI_Open must have been called to obtain a valid opened device handle.
+
+  Parameters:
+    handle - A valid open-instance handle, returned from the driver's open
+             routine DRV_SPI_Open function.
+
+    priority - Priority class of the client.
+
+  Returns:
+    true - If the priority was set.
+    false - If the handle or the priority is invalid.
+
+  Example:
+  <code>
+    // The ADC client must not wait behind the display refresh transfers
+    DRV_SPI_ClientPrioritySet(myADCSPIHandle, DRV_SPI_PRIORITY_HIGH);
+    DRV_SPI_ClientPrioritySet(myDisplaySPIHandle, DRV_SPI_PRIORITY_LOW);
+  </code>
+
+  Remarks:
+    The new priority also applies to the transfers of the client that are
+    already queued. The transfer in progress is never pre-empted.
+*/
+
+bool DRV_SPI_ClientPrioritySet( const DRV_HANDLE handle, const DRV_SPI_PRIORITY priority );
+
+// *****************************************************************************
+/* Function:
+    bool DRV_SPI_ClientStatisticsGet(const DRV_HANDLE handle, DRV_SPI_CLIENT_STATISTICS* statistics)
+
+  Summary:
+    Returns the queueing statistics of the client.
+
+  Description:
+    This function returns the number of transfers of the client started on the
+    bus, the total and the longest wait of these transfers, and the largest
+    number of later transfers started ahead of one of them. The wait of
+    a transfer is the time, in microseconds, between the moment it was queued
+    and the moment it was started. It is timed with the SysTick timer at the
+    CPU clock, which DRV_SPI_Initialize starts as a free running counter if
+    it is not running yet.
+
+    The statistics are cleared when the client is opened and by
+    DRV_SPI_ClientStatisticsReset.
+
+  Precondition:
+    DRV_SPI_Open must have been called to obtain a valid opened device handle.
+
+  Parameters:
+    handle - A valid open-instance handle, returned from the driver's open
+             routine DRV_SPI_Open function.
+
+    statistics - Pointer to where the statistics are to be copied.
+
+  Returns:
+    true - If the statistics were copied.
+    false - If the handle is invalid or statistics is NULL.
+
+  Example:
+  <code>
+    DRV_SPI_CLIENT_STATISTICS stats;
+
+    if (DRV_SPI_ClientStatisticsGet(myADCSPIHandle, &stats) == true)
+    {
+        if (stats.maxWaitUs > APP_ADC_MAX_LATENCY_US)
+        {
+            // The ADC transfers are delayed too long by the other clients
+        }
+    }
+  </code>
+
+  Remarks:
+    The driver reads SysTick on every queueing, start and completion of a
+    transfer and extends it to 32 bits. Two of these events must not be more
+    than one SysTick period apart (0.52 s for a free running SysTick at
+    32 MHz), otherwise the wait is under-reported.
+*/
+
+bool DRV_SPI_ClientStatisticsGet( const DRV_HANDLE handle, DRV_SPI_CLIENT_STATISTICS* statistics );
+
+// *****************************************************************************
+/* Function:
+    bool DRV_SPI_ClientStatisticsReset(const DRV_HANDLE handle)
+
+  Summary:
+    Clears the queueing statistics of the client.
+
+  Description:
+    This function clears the statistics returned by
+    DRV_SPI_ClientStatisticsGet, so that a new measurement window can be
+    started.
+
+  Precondition:
+    DRV_SPI_Open must have been called to obtain a valid opened device handle.
+
+  Parameters:
+    handle - A valid open-instance handle, returned from the driver's open
+             routine DRV_SPI_Open function.
+
+  Returns:
+    true - If the statistics were cleared.
+    false - If the handle is invalid.
+
+  Example:
+  <code>
+    DRV_SPI_ClientStatisticsReset(myADCSPIHandle);
+  </code>
+
+  Remarks:
+    None.
+*/
+
+bool DRV_SPI_ClientStatisticsReset( const DRV_HANDLE handle );
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: SPI Driver Synchronous(Blocking Model) Transfer Interface Routines
@@ -144,6 +144,128 @@ typedef struct
 
 } DRV_SPI_TRANSFER_SETUP;
 
+// *****************************************************************************
+/* SPI Driver CRC Type
+
+  Summary:
+    Identifies the CRC computed by the DMA controller during a transfer
+
+  Description:
+    This data type identifies the CRC polynomial the DMA CRC engine computes
+    over the data of a transfer. DRV_SPI_CRC_TYPE_NONE disables the inline
+    CRC computation.
+
+  Remarks:
+    None.
+*/
+
+typedef enum
+{
+    DRV_SPI_CRC_TYPE_NONE = 0,
+
+    /* CRC16 (CRC-CCITT): 0x1021 */
+    DRV_SPI_CRC_TYPE_16 = 1,
+
+    /* CRC32 (IEEE 802.3): 0x04C11DB7 */
+    DRV_SPI_CRC_TYPE_32 = 2
+
+} DRV_SPI_CRC_TYPE;
+
+typedef enum
+{
+    /* CRC is computed over the data received by the RX DMA channel */
+    DRV_SPI_CRC_DIRECTION_RX = 0,
+
+    /* CRC is computed over the data transmitted by the TX DMA channel */
+    DRV_SPI_CRC_DIRECTION_TX = 1
+
+} DRV_SPI_CRC_DIRECTION;
+
+// *****************************************************************************
+/* SPI Driver CRC Setup Data
+
+  Summary:
+    Defines the data required to setup the inline CRC of a transfer
+
+  Description:
+    This data type defines the data required to have the DMA controller compute
+    a CRC over the data of a transfer as it streams through the RX or TX DMA
+    channel. The data is passed to the DRV_SPI_TransferCRCSetup API.
+
+  Remarks:
+    None.
+*/
+
+typedef struct
+{
+    DRV_SPI_CRC_TYPE                type;
+
+    DRV_SPI_CRC_DIRECTION           direction;
+
+    uint32_t                        seed;
+
+} DRV_SPI_CRC_SETUP;
+
+// *****************************************************************************
+/* SPI Driver Client Priority
+
+  Summary:
+    Identifies the priority class of a client on a shared SPI bus
+
+  Description:
+    This data type identifies the priority class of a client. When a transfer
+    completes, the driver starts the queued transfer of the highest priority
+    class next. A queued transfer gains one priority class for every
+    DRV_SPI_PRIORITY_AGING_STEP transfers that are started ahead of it, so that
+    lower priority clients are not starved.
+
+  Remarks:
+    Transfers of a client are always started in the order they were queued.
+*/
+
+typedef enum
+{
+    DRV_SPI_PRIORITY_LOW = 0,
+
+    DRV_SPI_PRIORITY_NORMAL = 1,
+
+    DRV_SPI_PRIORITY_HIGH = 2
+
+} DRV_SPI_PRIORITY;
+
+// *****************************************************************************
+/* SPI Driver Client Statistics
+
+  Summary:
+    Defines the queueing statistics of a client
+
+  Description:
+    This data type defines the statistics maintained by the driver for each
+    client to validate the latency of its transfers on a shared bus. The wait
+    of a transfer is the time between the moment it was queued and the moment
+    it was started, in microseconds.
+
+  Remarks:
+    The statistics are returned by the DRV_SPI_ClientStatisticsGet API.
+*/
+
+typedef struct
+{
+    /* Number of transfers of the client started on the bus */
+    uint32_t                        transferCount;
+
+    /* Sum of the wait of all the started transfers, in microseconds */
+    uint32_t                        totalWaitUs;
+
+    /* Longest wait of a started transfer, in microseconds */
+    uint32_t                        maxWaitUs;
+
+    /* Largest number of transfers started ahead of a transfer of the client
+     * that were queued after it */
+    uint32_t                        maxBypassCount;
+
+} DRV_SPI_CLIENT_STATISTICS;
+
 typedef void (*DRV_SPI_PLIB_CALLBACK)( uintptr_t context);
 
 typedef bool (*DRV_SPI_PLIB_SETUP) (DRV_SPI_TRANSFER_SETUP *setup, uint32_t spiSourceClock);
@@ -154,6 +276,8 @@ typedef bool (*DRV_SPI_PLIB_TRANSMITTER_IS_BUSY)(void);
 
 typedef void (* DRV_SPI_PLIB_CALLBACK_REGISTER)(DRV_SPI_PLIB_CALLBACK callBack, uintptr_t context);
 
+typedef void (* DRV_SPI_PLIB_HARDWARE_CHIP_SELECT_ENABLE)(bool enable);
+
 
 typedef struct
 {
@@ -206,6 +330,10 @@ typedef struct
     /* SPI PLIB callback register API */
     DRV_SPI_PLIB_CALLBACK_REGISTER       callbackRegister;
 
+    /* SPI PLIB hardware slave select enable API. NULL if the SS pad of the
+     * peripheral is not used. */
+    DRV_SPI_PLIB_HARDWARE_CHIP_SELECT_ENABLE hardwareChipSelectEnable;
+
 } DRV_SPI_PLIB_INTERFACE;
 
 // *****************************************************************************
@@ -257,6 +385,11 @@ typedef struct
     uintptr_t                       transferObjPool;
 
     const DRV_SPI_INTERRUPT_SOURCES*      interruptSources;
+
+    /* Pin routed to the SS pad of the peripheral. A client whose chip select
+     * is this pin (active low) has it driven by the peripheral instead of
+     * by the driver, DMA mode only. SYS_PORT_PIN_NONE if not used. */
+    SYS_PORT_PIN                    hardwareChipSelect;
 } DRV_SPI_INIT;
 
 
@@ -47,6 +47,7 @@
 
 #include <string.h>
 #include "configuration.h"
+#include "definitions.h"
 #include "driver/spi/drv_spi.h"
 #include "system/debug/sys_debug.h"
 
@@ -61,6 +62,14 @@ static DRV_SPI_OBJ gDrvSPIObj[DRV_SPI_INSTANCES_NUMBER];
 /* Dummy data being transmitted by TX DMA */
 static CACHE_ALIGN uint8_t txDummyData[CACHE_ALIGNED_SIZE_GET(4)];
 
+/* CPU cycles per microsecond, the wait statistics are timed with SysTick */
+#define DRV_SPI_CYCLES_PER_US       (CPU_CLOCK_FREQUENCY / 1000000U)
+
+/* 32-bit CPU cycle count extended from the 24-bit SysTick, and the SysTick
+ * value it was last updated with */
+static uint32_t gDrvSPICycleCount;
+static uint32_t gDrvSPISysTickLast;
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: File scope functions
@@ -342,6 +351,38 @@ static DRV_SPI_TRANSFER_OBJ* lDRV_SPI_TransferObjListGet( DRV_SPI_OBJ* dObj )
     return pTransferObj;
 }
 
+/* Returns the number of CPU cycles counted by SysTick, extended to 32 bits.
+ * SysTick counts down and wraps around every LOAD + 1 cycles; the count is
+ * updated on every queueing, start and completion of a transfer, which must
+ * not be more than one SysTick period apart for a wait to be timed right. */
+static uint32_t lDRV_SPI_CycleCountGet(void)
+{
+    bool interruptState;
+    uint32_t sysTickValue;
+    uint32_t cycleCount;
+
+    /* Updated from task and interrupt contexts */
+    interruptState = SYS_INT_Disable();
+
+    sysTickValue = SysTick->VAL;
+
+    if (sysTickValue <= gDrvSPISysTickLast)
+    {
+        gDrvSPICycleCount += gDrvSPISysTickLast - sysTickValue;
+    }
+    else
+    {
+        gDrvSPICycleCount += gDrvSPISysTickLast + (SysTick->LOAD + 1U) - sysTickValue;
+    }
+
+    gDrvSPISysTickLast = sysTickValue;
+    cycleCount = gDrvSPICycleCount;
+
+    SYS_INT_Restore(interruptState);
+
+    return cycleCount;
+}
+
 static void lDRV_SPI_RemoveTransferObjFromList( DRV_SPI_OBJ* dObj )
 {
     DRV_SPI_TRANSFER_OBJ** pTransferObjList;
@@ -355,6 +396,10 @@ static void lDRV_SPI_RemoveTransferObjFromList( DRV_SPI_OBJ* dObj )
          * the new head of the linked list. Reset the removed buffer object. */
 
         DRV_SPI_TRANSFER_OBJ* temp = *pTransferObjList;
+
+        /* Keep the cycle count up to date while the bus is busy */
+        (void) lDRV_SPI_CycleCountGet();
+
         *pTransferObjList = (*pTransferObjList)->next;
         temp->currentState = DRV_SPI_TRANSFER_OBJ_IS_FREE;
         temp->next = NULL;
@@ -362,6 +407,133 @@ static void lDRV_SPI_RemoveTransferObjFromList( DRV_SPI_OBJ* dObj )
     }
 }
 
+static DRV_SPI_CLIENT_OBJ* lDRV_SPI_TransferObjClientGet(
+    DRV_SPI_OBJ* dObj,
+    DRV_SPI_TRANSFER_OBJ* transferObj
+)
+{
+    DRV_SPI_CLIENT_OBJ* clientObj;
+
+    clientObj = &((DRV_SPI_CLIENT_OBJ *)dObj->clientObjPool)[transferObj->clientHandle & DRV_SPI_INDEX_MASK];
+
+    /* The client may have been closed after the transfer was queued */
+    if (clientObj->clientHandle != transferObj->clientHandle)
+    {
+        clientObj = NULL;
+    }
+
+    return clientObj;
+}
+
+/* Returns the effective priority of a queued transfer: the priority class of
+ * the client, raised by one class for every DRV_SPI_PRIORITY_AGING_STEP later
+ * transfers that were started ahead of it. */
+static uint32_t lDRV_SPI_TransferObjPriorityGet(
+    DRV_SPI_OBJ* dObj,
+    DRV_SPI_TRANSFER_OBJ* transferObj
+)
+{
+    DRV_SPI_CLIENT_OBJ* clientObj = lDRV_SPI_TransferObjClientGet(dObj, transferObj);
+    uint32_t priority = (uint32_t)DRV_SPI_PRIORITY_LOW;
+
+    if (clientObj != NULL)
+    {
+        priority = (uint32_t)clientObj->priority;
+    }
+
+    return priority + (transferObj->bypassCount / DRV_SPI_PRIORITY_AGING_STEP);
+}
+
+static void lDRV_SPI_TransferObjStatisticsUpdate(
+    DRV_SPI_OBJ* dObj,
+    DRV_SPI_TRANSFER_OBJ* transferObj
+)
+{
+    DRV_SPI_CLIENT_OBJ* clientObj = lDRV_SPI_TransferObjClientGet(dObj, transferObj);
+    uint32_t waitUs;
+
+    if (clientObj != NULL)
+    {
+        /* Unsigned arithmetic takes care of the cycle count roll over */
+        waitUs = (lDRV_SPI_CycleCountGet() - transferObj->queuedCycleCount) / DRV_SPI_CYCLES_PER_US;
+
+        clientObj->statistics.transferCount++;
+        clientObj->statistics.totalWaitUs += waitUs;
+
+        if (waitUs > clientObj->statistics.maxWaitUs)
+        {
+            clientObj->statistics.maxWaitUs = waitUs;
+        }
+
+        if (transferObj->bypassCount > clientObj->statistics.maxBypassCount)
+        {
+            clientObj->statistics.maxBypassCount = transferObj->bypassCount;
+        }
+    }
+}
+
+/* Selects the queued transfer to be started next and moves it to the head of
+ * the list. The list is kept in queueing order, so the first transfer of the
+ * highest effective priority is the oldest one of that priority and the
+ * transfers of a client are started in the order they were queued. */
+static DRV_SPI_TRANSFER_OBJ* lDRV_SPI_TransferObjScheduleNext( DRV_SPI_OBJ* dObj )
+{
+    DRV_SPI_TRANSFER_OBJ** pTransferObjList;
+    DRV_SPI_TRANSFER_OBJ** pNextTransferObj;
+    DRV_SPI_TRANSFER_OBJ* transferObj;
+    DRV_SPI_TRANSFER_OBJ* pTransferObj;
+    uint32_t maxPriority;
+    uint32_t priority;
+
+    pTransferObjList = (DRV_SPI_TRANSFER_OBJ**)&(dObj->transferObjList);
+
+    transferObj = *pTransferObjList;
+
+    /* Nothing to schedule if the list is empty or if a transfer was already
+     * started from the event handler */
+    if ((transferObj == NULL) || (transferObj->currentState != DRV_SPI_TRANSFER_OBJ_IS_IN_QUEUE))
+    {
+        return transferObj;
+    }
+
+    pNextTransferObj = pTransferObjList;
+    maxPriority = lDRV_SPI_TransferObjPriorityGet(dObj, transferObj);
+
+    pTransferObjList = (DRV_SPI_TRANSFER_OBJ**)&(transferObj->next);
+
+    while (*pTransferObjList != NULL)
+    {
+        priority = lDRV_SPI_TransferObjPriorityGet(dObj, *pTransferObjList);
+
+        if (priority > maxPriority)
+        {
+            maxPriority = priority;
+            pNextTransferObj = pTransferObjList;
+        }
+
+        pTransferObjList = (DRV_SPI_TRANSFER_OBJ**)&((*pTransferObjList)->next);
+    }
+
+    pTransferObjList = (DRV_SPI_TRANSFER_OBJ**)&(dObj->transferObjList);
+    transferObj = *pNextTransferObj;
+
+    if (pNextTransferObj != pTransferObjList)
+    {
+        /* The transfers ahead of the selected one were queued before it */
+        for (pTransferObj = *pTransferObjList; pTransferObj != transferObj; pTransferObj = pTransferObj->next)
+        {
+            pTransferObj->bypassCount++;
+        }
+
+        /* Move the selected transfer to the head of the list */
+        *pNextTransferObj = transferObj->next;
+        transferObj->next = *pTransferObjList;
+        *pTransferObjList = transferObj;
+    }
+
+    return transferObj;
+}
+
 static void lDRV_SPI_RemoveClientTransfersFromList(
     DRV_SPI_OBJ* dObj,
     DRV_SPI_CLIENT_OBJ* clientObj
@@ -398,11 +570,102 @@ static void lDRV_SPI_RemoveClientTransfersFromList(
     }
 }
 
+/* Reads the CRC of the transfer and gives the DMA CRC engine back. Called as
+ * soon as the payload has gone through the channel, so that the dummy data the
+ * channel moves afterwards is left out of the CRC. */
+static void lDRV_SPI_DMA_CRCLatch(DRV_SPI_OBJ* dObj, DRV_SPI_TRANSFER_OBJ* transferObj)
+{
+    if (dObj->isCRCEngineOwned == true)
+    {
+        transferObj->crc = SYS_DMA_CRCRead();
+
+        if (transferObj->crcSetup.type == DRV_SPI_CRC_TYPE_16)
+        {
+            transferObj->crc &= 0xFFFFU;
+        }
+
+        transferObj->isCRCComputed = true;
+
+        SYS_DMA_CRCEngineRelease();
+        dObj->isCRCEngineOwned = false;
+    }
+}
+
+/* Attaches the DMA CRC engine to the RX or TX DMA channel of the transfer. The
+ * CRC covers the payload of that direction only: txSize bytes for TX, rxSize
+ * bytes for RX. It is latched before the channel moves dummy data. */
+static void lDRV_SPI_DMA_CRCSetup(DRV_SPI_OBJ* dObj, DRV_SPI_TRANSFER_OBJ* transferObj)
+{
+    SYS_DMA_CRC_SETUP crcSetup;
+    SYS_DMA_CHANNEL channel;
+    size_t payloadSize;
+    size_t dummySize;
+
+    if (transferObj->crcSetup.direction == DRV_SPI_CRC_DIRECTION_TX)
+    {
+        channel = dObj->txDMAChannel;
+        payloadSize = transferObj->txSize;
+        dummySize = dObj->txDummyDataSize;
+    }
+    else
+    {
+        channel = dObj->rxDMAChannel;
+        payloadSize = transferObj->rxSize;
+        dummySize = dObj->rxDummyDataSize;
+    }
+
+    /* With the hardware chip select the payload and the dummy data are
+     * chained on the channel with no interrupt in between, so the CRC cannot
+     * be stopped at the end of the payload. No CRC is computed. */
+    if ((dObj->isHwChipSelectEnabled == true) && (payloadSize > 0U) && (dummySize > 0U))
+    {
+        return;
+    }
+
+    /* The engine is shared with the other driver instances and the DMA
+     * services. If it is owned by another user, the transfer goes ahead
+     * without a CRC and DRV_SPI_TransferCRCGet reports none. */
+    if (SYS_DMA_CRCEngineAcquire() == false)
+    {
+        return;
+    }
+
+    if (transferObj->crcSetup.type == DRV_SPI_CRC_TYPE_32)
+    {
+        crcSetup.polynomialType = SYS_DMA_CRC_TYPE_32;
+    }
+    else
+    {
+        crcSetup.polynomialType = SYS_DMA_CRC_TYPE_16;
+    }
+
+    crcSetup.seed = transferObj->crcSetup.seed;
+
+    SYS_DMA_ChannelCRCSetup(channel, crcSetup);
+    dObj->isCRCEngineOwned = true;
+
+    if (payloadSize == 0U)
+    {
+        /* The channel only moves dummy data, the CRC is the one of no data */
+        lDRV_SPI_DMA_CRCLatch(dObj, transferObj);
+    }
+}
+
+/* Returns true if the chip select of the client is the SS pad driven by the
+ * peripheral */
+static bool lDRV_SPI_IsHardwareChipSelect(const DRV_SPI_OBJ* dObj, const DRV_SPI_CLIENT_OBJ* clientObj)
+{
+    return ((dObj->hwChipSelect != SYS_PORT_PIN_NONE) &&
+            (clientObj->setup.chipSelect == dObj->hwChipSelect) &&
+            (clientObj->setup.csPolarity == DRV_SPI_CS_POLARITY_ACTIVE_LOW));
+}
+
 /* MISRA C-2012 Rule 11.1 deviated:2 Deviation record ID -  H3_MISRAC_2012_R_11_1_DR_1 */
 static void lDRV_SPI_StartDMATransfer(DRV_SPI_TRANSFER_OBJ* transferObj)
 {
     DRV_SPI_CLIENT_OBJ* clientObj;
     DRV_SPI_OBJ* dObj;
+    SYS_DMA_DESCRIPTOR dataDescriptor;
     uint32_t size = 0;
     /* To avoid unused build error */
     (void) size;
@@ -448,6 +711,11 @@ static void lDRV_SPI_StartDMATransfer(DRV_SPI_TRANSFER_OBJ* transferObj)
         SYS_DMA_DataWidthSetup(dObj->txDMAChannel, SYS_DMA_WIDTH_32_BIT);
     }
 
+    if (transferObj->crcSetup.type != DRV_SPI_CRC_TYPE_NONE)
+    {
+        lDRV_SPI_DMA_CRCSetup(dObj, transferObj);
+    }
+
     if (transferObj->rxSize == 0U)
     {
         /* Configure the RX DMA channel - to receive dummy data */
@@ -456,6 +724,25 @@ static void lDRV_SPI_StartDMATransfer(DRV_SPI_TRANSFER_OBJ* transferObj)
         dObj->rxDummyDataSize = 0;
         (void) SYS_DMA_ChannelTransfer(dObj->rxDMAChannel, dObj->rxAddress, &dObj->rxDummyData, size);
     }
+    else if ((dObj->isHwChipSelectEnabled == true) && (dObj->rxDummyDataSize > 0U))
+    {
+        /* The peripheral releases the SS pad as soon as the transmitter runs
+         * dry, so the TX DMA must not wait for the RX DMA to be re-armed for
+         * the dummy data. Chain the receive buffer and the dummy data instead;
+         * the TX DMA then sends the whole transmit buffer in one block. */
+        SYS_DMA_AddressingModeSetup(dObj->rxDMAChannel, SYS_DMA_SOURCE_ADDRESSING_MODE_FIXED, SYS_DMA_DESTINATION_ADDRESSING_MODE_INCREMENTED);
+        dObj->rxDMAChannelConfig = SYS_DMA_ChannelSettingsGet(dObj->rxDMAChannel);
+
+        SYS_DMA_LinkedListDescriptorSetup(&dataDescriptor, (dObj->rxDMAChannelConfig & ~DRV_SPI_DMA_BLOCK_ACTION_MASK),
+            dObj->rxAddress, transferObj->pReceiveData, transferObj->rxSize, &dObj->rxDummyDescriptor);
+
+        SYS_DMA_LinkedListDescriptorSetup(&dObj->rxDummyDescriptor, (dObj->rxDMAChannelConfig & ~(SYS_DMA_CHANNEL_CONFIG)SYS_DMA_DESTINATION_ADDRESSING_MODE_INCREMENTED),
+            dObj->rxAddress, &dObj->rxDummyData, dObj->rxDummyDataSize, NULL);
+
+        dObj->rxDummyDataSize = 0;
+        dObj->isRxDMAChained = true;
+        (void) SYS_DMA_ChannelLinkedListTransfer(dObj->rxDMAChannel, &dataDescriptor);
+    }
     else
     {
         /* Configure the RX DMA channel - to receive data in receive buffer */
@@ -471,6 +758,23 @@ static void lDRV_SPI_StartDMATransfer(DRV_SPI_TRANSFER_OBJ* transferObj)
         dObj->txDummyDataSize = 0;
         (void) SYS_DMA_ChannelTransfer(dObj->txDMAChannel, txDummyData, dObj->txAddress, size);
     }
+    else if ((dObj->isHwChipSelectEnabled == true) && (dObj->txDummyDataSize > 0U))
+    {
+        /* Chain the transmit buffer and the dummy data, so that the SS pad
+         * stays asserted between them */
+        SYS_DMA_AddressingModeSetup(dObj->txDMAChannel, SYS_DMA_SOURCE_ADDRESSING_MODE_INCREMENTED, SYS_DMA_DESTINATION_ADDRESSING_MODE_FIXED);
+        dObj->txDMAChannelConfig = SYS_DMA_ChannelSettingsGet(dObj->txDMAChannel);
+
+        SYS_DMA_LinkedListDescriptorSetup(&dataDescriptor, (dObj->txDMAChannelConfig & ~DRV_SPI_DMA_BLOCK_ACTION_MASK),
+            transferObj->pTransmitData, dObj->txAddress, transferObj->txSize, &dObj->txDummyDescriptor);
+
+        SYS_DMA_LinkedListDescriptorSetup(&dObj->txDummyDescriptor, (dObj->txDMAChannelConfig & ~(SYS_DMA_CHANNEL_CONFIG)SYS_DMA_SOURCE_ADDRESSING_MODE_INCREMENTED),
+            txDummyData, dObj->txAddress, dObj->txDummyDataSize, NULL);
+
+        dObj->txDummyDataSize = 0;
+        dObj->isTxDMAChained = true;
+        (void) SYS_DMA_ChannelLinkedListTransfer(dObj->txDMAChannel, &dataDescriptor);
+    }
     else
     {
         /* Configure the transmit DMA channel - to send data from transmit buffer */
@@ -497,6 +801,7 @@ static void lDRV_SPI_UpdateTransferSetupAndAssertCS(
     DRV_SPI_OBJ* dObj;
     DRV_SPI_CLIENT_OBJ* clientObj;
     DRV_SPI_TRANSFER_SETUP setupRemap;
+    bool isHwChipSelect;
 
     /* Get the client object that owns this buffer */
     clientObj = &((DRV_SPI_CLIENT_OBJ *)gDrvSPIObj[((transferObj->clientHandle & DRV_SPI_INSTANCE_MASK) >> 8)].clientObjPool)
@@ -518,8 +823,19 @@ static void lDRV_SPI_UpdateTransferSetupAndAssertCS(
         clientObj->setupChanged = false;
     }
 
-    /* Assert chip select if configured */
-    if(clientObj->setup.chipSelect != SYS_PORT_PIN_NONE)
+    isHwChipSelect = lDRV_SPI_IsHardwareChipSelect(dObj, clientObj);
+
+    /* Give the SS pad to the peripheral, or take it back, when the client
+     * kind changes. The peripheral then asserts and releases it right at the
+     * first and last clock edges. */
+    if (isHwChipSelect != dObj->isHwChipSelectEnabled)
+    {
+        dObj->spiPlib->hardwareChipSelectEnable(isHwChipSelect);
+        dObj->isHwChipSelectEnabled = isHwChipSelect;
+    }
+
+    /* Assert chip select if configured and not driven by the peripheral */
+    if((isHwChipSelect == false) && (clientObj->setup.chipSelect != SYS_PORT_PIN_NONE))
     {
         if (clientObj->setup.csPolarity == DRV_SPI_CS_POLARITY_ACTIVE_LOW)
         {
@@ -602,8 +918,8 @@ static void lDRV_SPI_PlibCallbackHandler(uintptr_t contextHandle)
         lDRV_SPI_RemoveTransferObjFromList(dObj);
     }
 
-     /* Get the transfer object at the head of the list */
-    transferObj = lDRV_SPI_TransferObjListGet(dObj);
+     /* Get the next transfer object as per the client priorities */
+    transferObj = lDRV_SPI_TransferObjScheduleNext(dObj);
 
     /* Process the next transfer buffer */
     if((transferObj != NULL) && (transferObj->currentState == DRV_SPI_TRANSFER_OBJ_IS_IN_QUEUE))
@@ -611,6 +927,7 @@ static void lDRV_SPI_PlibCallbackHandler(uintptr_t contextHandle)
         lDRV_SPI_UpdateTransferSetupAndAssertCS(transferObj);
 
         transferObj->currentState = DRV_SPI_TRANSFER_OBJ_IS_PROCESSING;
+        lDRV_SPI_TransferObjStatisticsUpdate(dObj, transferObj);
 
         (void) dObj->spiPlib->writeRead(
             transferObj->pTransmitData,
@@ -702,6 +1019,12 @@ static void lDRV_SPI_TX_DMA_CallbackHandler(
 
     if (dObj->txDummyDataSize > 0U)
     {
+        /* The transmit buffer has been sent, leave the dummy data out of the CRC */
+        if (transferObj->crcSetup.direction == DRV_SPI_CRC_DIRECTION_TX)
+        {
+            lDRV_SPI_DMA_CRCLatch(dObj, transferObj);
+        }
+
         /* Configure DMA channel to transmit (dummy data) from the same location
          * (Source address not incremented) */
         SYS_DMA_AddressingModeSetup(dObj->txDMAChannel, SYS_DMA_SOURCE_ADDRESSING_MODE_FIXED, SYS_DMA_DESTINATION_ADDRESSING_MODE_FIXED);
@@ -732,6 +1055,12 @@ static void lDRV_SPI_RX_DMA_CallbackHandler(
 
     if (dObj->rxDummyDataSize > 0U)
     {
+        /* The receive buffer is full, leave the dummy data out of the CRC */
+        if (transferObj->crcSetup.direction == DRV_SPI_CRC_DIRECTION_RX)
+        {
+            lDRV_SPI_DMA_CRCLatch(dObj, transferObj);
+        }
+
         /* Configure DMA to receive dummy data */
         SYS_DMA_AddressingModeSetup(dObj->rxDMAChannel, SYS_DMA_SOURCE_ADDRESSING_MODE_FIXED, SYS_DMA_DESTINATION_ADDRESSING_MODE_FIXED);
 
@@ -743,14 +1072,30 @@ static void lDRV_SPI_RX_DMA_CallbackHandler(
     }
     else
     {
-        /* Make sure the shift register is empty before de-asserting the CS line */
+        /* Make sure the shift register is empty before de-asserting the CS line.
+         * With the hardware chip select this also keeps the next transfer from
+         * being appended to this one before the SS pad is released. */
         while (dObj->spiPlib->isTransmitterBusy())
         {
             /* Do Nothing */
         }
 
-        /* De-assert Chip Select if it is defined by user */
-        if(clientObj->setup.chipSelect != SYS_PORT_PIN_NONE)
+        /* Restore the channel settings used for single block transfers */
+        if (dObj->isTxDMAChained == true)
+        {
+            SYS_DMA_ChannelSettingsSet(dObj->txDMAChannel, dObj->txDMAChannelConfig);
+            dObj->isTxDMAChained = false;
+        }
+
+        if (dObj->isRxDMAChained == true)
+        {
+            SYS_DMA_ChannelSettingsSet(dObj->rxDMAChannel, dObj->rxDMAChannelConfig);
+            dObj->isRxDMAChained = false;
+        }
+
+        /* De-assert Chip Select if it is defined by user. The SS pad has
+         * already been released by the peripheral. */
+        if((dObj->isHwChipSelectEnabled == false) && (clientObj->setup.chipSelect != SYS_PORT_PIN_NONE))
         {
             if (clientObj->setup.csPolarity == DRV_SPI_CS_POLARITY_ACTIVE_LOW)
             {
@@ -762,6 +1107,10 @@ static void lDRV_SPI_RX_DMA_CallbackHandler(
             }
         }
 
+        /* Both channels are done. Latch the CRC, if not done yet, before the
+         * event handler is called. */
+        lDRV_SPI_DMA_CRCLatch(dObj, transferObj);
+
         /* Check if the client that submitted the request is active? */
         if (clientObj->clientHandle == transferObj->clientHandle)
         {
@@ -809,14 +1158,15 @@ static void lDRV_SPI_RX_DMA_CallbackHandler(
             lDRV_SPI_RemoveTransferObjFromList(dObj);
         }
 
-        /* Get the next transfer object at the head of the list */
-        transferObj = lDRV_SPI_TransferObjListGet(dObj);
+        /* Get the next transfer object as per the client priorities */
+        transferObj = lDRV_SPI_TransferObjScheduleNext(dObj);
 
         if((transferObj != NULL) && (transferObj->currentState == DRV_SPI_TRANSFER_OBJ_IS_IN_QUEUE))
         {
             /* Process the next transfer buffer */
             lDRV_SPI_UpdateTransferSetupAndAssertCS(transferObj);
             transferObj->currentState = DRV_SPI_TRANSFER_OBJ_IS_PROCESSING;
+            lDRV_SPI_TransferObjStatisticsUpdate(dObj, transferObj);
             lDRV_SPI_StartDMATransfer(transferObj);
         }
     }
@@ -895,12 +1245,28 @@ SYS_MODULE_OBJ DRV_SPI_Initialize (
     dObj->drvInExclusiveMode        = false;
     dObj->exclusiveUseCntr          = 0;
     dObj->transferObjLastUsedIndex  = 0;
+    dObj->hwChipSelect              = SYS_PORT_PIN_NONE;
+    dObj->isHwChipSelectEnabled     = false;
+    dObj->isTxDMAChained            = false;
+    dObj->isRxDMAChained            = false;
+    dObj->isCRCEngineOwned          = false;
 
     for (txDummyDataIdx = 0; txDummyDataIdx < sizeof(txDummyData); txDummyDataIdx++)
     {
         txDummyData[txDummyDataIdx] = 0xFF;
     }
 
+    /* Free running SysTick at the CPU clock, without interrupt, to time the
+     * wait of the queued transfers */
+    if ((SysTick->CTRL & SysTick_CTRL_ENABLE_Msk) == 0U)
+    {
+        SysTick->LOAD = SysTick_LOAD_RELOAD_Msk;
+        SysTick->VAL  = 0U;
+        SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+    }
+
+    gDrvSPISysTickLast = SysTick->VAL;
+
     if((dObj->txDMAChannel == SYS_DMA_CHANNEL_NONE) || (dObj->rxDMAChannel == SYS_DMA_CHANNEL_NONE))
     {
         /* Register a callback with SPI PLIB.
@@ -912,6 +1278,14 @@ SYS_MODULE_OBJ DRV_SPI_Initialize (
     {
         /* This means DMA has to be used for SPI transfer.
          * DMA Callbacks will be set for every transfer later. */
+
+        /* The SS pad is released whenever the transmitter runs dry, so it can
+         * only be driven by the peripheral when the DMA feeds the whole
+         * transfer */
+        if ((spiInit->hardwareChipSelect != SYS_PORT_PIN_NONE) && (dObj->spiPlib->hardwareChipSelectEnable != NULL))
+        {
+            dObj->hwChipSelect = spiInit->hardwareChipSelect;
+        }
     }
 
     /* Update the status */
@@ -1016,6 +1390,9 @@ DRV_HANDLE DRV_SPI_Open(
             clientObj->context              = 0U;
             clientObj->setup.chipSelect     = SYS_PORT_PIN_NONE;
             clientObj->setupChanged         = false;
+            clientObj->crcSetup.type        = DRV_SPI_CRC_TYPE_NONE;
+            clientObj->priority             = DRV_SPI_PRIORITY_NORMAL;
+            (void) memset(&clientObj->statistics, 0, sizeof(clientObj->statistics));
             clientObj->drvIndex             = drvIndex;
 
             return clientObj->clientHandle;
@@ -1153,6 +1530,36 @@ bool DRV_SPI_TransferSetup (
     return isSuccess;
 }
 
+bool DRV_SPI_TransferCRCSetup (
+    const DRV_HANDLE handle,
+    const DRV_SPI_CRC_SETUP* crcSetup
+)
+{
+    DRV_SPI_CLIENT_OBJ* clientObj = NULL;
+    DRV_SPI_OBJ* dObj = (DRV_SPI_OBJ*)NULL;
+    bool isSuccess = false;
+
+    /* Validate the driver handle */
+    clientObj = lDRV_SPI_DriverHandleValidate(handle);
+
+    if((clientObj != NULL) && (crcSetup != NULL))
+    {
+        dObj = (DRV_SPI_OBJ *)&gDrvSPIObj[clientObj->drvIndex];
+
+        /* The CRC is computed by the DMA CRC engine, hence is available only
+         * when the driver instance uses DMA */
+        if ((crcSetup->type == DRV_SPI_CRC_TYPE_NONE) ||
+            ((dObj->txDMAChannel != SYS_DMA_CHANNEL_NONE) && (dObj->rxDMAChannel != SYS_DMA_CHANNEL_NONE)))
+        {
+            /* Applied to the transfers queued from now on */
+            clientObj->crcSetup = *crcSetup;
+
+            isSuccess = true;
+        }
+    }
+    return isSuccess;
+}
+
 void DRV_SPI_WriteReadTransferAdd (
     const DRV_HANDLE handle,
     void* pTransmitData,
@@ -1217,6 +1624,11 @@ void DRV_SPI_WriteReadTransferAdd (
         transferObj->currentState   = DRV_SPI_TRANSFER_OBJ_IS_IN_QUEUE;
         transferObj->event          = DRV_SPI_TRANSFER_EVENT_PENDING;
         transferObj->clientHandle   = handle;
+        transferObj->crcSetup       = clientObj->crcSetup;
+        transferObj->crc            = 0;
+        transferObj->isCRCComputed  = false;
+        transferObj->queuedCycleCount = lDRV_SPI_CycleCountGet();
+        transferObj->bypassCount    = 0;
 
         if (clientObj->setup.dataBits == DRV_SPI_DATA_BITS_8)
         {
@@ -1244,6 +1656,7 @@ void DRV_SPI_WriteReadTransferAdd (
         if (lDRV_SPI_TransferObjAddToList(dObj, transferObj) == true)
         {
             transferObj->currentState = DRV_SPI_TRANSFER_OBJ_IS_PROCESSING;
+            lDRV_SPI_TransferObjStatisticsUpdate(dObj, transferObj);
 
              /* This is the first request in the queue, hence initiate a transfer */
             lDRV_SPI_UpdateTransferSetupAndAssertCS(transferObj);
@@ -1319,6 +1732,135 @@ DRV_SPI_TRANSFER_EVENT DRV_SPI_TransferStatusGet(const DRV_SPI_TRANSFER_HANDLE t
     }
 }
 
+bool DRV_SPI_TransferCRCGet(const DRV_SPI_TRANSFER_HANDLE transferHandle, uint32_t* crc)
+{
+    DRV_SPI_OBJ* dObj = NULL;
+    DRV_SPI_TRANSFER_OBJ* transferObj = NULL;
+    uint32_t drvInstance = 0;
+    uint8_t transferIndex;
+    bool isSuccess = false;
+
+    /* Extract driver instance value from the transfer handle */
+    drvInstance = ((transferHandle & DRV_SPI_INSTANCE_MASK) >> 8);
+
+    if ((drvInstance >= DRV_SPI_INSTANCES_NUMBER) || (crc == NULL))
+    {
+        return isSuccess;
+    }
+
+    dObj = (DRV_SPI_OBJ*)&gDrvSPIObj[drvInstance];
+
+    /* Extract transfer buffer index value from the transfer handle */
+    transferIndex = (uint8_t)(transferHandle & DRV_SPI_INDEX_MASK);
+
+    if (transferIndex < dObj->transferObjPoolSize)
+    {
+        transferObj = &dObj->transferObjPool[transferIndex];
+
+        if ((transferHandle == transferObj->transferHandle) &&
+            (transferObj->event == DRV_SPI_TRANSFER_EVENT_COMPLETE) &&
+            (transferObj->isCRCComputed == true))
+        {
+            *crc = transferObj->crc;
+            isSuccess = true;
+        }
+    }
+
+    return isSuccess;
+}
+
+bool DRV_SPI_ClientPrioritySet(
+    const DRV_HANDLE handle,
+    const DRV_SPI_PRIORITY priority
+)
+{
+    DRV_SPI_CLIENT_OBJ* clientObj = NULL;
+    DRV_SPI_OBJ* dObj = (DRV_SPI_OBJ*)NULL;
+
+    /* Validate the driver handle */
+    clientObj = lDRV_SPI_DriverHandleValidate(handle);
+
+    if((clientObj == NULL) || (priority > DRV_SPI_PRIORITY_HIGH))
+    {
+        return false;
+    }
+
+    dObj = (DRV_SPI_OBJ *)&gDrvSPIObj[clientObj->drvIndex];
+
+    /* The priority is read by the scheduler from the interrupt context */
+    if(lDRV_SPI_ResourceLock(dObj) == false)
+    {
+        SYS_DEBUG_MESSAGE(SYS_ERROR_ERROR, "Failed to get resource lock");
+        return false;
+    }
+
+    clientObj->priority = priority;
+
+    lDRV_SPI_ResourceUnlock(dObj);
+
+    return true;
+}
+
+bool DRV_SPI_ClientStatisticsGet(
+    const DRV_HANDLE handle,
+    DRV_SPI_CLIENT_STATISTICS* statistics
+)
+{
+    DRV_SPI_CLIENT_OBJ* clientObj = NULL;
+    DRV_SPI_OBJ* dObj = (DRV_SPI_OBJ*)NULL;
+
+    /* Validate the driver handle */
+    clientObj = lDRV_SPI_DriverHandleValidate(handle);
+
+    if((clientObj == NULL) || (statistics == NULL))
+    {
+        return false;
+    }
+
+    dObj = (DRV_SPI_OBJ *)&gDrvSPIObj[clientObj->drvIndex];
+
+    /* The statistics are updated from the interrupt context */
+    if(lDRV_SPI_ResourceLock(dObj) == false)
+    {
+        SYS_DEBUG_MESSAGE(SYS_ERROR_ERROR, "Failed to get resource lock");
+        return false;
+    }
+
+    *statistics = clientObj->statistics;
+
+    lDRV_SPI_ResourceUnlock(dObj);
+
+    return true;
+}
+
+bool DRV_SPI_ClientStatisticsReset( const DRV_HANDLE handle )
+{
+    DRV_SPI_CLIENT_OBJ* clientObj = NULL;
+    DRV_SPI_OBJ* dObj = (DRV_SPI_OBJ*)NULL;
+
+    /* Validate the driver handle */
+    clientObj = lDRV_SPI_DriverHandleValidate(handle);
+
+    if(clientObj == NULL)
+    {
+        return false;
+    }
+
+    dObj = (DRV_SPI_OBJ *)&gDrvSPIObj[clientObj->drvIndex];
+
+    if(lDRV_SPI_ResourceLock(dObj) == false)
+    {
+        SYS_DEBUG_MESSAGE(SYS_ERROR_ERROR, "Failed to get resource lock");
+        return false;
+    }
+
+    (void) memset(&clientObj->statistics, 0, sizeof(clientObj->statistics));
+
+    lDRV_SPI_ResourceUnlock(dObj);
+
+    return true;
+}
+
 bool DRV_SPI_Lock( const DRV_HANDLE handle, bool lock )
 {
     return DRV_SPI_ExclusiveUse(handle, lock );
@@ -68,6 +68,11 @@
 #define USE_FREQ_CONFIGURED_IN_CLOCK_MANAGER    (0)
 #define NULL_INDEX                              (0xFF)
 
+/* Block action field of a DMA descriptor. Cleared (no action) on the first
+ * descriptor of a chain, so that the channel interrupts only once, at the end
+ * of the chain. */
+#define DRV_SPI_DMA_BLOCK_ACTION_MASK           ((SYS_DMA_CHANNEL_CONFIG)DMAC_BTCTRL_BLOCKACT_Msk)
+
 // *****************************************************************************
 /* SPI Client-Specific Driver Status
 
@@ -153,6 +158,22 @@ typedef struct DRV_SPI_TRANSFER_OBJ_T
     size_t                          rxSize;
 
 
+    /* CRC requested for this transfer */
+    DRV_SPI_CRC_SETUP               crcSetup;
+
+    /* CRC computed by the DMA CRC engine for this transfer */
+    uint32_t                        crc;
+
+    /* crc holds the CRC of the payload. Not set if the engine was owned by
+     * another user when the transfer started. */
+    bool                            isCRCComputed;
+
+    /* CPU cycle count when the transfer was queued */
+    uint32_t                        queuedCycleCount;
+
+    /* Number of transfers queued later that were started ahead of this one */
+    uint32_t                        bypassCount;
+
     /* Current status of the buffer */
     DRV_SPI_TRANSFER_EVENT          event;
 
@@ -277,6 +298,30 @@ typedef struct
     
     uint32_t                        transferObjLastUsedIndex;
 
+    /* Pin driven by the peripheral SS pad, SYS_PORT_PIN_NONE if not used */
+    SYS_PORT_PIN                    hwChipSelect;
+
+    /* The peripheral currently drives the SS pad */
+    bool                            isHwChipSelectEnabled;
+
+    /* The TX/RX DMA channel runs a descriptor chain. The channel settings are
+     * restored when the transfer completes. */
+    bool                            isTxDMAChained;
+    bool                            isRxDMAChained;
+
+    /* The DMA CRC engine is owned by this instance and attached to the TX or
+     * RX DMA channel of the current transfer */
+    bool                            isCRCEngineOwned;
+
+    /* Channel settings saved before a descriptor chain is submitted */
+    SYS_DMA_CHANNEL_CONFIG          txDMAChannelConfig;
+    SYS_DMA_CHANNEL_CONFIG          rxDMAChannelConfig;
+
+    /* Second descriptor of the TX/RX chains, carrying the dummy data part of
+     * the transfer */
+    SYS_DMA_DESCRIPTOR              txDummyDescriptor __ALIGNED(8);
+    SYS_DMA_DESCRIPTOR              rxDummyDescriptor __ALIGNED(8);
+
     /* Mutex to protect access to the client objects */
     OSAL_MUTEX_DECLARE(mutexClientObjects);
 
@@ -327,6 +372,15 @@ typedef struct DRV_SPI_CLIENT_OBJ_T
     /* Flag to save setup changed status */
     bool                            setupChanged;
 
+    /* CRC setup applied to the transfers queued by this client */
+    DRV_SPI_CRC_SETUP               crcSetup;
+
+    /* Priority class of the client's transfers on the shared bus */
+    DRV_SPI_PRIORITY                priority;
+
+    /* Queueing statistics of the client */
+    DRV_SPI_CLIENT_STATISTICS       statistics;
+
     /* Client handle assigned to this client object when it was opened */
     DRV_HANDLE                      clientHandle;
 
@@ -149,6 +149,9 @@ static const DRV_SPI_INIT drvSPI0InitData =
 
     /* SPI interrupt sources (SPI peripheral and DMA) */
     .interruptSources = &drvSPI0InterruptSources,
+
+    /* SPI Hardware Chip Select */
+    .hardwareChipSelect = SYS_PORT_PIN_NONE,
 };
 // </editor-fold>
 // <editor-fold defaultstate="collapsed" desc="DRV_SPI Instance 1 Initialization Data">
@@ -173,6 +176,9 @@ static const DRV_SPI_PLIB_INTERFACE drvSPI1PlibAPI = {
 
     /* SPI PLIB Callback Register */
     .callbackRegister = (DRV_SPI_PLIB_CALLBACK_REGISTER)SERCOM1_SPI_CallbackRegister,
+
+    /* SPI PLIB Hardware Chip Select Enable */
+    .hardwareChipSelectEnable = (DRV_SPI_PLIB_HARDWARE_CHIP_SELECT_ENABLE)SERCOM1_SPI_HardwareChipSelectEnable,
 };
 
 static const uint32_t drvSPI1remapDataBits[]= { 0x0, 0x1, 0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU };
@@ -228,6 +234,9 @@ static const DRV_SPI_INIT drvSPI1InitData =
 
     /* SPI interrupt sources (SPI peripheral and DMA) */
     .interruptSources = &drvSPI1InterruptSources,
+
+    /* SPI Hardware Chip Select (SERCOM1 PAD1) */
+    .hardwareChipSelect = DRV_SPI_HARDWARE_CS_PIN_IDX1,
 };
 // </editor-fold>
 
@@ -216,6 +216,9 @@ bool DMAC_ChannelTransfer( DMAC_CHANNEL channel, const void *srcAddr, const void
         /* Set Block Transfer Count */
         dmacDescReg->DMAC_BTCNT = (uint16_t)(blockSize / (1UL << beat_size));
 
+        /* Single block transfer, drop the chain left by a linked list transfer */
+        dmacDescReg->DMAC_DESCADDR = 0U;
+
         /* Enable the channel */
         DMAC_REGS->DMAC_CHCTRLA |= (uint8_t)DMAC_CHCTRLA_ENABLE_Msk;
 
@@ -237,6 +240,90 @@ bool DMAC_ChannelTransfer( DMAC_CHANNEL channel, const void *srcAddr, const void
     return returnStatus;
 }
 
+/*******************************************************************************
+    This function submits a list of DMA transfers. The first descriptor of the
+    list is copied to the channel descriptor, the following ones are fetched by
+    the DMAC from the descriptor chain.
+********************************************************************************/
+
+bool DMAC_ChannelLinkedListTransfer (DMAC_CHANNEL channel, dmac_descriptor_registers_t* channelDesc)
+{
+    uint8_t channelId = 0U;
+    bool returnStatus = false;
+    bool busyStatus = dmacChannelObj[channel].busyStatus;
+
+    /* Save channel ID */
+    channelId = (uint8_t)DMAC_REGS->DMAC_CHID;
+
+    /* Set the DMA channel */
+    DMAC_REGS->DMAC_CHID = (uint8_t)channel;
+
+    if (((DMAC_REGS->DMAC_CHINTFLAG & (DMAC_CHINTENCLR_TCMPL_Msk | DMAC_CHINTENCLR_TERR_Msk)) != 0U) || (busyStatus == false))
+    {
+        /* Clear the transfer complete flag */
+        DMAC_REGS->DMAC_CHINTFLAG = (uint8_t)(DMAC_CHINTENCLR_TCMPL_Msk | DMAC_CHINTENCLR_TERR_Msk);
+
+        dmacChannelObj[channel].busyStatus = true;
+
+        (void)memcpy(&descriptor_section[channel], channelDesc, sizeof(dmac_descriptor_registers_t));
+
+        /* Enable the channel */
+        DMAC_REGS->DMAC_CHCTRLA |= (uint8_t)DMAC_CHCTRLA_ENABLE_Msk;
+
+        returnStatus = true;
+    }
+
+    /* Restore channel ID */
+    DMAC_REGS->DMAC_CHID = channelId;
+
+    return returnStatus;
+}
+
+/*******************************************************************************
+    This function sets up a descriptor of a linked list of DMA transfers.
+********************************************************************************/
+
+void DMAC_LinkedListDescriptorSetup (dmac_descriptor_registers_t* currentDescriptor,
+                                     DMAC_CHANNEL_CONFIG setting,
+                                     const void *srcAddr,
+                                     const void *destAddr,
+                                     size_t blockSize,
+                                     dmac_descriptor_registers_t* nextDescriptor)
+{
+    uint8_t beat_size = 0U;
+
+    currentDescriptor->DMAC_BTCTRL = (uint16_t)setting;
+
+    /* Set source address */
+    if ((currentDescriptor->DMAC_BTCTRL & DMAC_BTCTRL_SRCINC_Msk) == DMAC_BTCTRL_SRCINC_Msk)
+    {
+        currentDescriptor->DMAC_SRCADDR = ((uintptr_t)srcAddr + blockSize);
+    }
+    else
+    {
+        currentDescriptor->DMAC_SRCADDR = (uintptr_t)srcAddr;
+    }
+
+    /* Set destination address */
+    if ((currentDescriptor->DMAC_BTCTRL & DMAC_BTCTRL_DSTINC_Msk) == DMAC_BTCTRL_DSTINC_Msk)
+    {
+        currentDescriptor->DMAC_DSTADDR = ((uintptr_t)destAddr + blockSize);
+    }
+    else
+    {
+        currentDescriptor->DMAC_DSTADDR = (uintptr_t)destAddr;
+    }
+
+    /* Calculate the beat size and then set the BTCNT value */
+    beat_size = (uint8_t)((currentDescriptor->DMAC_BTCTRL & DMAC_BTCTRL_BEATSIZE_Msk) >> DMAC_BTCTRL_BEATSIZE_Pos);
+
+    /* Set Block Transfer Count */
+    currentDescriptor->DMAC_BTCNT = (uint16_t)(blockSize / (1UL << beat_size));
+
+    /* Set next descriptor address */
+    currentDescriptor->DMAC_DESCADDR = (uint32_t)nextDescriptor;
+}
+
 /*******************************************************************************
     This function returns the status of the channel.
 ********************************************************************************/
@@ -298,6 +298,42 @@ bool SERCOM1_SPI_IsTransmitterBusy(void)
     return ((SERCOM1_REGS->SPIM.SERCOM_INTFLAG & SERCOM_SPIM_INTFLAG_TXC_Msk) == 0U)? true : false;
 }
 
+void SERCOM1_SPI_HardwareChipSelectEnable(bool enable)
+{
+    /* MSSEN is enable-protected */
+    SERCOM1_REGS->SPIM.SERCOM_CTRLA &= ~(SERCOM_SPIM_CTRLA_ENABLE_Msk);
+
+    /* Wait for synchronization */
+    while((SERCOM1_REGS->SPIM.SERCOM_SYNCBUSY) != 0U)
+    {
+        /* Do nothing */
+    }
+
+    if (enable == true)
+    {
+        SERCOM1_REGS->SPIM.SERCOM_CTRLB |= SERCOM_SPIM_CTRLB_MSSEN_Msk;
+    }
+    else
+    {
+        SERCOM1_REGS->SPIM.SERCOM_CTRLB &= ~SERCOM_SPIM_CTRLB_MSSEN_Msk;
+    }
+
+    /* Wait for synchronization */
+    while((SERCOM1_REGS->SPIM.SERCOM_SYNCBUSY) != 0U)
+    {
+        /* Do nothing */
+    }
+
+    /* Enabling the SPI Module */
+    SERCOM1_REGS->SPIM.SERCOM_CTRLA |= SERCOM_SPIM_CTRLA_ENABLE_Msk;
+
+    /* Wait for synchronization */
+    while((SERCOM1_REGS->SPIM.SERCOM_SYNCBUSY) != 0U)
+    {
+        /* Do nothing */
+    }
+}
+
 // *****************************************************************************
 /* Function:
     bool SERCOM1_SPI_WriteRead (void* pTransmitData, size_t txSize
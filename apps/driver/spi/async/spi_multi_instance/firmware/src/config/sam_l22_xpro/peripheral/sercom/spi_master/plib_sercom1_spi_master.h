@@ -617,6 +617,43 @@ bool SERCOM1_SPI_IsBusy (void);
 */
 bool SERCOM1_SPI_IsTransmitterBusy(void);
 
+// *****************************************************************************
+/* Function:
+    void SERCOM1_SPI_HardwareChipSelectEnable (bool enable);
+
+  Summary:
+    Enables or disables the hardware controlled slave select.
+
+  Description:
+    When enabled (CTRLB.MSSEN), the SERCOM drives its SS pad low before the
+    first character is shifted out and releases it as soon as the shift
+    register and the data register are both empty. No software action is
+    needed to assert or de-assert the slave select line.
+
+    The SS pad is released whenever the transmitter runs dry, so the data must
+    be supplied without gaps for the whole transfer (DMA).
+
+  Precondition:
+    The SERCOM1_SPI_Initialize() should have been called once. The SS pad must
+    be routed to the SERCOM in the pin configuration.
+
+  Parameters:
+    enable - true to let the SERCOM drive the SS pad, false to leave it idle
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+    SERCOM1_SPI_HardwareChipSelectEnable(true);
+    </code>
+
+  Remarks:
+    The SERCOM is briefly disabled to change the setting, so this function must
+    not be called while a transfer is in progress.
+*/
+void SERCOM1_SPI_HardwareChipSelectEnable(bool enable);
+
 #ifdef __cplusplus // Provide C++ Compatibility
 }
 #endif
@@ -59,6 +59,7 @@
 #include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include "device.h"
 
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus  // Provide C++ Compatibility
@@ -248,6 +249,82 @@ typedef enum
 */
 typedef void (*SYS_DMA_CHANNEL_CALLBACK) (SYS_DMA_TRANSFER_EVENT event, uintptr_t contextHandle);
 
+// *****************************************************************************
+/* DMA CRC polynomial type
+
+   Summary:
+    Enumeration of the CRC polynomials supported by the DMA CRC engine.
+
+   Description:
+    This data type provides an enumeration of the polynomials the DMA CRC
+    engine can compute while a DMA channel moves data.
+
+   Remarks:
+    None.
+*/
+typedef enum
+{
+    /* CRC16 (CRC-CCITT): 0x1021 */
+    SYS_DMA_CRC_TYPE_16 = 0x0,
+
+    /* CRC32 (IEEE 802.3): 0x04C11DB7 */
+    SYS_DMA_CRC_TYPE_32 = 0x1
+
+} SYS_DMA_CRC_POLYNOMIAL_TYPE;
+
+// *****************************************************************************
+/* DMA CRC setup
+
+   Summary:
+    Defines the setup of the DMA CRC engine.
+
+   Description:
+    This data type defines the polynomial and the initial seed used by the DMA
+    CRC engine.
+
+   Remarks:
+    None.
+*/
+typedef struct
+{
+    /* Polynomial type (CRC16, CRC32) */
+    SYS_DMA_CRC_POLYNOMIAL_TYPE polynomialType;
+
+    /* Initial seed for calculating the CRC */
+    uint32_t seed;
+
+} SYS_DMA_CRC_SETUP;
+
+// *****************************************************************************
+/* DMA linked list descriptor
+
+   Summary:
+    Defines a descriptor of a linked list of DMA transfers.
+
+   Description:
+    This data type maps to the DMAC transfer descriptor. Descriptors are set up
+    with SYS_DMA_LinkedListDescriptorSetup and must be 8-byte aligned.
+
+   Remarks:
+    None.
+*/
+typedef dmac_descriptor_registers_t SYS_DMA_DESCRIPTOR;
+
+// *****************************************************************************
+/* DMA channel configuration
+
+   Summary:
+    Defines the block transfer control of a DMA descriptor.
+
+   Description:
+    This data type holds the beat size, address increment, block action and
+    valid bit of a DMA descriptor.
+
+   Remarks:
+    None.
+*/
+typedef uint32_t SYS_DMA_CHANNEL_CONFIG;
+
 
 // *****************************************************************************
 // *****************************************************************************
@@ -329,6 +406,118 @@ void SYS_DMA_AddressingModeSetup(SYS_DMA_CHANNEL channel, SYS_DMA_SOURCE_ADDRESS
 */
 void SYS_DMA_DataWidthSetup(SYS_DMA_CHANNEL channel, SYS_DMA_WIDTH dataWidth);
 
+//******************************************************************************
+/* Function:
+    void SYS_DMA_ChannelCRCSetup(SYS_DMA_CHANNEL channel, SYS_DMA_CRC_SETUP crcSetup);
+
+  Summary:
+    Attaches the DMA CRC engine to the selected DMA channel.
+
+  Description:
+    This function configures the DMA CRC engine with the given polynomial and
+    seed and selects the DMA channel whose data beats are fed to the engine.
+    The CRC is then computed on the fly as the channel moves data, without a
+    second pass over the buffer. The result can be read with SYS_DMA_CRCRead
+    once the transfer(s) on the channel have completed.
+
+    There is a single CRC engine; the CRC of any previously configured channel
+    is discarded. The engine must be owned through SYS_DMA_CRCEngineAcquire.
+
+  Precondition:
+    DMA Controller should have been initialized.
+
+  Parameters:
+    channel - A specific DMA channel
+    crcSetup - Polynomial and seed of type SYS_DMA_CRC_SETUP
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+        SYS_DMA_CRC_SETUP crcSetup = {SYS_DMA_CRC_TYPE_16, 0};
+
+        if (SYS_DMA_CRCEngineAcquire() == true)
+        {
+            SYS_DMA_ChannelCRCSetup(SYS_DMA_CHANNEL_1, crcSetup);
+            SYS_DMA_ChannelTransfer(SYS_DMA_CHANNEL_1, srcAddr, destAddr, size);
+        }
+
+        // After the transfer complete event
+        crc = SYS_DMA_CRCRead();
+        SYS_DMA_CRCEngineRelease();
+    </code>
+
+  Remarks:
+    The channel must be configured before the transfer is started. The CRC is
+    computed on the beat size of the channel.
+*/
+void SYS_DMA_ChannelCRCSetup(SYS_DMA_CHANNEL channel, SYS_DMA_CRC_SETUP crcSetup);
+
+//******************************************************************************
+/* Function:
+    bool SYS_DMA_CRCEngineAcquire(void);
+
+  Summary:
+    Takes ownership of the DMA CRC engine.
+
+  Description:
+    The DMA controller has a single CRC engine, shared by every driver or
+    service that computes a CRC on the fly (SPI driver instances, SD card
+    driver, DMA CRC service). A user takes the engine with this function
+    before calling SYS_DMA_ChannelCRCSetup and gives it back with
+    SYS_DMA_CRCEngineRelease once the CRC has been read.
+
+    The function does not wait. A user that finds the engine owned by another
+    one must not configure, read or disable it.
+
+  Precondition:
+    None.
+
+  Parameters:
+    None.
+
+  Returns:
+    true - The engine was free and is now owned by the caller.
+    false - The engine is owned by another user.
+
+  Example:
+    See SYS_DMA_ChannelCRCSetup.
+
+  Remarks:
+    May be called from interrupt context.
+*/
+bool SYS_DMA_CRCEngineAcquire(void);
+
+//******************************************************************************
+/* Function:
+    void SYS_DMA_CRCEngineRelease(void);
+
+  Summary:
+    Disables the DMA CRC engine and gives up its ownership.
+
+  Description:
+    This function disables the CRC engine, detaching it from the DMA channel
+    it was attached to, and makes it available to the next
+    SYS_DMA_CRCEngineAcquire call.
+
+  Precondition:
+    The engine must be owned by the caller.
+
+  Parameters:
+    None.
+
+  Returns:
+    None.
+
+  Example:
+    See SYS_DMA_ChannelCRCSetup.
+
+  Remarks:
+    May be called from interrupt context.
+*/
+void SYS_DMA_CRCEngineRelease(void);
+
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus  // Provide C++ Compatibility
 
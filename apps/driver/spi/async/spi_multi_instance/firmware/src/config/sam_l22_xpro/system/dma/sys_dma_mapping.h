@@ -275,4 +275,231 @@
 */
 #define SYS_DMA_ChannelDisable(channel)  DMAC_ChannelDisable((DMAC_CHANNEL)channel)
 
+
+//******************************************************************************
+/* Function:
+    uint32_t SYS_DMA_CRCRead (void)
+
+  Summary:
+    Returns the CRC computed by the DMA CRC engine.
+
+  Description:
+    This function returns the CRC checksum computed by the DMA CRC engine for
+    the channel configured with SYS_DMA_ChannelCRCSetup.
+
+  Precondition:
+    SYS_DMA_ChannelCRCSetup should have been called and the DMA transfer
+    should have completed.
+
+  Parameters:
+    None.
+
+  Returns:
+    CRC checksum. Only the lower 16 bits are valid for SYS_DMA_CRC_TYPE_16.
+
+  Example:
+    <code>
+    uint32_t crc = SYS_DMA_CRCRead();
+    </code>
+
+  Remarks:
+    None.
+*/
+#define SYS_DMA_CRCRead()  DMAC_CRCRead()
+
+
+//******************************************************************************
+/* Function:
+    void SYS_DMA_CRCDisable (void)
+
+  Summary:
+    Disables the DMA CRC engine.
+
+  Description:
+    This function disables the DMA CRC engine and detaches it from the DMA
+    channel, making it available for the next user.
+
+  Precondition:
+    DMA Controller should have been initialized.
+
+  Parameters:
+    None.
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+    SYS_DMA_CRCDisable();
+    </code>
+
+  Remarks:
+    None.
+*/
+#define SYS_DMA_CRCDisable()  DMAC_CRCDisable()
+
+//******************************************************************************
+/* Function:
+    bool SYS_DMA_ChannelLinkedListTransfer
+    (
+        SYS_DMA_CHANNEL channel,
+        SYS_DMA_DESCRIPTOR* channelDesc
+    )
+
+  Summary:
+    Submits a linked list of DMA transfers and enables the channel.
+
+  Description:
+    This function submits a chain of descriptors set up with
+    SYS_DMA_LinkedListDescriptorSetup to a DMA channel and enables the channel.
+    The first descriptor is copied to the channel; the DMA fetches the
+    following descriptors from the chain as each block completes. A descriptor
+    whose valid bit is cleared stops the DMA with a fetch error until the
+    channel is re-armed.
+
+    If the requesting client registered an event callback, the
+    SYS_DMA_TRANSFER_COMPLETE event is issued at the end of each block set up
+    with the interrupt block action.
+
+  Precondition:
+    DMA Controller should have been initialized.
+
+  Parameters:
+    channel - A specific DMA channel
+
+    channelDesc - First descriptor of the chain. The descriptors must be
+    8-byte aligned.
+
+  Returns:
+    True - If transfer request is accepted.
+    False - If previous transfer is in progress and the request is rejected.
+
+  Example:
+    <code>
+    SYS_DMA_ChannelLinkedListTransfer(SYS_DMA_CHANNEL_0, &descriptors[0]);
+    </code>
+
+  Remarks:
+    None.
+*/
+#define SYS_DMA_ChannelLinkedListTransfer(channel, channelDesc)  DMAC_ChannelLinkedListTransfer((DMAC_CHANNEL)channel, channelDesc)
+
+
+//******************************************************************************
+/* Function:
+    void SYS_DMA_LinkedListDescriptorSetup
+    (
+        SYS_DMA_DESCRIPTOR* currentDescriptor,
+        SYS_DMA_CHANNEL_CONFIG setting,
+        const void *srcAddr,
+        const void *destAddr,
+        size_t blockSize,
+        SYS_DMA_DESCRIPTOR* nextDescriptor
+    )
+
+  Summary:
+    Sets up a descriptor of a linked list of DMA transfers.
+
+  Description:
+    This function fills the block transfer control, source and destination
+    addresses, block transfer count and next descriptor address of a
+    descriptor. Passing NULL as the next descriptor ends the chain.
+
+  Precondition:
+    None.
+
+  Parameters:
+    currentDescriptor - Descriptor to be set up
+
+    setting - Block transfer control of the descriptor (beat size, address
+    increment, block action and valid bit)
+
+    srcAddr - Source of the block transfer
+
+    destAddr - Destination of the block transfer
+
+    blockSize - Size of the block in bytes
+
+    nextDescriptor - Descriptor fetched after this block completes
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+    SYS_DMA_LinkedListDescriptorSetup(&descriptors[0], setting,
+        (const void*)&SERCOM0_REGS->SPIS.SERCOM_DATA, buffer0, 256U, &descriptors[1]);
+    </code>
+
+  Remarks:
+    None.
+*/
+#define SYS_DMA_LinkedListDescriptorSetup(currentDescriptor, setting, srcAddr, destAddr, blockSize, nextDescriptor)  DMAC_LinkedListDescriptorSetup(currentDescriptor, (DMAC_CHANNEL_CONFIG)setting, srcAddr, destAddr, blockSize, nextDescriptor)
+
+
+//******************************************************************************
+/* Function:
+    SYS_DMA_CHANNEL_CONFIG SYS_DMA_ChannelSettingsGet (SYS_DMA_CHANNEL channel)
+
+  Summary:
+    Returns the block transfer control of a DMA channel.
+
+  Description:
+    This function returns the block transfer control (beat size, address
+    increment, block action and valid bit) used by SYS_DMA_ChannelTransfer on
+    the channel.
+
+  Precondition:
+    DMA Controller should have been initialized.
+
+  Parameters:
+    channel - A specific DMA channel
+
+  Returns:
+    Block transfer control of the channel.
+
+  Example:
+    <code>
+    SYS_DMA_CHANNEL_CONFIG setting = SYS_DMA_ChannelSettingsGet(SYS_DMA_CHANNEL_0);
+    </code>
+
+  Remarks:
+    None.
+*/
+#define SYS_DMA_ChannelSettingsGet(channel)  (SYS_DMA_CHANNEL_CONFIG)DMAC_ChannelSettingsGet((DMAC_CHANNEL)channel)
+
+
+//******************************************************************************
+/* Function:
+    void SYS_DMA_ChannelSettingsSet (SYS_DMA_CHANNEL channel, SYS_DMA_CHANNEL_CONFIG setting)
+
+  Summary:
+    Sets the block transfer control of a DMA channel.
+
+  Description:
+    This function disables the channel and sets the block transfer control used
+    by SYS_DMA_ChannelTransfer on the channel. It restores the channel settings
+    after a linked list transfer.
+
+  Precondition:
+    DMA Controller should have been initialized.
+
+  Parameters:
+    channel - A specific DMA channel
+
+    setting - Block transfer control of the channel
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+    SYS_DMA_ChannelSettingsSet(SYS_DMA_CHANNEL_0, setting);
+    </code>
+
+  Remarks:
+    None.
+*/
+#define SYS_DMA_ChannelSettingsSet(channel, setting)  (void)DMAC_ChannelSettingsSet((DMAC_CHANNEL)channel, (DMAC_CHANNEL_CONFIG)setting)
+
 #endif // SYS_DMA_MAPPING_H
@@ -0,0 +1,230 @@
+/*******************************************************************************
+  MPLAB Harmony Application Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    app.c
+
+  Summary:
+    This file contains the source code for the MPLAB Harmony application.
+
+  Description:
+    This file contains the source code for the MPLAB Harmony application.  It
+    receives the frames sent by an external SPI master into the ping-pong
+    buffers of the SPI slave driver and returns each buffer to the driver once
+    it has been processed.
+ *******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include "app.h"
+#include "definitions.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* Application Data
+
+  Summary:
+    Holds application data
+
+  Description:
+    This structure holds the application's data.
+
+  Remarks:
+    This structure should be initialized by the APP_Initialize function.
+
+    Application strings and buffers are be defined outside this structure.
+*/
+
+static APP_DATA appData;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Application Callback Functions
+// *****************************************************************************
+// *****************************************************************************
+
+/* Called from the DMA and SERCOM interrupts. The buffers are only queued here;
+ * they are processed and released from the application task. */
+static void SPISlaveEventHandler (
+    DRV_SPI_SLAVE_EVENT event,
+    uint8_t* pBuffer,
+    size_t nBytes,
+    uintptr_t context
+)
+{
+    APP_RX_BUFFER* rxBuffer;
+
+    if (event == DRV_SPI_SLAVE_EVENT_OVERRUN)
+    {
+        /* Counted by the driver */
+        return;
+    }
+
+    if ((appData.rxQueueIn - appData.rxQueueOut) < APP_RX_QUEUE_SIZE)
+    {
+        rxBuffer = &appData.rxQueue[appData.rxQueueIn % APP_RX_QUEUE_SIZE];
+        rxBuffer->event = event;
+        rxBuffer->pBuffer = pBuffer;
+        rxBuffer->nBytes = nBytes;
+
+        appData.rxQueueIn++;
+    }
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Application Local Functions
+// *****************************************************************************
+// *****************************************************************************
+
+static void APP_RxBufferProcess(APP_RX_BUFFER* rxBuffer)
+{
+    appData.frameSize += (uint32_t)rxBuffer->nBytes;
+    appData.nBytes += (uint32_t)rxBuffer->nBytes;
+
+    if (rxBuffer->pBuffer != NULL)
+    {
+        /* The data is processed in place, then the buffer is given back to
+         * the driver so that it can be filled again */
+        DRV_SPI_SLAVE_BufferRelease(appData.drvSPISlaveHandle, rxBuffer->pBuffer);
+    }
+
+    if (rxBuffer->event == DRV_SPI_SLAVE_EVENT_FRAME_END)
+    {
+        appData.lastFrameSize = appData.frameSize;
+        appData.frameSize = 0;
+        appData.nFrames++;
+
+        LED_Toggle();
+    }
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Application Initialization and State Machine Functions
+// *****************************************************************************
+// *****************************************************************************
+
+/*******************************************************************************
+  Function:
+    void APP_Initialize ( void )
+
+  Remarks:
+    See prototype in app.h.
+ */
+
+void APP_Initialize ( void )
+{
+    /* Place the App state machine in its initial state. */
+    appData.state               = APP_STATE_INIT;
+    appData.drvSPISlaveHandle   = DRV_HANDLE_INVALID;
+    appData.rxQueueIn           = 0;
+    appData.rxQueueOut          = 0;
+}
+
+
+/******************************************************************************
+  Function:
+    void APP_Tasks ( void )
+
+  Remarks:
+    See prototype in app.h.
+ */
+
+void APP_Tasks ( void )
+{
+    /* Check the application's current state. */
+    switch ( appData.state )
+    {
+        /* Application's initial state. */
+        case APP_STATE_INIT:
+
+            appData.frameSize       = 0;
+            appData.lastFrameSize   = 0;
+            appData.nFrames         = 0;
+            appData.nBytes          = 0;
+            appData.nOverruns       = 0;
+
+            LED_Off();
+
+            appData.state = APP_STATE_DRIVER_OPEN;
+            break;
+
+        case APP_STATE_DRIVER_OPEN:
+
+            if (DRV_SPI_SLAVE_Status(DRV_SPI_SLAVE_INDEX_0) != SYS_STATUS_READY)
+            {
+                break;
+            }
+
+            /* Open the SPI slave driver. Reception starts right away. */
+            appData.drvSPISlaveHandle = DRV_SPI_SLAVE_Open( DRV_SPI_SLAVE_INDEX_0, DRV_IO_INTENT_READ );
+
+            if (appData.drvSPISlaveHandle != DRV_HANDLE_INVALID)
+            {
+                DRV_SPI_SLAVE_EventHandlerSet(appData.drvSPISlaveHandle, SPISlaveEventHandler, (uintptr_t)0);
+                appData.state = APP_STATE_RECEIVE;
+            }
+            else
+            {
+                appData.state = APP_STATE_ERROR;
+            }
+            break;
+
+        case APP_STATE_RECEIVE:
+
+            while (appData.rxQueueOut != appData.rxQueueIn)
+            {
+                APP_RxBufferProcess(&appData.rxQueue[appData.rxQueueOut % APP_RX_QUEUE_SIZE]);
+
+                appData.rxQueueOut++;
+            }
+
+            appData.nOverruns = DRV_SPI_SLAVE_OverrunCountGet(appData.drvSPISlaveHandle);
+            break;
+
+        case APP_STATE_ERROR:
+            LED_On();
+            break;
+
+        default:
+            break;
+    }
+}
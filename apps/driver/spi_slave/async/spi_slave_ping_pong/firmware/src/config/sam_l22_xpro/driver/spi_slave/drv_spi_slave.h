@@ -0,0 +1,452 @@
+/*******************************************************************************
+  SPI Slave Driver Interface Definition
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    drv_spi_slave.h
+
+  Summary:
+    SPI Slave Driver Interface Definition
+
+  Description:
+    The SPI slave driver receives a continuous stream of data from an external
+    SPI master. The DMA fills a ring of receive buffers without CPU involvement;
+    a filled buffer, or the partially filled buffer at the end of a frame
+    (slave select de-asserted), is handed to the client without copying and
+    is given back to the driver with DRV_SPI_SLAVE_BufferRelease.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+#ifndef DRV_SPI_SLAVE_H
+#define DRV_SPI_SLAVE_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File includes
+// *****************************************************************************
+// *****************************************************************************
+
+#include "driver/driver_common.h"
+#include "system/system.h"
+#include "drv_spi_slave_definitions.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* SPI Slave Driver Events
+
+ Summary:
+    Identifies the events reported by the SPI slave driver.
+
+ Description:
+    This enumeration identifies the events passed to the client's event
+    handler.
+
+ Remarks:
+    None.
+*/
+
+typedef enum
+{
+    /* A receive buffer has been filled. The buffer is owned by the client
+     * until it is released. */
+    DRV_SPI_SLAVE_EVENT_BUFFER_FULL,
+
+    /* The master de-asserted the slave select line. The partially filled
+     * buffer holding the tail of the frame is owned by the client until it is
+     * released. The buffer pointer is NULL and the byte count is zero when the
+     * frame ended on a buffer boundary. */
+    DRV_SPI_SLAVE_EVENT_FRAME_END,
+
+    /* Received data was lost because no free receive buffer was available.
+     * The buffer pointer is NULL. */
+    DRV_SPI_SLAVE_EVENT_OVERRUN
+
+} DRV_SPI_SLAVE_EVENT;
+
+// *****************************************************************************
+/* SPI Slave Driver Event Handler Function Pointer
+
+   Summary:
+    Pointer to a SPI slave driver event handler function
+
+   Description:
+    This data type defines the required function signature for the SPI slave
+    driver event handling callback function.
+
+   Parameters:
+    event   - Identifies the type of event
+
+    pBuffer - Receive buffer handed to the client, or NULL
+
+    nBytes  - Number of valid bytes in the buffer
+
+    context - Value identifying the context of the application that registered
+              the event handling function
+
+   Returns:
+    None.
+
+   Example:
+    <code>
+    void APP_SPISlaveEventHandler(DRV_SPI_SLAVE_EVENT event, uint8_t* pBuffer,
+                                  size_t nBytes, uintptr_t context)
+    {
+        if (pBuffer != NULL)
+        {
+            // Queue the buffer for processing, then call
+            // DRV_SPI_SLAVE_BufferRelease once it is consumed.
+        }
+    }
+    </code>
+
+   Remarks:
+    The event handler executes in interrupt context. It should only record the
+    buffer; processing and release should be done from the task context.
+*/
+
+typedef void (*DRV_SPI_SLAVE_EVENT_HANDLER)( DRV_SPI_SLAVE_EVENT event, uint8_t* pBuffer, size_t nBytes, uintptr_t context );
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: SPI Slave Driver System Interface Routines
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* Function:
+    SYS_MODULE_OBJ DRV_SPI_SLAVE_Initialize
+    (
+        const SYS_MODULE_INDEX drvIndex,
+        const SYS_MODULE_INIT *const init
+    );
+
+  Summary:
+    Initializes the SPI slave driver
+
+  Description:
+    This routine initializes the SPI slave driver and links the DMA
+    descriptors of the receive buffers into a ring. Reception starts when a
+    client opens the driver.
+
+  Precondition:
+    The SERCOM SPI slave PLIB and the DMA must have been initialized.
+
+  Parameters:
+    drvIndex -  Identifier for the instance to be initialized
+
+    init     -  Pointer to a data structure containing any data necessary to
+                initialize the driver.
+
+  Returns:
+    If successful, returns a valid handle to a driver instance object.
+    Otherwise it returns SYS_MODULE_OBJ_INVALID.
+
+  Example:
+    <code>
+    sysObj.drvSPISlave0 = DRV_SPI_SLAVE_Initialize(DRV_SPI_SLAVE_INDEX_0, (SYS_MODULE_INIT *)&drvSPISlave0InitData);
+    </code>
+
+  Remarks:
+    This routine must be called before any other SPI slave driver routine is
+    called.
+*/
+
+SYS_MODULE_OBJ DRV_SPI_SLAVE_Initialize( const SYS_MODULE_INDEX drvIndex, const SYS_MODULE_INIT *const init );
+
+// *****************************************************************************
+/* Function:
+    SYS_STATUS DRV_SPI_SLAVE_Status( const SYS_MODULE_INDEX drvIndex );
+
+  Summary:
+    Gets the current status of the SPI slave driver module.
+
+  Description:
+    This routine provides the current status of the SPI slave driver module.
+
+  Precondition:
+    Function DRV_SPI_SLAVE_Initialize should have been called before calling
+    this function.
+
+  Parameters:
+    drvIndex   -  Identifier for the instance
+
+  Returns:
+    SYS_STATUS_READY - Indicates that the driver is ready.
+
+    SYS_STATUS_UNINITIALIZED - Indicates that the driver is not initialized.
+
+  Example:
+    <code>
+    if (DRV_SPI_SLAVE_Status(DRV_SPI_SLAVE_INDEX_0) == SYS_STATUS_READY)
+    {
+        // Driver is ready
+    }
+    </code>
+
+  Remarks:
+    None.
+*/
+
+SYS_STATUS DRV_SPI_SLAVE_Status( const SYS_MODULE_INDEX drvIndex );
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: SPI Slave Driver Client Interface Routines
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* Function:
+    DRV_HANDLE DRV_SPI_SLAVE_Open
+    (
+        const SYS_MODULE_INDEX drvIndex,
+        const DRV_IO_INTENT ioIntent
+    );
+
+  Summary:
+    Opens the specified SPI slave driver instance and returns a handle to it
+
+  Description:
+    This routine opens the specified SPI slave driver instance, gives all the
+    receive buffers to the DMA and starts reception.
+
+  Precondition:
+    Function DRV_SPI_SLAVE_Initialize must have been called before calling
+    this function.
+
+  Parameters:
+    drvIndex  -  Identifier for the instance to be opened
+
+    ioIntent  -  Zero or more of the values from the enumeration
+                 DRV_IO_INTENT "ORed" together to indicate the intended use
+                 of the driver
+
+  Returns:
+    If successful, the routine returns a valid open-instance handle.
+
+    If an error occurs, DRV_HANDLE_INVALID is returned. Errors can occur
+    - if the driver is already opened by a client
+    - if the driver instance being opened is not initialized.
+
+  Example:
+    <code>
+    DRV_HANDLE handle;
+
+    handle = DRV_SPI_SLAVE_Open(DRV_SPI_SLAVE_INDEX_0, DRV_IO_INTENT_READ);
+    if (DRV_HANDLE_INVALID == handle)
+    {
+        // Unable to open the driver
+    }
+    </code>
+
+  Remarks:
+    The driver supports a single client. Data received before an event handler
+    is registered is discarded.
+*/
+
+DRV_HANDLE DRV_SPI_SLAVE_Open( const SYS_MODULE_INDEX drvIndex, const DRV_IO_INTENT ioIntent );
+
+// *****************************************************************************
+/* Function:
+    void DRV_SPI_SLAVE_Close( const DRV_HANDLE handle );
+
+  Summary:
+    Closes an opened-instance of the SPI slave driver
+
+  Description:
+    This routine stops reception and invalidates the handle. Buffers held by
+    the client must not be used after the driver is closed.
+
+  Precondition:
+    DRV_SPI_SLAVE_Open must have been called to obtain a valid opened device
+    handle.
+
+  Parameters:
+    handle       - A valid open-instance handle, returned from the driver's
+                   open routine
+
+  Returns:
+    None
+
+  Example:
+    <code>
+    DRV_SPI_SLAVE_Close(handle);
+    </code>
+
+  Remarks:
+    None.
+*/
+
+void DRV_SPI_SLAVE_Close( const DRV_HANDLE handle );
+
+// *****************************************************************************
+/* Function:
+    void DRV_SPI_SLAVE_EventHandlerSet
+    (
+        const DRV_HANDLE handle,
+        const DRV_SPI_SLAVE_EVENT_HANDLER eventHandler,
+        const uintptr_t context
+    );
+
+  Summary:
+    Allows a client to identify an event handling function for the driver to
+    call back when buffers are handed over.
+
+  Description:
+    This function registers the handler called when a receive buffer is filled,
+    when a frame ends and when received data is lost.
+
+  Precondition:
+    DRV_SPI_SLAVE_Open must have been called to obtain a valid opened device
+    handle.
+
+  Parameters:
+    handle       - A valid open-instance handle, returned from the driver's
+                   open routine
+
+    eventHandler - Pointer to the event handler function
+
+    context      - The value of parameter will be passed back to the client
+                   unchanged, when the eventHandler function is called
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+    DRV_SPI_SLAVE_EventHandlerSet(handle, APP_SPISlaveEventHandler, (uintptr_t)&appData);
+    </code>
+
+  Remarks:
+    None.
+*/
+
+void DRV_SPI_SLAVE_EventHandlerSet( const DRV_HANDLE handle, const DRV_SPI_SLAVE_EVENT_HANDLER eventHandler, const uintptr_t context );
+
+// *****************************************************************************
+/* Function:
+    bool DRV_SPI_SLAVE_BufferRelease( const DRV_HANDLE handle, uint8_t* pBuffer );
+
+  Summary:
+    Gives a receive buffer back to the driver.
+
+  Description:
+    This function returns a buffer handed over by a BUFFER_FULL or FRAME_END
+    event to the DMA ring. Buffers should be released in the order they were
+    received; the DMA stops at the oldest buffer still held by the client and
+    the incoming data is lost (OVERRUN event) until that buffer is released.
+
+  Precondition:
+    DRV_SPI_SLAVE_Open must have been called to obtain a valid opened device
+    handle.
+
+  Parameters:
+    handle  - A valid open-instance handle, returned from the driver's open
+              routine
+
+    pBuffer - Buffer pointer passed to the event handler
+
+  Returns:
+    true  - The buffer has been given back to the driver.
+
+    false - The handle is invalid or the buffer is not held by the client.
+
+  Example:
+    <code>
+    // pBuffer was received with DRV_SPI_SLAVE_EVENT_BUFFER_FULL
+    APP_Process(pBuffer, nBytes);
+
+    DRV_SPI_SLAVE_BufferRelease(handle, pBuffer);
+    </code>
+
+  Remarks:
+    None.
+*/
+
+bool DRV_SPI_SLAVE_BufferRelease( const DRV_HANDLE handle, uint8_t* pBuffer );
+
+// *****************************************************************************
+/* Function:
+    uint32_t DRV_SPI_SLAVE_OverrunCountGet( const DRV_HANDLE handle );
+
+  Summary:
+    Returns the number of receive overruns since the driver was opened.
+
+  Description:
+    This function returns the number of times received data was lost because
+    no free receive buffer was available.
+
+  Precondition:
+    DRV_SPI_SLAVE_Open must have been called to obtain a valid opened device
+    handle.
+
+  Parameters:
+    handle  - A valid open-instance handle, returned from the driver's open
+              routine
+
+  Returns:
+    Number of overruns. Zero if the handle is invalid.
+
+  Example:
+    <code>
+    if (DRV_SPI_SLAVE_OverrunCountGet(handle) != 0U)
+    {
+        // The client does not release the buffers fast enough
+    }
+    </code>
+
+  Remarks:
+    None.
+*/
+
+uint32_t DRV_SPI_SLAVE_OverrunCountGet( const DRV_HANDLE handle );
+
+#ifdef __cplusplus
+}
+#endif
+
+#include "driver/spi_slave/src/drv_spi_slave_local.h"
+
+#endif // #ifndef DRV_SPI_SLAVE_H
+/*******************************************************************************
+ End of File
+*/
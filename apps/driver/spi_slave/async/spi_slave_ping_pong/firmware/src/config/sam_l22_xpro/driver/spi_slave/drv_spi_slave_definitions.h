@@ -0,0 +1,164 @@
+/*******************************************************************************
+  SPI Slave Driver Definitions Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    drv_spi_slave_definitions.h
+
+  Summary:
+    SPI Slave Driver Definitions Header File
+
+  Description:
+    This file provides implementation-specific definitions for the SPI slave
+    driver's system interface.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+#ifndef DRV_SPI_SLAVE_DEFINITIONS_H
+#define DRV_SPI_SLAVE_DEFINITIONS_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File includes
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "system/system_module.h"
+#include "system/dma/sys_dma.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+typedef void (* DRV_SPI_SLAVE_PLIB_CALLBACK)( uintptr_t context );
+
+typedef void (* DRV_SPI_SLAVE_PLIB_CALLBACK_REGISTER)(DRV_SPI_SLAVE_PLIB_CALLBACK callback, uintptr_t context);
+
+typedef bool (* DRV_SPI_SLAVE_PLIB_IS_BUSY)(void);
+
+typedef uint32_t (* DRV_SPI_SLAVE_PLIB_ERROR_GET)(void);
+
+// *****************************************************************************
+/* SPI Slave Driver PLIB Interface Data
+
+  Summary:
+    Defines the data required to initialize the SPI slave driver PLIB
+    Interface.
+
+  Description:
+    This data type defines the SERCOM SPI slave PLIB functions used by the
+    driver. The PLIB reports the end of a frame (slave select de-asserted) and
+    receive overflows; the received data is moved by the DMA.
+
+  Remarks:
+    None.
+*/
+
+typedef struct
+{
+    /* SPI slave PLIB callback register API */
+    DRV_SPI_SLAVE_PLIB_CALLBACK_REGISTER    callbackRegister;
+
+    /* SPI slave PLIB frame status API */
+    DRV_SPI_SLAVE_PLIB_IS_BUSY              isBusy;
+
+    /* SPI slave PLIB error get API */
+    DRV_SPI_SLAVE_PLIB_ERROR_GET            errorGet;
+
+} DRV_SPI_SLAVE_PLIB_INTERFACE;
+
+// *****************************************************************************
+/* SPI Slave Driver Initialization Data
+
+  Summary:
+    Defines the data required to initialize the SPI slave driver
+
+  Description:
+    This data type defines the data required to initialize the SPI slave
+    driver. The receive buffers, their DMA descriptors and their buffer objects
+    are allocated by the configuration. The descriptors are chained in a ring,
+    so that the DMA moves from one buffer to the next without CPU involvement.
+
+  Remarks:
+    At least two buffers are required. The buffer size must not exceed the
+    DMA block transfer count (65535 bytes).
+*/
+
+typedef struct
+{
+    /* Identifies the PLIB API set to be used by the driver to access the
+     * peripheral. */
+    const DRV_SPI_SLAVE_PLIB_INTERFACE*     spiPlib;
+
+    /* DMA channel triggered by the SPI receive complete event */
+    SYS_DMA_CHANNEL                         dmaChannelReceive;
+
+    /* SPI receive register address used by the DMA */
+    void*                                   spiReceiveAddress;
+
+    /* Receive buffers, numBuffers * bufferSize bytes */
+    uint8_t*                                bufferPool;
+
+    /* Size of each receive buffer in bytes */
+    size_t                                  bufferSize;
+
+    /* Number of receive buffers */
+    uint32_t                                numBuffers;
+
+    /* DMA descriptors, one per buffer. Must be 8-byte aligned. */
+    SYS_DMA_DESCRIPTOR*                     descriptorPool;
+
+    /* Memory pool for the buffer objects, one per buffer */
+    uintptr_t                               bufferObjPool;
+
+} DRV_SPI_SLAVE_INIT;
+
+//DOM-IGNORE-BEGIN
+#ifdef __cplusplus
+}
+#endif
+//DOM-IGNORE-END
+
+#endif // #ifndef DRV_SPI_SLAVE_DEFINITIONS_H
+/*******************************************************************************
+ End of File
+*/
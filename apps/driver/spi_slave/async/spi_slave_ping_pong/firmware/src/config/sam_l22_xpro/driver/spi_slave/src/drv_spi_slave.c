@@ -0,0 +1,534 @@
+/*******************************************************************************
+  SPI Slave Driver Implementation.
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    drv_spi_slave.c
+
+  Summary:
+    SPI slave driver interface declarations for the static single instance
+    driver.
+
+  Description:
+    The receive buffers are filled by a DMA channel walking a ring of linked
+    descriptors. A buffer handed to the client has its descriptor marked
+    invalid, so that the DMA stops at it rather than overwriting it, and is
+    put back in the ring when the client releases it.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Include Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include "configuration.h"
+#include "driver/spi_slave/src/drv_spi_slave_local.h"
+#include "system/int/sys_int.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global objects
+// *****************************************************************************
+// *****************************************************************************
+
+static DRV_SPI_SLAVE_OBJ gDrvSPISlaveObj[DRV_SPI_SLAVE_INSTANCES_NUMBER];
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: SPI Slave Driver Local Functions
+// *****************************************************************************
+// *****************************************************************************
+
+static DRV_SPI_SLAVE_OBJ * lDRV_SPI_SLAVE_DriverHandleValidate( const DRV_HANDLE handle )
+{
+    DRV_SPI_SLAVE_OBJ *dObj = NULL;
+
+    if (handle < DRV_SPI_SLAVE_INSTANCES_NUMBER)
+    {
+        dObj = &gDrvSPISlaveObj[handle];
+
+        if (dObj->isOpened == false)
+        {
+            dObj = NULL;
+        }
+    }
+
+    return dObj;
+}
+
+static uint32_t lDRV_SPI_SLAVE_NextIndex( const DRV_SPI_SLAVE_OBJ *dObj, uint32_t index )
+{
+    index++;
+
+    if (index >= dObj->numBuffers)
+    {
+        index = 0U;
+    }
+
+    return index;
+}
+
+/* Hands a buffer to the client. Called from interrupt context. */
+static void lDRV_SPI_SLAVE_BufferHandOver( DRV_SPI_SLAVE_OBJ *dObj, uint32_t index, DRV_SPI_SLAVE_EVENT event, size_t nBytes )
+{
+    DRV_SPI_SLAVE_BUFFER_OBJ *bufferObj = &dObj->bufferObjPool[index];
+
+    if (dObj->eventHandler == NULL)
+    {
+        /* Nobody to consume the data, the buffer stays in the ring */
+        return;
+    }
+
+    /* Take the buffer out of the ring before the DMA wraps around to it */
+    bufferObj->descriptor->DMAC_BTCTRL &= (uint16_t)(~DRV_SPI_SLAVE_DMA_DESCRIPTOR_VALID);
+    bufferObj->isClientOwned = true;
+
+    dObj->eventHandler(event, bufferObj->pBuffer, nBytes, dObj->context);
+}
+
+/* Starts the DMA on the ring at the buffer to be filled next, unless the
+ * client still holds it. */
+static void lDRV_SPI_SLAVE_ReceiveStart( DRV_SPI_SLAVE_OBJ *dObj )
+{
+    DRV_SPI_SLAVE_BUFFER_OBJ *bufferObj = &dObj->bufferObjPool[dObj->fillIndex];
+
+    if (bufferObj->isClientOwned == true)
+    {
+        dObj->isStalled = true;
+    }
+    else
+    {
+        dObj->isStalled = false;
+
+        (void)SYS_DMA_ChannelLinkedListTransfer(dObj->rxDMAChannel, bufferObj->descriptor);
+    }
+}
+
+static void lDRV_SPI_SLAVE_OverrunNotify( DRV_SPI_SLAVE_OBJ *dObj )
+{
+    dObj->overrunCount++;
+
+    if (dObj->eventHandler != NULL)
+    {
+        dObj->eventHandler(DRV_SPI_SLAVE_EVENT_OVERRUN, NULL, 0U, dObj->context);
+    }
+}
+
+/* Called when the master de-asserts the slave select line. No data is clocked
+ * until slave select is asserted again, so the DMA can be stopped to read back
+ * the length of the tail of the frame, and must be re-armed before the master
+ * starts the next frame. */
+static void lDRV_SPI_SLAVE_FrameEnd( DRV_SPI_SLAVE_OBJ *dObj )
+{
+    uint32_t index;
+    size_t nBytes = 0U;
+    bool interruptState;
+
+    /* The DMA interrupt must not be served between the stop of the channel
+     * and the read of its state */
+    interruptState = SYS_INT_Disable();
+
+    index = dObj->fillIndex;
+    dObj->isFrameEndPending = false;
+
+    if (dObj->isStalled == false)
+    {
+        SYS_DMA_ChannelDisable(dObj->rxDMAChannel);
+
+        if (SYS_DMA_ChannelIsTransferComplete(dObj->rxDMAChannel) == true)
+        {
+            /* The buffer at fillIndex was completed by the last bytes of the
+             * frame and its interrupt has not been served yet. The transferred
+             * count is the one of the next descriptor. Let the DMA event
+             * handler hand the full buffer over first; it ends the frame
+             * afterwards. */
+            dObj->isFrameEndPending = true;
+        }
+        else if (dObj->bufferObjPool[index].isClientOwned == false)
+        {
+            nBytes = (size_t)SYS_DMA_ChannelGetTransferredCount(dObj->rxDMAChannel);
+        }
+        else
+        {
+            /* The DMA stopped on the descriptor of a buffer held by the
+             * client, nothing was written to it */
+        }
+    }
+
+    SYS_INT_Restore(interruptState);
+
+    if (dObj->isFrameEndPending == true)
+    {
+        return;
+    }
+
+    if (nBytes > 0U)
+    {
+        dObj->fillIndex = lDRV_SPI_SLAVE_NextIndex(dObj, index);
+
+        lDRV_SPI_SLAVE_BufferHandOver(dObj, index, DRV_SPI_SLAVE_EVENT_FRAME_END, nBytes);
+    }
+    else if ((dObj->isFrameActive == true) && (dObj->eventHandler != NULL))
+    {
+        /* The frame ended on a buffer boundary */
+        dObj->eventHandler(DRV_SPI_SLAVE_EVENT_FRAME_END, NULL, 0U, dObj->context);
+    }
+    else
+    {
+        /* Nothing received since the last frame end */
+    }
+
+    dObj->isFrameActive = false;
+
+    if (dObj->isStalled == false)
+    {
+        lDRV_SPI_SLAVE_ReceiveStart(dObj);
+    }
+}
+
+static void lDRV_SPI_SLAVE_DMAEventHandler( SYS_DMA_TRANSFER_EVENT event, uintptr_t context )
+{
+    DRV_SPI_SLAVE_OBJ *dObj = (DRV_SPI_SLAVE_OBJ *)context;
+    uint32_t index = dObj->fillIndex;
+
+    if (dObj->isOpened == false)
+    {
+        return;
+    }
+
+    if (event == SYS_DMA_TRANSFER_COMPLETE)
+    {
+        /* The DMA has already moved on to the next descriptor of the ring */
+        dObj->fillIndex = lDRV_SPI_SLAVE_NextIndex(dObj, index);
+        dObj->isFrameActive = true;
+
+        lDRV_SPI_SLAVE_BufferHandOver(dObj, index, DRV_SPI_SLAVE_EVENT_BUFFER_FULL, dObj->bufferSize);
+
+        if (dObj->isFrameEndPending == true)
+        {
+            lDRV_SPI_SLAVE_FrameEnd(dObj);
+        }
+    }
+    else
+    {
+        /* Bus error. Restart at the beginning of the current buffer. */
+        SYS_DMA_ChannelDisable(dObj->rxDMAChannel);
+
+        lDRV_SPI_SLAVE_OverrunNotify(dObj);
+
+        lDRV_SPI_SLAVE_ReceiveStart(dObj);
+    }
+}
+
+static void lDRV_SPI_SLAVE_PlibEventHandler( uintptr_t context )
+{
+    DRV_SPI_SLAVE_OBJ *dObj = (DRV_SPI_SLAVE_OBJ *)context;
+    uint32_t errorStatus = dObj->spiPlib->errorGet();
+
+    if (dObj->isOpened == false)
+    {
+        return;
+    }
+
+    if (errorStatus != 0U)
+    {
+        lDRV_SPI_SLAVE_OverrunNotify(dObj);
+    }
+
+    if (dObj->spiPlib->isBusy() == false)
+    {
+        lDRV_SPI_SLAVE_FrameEnd(dObj);
+    }
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: SPI Slave Driver Global Functions
+// *****************************************************************************
+// *****************************************************************************
+
+SYS_MODULE_OBJ DRV_SPI_SLAVE_Initialize
+(
+    const SYS_MODULE_INDEX drvIndex,
+    const SYS_MODULE_INIT *const init
+)
+{
+    DRV_SPI_SLAVE_OBJ *dObj = NULL;
+    const DRV_SPI_SLAVE_INIT *spiSlaveInit = NULL;
+    DRV_SPI_SLAVE_BUFFER_OBJ *bufferObj = NULL;
+    uint32_t index = 0U;
+    uint32_t nextIndex = 0U;
+
+    /* Validate the driver index */
+    if (drvIndex >= DRV_SPI_SLAVE_INSTANCES_NUMBER)
+    {
+        return SYS_MODULE_OBJ_INVALID;
+    }
+
+    dObj = &gDrvSPISlaveObj[drvIndex];
+
+    /* Check if the instance has already been initialized. */
+    if (dObj->inUse == true)
+    {
+        return SYS_MODULE_OBJ_INVALID;
+    }
+
+    spiSlaveInit = (const DRV_SPI_SLAVE_INIT *)init;
+
+    /* Double buffering needs at least two buffers and each buffer must be
+     * filled by a single DMA block */
+    if ((spiSlaveInit->numBuffers < 2U) || (spiSlaveInit->bufferSize == 0U) ||
+        (spiSlaveInit->bufferSize > DRV_SPI_SLAVE_BUFFER_SIZE_MAX))
+    {
+        return SYS_MODULE_OBJ_INVALID;
+    }
+
+    dObj->inUse             = true;
+    dObj->isOpened          = false;
+    dObj->spiPlib           = spiSlaveInit->spiPlib;
+    dObj->rxDMAChannel      = spiSlaveInit->dmaChannelReceive;
+    dObj->rxAddress         = spiSlaveInit->spiReceiveAddress;
+    dObj->bufferObjPool     = (DRV_SPI_SLAVE_BUFFER_OBJ *)spiSlaveInit->bufferObjPool;
+    dObj->numBuffers        = spiSlaveInit->numBuffers;
+    dObj->bufferSize        = spiSlaveInit->bufferSize;
+    dObj->fillIndex         = 0U;
+    dObj->isStalled         = true;
+    dObj->isFrameActive     = false;
+    dObj->isFrameEndPending = false;
+    dObj->eventHandler      = NULL;
+    dObj->context           = 0U;
+    dObj->overrunCount      = 0U;
+
+    /* Link the descriptors of the buffers in a ring */
+    for (index = 0U; index < dObj->numBuffers; index++)
+    {
+        bufferObj = &dObj->bufferObjPool[index];
+        nextIndex = lDRV_SPI_SLAVE_NextIndex(dObj, index);
+
+        bufferObj->pBuffer          = &spiSlaveInit->bufferPool[index * dObj->bufferSize];
+        bufferObj->descriptor       = &spiSlaveInit->descriptorPool[index];
+        bufferObj->isClientOwned    = false;
+
+        SYS_DMA_LinkedListDescriptorSetup(bufferObj->descriptor, DRV_SPI_SLAVE_DMA_RX_CONFIG,
+                dObj->rxAddress, bufferObj->pBuffer, dObj->bufferSize, &spiSlaveInit->descriptorPool[nextIndex]);
+    }
+
+    SYS_DMA_ChannelCallbackRegister(dObj->rxDMAChannel, lDRV_SPI_SLAVE_DMAEventHandler, (uintptr_t)dObj);
+
+    dObj->spiPlib->callbackRegister(lDRV_SPI_SLAVE_PlibEventHandler, (uintptr_t)dObj);
+
+    dObj->status = SYS_STATUS_READY;
+
+    /* Return the driver index */
+    return (SYS_MODULE_OBJ)drvIndex;
+}
+
+SYS_STATUS DRV_SPI_SLAVE_Status( const SYS_MODULE_INDEX drvIndex )
+{
+    if (drvIndex >= DRV_SPI_SLAVE_INSTANCES_NUMBER)
+    {
+        return SYS_STATUS_UNINITIALIZED;
+    }
+
+    /* Return the driver status */
+    return (gDrvSPISlaveObj[drvIndex].status);
+}
+
+DRV_HANDLE DRV_SPI_SLAVE_Open( const SYS_MODULE_INDEX drvIndex, const DRV_IO_INTENT ioIntent )
+{
+    DRV_SPI_SLAVE_OBJ *dObj = NULL;
+    uint32_t index = 0U;
+    bool interruptState;
+
+    if (drvIndex >= DRV_SPI_SLAVE_INSTANCES_NUMBER)
+    {
+        return DRV_HANDLE_INVALID;
+    }
+
+    dObj = &gDrvSPISlaveObj[drvIndex];
+
+    if ((dObj->status != SYS_STATUS_READY) || (dObj->isOpened == true))
+    {
+        return DRV_HANDLE_INVALID;
+    }
+
+    interruptState = SYS_INT_Disable();
+
+    /* Give all the buffers to the DMA */
+    for (index = 0U; index < dObj->numBuffers; index++)
+    {
+        dObj->bufferObjPool[index].isClientOwned = false;
+        dObj->bufferObjPool[index].descriptor->DMAC_BTCTRL |= (uint16_t)DRV_SPI_SLAVE_DMA_DESCRIPTOR_VALID;
+    }
+
+    dObj->fillIndex         = 0U;
+    dObj->isFrameActive     = false;
+    dObj->isFrameEndPending = false;
+    dObj->eventHandler      = NULL;
+    dObj->context           = 0U;
+    dObj->overrunCount      = 0U;
+
+    /* Discard the overflows reported while nobody was receiving */
+    (void)dObj->spiPlib->errorGet();
+
+    dObj->isOpened = true;
+
+    lDRV_SPI_SLAVE_ReceiveStart(dObj);
+
+    SYS_INT_Restore(interruptState);
+
+    return ((DRV_HANDLE)drvIndex);
+}
+
+void DRV_SPI_SLAVE_Close( const DRV_HANDLE handle )
+{
+    DRV_SPI_SLAVE_OBJ *dObj = lDRV_SPI_SLAVE_DriverHandleValidate(handle);
+    bool interruptState;
+
+    if (dObj == NULL)
+    {
+        return;
+    }
+
+    interruptState = SYS_INT_Disable();
+
+    dObj->isOpened = false;
+
+    SYS_DMA_ChannelDisable(dObj->rxDMAChannel);
+
+    dObj->isStalled = true;
+    dObj->eventHandler = NULL;
+
+    SYS_INT_Restore(interruptState);
+}
+
+void DRV_SPI_SLAVE_EventHandlerSet
+(
+    const DRV_HANDLE handle,
+    const DRV_SPI_SLAVE_EVENT_HANDLER eventHandler,
+    const uintptr_t context
+)
+{
+    DRV_SPI_SLAVE_OBJ *dObj = lDRV_SPI_SLAVE_DriverHandleValidate(handle);
+    bool interruptState;
+
+    if (dObj == NULL)
+    {
+        return;
+    }
+
+    interruptState = SYS_INT_Disable();
+
+    dObj->eventHandler = eventHandler;
+    dObj->context = context;
+
+    SYS_INT_Restore(interruptState);
+}
+
+bool DRV_SPI_SLAVE_BufferRelease( const DRV_HANDLE handle, uint8_t* pBuffer )
+{
+    DRV_SPI_SLAVE_OBJ *dObj = lDRV_SPI_SLAVE_DriverHandleValidate(handle);
+    DRV_SPI_SLAVE_BUFFER_OBJ *bufferObj = NULL;
+    uintptr_t offset = 0U;
+    uint32_t index = 0U;
+    bool interruptState;
+    bool isReleased = false;
+
+    if ((dObj == NULL) || (pBuffer == NULL))
+    {
+        return false;
+    }
+
+    /* Map the buffer pointer back to its ring position */
+    if ((uintptr_t)pBuffer < (uintptr_t)dObj->bufferObjPool[0].pBuffer)
+    {
+        return false;
+    }
+
+    offset = (uintptr_t)pBuffer - (uintptr_t)dObj->bufferObjPool[0].pBuffer;
+
+    if ((offset % dObj->bufferSize) != 0U)
+    {
+        return false;
+    }
+
+    index = (uint32_t)(offset / dObj->bufferSize);
+
+    if (index >= dObj->numBuffers)
+    {
+        return false;
+    }
+
+    bufferObj = &dObj->bufferObjPool[index];
+
+    interruptState = SYS_INT_Disable();
+
+    if (bufferObj->isClientOwned == true)
+    {
+        bufferObj->isClientOwned = false;
+        bufferObj->descriptor->DMAC_BTCTRL |= (uint16_t)DRV_SPI_SLAVE_DMA_DESCRIPTOR_VALID;
+
+        if (dObj->isStalled == true)
+        {
+            /* The DMA was stopped at a frame end. Restart it if it was waiting
+             * for this buffer. */
+            if (index == dObj->fillIndex)
+            {
+                lDRV_SPI_SLAVE_ReceiveStart(dObj);
+            }
+        }
+        else
+        {
+            /* If the DMA fetched the invalid descriptor of this buffer in the
+             * middle of a frame it is suspended; the resume command makes it
+             * fetch the descriptor again. */
+            SYS_DMA_ChannelResume(dObj->rxDMAChannel);
+        }
+
+        isReleased = true;
+    }
+
+    SYS_INT_Restore(interruptState);
+
+    return isReleased;
+}
+
+uint32_t DRV_SPI_SLAVE_OverrunCountGet( const DRV_HANDLE handle )
+{
+    DRV_SPI_SLAVE_OBJ *dObj = lDRV_SPI_SLAVE_DriverHandleValidate(handle);
+
+    if (dObj == NULL)
+    {
+        return 0U;
+    }
+
+    return dObj->overrunCount;
+}
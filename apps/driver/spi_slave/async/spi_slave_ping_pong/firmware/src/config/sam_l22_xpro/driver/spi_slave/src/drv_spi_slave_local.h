@@ -0,0 +1,149 @@
+/*******************************************************************************
+  SPI Slave Driver Local Data Structures
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    drv_spi_slave_local.h
+
+  Summary:
+    SPI slave driver local declarations and definitions
+
+  Description:
+    This file contains the SPI slave driver's local declarations and
+    definitions.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+#ifndef DRV_SPI_SLAVE_LOCAL_H
+#define DRV_SPI_SLAVE_LOCAL_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File includes
+// *****************************************************************************
+// *****************************************************************************
+
+#include "driver/spi_slave/drv_spi_slave.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Data Type Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/* Block transfer control of the receive descriptors: byte beats from the SPI
+ * data register to an incrementing buffer address, interrupt at the end of
+ * every block. */
+#define DRV_SPI_SLAVE_DMA_RX_CONFIG             ((uint32_t)DMAC_BTCTRL_BLOCKACT_INT | (uint32_t)DMAC_BTCTRL_BEATSIZE_BYTE | (uint32_t)DMAC_BTCTRL_DSTINC_Msk | (uint32_t)DMAC_BTCTRL_VALID_Msk)
+
+/* Descriptor valid bit. Cleared while the client holds the buffer, so that the
+ * DMA stops instead of overwriting it. */
+#define DRV_SPI_SLAVE_DMA_DESCRIPTOR_VALID      (DMAC_BTCTRL_VALID_Msk)
+
+/* Largest buffer the DMA can fill with one block transfer */
+#define DRV_SPI_SLAVE_BUFFER_SIZE_MAX           (0xFFFFU)
+
+/**************************************
+ * SPI Slave Driver Receive Buffer Object
+ **************************************/
+typedef struct
+{
+    /* Receive buffer */
+    uint8_t* pBuffer;
+
+    /* DMA descriptor filling the buffer */
+    SYS_DMA_DESCRIPTOR* descriptor;
+
+    /* Buffer has been handed to the client and not yet released */
+    bool isClientOwned;
+
+} DRV_SPI_SLAVE_BUFFER_OBJ;
+
+/**************************************
+ * SPI Slave Driver Hardware Instance Object
+ **************************************/
+typedef struct
+{
+    /* Flag to indicate in use */
+    bool inUse;
+
+    /* Flag to indicate that the driver has been opened */
+    bool isOpened;
+
+    /* The status of the driver */
+    SYS_STATUS status;
+
+    /* PLIB API list that will be used by the driver to access the hardware */
+    const DRV_SPI_SLAVE_PLIB_INTERFACE* spiPlib;
+
+    /* Receive DMA channel */
+    SYS_DMA_CHANNEL rxDMAChannel;
+
+    /* SPI receive register address */
+    void* rxAddress;
+
+    /* Receive buffer objects, linked in a ring through their descriptors */
+    DRV_SPI_SLAVE_BUFFER_OBJ* bufferObjPool;
+
+    /* Number of receive buffers */
+    uint32_t numBuffers;
+
+    /* Size of each receive buffer */
+    size_t bufferSize;
+
+    /* Index of the buffer being filled by the DMA */
+    volatile uint32_t fillIndex;
+
+    /* The DMA has been stopped at the end of a frame and could not be re-armed
+     * because the next buffer is held by the client */
+    volatile bool isStalled;
+
+    /* Data has been received since the last frame end */
+    volatile bool isFrameActive;
+
+    /* The frame ended while the transfer complete interrupt of a full buffer
+     * was pending. The frame end is handled after that buffer. */
+    volatile bool isFrameEndPending;
+
+    /* Client event handler */
+    DRV_SPI_SLAVE_EVENT_HANDLER eventHandler;
+
+    /* Client context */
+    uintptr_t context;
+
+    /* Number of receive overruns since the driver was opened */
+    volatile uint32_t overrunCount;
+
+} DRV_SPI_SLAVE_OBJ;
+
+#endif //#ifndef DRV_SPI_SLAVE_LOCAL_H
+
+/*******************************************************************************
+ End of File
+*/
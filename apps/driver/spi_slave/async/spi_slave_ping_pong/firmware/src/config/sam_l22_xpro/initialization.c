@@ -0,0 +1,229 @@
+/*******************************************************************************
+  System Initialization File
+
+  File Name:
+    initialization.c
+
+  Summary:
+    This file contains source code necessary to initialize the system.
+
+  Description:
+    This file contains source code necessary to initialize the system.  It
+    implements the "SYS_Initialize" function, defines the configuration bits,
+    and allocates any necessary global system resources,
+ *******************************************************************************/
+
+// DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *******************************************************************************/
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include "configuration.h"
+#include "definitions.h"
+#include "device.h"
+
+
+// ****************************************************************************
+// ****************************************************************************
+// Section: Configuration Bits
+// ****************************************************************************
+// ****************************************************************************
+#pragma config NVMCTRL_BOOTPROT = 0x7
+#pragma config NVMCTRL_EEPROM_SIZE = 0x7
+#pragma config BOD33USERLEVEL = 0x6U
+#pragma config BOD33_DIS = CLEAR
+#pragma config BOD33_ACTION = 0x0
+#pragma config WDT_ENABLE = CLEAR
+#pragma config WDT_ALWAYSON = CLEAR
+#pragma config WDT_PER = 0xB
+#pragma config WDT_WINDOW = 0xB
+#pragma config WDT_EWOFFSET = 0xB
+#pragma config WDT_WEN = CLEAR
+#pragma config BOD33_HYST = CLEAR
+#pragma config NVMCTRL_REGION_LOCKS = 0xffffU
+
+
+
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Driver Initialization Data
+// *****************************************************************************
+// *****************************************************************************
+/* Following MISRA-C rules are deviated in the below code block */
+/* MISRA C-2012 Rule 7.2 - Deviation record ID - H3_MISRAC_2012_R_7_2_DR_1 */
+/* MISRA C-2012 Rule 11.1 - Deviation record ID - H3_MISRAC_2012_R_11_1_DR_1 */
+/* MISRA C-2012 Rule 11.3 - Deviation record ID - H3_MISRAC_2012_R_11_3_DR_1 */
+/* MISRA C-2012 Rule 11.8 - Deviation record ID - H3_MISRAC_2012_R_11_8_DR_1 */
+// <editor-fold defaultstate="collapsed" desc="DRV_SPI_SLAVE Instance 0 Initialization Data">
+
+/* SPI Slave Receive Buffers */
+static uint8_t drvSPISlave0Buffers[DRV_SPI_SLAVE_BUFFERS_NUMBER_IDX0 * DRV_SPI_SLAVE_BUFFER_SIZE_IDX0];
+
+/* SPI Slave Receive DMA Descriptors, linked in a ring by the driver */
+static SYS_DMA_DESCRIPTOR __ALIGNED(8) drvSPISlave0Descriptors[DRV_SPI_SLAVE_BUFFERS_NUMBER_IDX0];
+
+/* SPI Slave Buffer Objects Pool */
+static DRV_SPI_SLAVE_BUFFER_OBJ drvSPISlave0BufferObjPool[DRV_SPI_SLAVE_BUFFERS_NUMBER_IDX0];
+
+/* SPI Slave PLIB Interface Initialization */
+static const DRV_SPI_SLAVE_PLIB_INTERFACE drvSPISlave0PlibAPI = {
+
+    /* SPI Slave PLIB Callback Register */
+    .callbackRegister = (DRV_SPI_SLAVE_PLIB_CALLBACK_REGISTER)SERCOM0_SPI_CallbackRegister,
+
+    /* SPI Slave PLIB Frame Status function */
+    .isBusy = (DRV_SPI_SLAVE_PLIB_IS_BUSY)SERCOM0_SPI_IsBusy,
+
+    /* SPI Slave PLIB Error Get function */
+    .errorGet = (DRV_SPI_SLAVE_PLIB_ERROR_GET)SERCOM0_SPI_ErrorGet,
+};
+
+/* SPI Slave Driver Initialization Data */
+static const DRV_SPI_SLAVE_INIT drvSPISlave0InitData =
+{
+    /* SPI Slave PLIB API */
+    .spiPlib = &drvSPISlave0PlibAPI,
+
+    /* DMA Channel for Receive */
+    .dmaChannelReceive = DRV_SPI_SLAVE_RCV_DMA_CH_IDX0,
+
+    /* SPI Receive Register */
+    .spiReceiveAddress = (void *)&(SERCOM0_REGS->SPIS.SERCOM_DATA),
+
+    /* SPI Slave Receive Buffers */
+    .bufferPool = &drvSPISlave0Buffers[0],
+
+    /* SPI Slave Receive Buffer Size */
+    .bufferSize = DRV_SPI_SLAVE_BUFFER_SIZE_IDX0,
+
+    /* SPI Slave Number of Receive Buffers */
+    .numBuffers = DRV_SPI_SLAVE_BUFFERS_NUMBER_IDX0,
+
+    /* SPI Slave Receive DMA Descriptors */
+    .descriptorPool = &drvSPISlave0Descriptors[0],
+
+    /* SPI Slave Buffer Objects Pool */
+    .bufferObjPool = (uintptr_t)&drvSPISlave0BufferObjPool[0],
+};
+// </editor-fold>
+
+
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: System Data
+// *****************************************************************************
+// *****************************************************************************
+/* Structure to hold the object handles for the modules in the system. */
+SYSTEM_OBJECTS sysObj;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Library/Stack Initialization Data
+// *****************************************************************************
+// *****************************************************************************
+
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: System Initialization
+// *****************************************************************************
+// *****************************************************************************
+
+
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local initialization functions
+// *****************************************************************************
+// *****************************************************************************
+
+/* MISRAC 2012 deviation block end */
+
+/*******************************************************************************
+  Function:
+    void SYS_Initialize ( void *data )
+
+  Summary:
+    Initializes the board, services, drivers, application and other modules.
+
+  Remarks:
+ */
+
+void SYS_Initialize ( void* data )
+{
+
+    /* MISRAC 2012 deviation block start */
+    /* MISRA C-2012 Rule 2.2 deviated in this file.  Deviation record ID -  H3_MISRAC_2012_R_2_2_DR_1 */
+
+    NVMCTRL_REGS->NVMCTRL_CTRLB = NVMCTRL_CTRLB_RWS(3UL);
+
+    PM_Initialize();
+
+  
+    PORT_Initialize();
+
+    CLOCK_Initialize();
+
+
+
+    SERCOM0_SPI_Initialize();
+
+    NVMCTRL_Initialize( );
+
+    EVSYS_Initialize();
+
+    DMAC_Initialize();
+
+	BSP_Initialize();
+
+    /* MISRAC 2012 deviation block start */
+    /* Following MISRA-C rules deviated in this block  */
+    /* MISRA C-2012 Rule 11.3 - Deviation record ID - H3_MISRAC_2012_R_11_3_DR_1 */
+    /* MISRA C-2012 Rule 11.8 - Deviation record ID - H3_MISRAC_2012_R_11_8_DR_1 */
+
+    /* Initialize SPI Slave 0 Driver Instance */
+    sysObj.drvSPISlave0 = DRV_SPI_SLAVE_Initialize(DRV_SPI_SLAVE_INDEX_0, (SYS_MODULE_INIT *)&drvSPISlave0InitData);
+
+
+
+
+    /* MISRAC 2012 deviation block end */
+    APP_Initialize();
+
+
+    NVIC_Initialize();
+
+
+    /* MISRAC 2012 deviation block end */
+}
+
+/*******************************************************************************
+ End of File
+*/
@@ -0,0 +1,182 @@
+/*******************************************************************************
+  SERIAL COMMUNICATION SERIAL PERIPHERAL INTERFACE(SERCOM0_SPI) PLIB
+
+  Company
+    Microchip Technology Inc.
+
+  File Name
+    plib_sercom0_spi_slave.c
+
+  Summary
+    SERCOM0_SPI Slave PLIB Implementation File.
+
+  Description
+    This file defines the interface to the SERCOM SPI peripheral library
+    operating in slave mode. The received data is moved by the DMA; this
+    library configures the peripheral and reports the frame boundaries and
+    the receive errors.
+
+  Remarks:
+    None.
+
+*******************************************************************************/
+
+// DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+// DOM-IGNORE-END
+
+#include "interrupts.h"
+#include "plib_sercom0_spi_slave.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data
+// *****************************************************************************
+// *****************************************************************************
+
+/* Global object to save SPI slave related data */
+volatile static SPI_SLAVE_OBJECT sercom0SPISObj;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: SERCOM0_SPI Slave Implementation
+// *****************************************************************************
+// *****************************************************************************
+
+void SERCOM0_SPI_Initialize(void)
+{
+    /* Instantiate the SERCOM0 SPI slave object */
+    sercom0SPISObj.callback = NULL;
+    sercom0SPISObj.context = 0U;
+    sercom0SPISObj.transferIsBusy = false;
+    sercom0SPISObj.errorStatus = (uint32_t)SPI_SLAVE_ERROR_NONE;
+
+    /* Selection of the Character Size, Receiver Enable and Slave Select Low
+     * Detect Enable */
+    SERCOM0_REGS->SPIS.SERCOM_CTRLB = SERCOM_SPIS_CTRLB_CHSIZE_8_BIT | SERCOM_SPIS_CTRLB_RXEN_Msk | SERCOM_SPIS_CTRLB_SSDE_Msk;
+
+    /* Wait for synchronization */
+    while((SERCOM0_REGS->SPIS.SERCOM_SYNCBUSY) != 0U)
+    {
+        /* Do nothing */
+    }
+
+    /* Enable the slave select low, transmit complete (slave select high) and
+     * error interrupts. The receive complete flag triggers the DMA and is not
+     * enabled as an interrupt. */
+    SERCOM0_REGS->SPIS.SERCOM_INTENSET = (uint8_t)(SERCOM_SPIS_INTENSET_SSL_Msk | SERCOM_SPIS_INTENSET_TXC_Msk | SERCOM_SPIS_INTENSET_ERROR_Msk);
+
+    /* Configure Data Out Pin Out, Slave Mode, Data In Pin Out, Data Order,
+     * Immediate Buffer Overflow Notification and Selection of the Clock Phase
+     * and Polarity and Enable the SPI Module
+     */
+    SERCOM0_REGS->SPIS.SERCOM_CTRLA = SERCOM_SPIS_CTRLA_MODE_SPI_SLAVE | SERCOM_SPIS_CTRLA_DOPO_PAD2 | SERCOM_SPIS_CTRLA_DIPO_PAD0 | SERCOM_SPIS_CTRLA_CPOL_IDLE_LOW | SERCOM_SPIS_CTRLA_CPHA_LEADING_EDGE | SERCOM_SPIS_CTRLA_DORD_MSB | SERCOM_SPIS_CTRLA_IBON_Msk | SERCOM_SPIS_CTRLA_ENABLE_Msk;
+
+    /* Wait for synchronization */
+    while((SERCOM0_REGS->SPIS.SERCOM_SYNCBUSY) != 0U)
+    {
+        /* Do nothing */
+    }
+}
+
+bool SERCOM0_SPI_IsBusy(void)
+{
+    return sercom0SPISObj.transferIsBusy;
+}
+
+SPI_SLAVE_ERROR SERCOM0_SPI_ErrorGet(void)
+{
+    SPI_SLAVE_ERROR errorStatus = (SPI_SLAVE_ERROR)sercom0SPISObj.errorStatus;
+
+    sercom0SPISObj.errorStatus = (uint32_t)SPI_SLAVE_ERROR_NONE;
+
+    return errorStatus;
+}
+
+void SERCOM0_SPI_CallbackRegister(SERCOM_SPI_SLAVE_CALLBACK callBack, uintptr_t context)
+{
+    sercom0SPISObj.callback = callBack;
+
+    sercom0SPISObj.context = context;
+}
+
+/*******************************************************************************
+  Function:
+    void SERCOM0_SPI_InterruptHandler(void);
+
+  Summary:
+    Handler that handles the SPI slave interrupts
+
+  Description:
+    The transmit complete flag is processed before the slave select low flag
+    so that the end of a frame is reported before the start of the next one
+    when both are pending.
+
+  Remarks:
+    Refer plib_sercom0_spi_slave.h file for more information.
+*/
+
+void __attribute__((used)) SERCOM0_SPI_InterruptHandler(void)
+{
+    uint8_t intFlag = SERCOM0_REGS->SPIS.SERCOM_INTFLAG;
+    uintptr_t context = sercom0SPISObj.context;
+
+    if ((intFlag & SERCOM_SPIS_INTFLAG_ERROR_Msk) == SERCOM_SPIS_INTFLAG_ERROR_Msk)
+    {
+        sercom0SPISObj.errorStatus |= ((uint32_t)SERCOM0_REGS->SPIS.SERCOM_STATUS & SERCOM_SPIS_STATUS_BUFOVF_Msk);
+
+        /* Clear the error status and the error interrupt flag */
+        SERCOM0_REGS->SPIS.SERCOM_STATUS = (uint16_t)SERCOM_SPIS_STATUS_BUFOVF_Msk;
+        SERCOM0_REGS->SPIS.SERCOM_INTFLAG = (uint8_t)SERCOM_SPIS_INTFLAG_ERROR_Msk;
+
+        /* Overflows only occur while data is clocked in */
+        sercom0SPISObj.transferIsBusy = true;
+
+        if (sercom0SPISObj.callback != NULL)
+        {
+            sercom0SPISObj.callback(context);
+        }
+    }
+
+    if ((intFlag & SERCOM_SPIS_INTFLAG_TXC_Msk) == SERCOM_SPIS_INTFLAG_TXC_Msk)
+    {
+        /* Slave select has been de-asserted by the master */
+        SERCOM0_REGS->SPIS.SERCOM_INTFLAG = (uint8_t)SERCOM_SPIS_INTFLAG_TXC_Msk;
+
+        sercom0SPISObj.transferIsBusy = false;
+
+        if (sercom0SPISObj.callback != NULL)
+        {
+            sercom0SPISObj.callback(context);
+        }
+    }
+
+    if ((intFlag & SERCOM_SPIS_INTFLAG_SSL_Msk) == SERCOM_SPIS_INTFLAG_SSL_Msk)
+    {
+        /* Slave select has been asserted by the master */
+        SERCOM0_REGS->SPIS.SERCOM_INTFLAG = (uint8_t)SERCOM_SPIS_INTFLAG_SSL_Msk;
+
+        sercom0SPISObj.transferIsBusy = true;
+    }
+}
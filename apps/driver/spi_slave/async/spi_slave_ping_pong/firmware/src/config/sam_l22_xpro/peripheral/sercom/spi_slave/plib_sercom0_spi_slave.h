@@ -0,0 +1,226 @@
+/*******************************************************************************
+  SERIAL COMMUNICATION SERIAL PERIPHERAL INTERFACE(SERCOM0_SPI) PLIB
+
+  Company
+    Microchip Technology Inc.
+
+  File Name
+    plib_sercom0_spi_slave.h
+
+  Summary
+    SERCOM0_SPI Slave PLIB Header File.
+
+  Description
+    This file has prototype of all the interfaces provided for particular
+    SERCOM peripheral operating in SPI slave mode.
+
+*******************************************************************************/
+
+// DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+// DOM-IGNORE-END
+
+#ifndef PLIB_SERCOM0_SPI_SLAVE_H // Guards against multiple inclusion
+#define PLIB_SERCOM0_SPI_SLAVE_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+/* This section lists the other files that are included in this file.
+*/
+
+#include "plib_sercom_spi_slave_common.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus // Provide C++ Compatibility
+
+extern "C" {
+
+#endif
+
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Routines
+// *****************************************************************************
+// *****************************************************************************
+
+/* The following functions make up the methods (set of possible operations) of
+this interface.
+*/
+
+// *****************************************************************************
+/* Function:
+    void SERCOM0_SPI_Initialize (void);
+
+  Summary:
+    Initializes instance SERCOM0 operating in SPI slave mode.
+
+  Description:
+    This function initializes instance SERCOM0 operating in SPI slave mode.
+    The receiver is enabled and the received characters are expected to be
+    moved out of the data register by the DMA, which is triggered by the
+    SERCOM0 receive complete event. The slave select low and transmit complete
+    (slave select high) interrupts are used to track the frame boundaries.
+
+  Precondition:
+    The Generic Clock configuration and the SERCOM Peripheral Clock channel
+    should have been configured in the clock manager.
+
+  Parameters:
+    None.
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+        SERCOM0_SPI_Initialize();
+    </code>
+
+  Remarks:
+    This function must be called once before any other SPI function is called.
+*/
+
+void SERCOM0_SPI_Initialize (void);
+
+// *****************************************************************************
+/* Function:
+    bool SERCOM0_SPI_IsBusy (void);
+
+  Summary:
+    Returns the frame status of the SPI slave.
+
+  Description:
+    This function returns true while the master holds the slave select line
+    asserted, that is while a frame is being received.
+
+  Precondition:
+    The SERCOM0_SPI_Initialize function must have been called.
+
+  Parameters:
+    None.
+
+  Returns:
+    true - Slave select is asserted.
+    false - Slave select is de-asserted.
+
+  Example:
+    <code>
+        if (SERCOM0_SPI_IsBusy() == false)
+        {
+            // Frame has ended
+        }
+    </code>
+
+  Remarks:
+    None.
+*/
+
+bool SERCOM0_SPI_IsBusy (void);
+
+// *****************************************************************************
+/* Function:
+    SPI_SLAVE_ERROR SERCOM0_SPI_ErrorGet (void);
+
+  Summary:
+    Returns the errors latched by the SPI slave.
+
+  Description:
+    This function returns the errors latched since the previous call and clears
+    them.
+
+  Precondition:
+    The SERCOM0_SPI_Initialize function must have been called.
+
+  Parameters:
+    None.
+
+  Returns:
+    SPI_SLAVE_ERROR_BUFOVF if a receive overflow occurred, otherwise
+    SPI_SLAVE_ERROR_NONE.
+
+  Example:
+    <code>
+        if (SERCOM0_SPI_ErrorGet() == SPI_SLAVE_ERROR_BUFOVF)
+        {
+            // Data was lost
+        }
+    </code>
+
+  Remarks:
+    None.
+*/
+
+SPI_SLAVE_ERROR SERCOM0_SPI_ErrorGet (void);
+
+// *****************************************************************************
+/* Function:
+    void SERCOM0_SPI_CallbackRegister(const SERCOM_SPI_SLAVE_CALLBACK callBack,
+                                                    uintptr_t context);
+
+  Summary:
+    Allows application to register callback with PLIB.
+
+  Description:
+    This function allows application to register a callback function for the
+    PLIB to call back when the master de-asserts the slave select line or a
+    receive error occurs.
+
+  Precondition:
+    The SERCOM0_SPI_Initialize function must have been called.
+
+  Parameters:
+    callBack - Pointer to the callback function implemented by the user.
+
+    context - The value of parameter will be passed back to the application
+    unchanged, when the callBack function is called.
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+        SERCOM0_SPI_CallbackRegister(&APP_SPISlaveCallback, 0);
+    </code>
+
+  Remarks:
+    None.
+*/
+
+void SERCOM0_SPI_CallbackRegister(SERCOM_SPI_SLAVE_CALLBACK callBack, uintptr_t context);
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus // Provide C++ Compatibility
+
+}
+
+#endif
+
+// DOM-IGNORE-END
+
+#endif //PLIB_SERCOM0_SPI_SLAVE_H
@@ -0,0 +1,177 @@
+/*******************************************************************************
+  SERCOM_SPI(SERIAL COMMUNICATION SERIAL PERIPHERAL INTERFACE) PLIB
+
+  Company
+    Microchip Technology Inc.
+
+  File Name
+    plib_sercom_spi_slave_common.h
+
+  Summary
+   SERCOM_SPI PLIB Slave Local Header File.
+
+  Description
+    This file defines the interface to the SERCOM SPI peripheral library
+    operating in slave mode. This library provides access to and control of
+    the associated peripheral instance.
+
+  Remarks:
+    None.
+
+*******************************************************************************/
+
+// DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+// DOM-IGNORE-END
+
+#ifndef PLIB_SERCOM_SPI_SLAVE_COMMON_H  // Guards against multiple inclusion
+#define PLIB_SERCOM_SPI_SLAVE_COMMON_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <device.h>
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* SPI Slave Errors
+
+  Summary:
+    Defines the errors reported by the SPI slave.
+
+  Description:
+    This enumeration defines the errors reported by the SERCOM SPI slave.
+
+  Remarks:
+    None.
+*/
+
+typedef enum
+{
+    /* No error */
+    SPI_SLAVE_ERROR_NONE = 0U,
+
+    /* Receive buffer overflow. A character was received while the receive
+     * buffer was full. */
+    SPI_SLAVE_ERROR_BUFOVF = SERCOM_SPIS_STATUS_BUFOVF_Msk,
+
+    /* Force the compiler to reserve 32-bit space for each enum value */
+    SPI_SLAVE_ERROR_INVALID = 0xFFFFFFFFU
+
+} SPI_SLAVE_ERROR;
+
+// *****************************************************************************
+/* SPI Slave CallBack Function Pointer
+
+  Summary:
+    Pointer to a SPI slave call back function.
+
+  Description:
+    This data type defines the required function signature for the SPI slave
+    event handling callback function. The callback is called when the master
+    de-asserts the slave select line and when a receive error occurs.
+
+  Parameters:
+    context         - Value identifying the context of the application that
+                      registered the event handling function
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+        SERCOM0_SPI_CallbackRegister(&APP_SPISlaveCallback, 0);
+
+        void APP_SPISlaveCallback(uintptr_t context)
+        {
+            if (SERCOM0_SPI_ErrorGet() != SPI_SLAVE_ERROR_NONE)
+            {
+                // Receive overflow occurred
+            }
+
+            if (SERCOM0_SPI_IsBusy() == false)
+            {
+                // Master de-asserted the slave select line
+            }
+        }
+    </code>
+
+  Remarks:
+    The event handler function executes in the PLIB's interrupt context. It is
+    recommended of the application to not perform process intensive or blocking
+    operations with in this function.
+*/
+
+typedef void (*SERCOM_SPI_SLAVE_CALLBACK)(uintptr_t context);
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local: **** Local SPI Slave Object****
+// *****************************************************************************
+// *****************************************************************************
+
+typedef struct
+{
+    /* Slave select is asserted and a frame is in progress */
+    bool                        transferIsBusy;
+
+    /* Errors latched since the last call to ErrorGet */
+    uint32_t                    errorStatus;
+
+    /* SPI slave event handler */
+    SERCOM_SPI_SLAVE_CALLBACK   callback;
+
+    /* Context */
+    uintptr_t                   context;
+
+} SPI_SLAVE_OBJECT;
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus // Provide C++ Compatibility
+
+    }
+
+#endif
+// DOM-IGNORE-END
+
+#endif //PLIB_SERCOM_SPI_SLAVE_COMMON_H
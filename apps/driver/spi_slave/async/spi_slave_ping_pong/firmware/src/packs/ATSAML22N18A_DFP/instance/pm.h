@@ -0,0 +1,38 @@
+/*
+ * Instance header file for ATSAML22N18A
+ *
+ * Copyright (c) 2022 Microchip Technology Inc. and its subsidiaries.
+ *
+ * Subject to your compliance with these terms, you may use Microchip software and any derivatives
+ * exclusively with Microchip products. It is your responsibility to comply with third party license
+ * terms applicable to your use of third party software (including open source software) that may
+ * accompany Microchip software.
+ *
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY,
+ * APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR CONSEQUENTIAL
+ * LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF
+ * MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE FULLEST EXTENT
+ * ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT
+ * EXCEED THE AMOUNT OF FEES, IF ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ */
+
+/* file generated from device description version 2020-11-19T06:59:39Z */
+#ifndef _SAML22_PM_INSTANCE_
+#define _SAML22_PM_INSTANCE_
+
+
+/* ========== Instance Parameter definitions for PM peripheral ========== */
+#define PM_BIAS_RAM_HS                           (1)        /* one if RAM HS can be back biased */
+#define PM_PD_NUM                                (0)        /* Number of switchable Power Domain */
+#define PM_INSTANCE_ID                           (1)        
+#define PM_HAS_BACKUP_SLEEP                      (1)        /* BACKUP Sleep mode supported */
+#define PM_HAS_OFF_SLEEP                         (1)        /* OFF Sleep mode supported */
+#define PM_HAS_BBIASHS_FIELD                     (1)        /* BBIASHS field is present */
+#define PM_HAS_PLCFG                             (1)        /* Performance Level Configuration supported */
+#define PM_HAS_IORET_BIT                         (1)        /* IORET bit is present */
+
+#endif /* _SAML22_PM_INSTANCE_ */
@@ -0,0 +1,39 @@
+/*
+ * Instance header file for ATSAML22N18A
+ *
+ * Copyright (c) 2022 Microchip Technology Inc. and its subsidiaries.
+ *
+ * Subject to your compliance with these terms, you may use Microchip software and any derivatives
+ * exclusively with Microchip products. It is your responsibility to comply with third party license
+ * terms applicable to your use of third party software (including open source software) that may
+ * accompany Microchip software.
+ *
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY,
+ * APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR CONSEQUENTIAL
+ * LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF
+ * MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE FULLEST EXTENT
+ * ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT
+ * EXCEED THE AMOUNT OF FEES, IF ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ */
+
+/* file generated from device description version 2020-11-19T06:59:39Z */
+#ifndef _SAML22_RTC_INSTANCE_
+#define _SAML22_RTC_INSTANCE_
+
+
+/* ========== Instance Parameter definitions for RTC peripheral ========== */
+#define RTC_ALARM_NUM                            (1)        /* Number of Alarms */
+#define RTC_BKUP_NUM                             (8)        /* Number of Backup Registers */
+#define RTC_COMP16_NUM                           (2)        /* Number of 16-bit Comparators */
+#define RTC_COMP32_NUM                           (1)        /* Number of 32-bit Comparators */
+#define RTC_DMAC_ID_TIMESTAMP                    (1)        /* DMA RTC timestamp trigger */
+#define RTC_GPR_NUM                              (2)        /* Number of General-Purpose Registers */
+#define RTC_PER_NUM                              (8)        /* Number of Periodic Intervals */
+#define RTC_TAMPER_NUM                           (5)        /* Number of Tamper Inputs */
+#define RTC_INSTANCE_ID                          (9)        
+
+#endif /* _SAML22_RTC_INSTANCE_ */
@@ -0,0 +1,45 @@
+/*
+ * Instance header file for ATSAML22N18A
+ *
+ * Copyright (c) 2022 Microchip Technology Inc. and its subsidiaries.
+ *
+ * Subject to your compliance with these terms, you may use Microchip software and any derivatives
+ * exclusively with Microchip products. It is your responsibility to comply with third party license
+ * terms applicable to your use of third party software (including open source software) that may
+ * accompany Microchip software.
+ *
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY,
+ * APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR CONSEQUENTIAL
+ * LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF
+ * MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE FULLEST EXTENT
+ * ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT
+ * EXCEED THE AMOUNT OF FEES, IF ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ */
+
+/* file generated from device description version 2020-11-19T06:59:39Z */
+#ifndef _SAML22_SERCOM0_INSTANCE_
+#define _SAML22_SERCOM0_INSTANCE_
+
+
+/* ========== Instance Parameter definitions for SERCOM0 peripheral ========== */
+#define SERCOM0_DMAC_ID_RX                       (2)        /* Index of DMA RX trigger */
+#define SERCOM0_DMAC_ID_TX                       (3)        /* Index of DMA TX trigger */
+#define SERCOM0_GCLK_ID_CORE                     (16)       
+#define SERCOM0_GCLK_ID_SLOW                     (15)       
+#define SERCOM0_INT_MSB                          (6)        
+#define SERCOM0_PMSB                             (3)        
+#define SERCOM0_SPI                              (1)        /* SPI mode implemented? */
+#define SERCOM0_TWIM                             (0)        /* TWI Master mode implemented? */
+#define SERCOM0_TWIS                             (0)        /* TWI Slave mode implemented? */
+#define SERCOM0_TWI_HSMODE                       (0)        /* TWI HighSpeed mode implemented? */
+#define SERCOM0_USART                            (1)        /* USART mode implemented? */
+#define SERCOM0_USART_ISO7816                    (1)        /* USART ISO7816 mode implemented? */
+#define SERCOM0_USART_LIN_MASTER                 (0)        /* USART LIN Master mode implemented? */
+#define SERCOM0_USART_RS485                      (1)        /* USART RS485 mode implemented? */
+#define SERCOM0_INSTANCE_ID                      (65)       
+
+#endif /* _SAML22_SERCOM0_INSTANCE_ */
@@ -0,0 +1,45 @@
+/*
+ * Instance header file for ATSAML22N18A
+ *
+ * Copyright (c) 2022 Microchip Technology Inc. and its subsidiaries.
+ *
+ * Subject to your compliance with these terms, you may use Microchip software and any derivatives
+ * exclusively with Microchip products. It is your responsibility to comply with third party license
+ * terms applicable to your use of third party software (including open source software) that may
+ * accompany Microchip software.
+ *
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY,
+ * APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR CONSEQUENTIAL
+ * LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF
+ * MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE FULLEST EXTENT
+ * ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT
+ * EXCEED THE AMOUNT OF FEES, IF ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ */
+
+/* file generated from device description version 2020-11-19T06:59:39Z */
+#ifndef _SAML22_SERCOM5_INSTANCE_
+#define _SAML22_SERCOM5_INSTANCE_
+
+
+/* ========== Instance Parameter definitions for SERCOM5 peripheral ========== */
+#define SERCOM5_DMAC_ID_RX                       (12)       /* Index of DMA RX trigger */
+#define SERCOM5_DMAC_ID_TX                       (13)       /* Index of DMA TX trigger */
+#define SERCOM5_GCLK_ID_CORE                     (21)       
+#define SERCOM5_GCLK_ID_SLOW                     (15)       
+#define SERCOM5_INT_MSB                          (3)        
+#define SERCOM5_PMSB                             (3)        
+#define SERCOM5_SPI                              (1)        /* SPI mode implemented? */
+#define SERCOM5_TWIM                             (1)        /* TWI Master mode implemented? */
+#define SERCOM5_TWIS                             (1)        /* TWI Slave mode implemented? */
+#define SERCOM5_TWI_HSMODE                       (1)        /* TWI HighSpeed mode implemented? */
+#define SERCOM5_USART                            (1)        /* USART mode implemented? */
+#define SERCOM5_USART_ISO7816                    (1)        /* USART ISO7816 mode implemented? */
+#define SERCOM5_USART_LIN_MASTER                 (0)        /* USART LIN Master mode implemented? */
+#define SERCOM5_USART_RS485                      (1)        /* USART RS485 mode implemented? */
+#define SERCOM5_INSTANCE_ID                      (70)       
+
+#endif /* _SAML22_SERCOM5_INSTANCE_ */
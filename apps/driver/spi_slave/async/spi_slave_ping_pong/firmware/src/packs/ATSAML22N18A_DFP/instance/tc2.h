@@ -0,0 +1,39 @@
+/*
+ * Instance header file for ATSAML22N18A
+ *
+ * Copyright (c) 2022 Microchip Technology Inc. and its subsidiaries.
+ *
+ * Subject to your compliance with these terms, you may use Microchip software and any derivatives
+ * exclusively with Microchip products. It is your responsibility to comply with third party license
+ * terms applicable to your use of third party software (including open source software) that may
+ * accompany Microchip software.
+ *
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY,
+ * APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR CONSEQUENTIAL
+ * LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF
+ * MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE FULLEST EXTENT
+ * ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT
+ * EXCEED THE AMOUNT OF FEES, IF ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ */
+
+/* file generated from device description version 2020-11-19T06:59:39Z */
+#ifndef _SAML22_TC2_INSTANCE_
+#define _SAML22_TC2_INSTANCE_
+
+
+/* ========== Instance Parameter definitions for TC2 peripheral ========== */
+#define TC2_CC_NUM                               (2)        
+#define TC2_DMAC_ID_OVF                          (25)       /* Indexes of DMA Overflow trigger */
+#define TC2_DMAC_ID_MC0                          (26)       /* Indexes of DMA Match/Compare 0 trigger */
+#define TC2_DMAC_ID_MC1                          (27)       /* Indexes of DMA Match/Compare 1 trigger */
+#define TC2_EXT                                  (0)        
+#define TC2_GCLK_ID                              (24)       
+#define TC2_MASTER_SLAVE_MODE                    (1)        /* TC type 1 : Master, 2 : Slave */
+#define TC2_OW_NUM                               (2)        
+#define TC2_INSTANCE_ID                          (74)       
+
+#endif /* _SAML22_TC2_INSTANCE_ */
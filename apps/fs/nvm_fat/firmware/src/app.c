@@ -54,6 +54,7 @@
 
 #include <string.h>
 #include "app.h"
+#include "definitions.h"
 
 /* This application showcases the File operations with NVM as the media. To
  * begin with the file system image contains a file called "FILE.TXT" with
@@ -75,6 +76,22 @@
  * 11. If there is no error in any of the above steps then the application will
  *     go into Idle state.
  * 12. If there is an error then the application will go into Error state.
+ *
+ * When APP_DMA_BENCHMARK_ENABLE is defined (see app.h), before waiting for the
+ * switch, the application computes the CRC32 of the
+ * first APP_CRC_BENCHMARK_SIZE bytes of the NVM disk three ways: in software,
+ * with the CPU feeding the DMA CRC engine (DMAC_CRCCalculate) and with the
+ * DMA CRC service. The values and the CPU cycles taken by each method are
+ * kept in appData for inspection with the debugger; crcCheckPassed tells
+ * whether the three values match.
+ *
+ * It then copies APP_COPY_BENCHMARK_SIZE_MIN to APP_COPY_BENCHMARK_SIZE_MAX
+ * bytes of the NVM disk to RAM, doubling the size each time, once with
+ * memcpy and once with the DMA memory service. The CPU cycles of each copy
+ * are kept in copyCpuCycles and copyDmaCycles; copyCheckPassed tells whether
+ * every DMA copy matches the source. The sizes where the DMA is faster give
+ * the value of SYS_DMA_MEM_THRESHOLD. The cycles are read from SysTick, which
+ * the DMAC PLIB keeps free running.
  * */
 
 // *****************************************************************************
@@ -92,6 +109,18 @@
 #define WRITE_DATA_SIZE         13
 #define ORIG_DATA_SIZE          4
 
+#if defined(APP_DMA_BENCHMARK_ENABLE)
+/* Number of bytes of the NVM disk checksummed by the CRC benchmark */
+#define APP_CRC_BENCHMARK_SIZE  (4096U)
+
+/* Smallest and largest copy of the memory copy benchmark */
+#define APP_COPY_BENCHMARK_SIZE_MIN     (64U)
+#define APP_COPY_BENCHMARK_SIZE_MAX     (4096U)
+
+/* Destination of the memory copy benchmark */
+static uint8_t __attribute__((aligned(4))) appCopyBuffer[APP_COPY_BENCHMARK_SIZE_MAX];
+#endif
+
 /* This is the string that will written to the file */
 const uint8_t writeData[WRITE_DATA_SIZE] = "Hello World";
 
@@ -123,8 +152,24 @@ APP_DATA appData;
 // *****************************************************************************
 // *****************************************************************************
 
-/* TODO:  Add any necessary callback functions.
-*/
+#if defined(APP_DMA_BENCHMARK_ENABLE)
+static void APP_CRCEventHandler(SYS_DMA_TRANSFER_EVENT event, uint32_t crc, uintptr_t context)
+{
+    appData.crcDmaCycles = (appData.crcDmaStartCount - SysTick->VAL) & SysTick_LOAD_RELOAD_Msk;
+
+    if (event == SYS_DMA_TRANSFER_COMPLETE)
+    {
+        appData.crcDma = crc;
+    }
+
+    appData.crcDmaDone = true;
+}
+
+static void APP_CopyEventHandler(SYS_DMA_TRANSFER_EVENT event, uintptr_t context)
+{
+    appData.copyDmaEvent = event;
+}
+#endif
 
 
 // *****************************************************************************
@@ -133,8 +178,85 @@ APP_DATA appData;
 // *****************************************************************************
 // *****************************************************************************
 
-/* TODO:  Add any necessary local functions.
-*/
+#if defined(APP_DMA_BENCHMARK_ENABLE)
+/* Returns the number of CPU cycles since startCount was read from SysTick */
+static uint32_t APP_CyclesElapsed(uint32_t startCount)
+{
+    return (startCount - SysTick->VAL) & SysTick_LOAD_RELOAD_Msk;
+}
+
+static bool APP_CRCBenchmarkStart(void)
+{
+    const void* buffer = (const void*)DRV_MEMORY_DEVICE_START_ADDRESS;
+    SYS_DMA_CRC_SETUP crcSetup = {SYS_DMA_CRC_TYPE_32, 0xFFFFFFFFU};
+    DMAC_CRC_SETUP dmacCRCSetup = {DMAC_CRC_TYPE_32, 0xFFFFFFFFU};
+    uint32_t startCount;
+
+    /* SysTick is left as the DMAC PLIB started it, free running at the CPU
+     * clock: the DMAC and DRV_SPI statistics read it too */
+    startCount = SysTick->VAL;
+    appData.crcReference = SYS_DMA_CRCReferenceCalculate(buffer, APP_CRC_BENCHMARK_SIZE, crcSetup);
+    appData.crcReferenceCycles = APP_CyclesElapsed(startCount);
+
+    /* The CRC engine is shared with the DMA CRC users (DRV_SPI, DRV_SDSPI) */
+    if (SYS_DMA_CRCEngineAcquire() == true)
+    {
+        startCount = SysTick->VAL;
+        appData.crcCpu = DMAC_CRCCalculate((void*)buffer, APP_CRC_BENCHMARK_SIZE, dmacCRCSetup);
+        appData.crcCpuCycles = APP_CyclesElapsed(startCount);
+
+        SYS_DMA_CRCEngineRelease();
+    }
+
+    appData.crcDmaDone = false;
+    appData.crcDmaStartCount = SysTick->VAL;
+
+    return SYS_DMA_CRCRequestAdd(buffer, APP_CRC_BENCHMARK_SIZE, crcSetup, APP_CRCEventHandler, 0);
+}
+
+/* Times memcpy and the DMA memory service for each size of the benchmark */
+static void APP_CopyBenchmark(void)
+{
+    const uint8_t* source = (const uint8_t*)DRV_MEMORY_DEVICE_START_ADDRESS;
+    uint32_t size = APP_COPY_BENCHMARK_SIZE_MIN;
+    uint32_t startCount;
+    uint32_t i = 0U;
+
+    appData.copyCheckPassed = true;
+
+    while ((size <= APP_COPY_BENCHMARK_SIZE_MAX) && (i < APP_COPY_BENCHMARK_SIZES))
+    {
+        appData.copySize[i] = size;
+
+        startCount = SysTick->VAL;
+        (void) memcpy(appCopyBuffer, source, size);
+        appData.copyCpuCycles[i] = APP_CyclesElapsed(startCount);
+
+        (void) memset(appCopyBuffer, 0, size);
+
+        appData.copyDmaEvent = (SYS_DMA_TRANSFER_EVENT)0;
+        startCount = SysTick->VAL;
+
+        if (SYS_DMA_MemCopyAsync(appCopyBuffer, source, size, APP_CopyEventHandler, 0) == true)
+        {
+            while (appData.copyDmaEvent == (SYS_DMA_TRANSFER_EVENT)0)
+            {
+                /* Wait for the DMA interrupt */
+            }
+        }
+
+        appData.copyDmaCycles[i] = APP_CyclesElapsed(startCount);
+
+        if ((appData.copyDmaEvent != SYS_DMA_TRANSFER_COMPLETE) || (memcmp(appCopyBuffer, source, size) != 0))
+        {
+            appData.copyCheckPassed = false;
+        }
+
+        size <<= 1U;
+        i++;
+    }
+}
+#endif
 
 // *****************************************************************************
 // *****************************************************************************
@@ -152,9 +274,13 @@ APP_DATA appData;
 
 void APP_Initialize ( void )
 {
-    /* Initialize the app state to wait for
-     * media attach. */
+#if defined(APP_DMA_BENCHMARK_ENABLE)
+    /* Check the DMA CRC service, then wait for media attach. */
+    appData.state = APP_CRC_BENCHMARK;
+#else
+    /* Place the App state machine in its initial state. */
     appData.state = APP_SWITCH_PRESS_WAIT;
+#endif
 }
 
 
@@ -172,6 +298,41 @@ void APP_Tasks ( void )
     /* Check the application's current state. */
     switch ( appData.state )
     {
+#if defined(APP_DMA_BENCHMARK_ENABLE)
+        case APP_CRC_BENCHMARK:
+        {
+            if (APP_CRCBenchmarkStart() == true)
+            {
+                appData.state = APP_CRC_BENCHMARK_WAIT;
+            }
+            else
+            {
+                appData.state = APP_COPY_BENCHMARK;
+            }
+            break;
+        }
+
+        case APP_CRC_BENCHMARK_WAIT:
+        {
+            if (appData.crcDmaDone == true)
+            {
+                appData.crcCheckPassed = (appData.crcCpu == appData.crcReference) &&
+                                         (appData.crcDma == appData.crcReference);
+
+                appData.state = APP_COPY_BENCHMARK;
+            }
+            break;
+        }
+
+        case APP_COPY_BENCHMARK:
+        {
+            APP_CopyBenchmark();
+
+            appData.state = APP_SWITCH_PRESS_WAIT;
+            break;
+        }
+#endif
+
         case APP_SWITCH_PRESS_WAIT:
         {
             if (SWITCH_GET() == SWITCH_PRESSED)
@@ -58,6 +58,7 @@
 #include <stdlib.h>
 #include "configuration.h"
 #include "system/fs/sys_fs.h"
+#include "system/dma/sys_dma.h"
 #include "nvm_disk_images.h"
 
 
@@ -76,6 +77,16 @@ extern "C" {
 // *****************************************************************************
 #define BUFFER_SIZE         (64U)
 
+/* Define APP_DMA_BENCHMARK_ENABLE, here or in the project settings, to check
+ * and time the DMA CRC and memory copy services before the demo. The memory
+ * copy benchmark takes a 4 KB buffer. */
+/* #define APP_DMA_BENCHMARK_ENABLE */
+
+#if defined(APP_DMA_BENCHMARK_ENABLE)
+/* Number of sizes timed by the memory copy benchmark, 64 B to 4 KB */
+#define APP_COPY_BENCHMARK_SIZES    (7U)
+#endif
+
 // *****************************************************************************
 /* Application states
 
@@ -92,6 +103,17 @@ typedef enum
     /* The app waits for Switch press */
     APP_SWITCH_PRESS_WAIT = 0,
 
+#if defined(APP_DMA_BENCHMARK_ENABLE)
+    /* The app checks the DMA CRC service and measures its speed */
+    APP_CRC_BENCHMARK,
+
+    /* The app waits for the DMA CRC result */
+    APP_CRC_BENCHMARK_WAIT,
+
+    /* The app compares memcpy and the DMA memory service */
+    APP_COPY_BENCHMARK,
+#endif
+
     /* The app mounts the disk */
     APP_MOUNT_DISK,
 
@@ -169,6 +191,46 @@ typedef struct
 
     long fileSize;
 
+#if defined(APP_DMA_BENCHMARK_ENABLE)
+    /* CRC of the benchmark buffer computed in software, by the CPU feeding
+     * the CRC engine and by the DMA CRC service */
+    uint32_t crcReference;
+
+    uint32_t crcCpu;
+
+    volatile uint32_t crcDma;
+
+    /* CPU cycles taken by each CRC computation */
+    uint32_t crcReferenceCycles;
+
+    uint32_t crcCpuCycles;
+
+    volatile uint32_t crcDmaCycles;
+
+    /* SysTick value at the start of the DMA CRC request */
+    uint32_t crcDmaStartCount;
+
+    /* Set by the DMA CRC callback */
+    volatile bool crcDmaDone;
+
+    /* True if the three CRC values match */
+    bool crcCheckPassed;
+
+    /* Sizes of the memory copy benchmark and the CPU cycles taken by memcpy
+     * and by the DMA memory service to copy them */
+    uint32_t copySize[APP_COPY_BENCHMARK_SIZES];
+
+    uint32_t copyCpuCycles[APP_COPY_BENCHMARK_SIZES];
+
+    uint32_t copyDmaCycles[APP_COPY_BENCHMARK_SIZES];
+
+    /* Set by the DMA memory service callback */
+    volatile SYS_DMA_TRANSFER_EVENT copyDmaEvent;
+
+    /* True if every DMA copy matches its source */
+    bool copyCheckPassed;
+#endif
+
 } APP_DATA;
 
 
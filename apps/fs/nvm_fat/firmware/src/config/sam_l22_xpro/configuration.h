@@ -80,16 +80,32 @@ extern "C" {
 // *****************************************************************************
 // *****************************************************************************
 
+/* DMA Channel Pool Configuration */
+#define SYS_DMA_CHANNEL_POOL_FIRST        SYS_DMA_CHANNEL_2
+#define SYS_DMA_CHANNEL_POOL_SIZE         (2U)
+
+/* DMA CRC Service Configuration */
+#define SYS_DMA_CRC_QUEUE_SIZE            (4U)
+#define SYS_DMA_CRC_PRIORITY              SYS_DMA_PRIORITY_LEVEL_0
+
+/* DMA Memory Service Configuration */
+#define SYS_DMA_MEM_QUEUE_SIZE            (4U)
+#define SYS_DMA_MEM_PRIORITY              SYS_DMA_PRIORITY_LEVEL_1
+#define SYS_DMA_MEM_THRESHOLD             (256U)
+
 /* File System Service Configuration */
 
-#define SYS_FS_MEDIA_NUMBER               (1U)
-#define SYS_FS_VOLUME_NUMBER              (1U)
+#define SYS_FS_MEDIA_NUMBER               (2U)
+#define SYS_FS_VOLUME_NUMBER              (2U)
 
 #define SYS_FS_AUTOMOUNT_ENABLE           false
 #define SYS_FS_MAX_FILES                  (1U)
+#define SYS_FS_FILE_ASYNC_QUEUE_SIZE      (2U)
+#define SYS_FS_FILE_ASYNC_CHUNK_SIZE      (512U)
 #define SYS_FS_MAX_FILE_SYSTEM_TYPE       (1U)
 #define SYS_FS_MEDIA_MAX_BLOCK_SIZE       (512U)
 #define SYS_FS_MEDIA_MANAGER_BUFFER_SIZE  (2048U)
+#define SYS_FS_MEDIA_MANAGER_CACHE_SECTORS (4U)
 #define SYS_FS_USE_LFN                    (1)
 #define SYS_FS_FILE_NAME_LEN              (255U)
 #define SYS_FS_CWD_STRING_LEN             (1024)
@@ -123,8 +139,37 @@ extern "C" {
 #define DRV_MEMORY_DEVICE_PROGRAM_SIZE       64U
 #define DRV_MEMORY_DEVICE_ERASE_SIZE         256U
 
+/* Memory Driver Instance 0 Flash Translation Layer Configuration */
+#define DRV_MEMORY_FTL_ENABLE
+#define DRV_MEMORY_FTL_SECTORS_IDX0          (192U)
+#define DRV_MEMORY_FTL_JOURNAL_BLOCKS_IDX0   (16U)
+
+/* SPI Driver Instance 0 Configuration Options */
+#define DRV_SPI_INDEX_0                       0
+#define DRV_SPI_CLIENTS_NUMBER_IDX0           1
+#define DRV_SPI_DMA_MODE
+#define DRV_SPI_XMIT_DMA_CH_IDX0              SYS_DMA_CHANNEL_1
+#define DRV_SPI_RCV_DMA_CH_IDX0               SYS_DMA_CHANNEL_0
+#define DRV_SPI_QUEUE_SIZE_IDX0               4
+
+/* SPI Driver Common Configuration Options */
+#define DRV_SPI_INSTANCES_NUMBER              (1U)
+#define DRV_SPI_PRIORITY_AGING_STEP           (4U)
+
+/* SPI NOR Flash Driver Configuration Options */
+#define DRV_SPI_NOR_INDEX                     0
+#define DRV_SPI_NOR_INSTANCES_NUMBER          (1U)
+#define DRV_SPI_NOR_CLOCK_SPEED_HZ            8000000U
+#define DRV_SPI_NOR_FLASH_SIZE_BYTES          (2048UL * 1024UL)
+#define DRV_SPI_NOR_ERASE_BUFFER_SIZE         4096U
+
+/* Memory Driver Instance 1 Configuration */
+#define DRV_MEMORY_INDEX_1                   1
+#define DRV_MEMORY_CLIENTS_NUMBER_IDX1       1
+#define DRV_MEMORY_BUF_Q_SIZE_IDX1    1
+
 /* Memory Driver Global Configuration Options */
-#define DRV_MEMORY_INSTANCES_NUMBER          (1U)
+#define DRV_MEMORY_INSTANCES_NUMBER          (2U)
 
 
 // *****************************************************************************
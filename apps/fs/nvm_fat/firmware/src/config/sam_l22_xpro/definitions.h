@@ -51,6 +51,12 @@
 #include "peripheral/nvmctrl/plib_nvmctrl.h"
 #include "driver/memory/drv_memory_nvmctrl.h"
 #include "peripheral/evsys/plib_evsys.h"
+#include "peripheral/sercom/spi_master/plib_sercom1_spi_master.h"
+#include "peripheral/dmac/plib_dmac.h"
+#include "driver/spi/drv_spi.h"
+#include "driver/spi_nor/drv_spi_nor.h"
+#include "system/ports/sys_ports.h"
+#include "system/dma/sys_dma.h"
 #include "system/fs/sys_fs.h"
 #include "system/fs/sys_fs_media_manager.h"
 #include "system/fs/sys_fs_fat_interface.h"
@@ -198,6 +204,11 @@ Remarks:
 typedef struct
 {
     SYS_MODULE_OBJ  drvMemory0;
+    SYS_MODULE_OBJ  drvSPI0;
+
+    SYS_MODULE_OBJ  drvSpiNor;
+
+    SYS_MODULE_OBJ  drvMemory1;
 
 } SYSTEM_OBJECTS;
 
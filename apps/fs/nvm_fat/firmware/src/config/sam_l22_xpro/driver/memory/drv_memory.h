@@ -1762,7 +1762,9 @@ bool DRV_MEMORY_IsWriteProtected
     </code>
 
   Remarks:
-    None.
+    When the instance uses the flash translation layer, the address is only the
+    base of the logical address space. The logical sectors are not stored at
+    fixed physical addresses and must not be accessed through it.
 */
 
 uintptr_t DRV_MEMORY_AddressGet
@@ -1770,6 +1772,63 @@ uintptr_t DRV_MEMORY_AddressGet
     const DRV_HANDLE handle
 );
 
+// *****************************************************************************
+/* Function:
+    uintptr_t DRV_MEMORY_BlockAddressGet
+    (
+        const DRV_HANDLE handle,
+        uint32_t blockStart,
+        uint32_t *nBlock
+    );
+
+  Summary:
+    Returns the memory address of a range of read blocks
+
+  Description:
+    This function returns the address at which the CPU can read the read
+    blocks starting at blockStart. On return nBlock holds the number of blocks
+    that are contiguous in memory from the returned address.
+
+  Precondition:
+    The DRV_MEMORY_Open() routine must have been called to obtain a valid opened
+    device handle.
+
+  Parameters:
+    handle       - A valid open-instance handle, returned from the driver's
+                   open function
+
+    blockStart   - First read block of the range
+
+    nBlock       - Pointer to the number of read blocks of the range
+
+  Returns:
+    Memory address of the first block, or 0 if the handle is invalid, the range
+    is outside the media or the first block does not hold any data.
+
+  Example:
+    <code>
+
+    uint32_t nBlock = 1024;
+    const uint8_t *data;
+
+    data = (const uint8_t *)DRV_MEMORY_BlockAddressGet(drvMEMORYHandle, 0, &nBlock);
+
+    </code>
+
+  Remarks:
+    The address is only meaningful for memory mapped devices. When the instance
+    uses the flash translation layer, the range ends at the first sector that
+    is not held in the slot following the previous one. The address stays
+    valid until the blocks are written or erased.
+*/
+
+uintptr_t DRV_MEMORY_BlockAddressGet
+(
+    const DRV_HANDLE handle,
+    uint32_t blockStart,
+    uint32_t *nBlock
+);
+
 // *****************************************************************************
 /* Function:
     void DRV_MEMORY_Erase
@@ -235,6 +235,9 @@ typedef struct
     /* Maximum number of clients */
     size_t nClientsMax;
 
+    /* Flash translation layer object, 0 if the instance does not use it */
+    uintptr_t ftlObj;
+
 } DRV_MEMORY_INIT;
 
 #ifdef __cplusplus
@@ -50,6 +50,12 @@
 #include "driver/memory/src/drv_memory_local.h"
 #include "system/debug/sys_debug.h"
 #include "driver/memory/src/drv_memory_file_system.h"
+#if defined(SYS_DMA_MEM_QUEUE_SIZE)
+#include "system/dma/sys_dma.h"
+#endif
+#if defined(DRV_MEMORY_FTL_ENABLE)
+#include "driver/memory/src/drv_memory_ftl.h"
+#endif
 
 // *****************************************************************************
 // *****************************************************************************
@@ -109,6 +115,18 @@ static const DRV_MEMORY_TransferOperation gMemoryXferFuncPtr[4] =
     DRV_MEMORY_HandleEraseWrite,
 };
 
+#if defined(DRV_MEMORY_FTL_ENABLE)
+/* Erase write needs no read-modify-write cycle when sectors are written out of
+ * place. */
+static const DRV_MEMORY_TransferOperation gMemoryFtlXferFuncPtr[4] =
+{
+    DRV_MEMORY_FTL_HandleRead,
+    DRV_MEMORY_FTL_HandleWrite,
+    DRV_MEMORY_FTL_HandleErase,
+    DRV_MEMORY_FTL_HandleWrite,
+};
+#endif
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: MEMORY Driver Local Functions
@@ -351,6 +369,14 @@ static bool DRV_MEMORY_UpdateGeometry( DRV_MEMORY_OBJECT *dObj )
 
     dObj->blockStartAddress = memoryDeviceGeometry.blockStartAddress;
 
+#if defined(DRV_MEMORY_FTL_ENABLE)
+    if (dObj->ftl != NULL)
+    {
+        /* Rebuild the sector map and expose the logical geometry instead */
+        return DRV_MEMORY_FTL_Mount(dObj);
+    }
+#endif
+
     return true;
 }
 /* MISRA C-2012 Rule 16.1, 16.3, 16.5, 16.6 deviated below.Deviation record ID -
@@ -595,7 +621,11 @@ static MEMORY_DEVICE_TRANSFER_STATUS DRV_MEMORY_HandleEraseWrite
                 /* Find the offset from which the data is to be overlaid. */
                 dObj->blockOffsetInSector *= dObj->writeBlockSize;
 
+#if defined(SYS_DMA_MEM_QUEUE_SIZE)
+                (void) SYS_DMA_MemCopy ((void *)&dObj->ewBuffer[dObj->blockOffsetInSector], (const void *)bufferObj->buffer, dObj->nBlocksToWrite * dObj->writeBlockSize);
+#else
                 (void) memcpy ((void *)&dObj->ewBuffer[dObj->blockOffsetInSector], (const void *)bufferObj->buffer, dObj->nBlocksToWrite * dObj->writeBlockSize);
+#endif
 
                 dObj->ewState = DRV_MEMORY_EW_ERASE_SECTOR;
 
@@ -791,6 +821,10 @@ SYS_MODULE_OBJ DRV_MEMORY_Initialize
     /* Set the erase buffer */
     dObj->ewBuffer = memoryInit->ewBuffer;
 
+#if defined(DRV_MEMORY_FTL_ENABLE)
+    dObj->ftl = (DRV_MEMORY_FTL_OBJECT *)memoryInit->ftlObj;
+#endif
+
     dObj->state = DRV_MEMORY_PROCESS_QUEUE;
 
     if (OSAL_MUTEX_Create(&dObj->clientMutex) == OSAL_RESULT_FAIL)
@@ -1143,6 +1177,7 @@ void DRV_MEMORY_Tasks( SYS_MODULE_OBJ object )
     DRV_MEMORY_EVENT event = DRV_MEMORY_EVENT_COMMAND_ERROR;
     bool isDone = false;
     MEMORY_DEVICE_TRANSFER_STATUS transferStatus = MEMORY_DEVICE_TRANSFER_ERROR_UNKNOWN;
+    const DRV_MEMORY_TransferOperation *xferFuncPtr = gMemoryXferFuncPtr;
 
     if(object == SYS_MODULE_OBJ_INVALID)
     {
@@ -1179,6 +1214,14 @@ void DRV_MEMORY_Tasks( SYS_MODULE_OBJ object )
             {
                 /* Queue is empty. Continue to remain in the same state. */
                 dObj->queueTail = NULL;
+
+#if defined(DRV_MEMORY_FTL_ENABLE)
+                if (dObj->ftl != NULL)
+                {
+                    /* Use the idle time to erase stale slots and checkpoint */
+                    DRV_MEMORY_FTL_Tasks(dObj);
+                }
+#endif
                 break;
             }
             else
@@ -1188,6 +1231,12 @@ void DRV_MEMORY_Tasks( SYS_MODULE_OBJ object )
                 dObj->writeState = DRV_MEMORY_WRITE_INIT;
                 dObj->eraseState = DRV_MEMORY_ERASE_INIT;
                 dObj->ewState    = DRV_MEMORY_EW_INIT;
+#if defined(DRV_MEMORY_FTL_ENABLE)
+                if (dObj->ftl != NULL)
+                {
+                    dObj->ftl->xferState = DRV_MEMORY_FTL_XFER_INIT;
+                }
+#endif
 
                 dObj->state = DRV_MEMORY_TRANSFER;
 
@@ -1199,7 +1248,14 @@ void DRV_MEMORY_Tasks( SYS_MODULE_OBJ object )
         {
             bufferObj = dObj->currentBufObj;
 
-            transferStatus = gMemoryXferFuncPtr[bufferObj->opType](dObj, &bufferObj->buffer[0], bufferObj->blockStart, bufferObj->nBlocks);
+#if defined(DRV_MEMORY_FTL_ENABLE)
+            if (dObj->ftl != NULL)
+            {
+                xferFuncPtr = gMemoryFtlXferFuncPtr;
+            }
+#endif
+
+            transferStatus = xferFuncPtr[bufferObj->opType](dObj, &bufferObj->buffer[0], bufferObj->blockStart, bufferObj->nBlocks);
 
             if (transferStatus == MEMORY_DEVICE_TRANSFER_COMPLETED)
             {
@@ -1355,3 +1411,63 @@ uintptr_t DRV_MEMORY_AddressGet
 
     return dObj->blockStartAddress;
 }
+
+uintptr_t DRV_MEMORY_BlockAddressGet
+(
+    const DRV_HANDLE handle,
+    uint32_t blockStart,
+    uint32_t *nBlock
+)
+{
+    DRV_MEMORY_CLIENT_OBJECT *clientObj = NULL;
+    DRV_MEMORY_OBJECT *dObj = NULL;
+    uintptr_t address = 0U;
+    uint32_t numBlocks = 0U;
+
+    /* Get the Client object from the handle passed */
+    clientObj = DRV_MEMORY_DriverHandleValidate(handle);
+
+    /* Check if the client object is valid */
+    if ((clientObj == NULL) || (nBlock == NULL))
+    {
+        SYS_DEBUG_MESSAGE(SYS_ERROR_INFO, "DRV_MEMORY_BlockAddressGet(): Invalid parameters.\n");
+        return (0U);
+    }
+
+    dObj = &gDrvMemoryObj[clientObj->drvIndex];
+
+    numBlocks = dObj->mediaGeometryTable[SYS_MEDIA_GEOMETRY_TABLE_READ_ENTRY].numBlocks;
+
+    if (blockStart >= numBlocks)
+    {
+        *nBlock = 0U;
+        return (0U);
+    }
+
+    if (*nBlock > (numBlocks - blockStart))
+    {
+        *nBlock = numBlocks - blockStart;
+    }
+
+#if defined(DRV_MEMORY_FTL_ENABLE)
+    if (dObj->ftl != NULL)
+    {
+        /* The map must not change while it is looked up */
+        if (OSAL_MUTEX_Lock(&dObj->transferMutex, OSAL_WAIT_FOREVER) == OSAL_RESULT_SUCCESS)
+        {
+            address = DRV_MEMORY_FTL_AddressGet(dObj, blockStart, nBlock);
+            (void) OSAL_MUTEX_Unlock(&dObj->transferMutex);
+        }
+        else
+        {
+            *nBlock = 0U;
+        }
+
+        return address;
+    }
+#endif
+
+    address = dObj->blockStartAddress + (blockStart * dObj->mediaGeometryTable[SYS_MEDIA_GEOMETRY_TABLE_READ_ENTRY].blockSize);
+
+    return address;
+}
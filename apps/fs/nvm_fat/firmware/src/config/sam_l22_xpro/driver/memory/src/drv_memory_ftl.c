@@ -0,0 +1,1062 @@
+/******************************************************************************
+  MEMORY Driver Flash Translation Layer Implementation
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    drv_memory_ftl.c
+
+  Summary:
+    MEMORY Driver Flash Translation Layer Implementation
+
+  Description:
+    This file implements the optional flash translation layer of the MEMORY
+    driver.
+
+    The media is split into a data area made of sector sized slots and two
+    journal areas at the end of the media. Every sector write programs an
+    erased slot and then appends a journal record mapping the logical sector to
+    that slot. The record is the commit point, a write interrupted by a power
+    loss leaves the previous copy of the sector mapped. When the active journal
+    area fills up, the complete map is written as a checkpoint to the other
+    area, which then becomes the active one.
+
+    On mount the newest valid checkpoint is loaded and its journal is replayed.
+    A media without any checkpoint is adopted with an identity map, so an
+    existing image programmed 1:1 at the media start address stays readable.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Include Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include "driver/memory/src/drv_memory_ftl.h"
+#include "system/debug/sys_debug.h"
+
+#if defined(DRV_MEMORY_FTL_ENABLE)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Data
+// *****************************************************************************
+// *****************************************************************************
+
+/* FNV-1a parameters used for the record and checkpoint checksums */
+#define DRV_MEMORY_FTL_CHECK_OFFSET                     (2166136261U)
+#define DRV_MEMORY_FTL_CHECK_PRIME                      (16777619U)
+
+#define DRV_MEMORY_FTL_AREA_NONE                        (0xFFU)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: MEMORY Driver Flash Translation Layer Local Functions
+// *****************************************************************************
+// *****************************************************************************
+
+static uint32_t DRV_MEMORY_FTL_Checksum
+(
+    uint32_t check,
+    const uint8_t *data,
+    uint32_t size
+)
+{
+    uint32_t i;
+
+    for (i = 0U; i < size; i++)
+    {
+        check ^= data[i];
+        check *= DRV_MEMORY_FTL_CHECK_PRIME;
+    }
+
+    return check;
+}
+
+static inline bool DRV_MEMORY_FTL_BitGet( const uint32_t *bitmap, uint32_t index )
+{
+    return ((bitmap[index >> 5U] & (1UL << (index & 31U))) != 0U);
+}
+
+static inline void DRV_MEMORY_FTL_BitSet( uint32_t *bitmap, uint32_t index )
+{
+    bitmap[index >> 5U] |= (1UL << (index & 31U));
+}
+
+static inline void DRV_MEMORY_FTL_BitClear( uint32_t *bitmap, uint32_t index )
+{
+    bitmap[index >> 5U] &= ~(1UL << (index & 31U));
+}
+
+static inline uint32_t *DRV_MEMORY_FTL_FreeMap( DRV_MEMORY_FTL_OBJECT *ftl )
+{
+    return &ftl->slotMap[0];
+}
+
+static inline uint32_t *DRV_MEMORY_FTL_StaleMap( DRV_MEMORY_FTL_OBJECT *ftl )
+{
+    return &ftl->slotMap[ftl->slotMapWords];
+}
+
+static inline uint32_t DRV_MEMORY_FTL_SlotAddress( const DRV_MEMORY_OBJECT *dObj, uint32_t slot )
+{
+    return (dObj->blockStartAddress + (slot * DRV_MEMORY_FTL_SECTOR_SIZE));
+}
+
+static MEMORY_DEVICE_TRANSFER_STATUS DRV_MEMORY_FTL_DeviceStatus( const DRV_MEMORY_OBJECT *dObj )
+{
+    return (MEMORY_DEVICE_TRANSFER_STATUS)(uint32_t)(dObj->memoryDevice->TransferStatusGet(dObj->memDevHandle));
+}
+
+/* Finds the next slot set in the bitmap, starting at the cursor. The cursor
+ * moves past the slot found so that the slots are used in a round robin
+ * fashion, which spreads the erase cycles over the whole data area. */
+static bool DRV_MEMORY_FTL_SlotFind
+(
+    const DRV_MEMORY_FTL_OBJECT *ftl,
+    const uint32_t *bitmap,
+    uint32_t *cursor,
+    uint32_t *slot
+)
+{
+    uint32_t i;
+    uint32_t index = *cursor;
+
+    for (i = 0U; i < ftl->nSlots; i++)
+    {
+        if (index >= ftl->nSlots)
+        {
+            index = 0U;
+        }
+
+        if (DRV_MEMORY_FTL_BitGet(bitmap, index) == true)
+        {
+            *slot = index;
+            *cursor = index + 1U;
+            return true;
+        }
+
+        index++;
+    }
+
+    return false;
+}
+
+/* Reads one page into the page buffer. Only used while mounting. */
+static bool DRV_MEMORY_FTL_PageRead( DRV_MEMORY_OBJECT *dObj, uint32_t address )
+{
+    MEMORY_DEVICE_TRANSFER_STATUS transferStatus;
+
+    if (dObj->memoryDevice->Read(dObj->memDevHandle, (void *)dObj->ftl->pageBuffer, dObj->writeBlockSize, address) == false)
+    {
+        return false;
+    }
+
+    do
+    {
+        transferStatus = DRV_MEMORY_FTL_DeviceStatus(dObj);
+    } while (transferStatus == MEMORY_DEVICE_TRANSFER_BUSY);
+
+    return (transferStatus == MEMORY_DEVICE_TRANSFER_COMPLETED);
+}
+
+static bool DRV_MEMORY_FTL_PageIsBlank( const DRV_MEMORY_OBJECT *dObj )
+{
+    uint32_t i;
+
+    for (i = 0U; i < dObj->writeBlockSize; i++)
+    {
+        if (dObj->ftl->pageBuffer[i] != 0xFFU)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/* A range that cannot be read is reported as not blank, so that it gets
+ * erased before it is used. */
+static bool DRV_MEMORY_FTL_RangeIsBlank( DRV_MEMORY_OBJECT *dObj, uint32_t address, uint32_t size )
+{
+    uint32_t offset;
+
+    for (offset = 0U; offset < size; offset += dObj->writeBlockSize)
+    {
+        if ((DRV_MEMORY_FTL_PageRead(dObj, address + offset) == false) || (DRV_MEMORY_FTL_PageIsBlank(dObj) == false))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static bool DRV_MEMORY_FTL_CheckpointRead
+(
+    DRV_MEMORY_OBJECT *dObj,
+    uint8_t area,
+    DRV_MEMORY_FTL_CHECKPOINT *header
+)
+{
+    DRV_MEMORY_FTL_OBJECT *ftl = dObj->ftl;
+
+    if (DRV_MEMORY_FTL_PageRead(dObj, ftl->areaAddress[area]) == false)
+    {
+        return false;
+    }
+
+    (void) memcpy((void *)header, (const void *)ftl->pageBuffer, sizeof(DRV_MEMORY_FTL_CHECKPOINT));
+
+    return ((header->magic == DRV_MEMORY_FTL_CHECKPOINT_MAGIC) &&
+            (header->nSectors == ftl->nSectors) &&
+            (header->check == DRV_MEMORY_FTL_Checksum(DRV_MEMORY_FTL_CHECK_OFFSET, (const uint8_t *)header, sizeof(DRV_MEMORY_FTL_CHECKPOINT) - sizeof(uint32_t))));
+}
+
+static bool DRV_MEMORY_FTL_MapLoad
+(
+    DRV_MEMORY_OBJECT *dObj,
+    uint8_t area,
+    const DRV_MEMORY_FTL_CHECKPOINT *header
+)
+{
+    DRV_MEMORY_FTL_OBJECT *ftl = dObj->ftl;
+    uint8_t *map = (uint8_t *)ftl->map;
+    uint32_t mapSize = ftl->nSectors * sizeof(uint16_t);
+    uint32_t offset = 0U;
+    uint32_t length = 0U;
+    uint32_t page;
+    uint32_t sector;
+
+    for (page = 0U; page < ftl->mapPages; page++)
+    {
+        if (DRV_MEMORY_FTL_PageRead(dObj, ftl->areaAddress[area] + ((page + 1U) * dObj->writeBlockSize)) == false)
+        {
+            return false;
+        }
+
+        length = mapSize - offset;
+
+        if (length > dObj->writeBlockSize)
+        {
+            length = dObj->writeBlockSize;
+        }
+
+        (void) memcpy((void *)&map[offset], (const void *)ftl->pageBuffer, length);
+        offset += length;
+    }
+
+    if (DRV_MEMORY_FTL_Checksum(DRV_MEMORY_FTL_CHECK_OFFSET, map, mapSize) != header->mapCheck)
+    {
+        return false;
+    }
+
+    for (sector = 0U; sector < ftl->nSectors; sector++)
+    {
+        if ((ftl->map[sector] != DRV_MEMORY_FTL_SLOT_UNMAPPED) && (ftl->map[sector] >= ftl->nSlots))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/* Applies the records of the active journal area to the map and finds the
+ * first free page. Records that fail the checks were torn by a power loss and
+ * are skipped. */
+static void DRV_MEMORY_FTL_Replay( DRV_MEMORY_OBJECT *dObj )
+{
+    DRV_MEMORY_FTL_OBJECT *ftl = dObj->ftl;
+    DRV_MEMORY_FTL_RECORD record;
+    uint32_t index = ftl->mapPages + 1U;
+    uint32_t sector;
+    uint32_t slot;
+
+    while (index < ftl->pagesPerArea)
+    {
+        if (DRV_MEMORY_FTL_PageRead(dObj, ftl->areaAddress[ftl->activeArea] + (index * dObj->writeBlockSize)) == false)
+        {
+            /* Do not append to a journal that cannot be read back */
+            index = ftl->pagesPerArea;
+            break;
+        }
+
+        if (DRV_MEMORY_FTL_PageIsBlank(dObj) == true)
+        {
+            break;
+        }
+
+        (void) memcpy((void *)&record, (const void *)ftl->pageBuffer, sizeof(DRV_MEMORY_FTL_RECORD));
+
+        sector = record.mapping >> 16U;
+        slot = record.mapping & 0xFFFFU;
+
+        if ((record.magic == DRV_MEMORY_FTL_RECORD_MAGIC) &&
+            (record.generation == ftl->generation) &&
+            (record.check == DRV_MEMORY_FTL_Checksum(DRV_MEMORY_FTL_CHECK_OFFSET, (const uint8_t *)&record, sizeof(DRV_MEMORY_FTL_RECORD) - sizeof(uint32_t))) &&
+            (sector < ftl->nSectors) &&
+            ((slot < ftl->nSlots) || (slot == DRV_MEMORY_FTL_SLOT_UNMAPPED)))
+        {
+            ftl->map[sector] = (uint16_t)slot;
+        }
+
+        index++;
+    }
+
+    ftl->journalIndex = index;
+}
+
+/* Starts the maintenance operation the layer needs most. In the foreground
+ * only the operations blocking the next sector update are started. Returns
+ * false if there is nothing to do. */
+static bool DRV_MEMORY_FTL_GcStart
+(
+    DRV_MEMORY_OBJECT *dObj,
+    bool isForeground,
+    bool isSlotNeeded
+)
+{
+    DRV_MEMORY_FTL_OBJECT *ftl = dObj->ftl;
+    uint32_t threshold = ftl->pagesPerArea - ((ftl->pagesPerArea - ftl->mapPages - 1U) / 4U);
+    DRV_MEMORY_FTL_GC_STATE gcState = DRV_MEMORY_FTL_GC_IDLE;
+
+    if (isForeground == true)
+    {
+        if (ftl->journalIndex >= ftl->pagesPerArea)
+        {
+            gcState = (ftl->isInactiveErased == true) ? DRV_MEMORY_FTL_GC_CHECKPOINT : DRV_MEMORY_FTL_GC_ERASE_AREA;
+        }
+        else if ((isSlotNeeded == true) && (ftl->freeSlots == 0U))
+        {
+            gcState = DRV_MEMORY_FTL_GC_ERASE_SLOT;
+        }
+        else
+        {
+            /* Nothing to do */
+        }
+    }
+    else
+    {
+        /* Keep the inactive area erased so that the next checkpoint only
+         * programs pages. */
+        if (ftl->isInactiveErased == false)
+        {
+            gcState = DRV_MEMORY_FTL_GC_ERASE_AREA;
+        }
+        else if (ftl->journalIndex >= threshold)
+        {
+            gcState = DRV_MEMORY_FTL_GC_CHECKPOINT;
+        }
+        else if (ftl->staleSlots != 0U)
+        {
+            gcState = DRV_MEMORY_FTL_GC_ERASE_SLOT;
+        }
+        else
+        {
+            /* Nothing to do */
+        }
+    }
+
+    if (gcState == DRV_MEMORY_FTL_GC_ERASE_SLOT)
+    {
+        if (DRV_MEMORY_FTL_SlotFind(ftl, DRV_MEMORY_FTL_StaleMap(ftl), &ftl->gcCursor, &ftl->gcSlot) == false)
+        {
+            gcState = DRV_MEMORY_FTL_GC_IDLE;
+        }
+    }
+
+    ftl->gcState = gcState;
+    ftl->gcIndex = 0U;
+
+    return (gcState != DRV_MEMORY_FTL_GC_IDLE);
+}
+
+/* Advances the current maintenance operation by one device operation. Returns
+ * MEMORY_DEVICE_TRANSFER_COMPLETED once the operation has finished. */
+static MEMORY_DEVICE_TRANSFER_STATUS DRV_MEMORY_FTL_GcStep( DRV_MEMORY_OBJECT *dObj )
+{
+    DRV_MEMORY_FTL_OBJECT *ftl = dObj->ftl;
+    DRV_MEMORY_FTL_CHECKPOINT header;
+    uint32_t inactiveAddress = ftl->areaAddress[ftl->activeArea ^ 1U];
+    uint32_t mapSize = ftl->nSectors * sizeof(uint16_t);
+    uint32_t offset = 0U;
+    uint32_t length = 0U;
+    bool isIssued = false;
+    MEMORY_DEVICE_TRANSFER_STATUS transferStatus = DRV_MEMORY_FTL_DeviceStatus(dObj);
+
+    if (transferStatus == MEMORY_DEVICE_TRANSFER_BUSY)
+    {
+        return transferStatus;
+    }
+
+    if (transferStatus != MEMORY_DEVICE_TRANSFER_COMPLETED)
+    {
+        /* The previous operation failed. Give up, it is retried later. */
+        ftl->gcState = DRV_MEMORY_FTL_GC_IDLE;
+        return MEMORY_DEVICE_TRANSFER_ERROR_UNKNOWN;
+    }
+
+    switch (ftl->gcState)
+    {
+        case DRV_MEMORY_FTL_GC_ERASE_AREA:
+        {
+            /* The first block holds the checkpoint header and is erased first,
+             * which invalidates the area before the rest of it is erased. */
+            if (ftl->gcIndex < ftl->journalBlocks)
+            {
+                dObj->isTransferDone = false;
+                isIssued = dObj->memoryDevice->SectorErase(dObj->memDevHandle, inactiveAddress + (ftl->gcIndex * dObj->eraseBlockSize));
+                ftl->gcIndex++;
+            }
+            else
+            {
+                ftl->isInactiveErased = true;
+                ftl->gcState = DRV_MEMORY_FTL_GC_IDLE;
+            }
+            break;
+        }
+
+        case DRV_MEMORY_FTL_GC_CHECKPOINT:
+        {
+            /* The map pages are programmed first. The header page commits the
+             * checkpoint, after which the journal moves to this area. */
+            if (ftl->gcIndex < ftl->mapPages)
+            {
+                offset = ftl->gcIndex * dObj->writeBlockSize;
+                length = mapSize - offset;
+
+                if (length > dObj->writeBlockSize)
+                {
+                    length = dObj->writeBlockSize;
+                }
+
+                (void) memset((void *)ftl->pageBuffer, 0xFF, dObj->writeBlockSize);
+                (void) memcpy((void *)ftl->pageBuffer, (const void *)&((const uint8_t *)ftl->map)[offset], length);
+
+                dObj->isTransferDone = false;
+                isIssued = dObj->memoryDevice->PageWrite(dObj->memDevHandle, (void *)ftl->pageBuffer, inactiveAddress + (offset + dObj->writeBlockSize));
+                ftl->gcIndex++;
+            }
+            else if (ftl->gcIndex == ftl->mapPages)
+            {
+                header.magic = DRV_MEMORY_FTL_CHECKPOINT_MAGIC;
+                header.generation = ftl->generation + 1U;
+                header.nSectors = ftl->nSectors;
+                header.mapCheck = DRV_MEMORY_FTL_Checksum(DRV_MEMORY_FTL_CHECK_OFFSET, (const uint8_t *)ftl->map, mapSize);
+                header.check = DRV_MEMORY_FTL_Checksum(DRV_MEMORY_FTL_CHECK_OFFSET, (const uint8_t *)&header, sizeof(DRV_MEMORY_FTL_CHECKPOINT) - sizeof(uint32_t));
+
+                (void) memset((void *)ftl->pageBuffer, 0xFF, dObj->writeBlockSize);
+                (void) memcpy((void *)ftl->pageBuffer, (const void *)&header, sizeof(DRV_MEMORY_FTL_CHECKPOINT));
+
+                dObj->isTransferDone = false;
+                isIssued = dObj->memoryDevice->PageWrite(dObj->memDevHandle, (void *)ftl->pageBuffer, inactiveAddress);
+                ftl->gcIndex++;
+            }
+            else
+            {
+                ftl->activeArea ^= 1U;
+                ftl->generation++;
+                ftl->journalIndex = ftl->mapPages + 1U;
+                ftl->isInactiveErased = false;
+                ftl->gcState = DRV_MEMORY_FTL_GC_IDLE;
+            }
+            break;
+        }
+
+        case DRV_MEMORY_FTL_GC_ERASE_SLOT:
+        {
+            if (ftl->gcIndex < (DRV_MEMORY_FTL_SECTOR_SIZE / dObj->eraseBlockSize))
+            {
+                dObj->isTransferDone = false;
+                isIssued = dObj->memoryDevice->SectorErase(dObj->memDevHandle, DRV_MEMORY_FTL_SlotAddress(dObj, ftl->gcSlot) + (ftl->gcIndex * dObj->eraseBlockSize));
+                ftl->gcIndex++;
+            }
+            else
+            {
+                DRV_MEMORY_FTL_BitClear(DRV_MEMORY_FTL_StaleMap(ftl), ftl->gcSlot);
+                DRV_MEMORY_FTL_BitSet(DRV_MEMORY_FTL_FreeMap(ftl), ftl->gcSlot);
+                ftl->staleSlots--;
+                ftl->freeSlots++;
+                ftl->gcState = DRV_MEMORY_FTL_GC_IDLE;
+            }
+            break;
+        }
+
+        case DRV_MEMORY_FTL_GC_IDLE:
+        default:
+        {
+            /* Nothing to do */
+            break;
+        }
+    }
+
+    if (ftl->gcState == DRV_MEMORY_FTL_GC_IDLE)
+    {
+        return MEMORY_DEVICE_TRANSFER_COMPLETED;
+    }
+
+    if (isIssued == false)
+    {
+        ftl->gcState = DRV_MEMORY_FTL_GC_IDLE;
+        return MEMORY_DEVICE_TRANSFER_ERROR_UNKNOWN;
+    }
+
+    return MEMORY_DEVICE_TRANSFER_BUSY;
+}
+
+/* Moves to the next sector of the request. Returns true when the request is
+ * complete. */
+static bool DRV_MEMORY_FTL_SectorNext( DRV_MEMORY_FTL_OBJECT *ftl, bool isTrim )
+{
+    ftl->position++;
+    ftl->remaining--;
+
+    if (isTrim == false)
+    {
+        ftl->dataPtr += DRV_MEMORY_FTL_SECTOR_SIZE;
+    }
+
+    ftl->xferState = DRV_MEMORY_FTL_XFER_PREPARE;
+
+    return (ftl->remaining == 0U);
+}
+
+/* MISRA C-2012 Rule 16.1, 16.3, 16.5, 16.6 deviated below.Deviation record ID -
+  H3_MISRAC_2012_R_16_1_DR_1, H3_MISRAC_2012_R_16_3_DR_1, H3_MISRAC_2012_R_16_5_DR_1 & H3_MISRAC_2012_R_16_6_DR_1*/
+
+/* Writes (or trims) the sectors of a request out of place, one sector at a
+ * time. */
+static MEMORY_DEVICE_TRANSFER_STATUS DRV_MEMORY_FTL_Update
+(
+    DRV_MEMORY_OBJECT *dObj,
+    uint8_t *data,
+    uint32_t blockStart,
+    uint32_t nBlocks,
+    bool isTrim
+)
+{
+    DRV_MEMORY_FTL_OBJECT *ftl = dObj->ftl;
+    DRV_MEMORY_FTL_RECORD record;
+    uint32_t pageAddress = 0U;
+    uint16_t oldSlot = DRV_MEMORY_FTL_SLOT_UNMAPPED;
+    MEMORY_DEVICE_TRANSFER_STATUS transferStatus = MEMORY_DEVICE_TRANSFER_BUSY;
+
+    switch (ftl->xferState)
+    {
+        case DRV_MEMORY_FTL_XFER_INIT:
+        default:
+        {
+            ftl->position = blockStart;
+            ftl->remaining = nBlocks;
+            ftl->dataPtr = data;
+            ftl->xferState = DRV_MEMORY_FTL_XFER_PREPARE;
+            /* Fall through */
+        }
+
+        case DRV_MEMORY_FTL_XFER_PREPARE:
+        {
+            /* Finish any maintenance operation first, then make sure that a
+             * free slot and a free journal page are available. */
+            if ((ftl->gcState != DRV_MEMORY_FTL_GC_IDLE) || (DRV_MEMORY_FTL_GcStart(dObj, true, !isTrim) == true))
+            {
+                transferStatus = DRV_MEMORY_FTL_GcStep(dObj);
+
+                if (transferStatus == MEMORY_DEVICE_TRANSFER_COMPLETED)
+                {
+                    transferStatus = MEMORY_DEVICE_TRANSFER_BUSY;
+                }
+                break;
+            }
+
+            if (isTrim == true)
+            {
+                if (ftl->map[ftl->position] == DRV_MEMORY_FTL_SLOT_UNMAPPED)
+                {
+                    /* Already erased, no record needed */
+                    if (DRV_MEMORY_FTL_SectorNext(ftl, isTrim) == true)
+                    {
+                        transferStatus = MEMORY_DEVICE_TRANSFER_COMPLETED;
+                    }
+                    break;
+                }
+
+                ftl->slot = DRV_MEMORY_FTL_SLOT_UNMAPPED;
+                ftl->xferState = DRV_MEMORY_FTL_XFER_RECORD;
+                break;
+            }
+
+            if (DRV_MEMORY_FTL_SlotFind(ftl, DRV_MEMORY_FTL_FreeMap(ftl), &ftl->allocCursor, &ftl->slot) == false)
+            {
+                transferStatus = MEMORY_DEVICE_TRANSFER_ERROR_UNKNOWN;
+                break;
+            }
+
+            DRV_MEMORY_FTL_BitClear(DRV_MEMORY_FTL_FreeMap(ftl), ftl->slot);
+            ftl->freeSlots--;
+            ftl->page = 0U;
+            ftl->xferState = DRV_MEMORY_FTL_XFER_DATA;
+            /* Fall through */
+        }
+
+        case DRV_MEMORY_FTL_XFER_DATA:
+        {
+            transferStatus = DRV_MEMORY_FTL_DeviceStatus(dObj);
+
+            if (transferStatus == MEMORY_DEVICE_TRANSFER_BUSY)
+            {
+                break;
+            }
+
+            if (transferStatus == MEMORY_DEVICE_TRANSFER_COMPLETED)
+            {
+                if (ftl->page < (DRV_MEMORY_FTL_SECTOR_SIZE / dObj->writeBlockSize))
+                {
+                    pageAddress = ftl->page * dObj->writeBlockSize;
+                    ftl->page++;
+
+                    dObj->isTransferDone = false;
+
+                    if (dObj->memoryDevice->PageWrite(dObj->memDevHandle, (void *)&ftl->dataPtr[pageAddress], DRV_MEMORY_FTL_SlotAddress(dObj, ftl->slot) + pageAddress) == true)
+                    {
+                        transferStatus = MEMORY_DEVICE_TRANSFER_BUSY;
+                        break;
+                    }
+
+                    transferStatus = MEMORY_DEVICE_TRANSFER_ERROR_UNKNOWN;
+                }
+                else
+                {
+                    ftl->xferState = DRV_MEMORY_FTL_XFER_RECORD;
+                }
+            }
+
+            if (transferStatus != MEMORY_DEVICE_TRANSFER_COMPLETED)
+            {
+                /* The slot is partially programmed, it has to be erased */
+                DRV_MEMORY_FTL_BitSet(DRV_MEMORY_FTL_StaleMap(ftl), ftl->slot);
+                ftl->staleSlots++;
+                break;
+            }
+
+            /* Fall through */
+        }
+
+        case DRV_MEMORY_FTL_XFER_RECORD:
+        {
+            transferStatus = DRV_MEMORY_FTL_DeviceStatus(dObj);
+
+            if (transferStatus != MEMORY_DEVICE_TRANSFER_COMPLETED)
+            {
+                break;
+            }
+
+            record.magic = DRV_MEMORY_FTL_RECORD_MAGIC;
+            record.generation = ftl->generation;
+            record.mapping = (ftl->position << 16U) | ftl->slot;
+            record.check = DRV_MEMORY_FTL_Checksum(DRV_MEMORY_FTL_CHECK_OFFSET, (const uint8_t *)&record, sizeof(DRV_MEMORY_FTL_RECORD) - sizeof(uint32_t));
+
+            (void) memset((void *)ftl->pageBuffer, 0xFF, dObj->writeBlockSize);
+            (void) memcpy((void *)ftl->pageBuffer, (const void *)&record, sizeof(DRV_MEMORY_FTL_RECORD));
+
+            /* The page is consumed even if the program operation fails */
+            pageAddress = ftl->areaAddress[ftl->activeArea] + (ftl->journalIndex * dObj->writeBlockSize);
+            ftl->journalIndex++;
+
+            dObj->isTransferDone = false;
+
+            if (dObj->memoryDevice->PageWrite(dObj->memDevHandle, (void *)ftl->pageBuffer, pageAddress) == false)
+            {
+                transferStatus = MEMORY_DEVICE_TRANSFER_ERROR_UNKNOWN;
+                break;
+            }
+
+            ftl->xferState = DRV_MEMORY_FTL_XFER_COMMIT;
+            transferStatus = MEMORY_DEVICE_TRANSFER_BUSY;
+            break;
+        }
+
+        case DRV_MEMORY_FTL_XFER_COMMIT:
+        {
+            /* If the record failed the slot is neither free nor stale. It
+             * stays unused until the next mount sorts it out. */
+            transferStatus = DRV_MEMORY_FTL_DeviceStatus(dObj);
+
+            if (transferStatus != MEMORY_DEVICE_TRANSFER_COMPLETED)
+            {
+                break;
+            }
+
+            oldSlot = ftl->map[ftl->position];
+            ftl->map[ftl->position] = (uint16_t)ftl->slot;
+
+            if (oldSlot != DRV_MEMORY_FTL_SLOT_UNMAPPED)
+            {
+                DRV_MEMORY_FTL_BitSet(DRV_MEMORY_FTL_StaleMap(ftl), oldSlot);
+                ftl->staleSlots++;
+            }
+
+            if (DRV_MEMORY_FTL_SectorNext(ftl, isTrim) == false)
+            {
+                transferStatus = MEMORY_DEVICE_TRANSFER_BUSY;
+            }
+            break;
+        }
+
+        case DRV_MEMORY_FTL_XFER_DATA_STATUS:
+        {
+            /* Only used by the read transfers */
+            transferStatus = MEMORY_DEVICE_TRANSFER_ERROR_UNKNOWN;
+            break;
+        }
+    }
+
+    return transferStatus;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: MEMORY Driver Flash Translation Layer Routines
+// *****************************************************************************
+// *****************************************************************************
+
+bool DRV_MEMORY_FTL_Mount( DRV_MEMORY_OBJECT *dObj )
+{
+    DRV_MEMORY_FTL_OBJECT *ftl = dObj->ftl;
+    DRV_MEMORY_FTL_CHECKPOINT header[2];
+    bool isValid[2];
+    uint32_t *staleMap = NULL;
+    uint32_t pageSize = dObj->writeBlockSize;
+    uint32_t rowSize = dObj->eraseBlockSize;
+    uint32_t mediaSize = dObj->mediaGeometryTable[SYS_MEDIA_GEOMETRY_TABLE_READ_ENTRY].blockSize * dObj->mediaGeometryTable[SYS_MEDIA_GEOMETRY_TABLE_READ_ENTRY].numBlocks;
+    uint32_t areaSize = ftl->journalBlocks * rowSize;
+    uint32_t sector;
+    uint32_t slot;
+    uint8_t area = DRV_MEMORY_FTL_AREA_NONE;
+    uint8_t candidate;
+    uint8_t first;
+    uint8_t i;
+
+    /* The sectors must be made of whole erase blocks and the erase blocks of
+     * whole pages, each page large enough for a checkpoint header. */
+    if ((dObj->memoryDevice->SectorErase == NULL) || (pageSize < sizeof(DRV_MEMORY_FTL_CHECKPOINT)) ||
+        (rowSize < pageSize) || ((rowSize % pageSize) != 0U) ||
+        (rowSize > DRV_MEMORY_FTL_SECTOR_SIZE) || ((DRV_MEMORY_FTL_SECTOR_SIZE % rowSize) != 0U) ||
+        ((2U * areaSize) >= mediaSize))
+    {
+        SYS_DEBUG_MESSAGE(SYS_ERROR_INFO, "DRV_MEMORY_FTL_Mount(): Unsupported device geometry.\n");
+        return false;
+    }
+
+    ftl->nSlots = (mediaSize - (2U * areaSize)) / DRV_MEMORY_FTL_SECTOR_SIZE;
+    ftl->slotMapWords = (ftl->nSlots + 31U) / 32U;
+    ftl->pagesPerArea = areaSize / pageSize;
+    ftl->mapPages = ((ftl->nSectors * sizeof(uint16_t)) + pageSize - 1U) / pageSize;
+    ftl->areaAddress[0] = dObj->blockStartAddress + (mediaSize - (2U * areaSize));
+    ftl->areaAddress[1] = ftl->areaAddress[0] + areaSize;
+
+    /* At least one spare slot is needed to write a sector out of place */
+    if ((ftl->nSectors == 0U) || (ftl->nSlots <= ftl->nSectors) ||
+        (ftl->nSlots >= DRV_MEMORY_FTL_SLOT_UNMAPPED) || (ftl->pagesPerArea <= (ftl->mapPages + 1U)))
+    {
+        SYS_DEBUG_MESSAGE(SYS_ERROR_INFO, "DRV_MEMORY_FTL_Mount(): Invalid flash translation layer configuration.\n");
+        return false;
+    }
+
+    /* Load the newest checkpoint, fall back to the other one if its map
+     * does not verify. */
+    isValid[0] = DRV_MEMORY_FTL_CheckpointRead(dObj, 0U, &header[0]);
+    isValid[1] = DRV_MEMORY_FTL_CheckpointRead(dObj, 1U, &header[1]);
+
+    if ((isValid[0] == true) && (isValid[1] == true))
+    {
+        first = ((int32_t)(header[1].generation - header[0].generation) > 0) ? 1U : 0U;
+    }
+    else
+    {
+        first = (isValid[1] == true) ? 1U : 0U;
+    }
+
+    for (i = 0U; i < 2U; i++)
+    {
+        candidate = (uint8_t)(first ^ i);
+
+        if ((isValid[candidate] == true) && (DRV_MEMORY_FTL_MapLoad(dObj, candidate, &header[candidate]) == true))
+        {
+            area = candidate;
+            break;
+        }
+    }
+
+    if (area == DRV_MEMORY_FTL_AREA_NONE)
+    {
+        /* No checkpoint yet. Adopt the 1:1 layout of the media and force a
+         * checkpoint to area 0 before the first update. */
+        for (sector = 0U; sector < ftl->nSectors; sector++)
+        {
+            ftl->map[sector] = (uint16_t)sector;
+        }
+
+        ftl->activeArea = 1U;
+        ftl->generation = 0U;
+        ftl->journalIndex = ftl->pagesPerArea;
+    }
+    else
+    {
+        ftl->activeArea = area;
+        ftl->generation = header[area].generation;
+        DRV_MEMORY_FTL_Replay(dObj);
+    }
+
+    ftl->isInactiveErased = DRV_MEMORY_FTL_RangeIsBlank(dObj, ftl->areaAddress[ftl->activeArea ^ 1U], areaSize);
+
+    /* Rebuild the slot bitmaps. The stale bitmap first marks the mapped slots,
+     * the remaining slots are free when blank and stale otherwise. */
+    staleMap = DRV_MEMORY_FTL_StaleMap(ftl);
+    (void) memset((void *)ftl->slotMap, 0, 2U * ftl->slotMapWords * sizeof(uint32_t));
+
+    for (sector = 0U; sector < ftl->nSectors; sector++)
+    {
+        if (ftl->map[sector] != DRV_MEMORY_FTL_SLOT_UNMAPPED)
+        {
+            DRV_MEMORY_FTL_BitSet(staleMap, ftl->map[sector]);
+        }
+    }
+
+    ftl->freeSlots = 0U;
+    ftl->staleSlots = 0U;
+
+    for (slot = 0U; slot < ftl->nSlots; slot++)
+    {
+        if (DRV_MEMORY_FTL_BitGet(staleMap, slot) == true)
+        {
+            DRV_MEMORY_FTL_BitClear(staleMap, slot);
+        }
+        else if (DRV_MEMORY_FTL_RangeIsBlank(dObj, DRV_MEMORY_FTL_SlotAddress(dObj, slot), DRV_MEMORY_FTL_SECTOR_SIZE) == true)
+        {
+            DRV_MEMORY_FTL_BitSet(DRV_MEMORY_FTL_FreeMap(ftl), slot);
+            ftl->freeSlots++;
+        }
+        else
+        {
+            DRV_MEMORY_FTL_BitSet(staleMap, slot);
+            ftl->staleSlots++;
+        }
+    }
+
+    ftl->allocCursor = 0U;
+    ftl->gcCursor = 0U;
+    ftl->gcState = DRV_MEMORY_FTL_GC_IDLE;
+    ftl->xferState = DRV_MEMORY_FTL_XFER_INIT;
+
+    /* Expose the logical sectors to the clients */
+    dObj->mediaGeometryTable[SYS_MEDIA_GEOMETRY_TABLE_READ_ENTRY].blockSize = 1U;
+    dObj->mediaGeometryTable[SYS_MEDIA_GEOMETRY_TABLE_READ_ENTRY].numBlocks = ftl->nSectors * DRV_MEMORY_FTL_SECTOR_SIZE;
+    dObj->mediaGeometryTable[SYS_MEDIA_GEOMETRY_TABLE_WRITE_ENTRY].blockSize = DRV_MEMORY_FTL_SECTOR_SIZE;
+    dObj->mediaGeometryTable[SYS_MEDIA_GEOMETRY_TABLE_WRITE_ENTRY].numBlocks = ftl->nSectors;
+    dObj->mediaGeometryTable[SYS_MEDIA_GEOMETRY_TABLE_ERASE_ENTRY].blockSize = DRV_MEMORY_FTL_SECTOR_SIZE;
+    dObj->mediaGeometryTable[SYS_MEDIA_GEOMETRY_TABLE_ERASE_ENTRY].numBlocks = ftl->nSectors;
+
+    return true;
+}
+
+MEMORY_DEVICE_TRANSFER_STATUS DRV_MEMORY_FTL_HandleRead
+(
+    DRV_MEMORY_OBJECT *dObj,
+    uint8_t *data,
+    uint32_t blockStart,
+    uint32_t nBlocks
+)
+{
+    DRV_MEMORY_FTL_OBJECT *ftl = dObj->ftl;
+    MEMORY_DEVICE_TRANSFER_STATUS transferStatus = MEMORY_DEVICE_TRANSFER_BUSY;
+    uint32_t offset = 0U;
+    uint32_t length = 0U;
+    uint16_t slot = DRV_MEMORY_FTL_SLOT_UNMAPPED;
+
+    switch (ftl->xferState)
+    {
+        case DRV_MEMORY_FTL_XFER_INIT:
+        default:
+        {
+            /* The read geometry is byte addressed */
+            ftl->position = blockStart;
+            ftl->remaining = nBlocks;
+            ftl->dataPtr = data;
+            ftl->xferState = DRV_MEMORY_FTL_XFER_DATA;
+            /* Fall through */
+        }
+
+        case DRV_MEMORY_FTL_XFER_DATA:
+        {
+            /* Wait for a background erase to complete */
+            if (DRV_MEMORY_FTL_DeviceStatus(dObj) == MEMORY_DEVICE_TRANSFER_BUSY)
+            {
+                break;
+            }
+
+            offset = ftl->position % DRV_MEMORY_FTL_SECTOR_SIZE;
+            length = DRV_MEMORY_FTL_SECTOR_SIZE - offset;
+
+            if (length > ftl->remaining)
+            {
+                length = ftl->remaining;
+            }
+
+            slot = ftl->map[ftl->position / DRV_MEMORY_FTL_SECTOR_SIZE];
+
+            if (slot == DRV_MEMORY_FTL_SLOT_UNMAPPED)
+            {
+                (void) memset((void *)ftl->dataPtr, 0xFF, length);
+            }
+            else if (dObj->memoryDevice->Read(dObj->memDevHandle, (void *)ftl->dataPtr, length, DRV_MEMORY_FTL_SlotAddress(dObj, slot) + offset) == false)
+            {
+                transferStatus = MEMORY_DEVICE_TRANSFER_ERROR_UNKNOWN;
+                break;
+            }
+            else
+            {
+                /* Nothing to do */
+            }
+
+            ftl->position += length;
+            ftl->remaining -= length;
+            ftl->dataPtr += length;
+            ftl->xferState = DRV_MEMORY_FTL_XFER_DATA_STATUS;
+            /* Fall through For immediate check */
+        }
+
+        case DRV_MEMORY_FTL_XFER_DATA_STATUS:
+        {
+            transferStatus = DRV_MEMORY_FTL_DeviceStatus(dObj);
+
+            if ((transferStatus == MEMORY_DEVICE_TRANSFER_COMPLETED) && (ftl->remaining != 0U))
+            {
+                /* The next part is in another slot */
+                ftl->xferState = DRV_MEMORY_FTL_XFER_DATA;
+                transferStatus = MEMORY_DEVICE_TRANSFER_BUSY;
+            }
+            break;
+        }
+
+        case DRV_MEMORY_FTL_XFER_PREPARE:
+        case DRV_MEMORY_FTL_XFER_RECORD:
+        case DRV_MEMORY_FTL_XFER_COMMIT:
+        {
+            /* Only used by the update transfers */
+            transferStatus = MEMORY_DEVICE_TRANSFER_ERROR_UNKNOWN;
+            break;
+        }
+    }
+
+    return transferStatus;
+}
+
+uintptr_t DRV_MEMORY_FTL_AddressGet
+(
+    DRV_MEMORY_OBJECT *dObj,
+    uint32_t blockStart,
+    uint32_t *nBlock
+)
+{
+    DRV_MEMORY_FTL_OBJECT *ftl = dObj->ftl;
+    uint32_t sector = blockStart / DRV_MEMORY_FTL_SECTOR_SIZE;
+    uint32_t offset = blockStart % DRV_MEMORY_FTL_SECTOR_SIZE;
+    uint32_t length = DRV_MEMORY_FTL_SECTOR_SIZE - offset;
+    uint16_t firstSlot = ftl->map[sector];
+    uint16_t slot = firstSlot;
+
+    /* An unmapped sector is not stored anywhere on the device */
+    if (firstSlot == DRV_MEMORY_FTL_SLOT_UNMAPPED)
+    {
+        *nBlock = 0U;
+        return 0U;
+    }
+
+    /* The read geometry is byte addressed. The range stays contiguous as long
+     * as the following sectors are held in the following slots. */
+    while (length < *nBlock)
+    {
+        sector++;
+        slot++;
+
+        if (ftl->map[sector] != slot)
+        {
+            break;
+        }
+
+        length += DRV_MEMORY_FTL_SECTOR_SIZE;
+    }
+
+    if (length < *nBlock)
+    {
+        *nBlock = length;
+    }
+
+    return ((uintptr_t)DRV_MEMORY_FTL_SlotAddress(dObj, firstSlot) + offset);
+}
+
+MEMORY_DEVICE_TRANSFER_STATUS DRV_MEMORY_FTL_HandleWrite
+(
+    DRV_MEMORY_OBJECT *dObj,
+    uint8_t *data,
+    uint32_t blockStart,
+    uint32_t nBlocks
+)
+{
+    return DRV_MEMORY_FTL_Update(dObj, data, blockStart, nBlocks, false);
+}
+
+MEMORY_DEVICE_TRANSFER_STATUS DRV_MEMORY_FTL_HandleErase
+(
+    DRV_MEMORY_OBJECT *dObj,
+    uint8_t *data,
+    uint32_t blockStart,
+    uint32_t nBlocks
+)
+{
+    /* Erasing a logical sector only unmaps it */
+    return DRV_MEMORY_FTL_Update(dObj, data, blockStart, nBlocks, true);
+}
+
+/* MISRAC 2012 deviation block end */
+
+void DRV_MEMORY_FTL_Tasks( DRV_MEMORY_OBJECT *dObj )
+{
+    DRV_MEMORY_FTL_OBJECT *ftl = dObj->ftl;
+
+    if ((ftl->gcState == DRV_MEMORY_FTL_GC_IDLE) && (DRV_MEMORY_FTL_GcStart(dObj, false, false) == false))
+    {
+        return;
+    }
+
+    (void) DRV_MEMORY_FTL_GcStep(dObj);
+}
+
+#endif
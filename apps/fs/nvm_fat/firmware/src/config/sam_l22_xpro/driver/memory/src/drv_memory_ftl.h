@@ -0,0 +1,170 @@
+/******************************************************************************
+  MEMORY Driver Flash Translation Layer Interface
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    drv_memory_ftl.h
+
+  Summary:
+    MEMORY Driver Flash Translation Layer Interface Definition
+
+  Description:
+    The flash translation layer maps the logical sectors of a MEMORY driver
+    instance onto physical slots of the attached memory device. Sectors are
+    written out of place and the stale slots are erased in the background, so
+    that a sector update does not need an erase and the erase cycles are spread
+    over the whole device.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+#ifndef DRV_MEMORY_FTL_H
+#define DRV_MEMORY_FTL_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Include Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include "driver/memory/src/drv_memory_local.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+    extern "C" {
+#endif
+// DOM-IGNORE-END
+
+#if defined(DRV_MEMORY_FTL_ENABLE)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+/* Map entry of a logical sector that does not hold any data. Reads of such a
+ * sector return erased (0xFF) data. */
+#define DRV_MEMORY_FTL_SLOT_UNMAPPED                    (0xFFFFU)
+
+/* Signatures of the journal records and of the map checkpoints */
+#define DRV_MEMORY_FTL_RECORD_MAGIC                     (0x4C54464DU)
+#define DRV_MEMORY_FTL_CHECKPOINT_MAGIC                 (0x504B4346U)
+
+/*******************************************
+ * Journal record. One record is programmed
+ * in its own page of the active journal area
+ * after the sector data has been programmed.
+ ******************************************/
+typedef struct
+{
+    /* DRV_MEMORY_FTL_RECORD_MAGIC */
+    uint32_t magic;
+
+    /* Generation of the journal area holding the record */
+    uint32_t generation;
+
+    /* Logical sector in the upper 16 bits, physical slot in the lower 16 bits */
+    uint32_t mapping;
+
+    /* Checksum of the fields above */
+    uint32_t check;
+
+} DRV_MEMORY_FTL_RECORD;
+
+/*******************************************
+ * Map checkpoint header. Programmed in the
+ * first page of a journal area once the map
+ * pages following it have been programmed.
+ ******************************************/
+typedef struct
+{
+    /* DRV_MEMORY_FTL_CHECKPOINT_MAGIC */
+    uint32_t magic;
+
+    /* Generation of the journal area, incremented for every checkpoint */
+    uint32_t generation;
+
+    /* Number of logical sectors in the map */
+    uint32_t nSectors;
+
+    /* Checksum of the map pages */
+    uint32_t mapCheck;
+
+    /* Checksum of the fields above */
+    uint32_t check;
+
+} DRV_MEMORY_FTL_CHECKPOINT;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: MEMORY Driver Flash Translation Layer Routines
+// *****************************************************************************
+// *****************************************************************************
+
+bool DRV_MEMORY_FTL_Mount( DRV_MEMORY_OBJECT *dObj );
+
+MEMORY_DEVICE_TRANSFER_STATUS DRV_MEMORY_FTL_HandleRead
+(
+    DRV_MEMORY_OBJECT *dObj,
+    uint8_t *data,
+    uint32_t blockStart,
+    uint32_t nBlocks
+);
+
+MEMORY_DEVICE_TRANSFER_STATUS DRV_MEMORY_FTL_HandleWrite
+(
+    DRV_MEMORY_OBJECT *dObj,
+    uint8_t *data,
+    uint32_t blockStart,
+    uint32_t nBlocks
+);
+
+MEMORY_DEVICE_TRANSFER_STATUS DRV_MEMORY_FTL_HandleErase
+(
+    DRV_MEMORY_OBJECT *dObj,
+    uint8_t *data,
+    uint32_t blockStart,
+    uint32_t nBlocks
+);
+
+uintptr_t DRV_MEMORY_FTL_AddressGet
+(
+    DRV_MEMORY_OBJECT *dObj,
+    uint32_t blockStart,
+    uint32_t *nBlock
+);
+
+void DRV_MEMORY_FTL_Tasks( DRV_MEMORY_OBJECT *dObj );
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //#ifndef DRV_MEMORY_FTL_H
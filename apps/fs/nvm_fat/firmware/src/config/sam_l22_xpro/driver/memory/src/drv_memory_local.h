@@ -172,6 +172,132 @@ typedef enum
 
 } DRV_MEMORY_STATE;
 
+#if defined(DRV_MEMORY_FTL_ENABLE)
+/* Size of a flash translation layer sector and of a physical slot. */
+#define DRV_MEMORY_FTL_SECTOR_SIZE                      (512U)
+
+/* Number of words required for the slot bitmaps of a media of the given size. */
+#define DRV_MEMORY_FTL_SLOT_MAP_SIZE(mediaSize)         (2U * ((((mediaSize) / DRV_MEMORY_FTL_SECTOR_SIZE) + 31U) / 32U))
+
+/* MEMORY Driver flash translation layer transfer states. */
+typedef enum
+{
+    /* Transfer init state */
+    DRV_MEMORY_FTL_XFER_INIT = 0,
+
+    /* Make room for the next sector (free slot and journal space) */
+    DRV_MEMORY_FTL_XFER_PREPARE,
+
+    /* Transfer the sector data */
+    DRV_MEMORY_FTL_XFER_DATA,
+
+    /* Wait for the sector data transfer to complete */
+    DRV_MEMORY_FTL_XFER_DATA_STATUS,
+
+    /* Append the journal record for the sector */
+    DRV_MEMORY_FTL_XFER_RECORD,
+
+    /* Apply the journal record to the map */
+    DRV_MEMORY_FTL_XFER_COMMIT
+
+} DRV_MEMORY_FTL_XFER_STATE;
+
+/* MEMORY Driver flash translation layer maintenance states. */
+typedef enum
+{
+    /* No maintenance operation in progress */
+    DRV_MEMORY_FTL_GC_IDLE = 0,
+
+    /* Erase the inactive journal area */
+    DRV_MEMORY_FTL_GC_ERASE_AREA,
+
+    /* Write a map checkpoint to the inactive journal area */
+    DRV_MEMORY_FTL_GC_CHECKPOINT,
+
+    /* Erase a stale slot */
+    DRV_MEMORY_FTL_GC_ERASE_SLOT
+
+} DRV_MEMORY_FTL_GC_STATE;
+
+/**************************************
+ * MEMORY Driver Flash Translation Layer
+ **************************************/
+typedef struct
+{
+    /* Logical sector to physical slot map */
+    uint16_t *map;
+
+    /* Free slot bitmap followed by the stale slot bitmap */
+    uint32_t *slotMap;
+
+    /* Page sized buffer used for journal records and media scans */
+    uint8_t *pageBuffer;
+
+    /* Number of logical sectors exposed to the clients */
+    uint32_t nSectors;
+
+    /* Number of erase blocks in each of the two journal areas */
+    uint32_t journalBlocks;
+
+    /* Number of physical slots in the data area */
+    uint32_t nSlots;
+
+    /* Number of words in each of the two slot bitmaps */
+    uint32_t slotMapWords;
+
+    /* Start address of the two journal areas */
+    uint32_t areaAddress[2];
+
+    /* Number of pages in a journal area */
+    uint32_t pagesPerArea;
+
+    /* Number of pages holding the map in a checkpoint */
+    uint32_t mapPages;
+
+    /* Generation of the active journal area */
+    uint32_t generation;
+
+    /* Next free page in the active journal area */
+    uint32_t journalIndex;
+
+    /* Number of erased slots */
+    uint32_t freeSlots;
+
+    /* Number of slots waiting to be erased */
+    uint32_t staleSlots;
+
+    /* Round robin cursors for slot allocation and slot erase */
+    uint32_t allocCursor;
+    uint32_t gcCursor;
+
+    /* Index of the active journal area */
+    uint8_t activeArea;
+
+    /* Flag to indicate that the inactive journal area is erased */
+    bool isInactiveErased;
+
+    /* Maintenance operation state, progress and target slot */
+    DRV_MEMORY_FTL_GC_STATE gcState;
+    uint32_t gcIndex;
+    uint32_t gcSlot;
+
+    /* Transfer state of the current request */
+    DRV_MEMORY_FTL_XFER_STATE xferState;
+
+    /* Current sector (byte offset for reads) and remaining count */
+    uint32_t position;
+    uint32_t remaining;
+
+    /* Current client buffer pointer */
+    uint8_t *dataPtr;
+
+    /* Slot and page being programmed for the current sector */
+    uint32_t slot;
+    uint32_t page;
+
+} DRV_MEMORY_FTL_OBJECT;
+#endif
+
 /**************************************
  * MEMORY Driver Client
  **************************************/
@@ -316,6 +442,11 @@ typedef struct
     /* Attached Memory Device functions */
     const DRV_MEMORY_DEVICE_INTERFACE *memoryDevice;
 
+#if defined(DRV_MEMORY_FTL_ENABLE)
+    /* Flash translation layer object, NULL if the instance does not use it */
+    DRV_MEMORY_FTL_OBJECT *ftl;
+#endif
+
     /* Pointer to Buffer Objects array */
     DRV_MEMORY_BUFFER_OBJECT *buffObjArr;
 
@@ -0,0 +1,671 @@
+/*******************************************************************************
+  SPI NOR Flash Driver Interface Definition
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    drv_spi_nor.h
+
+  Summary:
+    SPI NOR Flash Driver Interface Definition
+
+  Description:
+    The SPI NOR flash driver provides a simple interface to manage a serial
+    NOR flash (JEDEC standard 0x03/0x0B/0x02/0x20 command set) connected to a
+    SERCOM SPI through the SPI driver. The driver exposes the functions expected
+    by the Memory driver (DRV_MEMORY_DEVICE_INTERFACE), which in turn registers
+    the flash as a media with the File System media manager.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+#ifndef DRV_SPI_NOR_H
+#define DRV_SPI_NOR_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File includes
+// *****************************************************************************
+// *****************************************************************************
+
+#include "driver/driver_common.h"
+#include "system/system.h"
+#include "drv_spi_nor_definitions.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* SPI NOR Flash Page and Sector Size
+
+ Summary:
+    Program page size and erase sector size of the SPI NOR flash.
+
+ Description:
+    A page program operation writes at most one page and the smallest
+    erasable unit is one sector.
+
+ Remarks:
+    None.
+*/
+
+#define DRV_SPI_NOR_PAGE_SIZE           (256U)
+#define DRV_SPI_NOR_SECTOR_SIZE         (4096U)
+
+// *****************************************************************************
+/* SPI NOR Driver Transfer Status
+
+ Summary:
+    Defines the data type for SPI NOR Driver transfer status.
+
+ Description:
+    This will be used to indicate the current transfer status of the SPI NOR
+    driver operations.
+
+ Remarks:
+    The values match MEMORY_DEVICE_TRANSFER_STATUS so that the driver can be
+    attached to the Memory driver.
+*/
+
+typedef enum
+{
+    /* Transfer is being processed */
+    DRV_SPI_NOR_TRANSFER_BUSY,
+
+    /* Transfer is successfully completed */
+    DRV_SPI_NOR_TRANSFER_COMPLETED,
+
+    /* Transfer had error */
+    DRV_SPI_NOR_TRANSFER_ERROR_UNKNOWN,
+
+} DRV_SPI_NOR_TRANSFER_STATUS;
+
+// *****************************************************************************
+/* SPI NOR Device Geometry data.
+
+ Summary:
+    Defines the data type for SPI NOR flash geometry details.
+
+ Description:
+    This will be used to get the geometry details of the attached SPI NOR
+    flash device.
+
+ Remarks:
+    The layout matches MEMORY_DEVICE_GEOMETRY.
+*/
+
+typedef struct
+{
+    uint32_t read_blockSize;
+    uint32_t read_numBlocks;
+    uint32_t numReadRegions;
+
+    uint32_t write_blockSize;
+    uint32_t write_numBlocks;
+    uint32_t numWriteRegions;
+
+    uint32_t erase_blockSize;
+    uint32_t erase_numBlocks;
+    uint32_t numEraseRegions;
+
+    uint32_t blockStartAddress;
+
+} DRV_SPI_NOR_GEOMETRY;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: SPI NOR Driver Module Interface Routines
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* Function:
+    SYS_MODULE_OBJ DRV_SPI_NOR_Initialize
+    (
+        const SYS_MODULE_INDEX drvIndex,
+        const SYS_MODULE_INIT *const init
+    );
+
+  Summary:
+    Initializes the SPI NOR Driver
+
+  Description:
+    This routine initializes the SPI NOR driver making it ready for client to
+    use. The SPI driver instance given in the init data is not opened here; it
+    is opened when a client opens the SPI NOR driver.
+
+  Precondition:
+    None.
+
+  Parameters:
+    drvIndex -  Identifier for the instance to be initialized
+
+    init     -  Pointer to a data structure containing any data necessary to
+                initialize the driver.
+
+  Returns:
+    If successful, returns a valid handle to a driver instance object.
+    Otherwise it returns SYS_MODULE_OBJ_INVALID.
+
+  Example:
+    <code>
+    SYS_MODULE_OBJ  objectHandle;
+
+    const DRV_SPI_NOR_INIT drvSpiNorInitData =
+    {
+        .spiDrvIndex    = DRV_SPI_INDEX_0,
+        .chipSelectPin  = SYS_PORT_PIN_PA17,
+        .clockSpeedHz   = 8000000,
+        .flashSize      = 2097152,
+    };
+
+    objectHandle = DRV_SPI_NOR_Initialize((SYS_MODULE_INDEX)DRV_SPI_NOR_INDEX, (SYS_MODULE_INIT *)&drvSpiNorInitData);
+
+    if (SYS_MODULE_OBJ_INVALID == objectHandle)
+    {
+        // Handle error
+    }
+    </code>
+
+  Remarks:
+    This routine must be called after the SPI driver instance it uses has been
+    initialized.
+*/
+
+SYS_MODULE_OBJ DRV_SPI_NOR_Initialize
+(
+    const SYS_MODULE_INDEX drvIndex,
+    const SYS_MODULE_INIT *const init
+);
+
+// *************************************************************************
+/* Function:
+    SYS_STATUS DRV_SPI_NOR_Status( const SYS_MODULE_INDEX drvIndex );
+
+  Summary:
+    Gets the current status of the SPI NOR driver module.
+
+  Description:
+    This routine provides the current status of the SPI NOR driver module.
+
+  Precondition:
+    Function DRV_SPI_NOR_Initialize should have been called before calling
+    this function.
+
+  Parameters:
+    drvIndex   -  Identifier for the instance used to initialize driver
+
+  Returns:
+    SYS_STATUS_READY - Indicates that the driver is ready and accept requests
+                       for new operations.
+
+    SYS_STATUS_UNINITIALIZED - Indicates the driver is not initialized.
+
+  Example:
+    <code>
+    SYS_STATUS status;
+
+    status = DRV_SPI_NOR_Status(DRV_SPI_NOR_INDEX);
+    </code>
+
+  Remarks:
+    None.
+*/
+
+SYS_STATUS DRV_SPI_NOR_Status( const SYS_MODULE_INDEX drvIndex );
+
+// *****************************************************************************
+/* Function:
+    DRV_HANDLE DRV_SPI_NOR_Open
+    (
+        const SYS_MODULE_INDEX drvIndex,
+        const DRV_IO_INTENT ioIntent
+    );
+
+  Summary:
+    Opens the specified SPI NOR driver instance and returns a handle to it
+
+  Description:
+    This routine opens the specified SPI NOR driver instance and provides a
+    handle. This handle must be provided to all other client-level operations
+    to identify the caller and the instance of the driver.
+
+    The underlying SPI driver instance is opened in exclusive mode, as the SPI
+    NOR driver controls the chip select line across several queued transfers.
+
+  Precondition:
+    Function DRV_SPI_NOR_Initialize must have been called before calling this
+    function.
+
+  Parameters:
+    drvIndex  -  Identifier for the instance to be opened
+
+    ioIntent  -  Zero or more of the values from the enumeration
+                 DRV_IO_INTENT "ORed" together to indicate the intended use
+                 of the driver
+
+  Returns:
+    If successful, the routine returns a valid open-instance handle (a
+    number identifying both the caller and the module instance).
+
+    If an error occurs, DRV_HANDLE_INVALID is returned. Errors can occur
+    - if the driver is already opened by a client
+    - if the SPI driver instance cannot be opened
+    - if the driver instance being opened is not initialized.
+
+  Example:
+    <code>
+    DRV_HANDLE handle;
+
+    handle = DRV_SPI_NOR_Open(DRV_SPI_NOR_INDEX, DRV_IO_INTENT_READWRITE);
+    if (DRV_HANDLE_INVALID == handle)
+    {
+        // Unable to open the driver
+    }
+    </code>
+
+  Remarks:
+    The driver supports a single client. It is normally opened by the Memory
+    driver.
+*/
+
+DRV_HANDLE DRV_SPI_NOR_Open( const SYS_MODULE_INDEX drvIndex, const DRV_IO_INTENT ioIntent );
+
+// *****************************************************************************
+/* Function:
+    void DRV_SPI_NOR_Close( const DRV_HANDLE handle );
+
+  Summary:
+    Closes an opened-instance of the SPI NOR driver
+
+  Description:
+    This routine closes an opened-instance of the SPI NOR driver, invalidating
+    the handle and releasing the SPI driver instance.
+
+  Precondition:
+    DRV_SPI_NOR_Open must have been called to obtain a valid opened device
+    handle.
+
+  Parameters:
+    handle       - A valid open-instance handle, returned from the driver's
+                   open routine
+
+  Returns:
+    None
+
+  Example:
+    <code>
+    DRV_HANDLE handle;  // Returned from DRV_SPI_NOR_Open
+
+    DRV_SPI_NOR_Close(handle);
+    </code>
+
+  Remarks:
+    None.
+*/
+
+void DRV_SPI_NOR_Close( const DRV_HANDLE handle );
+
+// *****************************************************************************
+/* Function:
+    bool DRV_SPI_NOR_ReadJedecId( const DRV_HANDLE handle, void *jedec_id );
+
+  Summary:
+    Reads the JEDEC ID of the SPI NOR flash.
+
+  Description:
+    This function schedules a non-blocking read of the 3 byte JEDEC ID
+    (manufacturer ID, memory type, capacity) into jedec_id. The completion of
+    the operation is reported by DRV_SPI_NOR_TransferStatusGet.
+
+  Precondition:
+    The DRV_SPI_NOR_Open() routine must have been called for the specified
+    SPI NOR driver instance.
+
+  Parameters:
+    handle   - A valid open-instance handle, returned from the driver's open
+               routine
+
+    jedec_id - Pointer to a 32-bit variable to receive the JEDEC ID. The
+               manufacturer ID is placed in the least significant byte.
+
+  Returns:
+    false
+    - if the driver is busy with another operation or the request could not
+      be queued
+
+    true
+    - if the request was queued
+
+  Example:
+    <code>
+    DRV_HANDLE handle;  // Returned from DRV_SPI_NOR_Open
+    uint32_t jedecId = 0;
+
+    if (DRV_SPI_NOR_ReadJedecId(handle, (void *)&jedecId) == true)
+    {
+        while (DRV_SPI_NOR_TransferStatusGet(handle) == DRV_SPI_NOR_TRANSFER_BUSY);
+    }
+    </code>
+
+  Remarks:
+    None.
+*/
+
+bool DRV_SPI_NOR_ReadJedecId( const DRV_HANDLE handle, void *jedec_id );
+
+// **************************************************************************
+/* Function:
+    bool DRV_SPI_NOR_SectorErase( const DRV_HANDLE handle, uint32_t address );
+
+  Summary:
+    Erase the 4 KB sector containing the given address.
+
+  Description:
+    This function schedules a non-blocking sector erase operation of the flash
+    memory. The write enable, sector erase and the status register polling
+    that follows are sequenced by the driver. The completion of the operation
+    is reported by DRV_SPI_NOR_TransferStatusGet.
+
+  Precondition:
+    The DRV_SPI_NOR_Open() routine must have been called for the specified
+    SPI NOR driver instance.
+
+  Parameters:
+    handle  - A valid open-instance handle, returned from the driver's open
+              routine
+
+    address - Address of the sector to be erased.
+
+  Returns:
+    false
+    - if the driver is busy, the address is out of range or the request could
+      not be queued
+
+    true
+    - if the erase request was queued
+
+  Example:
+    <code>
+    DRV_HANDLE handle;  // Returned from DRV_SPI_NOR_Open
+    uint32_t sectorStart = 0;
+
+    if (DRV_SPI_NOR_SectorErase(handle, sectorStart) == false)
+    {
+        // Error handling here
+    }
+
+    while (DRV_SPI_NOR_TransferStatusGet(handle) == DRV_SPI_NOR_TRANSFER_BUSY);
+    </code>
+
+  Remarks:
+    None.
+*/
+
+bool DRV_SPI_NOR_SectorErase( const DRV_HANDLE handle, uint32_t address );
+
+// *****************************************************************************
+/* Function:
+    bool DRV_SPI_NOR_Read
+    (
+        const DRV_HANDLE handle,
+        void *rx_data,
+        uint32_t rx_data_length,
+        uint32_t address
+    );
+
+  Summary:
+    Reads rx_data_length bytes of data from the specified address in flash
+    memory.
+
+  Description:
+    This function schedules a non-blocking fast read operation. The command
+    header is sent as one SPI transfer and the data phase is received as a
+    second, read only transfer directly into rx_data, so that when the SPI
+    driver is configured with DMA the data is streamed into the caller's
+    buffer without an intermediate copy. Reads larger than what a single DMA
+    block transfer can move are split internally while the chip select is
+    held asserted.
+
+  Precondition:
+    The DRV_SPI_NOR_Open() routine must have been called for the specified
+    SPI NOR driver instance.
+
+  Parameters:
+    handle          - A valid open-instance handle, returned from the driver's
+                      open routine
+
+    rx_data         - Buffer pointer into which the data read from the flash
+                      is placed.
+
+    rx_data_length  - Total number of bytes to be read.
+
+    address         - Read memory start address from where the data should be
+                      read.
+
+  Returns:
+    false
+    - if the driver is busy, the parameters are invalid or the request could
+      not be queued
+
+    true
+    - if the read request was queued
+
+  Example:
+    <code>
+    #define BUFFER_SIZE  1024
+    #define MEM_ADDRESS  0x0
+
+    DRV_HANDLE handle;  // Returned from DRV_SPI_NOR_Open
+    uint8_t readBuffer[BUFFER_SIZE];
+
+    if (DRV_SPI_NOR_Read(handle, (void *)&readBuffer, BUFFER_SIZE, MEM_ADDRESS) == false)
+    {
+        // Error handling here
+    }
+
+    while (DRV_SPI_NOR_TransferStatusGet(handle) == DRV_SPI_NOR_TRANSFER_BUSY);
+    </code>
+
+  Remarks:
+    None.
+*/
+
+bool DRV_SPI_NOR_Read( const DRV_HANDLE handle, void *rx_data, uint32_t rx_data_length, uint32_t address );
+
+// *****************************************************************************
+/* Function:
+    bool DRV_SPI_NOR_PageWrite
+    (
+        const DRV_HANDLE handle,
+        void *tx_data,
+        uint32_t address
+    );
+
+  Summary:
+    Writes one page of data starting at the specified address.
+
+  Description:
+    This function schedules a non-blocking page program operation of one
+    DRV_SPI_NOR_PAGE_SIZE byte page. The write enable, page program and the
+    status register polling that follows are sequenced by the driver. The
+    completion of the operation is reported by DRV_SPI_NOR_TransferStatusGet.
+
+  Precondition:
+    The DRV_SPI_NOR_Open() routine must have been called for the specified
+    SPI NOR driver instance.
+
+    The page must have been erased.
+
+  Parameters:
+    handle    - A valid open-instance handle, returned from the driver's open
+                routine
+
+    tx_data   - The source buffer containing data to be programmed into the
+                flash. The buffer must remain valid until the operation
+                completes.
+
+    address   - Page aligned write memory start address.
+
+  Returns:
+    false
+    - if the driver is busy, the address is not page aligned or out of range,
+      or the request could not be queued
+
+    true
+    - if the write request was queued
+
+  Example:
+    <code>
+    DRV_HANDLE handle;  // Returned from DRV_SPI_NOR_Open
+    uint8_t writeBuffer[DRV_SPI_NOR_PAGE_SIZE];
+
+    if (DRV_SPI_NOR_PageWrite(handle, (void *)&writeBuffer, 0x100) == false)
+    {
+        // Error handling here
+    }
+
+    while (DRV_SPI_NOR_TransferStatusGet(handle) == DRV_SPI_NOR_TRANSFER_BUSY);
+    </code>
+
+  Remarks:
+    None.
+*/
+
+bool DRV_SPI_NOR_PageWrite( const DRV_HANDLE handle, void *tx_data, uint32_t address );
+
+// *****************************************************************************
+/* Function:
+    DRV_SPI_NOR_TRANSFER_STATUS DRV_SPI_NOR_TransferStatusGet( const DRV_HANDLE handle );
+
+  Summary:
+    Gets the current status of the transfer request.
+
+  Description:
+    This routine gets the current status of the last scheduled operation.
+    While an erase or program operation is executing inside the flash, each
+    call issues at most one read of the status register and returns
+    DRV_SPI_NOR_TRANSFER_BUSY until the write-in-progress bit clears. The
+    function is therefore expected to be polled, as done by the Memory driver
+    task routine.
+
+  Preconditions:
+    The DRV_SPI_NOR_Open() routine must have been called for the specified
+    SPI NOR driver instance.
+
+  Parameters:
+    handle - A valid open-instance handle, returned from the driver's open
+             routine
+
+  Returns:
+    One of the status element from the enum DRV_SPI_NOR_TRANSFER_STATUS.
+
+  Example:
+    <code>
+    DRV_HANDLE handle;  // Returned from DRV_SPI_NOR_Open
+
+    if (DRV_SPI_NOR_TransferStatusGet(handle) == DRV_SPI_NOR_TRANSFER_COMPLETED)
+    {
+        // Operation Done
+    }
+    </code>
+
+  Remarks:
+    None.
+*/
+
+DRV_SPI_NOR_TRANSFER_STATUS DRV_SPI_NOR_TransferStatusGet( const DRV_HANDLE handle );
+
+// *****************************************************************************
+/* Function:
+    bool DRV_SPI_NOR_GeometryGet( const DRV_HANDLE handle, DRV_SPI_NOR_GEOMETRY *geometry );
+
+  Summary:
+    Returns the geometry of the device.
+
+  Description:
+    This API gives the following geometrical details of the SPI NOR flash:
+    - Media Property
+    - Number of Read/Write/Erase regions in the flash device
+    - Number of Blocks and their size in each region of the device
+
+    The read block size is one byte, the write block size is one page and the
+    erase block size is one 4 KB sector.
+
+  Precondition:
+    The DRV_SPI_NOR_Open() routine must have been called for the specified
+    SPI NOR driver instance.
+
+  Parameters:
+    handle   - A valid open-instance handle, returned from the driver's open
+               routine
+
+    geometry - Pointer to flash device geometry table instance
+
+  Returns:
+    true
+    - if able to get the geometry details of the flash
+
+    false
+    - if the handle is invalid
+
+  Example:
+    <code>
+    DRV_HANDLE handle;  // Returned from DRV_SPI_NOR_Open
+    DRV_SPI_NOR_GEOMETRY flashGeometry;
+    uint32_t totalFlashSize;
+
+    DRV_SPI_NOR_GeometryGet(handle, &flashGeometry);
+
+    totalFlashSize = (flashGeometry.read_blockSize * flashGeometry.read_numBlocks);
+    </code>
+
+  Remarks:
+    None.
+*/
+
+bool DRV_SPI_NOR_GeometryGet( const DRV_HANDLE handle, DRV_SPI_NOR_GEOMETRY *geometry );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // #ifndef DRV_SPI_NOR_H
+/*******************************************************************************
+ End of File
+*/
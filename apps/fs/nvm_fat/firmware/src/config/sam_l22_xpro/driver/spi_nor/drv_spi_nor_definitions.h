@@ -0,0 +1,114 @@
+/*******************************************************************************
+  SPI NOR Flash Driver Definitions Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    drv_spi_nor_definitions.h
+
+  Summary:
+    SPI NOR Flash Driver Definitions Header File
+
+  Description:
+    This file provides implementation-specific definitions for the SPI NOR
+    flash driver's system interface.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+#ifndef DRV_SPI_NOR_DEFINITIONS_H
+#define DRV_SPI_NOR_DEFINITIONS_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File includes
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "system/system_module.h"
+#include "system/ports/sys_ports.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* SPI NOR Driver Initialization Data
+
+  Summary:
+    Defines the data required to initialize the SPI NOR driver
+
+  Description:
+    This data type defines the data required to initialize the SPI NOR driver.
+    The driver does not own the SPI peripheral; it opens the DRV_SPI instance
+    identified by spiDrvIndex and drives the flash chip select itself, so that
+    the command header and the data phase of a command can be queued as
+    separate SPI transfers while the chip select stays asserted.
+
+  Remarks:
+    None.
+*/
+
+typedef struct
+{
+    /* Index of the SPI driver instance the flash is connected to */
+    SYS_MODULE_INDEX                spiDrvIndex;
+
+    /* Chip select pin of the flash device */
+    SYS_PORT_PIN                    chipSelectPin;
+
+    /* SPI clock frequency used to talk to the flash */
+    uint32_t                        clockSpeedHz;
+
+    /* Size of the flash device in bytes */
+    uint32_t                        flashSize;
+
+} DRV_SPI_NOR_INIT;
+
+//DOM-IGNORE-BEGIN
+#ifdef __cplusplus
+}
+#endif
+//DOM-IGNORE-END
+
+#endif // #ifndef DRV_SPI_NOR_DEFINITIONS_H
+/*******************************************************************************
+ End of File
+*/
@@ -0,0 +1,572 @@
+/*******************************************************************************
+  SPI NOR Flash Driver Implementation
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    drv_spi_nor.c
+
+  Summary:
+    SPI NOR flash driver implementation on top of the SPI driver.
+
+  Description:
+    This file implements the SPI NOR flash driver. Every flash command is
+    issued as one or two SPI driver transfers (command header followed by an
+    optional data phase) while the driver holds the flash chip select, so that
+    read data can be received by DMA directly into the caller's buffer. The
+    transfers are sequenced from the SPI driver event handler and the flash
+    busy status is polled through DRV_SPI_NOR_TransferStatusGet.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Include Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include "driver/spi_nor/src/drv_spi_nor_local.h"
+#include "system/debug/sys_debug.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global objects
+// *****************************************************************************
+// *****************************************************************************
+
+static CACHE_ALIGN DRV_SPI_NOR_OBJECT gDrvSpiNorObj[DRV_SPI_NOR_INSTANCES_NUMBER];
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: SPI NOR Driver Local Functions
+// *****************************************************************************
+// *****************************************************************************
+
+static DRV_SPI_NOR_OBJECT * lDRV_SPI_NOR_DriverHandleValidate( const DRV_HANDLE handle )
+{
+    DRV_SPI_NOR_OBJECT *dObj = NULL;
+
+    if (handle < DRV_SPI_NOR_INSTANCES_NUMBER)
+    {
+        dObj = &gDrvSpiNorObj[handle];
+
+        if (dObj->isOpened == false)
+        {
+            dObj = NULL;
+        }
+    }
+
+    return dObj;
+}
+
+static inline void lDRV_SPI_NOR_ChipSelectAssert( DRV_SPI_NOR_OBJECT *dObj )
+{
+    SYS_PORT_PinClear(dObj->chipSelectPin);
+}
+
+static inline void lDRV_SPI_NOR_ChipSelectDeassert( DRV_SPI_NOR_OBJECT *dObj )
+{
+    SYS_PORT_PinSet(dObj->chipSelectPin);
+}
+
+static void lDRV_SPI_NOR_CommandHeaderBuild( DRV_SPI_NOR_OBJECT *dObj, uint8_t command, uint32_t address )
+{
+    dObj->cmdBuffer[0] = command;
+    dObj->cmdBuffer[1] = (uint8_t)(address >> 16);
+    dObj->cmdBuffer[2] = (uint8_t)(address >> 8);
+    dObj->cmdBuffer[3] = (uint8_t)(address);
+    dObj->cmdBuffer[4] = 0xFFU;
+}
+
+/* Ends the current command with the given status. Called with CS asserted. */
+static void lDRV_SPI_NOR_CommandEnd( DRV_SPI_NOR_OBJECT *dObj, DRV_SPI_NOR_TRANSFER_STATUS status )
+{
+    lDRV_SPI_NOR_ChipSelectDeassert(dObj);
+
+    dObj->lastTransferHandle = DRV_SPI_TRANSFER_HANDLE_INVALID;
+    dObj->state = DRV_SPI_NOR_STATE_IDLE;
+    dObj->transferStatus = status;
+}
+
+/* Asserts CS and queues a single full duplex register command. The receive
+ * data (if any) is placed in regRxBuffer. */
+static bool lDRV_SPI_NOR_RegisterCommand( DRV_SPI_NOR_OBJECT *dObj, size_t length, DRV_SPI_NOR_STATE nextState )
+{
+    dObj->state = nextState;
+
+    lDRV_SPI_NOR_ChipSelectAssert(dObj);
+
+    DRV_SPI_WriteReadTransferAdd(dObj->spiHandle, (void *)dObj->regTxBuffer, length, (void *)dObj->regRxBuffer, length, (DRV_SPI_TRANSFER_HANDLE *)&dObj->lastTransferHandle);
+
+    if (dObj->lastTransferHandle == DRV_SPI_TRANSFER_HANDLE_INVALID)
+    {
+        lDRV_SPI_NOR_CommandEnd(dObj, DRV_SPI_NOR_TRANSFER_ERROR_UNKNOWN);
+        return false;
+    }
+
+    return true;
+}
+
+/* Queues the next chunk of the read data phase directly into the user buffer */
+static bool lDRV_SPI_NOR_ReadChunk( DRV_SPI_NOR_OBJECT *dObj )
+{
+    uint32_t length = dObj->rxPending;
+    uint8_t *rxPtr = dObj->rxPtr;
+
+    if (length > DRV_SPI_NOR_MAX_TRANSFER_SIZE)
+    {
+        length = DRV_SPI_NOR_MAX_TRANSFER_SIZE;
+    }
+
+    dObj->rxPtr += length;
+    dObj->rxPending -= length;
+
+    DRV_SPI_ReadTransferAdd(dObj->spiHandle, (void *)rxPtr, length, (DRV_SPI_TRANSFER_HANDLE *)&dObj->lastTransferHandle);
+
+    return (dObj->lastTransferHandle != DRV_SPI_TRANSFER_HANDLE_INVALID);
+}
+
+/* Asserts CS and queues the address command header followed by the optional
+ * page program data. */
+static bool lDRV_SPI_NOR_WriteCommand( DRV_SPI_NOR_OBJECT *dObj )
+{
+    DRV_SPI_TRANSFER_HANDLE transferHandle;
+
+    dObj->state = DRV_SPI_NOR_STATE_WRITE_CMD;
+    dObj->lastTransferHandle = DRV_SPI_TRANSFER_HANDLE_INVALID;
+
+    lDRV_SPI_NOR_ChipSelectAssert(dObj);
+
+    if (dObj->txPtr == NULL)
+    {
+        DRV_SPI_WriteTransferAdd(dObj->spiHandle, (void *)dObj->cmdBuffer, dObj->cmdLength, (DRV_SPI_TRANSFER_HANDLE *)&dObj->lastTransferHandle);
+    }
+    else
+    {
+        DRV_SPI_WriteTransferAdd(dObj->spiHandle, (void *)dObj->cmdBuffer, dObj->cmdLength, &transferHandle);
+
+        if (transferHandle != DRV_SPI_TRANSFER_HANDLE_INVALID)
+        {
+            DRV_SPI_WriteTransferAdd(dObj->spiHandle, (void *)dObj->txPtr, DRV_SPI_NOR_PAGE_SIZE, (DRV_SPI_TRANSFER_HANDLE *)&dObj->lastTransferHandle);
+        }
+    }
+
+    if (dObj->lastTransferHandle == DRV_SPI_TRANSFER_HANDLE_INVALID)
+    {
+        lDRV_SPI_NOR_CommandEnd(dObj, DRV_SPI_NOR_TRANSFER_ERROR_UNKNOWN);
+        return false;
+    }
+
+    return true;
+}
+
+/* Starts a write enable followed by the program/erase command in cmdBuffer */
+static bool lDRV_SPI_NOR_WriteStart( DRV_SPI_NOR_OBJECT *dObj, uint8_t *txData, uint32_t cmdLength )
+{
+    dObj->txPtr = txData;
+    dObj->cmdLength = cmdLength;
+    dObj->transferStatus = DRV_SPI_NOR_TRANSFER_BUSY;
+
+    dObj->regTxBuffer[0] = DRV_SPI_NOR_CMD_WRITE_ENABLE;
+
+    return lDRV_SPI_NOR_RegisterCommand(dObj, 1U, DRV_SPI_NOR_STATE_WRITE_ENABLE);
+}
+
+/* SPI driver event handler. Runs in the SPI/DMA interrupt context. */
+static void lDRV_SPI_NOR_EventHandler
+(
+    DRV_SPI_TRANSFER_EVENT event,
+    DRV_SPI_TRANSFER_HANDLE transferHandle,
+    uintptr_t context
+)
+{
+    DRV_SPI_NOR_OBJECT *dObj = (DRV_SPI_NOR_OBJECT *)context;
+
+    if ((dObj->state == DRV_SPI_NOR_STATE_IDLE) || (dObj->state == DRV_SPI_NOR_STATE_WAIT_WIP_CLEAR))
+    {
+        /* Stale completion of a command that has already ended */
+        return;
+    }
+
+    if (event != DRV_SPI_TRANSFER_EVENT_COMPLETE)
+    {
+        lDRV_SPI_NOR_CommandEnd(dObj, DRV_SPI_NOR_TRANSFER_ERROR_UNKNOWN);
+        return;
+    }
+
+    if (transferHandle != dObj->lastTransferHandle)
+    {
+        /* Command header completed, the data phase is still in progress */
+        return;
+    }
+
+    switch (dObj->state)
+    {
+        case DRV_SPI_NOR_STATE_READ_DATA:
+        {
+            if (dObj->rxPending != 0U)
+            {
+                /* Continue the same read command with the next chunk */
+                if (lDRV_SPI_NOR_ReadChunk(dObj) == false)
+                {
+                    lDRV_SPI_NOR_CommandEnd(dObj, DRV_SPI_NOR_TRANSFER_ERROR_UNKNOWN);
+                }
+            }
+            else
+            {
+                lDRV_SPI_NOR_CommandEnd(dObj, DRV_SPI_NOR_TRANSFER_COMPLETED);
+            }
+            break;
+        }
+
+        case DRV_SPI_NOR_STATE_WRITE_ENABLE:
+        {
+            /* Write enable latches on CS de-assertion */
+            lDRV_SPI_NOR_ChipSelectDeassert(dObj);
+
+            (void) lDRV_SPI_NOR_WriteCommand(dObj);
+            break;
+        }
+
+        case DRV_SPI_NOR_STATE_WRITE_CMD:
+        {
+            /* The flash starts the internal operation on CS de-assertion */
+            lDRV_SPI_NOR_ChipSelectDeassert(dObj);
+
+            dObj->lastTransferHandle = DRV_SPI_TRANSFER_HANDLE_INVALID;
+            dObj->state = DRV_SPI_NOR_STATE_WAIT_WIP_CLEAR;
+            break;
+        }
+
+        case DRV_SPI_NOR_STATE_READ_STATUS:
+        {
+            lDRV_SPI_NOR_ChipSelectDeassert(dObj);
+
+            dObj->lastTransferHandle = DRV_SPI_TRANSFER_HANDLE_INVALID;
+
+            if ((dObj->regRxBuffer[1] & DRV_SPI_NOR_STATUS_WIP_Msk) != 0U)
+            {
+                dObj->state = DRV_SPI_NOR_STATE_WAIT_WIP_CLEAR;
+            }
+            else
+            {
+                dObj->state = DRV_SPI_NOR_STATE_IDLE;
+                dObj->transferStatus = DRV_SPI_NOR_TRANSFER_COMPLETED;
+            }
+            break;
+        }
+
+        case DRV_SPI_NOR_STATE_READ_JEDEC_ID:
+        {
+            *dObj->jedecIdPtr = ((uint32_t)dObj->regRxBuffer[1]) |
+                                ((uint32_t)dObj->regRxBuffer[2] << 8) |
+                                ((uint32_t)dObj->regRxBuffer[3] << 16);
+
+            lDRV_SPI_NOR_CommandEnd(dObj, DRV_SPI_NOR_TRANSFER_COMPLETED);
+            break;
+        }
+
+        default:
+        {
+            /* Nothing to do */
+            break;
+        }
+    }
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: SPI NOR Driver Global Functions
+// *****************************************************************************
+// *****************************************************************************
+
+SYS_MODULE_OBJ DRV_SPI_NOR_Initialize
+(
+    const SYS_MODULE_INDEX drvIndex,
+    const SYS_MODULE_INIT *const init
+)
+{
+    DRV_SPI_NOR_OBJECT *dObj = NULL;
+    const DRV_SPI_NOR_INIT *spiNorInit = NULL;
+
+    /* Validate the driver index */
+    if (drvIndex >= DRV_SPI_NOR_INSTANCES_NUMBER)
+    {
+        return SYS_MODULE_OBJ_INVALID;
+    }
+
+    dObj = &gDrvSpiNorObj[drvIndex];
+
+    /* Check if the instance has already been initialized. */
+    if (dObj->inUse == true)
+    {
+        return SYS_MODULE_OBJ_INVALID;
+    }
+
+    spiNorInit = (const DRV_SPI_NOR_INIT *)init;
+
+    dObj->inUse                 = true;
+    dObj->isOpened              = false;
+    dObj->spiDrvIndex           = spiNorInit->spiDrvIndex;
+    dObj->spiHandle             = DRV_HANDLE_INVALID;
+    dObj->chipSelectPin         = spiNorInit->chipSelectPin;
+    dObj->clockSpeedHz          = spiNorInit->clockSpeedHz;
+    dObj->flashSize             = spiNorInit->flashSize;
+    dObj->state                 = DRV_SPI_NOR_STATE_IDLE;
+    dObj->transferStatus        = DRV_SPI_NOR_TRANSFER_COMPLETED;
+    dObj->lastTransferHandle    = DRV_SPI_TRANSFER_HANDLE_INVALID;
+
+    /* Keep the flash de-selected until the first command */
+    lDRV_SPI_NOR_ChipSelectDeassert(dObj);
+
+    dObj->status = SYS_STATUS_READY;
+
+    /* Return the driver index */
+    return (SYS_MODULE_OBJ)drvIndex;
+}
+
+SYS_STATUS DRV_SPI_NOR_Status( const SYS_MODULE_INDEX drvIndex )
+{
+    if (drvIndex >= DRV_SPI_NOR_INSTANCES_NUMBER)
+    {
+        return SYS_STATUS_UNINITIALIZED;
+    }
+
+    /* Return the driver status */
+    return (gDrvSpiNorObj[drvIndex].status);
+}
+
+DRV_HANDLE DRV_SPI_NOR_Open( const SYS_MODULE_INDEX drvIndex, const DRV_IO_INTENT ioIntent )
+{
+    DRV_SPI_NOR_OBJECT *dObj = NULL;
+    DRV_SPI_TRANSFER_SETUP setup;
+
+    if (drvIndex >= DRV_SPI_NOR_INSTANCES_NUMBER)
+    {
+        SYS_DEBUG_MESSAGE(SYS_ERROR_ERROR, "Invalid Driver Instance");
+        return DRV_HANDLE_INVALID;
+    }
+
+    dObj = &gDrvSpiNorObj[drvIndex];
+
+    if ((dObj->status != SYS_STATUS_READY) || (dObj->isOpened == true))
+    {
+        return DRV_HANDLE_INVALID;
+    }
+
+    /* The driver owns the chip select across transfers. Open the SPI driver
+     * exclusively so that no other client can interleave a transfer. */
+    dObj->spiHandle = DRV_SPI_Open(dObj->spiDrvIndex, (DRV_IO_INTENT)((uint32_t)DRV_IO_INTENT_READWRITE | (uint32_t)DRV_IO_INTENT_EXCLUSIVE));
+
+    if (dObj->spiHandle == DRV_HANDLE_INVALID)
+    {
+        SYS_DEBUG_MESSAGE(SYS_ERROR_ERROR, "SPI NOR: Failed to open SPI driver");
+        return DRV_HANDLE_INVALID;
+    }
+
+    /* SPI mode 0, 8-bit. CS is driven by this driver. */
+    setup.baudRateInHz      = dObj->clockSpeedHz;
+    setup.clockPhase        = DRV_SPI_CLOCK_PHASE_VALID_LEADING_EDGE;
+    setup.clockPolarity     = DRV_SPI_CLOCK_POLARITY_IDLE_LOW;
+    setup.dataBits          = DRV_SPI_DATA_BITS_8;
+    setup.chipSelect        = SYS_PORT_PIN_NONE;
+    setup.csPolarity        = DRV_SPI_CS_POLARITY_ACTIVE_LOW;
+
+    if (DRV_SPI_TransferSetup(dObj->spiHandle, &setup) == false)
+    {
+        DRV_SPI_Close(dObj->spiHandle);
+        dObj->spiHandle = DRV_HANDLE_INVALID;
+        return DRV_HANDLE_INVALID;
+    }
+
+    DRV_SPI_TransferEventHandlerSet(dObj->spiHandle, lDRV_SPI_NOR_EventHandler, (uintptr_t)dObj);
+
+    dObj->state             = DRV_SPI_NOR_STATE_IDLE;
+    dObj->transferStatus    = DRV_SPI_NOR_TRANSFER_COMPLETED;
+    dObj->isOpened          = true;
+
+    return ((DRV_HANDLE)drvIndex);
+}
+
+void DRV_SPI_NOR_Close( const DRV_HANDLE handle )
+{
+    DRV_SPI_NOR_OBJECT *dObj = lDRV_SPI_NOR_DriverHandleValidate(handle);
+
+    if (dObj == NULL)
+    {
+        return;
+    }
+
+    DRV_SPI_Close(dObj->spiHandle);
+
+    lDRV_SPI_NOR_ChipSelectDeassert(dObj);
+
+    dObj->spiHandle = DRV_HANDLE_INVALID;
+    dObj->state = DRV_SPI_NOR_STATE_IDLE;
+    dObj->isOpened = false;
+}
+
+bool DRV_SPI_NOR_ReadJedecId( const DRV_HANDLE handle, void *jedec_id )
+{
+    DRV_SPI_NOR_OBJECT *dObj = lDRV_SPI_NOR_DriverHandleValidate(handle);
+
+    if ((dObj == NULL) || (jedec_id == NULL) || (dObj->state != DRV_SPI_NOR_STATE_IDLE))
+    {
+        return false;
+    }
+
+    dObj->jedecIdPtr = (uint32_t *)jedec_id;
+    dObj->transferStatus = DRV_SPI_NOR_TRANSFER_BUSY;
+
+    dObj->regTxBuffer[0] = DRV_SPI_NOR_CMD_JEDEC_ID_READ;
+    dObj->regTxBuffer[1] = 0xFFU;
+    dObj->regTxBuffer[2] = 0xFFU;
+    dObj->regTxBuffer[3] = 0xFFU;
+
+    return lDRV_SPI_NOR_RegisterCommand(dObj, 4U, DRV_SPI_NOR_STATE_READ_JEDEC_ID);
+}
+
+bool DRV_SPI_NOR_SectorErase( const DRV_HANDLE handle, uint32_t address )
+{
+    DRV_SPI_NOR_OBJECT *dObj = lDRV_SPI_NOR_DriverHandleValidate(handle);
+
+    if ((dObj == NULL) || (dObj->state != DRV_SPI_NOR_STATE_IDLE) || (address >= dObj->flashSize))
+    {
+        return false;
+    }
+
+    lDRV_SPI_NOR_CommandHeaderBuild(dObj, DRV_SPI_NOR_CMD_SECTOR_ERASE, address & ~(DRV_SPI_NOR_SECTOR_SIZE - 1U));
+
+    return lDRV_SPI_NOR_WriteStart(dObj, NULL, 4U);
+}
+
+bool DRV_SPI_NOR_Read( const DRV_HANDLE handle, void *rx_data, uint32_t rx_data_length, uint32_t address )
+{
+    DRV_SPI_NOR_OBJECT *dObj = lDRV_SPI_NOR_DriverHandleValidate(handle);
+    DRV_SPI_TRANSFER_HANDLE transferHandle;
+
+    if ((dObj == NULL) || (rx_data == NULL) || (rx_data_length == 0U) || (dObj->state != DRV_SPI_NOR_STATE_IDLE))
+    {
+        return false;
+    }
+
+    if (((uint64_t)address + rx_data_length) > dObj->flashSize)
+    {
+        return false;
+    }
+
+    lDRV_SPI_NOR_CommandHeaderBuild(dObj, DRV_SPI_NOR_CMD_HIGH_SPEED_READ, address);
+
+    dObj->rxPtr = (uint8_t *)rx_data;
+    dObj->rxPending = rx_data_length;
+    dObj->transferStatus = DRV_SPI_NOR_TRANSFER_BUSY;
+    dObj->state = DRV_SPI_NOR_STATE_READ_DATA;
+
+    lDRV_SPI_NOR_ChipSelectAssert(dObj);
+
+    /* Command header first, then the data phase straight into the user buffer */
+    DRV_SPI_WriteTransferAdd(dObj->spiHandle, (void *)dObj->cmdBuffer, DRV_SPI_NOR_CMD_BUFFER_SIZE, &transferHandle);
+
+    if ((transferHandle == DRV_SPI_TRANSFER_HANDLE_INVALID) || (lDRV_SPI_NOR_ReadChunk(dObj) == false))
+    {
+        lDRV_SPI_NOR_CommandEnd(dObj, DRV_SPI_NOR_TRANSFER_ERROR_UNKNOWN);
+        return false;
+    }
+
+    return true;
+}
+
+bool DRV_SPI_NOR_PageWrite( const DRV_HANDLE handle, void *tx_data, uint32_t address )
+{
+    DRV_SPI_NOR_OBJECT *dObj = lDRV_SPI_NOR_DriverHandleValidate(handle);
+
+    if ((dObj == NULL) || (tx_data == NULL) || (dObj->state != DRV_SPI_NOR_STATE_IDLE))
+    {
+        return false;
+    }
+
+    if (((address & (DRV_SPI_NOR_PAGE_SIZE - 1U)) != 0U) || (address >= dObj->flashSize))
+    {
+        return false;
+    }
+
+    lDRV_SPI_NOR_CommandHeaderBuild(dObj, DRV_SPI_NOR_CMD_PAGE_PROGRAM, address);
+
+    return lDRV_SPI_NOR_WriteStart(dObj, (uint8_t *)tx_data, 4U);
+}
+
+DRV_SPI_NOR_TRANSFER_STATUS DRV_SPI_NOR_TransferStatusGet( const DRV_HANDLE handle )
+{
+    DRV_SPI_NOR_OBJECT *dObj = lDRV_SPI_NOR_DriverHandleValidate(handle);
+
+    if (dObj == NULL)
+    {
+        return DRV_SPI_NOR_TRANSFER_ERROR_UNKNOWN;
+    }
+
+    if (dObj->state == DRV_SPI_NOR_STATE_WAIT_WIP_CLEAR)
+    {
+        /* Issue one status register read per call while the flash is busy */
+        dObj->regTxBuffer[0] = DRV_SPI_NOR_CMD_READ_STATUS_REG;
+        dObj->regTxBuffer[1] = 0xFFU;
+
+        (void) lDRV_SPI_NOR_RegisterCommand(dObj, 2U, DRV_SPI_NOR_STATE_READ_STATUS);
+    }
+
+    return dObj->transferStatus;
+}
+
+bool DRV_SPI_NOR_GeometryGet( const DRV_HANDLE handle, DRV_SPI_NOR_GEOMETRY *geometry )
+{
+    DRV_SPI_NOR_OBJECT *dObj = lDRV_SPI_NOR_DriverHandleValidate(handle);
+
+    if ((dObj == NULL) || (geometry == NULL))
+    {
+        return false;
+    }
+
+    /* Read block size and number of blocks */
+    geometry->read_blockSize = 1;
+    geometry->read_numBlocks = dObj->flashSize;
+
+    /* Write block size and number of blocks */
+    geometry->write_blockSize = DRV_SPI_NOR_PAGE_SIZE;
+    geometry->write_numBlocks = (dObj->flashSize / DRV_SPI_NOR_PAGE_SIZE);
+
+    /* Erase block size and number of blocks */
+    geometry->erase_blockSize = DRV_SPI_NOR_SECTOR_SIZE;
+    geometry->erase_numBlocks = (dObj->flashSize / DRV_SPI_NOR_SECTOR_SIZE);
+
+    geometry->numReadRegions = 1;
+    geometry->numWriteRegions = 1;
+    geometry->numEraseRegions = 1;
+
+    geometry->blockStartAddress = 0;
+
+    return true;
+}
@@ -0,0 +1,172 @@
+/*******************************************************************************
+  SPI NOR Flash Driver Local Data Structures
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    drv_spi_nor_local.h
+
+  Summary:
+    SPI NOR flash driver local declarations and definitions
+
+  Description:
+    This file contains the SPI NOR flash driver's local declarations and
+    definitions.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+#ifndef DRV_SPI_NOR_LOCAL_H
+#define DRV_SPI_NOR_LOCAL_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File includes
+// *****************************************************************************
+// *****************************************************************************
+
+#include "configuration.h"
+#include "driver/spi/drv_spi.h"
+#include "driver/spi_nor/drv_spi_nor.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Data Type Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/* SPI NOR command set (JEDEC standard, 24-bit addressing) */
+#define DRV_SPI_NOR_CMD_WRITE_ENABLE            (0x06U)
+#define DRV_SPI_NOR_CMD_READ_STATUS_REG         (0x05U)
+#define DRV_SPI_NOR_CMD_HIGH_SPEED_READ         (0x0BU)
+#define DRV_SPI_NOR_CMD_PAGE_PROGRAM            (0x02U)
+#define DRV_SPI_NOR_CMD_SECTOR_ERASE            (0x20U)
+#define DRV_SPI_NOR_CMD_JEDEC_ID_READ           (0x9FU)
+
+/* Status register write-in-progress bit */
+#define DRV_SPI_NOR_STATUS_WIP_Msk              (0x01U)
+
+/* Opcode + 24-bit address + dummy byte of the high speed read command */
+#define DRV_SPI_NOR_CMD_BUFFER_SIZE             (5U)
+
+/* Largest data phase queued as a single SPI transfer. The DMAC block transfer
+ * count is 16-bit, so longer reads are split while CS remains asserted. */
+#define DRV_SPI_NOR_MAX_TRANSFER_SIZE           (32768U)
+
+/* SPI NOR Driver operation states */
+typedef enum
+{
+    /* No operation in progress */
+    DRV_SPI_NOR_STATE_IDLE = 0,
+
+    /* Read data phase in progress */
+    DRV_SPI_NOR_STATE_READ_DATA,
+
+    /* Write enable command in progress */
+    DRV_SPI_NOR_STATE_WRITE_ENABLE,
+
+    /* Page program or sector erase command in progress */
+    DRV_SPI_NOR_STATE_WRITE_CMD,
+
+    /* Flash is busy internally, status register is to be polled */
+    DRV_SPI_NOR_STATE_WAIT_WIP_CLEAR,
+
+    /* Status register read in progress */
+    DRV_SPI_NOR_STATE_READ_STATUS,
+
+    /* JEDEC ID read in progress */
+    DRV_SPI_NOR_STATE_READ_JEDEC_ID
+
+} DRV_SPI_NOR_STATE;
+
+/**************************************
+ * SPI NOR Driver Hardware Instance Object
+ **************************************/
+typedef struct
+{
+    /* Flag to indicate in use */
+    bool inUse;
+
+    /* Flag to indicate that the driver has been opened */
+    bool isOpened;
+
+    /* The status of the driver */
+    SYS_STATUS status;
+
+    /* Index of the SPI driver instance used by the flash */
+    SYS_MODULE_INDEX spiDrvIndex;
+
+    /* Handle to the SPI driver instance */
+    DRV_HANDLE spiHandle;
+
+    /* Chip select pin of the flash */
+    SYS_PORT_PIN chipSelectPin;
+
+    /* SPI clock frequency */
+    uint32_t clockSpeedHz;
+
+    /* Flash size in bytes */
+    uint32_t flashSize;
+
+    /* Current operation state, updated from the SPI driver event handler */
+    volatile DRV_SPI_NOR_STATE state;
+
+    /* Status of the last scheduled operation */
+    volatile DRV_SPI_NOR_TRANSFER_STATUS transferStatus;
+
+    /* Handle of the SPI transfer that completes the current command phase */
+    volatile DRV_SPI_TRANSFER_HANDLE lastTransferHandle;
+
+    /* Destination of the remaining read data */
+    uint8_t *rxPtr;
+
+    /* Number of bytes still to be read */
+    uint32_t rxPending;
+
+    /* Source of the page program data */
+    uint8_t *txPtr;
+
+    /* Length of the command header queued after write enable */
+    uint32_t cmdLength;
+
+    /* Pointer to the user buffer for the JEDEC ID */
+    uint32_t *jedecIdPtr;
+
+    /* Opcode, address and dummy byte of the current command */
+    uint8_t cmdBuffer[DRV_SPI_NOR_CMD_BUFFER_SIZE];
+
+    /* Buffers for single byte commands and register reads */
+    uint8_t regTxBuffer[4];
+    uint8_t regRxBuffer[4];
+
+} DRV_SPI_NOR_OBJECT;
+
+#endif //#ifndef DRV_SPI_NOR_LOCAL_H
+
+/*******************************************************************************
+ End of File
+*/
@@ -88,6 +88,23 @@ static DRV_MEMORY_CLIENT_OBJECT gDrvMemory0ClientObject[DRV_MEMORY_CLIENTS_NUMBE
 
 static DRV_MEMORY_BUFFER_OBJECT gDrvMemory0BufferObject[DRV_MEMORY_BUF_Q_SIZE_IDX0];
 
+#if defined(DRV_MEMORY_FTL_ENABLE)
+static uint16_t gDrvMemory0FtlMap[DRV_MEMORY_FTL_SECTORS_IDX0];
+
+static uint32_t gDrvMemory0FtlSlotMap[DRV_MEMORY_FTL_SLOT_MAP_SIZE(DRV_MEMORY_DEVICE_MEDIA_SIZE_BYTES)];
+
+static uint32_t gDrvMemory0FtlPageBuffer[DRV_MEMORY_DEVICE_PROGRAM_SIZE / 4U] CACHE_ALIGN;
+
+static DRV_MEMORY_FTL_OBJECT gDrvMemory0FtlObject =
+{
+    .map                        = &gDrvMemory0FtlMap[0],
+    .slotMap                    = &gDrvMemory0FtlSlotMap[0],
+    .pageBuffer                 = (uint8_t *)&gDrvMemory0FtlPageBuffer[0],
+    .nSectors                   = DRV_MEMORY_FTL_SECTORS_IDX0,
+    .journalBlocks              = DRV_MEMORY_FTL_JOURNAL_BLOCKS_IDX0
+};
+#endif
+
 static const DRV_MEMORY_DEVICE_INTERFACE drvMemory0DeviceAPI = {
     .Open               = DRV_NVMCTRL_Open,
     .Close              = DRV_NVMCTRL_Close,
@@ -110,7 +127,139 @@ static const DRV_MEMORY_INIT drvMemory0InitData =
     .clientObjPool              = (uintptr_t)&gDrvMemory0ClientObject[0],
     .bufferObj                  = (uintptr_t)&gDrvMemory0BufferObject[0],
     .queueSize                  = DRV_MEMORY_BUF_Q_SIZE_IDX0,
-    .nClientsMax                = DRV_MEMORY_CLIENTS_NUMBER_IDX0
+    .nClientsMax                = DRV_MEMORY_CLIENTS_NUMBER_IDX0,
+#if defined(DRV_MEMORY_FTL_ENABLE)
+    .ftlObj                     = (uintptr_t)&gDrvMemory0FtlObject
+#else
+    .ftlObj                     = 0U
+#endif
+};
+
+// </editor-fold>
+// <editor-fold defaultstate="collapsed" desc="DRV_SPI Instance 0 Initialization Data">
+
+/* SPI Client Objects Pool */
+static DRV_SPI_CLIENT_OBJ drvSPI0ClientObjPool[DRV_SPI_CLIENTS_NUMBER_IDX0];
+
+/* SPI Transfer Objects Pool */
+static DRV_SPI_TRANSFER_OBJ drvSPI0TransferObjPool[DRV_SPI_QUEUE_SIZE_IDX0];
+
+/* SPI PLIB Interface Initialization */
+static const DRV_SPI_PLIB_INTERFACE drvSPI0PlibAPI = {
+
+    /* SPI PLIB Setup */
+    .setup = (DRV_SPI_PLIB_SETUP)SERCOM1_SPI_TransferSetup,
+
+    /* SPI PLIB WriteRead function */
+    .writeRead = (DRV_SPI_PLIB_WRITE_READ)SERCOM1_SPI_WriteRead,
+
+    /* SPI PLIB Transfer Status function */
+    .isTransmitterBusy = (DRV_SPI_PLIB_TRANSMITTER_IS_BUSY)SERCOM1_SPI_IsTransmitterBusy,
+
+    /* SPI PLIB Callback Register */
+    .callbackRegister = (DRV_SPI_PLIB_CALLBACK_REGISTER)SERCOM1_SPI_CallbackRegister,
+};
+
+static const uint32_t drvSPI0remapDataBits[]= { 0x0, 0x1, 0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU };
+static const uint32_t drvSPI0remapClockPolarity[] = { 0x0, 0x20000000 };
+static const uint32_t drvSPI0remapClockPhase[] = { 0x10000000, 0x0 };
+
+static const DRV_SPI_INTERRUPT_SOURCES drvSPI0InterruptSources =
+{
+    /* Peripheral has single interrupt vector */
+    .isSingleIntSrc                        = true,
+
+    /* Peripheral interrupt line */
+    .intSources.spiInterrupt             = (int32_t)SERCOM1_IRQn,
+    /* DMA interrupt line */
+    .intSources.dmaInterrupt               = (int32_t)DMAC_IRQn,
+};
+
+/* SPI Driver Initialization Data */
+static const DRV_SPI_INIT drvSPI0InitData =
+{
+    /* SPI PLIB API */
+    .spiPlib = &drvSPI0PlibAPI,
+
+    .remapDataBits = drvSPI0remapDataBits,
+
+    .remapClockPolarity = drvSPI0remapClockPolarity,
+
+    .remapClockPhase = drvSPI0remapClockPhase,
+
+    /* SPI Number of clients */
+    .numClients = DRV_SPI_CLIENTS_NUMBER_IDX0,
+
+    /* SPI Client Objects Pool */
+    .clientObjPool = (uintptr_t)&drvSPI0ClientObjPool[0],
+
+    /* DMA Channel for Transmit */
+    .dmaChannelTransmit = DRV_SPI_XMIT_DMA_CH_IDX0,
+
+    /* DMA Channel for Receive */
+    .dmaChannelReceive  = DRV_SPI_RCV_DMA_CH_IDX0,
+
+    /* SPI Transmit Register */
+    .spiTransmitAddress =  (void *)&(SERCOM1_REGS->SPIM.SERCOM_DATA),
+
+    /* SPI Receive Register */
+    .spiReceiveAddress  = (void *)&(SERCOM1_REGS->SPIM.SERCOM_DATA),
+
+    /* SPI Queue Size */
+    .transferObjPoolSize = DRV_SPI_QUEUE_SIZE_IDX0,
+
+    /* SPI Transfer Objects Pool */
+    .transferObjPool = (uintptr_t)&drvSPI0TransferObjPool[0],
+
+    /* SPI interrupt sources (SPI peripheral and DMA) */
+    .interruptSources = &drvSPI0InterruptSources,
+
+    /* SPI Hardware Chip Select */
+    .hardwareChipSelect = SYS_PORT_PIN_NONE,
+};
+// </editor-fold>
+// <editor-fold defaultstate="collapsed" desc="DRV_SPI_NOR Initialization Data">
+
+static const DRV_SPI_NOR_INIT drvSpiNorInitData =
+{
+    .spiDrvIndex                = DRV_SPI_INDEX_0,
+    .chipSelectPin              = SYS_PORT_PIN_PA17,
+    .clockSpeedHz               = DRV_SPI_NOR_CLOCK_SPEED_HZ,
+    .flashSize                  = DRV_SPI_NOR_FLASH_SIZE_BYTES,
+};
+
+// </editor-fold>
+// <editor-fold defaultstate="collapsed" desc="DRV_MEMORY Instance 1 Initialization Data">
+
+static uint8_t gDrvMemory1EraseBuffer[DRV_SPI_NOR_ERASE_BUFFER_SIZE] CACHE_ALIGN;
+
+static DRV_MEMORY_CLIENT_OBJECT gDrvMemory1ClientObject[DRV_MEMORY_CLIENTS_NUMBER_IDX1];
+
+static DRV_MEMORY_BUFFER_OBJECT gDrvMemory1BufferObject[DRV_MEMORY_BUF_Q_SIZE_IDX1];
+
+static const DRV_MEMORY_DEVICE_INTERFACE drvMemory1DeviceAPI = {
+    .Open               = DRV_SPI_NOR_Open,
+    .Close              = DRV_SPI_NOR_Close,
+    .Status             = DRV_SPI_NOR_Status,
+    .SectorErase        = DRV_SPI_NOR_SectorErase,
+    .Read               = DRV_SPI_NOR_Read,
+    .PageWrite          = DRV_SPI_NOR_PageWrite,
+    .EventHandlerSet    = NULL,
+    .GeometryGet        = (DRV_MEMORY_DEVICE_GEOMETRY_GET)DRV_SPI_NOR_GeometryGet,
+    .TransferStatusGet  = (DRV_MEMORY_DEVICE_TRANSFER_STATUS_GET)DRV_SPI_NOR_TransferStatusGet
+};
+static const DRV_MEMORY_INIT drvMemory1InitData =
+{
+    .memDevIndex                = DRV_SPI_NOR_INDEX,
+    .memoryDevice               = &drvMemory1DeviceAPI,
+    .isMemDevInterruptEnabled   = false,
+    .isFsEnabled                = true,
+    .deviceMediaType            = (uint8_t)SYS_FS_MEDIA_TYPE_SPIFLASH,
+    .ewBuffer                   = &gDrvMemory1EraseBuffer[0],
+    .clientObjPool              = (uintptr_t)&gDrvMemory1ClientObject[0],
+    .bufferObj                  = (uintptr_t)&gDrvMemory1BufferObject[0],
+    .queueSize                  = DRV_MEMORY_BUF_Q_SIZE_IDX1,
+    .nClientsMax                = DRV_MEMORY_CLIENTS_NUMBER_IDX1
 };
 
 // </editor-fold>
@@ -173,7 +322,13 @@ static const SYS_FS_FUNCTIONS FatFsFunctions =
     .testerror         = FATFS_error,
     .formatDisk        = (FORMAT_DISK)FATFS_mkfs,
     .partitionDisk     = FATFS_fdisk,
-    .getCluster        = FATFS_getclusters
+    .getCluster        = FATFS_getclusters,
+    .seekIndex         = FATFS_linkmap,
+    .allocate          = FATFS_expand,
+    .extentGet         = FATFS_extent,
+    .sectorTransfer    = FATFS_transfer,
+    .sectorTransferStatus = FATFS_transferstatus,
+    .freeScan          = FATFS_freescan
 };
 
 
@@ -237,6 +392,14 @@ void SYS_Initialize ( void* data )
 
     EVSYS_Initialize();
 
+    SERCOM1_SPI_Initialize();
+
+    DMAC_Initialize();
+
+    SYS_DMA_CRCInitialize();
+
+    SYS_DMA_MemInitialize();
+
 	BSP_Initialize();
 
     /* MISRAC 2012 deviation block start */
@@ -247,6 +410,13 @@ void SYS_Initialize ( void* data )
 
     sysObj.drvMemory0 = DRV_MEMORY_Initialize((SYS_MODULE_INDEX)DRV_MEMORY_INDEX_0, (SYS_MODULE_INIT *)&drvMemory0InitData);
 
+    /* Initialize SPI0 Driver Instance */
+    sysObj.drvSPI0 = DRV_SPI_Initialize(DRV_SPI_INDEX_0, (SYS_MODULE_INIT *)&drvSPI0InitData);
+
+    sysObj.drvSpiNor = DRV_SPI_NOR_Initialize((SYS_MODULE_INDEX)DRV_SPI_NOR_INDEX, (SYS_MODULE_INIT *)&drvSpiNorInitData);
+
+    sysObj.drvMemory1 = DRV_MEMORY_Initialize((SYS_MODULE_INDEX)DRV_MEMORY_INDEX_1, (SYS_MODULE_INIT *)&drvMemory1InitData);
+
 
 
     /*** File System Service Initialization Code ***/
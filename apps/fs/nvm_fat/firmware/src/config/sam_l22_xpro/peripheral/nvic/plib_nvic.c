@@ -57,6 +57,10 @@ void NVIC_Initialize( void )
 
     /* Enable the interrupt sources and configure the priorities as configured
      * from within the "Interrupt Manager" of MHC. */
+    NVIC_SetPriority(DMAC_IRQn, 3);
+    NVIC_EnableIRQ(DMAC_IRQn);
+    NVIC_SetPriority(SERCOM1_IRQn, 3);
+    NVIC_EnableIRQ(SERCOM1_IRQn);
 
 
 
@@ -71,6 +71,15 @@
 void PORT_Initialize(void)
 {
    /************************** GROUP 0 Initialization *************************/
+   PORT_REGS->GROUP[0].PORT_DIR = 0x20000U;
+   PORT_REGS->GROUP[0].PORT_OUT = 0x20000U;
+   PORT_REGS->GROUP[0].PORT_PINCFG[16] = 0x1U;
+   PORT_REGS->GROUP[0].PORT_PINCFG[17] = 0x0U;
+   PORT_REGS->GROUP[0].PORT_PINCFG[18] = 0x1U;
+   PORT_REGS->GROUP[0].PORT_PINCFG[19] = 0x1U;
+
+   PORT_REGS->GROUP[0].PORT_PMUX[8] = 0x2U;
+   PORT_REGS->GROUP[0].PORT_PMUX[9] = 0x22U;
 
 
    /************************** GROUP 1 Initialization *************************/
@@ -0,0 +1,982 @@
+/*******************************************************************************
+  DMA System Service Library Implementation Source File
+
+  Company
+    Microchip Technology Inc.
+
+  File Name
+    sys_dma.c
+
+  Summary
+    DMA system service library interface implementation.
+
+  Description
+    This file implements the interface to the DMA system service library.
+
+  Remarks:
+    DMA controller initialize will be done from within the MCC.
+
+*******************************************************************************/
+
+// DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include <string.h>
+#include "configuration.h"
+#include "system/dma/sys_dma.h"
+#include "system/int/sys_int.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: DMA Channel Pool Data
+// *****************************************************************************
+// *****************************************************************************
+
+/* Channels of the pool handed out by SYS_DMA_ChannelAllocate */
+static bool gSysDmaChannelAllocated[SYS_DMA_CHANNEL_POOL_SIZE];
+
+/* Set while a user owns the DMA CRC engine */
+static bool gSysDmaCRCEngineBusy = false;
+
+#if defined(SYS_DMA_CRC_QUEUE_SIZE)
+// *****************************************************************************
+// *****************************************************************************
+// Section: DMA CRC Service Data
+// *****************************************************************************
+// *****************************************************************************
+
+/* Largest number of beats of one DMA block transfer */
+#define SYS_DMA_CRC_BLOCK_BEATS_MAX     (0xFFFFU)
+
+/* CRC request queued with SYS_DMA_CRCRequestAdd */
+typedef struct
+{
+    const uint8_t*          buffer;
+
+    size_t                  length;
+
+    SYS_DMA_CRC_SETUP       crcSetup;
+
+    SYS_DMA_CRC_CALLBACK    callback;
+
+    uintptr_t               context;
+
+} SYS_DMA_CRC_REQUEST;
+
+typedef struct
+{
+    /* Queued requests, the one at head is being processed */
+    SYS_DMA_CRC_REQUEST     queue[SYS_DMA_CRC_QUEUE_SIZE];
+
+    uint32_t                head;
+
+    uint32_t                nRequests;
+
+    /* Bytes of the current request already handed to the DMA */
+    size_t                  offset;
+
+    /* Log2 of the beat size of the current request */
+    uint32_t                beatShift;
+
+    /* Destination of the DMA transfers, the data is discarded */
+    uint32_t                sink;
+
+    /* Pool channel used while requests are queued */
+    SYS_DMA_CHANNEL         channel;
+
+} SYS_DMA_CRC_OBJ;
+
+static SYS_DMA_CRC_OBJ gSysDmaCRCObj;
+#endif
+
+#if defined(SYS_DMA_MEM_QUEUE_SIZE)
+// *****************************************************************************
+// *****************************************************************************
+// Section: DMA Memory Service Data
+// *****************************************************************************
+// *****************************************************************************
+
+/* Largest number of beats of one DMA block transfer */
+#define SYS_DMA_MEM_BLOCK_BEATS_MAX     (0xFFFFU)
+
+/* Copy or fill request queued with SYS_DMA_MemCopyAsync or SYS_DMA_MemSetAsync */
+typedef struct
+{
+    uint8_t*                dest;
+
+    /* Source of a copy, NULL for a fill */
+    const uint8_t*          source;
+
+    size_t                  length;
+
+    /* Fill value repeated in each byte, read by the DMA for the whole fill */
+    uint32_t                pattern;
+
+    SYS_DMA_MEM_CALLBACK    callback;
+
+    uintptr_t               context;
+
+} SYS_DMA_MEM_REQUEST;
+
+typedef struct
+{
+    /* Queued requests, the one at head is being processed */
+    SYS_DMA_MEM_REQUEST     queue[SYS_DMA_MEM_QUEUE_SIZE];
+
+    uint32_t                head;
+
+    uint32_t                nRequests;
+
+    /* Bytes of the current request already handed to the DMA */
+    size_t                  offset;
+
+    /* Log2 of the beat size of the current request */
+    uint32_t                beatShift;
+
+    /* Pool channel used while requests are queued */
+    SYS_DMA_CHANNEL         channel;
+
+} SYS_DMA_MEM_OBJ;
+
+static SYS_DMA_MEM_OBJ gSysDmaMemObj;
+#endif
+
+//******************************************************************************
+/* Function:
+    void SYS_DMA_AddressingModeSetup(SYS_DMA_CHANNEL channel, SYS_DMA_SOURCE_ADDRESSING_MODE sourceAddrMode, SYS_DMA_DESTINATION_ADDRESSING_MODE destAddrMode);
+
+  Summary:
+    Setup addressing mode of selected DMA channel.
+
+  Remarks:
+    Check sys_dma.h for more info.
+*/
+void SYS_DMA_AddressingModeSetup(SYS_DMA_CHANNEL channel, SYS_DMA_SOURCE_ADDRESSING_MODE sourceAddrMode, SYS_DMA_DESTINATION_ADDRESSING_MODE destAddrMode)
+{
+	uint32_t config;
+
+    config = (uint32_t)DMAC_ChannelSettingsGet((DMAC_CHANNEL)channel);
+    config &= ~(0x400U | 0x800U);
+
+    config |= (uint32_t)sourceAddrMode | (uint32_t)destAddrMode;
+
+    (void) DMAC_ChannelSettingsSet((DMAC_CHANNEL)channel, (DMAC_CHANNEL_CONFIG)config);
+}
+
+//******************************************************************************
+/* Function:
+    void SYS_DMA_DataWidthSetup(SYS_DMA_CHANNEL channel, SYS_DMA_WIDTH dataWidth);
+
+  Summary:
+    Setup data width of selected DMA channel.
+
+  Remarks:
+    Check sys_dma.h for more info.
+*/
+void SYS_DMA_DataWidthSetup(SYS_DMA_CHANNEL channel, SYS_DMA_WIDTH dataWidth)
+{
+	uint32_t config;
+
+    config = (uint32_t)DMAC_ChannelSettingsGet((DMAC_CHANNEL)channel);
+
+    config &= ~(0x300U);
+    config |= (uint32_t)dataWidth;
+
+    (void) DMAC_ChannelSettingsSet((DMAC_CHANNEL)channel, (DMAC_CHANNEL_CONFIG)config);
+}
+
+//******************************************************************************
+/* Function:
+    void SYS_DMA_ChannelCRCSetup(SYS_DMA_CHANNEL channel, SYS_DMA_CRC_SETUP crcSetup);
+
+  Summary:
+    Attaches the DMA CRC engine to the selected DMA channel.
+
+  Remarks:
+    Check sys_dma.h for more info.
+*/
+void SYS_DMA_ChannelCRCSetup(SYS_DMA_CHANNEL channel, SYS_DMA_CRC_SETUP crcSetup)
+{
+    DMAC_CRC_SETUP dmacCRCSetup;
+
+    dmacCRCSetup.polynomial_type = (DMAC_CRC_POLYNOMIAL_TYPE)crcSetup.polynomialType;
+    dmacCRCSetup.seed = crcSetup.seed;
+
+    DMAC_ChannelCRCSetup((DMAC_CHANNEL)channel, dmacCRCSetup);
+}
+
+//******************************************************************************
+/* Function:
+    bool SYS_DMA_CRCEngineAcquire(void);
+
+  Summary:
+    Takes ownership of the DMA CRC engine.
+
+  Remarks:
+    Check sys_dma.h for more info.
+*/
+bool SYS_DMA_CRCEngineAcquire(void)
+{
+    bool interruptState;
+    bool isAcquired = false;
+
+    /* The engine is taken from task and interrupt contexts */
+    interruptState = SYS_INT_Disable();
+
+    if (gSysDmaCRCEngineBusy == false)
+    {
+        gSysDmaCRCEngineBusy = true;
+        isAcquired = true;
+    }
+
+    SYS_INT_Restore(interruptState);
+
+    return isAcquired;
+}
+
+//******************************************************************************
+/* Function:
+    void SYS_DMA_CRCEngineRelease(void);
+
+  Summary:
+    Disables the DMA CRC engine and gives up its ownership.
+
+  Remarks:
+    Check sys_dma.h for more info.
+*/
+void SYS_DMA_CRCEngineRelease(void)
+{
+    SYS_DMA_CRCDisable();
+
+    gSysDmaCRCEngineBusy = false;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: DMA Channel Pool Implementation
+// *****************************************************************************
+// *****************************************************************************
+
+//******************************************************************************
+/* Function:
+    SYS_DMA_CHANNEL SYS_DMA_ChannelAllocate(uint32_t triggerSource,
+        SYS_DMA_PRIORITY priority);
+
+  Summary:
+    Takes a free channel from the DMA channel pool.
+
+  Remarks:
+    Check sys_dma.h for more info.
+*/
+SYS_DMA_CHANNEL SYS_DMA_ChannelAllocate(uint32_t triggerSource, SYS_DMA_PRIORITY priority)
+{
+    SYS_DMA_CHANNEL channel = SYS_DMA_CHANNEL_NONE;
+    bool interruptState;
+    uint32_t i;
+
+    /* The pool is also updated from interrupt contexts */
+    interruptState = SYS_INT_Disable();
+
+    for (i = 0U; i < SYS_DMA_CHANNEL_POOL_SIZE; i++)
+    {
+        if (gSysDmaChannelAllocated[i] == false)
+        {
+            gSysDmaChannelAllocated[i] = true;
+            channel = (SYS_DMA_CHANNEL)((uint32_t)SYS_DMA_CHANNEL_POOL_FIRST + i);
+            break;
+        }
+    }
+
+    SYS_INT_Restore(interruptState);
+
+    if (channel != SYS_DMA_CHANNEL_NONE)
+    {
+        DMAC_ChannelSetup((DMAC_CHANNEL)channel, triggerSource, (uint32_t)priority);
+    }
+
+    return channel;
+}
+
+//******************************************************************************
+/* Function:
+    void SYS_DMA_ChannelRelease(SYS_DMA_CHANNEL channel);
+
+  Summary:
+    Gives a channel back to the DMA channel pool.
+
+  Remarks:
+    Check sys_dma.h for more info.
+*/
+void SYS_DMA_ChannelRelease(SYS_DMA_CHANNEL channel)
+{
+    uint32_t index = (uint32_t)channel - (uint32_t)SYS_DMA_CHANNEL_POOL_FIRST;
+    bool interruptState;
+
+    /* Channels below the pool wrap around to large indexes */
+    if (index >= SYS_DMA_CHANNEL_POOL_SIZE)
+    {
+        return;
+    }
+
+    interruptState = SYS_INT_Disable();
+
+    if (gSysDmaChannelAllocated[index] == true)
+    {
+        DMAC_ChannelFree((DMAC_CHANNEL)channel);
+
+        gSysDmaChannelAllocated[index] = false;
+    }
+
+    SYS_INT_Restore(interruptState);
+}
+
+#if defined(SYS_DMA_CRC_QUEUE_SIZE)
+// *****************************************************************************
+// *****************************************************************************
+// Section: DMA CRC Service Implementation
+// *****************************************************************************
+// *****************************************************************************
+
+/* Hands the next block of the current request to the DMA. A request longer
+ * than one block is sent in several blocks; the CRC engine keeps its checksum
+ * between them. */
+static bool lSYS_DMA_CRCBlockStart(SYS_DMA_CRC_OBJ* crcObj)
+{
+    const SYS_DMA_CRC_REQUEST* request = &crcObj->queue[crcObj->head];
+    size_t blockSize = request->length - crcObj->offset;
+    size_t blockSizeMax = (size_t)SYS_DMA_CRC_BLOCK_BEATS_MAX << crcObj->beatShift;
+    const uint8_t* blockStart = &request->buffer[crcObj->offset];
+
+    if (blockSize > blockSizeMax)
+    {
+        blockSize = blockSizeMax;
+    }
+
+    crcObj->offset += blockSize;
+
+    return SYS_DMA_ChannelTransfer(crcObj->channel, blockStart, &crcObj->sink, blockSize);
+}
+
+/* Gives the channel and the CRC engine taken for a burst of requests back */
+static void lSYS_DMA_CRCChannelRelease(SYS_DMA_CRC_OBJ* crcObj)
+{
+    SYS_DMA_ChannelRelease(crcObj->channel);
+
+    crcObj->channel = SYS_DMA_CHANNEL_NONE;
+
+    SYS_DMA_CRCEngineRelease();
+}
+
+static bool lSYS_DMA_CRCRequestStart(SYS_DMA_CRC_OBJ* crcObj)
+{
+    const SYS_DMA_CRC_REQUEST* request = &crcObj->queue[crcObj->head];
+    uint32_t alignment = (uint32_t)request->buffer | (uint32_t)request->length;
+    SYS_DMA_WIDTH width;
+
+    /* Use the widest beat the buffer address and length allow */
+    if ((alignment & 0x3U) == 0U)
+    {
+        width = SYS_DMA_WIDTH_32_BIT;
+        crcObj->beatShift = 2U;
+    }
+    else if ((alignment & 0x1U) == 0U)
+    {
+        width = SYS_DMA_WIDTH_16_BIT;
+        crcObj->beatShift = 1U;
+    }
+    else
+    {
+        width = SYS_DMA_WIDTH_8_BIT;
+        crcObj->beatShift = 0U;
+    }
+
+    SYS_DMA_AddressingModeSetup(crcObj->channel, SYS_DMA_SOURCE_ADDRESSING_MODE_INCREMENTED, SYS_DMA_DESTINATION_ADDRESSING_MODE_FIXED);
+
+    SYS_DMA_DataWidthSetup(crcObj->channel, width);
+
+    SYS_DMA_ChannelCRCSetup(crcObj->channel, request->crcSetup);
+
+    crcObj->offset = 0U;
+
+    return lSYS_DMA_CRCBlockStart(crcObj);
+}
+
+/* Removes the request at the head of the queue, starts the next one or gives
+ * the channel back to the pool, and returns the result to the client */
+static void lSYS_DMA_CRCRequestComplete(SYS_DMA_CRC_OBJ* crcObj, SYS_DMA_TRANSFER_EVENT event)
+{
+    SYS_DMA_CRC_REQUEST request;
+    uint32_t crc;
+    bool isNextStarted;
+
+    do
+    {
+        request = crcObj->queue[crcObj->head];
+        crc = SYS_DMA_CRCRead();
+
+        SYS_DMA_CRCDisable();
+
+        crcObj->head = (crcObj->head + 1U) % SYS_DMA_CRC_QUEUE_SIZE;
+        crcObj->nRequests--;
+
+        if (crcObj->nRequests == 0U)
+        {
+            /* Released before the callback, which may queue a new request */
+            lSYS_DMA_CRCChannelRelease(crcObj);
+            isNextStarted = true;
+        }
+        else
+        {
+            isNextStarted = lSYS_DMA_CRCRequestStart(crcObj);
+        }
+
+        if (request.callback != NULL)
+        {
+            request.callback(event, crc, request.context);
+        }
+
+        /* The DMA refused the next request, fail it as well */
+        event = SYS_DMA_TRANSFER_ERROR;
+
+    } while (isNextStarted == false);
+}
+
+static void lSYS_DMA_CRCEventHandler(SYS_DMA_TRANSFER_EVENT event, uintptr_t context)
+{
+    SYS_DMA_CRC_OBJ* crcObj = &gSysDmaCRCObj;
+
+    (void)context;
+
+    if (crcObj->nRequests == 0U)
+    {
+        return;
+    }
+
+    if ((event == SYS_DMA_TRANSFER_COMPLETE) && (crcObj->offset < crcObj->queue[crcObj->head].length))
+    {
+        if (lSYS_DMA_CRCBlockStart(crcObj) == true)
+        {
+            return;
+        }
+
+        event = SYS_DMA_TRANSFER_ERROR;
+    }
+
+    lSYS_DMA_CRCRequestComplete(crcObj, event);
+}
+
+//******************************************************************************
+/* Function:
+    void SYS_DMA_CRCInitialize(void);
+
+  Summary:
+    Initializes the DMA CRC service.
+
+  Remarks:
+    Check sys_dma.h for more info.
+*/
+void SYS_DMA_CRCInitialize(void)
+{
+    (void) memset(&gSysDmaCRCObj, 0, sizeof(gSysDmaCRCObj));
+
+    gSysDmaCRCObj.channel = SYS_DMA_CHANNEL_NONE;
+}
+
+//******************************************************************************
+/* Function:
+    bool SYS_DMA_CRCRequestAdd(const void* buffer, size_t length,
+        SYS_DMA_CRC_SETUP crcSetup, SYS_DMA_CRC_CALLBACK callback,
+        uintptr_t context);
+
+  Summary:
+    Queues the CRC computation of a buffer.
+
+  Remarks:
+    Check sys_dma.h for more info.
+*/
+bool SYS_DMA_CRCRequestAdd(const void* buffer, size_t length, SYS_DMA_CRC_SETUP crcSetup, SYS_DMA_CRC_CALLBACK callback, uintptr_t context)
+{
+    SYS_DMA_CRC_OBJ* crcObj = &gSysDmaCRCObj;
+    SYS_DMA_CRC_REQUEST* request;
+    bool interruptState;
+    bool status = false;
+
+    if ((buffer == NULL) || (length == 0U))
+    {
+        return false;
+    }
+
+    /* The queue is also updated from the DMA interrupt */
+    interruptState = SYS_INT_SourceDisable(DMAC_IRQn);
+
+    if ((crcObj->nRequests == 0U) && (crcObj->channel == SYS_DMA_CHANNEL_NONE))
+    {
+        /* The service was idle, take the CRC engine and a channel for the
+         * new burst. The engine may be owned by a driver computing the CRC
+         * of its own transfers; it is not taken away from it. */
+        if (SYS_DMA_CRCEngineAcquire() == true)
+        {
+            crcObj->channel = SYS_DMA_ChannelAllocate(SYS_DMA_TRIGGER_SOFTWARE, SYS_DMA_CRC_PRIORITY);
+
+            if (crcObj->channel != SYS_DMA_CHANNEL_NONE)
+            {
+                SYS_DMA_ChannelCallbackRegister(crcObj->channel, lSYS_DMA_CRCEventHandler, 0);
+            }
+            else
+            {
+                SYS_DMA_CRCEngineRelease();
+            }
+        }
+    }
+
+    if ((crcObj->channel != SYS_DMA_CHANNEL_NONE) && (crcObj->nRequests < SYS_DMA_CRC_QUEUE_SIZE))
+    {
+        request = &crcObj->queue[(crcObj->head + crcObj->nRequests) % SYS_DMA_CRC_QUEUE_SIZE];
+
+        request->buffer   = (const uint8_t*)buffer;
+        request->length   = length;
+        request->crcSetup = crcSetup;
+        request->callback = callback;
+        request->context  = context;
+
+        crcObj->nRequests++;
+        status = true;
+
+        if (crcObj->nRequests == 1U)
+        {
+            /* The service was idle */
+            if (lSYS_DMA_CRCRequestStart(crcObj) == false)
+            {
+                crcObj->nRequests = 0U;
+                lSYS_DMA_CRCChannelRelease(crcObj);
+                status = false;
+            }
+        }
+    }
+
+    SYS_INT_SourceRestore(DMAC_IRQn, interruptState);
+
+    return status;
+}
+#endif
+
+#if defined(SYS_DMA_MEM_QUEUE_SIZE)
+// *****************************************************************************
+// *****************************************************************************
+// Section: DMA Memory Service Implementation
+// *****************************************************************************
+// *****************************************************************************
+
+/* Hands the next block of the current request to the DMA */
+static bool lSYS_DMA_MemBlockStart(SYS_DMA_MEM_OBJ* memObj)
+{
+    const SYS_DMA_MEM_REQUEST* request = &memObj->queue[memObj->head];
+    size_t blockSize = request->length - memObj->offset;
+    size_t blockSizeMax = (size_t)SYS_DMA_MEM_BLOCK_BEATS_MAX << memObj->beatShift;
+    const void* source = &request->pattern;
+
+    if (request->source != NULL)
+    {
+        source = &request->source[memObj->offset];
+    }
+
+    if (blockSize > blockSizeMax)
+    {
+        blockSize = blockSizeMax;
+    }
+
+    memObj->offset += blockSize;
+
+    return SYS_DMA_ChannelTransfer(memObj->channel, source, &request->dest[memObj->offset - blockSize], blockSize);
+}
+
+static bool lSYS_DMA_MemRequestStart(SYS_DMA_MEM_OBJ* memObj)
+{
+    const SYS_DMA_MEM_REQUEST* request = &memObj->queue[memObj->head];
+    uint32_t alignment = (uint32_t)request->dest | (uint32_t)request->length;
+    SYS_DMA_SOURCE_ADDRESSING_MODE sourceAddrMode = SYS_DMA_SOURCE_ADDRESSING_MODE_FIXED;
+    SYS_DMA_WIDTH width;
+
+    if (request->source != NULL)
+    {
+        alignment |= (uint32_t)request->source;
+        sourceAddrMode = SYS_DMA_SOURCE_ADDRESSING_MODE_INCREMENTED;
+    }
+
+    /* Use the widest beat the addresses and length allow */
+    if ((alignment & 0x3U) == 0U)
+    {
+        width = SYS_DMA_WIDTH_32_BIT;
+        memObj->beatShift = 2U;
+    }
+    else if ((alignment & 0x1U) == 0U)
+    {
+        width = SYS_DMA_WIDTH_16_BIT;
+        memObj->beatShift = 1U;
+    }
+    else
+    {
+        width = SYS_DMA_WIDTH_8_BIT;
+        memObj->beatShift = 0U;
+    }
+
+    SYS_DMA_AddressingModeSetup(memObj->channel, sourceAddrMode, SYS_DMA_DESTINATION_ADDRESSING_MODE_INCREMENTED);
+
+    SYS_DMA_DataWidthSetup(memObj->channel, width);
+
+    memObj->offset = 0U;
+
+    return lSYS_DMA_MemBlockStart(memObj);
+}
+
+static void lSYS_DMA_MemChannelRelease(SYS_DMA_MEM_OBJ* memObj)
+{
+    SYS_DMA_ChannelRelease(memObj->channel);
+
+    memObj->channel = SYS_DMA_CHANNEL_NONE;
+}
+
+/* Removes the request at the head of the queue, starts the next one or gives
+ * the channel back to the pool, and notifies the client */
+static void lSYS_DMA_MemRequestComplete(SYS_DMA_MEM_OBJ* memObj, SYS_DMA_TRANSFER_EVENT event)
+{
+    SYS_DMA_MEM_REQUEST request;
+    bool isNextStarted;
+
+    do
+    {
+        request = memObj->queue[memObj->head];
+
+        memObj->head = (memObj->head + 1U) % SYS_DMA_MEM_QUEUE_SIZE;
+        memObj->nRequests--;
+
+        if (memObj->nRequests == 0U)
+        {
+            /* Released before the callback, which may queue a new request */
+            lSYS_DMA_MemChannelRelease(memObj);
+            isNextStarted = true;
+        }
+        else
+        {
+            isNextStarted = lSYS_DMA_MemRequestStart(memObj);
+        }
+
+        if (request.callback != NULL)
+        {
+            request.callback(event, request.context);
+        }
+
+        /* The DMA refused the next request, fail it as well */
+        event = SYS_DMA_TRANSFER_ERROR;
+
+    } while (isNextStarted == false);
+}
+
+static void lSYS_DMA_MemEventHandler(SYS_DMA_TRANSFER_EVENT event, uintptr_t context)
+{
+    SYS_DMA_MEM_OBJ* memObj = &gSysDmaMemObj;
+
+    (void)context;
+
+    if (memObj->nRequests == 0U)
+    {
+        return;
+    }
+
+    if ((event == SYS_DMA_TRANSFER_COMPLETE) && (memObj->offset < memObj->queue[memObj->head].length))
+    {
+        if (lSYS_DMA_MemBlockStart(memObj) == true)
+        {
+            return;
+        }
+
+        event = SYS_DMA_TRANSFER_ERROR;
+    }
+
+    lSYS_DMA_MemRequestComplete(memObj, event);
+}
+
+static bool lSYS_DMA_MemRequestAdd(const SYS_DMA_MEM_REQUEST* newRequest)
+{
+    SYS_DMA_MEM_OBJ* memObj = &gSysDmaMemObj;
+    bool interruptState;
+    bool status = false;
+
+    if ((newRequest->dest == NULL) || (newRequest->length == 0U))
+    {
+        return false;
+    }
+
+    /* The queue is also updated from the DMA interrupt */
+    interruptState = SYS_INT_SourceDisable(DMAC_IRQn);
+
+    if ((memObj->nRequests == 0U) && (memObj->channel == SYS_DMA_CHANNEL_NONE))
+    {
+        /* The service was idle, take a channel for the new burst */
+        memObj->channel = SYS_DMA_ChannelAllocate(SYS_DMA_TRIGGER_SOFTWARE, SYS_DMA_MEM_PRIORITY);
+
+        if (memObj->channel != SYS_DMA_CHANNEL_NONE)
+        {
+            SYS_DMA_ChannelCallbackRegister(memObj->channel, lSYS_DMA_MemEventHandler, 0);
+        }
+    }
+
+    if ((memObj->channel != SYS_DMA_CHANNEL_NONE) && (memObj->nRequests < SYS_DMA_MEM_QUEUE_SIZE))
+    {
+        memObj->queue[(memObj->head + memObj->nRequests) % SYS_DMA_MEM_QUEUE_SIZE] = *newRequest;
+
+        memObj->nRequests++;
+        status = true;
+
+        if (memObj->nRequests == 1U)
+        {
+            if (lSYS_DMA_MemRequestStart(memObj) == false)
+            {
+                memObj->nRequests = 0U;
+                lSYS_DMA_MemChannelRelease(memObj);
+                status = false;
+            }
+        }
+    }
+
+    SYS_INT_SourceRestore(DMAC_IRQn, interruptState);
+
+    return status;
+}
+
+/* Completion handler of the blocking calls, context points to their event */
+static void lSYS_DMA_MemWaitHandler(SYS_DMA_TRANSFER_EVENT event, uintptr_t context)
+{
+    volatile SYS_DMA_TRANSFER_EVENT* waitEvent = (volatile SYS_DMA_TRANSFER_EVENT*)context;
+
+    *waitEvent = event;
+}
+
+/* Queues a request for a blocking call and waits for it. Returns false if the
+ * caller must do the work with the CPU instead. */
+static bool lSYS_DMA_MemRequestWait(SYS_DMA_MEM_REQUEST* request)
+{
+    volatile SYS_DMA_TRANSFER_EVENT waitEvent = (SYS_DMA_TRANSFER_EVENT)0;
+
+    /* Short buffers are faster with the CPU. The wait needs the DMA
+     * interrupt, so the CPU also does the work in interrupt context or while
+     * interrupts are disabled. */
+    if ((request->length < SYS_DMA_MEM_THRESHOLD) || (__get_IPSR() != 0U) || (SYS_INT_IsEnabled() == false))
+    {
+        return false;
+    }
+
+    request->callback = lSYS_DMA_MemWaitHandler;
+    request->context = (uintptr_t)&waitEvent;
+
+    if (lSYS_DMA_MemRequestAdd(request) == false)
+    {
+        return false;
+    }
+
+    while (waitEvent == (SYS_DMA_TRANSFER_EVENT)0)
+    {
+        /* Other interrupts are served while the DMA moves the data */
+    }
+
+    return (waitEvent == SYS_DMA_TRANSFER_COMPLETE);
+}
+
+//******************************************************************************
+/* Function:
+    void SYS_DMA_MemInitialize(void);
+
+  Summary:
+    Initializes the DMA memory service.
+
+  Remarks:
+    Check sys_dma.h for more info.
+*/
+void SYS_DMA_MemInitialize(void)
+{
+    (void) memset(&gSysDmaMemObj, 0, sizeof(gSysDmaMemObj));
+
+    gSysDmaMemObj.channel = SYS_DMA_CHANNEL_NONE;
+}
+
+//******************************************************************************
+/* Function:
+    bool SYS_DMA_MemCopyAsync(void* dest, const void* source, size_t length,
+        SYS_DMA_MEM_CALLBACK callback, uintptr_t context);
+
+  Summary:
+    Queues the copy of a buffer by the DMA.
+
+  Remarks:
+    Check sys_dma.h for more info.
+*/
+bool SYS_DMA_MemCopyAsync(void* dest, const void* source, size_t length, SYS_DMA_MEM_CALLBACK callback, uintptr_t context)
+{
+    SYS_DMA_MEM_REQUEST request;
+
+    if (source == NULL)
+    {
+        return false;
+    }
+
+    request.dest     = (uint8_t*)dest;
+    request.source   = (const uint8_t*)source;
+    request.length   = length;
+    request.pattern  = 0U;
+    request.callback = callback;
+    request.context  = context;
+
+    return lSYS_DMA_MemRequestAdd(&request);
+}
+
+//******************************************************************************
+/* Function:
+    bool SYS_DMA_MemSetAsync(void* dest, uint8_t value, size_t length,
+        SYS_DMA_MEM_CALLBACK callback, uintptr_t context);
+
+  Summary:
+    Queues the fill of a buffer by the DMA.
+
+  Remarks:
+    Check sys_dma.h for more info.
+*/
+bool SYS_DMA_MemSetAsync(void* dest, uint8_t value, size_t length, SYS_DMA_MEM_CALLBACK callback, uintptr_t context)
+{
+    SYS_DMA_MEM_REQUEST request;
+
+    request.dest     = (uint8_t*)dest;
+    request.source   = NULL;
+    request.length   = length;
+    request.pattern  = (uint32_t)value * 0x01010101U;
+    request.callback = callback;
+    request.context  = context;
+
+    return lSYS_DMA_MemRequestAdd(&request);
+}
+
+//******************************************************************************
+/* Function:
+    void* SYS_DMA_MemCopy(void* dest, const void* source, size_t length);
+
+  Summary:
+    Copies a buffer, with the DMA when it is worth it.
+
+  Remarks:
+    Check sys_dma.h for more info.
+*/
+void* SYS_DMA_MemCopy(void* dest, const void* source, size_t length)
+{
+    SYS_DMA_MEM_REQUEST request;
+
+    request.dest     = (uint8_t*)dest;
+    request.source   = (const uint8_t*)source;
+    request.length   = length;
+    request.pattern  = 0U;
+
+    if (lSYS_DMA_MemRequestWait(&request) == false)
+    {
+        (void) memcpy(dest, source, length);
+    }
+
+    return dest;
+}
+
+//******************************************************************************
+/* Function:
+    void* SYS_DMA_MemSet(void* dest, uint8_t value, size_t length);
+
+  Summary:
+    Fills a buffer, with the DMA when it is worth it.
+
+  Remarks:
+    Check sys_dma.h for more info.
+*/
+void* SYS_DMA_MemSet(void* dest, uint8_t value, size_t length)
+{
+    SYS_DMA_MEM_REQUEST request;
+
+    request.dest     = (uint8_t*)dest;
+    request.source   = NULL;
+    request.length   = length;
+    request.pattern  = (uint32_t)value * 0x01010101U;
+
+    if (lSYS_DMA_MemRequestWait(&request) == false)
+    {
+        (void) memset(dest, (int)value, length);
+    }
+
+    return dest;
+}
+#endif
+
+//******************************************************************************
+/* Function:
+    uint32_t SYS_DMA_CRCReferenceCalculate(const void* buffer, size_t length,
+        SYS_DMA_CRC_SETUP crcSetup);
+
+  Summary:
+    Computes a CRC in software the way the DMA CRC engine does.
+
+  Remarks:
+    Check sys_dma.h for more info.
+*/
+uint32_t SYS_DMA_CRCReferenceCalculate(const void* buffer, size_t length, SYS_DMA_CRC_SETUP crcSetup)
+{
+    const uint8_t* data = (const uint8_t*)buffer;
+    uint32_t crc = crcSetup.seed;
+    size_t i;
+    uint32_t bit;
+
+    for (i = 0U; i < length; i++)
+    {
+        if (crcSetup.polynomialType == SYS_DMA_CRC_TYPE_16)
+        {
+            crc ^= (uint32_t)data[i] << 8U;
+
+            for (bit = 0U; bit < 8U; bit++)
+            {
+                crc = ((crc & 0x8000U) != 0U) ? ((crc << 1U) ^ 0x1021U) : (crc << 1U);
+            }
+
+            crc &= 0xFFFFU;
+        }
+        else
+        {
+            crc ^= (uint32_t)data[i];
+
+            for (bit = 0U; bit < 8U; bit++)
+            {
+                crc = ((crc & 0x1U) != 0U) ? ((crc >> 1U) ^ 0xEDB88320U) : (crc >> 1U);
+            }
+        }
+    }
+
+    return crc;
+}
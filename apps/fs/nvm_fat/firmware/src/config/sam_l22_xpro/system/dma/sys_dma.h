@@ -0,0 +1,1019 @@
+/*******************************************************************************
+  DMA System Service Library Interface Header File
+
+  Company
+    Microchip Technology Inc.
+
+  File Name
+    sys_dma.h
+
+  Summary
+    DMA system service library interface.
+
+  Description
+    This file defines the interface to the DMA system service library.
+    This library provides access to and control of the DMA controller.
+
+  Remarks:
+    DMA controller initialize will be done from within the MCC.
+
+*******************************************************************************/
+
+// DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+// DOM-IGNORE-END
+
+#ifndef SYS_DMA_H    // Guards against multiple inclusion
+#define SYS_DMA_H
+
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+/*  This section lists the other files that are included in this file.
+*/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "device.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+/* DMA Channels
+
+  Summary:
+    This lists the set of channels available for data transfer using DMA.
+
+  Description:
+    This lists the set of channels available for data transfer using DMA.
+
+  Remarks:
+    None.
+*/
+
+typedef enum
+{
+    SYS_DMA_CHANNEL_0,
+    SYS_DMA_CHANNEL_1,
+    SYS_DMA_CHANNEL_2,
+    SYS_DMA_CHANNEL_3,
+    SYS_DMA_CHANNEL_4,
+    SYS_DMA_CHANNEL_5,
+    SYS_DMA_CHANNEL_6,
+    SYS_DMA_CHANNEL_7,
+    SYS_DMA_CHANNEL_8,
+    SYS_DMA_CHANNEL_9,
+    SYS_DMA_CHANNEL_10,
+    SYS_DMA_CHANNEL_11,
+    SYS_DMA_CHANNEL_12,
+    SYS_DMA_CHANNEL_13,
+    SYS_DMA_CHANNEL_14,
+    SYS_DMA_CHANNEL_15,
+    SYS_DMA_CHANNEL_NONE = 0xFFFFFFFFU
+
+} SYS_DMA_CHANNEL;
+
+// *****************************************************************************
+/* DMA Transfer Events
+
+   Summary:
+    Enumeration of possible DMA transfer events.
+
+   Description:
+    This data type provides an enumeration of all possible DMA transfer
+    events.
+
+   Remarks:
+    None.
+
+*/
+typedef enum
+{
+    /* Data was transferred successfully. */
+    SYS_DMA_TRANSFER_COMPLETE = 1,
+
+    /* Error while processing the request */
+    SYS_DMA_TRANSFER_ERROR
+
+} SYS_DMA_TRANSFER_EVENT;
+
+// *****************************************************************************
+/* DMA Source addressing modes
+
+   Summary:
+    Enumeration of possible DMA source addressing modes.
+
+   Description:
+    This data type provides an enumeration of all possible DMA source
+    addressing modes.
+
+   Remarks:
+    None.
+*/
+/* MISRA C-2012 Rule 5.2 deviated:8 Deviation record ID -  H3_MISRAC_2012_R_5_2_DR_1 */
+
+typedef enum
+{
+    /* Source address is always fixed */
+    SYS_DMA_SOURCE_ADDRESSING_MODE_FIXED = 0x0,
+
+    /* Source address is incremented after every transfer */
+    SYS_DMA_SOURCE_ADDRESSING_MODE_INCREMENTED = 0x400,
+
+    SYS_DMA_SOURCE_ADDRESSING_MODE_NONE = -1
+
+} SYS_DMA_SOURCE_ADDRESSING_MODE;
+
+// *****************************************************************************
+/* DMA destination addressing modes
+
+   Summary:
+    Enumeration of possible DMA destination addressing modes.
+
+   Description:
+    This data type provides an enumeration of all possible DMA destination
+    addressing modes.
+
+   Remarks:
+    None.
+*/
+typedef enum
+{
+    /* Destination address is always fixed */
+    SYS_DMA_DESTINATION_ADDRESSING_MODE_FIXED = 0x0,
+
+    /* Destination address is incremented after every transfer */
+    SYS_DMA_DESTINATION_ADDRESSING_MODE_INCREMENTED = 0x800,
+
+    SYS_DMA_DESTINATION_ADDRESSING_MODE_NONE = -1
+
+} SYS_DMA_DESTINATION_ADDRESSING_MODE;
+/* MISRAC 2012 deviation block end */
+
+// *****************************************************************************
+/* DMA data width
+
+   Summary:
+    Enumeration of possible DMA data width
+
+   Description:
+    This data type provides an enumeration of all possible DMA data width.
+
+   Remarks:
+    None.
+*/
+typedef enum
+{
+    /* DMA data width 8 bit */
+    SYS_DMA_WIDTH_8_BIT = 0x0,
+
+    /* DMA data width 16 bit */
+    SYS_DMA_WIDTH_16_BIT = 0x100,
+
+    /* DMA data width 32 bit */
+    SYS_DMA_WIDTH_32_BIT =  0x200,
+
+    SYS_DMA_WIDTH_NONE = -1
+
+} SYS_DMA_WIDTH;
+
+// *****************************************************************************
+/* DMA Transfer Event Handler Function
+
+   Summary:
+    Pointer to a DMA Transfer Event handler function.
+
+   Description:
+    This data type defines a DMA Transfer Event Handler Function.
+
+    A DMA client must register a transfer event handler function of this
+    type to receive transfer related events from the DMA System Service.
+
+    If the event is SYS_DMA_TRANSFER_COMPLETE, this means that the data
+    was transferred successfully.
+
+    If the event is SYS_DMA_TRANSFER_ERROR, this means that the data was
+    not transferred successfully.
+
+    The contextHandle parameter contains the context handle that was provided by
+    the client at the time of registering the event handler. This context handle
+    can be anything that the client consider helpful or necessary to identify
+    the client context object associated with the channel of the DMA that
+    generated the event.
+
+    The event handler function executes in an interrupt context of DMA.
+    It is recommended to the application not to perform process intensive
+    operations with in this function.
+
+   Remarks:
+    None.
+
+*/
+typedef void (*SYS_DMA_CHANNEL_CALLBACK) (SYS_DMA_TRANSFER_EVENT event, uintptr_t contextHandle);
+
+// *****************************************************************************
+/* DMA CRC polynomial type
+
+   Summary:
+    Enumeration of the CRC polynomials supported by the DMA CRC engine.
+
+   Description:
+    This data type provides an enumeration of the polynomials the DMA CRC
+    engine can compute while a DMA channel moves data.
+
+   Remarks:
+    None.
+*/
+typedef enum
+{
+    /* CRC16 (CRC-CCITT): 0x1021 */
+    SYS_DMA_CRC_TYPE_16 = 0x0,
+
+    /* CRC32 (IEEE 802.3): 0x04C11DB7 */
+    SYS_DMA_CRC_TYPE_32 = 0x1
+
+} SYS_DMA_CRC_POLYNOMIAL_TYPE;
+
+// *****************************************************************************
+/* DMA CRC setup
+
+   Summary:
+    Defines the setup of the DMA CRC engine.
+
+   Description:
+    This data type defines the polynomial and the initial seed used by the DMA
+    CRC engine.
+
+   Remarks:
+    None.
+*/
+typedef struct
+{
+    /* Polynomial type (CRC16, CRC32) */
+    SYS_DMA_CRC_POLYNOMIAL_TYPE polynomialType;
+
+    /* Initial seed for calculating the CRC */
+    uint32_t seed;
+
+} SYS_DMA_CRC_SETUP;
+
+// *****************************************************************************
+/* DMA CRC Request Event Handler Function
+
+   Summary:
+    Pointer to the function receiving the result of a CRC request.
+
+   Description:
+    This data type defines the function called when a CRC request queued with
+    SYS_DMA_CRCRequestAdd has been processed. event is SYS_DMA_TRANSFER_COMPLETE
+    if the whole buffer went through the CRC engine, in which case crc holds
+    the checksum, or SYS_DMA_TRANSFER_ERROR otherwise. context is the value
+    passed to SYS_DMA_CRCRequestAdd.
+
+    The function executes in the DMA interrupt context. It may queue another
+    CRC request.
+
+   Remarks:
+    None.
+*/
+typedef void (*SYS_DMA_CRC_CALLBACK) (SYS_DMA_TRANSFER_EVENT event, uint32_t crc, uintptr_t context);
+
+// *****************************************************************************
+/* DMA Memory Request Event Handler Function
+
+   Summary:
+    Pointer to the function notified of the end of a copy or fill request.
+
+   Description:
+    This data type defines the function called when a request queued with
+    SYS_DMA_MemCopyAsync or SYS_DMA_MemSetAsync has been processed. event is
+    SYS_DMA_TRANSFER_COMPLETE if the whole buffer was written, or
+    SYS_DMA_TRANSFER_ERROR otherwise. context is the value passed with the
+    request.
+
+    The function executes in the DMA interrupt context. It may queue another
+    request.
+
+   Remarks:
+    None.
+*/
+typedef void (*SYS_DMA_MEM_CALLBACK) (SYS_DMA_TRANSFER_EVENT event, uintptr_t context);
+
+// *****************************************************************************
+/* DMA linked list descriptor
+
+   Summary:
+    Defines a descriptor of a linked list of DMA transfers.
+
+   Description:
+    This data type maps to the DMAC transfer descriptor. Descriptors are set up
+    with SYS_DMA_LinkedListDescriptorSetup and must be 8-byte aligned.
+
+   Remarks:
+    None.
+*/
+typedef dmac_descriptor_registers_t SYS_DMA_DESCRIPTOR;
+
+// *****************************************************************************
+/* DMA channel configuration
+
+   Summary:
+    Defines the block transfer control of a DMA descriptor.
+
+   Description:
+    This data type holds the beat size, address increment, block action and
+    valid bit of a DMA descriptor.
+
+   Remarks:
+    None.
+*/
+typedef uint32_t SYS_DMA_CHANNEL_CONFIG;
+
+// *****************************************************************************
+/* DMA channel priority levels
+
+   Summary:
+    Enumeration of the arbitration priority levels of a DMA channel.
+
+   Description:
+    This data type lists the priority levels that can be given to a channel
+    taken from the channel pool with SYS_DMA_ChannelAllocate. Pending channels
+    of a higher level are served first.
+
+   Remarks:
+    None.
+*/
+typedef enum
+{
+    SYS_DMA_PRIORITY_LEVEL_0 = 0,
+
+    SYS_DMA_PRIORITY_LEVEL_1,
+
+    SYS_DMA_PRIORITY_LEVEL_2,
+
+    SYS_DMA_PRIORITY_LEVEL_3
+
+} SYS_DMA_PRIORITY;
+
+// *****************************************************************************
+/* DMA software trigger
+
+   Summary:
+    Trigger source of a channel started by software only.
+
+   Description:
+    Passed to SYS_DMA_ChannelAllocate for memory to memory transfers, where
+    the whole block is moved as soon as the transfer is started.
+
+   Remarks:
+    None.
+*/
+#define SYS_DMA_TRIGGER_SOFTWARE    (0U)
+
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Routines
+// *****************************************************************************
+// *****************************************************************************
+
+/* The following functions make up the methods (set of possible operations) of
+   this interface.
+*/
+
+/* Refer to sys_dma_mapping.h header file for all sys_dma functions mapped to plib interfaces */
+#include "sys_dma_mapping.h"
+
+//******************************************************************************
+/* Function:
+    void SYS_DMA_AddressingModeSetup(SYS_DMA_CHANNEL channel, SYS_DMA_SOURCE_ADDRESSING_MODE sourceAddrMode, SYS_DMA_DESTINATION_ADDRESSING_MODE destAddrMode);
+
+  Summary:
+    Setup addressing mode of selected DMA channel.
+
+  Description:
+    This function sets the addressing mode of selected DMA channel.
+
+    Any ongoing transaction of the specified XDMAC channel will be aborted when
+    this function is called.
+
+  Precondition:
+    DMA Controller should have been initialized.
+
+  Parameters:
+    channel - A specific DMA channel
+    sourceAddrMode -  Source addressing mode of type SYS_DMA_SOURCE_ADDRESSING_MODE
+    destAddrMode - Destination addressing mode of type SYS_DMA_DESTINATION_ADDRESSING_MODE
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+        SYS_DMA_AddressingModeSetup(SYS_DMA_CHANNEL_1, SYS_DMA_SOURCE_ADDRESSING_MODE_FIXED, SYS_DMA_DESTINATION_ADDRESSING_MODE_FIXED);
+    </code>
+
+  Remarks:
+    None.
+*/
+void SYS_DMA_AddressingModeSetup(SYS_DMA_CHANNEL channel, SYS_DMA_SOURCE_ADDRESSING_MODE sourceAddrMode, SYS_DMA_DESTINATION_ADDRESSING_MODE destAddrMode);
+
+//******************************************************************************
+/* Function:
+    void SYS_DMA_DataWidthSetup(SYS_DMA_CHANNEL channel, SYS_DMA_WIDTH dataWidth);
+
+  Summary:
+    Setup data width of selected DMA channel.
+
+  Description:
+    This function sets data width of selected DMA channel.
+
+    Any ongoing transaction of the specified XDMAC channel will be aborted when
+    this function is called.
+
+  Precondition:
+    DMA Controller should have been initialized.
+
+  Parameters:
+    channel - A specific DMA channel
+    dataWidth -  Data width of DMA transfer of type SYS_DMA_WIDTH
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+        SYS_DMA_DataWidthSetup(SYS_DMA_CHANNEL_1, SYS_DMA_WIDTH_16_BIT);
+    </code>
+
+  Remarks:
+    None.
+*/
+void SYS_DMA_DataWidthSetup(SYS_DMA_CHANNEL channel, SYS_DMA_WIDTH dataWidth);
+
+//******************************************************************************
+/* Function:
+    void SYS_DMA_ChannelCRCSetup(SYS_DMA_CHANNEL channel, SYS_DMA_CRC_SETUP crcSetup);
+
+  Summary:
+    Attaches the DMA CRC engine to the selected DMA channel.
+
+  Description:
+    This function configures the DMA CRC engine with the given polynomial and
+    seed and selects the DMA channel whose data beats are fed to the engine.
+    The CRC is then computed on the fly as the channel moves data, without a
+    second pass over the buffer. The result can be read with SYS_DMA_CRCRead
+    once the transfer(s) on the channel have completed.
+
+    There is a single CRC engine; the CRC of any previously configured channel
+    is discarded. The engine must be owned through SYS_DMA_CRCEngineAcquire.
+
+  Precondition:
+    DMA Controller should have been initialized.
+
+  Parameters:
+    channel - A specific DMA channel
+    crcSetup - Polynomial and seed of type SYS_DMA_CRC_SETUP
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+        SYS_DMA_CRC_SETUP crcSetup = {SYS_DMA_CRC_TYPE_16, 0};
+
+        if (SYS_DMA_CRCEngineAcquire() == true)
+        {
+            SYS_DMA_ChannelCRCSetup(SYS_DMA_CHANNEL_1, crcSetup);
+            SYS_DMA_ChannelTransfer(SYS_DMA_CHANNEL_1, srcAddr, destAddr, size);
+        }
+
+        // After the transfer complete event
+        crc = SYS_DMA_CRCRead();
+        SYS_DMA_CRCEngineRelease();
+    </code>
+
+  Remarks:
+    The channel must be configured before the transfer is started. The CRC is
+    computed on the beat size of the channel.
+*/
+void SYS_DMA_ChannelCRCSetup(SYS_DMA_CHANNEL channel, SYS_DMA_CRC_SETUP crcSetup);
+
+//******************************************************************************
+/* Function:
+    bool SYS_DMA_CRCEngineAcquire(void);
+
+  Summary:
+    Takes ownership of the DMA CRC engine.
+
+  Description:
+    The DMA controller has a single CRC engine, shared by every driver or
+    service that computes a CRC on the fly (SPI driver instances, SD card
+    driver, DMA CRC service). A user takes the engine with this function
+    before calling SYS_DMA_ChannelCRCSetup and gives it back with
+    SYS_DMA_CRCEngineRelease once the CRC has been read.
+
+    The function does not wait. A user that finds the engine owned by another
+    one must not configure, read or disable it.
+
+  Precondition:
+    None.
+
+  Parameters:
+    None.
+
+  Returns:
+    true - The engine was free and is now owned by the caller.
+    false - The engine is owned by another user.
+
+  Example:
+    See SYS_DMA_ChannelCRCSetup.
+
+  Remarks:
+    May be called from interrupt context.
+*/
+bool SYS_DMA_CRCEngineAcquire(void);
+
+//******************************************************************************
+/* Function:
+    void SYS_DMA_CRCEngineRelease(void);
+
+  Summary:
+    Disables the DMA CRC engine and gives up its ownership.
+
+  Description:
+    This function disables the CRC engine, detaching it from the DMA channel
+    it was attached to, and makes it available to the next
+    SYS_DMA_CRCEngineAcquire call.
+
+  Precondition:
+    The engine must be owned by the caller.
+
+  Parameters:
+    None.
+
+  Returns:
+    None.
+
+  Example:
+    See SYS_DMA_ChannelCRCSetup.
+
+  Remarks:
+    May be called from interrupt context.
+*/
+void SYS_DMA_CRCEngineRelease(void);
+
+//******************************************************************************
+/* Function:
+    SYS_DMA_CHANNEL SYS_DMA_ChannelAllocate(uint32_t triggerSource,
+        SYS_DMA_PRIORITY priority);
+
+  Summary:
+    Takes a free channel from the DMA channel pool.
+
+  Description:
+    This function takes a free channel from the pool of SYS_DMA_CHANNEL_POOL_SIZE
+    channels starting at SYS_DMA_CHANNEL_POOL_FIRST, set in configuration.h,
+    and binds it to a trigger source and a priority level. The channel is set
+    for byte beats with incrementing source and destination addresses; it can
+    then be adjusted with SYS_DMA_AddressingModeSetup and
+    SYS_DMA_DataWidthSetup like a statically configured channel.
+
+    Clients that only need DMA during bursts take a channel before the burst
+    and give it back with SYS_DMA_ChannelRelease after it, so a few channels
+    serve several clients.
+
+  Precondition:
+    DMA Controller should have been initialized.
+
+  Parameters:
+    triggerSource - Peripheral trigger of the channel, as listed in the DMAC
+    chapter of the device data sheet, or SYS_DMA_TRIGGER_SOFTWARE
+    priority - Arbitration level of the channel
+
+  Returns:
+    The allocated channel, or SYS_DMA_CHANNEL_NONE if all the channels of the
+    pool are in use.
+
+  Example:
+    <code>
+        SYS_DMA_CHANNEL channel;
+
+        channel = SYS_DMA_ChannelAllocate(SYS_DMA_TRIGGER_SOFTWARE, SYS_DMA_PRIORITY_LEVEL_0);
+
+        if (channel != SYS_DMA_CHANNEL_NONE)
+        {
+            SYS_DMA_ChannelCallbackRegister(channel, APP_DMAEventHandler, 0);
+            SYS_DMA_ChannelTransfer(channel, srcAddr, destAddr, size);
+        }
+    </code>
+
+  Remarks:
+    This function can be called from an interrupt context.
+*/
+SYS_DMA_CHANNEL SYS_DMA_ChannelAllocate(uint32_t triggerSource, SYS_DMA_PRIORITY priority);
+
+//******************************************************************************
+/* Function:
+    void SYS_DMA_ChannelRelease(SYS_DMA_CHANNEL channel);
+
+  Summary:
+    Gives a channel back to the DMA channel pool.
+
+  Description:
+    This function aborts any transfer of a channel obtained with
+    SYS_DMA_ChannelAllocate, removes its callback and returns it to the pool.
+    Channels outside of the pool or not allocated are ignored.
+
+  Precondition:
+    DMA Controller should have been initialized.
+
+  Parameters:
+    channel - Channel returned by SYS_DMA_ChannelAllocate
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+        // In the transfer complete event of the last transfer of the burst
+        SYS_DMA_ChannelRelease(channel);
+        channel = SYS_DMA_CHANNEL_NONE;
+    </code>
+
+  Remarks:
+    This function can be called from an interrupt context, including the
+    callback of the channel being released.
+*/
+void SYS_DMA_ChannelRelease(SYS_DMA_CHANNEL channel);
+
+//******************************************************************************
+/* Function:
+    void SYS_DMA_CRCInitialize(void);
+
+  Summary:
+    Initializes the DMA CRC service.
+
+  Description:
+    This function clears the CRC request queue. The service takes a channel
+    from the DMA channel pool when a request is queued while it is idle and
+    gives it back once the queue is empty.
+
+  Precondition:
+    DMA Controller should have been initialized.
+
+  Parameters:
+    None.
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+        DMAC_Initialize();
+        SYS_DMA_CRCInitialize();
+    </code>
+
+  Remarks:
+    Available when SYS_DMA_CRC_QUEUE_SIZE is defined.
+*/
+void SYS_DMA_CRCInitialize(void);
+
+//******************************************************************************
+/* Function:
+    bool SYS_DMA_CRCRequestAdd(const void* buffer, size_t length,
+        SYS_DMA_CRC_SETUP crcSetup, SYS_DMA_CRC_CALLBACK callback,
+        uintptr_t context);
+
+  Summary:
+    Queues the CRC computation of a buffer.
+
+  Description:
+    This function queues the CRC computation of a buffer and returns at once.
+    A channel of the DMA channel pool reads the buffer and feeds it to the DMA
+    CRC engine, writing the data to a discarded location, so the CPU is free while
+    the checksum is computed. Buffers are read in 32-bit beats when their
+    address and length allow it, in 16-bit or 8-bit beats otherwise. Requests
+    are processed in the order they were queued and the result of each one is
+    returned to its callback.
+
+  Precondition:
+    SYS_DMA_CRCInitialize should have been called.
+
+  Parameters:
+    buffer - Data to checksum. It must stay valid until the callback.
+    length - Number of bytes, at least one
+    crcSetup - Polynomial and seed of type SYS_DMA_CRC_SETUP
+    callback - Function receiving the result
+    context - Value passed back to the callback
+
+  Returns:
+    true - The request has been queued.
+
+    false - The parameters are not valid, the queue already holds
+    SYS_DMA_CRC_QUEUE_SIZE requests, no channel of the DMA channel pool is
+    free or the service was idle and the CRC engine is owned by another user.
+
+  Example:
+    <code>
+        SYS_DMA_CRC_SETUP crcSetup = {SYS_DMA_CRC_TYPE_32, 0xFFFFFFFFU};
+
+        void APP_CRCHandler(SYS_DMA_TRANSFER_EVENT event, uint32_t crc, uintptr_t context)
+        {
+            if (event == SYS_DMA_TRANSFER_COMPLETE)
+            {
+                // crc holds the checksum of the buffer
+            }
+        }
+
+        (void) SYS_DMA_CRCRequestAdd(buffer, sizeof(buffer), crcSetup, APP_CRCHandler, 0);
+    </code>
+
+  Remarks:
+    There is a single CRC engine. The service owns it, through
+    SYS_DMA_CRCEngineAcquire, from the first queued request until the queue
+    is empty again.
+
+    Available when SYS_DMA_CRC_QUEUE_SIZE is defined.
+*/
+bool SYS_DMA_CRCRequestAdd(const void* buffer, size_t length, SYS_DMA_CRC_SETUP crcSetup, SYS_DMA_CRC_CALLBACK callback, uintptr_t context);
+
+//******************************************************************************
+/* Function:
+    void SYS_DMA_MemInitialize(void);
+
+  Summary:
+    Initializes the DMA memory service.
+
+  Description:
+    This function clears the copy and fill request queue. The service takes a
+    channel from the DMA channel pool when a request is queued while it is
+    idle and gives it back once the queue is empty.
+
+  Precondition:
+    DMA Controller should have been initialized.
+
+  Parameters:
+    None.
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+        DMAC_Initialize();
+        SYS_DMA_MemInitialize();
+    </code>
+
+  Remarks:
+    Available when SYS_DMA_MEM_QUEUE_SIZE is defined.
+*/
+void SYS_DMA_MemInitialize(void);
+
+//******************************************************************************
+/* Function:
+    bool SYS_DMA_MemCopyAsync(void* dest, const void* source, size_t length,
+        SYS_DMA_MEM_CALLBACK callback, uintptr_t context);
+
+  Summary:
+    Queues the copy of a buffer by the DMA.
+
+  Description:
+    This function queues the copy of length bytes from source to dest and
+    returns at once. The data is moved in 32-bit beats when both addresses and
+    the length allow it, in 16-bit or 8-bit beats otherwise. Copy and fill
+    requests are processed in the order they were queued.
+
+  Precondition:
+    SYS_DMA_MemInitialize should have been called.
+
+  Parameters:
+    dest - Destination buffer. It must not overlap the source.
+    source - Data to copy. It must stay valid until the callback.
+    length - Number of bytes, at least one
+    callback - Function notified of the end of the copy, can be NULL
+    context - Value passed back to the callback
+
+  Returns:
+    true - The request has been queued.
+
+    false - The parameters are not valid, the queue already holds
+    SYS_DMA_MEM_QUEUE_SIZE requests or no channel of the DMA channel pool is
+    free.
+
+  Example:
+    <code>
+        void APP_CopyHandler(SYS_DMA_TRANSFER_EVENT event, uintptr_t context)
+        {
+            if (event == SYS_DMA_TRANSFER_COMPLETE)
+            {
+                // dest holds the data
+            }
+        }
+
+        (void) SYS_DMA_MemCopyAsync(dest, source, sizeof(dest), APP_CopyHandler, 0);
+    </code>
+
+  Remarks:
+    Available when SYS_DMA_MEM_QUEUE_SIZE is defined.
+*/
+bool SYS_DMA_MemCopyAsync(void* dest, const void* source, size_t length, SYS_DMA_MEM_CALLBACK callback, uintptr_t context);
+
+//******************************************************************************
+/* Function:
+    bool SYS_DMA_MemSetAsync(void* dest, uint8_t value, size_t length,
+        SYS_DMA_MEM_CALLBACK callback, uintptr_t context);
+
+  Summary:
+    Queues the fill of a buffer by the DMA.
+
+  Description:
+    This function queues the fill of length bytes at dest with value and
+    returns at once. It is processed like a SYS_DMA_MemCopyAsync request.
+
+  Precondition:
+    SYS_DMA_MemInitialize should have been called.
+
+  Parameters:
+    dest - Buffer to fill
+    value - Value written to each byte
+    length - Number of bytes, at least one
+    callback - Function notified of the end of the fill, can be NULL
+    context - Value passed back to the callback
+
+  Returns:
+    true - The request has been queued.
+
+    false - The parameters are not valid, the queue already holds
+    SYS_DMA_MEM_QUEUE_SIZE requests or no channel of the DMA channel pool is
+    free.
+
+  Example:
+    <code>
+        (void) SYS_DMA_MemSetAsync(buffer, 0xFF, sizeof(buffer), APP_FillHandler, 0);
+    </code>
+
+  Remarks:
+    Available when SYS_DMA_MEM_QUEUE_SIZE is defined.
+*/
+bool SYS_DMA_MemSetAsync(void* dest, uint8_t value, size_t length, SYS_DMA_MEM_CALLBACK callback, uintptr_t context);
+
+//******************************************************************************
+/* Function:
+    void* SYS_DMA_MemCopy(void* dest, const void* source, size_t length);
+
+  Summary:
+    Copies a buffer, with the DMA when it is worth it.
+
+  Description:
+    This function is a drop-in replacement of memcpy. Copies of at least
+    SYS_DMA_MEM_THRESHOLD bytes are queued to the DMA memory service and the
+    function waits for their end, with interrupts served in the meantime.
+    Shorter copies, copies requested from an interrupt context or with
+    interrupts disabled, and copies the DMA cannot take or fails are done by
+    the CPU.
+
+  Precondition:
+    SYS_DMA_MemInitialize should have been called.
+
+  Parameters:
+    dest - Destination buffer. It must not overlap the source.
+    source - Data to copy
+    length - Number of bytes
+
+  Returns:
+    dest.
+
+  Example:
+    <code>
+        (void) SYS_DMA_MemCopy(blockBuffer, dataBuffer, 2048);
+    </code>
+
+  Remarks:
+    Available when SYS_DMA_MEM_QUEUE_SIZE is defined.
+*/
+void* SYS_DMA_MemCopy(void* dest, const void* source, size_t length);
+
+//******************************************************************************
+/* Function:
+    void* SYS_DMA_MemSet(void* dest, uint8_t value, size_t length);
+
+  Summary:
+    Fills a buffer, with the DMA when it is worth it.
+
+  Description:
+    This function is a drop-in replacement of memset, with the same rules as
+    SYS_DMA_MemCopy.
+
+  Precondition:
+    SYS_DMA_MemInitialize should have been called.
+
+  Parameters:
+    dest - Buffer to fill
+    value - Value written to each byte
+    length - Number of bytes
+
+  Returns:
+    dest.
+
+  Example:
+    <code>
+        (void) SYS_DMA_MemSet(blockBuffer, 0, 2048);
+    </code>
+
+  Remarks:
+    Available when SYS_DMA_MEM_QUEUE_SIZE is defined.
+*/
+void* SYS_DMA_MemSet(void* dest, uint8_t value, size_t length);
+
+//******************************************************************************
+/* Function:
+    uint32_t SYS_DMA_CRCReferenceCalculate(const void* buffer, size_t length,
+        SYS_DMA_CRC_SETUP crcSetup);
+
+  Summary:
+    Computes a CRC in software the way the DMA CRC engine does.
+
+  Description:
+    This function is a bitwise reference of the DMA CRC engine, used to check
+    its results. CRC16 is the CRC-CCITT (0x1021) processed MSB first. CRC32 is
+    the IEEE 802.3 polynomial processed LSB first (reflected). Both start from
+    the seed and return the value of the checksum register, without final XOR.
+    The IEEE 802.3 CRC32 of a buffer is the complement of the result obtained
+    with a seed of 0xFFFFFFFF.
+
+    The function does not access the hardware and also builds on a host, to
+    generate expected checksums.
+
+  Precondition:
+    None.
+
+  Parameters:
+    buffer - Data to checksum
+    length - Number of bytes
+    crcSetup - Polynomial and seed of type SYS_DMA_CRC_SETUP
+
+  Returns:
+    The checksum.
+
+  Example:
+    <code>
+        SYS_DMA_CRC_SETUP crcSetup = {SYS_DMA_CRC_TYPE_16, 0};
+
+        crc = SYS_DMA_CRCReferenceCalculate("123456789", 9, crcSetup);
+        // crc is 0x31C3
+    </code>
+
+  Remarks:
+    The data is processed one bit at a time; use the function to verify
+    results, not to compute checksums at run time.
+*/
+uint32_t SYS_DMA_CRCReferenceCalculate(const void* buffer, size_t length, SYS_DMA_CRC_SETUP crcSetup);
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    }
+
+#endif
+// DOM-IGNORE-END
+
+#endif //SYS_DMA_H
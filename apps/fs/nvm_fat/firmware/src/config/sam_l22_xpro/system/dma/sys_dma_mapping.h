@@ -0,0 +1,638 @@
+/*******************************************************************************
+  DMA System Service Mapping File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sys_dma_mapping.h
+
+  Summary:
+    DMA System Service mapping file.
+
+  Description:
+    This header file contains the mapping of the APIs defined in the API header
+    to either the function implementations or macro implementation or the
+    specific variant implementation.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+#ifndef SYS_DMA_MAPPING_H
+#define SYS_DMA_MAPPING_H
+
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: DMA System Service Mapping
+// *****************************************************************************
+// *****************************************************************************
+
+#include "peripheral/dmac/plib_dmac.h"
+
+//******************************************************************************
+/*
+  Function:
+    void SYS_DMA_ChannelCallbackRegister
+    (
+        SYS_DMA_CHANNEL channel,
+        const SYS_DMA_CHANNEL_CALLBACK eventHandler,
+        const uintptr_t contextHandle
+    )
+
+  Summary:
+    This function allows a DMA client to set an event handler.
+
+  Description:
+    This function allows a client to set an event handler. The client may want
+    to receive transfer related events in cases when it submits a DMA
+    transfer request. The event handler should be set before the client
+    intends to perform operations that could generate events.
+
+    This function accepts a contextHandle parameter. This parameter could be
+    set by the client to contain (or point to) any client specific data object
+    that should be associated with this DMA channel.
+
+  Precondition:
+    DMA Controller should have been initialized.
+
+  Parameters:
+    channel - A specific DMA channel from which the events are expected.
+
+    eventHandler - Pointer to the event handler function.
+
+    contextHandle - Value identifying the context of the
+    application/driver/middleware that registered the event handling function.
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+    MY_APP_OBJ myAppObj;
+
+    void APP_DMA_TransferEventHandler(SYS_DMA_TRANSFER_EVENT event,
+            uintptr_t contextHandle)
+    {
+        switch(event)
+        {
+            case SYS_DMA_TRANSFER_COMPLETE:
+                break;
+
+            case SYS_DMA_TRANSFER_ERROR:
+                break;
+
+            default:
+                break;
+        }
+    }
+    SYS_DMA_ChannelCallbackRegister(channel, APP_DMA_TransferEventHandler,
+            (uintptr_t)&myAppObj);
+    </code>
+
+  Remarks:
+    None.
+ */
+#define SYS_DMA_ChannelCallbackRegister(channel, eventHandler, context)  DMAC_ChannelCallbackRegister((DMAC_CHANNEL)channel, (DMAC_CHANNEL_CALLBACK)eventHandler, context)
+
+
+//******************************************************************************
+/* Function:
+    bool SYS_DMA_ChannelTransfer
+    (
+        SYS_DMA_CHANNEL channel,
+        const void *srcAddr,
+        const void *destAddr,
+        size_t blockSize
+    )
+
+  Summary:
+    Adds a data transfer to a DMA channel and enables the channel to start
+    data transfer.
+
+  Description:
+    This function adds a single block data transfer characteristics for a
+    specific XDMAC channel id it is not busy already. It also enables the
+    channel to start data transfer.
+
+    If the requesting client registered an event callback with the PLIB,
+    the PLIB will issue a SYS_DMA_TRANSFER_COMPLETE event if the transfer was
+    processed successfully and SYS_DMA_TRANSFER_ERROR event if the transfer was
+    not processed successfully.
+
+  Precondition:
+    DMA Controller should have been initialized.
+
+  Parameters:
+    channel - A specific DMA channel
+
+    srcAddr - Source of the DMA transfer
+
+    destAddr - Destination of the DMA transfer
+
+    blockSize - Size of the transfer block
+
+  Returns:
+    True - If transfer request is accepted.
+    False - If previous transfer is in progress and the request is rejected.
+
+  Example:
+    <code>
+    MY_APP_OBJ myAppObj;
+    uint8_t buf[10] = {0,1,2,3,4,5,6,7,8,9};
+    void *srcAddr = (uint8_t *) buf;
+    void *destAddr = (uin8_t*) &U1TXREG;
+    size_t size = 10;
+
+    SYS_DMA_ChannelCallbackRegister(APP_DMA_TransferEventHandler,
+        (uintptr_t)&myAppObj);
+
+    if (SYS_DMA_ChannelTransfer(SYS_DMA_CHANNEL_1, srcAddr, destAddr, size) == true)
+    {
+
+    }
+    else
+    {
+
+    }
+    </code>
+
+  Remarks:
+    When DMA transfer buffers are placed in cache-able memory, cache maintenance
+    operation must be performed by cleaning and invalidating cache for DMA
+    buffers located in cache-able SRAM region using CMSIS APIs. The buffer start
+    address must be aligned to cache line and buffer size must be multiple of
+    cache line. Refer to device documentation to find the cache line size.
+
+    Invalidate cache lines having received buffer before using it to load the
+    latest data in the actual memory to the cache
+    SCB_InvalidateDCache_by_Addr((uint32_t *)&readBuffer, sizeof(readBuffer));
+
+    Clean cache lines having source buffer before submitting a transfer request
+    to XDMAC to load the latest data in the cache to the actual memory
+    SCB_CleanDCache_by_Addr((uint32_t *)&writeBuffer, sizeof(writeBuffer));
+*/
+#define SYS_DMA_ChannelTransfer(channel, srcAddr, destAddr, blockSize)  DMAC_ChannelTransfer((DMAC_CHANNEL)channel, srcAddr, destAddr, blockSize)
+
+
+//******************************************************************************
+/* Function:
+    bool SYS_DMA_ChannelIsBusy (SYS_DMA_CHANNEL channel)
+
+  Summary:
+    Returns the busy status of a specific DMA Channel.
+
+  Description:
+    This function returns the busy status of the DMA channel.
+    DMA channel will be busy if any transfer is in progress.
+
+    This function can be used to check the status of the channel prior to
+    submitting a transfer request. And this can also be used to check the status
+    of the submitted request if callback mechanism is not preferred.
+
+  Precondition:
+    DMA Controller should have been initialized.
+
+  Parameters:
+    channel - A specific DMA channel
+
+  Returns:
+    Busy status of the specific channel.
+    True - Channel is busy
+    False - Channel is free
+
+  Example:
+    <code>
+
+    MY_APP_OBJ myAppObj;
+    uint8_t buf[10] = {0,1,2,3,4,5,6,7,8,9};
+    void *srcAddr = (uint8_t *) buf;
+    void *destAddr = (uin8_t*) &U1TXREG;
+    size_t size = 10;
+
+    if(false == SYS_DMA_ChannelIsBusy(SYS_DMA_CHANNEL_1))
+    {
+        SYS_DMA_ChannelTransfer(SYS_DMA_CHANNEL_1, srcAddr, destAddr, size);
+    }
+    </code>
+
+  Remarks:
+    None.
+*/
+#define SYS_DMA_ChannelIsBusy(channel)  DMAC_ChannelIsBusy((DMAC_CHANNEL)channel)
+
+
+//******************************************************************************
+/* Function:
+    void SYS_DMA_ChannelDisable (SYS_DMA_CHANNEL channel)
+
+  Summary:
+    Disables the specified channel.
+
+  Description:
+    This function disables the specified channel and resets it.
+    Ongoing transfer will be aborted.
+
+  Precondition:
+    DMA Controller should have been initialized.
+
+  Parameters:
+    channel - A specific DMA channel
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+    SYS_DMA_ChannelDisable(SYS_DMA_CHANNEL_1);
+    </code>
+
+  Remarks:
+    None.
+*/
+#define SYS_DMA_ChannelDisable(channel)  DMAC_ChannelDisable((DMAC_CHANNEL)channel)
+
+
+//******************************************************************************
+/* Function:
+    uint32_t SYS_DMA_CRCRead (void)
+
+  Summary:
+    Returns the CRC computed by the DMA CRC engine.
+
+  Description:
+    This function returns the CRC checksum computed by the DMA CRC engine for
+    the channel configured with SYS_DMA_ChannelCRCSetup.
+
+  Precondition:
+    SYS_DMA_ChannelCRCSetup should have been called and the DMA transfer
+    should have completed.
+
+  Parameters:
+    None.
+
+  Returns:
+    CRC checksum. Only the lower 16 bits are valid for SYS_DMA_CRC_TYPE_16.
+
+  Example:
+    <code>
+    uint32_t crc = SYS_DMA_CRCRead();
+    </code>
+
+  Remarks:
+    None.
+*/
+#define SYS_DMA_CRCRead()  DMAC_CRCRead()
+
+
+//******************************************************************************
+/* Function:
+    void SYS_DMA_CRCDisable (void)
+
+  Summary:
+    Disables the DMA CRC engine.
+
+  Description:
+    This function disables the DMA CRC engine and detaches it from the DMA
+    channel, making it available for the next user.
+
+  Precondition:
+    DMA Controller should have been initialized.
+
+  Parameters:
+    None.
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+    SYS_DMA_CRCDisable();
+    </code>
+
+  Remarks:
+    None.
+*/
+#define SYS_DMA_CRCDisable()  DMAC_CRCDisable()
+
+//******************************************************************************
+/* Function:
+    bool SYS_DMA_ChannelLinkedListTransfer
+    (
+        SYS_DMA_CHANNEL channel,
+        SYS_DMA_DESCRIPTOR* channelDesc
+    )
+
+  Summary:
+    Submits a linked list of DMA transfers and enables the channel.
+
+  Description:
+    This function submits a chain of descriptors set up with
+    SYS_DMA_LinkedListDescriptorSetup to a DMA channel and enables the channel.
+    The first descriptor is copied to the channel; the DMA fetches the
+    following descriptors from the chain as each block completes. A descriptor
+    whose valid bit is cleared stops the DMA with a fetch error until the
+    channel is re-armed.
+
+    If the requesting client registered an event callback, the
+    SYS_DMA_TRANSFER_COMPLETE event is issued at the end of each block set up
+    with the interrupt block action.
+
+  Precondition:
+    DMA Controller should have been initialized.
+
+  Parameters:
+    channel - A specific DMA channel
+
+    channelDesc - First descriptor of the chain. The descriptors must be
+    8-byte aligned.
+
+  Returns:
+    True - If transfer request is accepted.
+    False - If previous transfer is in progress and the request is rejected.
+
+  Example:
+    <code>
+    SYS_DMA_ChannelLinkedListTransfer(SYS_DMA_CHANNEL_0, &descriptors[0]);
+    </code>
+
+  Remarks:
+    None.
+*/
+#define SYS_DMA_ChannelLinkedListTransfer(channel, channelDesc)  DMAC_ChannelLinkedListTransfer((DMAC_CHANNEL)channel, channelDesc)
+
+
+//******************************************************************************
+/* Function:
+    void SYS_DMA_LinkedListDescriptorSetup
+    (
+        SYS_DMA_DESCRIPTOR* currentDescriptor,
+        SYS_DMA_CHANNEL_CONFIG setting,
+        const void *srcAddr,
+        const void *destAddr,
+        size_t blockSize,
+        SYS_DMA_DESCRIPTOR* nextDescriptor
+    )
+
+  Summary:
+    Sets up a descriptor of a linked list of DMA transfers.
+
+  Description:
+    This function fills the block transfer control, source and destination
+    addresses, block transfer count and next descriptor address of a
+    descriptor. Passing NULL as the next descriptor ends the chain.
+
+  Precondition:
+    None.
+
+  Parameters:
+    currentDescriptor - Descriptor to be set up
+
+    setting - Block transfer control of the descriptor (beat size, address
+    increment, block action and valid bit)
+
+    srcAddr - Source of the block transfer
+
+    destAddr - Destination of the block transfer
+
+    blockSize - Size of the block in bytes
+
+    nextDescriptor - Descriptor fetched after this block completes
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+    SYS_DMA_LinkedListDescriptorSetup(&descriptors[0], setting,
+        (const void*)&SERCOM0_REGS->SPIS.SERCOM_DATA, buffer0, 256U, &descriptors[1]);
+    </code>
+
+  Remarks:
+    None.
+*/
+#define SYS_DMA_LinkedListDescriptorSetup(currentDescriptor, setting, srcAddr, destAddr, blockSize, nextDescriptor)  DMAC_LinkedListDescriptorSetup(currentDescriptor, (DMAC_CHANNEL_CONFIG)setting, srcAddr, destAddr, blockSize, nextDescriptor)
+
+
+//******************************************************************************
+/* Function:
+    SYS_DMA_CHANNEL_CONFIG SYS_DMA_ChannelSettingsGet (SYS_DMA_CHANNEL channel)
+
+  Summary:
+    Returns the block transfer control of a DMA channel.
+
+  Description:
+    This function returns the block transfer control (beat size, address
+    increment, block action and valid bit) used by SYS_DMA_ChannelTransfer on
+    the channel.
+
+  Precondition:
+    DMA Controller should have been initialized.
+
+  Parameters:
+    channel - A specific DMA channel
+
+  Returns:
+    Block transfer control of the channel.
+
+  Example:
+    <code>
+    SYS_DMA_CHANNEL_CONFIG setting = SYS_DMA_ChannelSettingsGet(SYS_DMA_CHANNEL_0);
+    </code>
+
+  Remarks:
+    None.
+*/
+#define SYS_DMA_ChannelSettingsGet(channel)  (SYS_DMA_CHANNEL_CONFIG)DMAC_ChannelSettingsGet((DMAC_CHANNEL)channel)
+
+
+//******************************************************************************
+/* Function:
+    void SYS_DMA_ChannelSettingsSet (SYS_DMA_CHANNEL channel, SYS_DMA_CHANNEL_CONFIG setting)
+
+  Summary:
+    Sets the block transfer control of a DMA channel.
+
+  Description:
+    This function disables the channel and sets the block transfer control used
+    by SYS_DMA_ChannelTransfer on the channel. It restores the channel settings
+    after a linked list transfer.
+
+  Precondition:
+    DMA Controller should have been initialized.
+
+  Parameters:
+    channel - A specific DMA channel
+
+    setting - Block transfer control of the channel
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+    SYS_DMA_ChannelSettingsSet(SYS_DMA_CHANNEL_0, setting);
+    </code>
+
+  Remarks:
+    None.
+*/
+#define SYS_DMA_ChannelSettingsSet(channel, setting)  (void)DMAC_ChannelSettingsSet((DMAC_CHANNEL)channel, (DMAC_CHANNEL_CONFIG)setting)
+
+#if defined(DMAC_STATISTICS_ENABLE)
+// *****************************************************************************
+/* DMA channel statistics
+
+   Summary:
+    Transfer statistics of a DMA channel.
+
+   Description:
+    Number of transfers, errors and bytes, and busy time in CPU cycles of a
+    channel since the last SYS_DMA_StatisticsReset.
+
+   Remarks:
+    Available when the DMAC PLIB is generated with DMAC_STATISTICS_ENABLE.
+*/
+typedef DMAC_CHANNEL_STATISTICS SYS_DMA_CHANNEL_STATISTICS;
+
+// *****************************************************************************
+/* DMA transfer record
+
+   Summary:
+    Channel, size, busy time and outcome of a finished DMA transfer.
+
+   Remarks:
+    Available when the DMAC PLIB is generated with DMAC_STATISTICS_ENABLE.
+*/
+typedef DMAC_TRANSFER_RECORD SYS_DMA_TRANSFER_RECORD;
+
+//******************************************************************************
+/* Function:
+    void SYS_DMA_ChannelStatisticsGet (SYS_DMA_CHANNEL channel, SYS_DMA_CHANNEL_STATISTICS* statistics)
+
+  Summary:
+    Returns the transfer statistics of a DMA channel.
+
+  Description:
+    This function copies the statistics of the channel since the last
+    SYS_DMA_StatisticsReset. A transfer is counted when it ends; its busy time
+    runs from its start to its end, including the wait for the peripheral
+    triggers. The utilization of the channel over a period is busyCycles
+    divided by the CPU cycles of the period.
+
+  Precondition:
+    DMA Controller should have been initialized.
+
+  Parameters:
+    channel - A specific DMA channel
+
+    statistics - Pointer to the statistics to fill
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+    SYS_DMA_CHANNEL_STATISTICS statistics;
+
+    SYS_DMA_ChannelStatisticsGet(SYS_DMA_CHANNEL_0, &statistics);
+    </code>
+
+  Remarks:
+    Busy times are measured with the SysTick timer at the CPU clock; a transfer
+    longer than 2^24 cycles is undercounted.
+*/
+#define SYS_DMA_ChannelStatisticsGet(channel, statistics)  DMAC_ChannelStatisticsGet((DMAC_CHANNEL)channel, statistics)
+
+//******************************************************************************
+/* Function:
+    uint32_t SYS_DMA_TransferRecordsGet (SYS_DMA_TRANSFER_RECORD* records, uint32_t nRecords)
+
+  Summary:
+    Returns the last finished DMA transfers.
+
+  Description:
+    This function copies up to nRecords of the last finished transfers of all
+    channels, oldest first. The ring holds DMAC_TRANSFER_RECORDS_NUMBER
+    records; gaps in the sequence numbers of successive reads show records
+    that were overwritten in between.
+
+  Precondition:
+    DMA Controller should have been initialized.
+
+  Parameters:
+    records - Array receiving the records
+
+    nRecords - Size of the array
+
+  Returns:
+    Number of records copied.
+
+  Example:
+    <code>
+    SYS_DMA_TRANSFER_RECORD records[8];
+    uint32_t nRecords;
+
+    nRecords = SYS_DMA_TransferRecordsGet(records, 8);
+    </code>
+
+  Remarks:
+    None.
+*/
+#define SYS_DMA_TransferRecordsGet(records, nRecords)  DMAC_TransferRecordsGet(records, nRecords)
+
+//******************************************************************************
+/* Function:
+    void SYS_DMA_StatisticsReset (void)
+
+  Summary:
+    Clears the statistics of all DMA channels and the transfer records.
+
+  Description:
+    This function starts a new measurement period. Transfers in progress are
+    counted in the new period when they end.
+
+  Precondition:
+    DMA Controller should have been initialized.
+
+  Parameters:
+    None.
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+    SYS_DMA_StatisticsReset();
+    </code>
+
+  Remarks:
+    None.
+*/
+#define SYS_DMA_StatisticsReset()  DMAC_StatisticsReset()
+#endif
+
+#endif // SYS_DMA_MAPPING_H
@@ -277,6 +277,12 @@
 #endif
 
 
+/* Free cluster scan */
+#if FF_USE_FREESCAN && FF_FS_READONLY
+#error FF_USE_FREESCAN must be 0 at read-only configuration
+#endif
+
+
 /* File lock controls */
 #if FF_FS_LOCK
 #if FF_FS_READONLY
@@ -1128,6 +1134,11 @@ static FRESULT sync_fs (	/* Returns FR_OK or FR_DISK_ERR */
 			disk_write(fs->pdrv, fs->win, fs->winsect, 1);
 			fs->fsi_flag = 0;
 		}
+#if FF_USE_FREESCAN
+		if (fs->free_clst <= fs->n_fatent - 2) {	/* Keep the count for the next mount (used on FAT12/16) */
+			fs->keep_free = fs->free_clst + 1;
+		}
+#endif
 		/* Make sure that no pending write process in the lower layer */
 		if (disk_ioctl(fs->pdrv, CTRL_SYNC, 0) != RES_OK) res = FR_DISK_ERR;
 	}
@@ -1466,6 +1477,9 @@ static FRESULT remove_chain (	/* FR_OK(0):succeeded, !=0:error */
 			fs->free_clst++;
 			fs->fsi_flag |= 1;
 		}
+#if FF_USE_FREESCAN
+		if (clst < fs->scan_clst) fs->scan_free++;	/* Already passed by the free cluster scan? */
+#endif
 #if FF_FS_EXFAT || FF_USE_TRIM
 		if (ecl + 1 == nxt) {	/* Is next cluster contiguous? */
 			ecl = nxt;
@@ -1609,6 +1623,9 @@ static DWORD create_chain (	/* 0:No free cluster, 1:Internal error, 0xFFFFFFFF:D
 		fs->last_clst = ncl;
 		if (fs->free_clst <= fs->n_fatent - 2) fs->free_clst--;
 		fs->fsi_flag |= 1;
+#if FF_USE_FREESCAN
+		if (ncl < fs->scan_clst) fs->scan_free--;	/* Already passed by the free cluster scan? */
+#endif
 	} else {
 		ncl = (res == FR_DISK_ERR) ? 0xFFFFFFFF : 1;	/* Failed. Generate error status */
 	}
@@ -2379,12 +2396,55 @@ static FRESULT dir_read (
 
 
 
+#if FF_USE_LFN && FF_DIR_CACHE_SIZE
+/*-----------------------------------------------------------------------*/
+/* Directory entry lookup cache                                          */
+/*-----------------------------------------------------------------------*/
+/* An item of the cache only tells dir_find() where to start the scan, so
+/  that a stale or colliding item costs a full scan but never a wrong match. */
+
+static DWORD dcache_hash (	/* Returns the hash of the directory and the name */
+	DWORD sclust,			/* Directory start cluster (0:root) */
+	const WCHAR* lfn		/* Pointer to the name in the LFN working buffer */
+)
+{
+	DWORD hash = 0x811C9DC5;
+	UINT i;
+
+
+	hash = (hash ^ sclust) * 0x01000193;
+	for (i = 0; lfn[i]; i++) {		/* FNV-1a over the up-cased name */
+		hash = (hash ^ ff_wtoupper(lfn[i])) * 0x01000193;
+	}
+	return hash;
+}
+
+
+static void dcache_invalidate (
+	FATFS* fs,				/* Filesystem object */
+	DWORD sclust			/* Start cluster of the directory to forget (0xFFFFFFFF:all) */
+)
+{
+	UINT i;
+
+
+	for (i = 0; i < FF_DIR_CACHE_SIZE; i++) {
+		if (sclust == 0xFFFFFFFF || fs->dcache[i].sclust == sclust) {
+			fs->dcache[i].ofs = 0xFFFFFFFF;
+		}
+	}
+}
+#endif
+
+
+
+
 /*-----------------------------------------------------------------------*/
 /* Directory handling - Find an object in the directory                  */
 /*-----------------------------------------------------------------------*/
 
-static FRESULT dir_find (	/* FR_OK(0):succeeded, !=0:error */
-	DIR* dp					/* Pointer to the directory object with the file name */
+static FRESULT dir_scan (	/* FR_OK(0):succeeded, !=0:error */
+	DIR* dp					/* Pointer to the directory object positioned where to start */
 )
 {
 	FRESULT res;
@@ -2394,29 +2454,6 @@ static FRESULT dir_find (	/* FR_OK(0):succeeded, !=0:error */
 	BYTE a, ord, sum;
 #endif
 
-	res = dir_sdi(dp, 0);			/* Rewind directory object */
-	if (res != FR_OK) return res;
-#if FF_FS_EXFAT
-	if (fs->fs_type == FS_EXFAT) {	/* On the exFAT volume */
-		BYTE nc;
-		UINT di, ni;
-		WORD hash = xname_sum(fs->lfnbuf);		/* Hash value of the name to find */
-
-		while ((res = DIR_READ_FILE(dp)) == FR_OK) {	/* Read an item */
-#if FF_MAX_LFN < 255
-			if (fs->dirbuf[XDIR_NumName] > FF_MAX_LFN) continue;		/* Skip comparison if inaccessible object name */
-#endif
-			if (ld_word(fs->dirbuf + XDIR_NameHash) != hash) continue;	/* Skip comparison if hash mismatched */
-			for (nc = fs->dirbuf[XDIR_NumName], di = SZDIRE * 2, ni = 0; nc; nc--, di += 2, ni++) {	/* Compare the name */
-				if ((di % SZDIRE) == 0) di += 2;
-				if (ff_wtoupper(ld_word(fs->dirbuf + di)) != ff_wtoupper(fs->lfnbuf[ni])) break;
-			}
-			if (nc == 0 && !fs->lfnbuf[ni]) break;	/* Name matched? */
-		}
-		return res;
-	}
-#endif
-	/* On the FAT/FAT32 volume */
 #if FF_USE_LFN
 	ord = sum = 0xFF; dp->blk_ofs = 0xFFFFFFFF;	/* Reset LFN sequence */
 #endif
@@ -2457,6 +2494,68 @@ static FRESULT dir_find (	/* FR_OK(0):succeeded, !=0:error */
 }
 
 
+static FRESULT dir_find (	/* FR_OK(0):succeeded, !=0:error */
+	DIR* dp					/* Pointer to the directory object with the file name */
+)
+{
+	FRESULT res;
+#if FF_FS_EXFAT || (FF_USE_LFN && FF_DIR_CACHE_SIZE)
+	FATFS *fs = dp->obj.fs;
+#endif
+#if FF_USE_LFN && FF_DIR_CACHE_SIZE
+	FFDCACHE *dc;
+	DWORD hash;
+#endif
+
+	res = dir_sdi(dp, 0);			/* Rewind directory object */
+	if (res != FR_OK) return res;
+#if FF_FS_EXFAT
+	if (fs->fs_type == FS_EXFAT) {	/* On the exFAT volume */
+		BYTE nc;
+		UINT di, ni;
+		WORD hash = xname_sum(fs->lfnbuf);		/* Hash value of the name to find */
+
+		while ((res = DIR_READ_FILE(dp)) == FR_OK) {	/* Read an item */
+#if FF_MAX_LFN < 255
+			if (fs->dirbuf[XDIR_NumName] > FF_MAX_LFN) continue;		/* Skip comparison if inaccessible object name */
+#endif
+			if (ld_word(fs->dirbuf + XDIR_NameHash) != hash) continue;	/* Skip comparison if hash mismatched */
+			for (nc = fs->dirbuf[XDIR_NumName], di = SZDIRE * 2, ni = 0; nc; nc--, di += 2, ni++) {	/* Compare the name */
+				if ((di % SZDIRE) == 0) di += 2;
+				if (ff_wtoupper(ld_word(fs->dirbuf + di)) != ff_wtoupper(fs->lfnbuf[ni])) break;
+			}
+			if (nc == 0 && !fs->lfnbuf[ni]) break;	/* Name matched? */
+		}
+		return res;
+	}
+#endif
+	/* On the FAT/FAT32 volume */
+#if FF_USE_LFN && FF_DIR_CACHE_SIZE
+	if (!(dp->fn[NSFLAG] & NS_NOLFN)) {	/* Searching by the name? */
+		hash = dcache_hash(dp->obj.sclust, fs->lfnbuf);
+		dc = &fs->dcache[hash % FF_DIR_CACHE_SIZE];
+		if (dc->ofs != 0xFFFFFFFF && dc->hash == hash && dc->sclust == dp->obj.sclust) {
+			res = dir_sdi(dp, dc->ofs);		/* Start at the location the name was found last time */
+			if (res == FR_OK) res = dir_scan(dp);
+			if (res == FR_NO_FILE || res == FR_INT_ERR) {	/* Not found there? */
+				res = dir_sdi(dp, 0);		/* Scan the whole table */
+				if (res == FR_OK) res = dir_scan(dp);
+			}
+		} else {
+			res = dir_scan(dp);
+		}
+		if (res == FR_OK) {					/* Remember the location of the object */
+			dc->hash = hash;
+			dc->sclust = dp->obj.sclust;
+			dc->ofs = (dp->blk_ofs != 0xFFFFFFFF) ? dp->blk_ofs : dp->dptr;
+		}
+		return res;
+	}
+#endif
+	return dir_scan(dp);
+}
+
+
 
 
 #if !FF_FS_READONLY
@@ -3397,6 +3496,9 @@ static FRESULT mount_volume (	/* FR_OK(0): successful, !=0: an error occurred */
 	DWORD tsect, sysect, fasize, nclst, szbfat;
 	WORD nrsv;
 	UINT fmt;
+#if FF_USE_FREESCAN
+	DWORD vsn;
+#endif
 
 
 	/* Get logical drive number */
@@ -3563,6 +3665,9 @@ static FRESULT mount_volume (	/* FR_OK(0): successful, !=0: an error occurred */
 		if (fs->fsize < (szbfat + (SS(fs) - 1)) / SS(fs)) return FR_NO_FILESYSTEM;	/* (BPB_FATSz must not be less than the size needed) */
 
 #if !FF_FS_READONLY
+#if FF_USE_FREESCAN
+		vsn = ld_dword(fs->win + ((fmt == FS_FAT32) ? BS_VolID32 : BS_VolID));	/* Volume serial number */
+#endif
 		/* Get FSInfo if available */
 		fs->last_clst = fs->free_clst = 0xFFFFFFFF;		/* Initialize cluster allocation information */
 		fs->fsi_flag = 0x80;
@@ -3585,11 +3690,27 @@ static FRESULT mount_volume (	/* FR_OK(0): successful, !=0: an error occurred */
 			}
 		}
 #endif	/* (FF_FS_NOFSINFO & 3) != 3 */
+#if FF_USE_FREESCAN
+		if (fs->keep_vsn != vsn) {		/* Is it another volume than the one whose count is kept? */
+			fs->keep_vsn = vsn;
+			fs->keep_free = 0;
+		}
+		if (fmt != FS_FAT32 && fs->keep_free != 0 && fs->keep_free - 1 <= fs->n_fatent - 2) {
+			fs->free_clst = fs->keep_free - 1;	/* FAT12/16: Trust the count kept at the last sync */
+		}	/* The count is not stored on FAT12/16 volumes and does not survive a reset */
+#endif
 #endif	/* !FF_FS_READONLY */
 	}
 
 	fs->fs_type = (BYTE)fmt;/* FAT sub-type (the filesystem object gets valid) */
 	fs->id = ++Fsid;		/* Volume mount ID */
+#if FF_USE_FREESCAN
+	fs->scan_clst = (fmt != FS_EXFAT) ? 2 : 0;	/* Validate the free cluster count in background */
+	fs->scan_free = 0;
+#endif
+#if FF_USE_LFN && FF_DIR_CACHE_SIZE
+	dcache_invalidate(fs, 0xFFFFFFFF);	/* Forget the locations on the previous volume */
+#endif
 #if FF_USE_LFN == 1
 	fs->lfnbuf = LfnBuf;	/* Static LFN working buffer */
 #if FF_FS_EXFAT
@@ -4811,6 +4932,61 @@ FRESULT f_stat (
 
 
 #if !FF_FS_READONLY
+#if FF_USE_FREESCAN
+/*-----------------------------------------------------------------------*/
+/* Check the FAT entries in a sector for the free cluster scan           */
+/*-----------------------------------------------------------------------*/
+
+static FRESULT scan_free_step (	/* FR_OK(0):succeeded, !=0:error */
+	FATFS* fs					/* Filesystem object with a scan in progress */
+)
+{
+	FRESULT res;
+	DWORD clst = fs->scan_clst, nfree = 0, stat;
+	UINT i, n;
+	FFOBJID obj;
+
+
+	if (fs->fs_type == FS_FAT12) {	/* FAT12: Get bit field FAT entries (as many as in a sector) */
+		obj.fs = fs;
+		n = SS(fs) * 2 / 3;
+		do {
+			stat = get_fat(&obj, clst);
+			if (stat == 0xFFFFFFFF) return FR_DISK_ERR;
+			if (stat == 1) return FR_INT_ERR;
+			if (stat == 0) nfree++;
+		} while (++clst < fs->n_fatent && --n);
+	} else {						/* FAT16/32: Count entries with zero in the FAT sector of the cluster */
+		n = (fs->fs_type == FS_FAT16) ? 2 : 4;	/* Size of an entry */
+		res = move_window(fs, fs->fatbase + clst / (SS(fs) / n));
+		if (res != FR_OK) return res;
+		i = clst % (SS(fs) / n) * n;			/* Offset in the sector */
+		do {
+			if (n == 2) {
+				if (ld_word(fs->win + i) == 0) nfree++;
+			} else {
+				if ((ld_dword(fs->win + i) & 0x0FFFFFFF) == 0) nfree++;
+			}
+			i += n;
+		} while (++clst < fs->n_fatent && i < SS(fs));
+	}
+	fs->scan_free += nfree;
+	fs->scan_clst = clst;
+	if (clst >= fs->n_fatent) {		/* Reached end of the FAT? */
+		if (fs->free_clst != fs->scan_free) {	/* Set or correct the free cluster count */
+			fs->free_clst = fs->scan_free;
+			fs->fsi_flag |= 1;		/* FAT32: FSInfo is to be updated */
+		}
+		fs->scan_clst = 0;			/* The count is valid */
+	}
+	return FR_OK;
+}
+
+#endif
+
+
+
+
 /*-----------------------------------------------------------------------*/
 /* Get Number of Free Clusters                                           */
 /*-----------------------------------------------------------------------*/
@@ -4833,6 +5009,11 @@ FRESULT f_getfree (
 	res = mount_volume(&path, &fs, 0);
 	if (res == FR_OK) {
 		*fatfs = fs;				/* Return ptr to the fs object */
+#if FF_USE_FREESCAN
+		while (fs->free_clst > fs->n_fatent - 2 && fs->scan_clst != 0) {	/* Count unknown: complete the background scan */
+			if (scan_free_step(fs) != FR_OK) break;
+		}
+#endif
 		/* If free_clst is valid, return it without full FAT scan */
 		if (fs->free_clst <= fs->n_fatent - 2) {
 			*nclst = fs->free_clst;
@@ -4907,6 +5088,42 @@ FRESULT f_getfree (
 
 
 
+#if FF_USE_FREESCAN
+/*-----------------------------------------------------------------------*/
+/* Validate Number of Free Clusters                                      */
+/*-----------------------------------------------------------------------*/
+
+FRESULT f_freescan (
+	const TCHAR* path,	/* Logical drive number */
+	DWORD* nleft		/* Pointer to a variable to return number of FAT entries left to check */
+)
+{
+	FRESULT res;
+	FATFS *fs;
+	BYTE fsi;
+
+
+	/* Get logical drive */
+	res = mount_volume(&path, &fs, 0);
+	if (res == FR_OK && fs->scan_clst != 0) {
+		fsi = fs->fsi_flag;
+		res = scan_free_step(fs);		/* Check the next FAT sector */
+		if (res == FR_OK && fs->scan_clst == 0 && fsi == 0 && fs->fsi_flag == 1) {
+			res = sync_fs(fs);			/* FAT32: Write the corrected count into the FSInfo now */
+		}
+	}
+	if (res == FR_OK) {
+		*nleft = (fs->scan_clst != 0) ? fs->n_fatent - fs->scan_clst : 0;
+	}
+
+	LEAVE_FF(fs, res);
+}
+
+#endif
+
+
+
+
 /*-----------------------------------------------------------------------*/
 /* Truncate File                                                         */
 /*-----------------------------------------------------------------------*/
@@ -5032,6 +5249,10 @@ FRESULT f_unlink (
 			}
 			if (res == FR_OK) {
 				res = dir_remove(&dj);			/* Remove the directory entry */
+#if FF_USE_LFN && FF_DIR_CACHE_SIZE
+				dcache_invalidate(fs, dj.obj.sclust);	/* Forget the locations in the directory */
+				if (dj.obj.attr & AM_DIR) dcache_invalidate(fs, dclst);	/* and in the removed one */
+#endif
 				if (res == FR_OK && dclst != 0) {	/* Remove the cluster chain if exist */
 #if FF_FS_EXFAT
 					res = remove_chain(&obj, dclst, 0);
@@ -5099,6 +5320,9 @@ FRESULT f_mkdir (
 						fs->wflag = 1;
 					}
 					res = dir_register(&dj);	/* Register the object to the parent directoy */
+#if FF_USE_LFN && FF_DIR_CACHE_SIZE
+					dcache_invalidate(fs, dj.obj.sclust);	/* Forget the locations in the parent directory */
+#endif
 				}
 			}
 			if (res == FR_OK) {
@@ -5223,6 +5447,10 @@ FRESULT f_rename (
 					}
 				}
 			}
+#if FF_USE_LFN && FF_DIR_CACHE_SIZE
+			dcache_invalidate(fs, djo.obj.sclust);	/* Forget the locations in both directories */
+			dcache_invalidate(fs, djn.obj.sclust);
+#endif
 			if (res == FR_OK) {
 				res = dir_remove(&djo);		/* Remove old entry */
 				if (res == FR_OK) {
@@ -5626,6 +5854,9 @@ FRESULT f_expand (
 				for (clst = scl, n = tcl; n; clst++, n--) {	/* Create a cluster chain on the FAT */
 					res = put_fat(fs, clst, (n == 1) ? 0xFFFFFFFF : clst + 1);
 					if (res != FR_OK) break;
+#if FF_USE_FREESCAN
+					if (clst < fs->scan_clst) fs->scan_free--;	/* Already passed by the free cluster scan? */
+#endif
 					lclst = clst;
 				}
 			} else {		/* Set it as suggested point for next allocation */
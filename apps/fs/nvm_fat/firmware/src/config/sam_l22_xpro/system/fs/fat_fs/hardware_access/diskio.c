@@ -15,6 +15,8 @@ typedef struct
 {
     SYS_FS_MEDIA_COMMAND_STATUS commandStatus;
     SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE commandHandle;
+    /* Transfer started by disk_transfer, which is not waited for */
+    SYS_FS_MEDIA_COMMAND_STATUS transferStatus;
 } SYS_FS_DISK_DATA;
 
 static SYS_FS_DISK_DATA CACHE_ALIGN gSysFsDiskData[SYS_FS_MEDIA_NUMBER];
@@ -26,19 +28,37 @@ void diskEventHandler
     uintptr_t context
 )
 {
+    SYS_FS_MEDIA_COMMAND_STATUS *commandStatus = &gSysFsDiskData[context].commandStatus;
+
+    /* The other commands of the disk are submitted once the transfer ended,
+     * so an event received while it is in progress belongs to it */
+    if (gSysFsDiskData[context].transferStatus == SYS_FS_MEDIA_COMMAND_IN_PROGRESS)
+    {
+        commandStatus = &gSysFsDiskData[context].transferStatus;
+    }
+
     switch(event)
     {
         case SYS_FS_MEDIA_EVENT_BLOCK_COMMAND_COMPLETE:
-            gSysFsDiskData[context].commandStatus = SYS_FS_MEDIA_COMMAND_COMPLETED;
+            *commandStatus = SYS_FS_MEDIA_COMMAND_COMPLETED;
             break;
         case SYS_FS_MEDIA_EVENT_BLOCK_COMMAND_ERROR:
-            gSysFsDiskData[context].commandStatus= SYS_FS_MEDIA_COMMAND_UNKNOWN;
+            *commandStatus = SYS_FS_MEDIA_COMMAND_UNKNOWN;
             break;
         default:
             break;
     }
 }
 
+static void disk_waitTransfer(uint8_t pdrv)
+{
+    /* The media runs one command of the disk at a time */
+    while (gSysFsDiskData[pdrv].transferStatus == SYS_FS_MEDIA_COMMAND_IN_PROGRESS)
+    {
+        SYS_FS_MEDIA_MANAGER_TransferTask (pdrv);
+    }
+}
+
 static DRESULT disk_checkCommandStatus(uint8_t pdrv)
 {
     DRESULT result = RES_ERROR;
@@ -117,6 +137,8 @@ static DRESULT disk_read_aligned
 {
     DRESULT result = RES_ERROR;
 
+    disk_waitTransfer(pdrv);
+
     gSysFsDiskData[pdrv].commandStatus = SYS_FS_MEDIA_COMMAND_IN_PROGRESS;
 
     gSysFsDiskData[pdrv].commandHandle = SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE_INVALID;
@@ -168,6 +190,8 @@ DRESULT disk_write
     DRESULT result = RES_ERROR;
 
     {
+        disk_waitTransfer(pdrv);
+
         gSysFsDiskData[pdrv].commandStatus = SYS_FS_MEDIA_COMMAND_IN_PROGRESS;
 
         gSysFsDiskData[pdrv].commandHandle = SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE_INVALID;
@@ -186,6 +210,75 @@ DRESULT disk_write
 #endif
 
 
+/*-----------------------------------------------------------------------*/
+/* Start a Sector Transfer                                               */
+/*-----------------------------------------------------------------------*/
+/* The transfer is submitted to the media and not waited for. The next   */
+/* disk_read, disk_write or disk_transfer of the drive waits for it.     */
+
+DRESULT disk_transfer
+(
+    uint8_t pdrv,       /* Physical drive nmuber (0..) */
+    uint8_t *buff,      /* Data buffer, must stay valid until the end */
+    uint32_t sector,    /* Sector address (LBA) */
+    uint32_t count,     /* Number of sectors to transfer */
+    bool write          /* Write the sectors, read them otherwise */
+)
+{
+    SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE commandHandle = SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE_INVALID;
+
+    disk_waitTransfer(pdrv);
+
+    gSysFsDiskData[pdrv].transferStatus = SYS_FS_MEDIA_COMMAND_IN_PROGRESS;
+
+    if (write == true)
+    {
+        commandHandle = SYS_FS_MEDIA_MANAGER_SectorWrite(pdrv, sector, buff, count);
+    }
+    else
+    {
+        commandHandle = SYS_FS_MEDIA_MANAGER_SectorRead(pdrv, buff, sector, count);
+    }
+
+    if (commandHandle == SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE_INVALID)
+    {
+        gSysFsDiskData[pdrv].transferStatus = SYS_FS_MEDIA_COMMAND_UNKNOWN;
+        return RES_PARERR;
+    }
+
+    return RES_OK;
+}
+
+/*-----------------------------------------------------------------------*/
+/* Get the State of the Sector Transfer                                  */
+/*-----------------------------------------------------------------------*/
+/* Returns RES_NOTRDY while the transfer is in progress. The media task  */
+/* routine is not run: the transfer advances with the driver tasks.      */
+
+DRESULT disk_transfer_status
+(
+    uint8_t pdrv        /* Physical drive nmuber (0..) */
+)
+{
+    DRESULT result = RES_ERROR;
+
+    if (gSysFsDiskData[pdrv].transferStatus == SYS_FS_MEDIA_COMMAND_IN_PROGRESS)
+    {
+        result = RES_NOTRDY;
+    }
+    else if (gSysFsDiskData[pdrv].transferStatus == SYS_FS_MEDIA_COMMAND_COMPLETED)
+    {
+        result = RES_OK;
+    }
+    else
+    {
+        /* Nothing to do */
+    }
+
+    return result;
+}
+
+
 /*-----------------------------------------------------------------------*/
 /* Miscellaneous Functions                                               */
 /*-----------------------------------------------------------------------*/
@@ -221,6 +314,22 @@ DRESULT disk_ioctl (
 
         *(uint32_t *)buff = numSectors;
     }
+#if defined(SYS_FS_MEDIA_MANAGER_CACHE_SECTORS)
+    else if (cmd == CTRL_SYNC)
+    {
+        disk_waitTransfer(pdrv);
+
+        /* Write the sectors held by the media manager cache */
+        if (SYS_FS_MEDIA_MANAGER_CacheFlush (pdrv) == false)
+        {
+            return RES_ERROR;
+        }
+    }
+#endif
+    else
+    {
+        /* Nothing to do */
+    }
 
     return RES_OK;
 }
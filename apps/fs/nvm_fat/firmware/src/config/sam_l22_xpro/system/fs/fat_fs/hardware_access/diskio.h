@@ -12,6 +12,7 @@ extern "C" {
 #define _USE_WRITE	1	/* 1: Enable disk_write function */
 #define _USE_IOCTL	1	/* 1: Enable disk_ioctl fucntion */
 
+#include <stdbool.h>
 #include "ff.h"
 
 /* Status of Disk Functions */
@@ -36,6 +37,8 @@ DSTATUS disk_status (uint8_t pdrv);
 DRESULT disk_read (uint8_t pdrv, uint8_t* buff, uint32_t sector, uint32_t count);
 DRESULT disk_write (uint8_t pdrv, const uint8_t* buff, uint32_t sector, uint32_t count);
 DRESULT disk_ioctl (uint8_t pdrv, uint8_t cmd, void* buff);
+DRESULT disk_transfer (uint8_t pdrv, uint8_t* buff, uint32_t sector, uint32_t count, bool write);
+DRESULT disk_transfer_status (uint8_t pdrv);
 
 
 /* Disk Status Bits (DSTATUS) */
@@ -121,6 +121,23 @@ static OSAL_MUTEX_DECLARE(gSysFsMutex);
 /* Variable to hold the error value */
 static SYS_FS_ERROR errorValue;
 
+#if defined(SYS_FS_FILE_ASYNC_QUEUE_SIZE)
+// *****************************************************************************
+/* Asynchronous file transfer queue
+
+  Summary:
+    Defines the queue of the transfers requested by SYS_FS_FileReadAsync and
+    SYS_FS_FileWriteAsync.
+
+  Description:
+    The transfers are performed in order by SYS_FS_Tasks.
+
+  Remarks:
+    None
+*/
+static SYS_FS_FILE_ASYNC_QUEUE gSYSFSFileAsyncQueue;
+#endif
+
 //******************************************************************************
 /*Function:
     static bool SYS_FS_GetDisk
@@ -265,52 +282,560 @@ static bool SYS_FS_StringWildCardCompare
 {
     do
     {
-        if((*ptr1 != '?') && (*ptr1 != '*') && (*ptr1 != *ptr2))
+        if((*ptr1 != '?') && (*ptr1 != '*') && (*ptr1 != *ptr2))
+        {
+            return false;
+        }
+        else
+        {
+           if(*ptr1 == '*')
+            {
+                ptr1++;
+                if(*ptr1 == '\0')
+                {
+                    return true;
+                }
+                else if(*ptr1 == '?')
+                {
+                    continue;
+                }
+                else
+                {
+                    // Find the same character in second string as well
+                    while((*ptr1 != *ptr2) && (*ptr2 != '\0'))
+                    {
+                        ptr2++;
+                    }
+                    if(*ptr2 == '\0')
+                    {
+                        return false;
+                    }
+                }
+            }
+            else
+            {
+                ptr1++;
+                ptr2++;
+            }
+        }
+    }while(*ptr1 != '\0');
+
+    if((*ptr1 == '\0') && (*ptr2 == '\0'))
+    {
+        return true;
+    }
+    return false;
+}
+
+
+#if defined(SYS_FS_FILE_ASYNC_QUEUE_SIZE)
+//******************************************************************************
+/*Function:
+    static SYS_FS_RESULT SYS_FS_FileAsyncRequestAdd
+    (
+        SYS_FS_HANDLE handle,
+        uint8_t *buffer,
+        size_t nbyte,
+        SYS_FS_FILE_ASYNC_CALLBACK callback,
+        uintptr_t context,
+        bool isWrite
+    )
+
+  Summary:
+    Queues an asynchronous file transfer.
+
+  Description:
+    This function validates the file handle and adds the transfer at the tail
+    of the asynchronous transfer queue.
+
+  Remarks:
+    None
+***************************************************************************/
+static SYS_FS_RESULT SYS_FS_FileAsyncRequestAdd
+(
+    SYS_FS_HANDLE handle,
+    uint8_t *buffer,
+    size_t nbyte,
+    SYS_FS_FILE_ASYNC_CALLBACK callback,
+    uintptr_t context,
+    bool isWrite
+)
+{
+    SYS_FS_OBJ *fileObj = (SYS_FS_OBJ *)handle;
+    SYS_FS_FILE_ASYNC_REQUEST *request = NULL;
+    SYS_FS_RESULT result = SYS_FS_RES_FAILURE;
+
+    /* Check if the handle is valid. */
+    if (handle == SYS_FS_HANDLE_INVALID)
+    {
+        errorValue = SYS_FS_ERROR_INVALID_OBJECT;
+        return SYS_FS_RES_FAILURE;
+    }
+
+    /* Check if the file object is in use. */
+    if (fileObj->inUse == false)
+    {
+        errorValue = SYS_FS_ERROR_INVALID_OBJECT;
+        return SYS_FS_RES_FAILURE;
+    }
+
+    if ((buffer == NULL) && (nbyte != 0U))
+    {
+        errorValue = SYS_FS_ERROR_INVALID_PARAMETER;
+        return SYS_FS_RES_FAILURE;
+    }
+
+    if (OSAL_MUTEX_Lock(&gSysFsMutex, OSAL_WAIT_FOREVER) != OSAL_RESULT_SUCCESS)
+    {
+        errorValue = SYS_FS_ERROR_DENIED;
+        return SYS_FS_RES_FAILURE;
+    }
+
+    if (gSYSFSFileAsyncQueue.count < SYS_FS_FILE_ASYNC_QUEUE_SIZE)
+    {
+        request = &gSYSFSFileAsyncQueue.requests[(gSYSFSFileAsyncQueue.head + gSYSFSFileAsyncQueue.count) % SYS_FS_FILE_ASYNC_QUEUE_SIZE];
+
+        request->handle = handle;
+        request->buffer = buffer;
+        request->nbyte = nbyte;
+        request->nDone = 0U;
+        request->callback = callback;
+        request->context = context;
+        request->isWrite = isWrite;
+        request->isCancelled = false;
+        request->nPending = 0U;
+        request->pdrv = 0U;
+        request->fsFunctions = NULL;
+
+        gSYSFSFileAsyncQueue.count++;
+        result = SYS_FS_RES_SUCCESS;
+    }
+    else
+    {
+        errorValue = SYS_FS_ERROR_NOT_ENOUGH_CORE;
+    }
+
+    (void) OSAL_MUTEX_Unlock(&gSysFsMutex);
+
+    return result;
+}
+
+//******************************************************************************
+/*Function:
+    static void SYS_FS_FileAsyncCancel
+    (
+        SYS_FS_HANDLE handle
+    )
+
+  Summary:
+    Cancels the asynchronous transfers of a file being closed.
+
+  Description:
+    The cancelled transfers stay in the queue and are ended with a failure by
+    SYS_FS_Tasks, so the callbacks are never called from SYS_FS_FileClose. A
+    sector transfer in progress runs to its end: the media commands that
+    follow, those of the close included, wait for it in the disk layer.
+
+  Remarks:
+    None
+***************************************************************************/
+static void SYS_FS_FileAsyncCancel
+(
+    SYS_FS_HANDLE handle
+)
+{
+    SYS_FS_FILE_ASYNC_REQUEST *request = NULL;
+    uint32_t index = 0;
+
+    if (OSAL_MUTEX_Lock(&gSysFsMutex, OSAL_WAIT_FOREVER) != OSAL_RESULT_SUCCESS)
+    {
+        return;
+    }
+
+    for (index = 0; index < gSYSFSFileAsyncQueue.count; index++)
+    {
+        request = &gSYSFSFileAsyncQueue.requests[(gSYSFSFileAsyncQueue.head + index) % SYS_FS_FILE_ASYNC_QUEUE_SIZE];
+
+        if (request->handle == handle)
+        {
+            request->isCancelled = true;
+        }
+    }
+
+    (void) OSAL_MUTEX_Unlock(&gSysFsMutex);
+}
+
+//******************************************************************************
+/*Function:
+    static bool SYS_FS_FileAsyncTransferStart
+    (
+        SYS_FS_FILE_ASYNC_REQUEST *request,
+        size_t *chunkSize
+    )
+
+  Summary:
+    Starts the media transfer of the whole sectors of a chunk.
+
+  Description:
+    When the file pointer is on a sector boundary, this function locates the
+    media sectors of the chunk, allocating them first for a write that grows
+    the file, and submits their transfer without waiting for its end. The
+    transfer stops at the end of the file and of the contiguous clusters.
+
+  Remarks:
+    Returns false if the chunk has to be moved by the native file system:
+    the file pointer is inside a sector, less than a sector is left before
+    the end of the file, or the native file system has no sector access.
+    When the file pointer is inside a sector, chunkSize is reduced to end the
+    chunk at the sector boundary, so that the next chunk can be transferred.
+***************************************************************************/
+static bool SYS_FS_FileAsyncTransferStart
+(
+    SYS_FS_FILE_ASYNC_REQUEST *request,
+    size_t *chunkSize
+)
+{
+    SYS_FS_OBJ *fileObj = (SYS_FS_OBJ *)request->handle;
+    const SYS_FS_FUNCTIONS *fsFunctions = fileObj->mountPoint->fsFunctions;
+    int fileStatus = -1;
+    uint32_t offset = 0;
+    uint32_t sector = 0;
+    uint8_t pdrv = 0;
+    /* The media manager sectors are 512 bytes long */
+    uint32_t length = (uint32_t)(*chunkSize - (*chunkSize % 512U));
+
+    if ((fsFunctions->tell == NULL) || (fsFunctions->seek == NULL) || (fsFunctions->allocate == NULL) ||
+            (fsFunctions->extentGet == NULL) || (fsFunctions->sectorTransfer == NULL) ||
+            (fsFunctions->sectorTransferStatus == NULL))
+    {
+        return false;
+    }
+
+    if (OSAL_MUTEX_Lock(&(fileObj->mountPoint->mutexDiskVolume), OSAL_WAIT_FOREVER) != OSAL_RESULT_SUCCESS)
+    {
+        return false;
+    }
+
+    offset = fsFunctions->tell(fileObj->nativeFSFileObj);
+
+    if ((offset % 512U) != 0U)
+    {
+        if (*chunkSize > (512U - (offset % 512U)))
+        {
+            *chunkSize = 512U - (offset % 512U);
+        }
+    }
+    else if (length != 0U)
+    {
+        fileStatus = 0;
+
+        if (request->isWrite == true)
+        {
+            /* Allocate the clusters the chunk adds to the file */
+            fileStatus = fsFunctions->allocate(fileObj->nativeFSFileObj, offset + length, false);
+        }
+
+        if (fileStatus == 0)
+        {
+            fileStatus = fsFunctions->extentGet(fileObj->nativeFSFileObj, offset, &length, &pdrv, &sector);
+        }
+
+        length -= (length % 512U);
+
+        if ((fileStatus == 0) && (length != 0U))
+        {
+            fileStatus = fsFunctions->sectorTransfer(pdrv, sector, &request->buffer[request->nDone], length / 512U, request->isWrite);
+        }
+    }
+
+    (void) OSAL_MUTEX_Unlock(&(fileObj->mountPoint->mutexDiskVolume));
+
+    if ((fileStatus != 0) || (length == 0U))
+    {
+        return false;
+    }
+
+    request->fsFunctions = fsFunctions;
+    request->pdrv = pdrv;
+    request->nPending = length;
+
+    return true;
+}
+
+//******************************************************************************
+/*Function:
+    static bool SYS_FS_FileAsyncTransferEnd
+    (
+        SYS_FS_FILE_ASYNC_REQUEST *request,
+        SYS_FS_RESULT *result
+    )
+
+  Summary:
+    Checks the end of the media transfer of a request.
+
+  Description:
+    This function returns false while the transfer is in progress. When it
+    has ended, the file pointer is moved over the bytes transferred, unless
+    the file was closed meanwhile.
+
+  Remarks:
+    result is set to SYS_FS_RES_FAILURE if the transfer failed or the file
+    was closed.
+***************************************************************************/
+static bool SYS_FS_FileAsyncTransferEnd
+(
+    SYS_FS_FILE_ASYNC_REQUEST *request,
+    SYS_FS_RESULT *result
+)
+{
+    SYS_FS_OBJ *fileObj = (SYS_FS_OBJ *)request->handle;
+    const SYS_FS_FUNCTIONS *fsFunctions = request->fsFunctions;
+    size_t nTransferred = request->nPending;
+    bool isDone = false;
+    int fileStatus = -1;
+    uint32_t offset = 0;
+
+    fileStatus = fsFunctions->sectorTransferStatus(request->pdrv, &isDone);
+
+    if (isDone == false)
+    {
+        return false;
+    }
+
+    request->nPending = 0U;
+
+    if (request->isCancelled == true)
+    {
+        *result = SYS_FS_RES_FAILURE;
+        return true;
+    }
+
+    if (fileStatus == 0)
+    {
+        if (OSAL_MUTEX_Lock(&(fileObj->mountPoint->mutexDiskVolume), OSAL_WAIT_FOREVER) == OSAL_RESULT_SUCCESS)
+        {
+            offset = fsFunctions->tell(fileObj->nativeFSFileObj);
+            fileStatus = fsFunctions->seek(fileObj->nativeFSFileObj, offset + (uint32_t)nTransferred);
+
+            (void) OSAL_MUTEX_Unlock(&(fileObj->mountPoint->mutexDiskVolume));
+        }
+        else
+        {
+            fileStatus = (int)SYS_FS_ERROR_DENIED;
+        }
+    }
+
+    if (fileStatus != 0)
+    {
+        fileObj->errorValue = (SYS_FS_ERROR)fileStatus;
+        *result = SYS_FS_RES_FAILURE;
+        return true;
+    }
+
+    request->nDone += nTransferred;
+    *result = SYS_FS_RES_SUCCESS;
+
+    return true;
+}
+
+//******************************************************************************
+/*Function:
+    static void SYS_FS_FileAsyncTasks
+    (
+        void
+    )
+
+  Summary:
+    Advances the asynchronous file transfer in progress.
+
+  Description:
+    This function moves at most SYS_FS_FILE_ASYNC_CHUNK_SIZE bytes of the
+    request at the head of the queue. The whole sectors of a chunk are moved
+    by a media transfer that is started here and checked on the next call, so
+    the call does not wait for the media; the bytes of a partial sector are
+    moved by the native file system. When the request ends, it is removed
+    from the queue before its callback is called, so the callback can queue
+    another transfer.
+
+  Remarks:
+    None
+***************************************************************************/
+static void SYS_FS_FileAsyncTasks
+(
+    void
+)
+{
+    SYS_FS_FILE_ASYNC_REQUEST *request = NULL;
+    SYS_FS_FILE_ASYNC_REQUEST doneRequest;
+    SYS_FS_RESULT result = SYS_FS_RES_SUCCESS;
+    size_t chunkSize = 0;
+    size_t nTransferred = 0;
+    bool isDone = false;
+
+    if (gSYSFSFileAsyncQueue.count == 0U)
+    {
+        return;
+    }
+
+    request = &gSYSFSFileAsyncQueue.requests[gSYSFSFileAsyncQueue.head];
+
+    if (request->nPending != 0U)
+    {
+        /* Media transfer started by a previous call */
+        if (SYS_FS_FileAsyncTransferEnd(request, &result) == false)
+        {
+            return;
+        }
+
+        isDone = ((result == SYS_FS_RES_FAILURE) || (request->nDone == request->nbyte));
+    }
+
+    if (isDone == true)
+    {
+        /* The request ended with the transfer */
+    }
+    else if (request->isCancelled == true)
+    {
+        result = SYS_FS_RES_FAILURE;
+        isDone = true;
+    }
+    else
+    {
+        chunkSize = request->nbyte - request->nDone;
+
+        if (chunkSize > SYS_FS_FILE_ASYNC_CHUNK_SIZE)
+        {
+            chunkSize = SYS_FS_FILE_ASYNC_CHUNK_SIZE;
+        }
+
+        if (chunkSize == 0U)
+        {
+            isDone = true;
+        }
+        else if (SYS_FS_FileAsyncTransferStart(request, &chunkSize) == true)
+        {
+            /* The transfer is checked on the next call */
+        }
+        else
+        {
+            if (request->isWrite == true)
+            {
+                nTransferred = SYS_FS_FileWrite(request->handle, (const void *)&request->buffer[request->nDone], chunkSize);
+            }
+            else
+            {
+                nTransferred = SYS_FS_FileRead(request->handle, (void *)&request->buffer[request->nDone], chunkSize);
+            }
+
+            if (nTransferred == 0XFFFFFFFFU)
+            {
+                /* The error is kept in the file object for SYS_FS_FileError */
+                result = SYS_FS_RES_FAILURE;
+                isDone = true;
+            }
+            else
+            {
+                request->nDone += nTransferred;
+
+                /* A short transfer ends at the end of the file or volume */
+                if ((nTransferred < chunkSize) || (request->nDone == request->nbyte))
+                {
+                    isDone = true;
+                }
+            }
+        }
+    }
+
+    if (isDone == false)
+    {
+        return;
+    }
+
+    doneRequest = *request;
+
+    if (OSAL_MUTEX_Lock(&gSysFsMutex, OSAL_WAIT_FOREVER) != OSAL_RESULT_SUCCESS)
+    {
+        return;
+    }
+
+    gSYSFSFileAsyncQueue.head = (gSYSFSFileAsyncQueue.head + 1U) % SYS_FS_FILE_ASYNC_QUEUE_SIZE;
+    gSYSFSFileAsyncQueue.count--;
+
+    (void) OSAL_MUTEX_Unlock(&gSysFsMutex);
+
+    if (doneRequest.callback != NULL)
+    {
+        doneRequest.callback(doneRequest.handle, result, doneRequest.nDone, doneRequest.context);
+    }
+}
+#endif
+
+//******************************************************************************
+/*Function:
+    static void SYS_FS_FreeScanTasks
+    (
+        void
+    )
+
+  Summary:
+    Advances the validation of the free cluster count of a mounted volume.
+
+  Description:
+    This function lets the native file system check one more part of the
+    allocation table of the first mounted volume whose free cluster count has
+    not been validated yet. The step is skipped when an API call holds the
+    volume, so the scan never delays the application.
+
+  Remarks:
+    None
+***************************************************************************/
+static void SYS_FS_FreeScanTasks
+(
+    void
+)
+{
+    SYS_FS_MOUNT_POINT *disk = NULL;
+    uint8_t pathWithDiskNo[3] = { 0 };
+    uint32_t remaining = 0;
+    uint32_t index = 0;
+
+    for (index = 0; index < SYS_FS_VOLUME_NUMBER; index++)
+    {
+        disk = &gSYSFSMountPoint[index];
+
+        if ((disk->inUse == false) || (disk->freeScanDone == true))
         {
-            return false;
+            continue;
         }
-        else
+
+        /* Do not wait for a volume in use */
+        if (OSAL_MUTEX_Lock(&(disk->mutexDiskVolume), 0U) == OSAL_RESULT_SUCCESS)
         {
-           if(*ptr1 == '*')
+            if ((disk->inUse == true) && (disk->fsFunctions->freeScan != NULL))
             {
-                ptr1++;
-                if(*ptr1 == '\0')
-                {
-                    return true;
-                }
-                else if(*ptr1 == '?')
-                {
-                    continue;
-                }
-                else
+                pathWithDiskNo[0] = (uint8_t)disk->diskNumber + (uint8_t)'0';
+                pathWithDiskNo[1] = (uint8_t)':';
+                pathWithDiskNo[2] = (uint8_t)'\0';
+
+                /* A volume that cannot be scanned is not retried */
+                if ((disk->fsFunctions->freeScan((const char *)pathWithDiskNo, &remaining) != 0) || (remaining == 0U))
                 {
-                    // Find the same character in second string as well
-                    while((*ptr1 != *ptr2) && (*ptr2 != '\0'))
-                    {
-                        ptr2++;
-                    }
-                    if(*ptr2 == '\0')
-                    {
-                        return false;
-                    }
+                    disk->freeScanDone = true;
                 }
             }
             else
             {
-                ptr1++;
-                ptr2++;
+                disk->freeScanDone = true;
             }
+
+            (void) OSAL_MUTEX_Unlock(&(disk->mutexDiskVolume));
         }
-    }while(*ptr1 != '\0');
 
-    if((*ptr1 == '\0') && (*ptr2 == '\0'))
-    {
-        return true;
+        /* One step per call */
+        break;
     }
-    return false;
 }
 
-
 //******************************************************************************
 /*Function:
     SYS_FS_RESULT SYS_FS_Initialize
@@ -403,6 +928,20 @@ void SYS_FS_Tasks ( void )
 {
     /* Task routine for media manager */
     SYS_FS_MEDIA_MANAGER_Tasks();
+
+#if defined(SYS_FS_FILE_ASYNC_QUEUE_SIZE)
+    /* Advance the asynchronous file transfers */
+    SYS_FS_FileAsyncTasks();
+
+    /* Validate the free cluster counts while no transfer is queued */
+    if (gSYSFSFileAsyncQueue.count == 0U)
+    {
+        SYS_FS_FreeScanTasks();
+    }
+#else
+    /* Validate the free cluster counts */
+    SYS_FS_FreeScanTasks();
+#endif
 }
 
 
@@ -636,6 +1175,7 @@ SYS_FS_RESULT SYS_FS_Mount
     /* Set the Disk in Use to true only when Mount is success */
     if (fileStatus == 0)
     {
+        disk->freeScanDone = false;
         disk->inUse = true;
 
         /* Put the recently assigned disk as the current disk */
@@ -932,6 +1472,11 @@ SYS_FS_RESULT SYS_FS_FileClose
         return SYS_FS_RES_FAILURE;
     }
 
+#if defined(SYS_FS_FILE_ASYNC_QUEUE_SIZE)
+    /* End the queued transfers of the file */
+    SYS_FS_FileAsyncCancel(handle);
+#endif
+
     /* Clear the error. */
     fileObj->errorValue = SYS_FS_ERROR_OK;
 
@@ -2451,6 +2996,79 @@ size_t SYS_FS_FileWrite
     return bytesWritten;
 }
 
+#if defined(SYS_FS_FILE_ASYNC_QUEUE_SIZE)
+//******************************************************************************
+/* Function:
+    SYS_FS_RESULT SYS_FS_FileReadAsync
+    (
+        SYS_FS_HANDLE handle,
+        void *buffer,
+        size_t nbyte,
+        SYS_FS_FILE_ASYNC_CALLBACK callback,
+        uintptr_t context
+    );
+
+  Summary:
+    Queues a read of data from the file.
+
+  Description:
+    This function queues a read that SYS_FS_Tasks performs in chunks and
+    returns immediately.
+
+  Remarks:
+    See sys_fs.h for usage information.
+***************************************************************************/
+
+SYS_FS_RESULT SYS_FS_FileReadAsync
+(
+    SYS_FS_HANDLE handle,
+    void *buffer,
+    size_t nbyte,
+    SYS_FS_FILE_ASYNC_CALLBACK callback,
+    uintptr_t context
+)
+{
+    return SYS_FS_FileAsyncRequestAdd(handle, (uint8_t *)buffer, nbyte, callback, context, false);
+}
+
+//******************************************************************************
+/* Function:
+    SYS_FS_RESULT SYS_FS_FileWriteAsync
+    (
+        SYS_FS_HANDLE handle,
+        const void *buffer,
+        size_t nbyte,
+        SYS_FS_FILE_ASYNC_CALLBACK callback,
+        uintptr_t context
+    );
+
+  Summary:
+    Queues a write of data to the file.
+
+  Description:
+    This function queues a write that SYS_FS_Tasks performs in chunks and
+    returns immediately.
+
+  Remarks:
+    See sys_fs.h for usage information.
+***************************************************************************/
+
+/* MISRA C-2012 Rule 11.8 deviated:1 Deviation record ID -  H3_MISRAC_2012_R_11_8_DR_1 */
+SYS_FS_RESULT SYS_FS_FileWriteAsync
+(
+    SYS_FS_HANDLE handle,
+    const void *buffer,
+    size_t nbyte,
+    SYS_FS_FILE_ASYNC_CALLBACK callback,
+    uintptr_t context
+)
+{
+    /* The buffer is only read by the transfer */
+    return SYS_FS_FileAsyncRequestAdd(handle, (uint8_t *)buffer, nbyte, callback, context, true);
+}
+/* MISRAC 2012 deviation block end */
+#endif
+
 //******************************************************************************
 /*Function:
     SYS_FS_RESULT SYS_FS_FileSync
@@ -2585,6 +3203,235 @@ SYS_FS_RESULT SYS_FS_FileTruncate
     }
 }
 
+//******************************************************************************
+/*Function:
+    SYS_FS_RESULT SYS_FS_FileSeekIndexBuild
+    (
+        SYS_FS_HANDLE handle,
+        uint32_t *table,
+        uint32_t tableSize
+    );
+
+  Summary:
+    Builds the cluster map of an open file for the fast seek.
+
+  Description:
+    This function maps the clusters of the file into the table supplied by
+    the caller, so the seeks on the file no longer follow the cluster chain.
+
+  Remarks:
+    See sys_fs.h for usage information.
+***************************************************************************/
+SYS_FS_RESULT SYS_FS_FileSeekIndexBuild
+(
+    SYS_FS_HANDLE handle,
+    uint32_t *table,
+    uint32_t tableSize
+)
+{
+    int fileStatus = -1;
+    SYS_FS_OBJ *obj = (SYS_FS_OBJ *)handle;
+
+    if(handle == SYS_FS_HANDLE_INVALID)
+    {
+        errorValue = SYS_FS_ERROR_INVALID_OBJECT;
+        return SYS_FS_RES_FAILURE;
+    }
+
+    if(obj->inUse == false)
+    {
+        errorValue = SYS_FS_ERROR_INVALID_OBJECT;
+        return SYS_FS_RES_FAILURE;
+    }
+
+    if((table != NULL) && (tableSize < 4U))
+    {
+        obj->errorValue = SYS_FS_ERROR_INVALID_PARAMETER;
+        return SYS_FS_RES_FAILURE;
+    }
+
+    if(obj->mountPoint->fsFunctions->seekIndex == NULL)
+    {
+        obj->errorValue = SYS_FS_ERROR_NOT_SUPPORTED_IN_NATIVE_FS;
+        return SYS_FS_RES_FAILURE;
+    }
+
+    if(OSAL_MUTEX_Lock(&(obj->mountPoint->mutexDiskVolume), OSAL_WAIT_FOREVER)
+                                                        == OSAL_RESULT_SUCCESS)
+    {
+        fileStatus = obj->mountPoint->fsFunctions->seekIndex(obj->nativeFSFileObj, table, tableSize);
+
+        (void) OSAL_MUTEX_Unlock(&(obj->mountPoint->mutexDiskVolume));
+    }
+
+    if(fileStatus == 0)
+    {
+        return SYS_FS_RES_SUCCESS;
+    }
+    else
+    {
+        obj->errorValue = (SYS_FS_ERROR)fileStatus;
+        return SYS_FS_RES_FAILURE;
+    }
+}
+
+//******************************************************************************
+/*Function:
+    SYS_FS_RESULT SYS_FS_FileAllocate
+    (
+        SYS_FS_HANDLE handle,
+        uint32_t size,
+        bool contiguous
+    );
+
+  Summary:
+    Allocates the clusters of a file ahead of its writes.
+
+  Description:
+    This function allocates the clusters for size bytes to the open file and
+    sets the file size to size. The file read/write pointer is not moved.
+
+  Remarks:
+    See sys_fs.h for usage information.
+***************************************************************************/
+SYS_FS_RESULT SYS_FS_FileAllocate
+(
+    SYS_FS_HANDLE handle,
+    uint32_t size,
+    bool contiguous
+)
+{
+    int fileStatus = -1;
+    SYS_FS_OBJ *obj = (SYS_FS_OBJ *)handle;
+
+    if(handle == SYS_FS_HANDLE_INVALID)
+    {
+        errorValue = SYS_FS_ERROR_INVALID_OBJECT;
+        return SYS_FS_RES_FAILURE;
+    }
+
+    if(obj->inUse == false)
+    {
+        errorValue = SYS_FS_ERROR_INVALID_OBJECT;
+        return SYS_FS_RES_FAILURE;
+    }
+
+    if(obj->mountPoint->fsFunctions->allocate == NULL)
+    {
+        obj->errorValue = SYS_FS_ERROR_NOT_SUPPORTED_IN_NATIVE_FS;
+        return SYS_FS_RES_FAILURE;
+    }
+
+    if(OSAL_MUTEX_Lock(&(obj->mountPoint->mutexDiskVolume), OSAL_WAIT_FOREVER)
+                                                        == OSAL_RESULT_SUCCESS)
+    {
+        fileStatus = obj->mountPoint->fsFunctions->allocate(obj->nativeFSFileObj, size, contiguous);
+
+        (void) OSAL_MUTEX_Unlock(&(obj->mountPoint->mutexDiskVolume));
+    }
+
+    if(fileStatus == 0)
+    {
+        return SYS_FS_RES_SUCCESS;
+    }
+    else
+    {
+        obj->errorValue = (SYS_FS_ERROR)fileStatus;
+        return SYS_FS_RES_FAILURE;
+    }
+}
+
+//******************************************************************************
+/*Function:
+    size_t SYS_FS_FileMap
+    (
+        SYS_FS_HANDLE handle,
+        uint32_t offset,
+        size_t nbyte,
+        const void **ptr
+    );
+
+  Summary:
+    Maps a range of a file for direct reads from a memory mapped media.
+
+  Description:
+    This function returns the address of the file data at offset on the media
+    and the number of bytes contiguous from it.
+
+  Remarks:
+    See sys_fs.h for usage information.
+***************************************************************************/
+size_t SYS_FS_FileMap
+(
+    SYS_FS_HANDLE handle,
+    uint32_t offset,
+    size_t nbyte,
+    const void **ptr
+)
+{
+    int fileStatus = -1;
+    SYS_FS_OBJ *obj = (SYS_FS_OBJ *)handle;
+    uint32_t length = (uint32_t)nbyte;
+    uint32_t sector = 0;
+    uint8_t pdrv = 0;
+    uintptr_t address = 0;
+
+    if(handle == SYS_FS_HANDLE_INVALID)
+    {
+        errorValue = SYS_FS_ERROR_INVALID_OBJECT;
+        return (size_t)-1;
+    }
+
+    if(obj->inUse == false)
+    {
+        errorValue = SYS_FS_ERROR_INVALID_OBJECT;
+        return (size_t)-1;
+    }
+
+    if(ptr == NULL)
+    {
+        obj->errorValue = SYS_FS_ERROR_INVALID_PARAMETER;
+        return (size_t)-1;
+    }
+
+    *ptr = NULL;
+
+    if(obj->mountPoint->fsFunctions->extentGet == NULL)
+    {
+        obj->errorValue = SYS_FS_ERROR_NOT_SUPPORTED_IN_NATIVE_FS;
+        return (size_t)-1;
+    }
+
+    if(OSAL_MUTEX_Lock(&(obj->mountPoint->mutexDiskVolume), OSAL_WAIT_FOREVER)
+                                                        == OSAL_RESULT_SUCCESS)
+    {
+        fileStatus = obj->mountPoint->fsFunctions->extentGet(obj->nativeFSFileObj, offset, &length, &pdrv, &sector);
+
+        if((fileStatus == 0) && (length != 0U))
+        {
+            /* The media manager sectors are 512 bytes long */
+            address = SYS_FS_MEDIA_MANAGER_SectorAddressGet((uint16_t)pdrv, sector, offset % 512U, &length);
+
+            if(address == 0U)
+            {
+                fileStatus = (int)SYS_FS_ERROR_DENIED;
+            }
+        }
+
+        (void) OSAL_MUTEX_Unlock(&(obj->mountPoint->mutexDiskVolume));
+    }
+
+    if(fileStatus != 0)
+    {
+        obj->errorValue = (SYS_FS_ERROR)fileStatus;
+        return (size_t)-1;
+    }
+
+    *ptr = (const void *)address;
+
+    return (size_t)length;
+}
+
 //******************************************************************************
 /*Function:
     SYS_FS_RESULT SYS_FS_FileCharacterPut
@@ -23,6 +23,8 @@
 
 #include "system/fs/sys_fs_fat_interface.h"
 #include "system/fs/sys_fs.h"
+#include "system/fs/sys_fs_media_manager.h"
+#include "system/fs/fat_fs/hardware_access/diskio.h"
 
 typedef struct
 {
@@ -97,6 +99,14 @@ int FATFS_mount ( uint8_t vol )
         FATFSVolume[vol].inUse = true;
     }
 
+#if defined(SYS_FS_MEDIA_MANAGER_CACHE_SECTORS)
+    if (res == FR_OK)
+    {
+        /* Keep the FAT sectors of the volume in the media manager cache */
+        SYS_FS_MEDIA_MANAGER_CacheSectorsPin(vol, fs->pdrv, (uint32_t)fs->fatbase, (uint32_t)fs->fsize * fs->n_fats);
+    }
+#endif
+
     return ((int)res);
 }
 
@@ -122,6 +132,12 @@ int FATFS_unmount ( uint8_t vol )
     path[1] = ':';
     path[2] = '\0';
 
+#if defined(SYS_FS_MEDIA_MANAGER_CACHE_SECTORS)
+    /* Write the cached sectors of the volume before releasing it */
+    (void) SYS_FS_MEDIA_MANAGER_CacheFlush((uint16_t)VolToPart[vol].pd);
+    SYS_FS_MEDIA_MANAGER_CacheSectorsPin(vol, (uint16_t)VolToPart[vol].pd, 0, 0);
+#endif
+
     res = f_mount(NULL, (const TCHAR *)&path, opt);
 
     if (res == FR_OK)
@@ -288,6 +304,217 @@ int FATFS_lseek (
     return ((int)res);
 }
 
+int FATFS_linkmap (
+    uintptr_t handle,   /* Pointer to the file object */
+    uint32_t *table,    /* Cluster link map table, NULL to leave fast seek mode */
+    uint32_t tableSize  /* Number of items of the table */
+)
+{
+    FRESULT res = FR_OK;
+    FATFS_FILE_OBJECT *ptr = (FATFS_FILE_OBJECT *)handle;
+    FIL *fp = &ptr->fileObj;
+
+    fp->cltbl = (DWORD *)table;
+
+    if (table != NULL)
+    {
+        table[0] = tableSize;
+
+        res = f_lseek(fp, CREATE_LINKMAP);
+
+        if (res != FR_OK)
+        {
+            /* On FR_NOT_ENOUGH_CORE, table[0] holds the required size */
+            fp->cltbl = NULL;
+        }
+    }
+
+    return ((int)res);
+}
+
+int FATFS_expand (
+    uintptr_t handle,   /* Pointer to the file object */
+    uint32_t size,      /* File size to be allocated */
+    bool contiguous     /* Allocate a single fragment */
+)
+{
+    FRESULT res = FR_OK;
+    FRESULT seekRes = FR_OK;
+    FATFS_FILE_OBJECT *ptr = (FATFS_FILE_OBJECT *)handle;
+    FIL *fp = &ptr->fileObj;
+    FSIZE_t fptr = f_tell(fp);
+
+    if (contiguous == true)
+    {
+        /* The file must be empty */
+        res = f_expand(fp, (FSIZE_t)size, 1);
+    }
+    else if (size > f_size(fp))
+    {
+        /* Moving the pointer past the end of a writable file stretches the
+         * cluster chain up to it */
+        res = f_lseek(fp, (FSIZE_t)size);
+
+        if ((res == FR_OK) && (f_size(fp) < (FSIZE_t)size))
+        {
+            /* The volume is full */
+            res = FR_DENIED;
+        }
+
+        /* Restore the file pointer, also when the chain stopped short */
+        seekRes = f_lseek(fp, fptr);
+
+        if (res == FR_OK)
+        {
+            res = seekRes;
+        }
+    }
+    else
+    {
+        /* Nothing to do */
+    }
+
+    return ((int)res);
+}
+
+int FATFS_extent (
+    uintptr_t handle,   /* Pointer to the file object */
+    uint32_t offset,    /* File offset of the extent */
+    uint32_t *length,   /* Bytes wanted, contiguous bytes on return */
+    uint8_t *pdrv,      /* Physical drive holding the extent */
+    uint32_t *sector    /* Sector holding the first byte of the extent */
+)
+{
+    FRESULT res = FR_OK;
+    FRESULT seekRes = FR_OK;
+    FATFS_FILE_OBJECT *ptr = (FATFS_FILE_OBJECT *)handle;
+    FIL *fp = &ptr->fileObj;
+    FATFS *fs = fp->obj.fs;
+    FSIZE_t fptr = f_tell(fp);
+    FSIZE_t fsize = 0;
+    FSIZE_t clusterSize = 0;
+    FSIZE_t position = 0;
+    uint32_t extent = 0;
+    DWORD clust = 0;
+
+    /* The data still held in the file buffer has to reach the media */
+    res = f_sync(fp);
+
+    if (res != FR_OK)
+    {
+        return ((int)res);
+    }
+
+    fsize = f_size(fp);
+
+    if ((offset >= fsize) || (*length == 0U))
+    {
+        *length = 0;
+        return ((int)FR_OK);
+    }
+
+    if (*length > (fsize - offset))
+    {
+        *length = fsize - offset;
+    }
+
+    clusterSize = (FSIZE_t)fs->csize * FF_MAX_SS;
+
+    /* Seeking to the end of the sector of the offset leaves its cluster in
+     * fp->clust without loading the sector in the file buffer. The pointer is
+     * never moved past the end of the file, which would stretch it. */
+    position = offset - (offset % FF_MAX_SS);
+    position = ((fsize - position) > FF_MAX_SS) ? (position + FF_MAX_SS) : fsize;
+
+    res = f_lseek(fp, position);
+
+    if (res == FR_OK)
+    {
+        clust = fp->clust;
+        *pdrv = fs->pdrv;
+        *sector = fs->database + ((clust - 2U) * fs->csize) + ((offset / FF_MAX_SS) % fs->csize);
+
+        /* Extend the extent over the clusters that follow it on the volume */
+        extent = clusterSize - (offset % clusterSize);
+
+        while (extent < *length)
+        {
+            position = offset + extent;
+            position = ((fsize - position) > FF_MAX_SS) ? (position + FF_MAX_SS) : fsize;
+
+            res = f_lseek(fp, position);
+
+            if ((res != FR_OK) || (fp->clust != (clust + 1U)))
+            {
+                break;
+            }
+
+            clust++;
+            extent += clusterSize;
+        }
+
+        if (extent < *length)
+        {
+            *length = extent;
+        }
+    }
+
+    /* Restore the file pointer */
+    seekRes = f_lseek(fp, fptr);
+
+    if (res == FR_OK)
+    {
+        res = seekRes;
+    }
+
+    /* The extent can be written without the file buffer, which must not keep
+     * an old copy of one of its sectors. FatFs reloads the buffer when the
+     * file pointer is on a sector boundary. */
+    if ((res == FR_OK) && ((fptr % FF_MAX_SS) == 0U) && (fp->sect >= *sector) &&
+            (fp->sect <= (*sector + (((offset % FF_MAX_SS) + *length - 1U) / FF_MAX_SS))))
+    {
+        fp->sect = 0;
+    }
+
+    return ((int)res);
+}
+
+int FATFS_transfer (
+    uint8_t pdrv,       /* Physical drive of the sectors */
+    uint32_t sector,    /* First sector */
+    uint8_t *buffer,    /* Data buffer, valid until the transfer ends */
+    uint32_t count,     /* Number of sectors */
+    bool write          /* Write the sectors, read them otherwise */
+)
+{
+    FRESULT res = FR_OK;
+
+    if (disk_transfer(pdrv, buffer, sector, count, write) != RES_OK)
+    {
+        res = FR_DISK_ERR;
+    }
+
+    return ((int)res);
+}
+
+int FATFS_transferstatus (
+    uint8_t pdrv,       /* Physical drive of the transfer */
+    bool *done          /* Pointer to return the end of the transfer */
+)
+{
+    FRESULT res = FR_OK;
+    DRESULT status = disk_transfer_status(pdrv);
+
+    *done = (status != RES_NOTRDY);
+
+    if ((status != RES_OK) && (status != RES_NOTRDY))
+    {
+        res = FR_DISK_ERR;
+    }
+
+    return ((int)res);
+}
+
 int FATFS_stat (
     const char* path,   /* Pointer to the file path */
     uintptr_t fileInfo  /* Pointer to file information to return */
@@ -717,6 +944,18 @@ int FATFS_getclusters (
     return ((int)res);
 }
 
+int FATFS_freescan (
+    const char *path,       /* Path name of the logical drive number */
+    uint32_t *remaining     /* Pointer to return the FAT entries left to check */
+)
+{
+    FRESULT res;
+
+    res = f_freescan((const TCHAR *)path, (DWORD *)remaining);
+
+    return ((int)res);
+}
+
 int FATFS_getfree (
     const char* path,  /* Path name of the logical drive number */
     uint32_t* nclst,        /* Pointer to a variable to return number of free clusters */
@@ -82,6 +82,8 @@ typedef struct
     uint8_t mountNameLength;
     /* Volume number */
     uint8_t diskNumber;
+    /* The free cluster count of the volume has been validated */
+    bool freeScanDone;
    /* Mount/Volume instance mutex */
     OSAL_MUTEX_DECLARE(mutexDiskVolume);
 }
@@ -168,6 +170,71 @@ typedef struct
 }
 SYS_FS_CURRENT_MOUNT_POINT;
 
+#if defined(SYS_FS_FILE_ASYNC_QUEUE_SIZE)
+// *****************************************************************************
+/* Asynchronous file transfer request
+
+  Summary:
+    Defines a file transfer queued by SYS_FS_FileReadAsync or
+    SYS_FS_FileWriteAsync.
+
+  Description:
+    This structure holds the progress of a transfer that SYS_FS_Tasks performs
+    in chunks of SYS_FS_FILE_ASYNC_CHUNK_SIZE bytes. The whole sectors of a
+    chunk are moved by a media transfer that is checked on the next calls.
+
+  Remarks:
+    None.
+*/
+typedef struct
+{
+    /* File handle of the transfer */
+    SYS_FS_HANDLE handle;
+    /* Data buffer, read into or written from */
+    uint8_t *buffer;
+    /* Number of bytes requested */
+    size_t nbyte;
+    /* Number of bytes transferred so far */
+    size_t nDone;
+    /* Completion callback and its context */
+    SYS_FS_FILE_ASYNC_CALLBACK callback;
+    uintptr_t context;
+    /* true for a write, false for a read */
+    bool isWrite;
+    /* The file was closed, the request ends with a failure */
+    bool isCancelled;
+    /* Bytes of the sector transfer in progress, 0 if none, and its physical
+     * drive */
+    size_t nPending;
+    uint8_t pdrv;
+    /* Native file system functions of the sector transfer */
+    const SYS_FS_FUNCTIONS *fsFunctions;
+}
+SYS_FS_FILE_ASYNC_REQUEST;
+
+// *****************************************************************************
+/* Asynchronous file transfer queue
+
+  Summary:
+    Defines the queue of the asynchronous file transfers.
+
+  Description:
+    The request at the head of the queue is the one in progress.
+
+  Remarks:
+    None.
+*/
+typedef struct
+{
+    SYS_FS_FILE_ASYNC_REQUEST requests[SYS_FS_FILE_ASYNC_QUEUE_SIZE];
+    /* Index of the request in progress */
+    uint32_t head;
+    /* Number of queued requests */
+    uint32_t count;
+}
+SYS_FS_FILE_ASYNC_QUEUE;
+#endif
+
 //******************************************************************************
 
 #endif // SYS_FS_PRIVATE_H
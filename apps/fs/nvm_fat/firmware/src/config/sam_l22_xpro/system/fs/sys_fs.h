@@ -582,6 +582,24 @@ typedef struct
     /* Function pointer of native file system to get total sectors and free
      * sectors */
     int(*getCluster)(const char *path, uint32_t *tot_sec, uint32_t *free_sec);
+    /* Function pointer of native file system to build the cluster map of an
+     * open file for the fast seek */
+    int(*seekIndex)(uintptr_t handle, uint32_t *table, uint32_t tableSize);
+    /* Function pointer of native file system to allocate the clusters of an
+     * open file */
+    int(*allocate)(uintptr_t handle, uint32_t size, bool contiguous);
+    /* Function pointer of native file system to locate the contiguous media
+     * sectors holding a range of an open file */
+    int(*extentGet)(uintptr_t handle, uint32_t offset, uint32_t *length, uint8_t *pdrv, uint32_t *sector);
+    /* Function pointer of native file system to start a transfer of media
+     * sectors without waiting for its end */
+    int(*sectorTransfer)(uint8_t pdrv, uint32_t sector, uint8_t *buffer, uint32_t count, bool isWrite);
+    /* Function pointer of native file system to check the end of the sector
+     * transfer */
+    int(*sectorTransferStatus)(uint8_t pdrv, bool *isDone);
+    /* Function pointer of native file system to validate the free cluster
+     * count one step at a time */
+    int(*freeScan)(const char *path, uint32_t *remaining);
 } SYS_FS_FUNCTIONS;
 
 // *****************************************************************************
@@ -645,6 +663,41 @@ typedef void (* SYS_FS_EVENT_HANDLER)
     uintptr_t context
 );
 
+// *****************************************************************************
+/* File System Asynchronous Transfer Callback function pointer
+
+  Summary:
+    Pointer to the completion callback of an asynchronous file transfer.
+
+  Description
+    This data type defines the function signature of the callback passed to
+    SYS_FS_FileReadAsync and SYS_FS_FileWriteAsync. The callback is called
+    from SYS_FS_Tasks when the transfer ends.
+
+  Parameters:
+    handle          - File handle of the transfer
+    result          - SYS_FS_RES_SUCCESS if the transfer ended without error,
+                      SYS_FS_RES_FAILURE otherwise. The reason for the failure
+                      can be retrieved with SYS_FS_FileError.
+    nbyte           - Number of bytes transferred. It is less than requested
+                      when the end of the file or of the volume was reached.
+    context         - Value passed with the transfer request
+
+  Returns:
+    None.
+
+  Remarks:
+    None.
+*/
+
+typedef void (* SYS_FS_FILE_ASYNC_CALLBACK)
+(
+    SYS_FS_HANDLE handle,
+    SYS_FS_RESULT result,
+    size_t nbyte,
+    uintptr_t context
+);
+
 // *****************************************************************************
 /* SYS FS File status structure
 
@@ -2696,6 +2749,144 @@ size_t SYS_FS_FileWrite
     size_t nbyte
 );
 
+//******************************************************************************
+/* Function:
+    SYS_FS_RESULT SYS_FS_FileReadAsync
+    (
+        SYS_FS_HANDLE handle,
+        void *buffer,
+        size_t nbyte,
+        SYS_FS_FILE_ASYNC_CALLBACK callback,
+        uintptr_t context
+    );
+
+    Summary:
+      Queues a read of data from the file.
+
+    Description:
+      This function queues a read of nbyte bytes from the file associated with
+      the file handle into the buffer and returns immediately. SYS_FS_Tasks
+      performs the read SYS_FS_FILE_ASYNC_CHUNK_SIZE bytes per call, so the
+      other modules of the super-loop keep running during large transfers.
+      The whole sectors of a chunk are read by a media transfer that the call
+      starts and a later call checks, without waiting for the media. The
+      callback is called from SYS_FS_Tasks when the read ends. Requests are
+      processed in the order they are queued.
+
+    Precondition:
+      A valid file handle must be obtained before reading a file.
+
+    Parameters:
+      handle      - File handle obtained during file open.
+      buffer      - Pointer to buffer into which data is read. It must stay
+                    valid until the callback is called.
+      nbyte       - Number of bytes to be read
+      callback    - Function called when the read ends, can be NULL
+      context     - Value passed to the callback
+
+    Returns:
+      SYS_FS_RES_SUCCESS - The read was queued.
+      SYS_FS_RES_FAILURE - The handle is invalid or the queue is full. The
+                           reason for the failure can be retrieved with
+                           SYS_FS_Error.
+
+    Example:
+      <code>
+        void APP_ReadCallback(SYS_FS_HANDLE handle, SYS_FS_RESULT result, size_t nbyte, uintptr_t context)
+        {
+            if (result == SYS_FS_RES_SUCCESS)
+            {
+                
+            }
+        }
+
+        if (SYS_FS_FileReadAsync(fileHandle, buffer, 4096, APP_ReadCallback, 0) == SYS_FS_RES_FAILURE)
+        {
+            
+        }
+      </code>
+
+    Remarks:
+      The file must not be accessed by other SYS_FS functions until the
+      callback is called. Closing the file ends its queued transfers with
+      SYS_FS_RES_FAILURE. The other files of the volume can be accessed: the
+      media commands of those accesses wait for the media transfer in
+      progress.
+*/
+
+SYS_FS_RESULT SYS_FS_FileReadAsync
+(
+    SYS_FS_HANDLE handle,
+    void *buffer,
+    size_t nbyte,
+    SYS_FS_FILE_ASYNC_CALLBACK callback,
+    uintptr_t context
+);
+
+//******************************************************************************
+/* Function:
+    SYS_FS_RESULT SYS_FS_FileWriteAsync
+    (
+        SYS_FS_HANDLE handle,
+        const void *buffer,
+        size_t nbyte,
+        SYS_FS_FILE_ASYNC_CALLBACK callback,
+        uintptr_t context
+    );
+
+    Summary:
+      Queues a write of data to the file.
+
+    Description:
+      This function queues a write of nbyte bytes from the buffer to the file
+      associated with the file handle and returns immediately. SYS_FS_Tasks
+      performs the write SYS_FS_FILE_ASYNC_CHUNK_SIZE bytes per call and calls
+      the callback when the write ends. The whole sectors of a chunk are
+      allocated to the file and written by a media transfer that the call
+      starts and a later call checks. Requests are processed in the order
+      they are queued.
+
+    Precondition:
+      A valid file handle must be obtained before writing a file.
+
+    Parameters:
+      handle      - File handle obtained during file open.
+      buffer      - Pointer to buffer from which data is to be written. It must
+                    stay valid until the callback is called.
+      nbyte       - Number of bytes to be written
+      callback    - Function called when the write ends, can be NULL
+      context     - Value passed to the callback
+
+    Returns:
+      SYS_FS_RES_SUCCESS - The write was queued.
+      SYS_FS_RES_FAILURE - The handle is invalid or the queue is full. The
+                           reason for the failure can be retrieved with
+                           SYS_FS_Error.
+
+    Example:
+      <code>
+        if (SYS_FS_FileWriteAsync(fileHandle, buffer, 4096, APP_WriteCallback, 0) == SYS_FS_RES_FAILURE)
+        {
+            
+        }
+      </code>
+
+    Remarks:
+      The file must not be accessed by other SYS_FS functions until the
+      callback is called. The data is written to the media as by
+      SYS_FS_FileWrite; use SYS_FS_FileSync once the callback is called to
+      commit the file.
+*/
+
+SYS_FS_RESULT SYS_FS_FileWriteAsync
+(
+    SYS_FS_HANDLE handle,
+    const void *buffer,
+    size_t nbyte,
+    SYS_FS_FILE_ASYNC_CALLBACK callback,
+    uintptr_t context
+);
+
 //******************************************************************************
 /* Function:
     SYS_FS_RESULT SYS_FS_FileTruncate
@@ -2763,6 +2954,238 @@ SYS_FS_RESULT SYS_FS_FileTruncate
     SYS_FS_HANDLE handle
 );
 
+//******************************************************************************
+/* Function:
+    SYS_FS_RESULT SYS_FS_FileSeekIndexBuild
+    (
+        SYS_FS_HANDLE handle,
+        uint32_t *table,
+        uint32_t tableSize
+    );
+
+    Summary:
+      Builds the cluster map of an open file for the fast seek.
+
+    Description:
+      This function maps the cluster chain of the file into the table supplied
+      by the caller and attaches the table to the file. From then on,
+      SYS_FS_FileSeek, SYS_FS_FileRead and SYS_FS_FileWrite find the cluster
+      of any file position from the table instead of following the chain on
+      the media, so a seek costs no media read for the FAT.
+
+      The table holds one pair of items for each contiguous fragment of the
+      file, plus 2 items: a file of N fragments needs (2 * N) + 2 items. If the
+      table is too small, the function fails with SYS_FS_ERROR_NOT_ENOUGH_CORE
+      and table[0] holds the required number of items. Passing a NULL table
+      leaves the fast seek mode.
+
+    Precondition:
+      A valid file handle has to be passed as input to the function.
+
+    Parameters:
+      handle    - A valid handle which was obtained while opening the file.
+      table     - Table of tableSize items, owned by the caller. It must stay
+                  valid while the file is open or until the function is called
+                  again with a NULL table.
+      tableSize - Number of items of the table, at least 4.
+
+    Returns:
+      SYS_FS_RES_SUCCESS - The cluster map is attached to the file.
+      SYS_FS_RES_FAILURE - The cluster map was not built. The reason for the
+                           failure can be retrieved with SYS_FS_Error or
+                           SYS_FS_FileError.
+
+    Example:
+      <code>
+        uint32_t seekTable[32];
+
+        fileHandle = SYS_FS_FileOpen("/mnt/myDrive/LOG.bin", (SYS_FS_FILE_OPEN_READ));
+
+        if(fileHandle != SYS_FS_HANDLE_INVALID)
+        {
+            if(SYS_FS_FileSeekIndexBuild(fileHandle, seekTable, 32) == SYS_FS_RES_FAILURE)
+            {
+                
+            }
+        }
+      </code>
+
+    Remarks:
+      The file cannot grow while the table is attached: a write past the
+      clusters of the file stops short, as on a full volume. Build the table
+      once the file has reached its size, or after SYS_FS_FileAllocate.
+*/
+
+SYS_FS_RESULT SYS_FS_FileSeekIndexBuild
+(
+    SYS_FS_HANDLE handle,
+    uint32_t *table,
+    uint32_t tableSize
+);
+
+//******************************************************************************
+/* Function:
+    SYS_FS_RESULT SYS_FS_FileAllocate
+    (
+        SYS_FS_HANDLE handle,
+        uint32_t size,
+        bool contiguous
+    );
+
+    Summary:
+      Allocates the clusters of a file ahead of its writes.
+
+    Description:
+      This function allocates the clusters needed for size bytes to the file
+      and sets the file size to size, so the later writes up to size do not
+      allocate clusters one at a time between the data writes.
+
+      With contiguous set to true, the clusters are taken as one contiguous
+      block: the file must be empty, and the function fails with
+      SYS_FS_ERROR_DENIED if the volume has no free block large enough. The
+      data then lies on consecutive sectors and FatFs writes it with
+      multi-sector transfers. With contiguous set to false, the cluster chain
+      of the file is stretched up to size with any free clusters; a file
+      already size bytes long or larger is left unchanged.
+
+      The file read/write pointer is not moved. The content of the allocated
+      area is undefined until written.
+
+    Precondition:
+      A valid file handle has to be passed as input to the function. The file
+      has to be opened in a mode where writes to file is possible.
+
+    Parameters:
+      handle     - A valid handle which was obtained while opening the file.
+      size       - File size to allocate, in bytes.
+      contiguous - true to allocate a single contiguous block.
+
+    Returns:
+      SYS_FS_RES_SUCCESS - The clusters were allocated.
+      SYS_FS_RES_FAILURE - The clusters were not allocated. The reason for the
+                           failure can be retrieved with SYS_FS_Error or
+                           SYS_FS_FileError.
+
+    Example:
+      <code>
+        uint32_t seekTable[4];
+
+        fileHandle = SYS_FS_FileOpen("/mnt/myDrive/LOG.bin", (SYS_FS_FILE_OPEN_WRITE));
+
+        if(fileHandle != SYS_FS_HANDLE_INVALID)
+        {
+            if(SYS_FS_FileAllocate(fileHandle, 65536, true) == SYS_FS_RES_SUCCESS)
+            {
+                // One fragment: the writes no longer read the FAT
+                SYS_FS_FileSeekIndexBuild(fileHandle, seekTable, 4);
+            }
+        }
+
+        
+
+        // Drop the unused end of the allocation before closing
+        SYS_FS_FileSeekIndexBuild(fileHandle, NULL, 0);
+        SYS_FS_FileTruncate(fileHandle);
+        SYS_FS_FileClose(fileHandle);
+      </code>
+
+    Remarks:
+      A logging file preallocated this way keeps its allocated size until it
+      is truncated at the position of the last write.
+*/
+
+SYS_FS_RESULT SYS_FS_FileAllocate
+(
+    SYS_FS_HANDLE handle,
+    uint32_t size,
+    bool contiguous
+);
+
+//******************************************************************************
+/* Function:
+    size_t SYS_FS_FileMap
+    (
+        SYS_FS_HANDLE handle,
+        uint32_t offset,
+        size_t nbyte,
+        const void **ptr
+    );
+
+    Summary:
+      Maps a range of a file for direct reads from a memory mapped media.
+
+    Description:
+      This function returns in ptr the address at which the CPU can read the
+      file data starting at offset, without copying it through a buffer. The
+      data of a file is contiguous in memory only within a run of consecutive
+      clusters, so the function returns the number of bytes readable from ptr,
+      which can be less than nbyte. The remaining data is mapped by calling the
+      function again with offset moved past the bytes returned.
+
+      Data written to the file and still held in the file or media manager
+      buffers is written to the media first.
+
+    Precondition:
+      A valid file handle has to be passed as input to the function. The file
+      must be on a memory mapped media (NVM).
+
+    Parameters:
+      handle - A valid handle which was obtained while opening the file.
+      offset - File offset of the first byte to map.
+      nbyte  - Number of bytes wanted.
+      ptr    - Pointer to the returned address of the data.
+
+    Returns:
+      On success, the number of bytes readable from ptr is returned. 0 is
+      returned when offset is at or past the end of the file.
+      On failure, -1 is returned and ptr is set to NULL. The reason for the
+      failure can be retrieved with SYS_FS_Error or SYS_FS_FileError. The
+      error is SYS_FS_ERROR_DENIED when the media cannot be read directly or
+      the range is not stored at a fixed address.
+
+    Example:
+      <code>
+        const void *data;
+        uint32_t offset = 0;
+        size_t nBytes;
+
+        fileHandle = SYS_FS_FileOpen("/mnt/myDrive/IMAGE.bin", (SYS_FS_FILE_OPEN_READ));
+
+        if(fileHandle != SYS_FS_HANDLE_INVALID)
+        {
+            do
+            {
+                nBytes = SYS_FS_FileMap(fileHandle, offset, 4096, &data);
+
+                if ((nBytes == 0) || (nBytes == (size_t)-1))
+                {
+                    break;
+                }
+
+                // Use the nBytes bytes at data in place
+                APP_Process(data, nBytes);
+
+                offset += nBytes;
+
+            } while (true);
+        }
+      </code>
+
+    Remarks:
+      The address stays valid until the mapped part of the file is written,
+      truncated or removed. Locating the cluster of offset follows the cluster
+      chain of the file, so large files should be mapped after
+      SYS_FS_FileSeekIndexBuild. The file read/write pointer is not moved.
+*/
+
+size_t SYS_FS_FileMap
+(
+    SYS_FS_HANDLE handle,
+    uint32_t offset,
+    size_t nbyte,
+    const void **ptr
+);
+
 //******************************************************************************
 /* Function:
     SYS_FS_RESULT SYS_FS_FileSync
@@ -3722,7 +4145,11 @@ SYS_FS_RESULT SYS_FS_DrivePartition
       </code>
 
     Remarks:
-      None.
+      On FAT32 the free cluster count is read from the FSInfo sector. FAT12
+      and FAT16 volumes have no such sector: their count is kept in RAM
+      across remounts only, and is lost at reset or power off. The first
+      call after a reset then reads the whole FAT, unless the background
+      scan run by SYS_FS_Tasks has already gone through it.
 */
 
 SYS_FS_RESULT SYS_FS_DriveSectorGet
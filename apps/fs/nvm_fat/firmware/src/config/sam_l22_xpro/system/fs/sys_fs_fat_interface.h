@@ -106,6 +106,18 @@ int FATFS_fdisk (uint8_t pdrv, const uint32_t ptbl[], void* work);
 
 int FATFS_getclusters (const char *path, uint32_t *tot_sec, uint32_t *free_sec);
 
+int FATFS_freescan (const char *path, uint32_t *remaining);
+
+int FATFS_linkmap (uintptr_t handle, uint32_t *table, uint32_t tableSize);
+
+int FATFS_expand (uintptr_t handle, uint32_t size, bool contiguous);
+
+int FATFS_extent (uintptr_t handle, uint32_t offset, uint32_t *length, uint8_t *pdrv, uint32_t *sector);
+
+int FATFS_transfer (uint8_t pdrv, uint32_t sector, uint8_t *buffer, uint32_t count, bool write);
+
+int FATFS_transferstatus (uint8_t pdrv, bool *done);
+
 
 #ifdef __cplusplus
 }
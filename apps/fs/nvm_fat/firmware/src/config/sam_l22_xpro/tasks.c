@@ -81,6 +81,8 @@ SYS_FS_Tasks();
     /* Maintain Device Drivers */
     DRV_MEMORY_Tasks(sysObj.drvMemory0);
 
+    DRV_MEMORY_Tasks(sysObj.drvMemory1);
+
 
 
     /* Maintain Middleware & Other Libraries */
@@ -99,6 +99,8 @@ extern "C" {
 #define SYS_FS_MAX_FILE_SYSTEM_TYPE       (1U)
 #define SYS_FS_MEDIA_MAX_BLOCK_SIZE       (512U)
 #define SYS_FS_MEDIA_MANAGER_BUFFER_SIZE  (2048U)
+#define SYS_FS_MEDIA_MANAGER_CACHE_SECTORS (4U)
+#define SYS_FS_MEDIA_MANAGER_READ_AHEAD_SECTORS (4U)
 #define SYS_FS_USE_LFN                    (1)
 #define SYS_FS_FILE_NAME_LEN              (255U)
 #define SYS_FS_CWD_STRING_LEN             (1024)
@@ -134,6 +136,7 @@ extern "C" {
 #define DRV_SDSPI_DMA_MODE
 #define DRV_SDSPI_XMIT_DMA_CH_IDX0              SYS_DMA_CHANNEL_0
 #define DRV_SDSPI_RCV_DMA_CH_IDX0               SYS_DMA_CHANNEL_1
+#define DRV_SDSPI_DATA_CRC_ENABLE
 
 
 /* SDSPI Driver Instance 0 RTOS Configurations*/
@@ -660,12 +660,35 @@ static bool lDRV_SDSPI_ReadBlock(
          /* Token received, now read one block of data */
         if (DRV_SDSPI_SPIBlockRead(dObj, targetBuffer) == true)
         {
+#if defined (DRV_SDSPI_DATA_CRC_ENABLE)
+            /* Data received, now read the CRC bytes and check them against the
+             * CRC computed by the DMA while the block was received */
+            /* MISRA C-2012 Rule 11.8 deviation taken. Deviation record ID -  H3_MISRAC_2012_R_11_8_DR_1 */
+            if (DRV_SDSPI_SPIRead(dObj, (uint8_t*)dObj->cmdRespBuffer, 2) == true)
+            {
+                if ((dObj->txDMAChannel == SYS_DMA_CHANNEL_NONE) || (dObj->rxDMAChannel == SYS_DMA_CHANNEL_NONE) ||
+                    (dObj->isDataBlockCRCValid == false))
+                {
+                    /* No CRC was computed for the block */
+                    isSuccess = true;
+                }
+                else if (dObj->dataBlockCRC == (((uint16_t)dObj->cmdRespBuffer[0] << 8) | (uint16_t)dObj->cmdRespBuffer[1]))
+                {
+                    isSuccess = true;
+                }
+                else
+                {
+                    /* CRC mismatch, fail the read so that it is not passed up as valid data */
+                }
+            }
+#else
             /* Data received, now read and discard the dummy CRC bytes */
             /* MISRA C-2012 Rule 11.8 deviation taken. Deviation record ID -  H3_MISRAC_2012_R_11_8_DR_1 */
             if (DRV_SDSPI_SPIRead(dObj, (uint8_t*)dObj->cmdRespBuffer, 2) == true)
             {
                 isSuccess = true;
             }
+#endif
         }
     }
 
@@ -702,9 +725,21 @@ static bool lDRV_SDSPI_WriteBlock(
         return isSuccess;
     }
 
-    /* Write two dummy bytes of CRC */
-    dObj->cmdRespBuffer[0] = 0xFF;
-    dObj->cmdRespBuffer[1] = 0xFF;
+#if defined (DRV_SDSPI_DATA_CRC_ENABLE)
+    if ((dObj->txDMAChannel != SYS_DMA_CHANNEL_NONE) && (dObj->rxDMAChannel != SYS_DMA_CHANNEL_NONE) &&
+        (dObj->isDataBlockCRCValid == true))
+    {
+        /* Write the CRC computed by the DMA while the block was transmitted */
+        dObj->cmdRespBuffer[0] = (uint8_t)(dObj->dataBlockCRC >> 8);
+        dObj->cmdRespBuffer[1] = (uint8_t)(dObj->dataBlockCRC);
+    }
+    else
+#endif
+    {
+        /* Write two dummy bytes of CRC */
+        dObj->cmdRespBuffer[0] = 0xFF;
+        dObj->cmdRespBuffer[1] = 0xFF;
+    }
 
     /* MISRA C-2012 Rule 11.8 deviation taken. Deviation record ID -  H3_MISRAC_2012_R_11_8_DR_1 */
     if (DRV_SDSPI_SPIWrite(dObj, (uint8_t*)dObj->cmdRespBuffer, 2) == false)
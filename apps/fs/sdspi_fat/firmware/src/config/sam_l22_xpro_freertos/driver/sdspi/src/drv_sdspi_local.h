@@ -753,6 +753,14 @@ typedef struct
     /* Dummy data is read into this variable by RX DMA */
     uint32_t                            rxDummyData;
 
+    /* CRC16 of the last data block, computed by the DMA CRC engine as the
+     * block streamed through the transmit or receive DMA channel */
+    volatile uint16_t                   dataBlockCRC;
+
+    /* dataBlockCRC holds the CRC of the last data block. Not set if the CRC
+     * engine was owned by another user when the block was started. */
+    volatile bool                       isDataBlockCRCValid;
+
     bool                                isFsEnabled;
 
     volatile DRV_SDSPI_SPI_TRANSFER_STATUS   spiTransferStatus;
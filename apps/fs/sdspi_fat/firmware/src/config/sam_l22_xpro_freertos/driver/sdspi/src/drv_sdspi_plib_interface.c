@@ -146,6 +146,15 @@ void DRV_SDSPI_RX_DMA_CallbackHandler(
     /* Only block transfers wait on semaphore. Post the semaphore and unblock the thread*/
     if (dObj->sdcardSPITransferType == DRV_SDSPI_SPI_TRANSFER_TYPE_BLOCK)
     {
+#if defined (DRV_SDSPI_DATA_CRC_ENABLE)
+        /* The transmit channel always finishes before the receive channel,
+         * so the CRC engine holds the CRC of the whole block here */
+        if (dObj->isDataBlockCRCValid == true)
+        {
+            dObj->dataBlockCRC = (uint16_t)(SYS_DMA_CRCRead() & 0xFFFFU);
+            SYS_DMA_CRCEngineRelease();
+        }
+#endif
         (void) OSAL_SEM_PostISR( &dObj->transferDone);
     }
 }
@@ -172,6 +181,46 @@ void DRV_SDSPI_TX_DMA_CallbackHandler(
 }
 
 
+// *****************************************************************************
+/* SDSPI DMA Data CRC Setup
+
+  Summary:
+    Attaches the DMA CRC engine to the DMA channel carrying the data block.
+
+  Description:
+    The SD card protects each data block with a CRC16 (CRC-CCITT, seed 0). The
+    CRC is computed by the DMA controller as the block streams through the
+    channel, so that it does not cost a second pass over the 512 bytes.
+
+  Remarks:
+    Only block transfers are covered; command and token transfers leave the
+    CRC engine untouched. The engine is shared with the other DMA users; if
+    another one owns it, the block is transferred without a CRC.
+*/
+
+#if defined (DRV_SDSPI_DATA_CRC_ENABLE)
+static void lDRV_SDSPI_DMA_DataCRCSetup(
+    DRV_SDSPI_OBJ* dObj,
+    SYS_DMA_CHANNEL channel
+)
+{
+    SYS_DMA_CRC_SETUP crcSetup;
+
+    if (dObj->sdcardSPITransferType == DRV_SDSPI_SPI_TRANSFER_TYPE_BLOCK)
+    {
+        dObj->isDataBlockCRCValid = SYS_DMA_CRCEngineAcquire();
+
+        if (dObj->isDataBlockCRCValid == true)
+        {
+            crcSetup.polynomialType = SYS_DMA_CRC_TYPE_16;
+            crcSetup.seed = 0U;
+
+            SYS_DMA_ChannelCRCSetup(channel, crcSetup);
+        }
+    }
+}
+#endif
+
 // *****************************************************************************
 /* SDSPI DMA Write
 
@@ -213,6 +262,10 @@ static bool lDRV_SDSPI_DMA_Write(
         SYS_DMA_DESTINATION_ADDRESSING_MODE_FIXED
     );
 
+#if defined (DRV_SDSPI_DATA_CRC_ENABLE)
+    lDRV_SDSPI_DMA_DataCRCSetup(dObj, dObj->txDMAChannel);
+#endif
+
     (void) SYS_DMA_ChannelTransfer(
         dObj->txDMAChannel,
         (const void *)pWriteBuffer,         /* Source Address */
@@ -251,6 +304,10 @@ static bool lDRV_SDSPI_DMA_Read(
         SYS_DMA_DESTINATION_ADDRESSING_MODE_INCREMENTED
     );
 
+#if defined (DRV_SDSPI_DATA_CRC_ENABLE)
+    lDRV_SDSPI_DMA_DataCRCSetup(dObj, dObj->rxDMAChannel);
+#endif
+
     (void) SYS_DMA_ChannelTransfer(
         dObj->rxDMAChannel,
         (const void *)dObj->rxAddress,      /* Source Address */
@@ -214,7 +214,9 @@ static const SYS_FS_FUNCTIONS FatFsFunctions =
     .testerror         = FATFS_error,
     .formatDisk        = (FORMAT_DISK)FATFS_mkfs,
     .partitionDisk     = FATFS_fdisk,
-    .getCluster        = FATFS_getclusters
+    .getCluster        = FATFS_getclusters,
+    .seekIndex         = FATFS_linkmap,
+    .freeScan          = FATFS_freescan
 };
 
 
@@ -49,6 +49,10 @@
 // *****************************************************************************
 // *****************************************************************************
 #include "system/dma/sys_dma.h"
+#include "system/int/sys_int.h"
+
+/* Set while a user owns the DMA CRC engine */
+static bool gSysDmaCRCEngineBusy = false;
 
 //******************************************************************************
 /* Function:
@@ -93,3 +97,69 @@ void SYS_DMA_DataWidthSetup(SYS_DMA_CHANNEL channel, SYS_DMA_WIDTH dataWidth)
 
     (void) DMAC_ChannelSettingsSet((DMAC_CHANNEL)channel, (DMAC_CHANNEL_CONFIG)config);
 }
+
+//******************************************************************************
+/* Function:
+    void SYS_DMA_ChannelCRCSetup(SYS_DMA_CHANNEL channel, SYS_DMA_CRC_SETUP crcSetup);
+
+  Summary:
+    Attaches the DMA CRC engine to the selected DMA channel.
+
+  Remarks:
+    Check sys_dma.h for more info.
+*/
+void SYS_DMA_ChannelCRCSetup(SYS_DMA_CHANNEL channel, SYS_DMA_CRC_SETUP crcSetup)
+{
+    DMAC_CRC_SETUP dmacCRCSetup;
+
+    dmacCRCSetup.polynomial_type = (DMAC_CRC_POLYNOMIAL_TYPE)crcSetup.polynomialType;
+    dmacCRCSetup.seed = crcSetup.seed;
+
+    DMAC_ChannelCRCSetup((DMAC_CHANNEL)channel, dmacCRCSetup);
+}
+
+//******************************************************************************
+/* Function:
+    bool SYS_DMA_CRCEngineAcquire(void);
+
+  Summary:
+    Takes ownership of the DMA CRC engine.
+
+  Remarks:
+    Check sys_dma.h for more info.
+*/
+bool SYS_DMA_CRCEngineAcquire(void)
+{
+    bool interruptState;
+    bool isAcquired = false;
+
+    /* The engine is taken from task and interrupt contexts */
+    interruptState = SYS_INT_Disable();
+
+    if (gSysDmaCRCEngineBusy == false)
+    {
+        gSysDmaCRCEngineBusy = true;
+        isAcquired = true;
+    }
+
+    SYS_INT_Restore(interruptState);
+
+    return isAcquired;
+}
+
+//******************************************************************************
+/* Function:
+    void SYS_DMA_CRCEngineRelease(void);
+
+  Summary:
+    Disables the DMA CRC engine and gives up its ownership.
+
+  Remarks:
+    Check sys_dma.h for more info.
+*/
+void SYS_DMA_CRCEngineRelease(void)
+{
+    SYS_DMA_CRCDisable();
+
+    gSysDmaCRCEngineBusy = false;
+}
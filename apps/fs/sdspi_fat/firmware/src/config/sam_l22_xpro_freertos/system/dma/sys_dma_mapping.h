@@ -275,4 +275,67 @@
 */
 #define SYS_DMA_ChannelDisable(channel)  DMAC_ChannelDisable((DMAC_CHANNEL)channel)
 
+
+//******************************************************************************
+/* Function:
+    uint32_t SYS_DMA_CRCRead (void)
+
+  Summary:
+    Returns the CRC computed by the DMA CRC engine.
+
+  Description:
+    This function returns the CRC checksum computed by the DMA CRC engine for
+    the channel configured with SYS_DMA_ChannelCRCSetup.
+
+  Precondition:
+    SYS_DMA_ChannelCRCSetup should have been called and the DMA transfer
+    should have completed.
+
+  Parameters:
+    None.
+
+  Returns:
+    CRC checksum. Only the lower 16 bits are valid for SYS_DMA_CRC_TYPE_16.
+
+  Example:
+    <code>
+    uint32_t crc = SYS_DMA_CRCRead();
+    </code>
+
+  Remarks:
+    None.
+*/
+#define SYS_DMA_CRCRead()  DMAC_CRCRead()
+
+
+//******************************************************************************
+/* Function:
+    void SYS_DMA_CRCDisable (void)
+
+  Summary:
+    Disables the DMA CRC engine.
+
+  Description:
+    This function disables the DMA CRC engine and detaches it from the DMA
+    channel, making it available for the next user.
+
+  Precondition:
+    DMA Controller should have been initialized.
+
+  Parameters:
+    None.
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+    SYS_DMA_CRCDisable();
+    </code>
+
+  Remarks:
+    None.
+*/
+#define SYS_DMA_CRCDisable()  DMAC_CRCDisable()
+
 #endif // SYS_DMA_MAPPING_H
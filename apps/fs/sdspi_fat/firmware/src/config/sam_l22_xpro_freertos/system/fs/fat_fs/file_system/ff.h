@@ -130,6 +130,18 @@ extern const char* VolumeStr[FF_VOLUMES];	/* User defied volume ID */
 
 
 
+/* Directory entry lookup cache item (FFDCACHE) */
+
+#if FF_USE_LFN && FF_DIR_CACHE_SIZE
+typedef struct {
+	DWORD	hash;			/* Hash of the directory start cluster and the up-cased name */
+	DWORD	sclust;			/* Directory start cluster (0:root) */
+	DWORD	ofs;			/* Offset of the top entry of the object (0xFFFFFFFF:unused item) */
+} FFDCACHE;
+#endif
+
+
+
 /* Filesystem object structure (FATFS) */
 
 typedef struct {
@@ -154,6 +166,12 @@ typedef struct {
 #if !FF_FS_READONLY
 	DWORD	last_clst;		/* Last allocated cluster */
 	DWORD	free_clst;		/* Number of free clusters */
+#if FF_USE_FREESCAN
+	DWORD	scan_clst;		/* Next cluster to be checked by the free cluster scan (0:no scan) */
+	DWORD	scan_free;		/* Number of free clusters below scan_clst */
+	DWORD	keep_vsn;		/* Serial number of the volume whose count is kept */
+	DWORD	keep_free;		/* Free cluster count at the last sync + 1 (0:not kept) */
+#endif
 #endif
 #if FF_FS_RPATH
 	DWORD	cdir;			/* Current directory start cluster (0:root) */
@@ -171,6 +189,9 @@ typedef struct {
 	LBA_t	database;		/* Data base sector */
 #if FF_FS_EXFAT
 	LBA_t	bitbase;		/* Allocation bitmap base sector */
+#endif
+#if FF_USE_LFN && FF_DIR_CACHE_SIZE
+	FFDCACHE	dcache[FF_DIR_CACHE_SIZE];	/* Directory entry lookup cache */
 #endif
 	LBA_t	winsect;		/* Current sector appearing in the win[] */
 	BYTE	CACHE_ALIGN win[FF_MAX_SS];	/* Disk access window for Directory, FAT (and file data at tiny cfg) */
@@ -326,6 +347,7 @@ FRESULT f_chdir (const TCHAR* path);								/* Change current directory */
 FRESULT f_chdrive (const TCHAR* path);								/* Change current drive */
 FRESULT f_getcwd (TCHAR* buff, UINT len);							/* Get current directory */
 FRESULT f_getfree (const TCHAR* path, DWORD* nclst, FATFS** fatfs);	/* Get number of free clusters on the drive */
+FRESULT f_freescan (const TCHAR* path, DWORD* nleft);				/* Validate number of free clusters on the drive step by step */
 FRESULT f_getlabel (const TCHAR* path, TCHAR* label, DWORD* vsn);	/* Get volume label */
 FRESULT f_setlabel (const TCHAR* label);							/* Set volume label */
 FRESULT f_forward (FIL* fp, UINT(*func)(const BYTE*,UINT), UINT btf, UINT* bf);	/* Forward data to the stream */
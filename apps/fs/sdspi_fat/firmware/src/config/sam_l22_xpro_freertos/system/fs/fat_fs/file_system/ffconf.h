@@ -33,7 +33,7 @@
 /* This option switches f_mkfs() function. (0:Disable or 1:Enable) */
 
 
-#define FF_USE_FASTSEEK	0
+#define FF_USE_FASTSEEK	1
 /* This option switches fast seek function. (0:Disable or 1:Enable) */
 
 
@@ -41,6 +41,20 @@
 /* This option switches f_expand function. (0:Disable or 1:Enable) */
 
 
+#define FF_USE_FREESCAN	1
+/* This option switches f_freescan() function and the free cluster count kept
+/  across mounts of a FAT12/16 volume. (0:Disable or 1:Enable)
+/  f_freescan() validates the free cluster count one FAT sector per call, so that
+/  the count read from the FSInfo (FAT32) or kept at the last sync (FAT12/16) is
+/  checked in idle time instead of by a full FAT scan in f_getfree(). The scan is
+/  not available on exFAT volumes. Also FF_FS_READONLY needs to be 0 to enable
+/  this option.
+/  FAT12/16 volumes have no FSInfo sector: their count is kept in the FATFS object
+/  in RAM only and is lost at reset or power off. The first f_getfree() after a
+/  reset scans the whole FAT, unless f_freescan() has been called until it has
+/  gone through the FAT. */
+
+
 #define FF_USE_CHMOD	1
 /* This option switches attribute manipulation functions, f_chmod() and f_utime().
 /  (0:Disable or 1:Enable) Also FF_FS_READONLY needs to be 0 to enable this option. */
@@ -152,6 +166,14 @@
 /  on character encoding. When LFN is not enabled, these options have no effect. */
 
 
+#define FF_DIR_CACHE_SIZE	8
+/* This option sets the number of items of the directory entry lookup cache held
+/  in each filesystem object. (0:Disable or 1-255)
+/  An item remembers where an object was found by name in a directory, so that
+/  following the same path again does not rescan the directories from the top.
+/  Each item occupies 12 bytes. When LFN is not enabled, this option has no effect. */
+
+
 #define FF_FS_RPATH		2
 /* This option configures support for relative path.
 /
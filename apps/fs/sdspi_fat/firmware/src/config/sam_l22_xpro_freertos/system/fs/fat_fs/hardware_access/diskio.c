@@ -221,6 +221,20 @@ DRESULT disk_ioctl (
 
         *(uint32_t *)buff = numSectors;
     }
+#if defined(SYS_FS_MEDIA_MANAGER_CACHE_SECTORS)
+    else if (cmd == CTRL_SYNC)
+    {
+        /* Write the sectors held by the media manager cache */
+        if (SYS_FS_MEDIA_MANAGER_CacheFlush (pdrv) == false)
+        {
+            return RES_ERROR;
+        }
+    }
+#endif
+    else
+    {
+        /* Nothing to do */
+    }
 
     return RES_OK;
 }
@@ -311,6 +311,72 @@ static bool SYS_FS_StringWildCardCompare
 }
 
 
+//******************************************************************************
+/*Function:
+    static void SYS_FS_FreeScanTasks
+    (
+        void
+    )
+
+  Summary:
+    Advances the validation of the free cluster count of a mounted volume.
+
+  Description:
+    This function lets the native file system check one more part of the
+    allocation table of the first mounted volume whose free cluster count has
+    not been validated yet. The step is skipped when an API call holds the
+    volume, so the scan never delays the application.
+
+  Remarks:
+    None
+***************************************************************************/
+static void SYS_FS_FreeScanTasks
+(
+    void
+)
+{
+    SYS_FS_MOUNT_POINT *disk = NULL;
+    uint8_t pathWithDiskNo[3] = { 0 };
+    uint32_t remaining = 0;
+    uint32_t index = 0;
+
+    for (index = 0; index < SYS_FS_VOLUME_NUMBER; index++)
+    {
+        disk = &gSYSFSMountPoint[index];
+
+        if ((disk->inUse == false) || (disk->freeScanDone == true))
+        {
+            continue;
+        }
+
+        /* Do not wait for a volume in use */
+        if (OSAL_MUTEX_Lock(&(disk->mutexDiskVolume), 0U) == OSAL_RESULT_SUCCESS)
+        {
+            if ((disk->inUse == true) && (disk->fsFunctions->freeScan != NULL))
+            {
+                pathWithDiskNo[0] = (uint8_t)disk->diskNumber + (uint8_t)'0';
+                pathWithDiskNo[1] = (uint8_t)':';
+                pathWithDiskNo[2] = (uint8_t)'\0';
+
+                /* A volume that cannot be scanned is not retried */
+                if ((disk->fsFunctions->freeScan((const char *)pathWithDiskNo, &remaining) != 0) || (remaining == 0U))
+                {
+                    disk->freeScanDone = true;
+                }
+            }
+            else
+            {
+                disk->freeScanDone = true;
+            }
+
+            (void) OSAL_MUTEX_Unlock(&(disk->mutexDiskVolume));
+        }
+
+        /* One step per call */
+        break;
+    }
+}
+
 //******************************************************************************
 /*Function:
     SYS_FS_RESULT SYS_FS_Initialize
@@ -403,6 +469,9 @@ void SYS_FS_Tasks ( void )
 {
     /* Task routine for media manager */
     SYS_FS_MEDIA_MANAGER_Tasks();
+
+    /* Validate the free cluster counts */
+    SYS_FS_FreeScanTasks();
 }
 
 
@@ -636,6 +705,7 @@ SYS_FS_RESULT SYS_FS_Mount
     /* Set the Disk in Use to true only when Mount is success */
     if (fileStatus == 0)
     {
+        disk->freeScanDone = false;
         disk->inUse = true;
 
         /* Put the recently assigned disk as the current disk */
@@ -2585,6 +2655,78 @@ SYS_FS_RESULT SYS_FS_FileTruncate
     }
 }
 
+//******************************************************************************
+/*Function:
+    SYS_FS_RESULT SYS_FS_FileSeekIndexBuild
+    (
+        SYS_FS_HANDLE handle,
+        uint32_t *table,
+        uint32_t tableSize
+    );
+
+  Summary:
+    Builds the cluster map of an open file for the fast seek.
+
+  Description:
+    This function maps the clusters of the file into the table supplied by
+    the caller, so the seeks on the file no longer follow the cluster chain.
+
+  Remarks:
+    See sys_fs.h for usage information.
+***************************************************************************/
+SYS_FS_RESULT SYS_FS_FileSeekIndexBuild
+(
+    SYS_FS_HANDLE handle,
+    uint32_t *table,
+    uint32_t tableSize
+)
+{
+    int fileStatus = -1;
+    SYS_FS_OBJ *obj = (SYS_FS_OBJ *)handle;
+
+    if(handle == SYS_FS_HANDLE_INVALID)
+    {
+        errorValue = SYS_FS_ERROR_INVALID_OBJECT;
+        return SYS_FS_RES_FAILURE;
+    }
+
+    if(obj->inUse == false)
+    {
+        errorValue = SYS_FS_ERROR_INVALID_OBJECT;
+        return SYS_FS_RES_FAILURE;
+    }
+
+    if((table != NULL) && (tableSize < 4U))
+    {
+        obj->errorValue = SYS_FS_ERROR_INVALID_PARAMETER;
+        return SYS_FS_RES_FAILURE;
+    }
+
+    if(obj->mountPoint->fsFunctions->seekIndex == NULL)
+    {
+        obj->errorValue = SYS_FS_ERROR_NOT_SUPPORTED_IN_NATIVE_FS;
+        return SYS_FS_RES_FAILURE;
+    }
+
+    if(OSAL_MUTEX_Lock(&(obj->mountPoint->mutexDiskVolume), OSAL_WAIT_FOREVER)
+                                                        == OSAL_RESULT_SUCCESS)
+    {
+        fileStatus = obj->mountPoint->fsFunctions->seekIndex(obj->nativeFSFileObj, table, tableSize);
+
+        (void) OSAL_MUTEX_Unlock(&(obj->mountPoint->mutexDiskVolume));
+    }
+
+    if(fileStatus == 0)
+    {
+        return SYS_FS_RES_SUCCESS;
+    }
+    else
+    {
+        obj->errorValue = (SYS_FS_ERROR)fileStatus;
+        return SYS_FS_RES_FAILURE;
+    }
+}
+
 //******************************************************************************
 /*Function:
     SYS_FS_RESULT SYS_FS_FileCharacterPut
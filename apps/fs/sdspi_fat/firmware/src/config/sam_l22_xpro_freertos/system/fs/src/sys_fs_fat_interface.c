@@ -23,6 +23,7 @@
 
 #include "system/fs/sys_fs_fat_interface.h"
 #include "system/fs/sys_fs.h"
+#include "system/fs/sys_fs_media_manager.h"
 
 typedef struct
 {
@@ -97,6 +98,14 @@ int FATFS_mount ( uint8_t vol )
         FATFSVolume[vol].inUse = true;
     }
 
+#if defined(SYS_FS_MEDIA_MANAGER_CACHE_SECTORS)
+    if (res == FR_OK)
+    {
+        /* Keep the FAT sectors of the volume in the media manager cache */
+        SYS_FS_MEDIA_MANAGER_CacheSectorsPin(vol, fs->pdrv, (uint32_t)fs->fatbase, (uint32_t)fs->fsize * fs->n_fats);
+    }
+#endif
+
     return ((int)res);
 }
 
@@ -122,6 +131,12 @@ int FATFS_unmount ( uint8_t vol )
     path[1] = ':';
     path[2] = '\0';
 
+#if defined(SYS_FS_MEDIA_MANAGER_CACHE_SECTORS)
+    /* Write the cached sectors of the volume before releasing it */
+    (void) SYS_FS_MEDIA_MANAGER_CacheFlush((uint16_t)VolToPart[vol].pd);
+    SYS_FS_MEDIA_MANAGER_CacheSectorsPin(vol, (uint16_t)VolToPart[vol].pd, 0, 0);
+#endif
+
     res = f_mount(NULL, (const TCHAR *)&path, opt);
 
     if (res == FR_OK)
@@ -288,6 +303,34 @@ int FATFS_lseek (
     return ((int)res);
 }
 
+int FATFS_linkmap (
+    uintptr_t handle,   /* Pointer to the file object */
+    uint32_t *table,    /* Cluster link map table, NULL to leave fast seek mode */
+    uint32_t tableSize  /* Number of items of the table */
+)
+{
+    FRESULT res = FR_OK;
+    FATFS_FILE_OBJECT *ptr = (FATFS_FILE_OBJECT *)handle;
+    FIL *fp = &ptr->fileObj;
+
+    fp->cltbl = (DWORD *)table;
+
+    if (table != NULL)
+    {
+        table[0] = tableSize;
+
+        res = f_lseek(fp, CREATE_LINKMAP);
+
+        if (res != FR_OK)
+        {
+            /* On FR_NOT_ENOUGH_CORE, table[0] holds the required size */
+            fp->cltbl = NULL;
+        }
+    }
+
+    return ((int)res);
+}
+
 int FATFS_stat (
     const char* path,   /* Pointer to the file path */
     uintptr_t fileInfo  /* Pointer to file information to return */
@@ -717,6 +760,18 @@ int FATFS_getclusters (
     return ((int)res);
 }
 
+int FATFS_freescan (
+    const char *path,       /* Path name of the logical drive number */
+    uint32_t *remaining     /* Pointer to return the FAT entries left to check */
+)
+{
+    FRESULT res;
+
+    res = f_freescan((const TCHAR *)path, (DWORD *)remaining);
+
+    return ((int)res);
+}
+
 int FATFS_getfree (
     const char* path,  /* Path name of the logical drive number */
     uint32_t* nclst,        /* Pointer to a variable to return number of free clusters */
@@ -82,6 +82,8 @@ typedef struct
     uint8_t mountNameLength;
     /* Volume number */
     uint8_t diskNumber;
+    /* The free cluster count of the volume has been validated */
+    bool freeScanDone;
    /* Mount/Volume instance mutex */
     OSAL_MUTEX_DECLARE(mutexDiskVolume);
 }
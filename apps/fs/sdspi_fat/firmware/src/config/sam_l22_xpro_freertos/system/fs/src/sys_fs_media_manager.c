@@ -42,6 +42,9 @@
 #include "system/fs/src/sys_fs_media_manager_local.h"
 #include "system/fs/src/sys_fs_local.h"
 #include "system/fs/fat_fs/file_system/ff.h"
+#if defined(SYS_DMA_MEM_QUEUE_SIZE)
+#include "system/dma/sys_dma.h"
+#endif
 
 static const char *gSYSFSVolumeName [] = {
     "nvm",
@@ -693,6 +696,1105 @@ void SYS_FS_MEDIA_MANAGER_DeRegister
     mediaObj->isMediaDisconnected = 1U;
 }
 
+//*****************************************************************************
+/* Function:
+    static SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE SYS_FS_MEDIA_T_MANAGER_SectorRead
+    (
+        SYS_FS_MEDIA *mediaObj,
+        uint8_t *dataBuffer,
+        uint32_t sector,
+        uint32_t numSectors
+    );
+
+  Summary:
+    Submits a sector read to the media driver.
+
+  Description:
+    This function translates the sectors to media blocks and submits the read
+    to the media driver of a validated media object.
+
+  Remarks:
+    None.
+***************************************************************************/
+static SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE SYS_FS_MEDIA_T_MANAGER_SectorRead
+(
+    SYS_FS_MEDIA *mediaObj,
+    uint8_t *dataBuffer,
+    uint32_t sector,
+    uint32_t numSectors
+)
+{
+    uint32_t blocksPerSector = 0;
+    uint32_t mediaReadBlockSize = 0;
+
+    mediaReadBlockSize = mediaObj->mediaGeometry->geometryTable[0].blockSize;
+
+    if (mediaReadBlockSize < 512U)
+    {
+        /* Find the number of blocks per sector */
+        blocksPerSector = 512U / mediaReadBlockSize;
+        /* Perform sector to block translation */
+        sector *= blocksPerSector;
+        numSectors *= blocksPerSector;
+    }
+    else
+    {
+        /* TODO: Handle cases where the block size is greater than 512 bytes.
+         * */
+    }
+
+
+    mediaObj->commandStatus = SYS_FS_MEDIA_COMMAND_IN_PROGRESS;
+    mediaObj->driverFunctions->sectorRead (mediaObj->driverHandle, &(mediaObj->commandHandle), dataBuffer, sector, numSectors);
+
+    return (mediaObj->commandHandle);
+}
+
+//*****************************************************************************
+/* Function:
+    static SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE SYS_FS_MEDIA_T_MANAGER_SectorWrite
+    (
+        SYS_FS_MEDIA *mediaObj,
+        uint32_t sector,
+        uint8_t *dataBuffer,
+        uint32_t numSectors
+    );
+
+  Summary:
+    Submits a sector write to the media driver.
+
+  Description:
+    This function translates the sectors to media blocks and submits the write
+    to the media driver of a validated media object. Partial media blocks at
+    the head and tail of the range are updated with a blocking
+    read-modify-write; the full blocks between them are written with a single
+    multi-block write.
+
+  Remarks:
+    The event notification state of the caller is restored on return.
+***************************************************************************/
+static SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE SYS_FS_MEDIA_T_MANAGER_SectorWrite
+(
+    SYS_FS_MEDIA *mediaObj,
+    uint32_t sector,
+    uint8_t *dataBuffer,
+    uint32_t numSectors
+)
+{
+    uint8_t *data = dataBuffer;
+    uint32_t sectorOffsetInBlock = 0;
+    uint32_t memoryBlock = 0;
+    uint32_t sectorsPerBlock = 0;
+    uint32_t numSectorsToWrite = 0;
+    uint32_t mediaWriteBlockSize = 0;
+    uint32_t blocksPerSector = 0;
+    uint32_t numBlocks = 1;
+    bool isMuted = gSYSFSMediaManagerObj.muteEventNotification;
+
+    mediaWriteBlockSize = mediaObj->mediaGeometry->geometryTable[1].blockSize;
+
+    if (mediaWriteBlockSize > 512U)
+    {
+        sectorsPerBlock = mediaWriteBlockSize / 512U;
+    }
+    else if (mediaWriteBlockSize == 512U)
+    {
+        sectorsPerBlock = 1;
+        blocksPerSector = 1;
+    }
+    else
+    {
+        blocksPerSector = 512U / mediaWriteBlockSize;
+        sector *= blocksPerSector;
+        numSectors *= blocksPerSector;
+    }
+
+    if ((sectorsPerBlock == 1U) || (blocksPerSector > 0U))
+    {
+        mediaObj->commandStatus = SYS_FS_MEDIA_COMMAND_IN_PROGRESS;
+        mediaObj->driverFunctions->sectorWrite (mediaObj->driverHandle, &(mediaObj->commandHandle), dataBuffer, sector, numSectors);
+        return (mediaObj->commandHandle);
+    }
+    else
+    {
+        /* Mute the event notification */
+        gSYSFSMediaManagerObj.muteEventNotification = true;
+
+        while (numSectors > 0U)
+        {
+            /* Find the memory block for the starting sector */
+            memoryBlock = sector / sectorsPerBlock;
+
+            /* Find the number of sectors to be updated in this block. */
+            sectorOffsetInBlock = (sector % sectorsPerBlock);
+
+            if ((sectorOffsetInBlock != 0U) || (numSectors < sectorsPerBlock))
+            {
+                /* Partial head or tail block: read the memory block from the
+                 * media and update it with the data. */
+                numSectorsToWrite = (sectorsPerBlock - sectorOffsetInBlock);
+
+                if (numSectors < numSectorsToWrite)
+                {
+                    numSectorsToWrite = numSectors;
+                }
+
+                numBlocks = 1;
+
+                if (mediaWriteBlockSize > SYS_FS_MEDIA_MANAGER_BUFFER_SIZE)
+                {
+                    /* The block does not fit the read-modify-write buffer */
+                    gSYSFSMediaManagerObj.muteEventNotification = isMuted;
+                    return SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE_INVALID;
+                }
+
+                mediaObj->commandStatus = SYS_FS_MEDIA_COMMAND_IN_PROGRESS;
+
+                mediaObj->driverFunctions->sectorRead(mediaObj->driverHandle, &(mediaObj->commandHandle), gSYSFSMediaBlockBuffer, memoryBlock * mediaWriteBlockSize, mediaWriteBlockSize);
+
+                while (mediaObj->commandStatus == SYS_FS_MEDIA_COMMAND_IN_PROGRESS)
+                {
+                    if(mediaObj->driverFunctions->tasks != NULL)
+                    {
+                        mediaObj->driverFunctions->tasks(mediaObj->driverObj);
+                    }
+                }
+
+                if (mediaObj->commandStatus != SYS_FS_MEDIA_COMMAND_COMPLETED)
+                {
+                    /* Restore the event notification */
+                    gSYSFSMediaManagerObj.muteEventNotification = isMuted;
+
+                    /* Media read operation failed. */
+                    return SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE_INVALID;
+                }
+
+                /* Multiply by the sector size */
+                sectorOffsetInBlock <<= 9;
+#if defined(SYS_DMA_MEM_QUEUE_SIZE)
+                (void) SYS_DMA_MemCopy ((void *)&gSYSFSMediaBlockBuffer[sectorOffsetInBlock], (const void *)dataBuffer, numSectorsToWrite << 9);
+#else
+                (void) memcpy ((void *)&gSYSFSMediaBlockBuffer[sectorOffsetInBlock], (const void *)dataBuffer, numSectorsToWrite << 9);
+#endif
+
+                data = gSYSFSMediaBlockBuffer;
+            }
+            else
+            {
+                /* All the full blocks that follow are written with a single
+                 * multi-block write, without read-modify-write. */
+                numBlocks = numSectors / sectorsPerBlock;
+                numSectorsToWrite = numBlocks * sectorsPerBlock;
+                data = dataBuffer;
+            }
+
+            if ((numSectors - numSectorsToWrite) == 0U)
+            {
+                /* This is the last write operation. */
+                break;
+            }
+
+            /* Write the blocks to the media */
+            mediaObj->commandStatus = SYS_FS_MEDIA_COMMAND_IN_PROGRESS;
+            mediaObj->driverFunctions->sectorWrite (mediaObj->driverHandle, &(mediaObj->commandHandle), data, memoryBlock, numBlocks);
+            while (mediaObj->commandStatus == SYS_FS_MEDIA_COMMAND_IN_PROGRESS)
+            {
+                if(mediaObj->driverFunctions->tasks != NULL)
+                {
+                    mediaObj->driverFunctions->tasks(mediaObj->driverObj);
+                }
+            }
+
+            if (mediaObj->commandStatus != SYS_FS_MEDIA_COMMAND_COMPLETED)
+            {
+                /* Restore the event notification */
+                gSYSFSMediaManagerObj.muteEventNotification = isMuted;
+
+                /* Media write operation failed. */
+                return SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE_INVALID;
+            }
+
+            /* Update the number of block still to be written, sector address
+             * and the buffer pointer */
+            numSectors -= numSectorsToWrite;
+            sector += numSectorsToWrite;
+            dataBuffer += (numSectorsToWrite << 9);
+        }
+    }
+
+    /* Restore the event notification */
+    gSYSFSMediaManagerObj.muteEventNotification = isMuted;
+
+    mediaObj->commandStatus = SYS_FS_MEDIA_COMMAND_IN_PROGRESS;
+    mediaObj->driverFunctions->sectorWrite (mediaObj->driverHandle, &(mediaObj->commandHandle), data, memoryBlock, numBlocks);
+
+    return (mediaObj->commandHandle);
+}
+
+#if defined(SYS_FS_MEDIA_MANAGER_READ_AHEAD_SECTORS)
+#if !defined(SYS_FS_MEDIA_MANAGER_CACHE_SECTORS)
+#error "The media manager read-ahead requires SYS_FS_MEDIA_MANAGER_CACHE_SECTORS"
+#endif
+// *****************************************************************************
+// *****************************************************************************
+// Section: Media Read-Ahead
+// *****************************************************************************
+// *****************************************************************************
+/* Reads smaller than a read-ahead window that continue the previous read are
+ * served from a window of SYS_FS_MEDIA_MANAGER_READ_AHEAD_SECTORS sectors read
+ * from the media in one command. When the reader enters a window, the next
+ * window is read into the other buffer while the application processes the
+ * data. Writes drop the windows they overlap. Served reads complete like the
+ * sector cache hits. */
+
+static SYS_FS_MEDIA_READ_AHEAD_OBJ CACHE_ALIGN gSYSFSMediaReadAheadObj;
+
+/* Intercepts the event of the outstanding read-ahead command. Returns true if
+ * the event belongs to it. */
+static bool SYS_FS_MEDIA_T_MANAGER_ReadAheadEvent
+(
+    SYS_FS_MEDIA_BLOCK_EVENT event,
+    const SYS_FS_MEDIA *mediaObj
+)
+{
+    if ((gSYSFSMediaReadAheadObj.pending == NULL) ||
+        (gSYSFSMediaReadAheadObj.commandStatus != SYS_FS_MEDIA_COMMAND_IN_PROGRESS) ||
+        (gSYSFSMediaReadAheadObj.diskNum != mediaObj->mediaIndex))
+    {
+        return false;
+    }
+
+    if (event == SYS_FS_MEDIA_EVENT_BLOCK_COMMAND_COMPLETE)
+    {
+        gSYSFSMediaReadAheadObj.commandStatus = SYS_FS_MEDIA_COMMAND_COMPLETED;
+    }
+    else
+    {
+        gSYSFSMediaReadAheadObj.commandStatus = SYS_FS_MEDIA_COMMAND_UNKNOWN;
+    }
+
+    return true;
+}
+
+/* Waits for the end of the outstanding read-ahead command, if any. Must be
+ * called before any other command is submitted to the media. */
+static void SYS_FS_MEDIA_T_MANAGER_ReadAheadSettle
+(
+    void
+)
+{
+    SYS_FS_MEDIA *mediaObj = NULL;
+
+    if (gSYSFSMediaReadAheadObj.pending == NULL)
+    {
+        return;
+    }
+
+    mediaObj = &gSYSFSMediaManagerObj.mediaObj[gSYSFSMediaReadAheadObj.diskNum];
+
+    while (gSYSFSMediaReadAheadObj.commandStatus == SYS_FS_MEDIA_COMMAND_IN_PROGRESS)
+    {
+        if(mediaObj->driverFunctions->tasks != NULL)
+        {
+            mediaObj->driverFunctions->tasks(mediaObj->driverObj);
+        }
+    }
+
+    gSYSFSMediaReadAheadObj.pending->valid = (gSYSFSMediaReadAheadObj.commandStatus == SYS_FS_MEDIA_COMMAND_COMPLETED);
+    gSYSFSMediaReadAheadObj.pending = NULL;
+}
+
+/* Drops the windows overlapping a range of a disk, all windows of the disk
+ * if numSectors is 0 */
+static void SYS_FS_MEDIA_T_MANAGER_ReadAheadInvalidate
+(
+    uint16_t diskNum,
+    uint32_t sector,
+    uint32_t numSectors
+)
+{
+    SYS_FS_MEDIA_READ_AHEAD_BUFFER *buffer = NULL;
+    uint32_t index;
+
+    if (gSYSFSMediaReadAheadObj.diskNum != diskNum)
+    {
+        return;
+    }
+
+    for (index = 0; index < 2U; index++)
+    {
+        buffer = &gSYSFSMediaReadAheadObj.buffers[index];
+
+        if ((numSectors == 0U) ||
+            (((sector + numSectors) > buffer->startSector) &&
+            (sector < (buffer->startSector + SYS_FS_MEDIA_MANAGER_READ_AHEAD_SECTORS))))
+        {
+            buffer->valid = false;
+        }
+    }
+
+    /* Restart the detection of the sequential reads */
+    gSYSFSMediaReadAheadObj.nextSector = 0xFFFFFFFFU;
+}
+
+/* Forgets the windows of a detached media and its outstanding command */
+static void SYS_FS_MEDIA_T_MANAGER_ReadAheadDiscard
+(
+    uint16_t diskNum
+)
+{
+    if (gSYSFSMediaReadAheadObj.diskNum == diskNum)
+    {
+        gSYSFSMediaReadAheadObj.pending = NULL;
+    }
+
+    SYS_FS_MEDIA_T_MANAGER_ReadAheadInvalidate (diskNum, 0, 0);
+}
+#endif
+
+#if defined(SYS_FS_MEDIA_MANAGER_CACHE_SECTORS)
+//*****************************************************************************
+/* Function:
+    static bool SYS_FS_MEDIA_T_MANAGER_CommandWait
+    (
+        SYS_FS_MEDIA *mediaObj,
+        SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE commandHandle
+    );
+
+  Summary:
+    Runs the media driver until the last submitted command ends.
+
+  Description:
+    This function blocks on the media task routine like the read-modify-write
+    of SYS_FS_MEDIA_T_MANAGER_SectorWrite does.
+
+  Remarks:
+    Returns true if the command completed successfully.
+***************************************************************************/
+static bool SYS_FS_MEDIA_T_MANAGER_CommandWait
+(
+    SYS_FS_MEDIA *mediaObj,
+    SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE commandHandle
+)
+{
+    if (commandHandle == SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE_INVALID)
+    {
+        return false;
+    }
+
+    while (mediaObj->commandStatus == SYS_FS_MEDIA_COMMAND_IN_PROGRESS)
+    {
+        if(mediaObj->driverFunctions->tasks != NULL)
+        {
+            mediaObj->driverFunctions->tasks(mediaObj->driverObj);
+        }
+    }
+
+    return (mediaObj->commandStatus == SYS_FS_MEDIA_COMMAND_COMPLETED);
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Media Sector Cache
+// *****************************************************************************
+// *****************************************************************************
+/* Single sector reads and writes, which the FAT file system issues for the
+ * FAT, the directories and the partial sectors of files, go through an LRU
+ * cache of SYS_FS_MEDIA_MANAGER_CACHE_SECTORS sectors. Writes are kept in the
+ * cache until the entry is reused or the disk is flushed. Multi-sector
+ * transfers go to the media: the modified cached sectors they read are
+ * flushed first and the cached sectors they write are dropped. */
+
+static SYS_FS_MEDIA_CACHE_OBJ CACHE_ALIGN gSYSFSMediaCacheObj;
+
+/* Returns the entry holding the sector, or NULL */
+static SYS_FS_MEDIA_CACHE_ENTRY *SYS_FS_MEDIA_T_MANAGER_CacheFind
+(
+    uint16_t diskNum,
+    uint32_t sector
+)
+{
+    SYS_FS_MEDIA_CACHE_ENTRY *entry = NULL;
+    uint32_t index;
+
+    for (index = 0; index < SYS_FS_MEDIA_MANAGER_CACHE_SECTORS; index++)
+    {
+        entry = &gSYSFSMediaCacheObj.entries[index];
+
+        if ((entry->valid == true) && (entry->diskNum == diskNum) && (entry->sector == sector))
+        {
+            return entry;
+        }
+    }
+
+    return NULL;
+}
+
+static bool SYS_FS_MEDIA_T_MANAGER_CacheIsPinned
+(
+    uint16_t diskNum,
+    uint32_t sector
+)
+{
+    const SYS_FS_MEDIA_CACHE_PIN *pin = NULL;
+    uint32_t volIndex;
+
+    for (volIndex = 0; volIndex < SYS_FS_VOLUME_NUMBER; volIndex++)
+    {
+        pin = &gSYSFSMediaCacheObj.pins[volIndex];
+
+        if ((pin->numSectors != 0U) && (pin->diskNum == diskNum) &&
+            (sector >= pin->startSector) && ((sector - pin->startSector) < pin->numSectors))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void SYS_FS_MEDIA_T_MANAGER_CacheTouch
+(
+    SYS_FS_MEDIA_CACHE_ENTRY *entry
+)
+{
+    gSYSFSMediaCacheObj.useCount++;
+    entry->lastUse = gSYSFSMediaCacheObj.useCount;
+}
+
+static void SYS_FS_MEDIA_T_MANAGER_CacheInvalidate
+(
+    SYS_FS_MEDIA_CACHE_ENTRY *entry
+)
+{
+    if (entry->pinned == true)
+    {
+        gSYSFSMediaCacheObj.nPinned--;
+    }
+
+    entry->valid = false;
+    entry->dirty = false;
+    entry->pinned = false;
+}
+
+/* Writes a modified entry to the media and waits for the end of the write */
+static bool SYS_FS_MEDIA_T_MANAGER_CacheWriteBack
+(
+    SYS_FS_MEDIA_CACHE_ENTRY *entry
+)
+{
+    SYS_FS_MEDIA *mediaObj = &gSYSFSMediaManagerObj.mediaObj[entry->diskNum];
+    SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE commandHandle;
+    bool isMuted = gSYSFSMediaManagerObj.muteEventNotification;
+    bool isWritten;
+
+    /* The write belongs to the cache, not to the command of the caller */
+    gSYSFSMediaManagerObj.muteEventNotification = true;
+
+    commandHandle = SYS_FS_MEDIA_T_MANAGER_SectorWrite (mediaObj, entry->sector, entry->data, 1);
+    isWritten = SYS_FS_MEDIA_T_MANAGER_CommandWait (mediaObj, commandHandle);
+
+    gSYSFSMediaManagerObj.muteEventNotification = isMuted;
+
+    if (isWritten == true)
+    {
+        entry->dirty = false;
+        gSYSFSMediaCacheObj.statistics.writeBacks++;
+    }
+
+    return isWritten;
+}
+
+/* Saves the modified cached sectors of a range before the media is read */
+static bool SYS_FS_MEDIA_T_MANAGER_CacheRangeWriteBack
+(
+    uint16_t diskNum,
+    uint32_t sector,
+    uint32_t numSectors
+)
+{
+    SYS_FS_MEDIA_CACHE_ENTRY *entry = NULL;
+    uint32_t index;
+
+    for (index = 0; index < SYS_FS_MEDIA_MANAGER_CACHE_SECTORS; index++)
+    {
+        entry = &gSYSFSMediaCacheObj.entries[index];
+
+        if ((entry->valid == true) && (entry->dirty == true) && (entry->diskNum == diskNum) &&
+            (entry->sector >= sector) && ((entry->sector - sector) < numSectors))
+        {
+            if (SYS_FS_MEDIA_T_MANAGER_CacheWriteBack (entry) == false)
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+/* Returns an entry for a sector not in the cache: a free entry, or else the
+ * least recently used entry not pinned, saved first if modified. Returns NULL
+ * if the modified entry could not be saved. */
+static SYS_FS_MEDIA_CACHE_ENTRY *SYS_FS_MEDIA_T_MANAGER_CacheAllocate
+(
+    uint16_t diskNum,
+    uint32_t sector
+)
+{
+    SYS_FS_MEDIA_CACHE_ENTRY *entry = NULL;
+    SYS_FS_MEDIA_CACHE_ENTRY *victim = NULL;
+    uint32_t index;
+
+    for (index = 0; index < SYS_FS_MEDIA_MANAGER_CACHE_SECTORS; index++)
+    {
+        entry = &gSYSFSMediaCacheObj.entries[index];
+
+        if (entry->valid == false)
+        {
+            victim = entry;
+            break;
+        }
+
+        /* Wrap-safe comparison of the use counts */
+        if ((entry->pinned == false) &&
+            ((victim == NULL) || ((int32_t)(entry->lastUse - victim->lastUse) < 0)))
+        {
+            victim = entry;
+        }
+    }
+
+    /* At most SYS_FS_MEDIA_MANAGER_CACHE_SECTORS - 1 entries are pinned */
+    if (victim->valid == true)
+    {
+        if ((victim->dirty == true) && (SYS_FS_MEDIA_T_MANAGER_CacheWriteBack (victim) == false))
+        {
+            return NULL;
+        }
+
+        SYS_FS_MEDIA_T_MANAGER_CacheInvalidate (victim);
+        gSYSFSMediaCacheObj.statistics.evictions++;
+    }
+
+    victim->diskNum = diskNum;
+    victim->sector = sector;
+
+    if ((gSYSFSMediaCacheObj.nPinned < (SYS_FS_MEDIA_MANAGER_CACHE_SECTORS - 1U)) &&
+        (SYS_FS_MEDIA_T_MANAGER_CacheIsPinned (diskNum, sector) == true))
+    {
+        victim->pinned = true;
+        gSYSFSMediaCacheObj.nPinned++;
+    }
+
+    return victim;
+}
+
+/* Ends a command served by the cache the way the media event handler ends a
+ * media command */
+static SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE SYS_FS_MEDIA_T_MANAGER_CacheCommandComplete
+(
+    SYS_FS_MEDIA *mediaObj,
+    bool isSuccess
+)
+{
+    SYS_FS_MEDIA_BLOCK_EVENT event = SYS_FS_MEDIA_EVENT_BLOCK_COMMAND_COMPLETE;
+
+    mediaObj->commandHandle = SYS_FS_MEDIA_MANAGER_CACHE_COMMAND_HANDLE;
+    mediaObj->commandStatus = SYS_FS_MEDIA_COMMAND_COMPLETED;
+
+    if (isSuccess == false)
+    {
+        event = SYS_FS_MEDIA_EVENT_BLOCK_COMMAND_ERROR;
+        mediaObj->commandStatus = SYS_FS_MEDIA_COMMAND_UNKNOWN;
+    }
+
+    if ((gSYSFSMediaManagerObj.eventHandler != NULL) && (gSYSFSMediaManagerObj.muteEventNotification == false))
+    {
+        gSYSFSMediaManagerObj.eventHandler ((SYS_FS_EVENT)event, (void *)mediaObj->commandHandle, mediaObj->mediaIndex);
+    }
+
+    return mediaObj->commandHandle;
+}
+
+static SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE SYS_FS_MEDIA_T_MANAGER_CacheRead
+(
+    SYS_FS_MEDIA *mediaObj,
+    uint8_t *dataBuffer,
+    uint32_t sector,
+    uint32_t numSectors
+)
+{
+    SYS_FS_MEDIA_CACHE_ENTRY *entry = NULL;
+    SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE commandHandle;
+    uint16_t diskNum = mediaObj->mediaIndex;
+    bool isMuted;
+    bool isRead;
+
+    if (numSectors != 1U)
+    {
+        /* Save the modified cached sectors the media read covers */
+        if (SYS_FS_MEDIA_T_MANAGER_CacheRangeWriteBack (diskNum, sector, numSectors) == false)
+        {
+            return SYS_FS_MEDIA_T_MANAGER_CacheCommandComplete (mediaObj, false);
+        }
+
+        return SYS_FS_MEDIA_T_MANAGER_SectorRead (mediaObj, dataBuffer, sector, numSectors);
+    }
+
+    entry = SYS_FS_MEDIA_T_MANAGER_CacheFind (diskNum, sector);
+
+    if (entry != NULL)
+    {
+        gSYSFSMediaCacheObj.statistics.readHits++;
+    }
+    else
+    {
+        gSYSFSMediaCacheObj.statistics.readMisses++;
+
+        entry = SYS_FS_MEDIA_T_MANAGER_CacheAllocate (diskNum, sector);
+
+        if (entry == NULL)
+        {
+            return SYS_FS_MEDIA_T_MANAGER_CacheCommandComplete (mediaObj, false);
+        }
+
+        /* Read the sector into the entry */
+        isMuted = gSYSFSMediaManagerObj.muteEventNotification;
+        gSYSFSMediaManagerObj.muteEventNotification = true;
+
+        commandHandle = SYS_FS_MEDIA_T_MANAGER_SectorRead (mediaObj, entry->data, sector, 1);
+        isRead = SYS_FS_MEDIA_T_MANAGER_CommandWait (mediaObj, commandHandle);
+
+        gSYSFSMediaManagerObj.muteEventNotification = isMuted;
+
+        if (isRead == false)
+        {
+            SYS_FS_MEDIA_T_MANAGER_CacheInvalidate (entry);
+            return SYS_FS_MEDIA_T_MANAGER_CacheCommandComplete (mediaObj, false);
+        }
+
+        entry->valid = true;
+    }
+
+    SYS_FS_MEDIA_T_MANAGER_CacheTouch (entry);
+
+    (void) memcpy ((void *)dataBuffer, (const void *)entry->data, sizeof(entry->data));
+
+    return SYS_FS_MEDIA_T_MANAGER_CacheCommandComplete (mediaObj, true);
+}
+
+static SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE SYS_FS_MEDIA_T_MANAGER_CacheWrite
+(
+    SYS_FS_MEDIA *mediaObj,
+    uint32_t sector,
+    uint8_t *dataBuffer,
+    uint32_t numSectors
+)
+{
+    SYS_FS_MEDIA_CACHE_ENTRY *entry = NULL;
+    uint16_t diskNum = mediaObj->mediaIndex;
+    uint32_t index;
+
+    if (numSectors != 1U)
+    {
+        /* The media write replaces the cached sectors it covers */
+        for (index = 0; index < SYS_FS_MEDIA_MANAGER_CACHE_SECTORS; index++)
+        {
+            entry = &gSYSFSMediaCacheObj.entries[index];
+
+            if ((entry->valid == true) && (entry->diskNum == diskNum) &&
+                (entry->sector >= sector) && ((entry->sector - sector) < numSectors))
+            {
+                SYS_FS_MEDIA_T_MANAGER_CacheInvalidate (entry);
+            }
+        }
+
+        return SYS_FS_MEDIA_T_MANAGER_SectorWrite (mediaObj, sector, dataBuffer, numSectors);
+    }
+
+    entry = SYS_FS_MEDIA_T_MANAGER_CacheFind (diskNum, sector);
+
+    if (entry != NULL)
+    {
+        gSYSFSMediaCacheObj.statistics.writeHits++;
+    }
+    else
+    {
+        gSYSFSMediaCacheObj.statistics.writeMisses++;
+
+        entry = SYS_FS_MEDIA_T_MANAGER_CacheAllocate (diskNum, sector);
+
+        if (entry == NULL)
+        {
+            return SYS_FS_MEDIA_T_MANAGER_CacheCommandComplete (mediaObj, false);
+        }
+
+        entry->valid = true;
+    }
+
+    (void) memcpy ((void *)entry->data, (const void *)dataBuffer, sizeof(entry->data));
+
+    entry->dirty = true;
+
+    SYS_FS_MEDIA_T_MANAGER_CacheTouch (entry);
+
+    return SYS_FS_MEDIA_T_MANAGER_CacheCommandComplete (mediaObj, true);
+}
+
+/* Drops the cached sectors of a detached media, modified or not */
+static void SYS_FS_MEDIA_T_MANAGER_CacheDiscard
+(
+    uint16_t diskNum
+)
+{
+    SYS_FS_MEDIA_CACHE_ENTRY *entry = NULL;
+    uint32_t index;
+
+    for (index = 0; index < SYS_FS_MEDIA_MANAGER_CACHE_SECTORS; index++)
+    {
+        entry = &gSYSFSMediaCacheObj.entries[index];
+
+        if ((entry->valid == true) && (entry->diskNum == diskNum))
+        {
+            SYS_FS_MEDIA_T_MANAGER_CacheInvalidate (entry);
+        }
+    }
+}
+
+//*****************************************************************************
+/* Function:
+    bool SYS_FS_MEDIA_MANAGER_CacheFlush
+    (
+        uint16_t diskNum
+    );
+
+  Summary:
+    Writes the modified cached sectors of a disk to the media.
+
+  Remarks:
+    See sys_fs_media_manager.h for usage information.
+***************************************************************************/
+bool SYS_FS_MEDIA_MANAGER_CacheFlush
+(
+    uint16_t diskNum
+)
+{
+    SYS_FS_MEDIA_CACHE_ENTRY *entry = NULL;
+    bool isFlushed = true;
+    uint32_t index;
+
+    if (diskNum >= SYS_FS_MEDIA_NUMBER)
+    {
+        return false;
+    }
+
+    if (gSYSFSMediaManagerObj.mediaObj[diskNum].driverHandle == DRV_HANDLE_INVALID)
+    {
+        return false;
+    }
+
+#if defined(SYS_FS_MEDIA_MANAGER_READ_AHEAD_SECTORS)
+    SYS_FS_MEDIA_T_MANAGER_ReadAheadSettle ();
+#endif
+
+    for (index = 0; index < SYS_FS_MEDIA_MANAGER_CACHE_SECTORS; index++)
+    {
+        entry = &gSYSFSMediaCacheObj.entries[index];
+
+        if ((entry->valid == true) && (entry->dirty == true) && (entry->diskNum == diskNum))
+        {
+            if (SYS_FS_MEDIA_T_MANAGER_CacheWriteBack (entry) == false)
+            {
+                isFlushed = false;
+            }
+        }
+    }
+
+    return isFlushed;
+}
+
+//*****************************************************************************
+/* Function:
+    void SYS_FS_MEDIA_MANAGER_CacheSectorsPin
+    (
+        uint8_t volIndex,
+        uint16_t diskNum,
+        uint32_t startSector,
+        uint32_t numSectors
+    );
+
+  Summary:
+    Keeps a range of sectors of a volume in the cache.
+
+  Remarks:
+    See sys_fs_media_manager.h for usage information.
+***************************************************************************/
+void SYS_FS_MEDIA_MANAGER_CacheSectorsPin
+(
+    uint8_t volIndex,
+    uint16_t diskNum,
+    uint32_t startSector,
+    uint32_t numSectors
+)
+{
+    SYS_FS_MEDIA_CACHE_ENTRY *entry = NULL;
+    uint32_t index;
+
+    if (volIndex >= SYS_FS_VOLUME_NUMBER)
+    {
+        return;
+    }
+
+    gSYSFSMediaCacheObj.pins[volIndex].diskNum = diskNum;
+    gSYSFSMediaCacheObj.pins[volIndex].startSector = startSector;
+    gSYSFSMediaCacheObj.pins[volIndex].numSectors = numSectors;
+
+    /* Apply the new ranges to the sectors already cached */
+    for (index = 0; index < SYS_FS_MEDIA_MANAGER_CACHE_SECTORS; index++)
+    {
+        entry = &gSYSFSMediaCacheObj.entries[index];
+
+        if (entry->valid == false)
+        {
+            continue;
+        }
+
+        if (SYS_FS_MEDIA_T_MANAGER_CacheIsPinned (entry->diskNum, entry->sector) == false)
+        {
+            if (entry->pinned == true)
+            {
+                entry->pinned = false;
+                gSYSFSMediaCacheObj.nPinned--;
+            }
+        }
+        else if ((entry->pinned == false) && (gSYSFSMediaCacheObj.nPinned < (SYS_FS_MEDIA_MANAGER_CACHE_SECTORS - 1U)))
+        {
+            entry->pinned = true;
+            gSYSFSMediaCacheObj.nPinned++;
+        }
+        else
+        {
+            /* Nothing to do */
+        }
+    }
+}
+
+//*****************************************************************************
+/* Function:
+    void SYS_FS_MEDIA_MANAGER_CacheStatisticsGet
+    (
+        SYS_FS_MEDIA_CACHE_STATISTICS *statistics
+    );
+
+  Summary:
+    Returns the counters of the sector cache.
+
+  Remarks:
+    See sys_fs_media_manager.h for usage information.
+***************************************************************************/
+void SYS_FS_MEDIA_MANAGER_CacheStatisticsGet
+(
+    SYS_FS_MEDIA_CACHE_STATISTICS *statistics
+)
+{
+    if (statistics != NULL)
+    {
+        *statistics = gSYSFSMediaCacheObj.statistics;
+    }
+}
+
+//*****************************************************************************
+/* Function:
+    void SYS_FS_MEDIA_MANAGER_CacheStatisticsReset
+    (
+        void
+    );
+
+  Summary:
+    Clears the counters of the sector cache.
+
+  Remarks:
+    See sys_fs_media_manager.h for usage information.
+***************************************************************************/
+void SYS_FS_MEDIA_MANAGER_CacheStatisticsReset
+(
+    void
+)
+{
+    (void) memset (&gSYSFSMediaCacheObj.statistics, 0, sizeof(gSYSFSMediaCacheObj.statistics));
+}
+#endif
+
+#if defined(SYS_FS_MEDIA_MANAGER_READ_AHEAD_SECTORS)
+/* Read-ahead, continued: the windows are read through the sector cache */
+
+/* Submits the read of the window starting at a sector into a buffer, without
+ * waiting for its end */
+static void SYS_FS_MEDIA_T_MANAGER_ReadAheadStart
+(
+    SYS_FS_MEDIA *mediaObj,
+    SYS_FS_MEDIA_READ_AHEAD_BUFFER *buffer,
+    uint32_t sector
+)
+{
+    SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE commandHandle;
+    uint32_t mediaReadBlockSize = 0;
+    uint32_t mediaSectors = 0;
+
+    buffer->valid = false;
+    buffer->startSector = sector;
+
+    /* No window is read past the end of the media, where a stream reaching
+     * the last sector would otherwise send a command out of range */
+    mediaReadBlockSize = mediaObj->mediaGeometry->geometryTable[0].blockSize;
+    mediaSectors = mediaObj->mediaGeometry->geometryTable[0].numBlocks;
+
+    if (mediaReadBlockSize < 512U)
+    {
+        mediaSectors /= (512U / mediaReadBlockSize);
+    }
+
+    if ((sector >= mediaSectors) || ((mediaSectors - sector) < SYS_FS_MEDIA_MANAGER_READ_AHEAD_SECTORS))
+    {
+        return;
+    }
+
+    /* The media must hold the modified cached sectors of the window */
+    if (SYS_FS_MEDIA_T_MANAGER_CacheRangeWriteBack (mediaObj->mediaIndex, sector, SYS_FS_MEDIA_MANAGER_READ_AHEAD_SECTORS) == false)
+    {
+        return;
+    }
+
+    /* Set before the submission, the event may be raised from within it */
+    gSYSFSMediaReadAheadObj.commandStatus = SYS_FS_MEDIA_COMMAND_IN_PROGRESS;
+    gSYSFSMediaReadAheadObj.pending = buffer;
+
+    commandHandle = SYS_FS_MEDIA_T_MANAGER_SectorRead (mediaObj, buffer->data, sector, SYS_FS_MEDIA_MANAGER_READ_AHEAD_SECTORS);
+
+    if (commandHandle == SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE_INVALID)
+    {
+        /* For instance a window past the end of the media */
+        gSYSFSMediaReadAheadObj.pending = NULL;
+        return;
+    }
+
+    gSYSFSMediaCacheObj.statistics.readAheadFetches++;
+}
+
+/* Returns the buffer whose window holds a range of sectors of the streamed
+ * disk, valid or being read, or NULL */
+static SYS_FS_MEDIA_READ_AHEAD_BUFFER *SYS_FS_MEDIA_T_MANAGER_ReadAheadFind
+(
+    uint32_t sector,
+    uint32_t numSectors
+)
+{
+    SYS_FS_MEDIA_READ_AHEAD_BUFFER *buffer = NULL;
+    uint32_t index;
+
+    for (index = 0; index < 2U; index++)
+    {
+        buffer = &gSYSFSMediaReadAheadObj.buffers[index];
+
+        if (((buffer->valid == true) || (buffer == gSYSFSMediaReadAheadObj.pending)) &&
+            (sector >= buffer->startSector) &&
+            ((sector - buffer->startSector) <= (SYS_FS_MEDIA_MANAGER_READ_AHEAD_SECTORS - numSectors)))
+        {
+            return buffer;
+        }
+    }
+
+    return NULL;
+}
+
+/* Serves a read from the read-ahead windows. Returns false if the read has to
+ * be submitted to the media. */
+static bool SYS_FS_MEDIA_T_MANAGER_ReadAheadRead
+(
+    SYS_FS_MEDIA *mediaObj,
+    uint8_t *dataBuffer,
+    uint32_t sector,
+    uint32_t numSectors
+)
+{
+    SYS_FS_MEDIA_READ_AHEAD_BUFFER *buffer = NULL;
+    SYS_FS_MEDIA_READ_AHEAD_BUFFER *nextBuffer = NULL;
+    uint32_t nextWindow = 0;
+    bool isSequential = false;
+
+    if (gSYSFSMediaReadAheadObj.diskNum != mediaObj->mediaIndex)
+    {
+        /* Another disk is streamed from now on */
+        SYS_FS_MEDIA_T_MANAGER_ReadAheadSettle ();
+        SYS_FS_MEDIA_T_MANAGER_ReadAheadInvalidate (gSYSFSMediaReadAheadObj.diskNum, 0, 0);
+        gSYSFSMediaReadAheadObj.diskNum = mediaObj->mediaIndex;
+    }
+
+    isSequential = (sector == gSYSFSMediaReadAheadObj.nextSector);
+    gSYSFSMediaReadAheadObj.nextSector = sector + numSectors;
+
+    if (numSectors >= SYS_FS_MEDIA_MANAGER_READ_AHEAD_SECTORS)
+    {
+        /* Large reads are efficient on their own */
+        return false;
+    }
+
+    buffer = SYS_FS_MEDIA_T_MANAGER_ReadAheadFind (sector, numSectors);
+
+    if (buffer == NULL)
+    {
+        if (isSequential == false)
+        {
+            return false;
+        }
+
+        /* Second read of a sequence: start the stream at this sector */
+        SYS_FS_MEDIA_T_MANAGER_ReadAheadSettle ();
+        buffer = &gSYSFSMediaReadAheadObj.buffers[0];
+        SYS_FS_MEDIA_T_MANAGER_ReadAheadStart (mediaObj, buffer, sector);
+    }
+
+    if (buffer == gSYSFSMediaReadAheadObj.pending)
+    {
+        SYS_FS_MEDIA_T_MANAGER_ReadAheadSettle ();
+    }
+
+    if (buffer->valid == false)
+    {
+        return false;
+    }
+
+#if defined(SYS_DMA_MEM_QUEUE_SIZE)
+    (void) SYS_DMA_MemCopy ((void *)dataBuffer, (const void *)&buffer->data[(sector - buffer->startSector) << 9], numSectors << 9);
+#else
+    (void) memcpy ((void *)dataBuffer, (const void *)&buffer->data[(sector - buffer->startSector) << 9], numSectors << 9);
+#endif
+
+    gSYSFSMediaCacheObj.statistics.readAheadHits += numSectors;
+
+    /* Read the window following this one into the other buffer */
+    nextWindow = buffer->startSector + SYS_FS_MEDIA_MANAGER_READ_AHEAD_SECTORS;
+
+    if (buffer == &gSYSFSMediaReadAheadObj.buffers[0])
+    {
+        nextBuffer = &gSYSFSMediaReadAheadObj.buffers[1];
+    }
+    else
+    {
+        nextBuffer = &gSYSFSMediaReadAheadObj.buffers[0];
+    }
+
+    if (((nextBuffer->valid == false) && (nextBuffer != gSYSFSMediaReadAheadObj.pending)) ||
+        (nextBuffer->startSector != nextWindow))
+    {
+        SYS_FS_MEDIA_T_MANAGER_ReadAheadSettle ();
+        SYS_FS_MEDIA_T_MANAGER_ReadAheadStart (mediaObj, nextBuffer, nextWindow);
+    }
+
+    return true;
+}
+#endif
+
 //*****************************************************************************
 /* Function:
     SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE SYS_FS_MEDIA_MANAGER_SectorRead
@@ -723,8 +1825,6 @@ SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE SYS_FS_MEDIA_MANAGER_SectorRead
 )
 {
     SYS_FS_MEDIA *mediaObj = NULL;
-    uint32_t blocksPerSector = 0;
-    uint32_t mediaReadBlockSize = 0;
 
     if (diskNum >= SYS_FS_MEDIA_NUMBER)
     {
@@ -739,27 +1839,20 @@ SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE SYS_FS_MEDIA_MANAGER_SectorRead
         return SYS_FS_MEDIA_HANDLE_INVALID;
     }
 
-    mediaReadBlockSize = mediaObj->mediaGeometry->geometryTable[0].blockSize;
-
-    if (mediaReadBlockSize < 512U)
-    {
-        /* Find the number of blocks per sector */
-        blocksPerSector = 512U / mediaReadBlockSize;
-        /* Perform sector to block translation */
-        sector *= blocksPerSector;
-        numSectors *= blocksPerSector;
-    }
-    else
+#if defined(SYS_FS_MEDIA_MANAGER_READ_AHEAD_SECTORS)
+    if (SYS_FS_MEDIA_T_MANAGER_ReadAheadRead (mediaObj, dataBuffer, sector, numSectors) == true)
     {
-        /* TODO: Handle cases where the block size is greater than 512 bytes.
-         * */
+        return SYS_FS_MEDIA_T_MANAGER_CacheCommandComplete (mediaObj, true);
     }
 
+    SYS_FS_MEDIA_T_MANAGER_ReadAheadSettle ();
+#endif
 
-    mediaObj->commandStatus = SYS_FS_MEDIA_COMMAND_IN_PROGRESS;
-    mediaObj->driverFunctions->sectorRead (mediaObj->driverHandle, &(mediaObj->commandHandle), dataBuffer, sector, numSectors);
-
-    return (mediaObj->commandHandle);
+#if defined(SYS_FS_MEDIA_MANAGER_CACHE_SECTORS)
+    return SYS_FS_MEDIA_T_MANAGER_CacheRead (mediaObj, dataBuffer, sector, numSectors);
+#else
+    return SYS_FS_MEDIA_T_MANAGER_SectorRead (mediaObj, dataBuffer, sector, numSectors);
+#endif
 }
 
 //*****************************************************************************
@@ -813,6 +1906,10 @@ SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE SYS_FS_MEDIA_MANAGER_Read
     startAddress = mediaObj->driverFunctions->addressGet(mediaObj->driverHandle);
     address = (uint32_t)source - (uint32_t)startAddress;
 
+#if defined(SYS_FS_MEDIA_MANAGER_READ_AHEAD_SECTORS)
+    SYS_FS_MEDIA_T_MANAGER_ReadAheadSettle ();
+#endif
+
 
     mediaObj->commandStatus = SYS_FS_MEDIA_COMMAND_IN_PROGRESS;
     mediaObj->driverFunctions->Read(mediaObj->driverHandle, &(mediaObj->commandHandle), destination, address, nBytes);
@@ -851,14 +1948,6 @@ SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE SYS_FS_MEDIA_MANAGER_SectorWrite
 )
 {
     SYS_FS_MEDIA *mediaObj = NULL;
-    uint8_t *data = dataBuffer;
-    uint32_t sectorOffsetInBlock = 0;
-    uint32_t memoryBlock = 0;
-    uint32_t sectorsPerBlock = 0;
-    uint32_t numSectorsToWrite = 0;
-    uint32_t mediaWriteBlockSize = 0;
-    uint32_t blocksPerSector = 0;
-    uint32_t readSize = SYS_FS_MEDIA_MANAGER_BUFFER_SIZE;
 
     if(diskNum >= SYS_FS_MEDIA_NUMBER)
     {
@@ -873,132 +1962,16 @@ SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE SYS_FS_MEDIA_MANAGER_SectorWrite
         return SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE_INVALID;
     }
 
-    mediaWriteBlockSize = mediaObj->mediaGeometry->geometryTable[1].blockSize;
-
-    if (mediaWriteBlockSize > 512U)
-    {
-        sectorsPerBlock = mediaWriteBlockSize / 512U;
-    }
-    else if (mediaWriteBlockSize == 512U)
-    {
-        sectorsPerBlock = 1;
-        blocksPerSector = 1;
-    }
-    else
-    {
-        blocksPerSector = 512U / mediaWriteBlockSize;
-        sector *= blocksPerSector;
-        numSectors *= blocksPerSector;
-    }
-
-    if ((sectorsPerBlock == 1U) || (blocksPerSector > 0U))
-    {
-        mediaObj->commandStatus = SYS_FS_MEDIA_COMMAND_IN_PROGRESS;
-        mediaObj->driverFunctions->sectorWrite (mediaObj->driverHandle, &(mediaObj->commandHandle), dataBuffer, sector, numSectors);
-        return (mediaObj->commandHandle);
-    }
-    else
-    {
-        /* Mute the event notification */
-        gSYSFSMediaManagerObj.muteEventNotification = true;
-
-        while (numSectors > 0U)
-        {
-            /* Find the memory block for the starting sector */
-            memoryBlock = sector / sectorsPerBlock;
-
-            /* Find the number of sectors to be updated in this block. */
-            sectorOffsetInBlock = (sector % sectorsPerBlock);
-            numSectorsToWrite = (sectorsPerBlock - sectorOffsetInBlock);
-
-            if (numSectors < numSectorsToWrite)
-            {
-                numSectorsToWrite = numSectors;
-            }
-
-            if (numSectorsToWrite != sectorsPerBlock)
-            {
-                /* Read the memory block from the media. Update the media data. */
-                mediaObj->commandStatus = SYS_FS_MEDIA_COMMAND_IN_PROGRESS;
-
-                if (mediaWriteBlockSize < SYS_FS_MEDIA_MANAGER_BUFFER_SIZE)
-                {
-                    readSize = mediaWriteBlockSize;
-                }
-
-                mediaObj->driverFunctions->sectorRead(mediaObj->driverHandle, &(mediaObj->commandHandle), gSYSFSMediaBlockBuffer, memoryBlock * mediaWriteBlockSize, readSize);
-
-                while (mediaObj->commandStatus == SYS_FS_MEDIA_COMMAND_IN_PROGRESS)
-                {
-                    if(mediaObj->driverFunctions->tasks != NULL)
-                    {
-                        mediaObj->driverFunctions->tasks(mediaObj->driverObj);
-                    }
-                }
-
-                if (mediaObj->commandStatus != SYS_FS_MEDIA_COMMAND_COMPLETED)
-                {
-                    /* Unmute the event notification */
-                    gSYSFSMediaManagerObj.muteEventNotification = false;
-
-                    /* Media read operation failed. */
-                    return SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE_INVALID;
-                }
-
-                /* Multiply by the sector size */
-                sectorOffsetInBlock <<= 9;
-                (void) memcpy ((void *)&gSYSFSMediaBlockBuffer[sectorOffsetInBlock], (const void *)dataBuffer, numSectorsToWrite << 9);
-
-                data = gSYSFSMediaBlockBuffer;
-            }
-            else
-            {
-                /* Since the whole block is being updated, there is no need to
-                 * perform a read-modify-write operation of the block. */
-                data = dataBuffer;
-            }
-
-            if ((numSectors - numSectorsToWrite) == 0U)
-            {
-                /* This is the last write operation. */
-                break;
-            }
-
-            /* Write the block to the media */
-            mediaObj->commandStatus = SYS_FS_MEDIA_COMMAND_IN_PROGRESS;
-            mediaObj->driverFunctions->sectorWrite (mediaObj->driverHandle, &(mediaObj->commandHandle), data, memoryBlock, 1);
-            while (mediaObj->commandStatus == SYS_FS_MEDIA_COMMAND_IN_PROGRESS)
-            {
-                if(mediaObj->driverFunctions->tasks != NULL)
-                {
-                    mediaObj->driverFunctions->tasks(mediaObj->driverObj);
-                }
-            }
-
-            if (mediaObj->commandStatus != SYS_FS_MEDIA_COMMAND_COMPLETED)
-            {
-                /* Unmute the event notification */
-                gSYSFSMediaManagerObj.muteEventNotification = false;
-
-                /* Media write operation failed. */
-                return SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE_INVALID;
-            }
-
-            /* Update the number of block still to be written, sector address
-             * and the buffer pointer */
-            numSectors -= numSectorsToWrite;
-            sector += numSectorsToWrite;
-            dataBuffer += (numSectorsToWrite << 9);
-        }
-    }
-
-    /* Unmute the event notification */
-    gSYSFSMediaManagerObj.muteEventNotification = false;
-
-    mediaObj->commandStatus = SYS_FS_MEDIA_COMMAND_IN_PROGRESS;
-    mediaObj->driverFunctions->sectorWrite (mediaObj->driverHandle, &(mediaObj->commandHandle), data, memoryBlock, 1);
+#if defined(SYS_FS_MEDIA_MANAGER_READ_AHEAD_SECTORS)
+    SYS_FS_MEDIA_T_MANAGER_ReadAheadSettle ();
+    SYS_FS_MEDIA_T_MANAGER_ReadAheadInvalidate (diskNum, sector, numSectors);
+#endif
 
-    return (mediaObj->commandHandle);
+#if defined(SYS_FS_MEDIA_MANAGER_CACHE_SECTORS)
+    return SYS_FS_MEDIA_T_MANAGER_CacheWrite (mediaObj, sector, dataBuffer, numSectors);
+#else
+    return SYS_FS_MEDIA_T_MANAGER_SectorWrite (mediaObj, sector, dataBuffer, numSectors);
+#endif
 }
 
 //*****************************************************************************
@@ -1077,6 +2050,14 @@ SYS_FS_MEDIA_COMMAND_STATUS SYS_FS_MEDIA_MANAGER_CommandStatusGet
         return SYS_FS_MEDIA_COMMAND_UNKNOWN;
     }
 
+#if defined(SYS_FS_MEDIA_MANAGER_CACHE_SECTORS)
+    if (commandHandle == SYS_FS_MEDIA_MANAGER_CACHE_COMMAND_HANDLE)
+    {
+        /* The command was served by the sector cache */
+        return mediaObj->commandStatus;
+    }
+#endif
+
     return (mediaObj->driverFunctions->commandStatusGet(mediaObj->driverHandle, commandHandle));
 }
 
@@ -1242,6 +2223,14 @@ static void SYS_FS_MEDIA_MANAGER_EventHandler
     uintptr_t context
 )
 {
+#if defined(SYS_FS_MEDIA_MANAGER_READ_AHEAD_SECTORS)
+    if (SYS_FS_MEDIA_T_MANAGER_ReadAheadEvent (event, (SYS_FS_MEDIA*)context) == true)
+    {
+        /* The read-ahead command is not known to the upper layers */
+        return;
+    }
+#endif
+
     switch(event)
     {
         case SYS_FS_MEDIA_EVENT_BLOCK_COMMAND_COMPLETE:
@@ -1450,6 +2439,12 @@ void SYS_FS_MEDIA_MANAGER_Tasks
                         /* The media was earlier attached. But now it is
                          * detached. Handle the media detach. */
                         SYS_FS_MEDIA_T_MANAGER_HandleMediaDetach (mediaObj);
+#if defined(SYS_FS_MEDIA_MANAGER_CACHE_SECTORS)
+                        SYS_FS_MEDIA_T_MANAGER_CacheDiscard (mediaObj->mediaIndex);
+#endif
+#if defined(SYS_FS_MEDIA_MANAGER_READ_AHEAD_SECTORS)
+                        SYS_FS_MEDIA_T_MANAGER_ReadAheadDiscard (mediaObj->mediaIndex);
+#endif
 
                         /* Reset the media's number of volumes field */
                         mediaObj->numVolumes = 0;
@@ -1566,6 +2561,12 @@ void SYS_FS_MEDIA_MANAGER_Tasks
                     /* The media was earlier attached. But now it is
                      * detached. Handle the media detach. */
                     SYS_FS_MEDIA_T_MANAGER_HandleMediaDetach (mediaObj);
+#if defined(SYS_FS_MEDIA_MANAGER_CACHE_SECTORS)
+                    SYS_FS_MEDIA_T_MANAGER_CacheDiscard (mediaObj->mediaIndex);
+#endif
+#if defined(SYS_FS_MEDIA_MANAGER_READ_AHEAD_SECTORS)
+                    SYS_FS_MEDIA_T_MANAGER_ReadAheadDiscard (mediaObj->mediaIndex);
+#endif
                 }
 
                 mediaObj->inUse = false;
@@ -199,5 +199,160 @@ typedef struct SYS_FS_MEDIA_MANAGER_OBJ
 
 } SYS_FS_MEDIA_MANAGER_OBJ;
 
+#if defined(SYS_FS_MEDIA_MANAGER_CACHE_SECTORS)
+/* Handle returned for the commands completed by the sector cache without
+ * media access */
+#define SYS_FS_MEDIA_MANAGER_CACHE_COMMAND_HANDLE   ((SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE)0xFFFFFFFEU)
+
+// *****************************************************************************
+/* Sector cache entry
+
+  Summary:
+    Defines a sector held by the media manager sector cache.
+
+  Description:
+    This structure holds one 512 byte sector of a disk with its state.
+
+  Remarks:
+    None.
+*/
+typedef struct
+{
+    /* Sector data, first to keep it word aligned for the DMA */
+    uint8_t data[1U << SYS_FS_MEDIA_SHIFT_SECTOR_VALUE];
+
+    /* Sector number, in 512 byte sectors */
+    uint32_t sector;
+
+    /* Value of the use counter at the last access, for the LRU replacement */
+    uint32_t lastUse;
+
+    /* Disk number of the media */
+    uint16_t diskNum;
+
+    /* The entry holds the sector */
+    bool valid;
+
+    /* The sector was written and not yet saved to the media */
+    bool dirty;
+
+    /* The sector belongs to a pinned range and is not replaced */
+    bool pinned;
+
+} SYS_FS_MEDIA_CACHE_ENTRY;
+
+// *****************************************************************************
+/* Sector cache pinned range
+
+  Summary:
+    Defines the range of sectors of a volume kept in the cache.
+
+  Description:
+    numSectors is 0 when the volume has no pinned range.
+
+  Remarks:
+    None.
+*/
+typedef struct
+{
+    uint32_t startSector;
+
+    uint32_t numSectors;
+
+    uint16_t diskNum;
+
+} SYS_FS_MEDIA_CACHE_PIN;
+
+// *****************************************************************************
+/* Sector cache object
+
+  Summary:
+    Defines the object of the media manager sector cache.
+
+  Description:
+    This structure holds the cache entries, the pinned ranges and the
+    counters of the cache.
+
+  Remarks:
+    None.
+*/
+typedef struct
+{
+    SYS_FS_MEDIA_CACHE_ENTRY entries[SYS_FS_MEDIA_MANAGER_CACHE_SECTORS];
+
+    /* Pinned range of each volume */
+    SYS_FS_MEDIA_CACHE_PIN pins[SYS_FS_VOLUME_NUMBER];
+
+    SYS_FS_MEDIA_CACHE_STATISTICS statistics;
+
+    /* Incremented at each access of an entry */
+    uint32_t useCount;
+
+    /* Number of pinned entries */
+    uint32_t nPinned;
+
+} SYS_FS_MEDIA_CACHE_OBJ;
+#endif
+
+#if defined(SYS_FS_MEDIA_MANAGER_READ_AHEAD_SECTORS)
+// *****************************************************************************
+/* Read-ahead buffer
+
+  Summary:
+    Defines a window of sectors read ahead of a sequential reader.
+
+  Description:
+    This structure holds SYS_FS_MEDIA_MANAGER_READ_AHEAD_SECTORS consecutive
+    sectors of the disk being streamed.
+
+  Remarks:
+    None.
+*/
+typedef struct
+{
+    /* Sector data, first to keep it word aligned for the DMA */
+    uint8_t data[SYS_FS_MEDIA_MANAGER_READ_AHEAD_SECTORS << SYS_FS_MEDIA_SHIFT_SECTOR_VALUE];
+
+    /* First sector of the window, in 512 byte sectors */
+    uint32_t startSector;
+
+    /* The buffer holds the window */
+    bool valid;
+
+} SYS_FS_MEDIA_READ_AHEAD_BUFFER;
+
+// *****************************************************************************
+/* Read-ahead object
+
+  Summary:
+    Defines the object of the media manager read-ahead.
+
+  Description:
+    Two buffers are used: the reader consumes one while the next window is
+    read into the other. At most one read-ahead command is outstanding and it
+    ends before any other command is submitted to the media.
+
+  Remarks:
+    None.
+*/
+typedef struct
+{
+    SYS_FS_MEDIA_READ_AHEAD_BUFFER buffers[2];
+
+    /* Buffer of the outstanding read-ahead command, NULL if none */
+    SYS_FS_MEDIA_READ_AHEAD_BUFFER *pending;
+
+    /* Status of the outstanding read-ahead command */
+    SYS_FS_MEDIA_COMMAND_STATUS commandStatus;
+
+    /* Sector following the last read, to detect sequential reads */
+    uint32_t nextSector;
+
+    /* Disk number of the media being streamed */
+    uint16_t diskNum;
+
+} SYS_FS_MEDIA_READ_AHEAD_OBJ;
+#endif
+
 #endif
 
@@ -582,6 +582,12 @@ typedef struct
     /* Function pointer of native file system to get total sectors and free
      * sectors */
     int(*getCluster)(const char *path, uint32_t *tot_sec, uint32_t *free_sec);
+    /* Function pointer of native file system to build the cluster map of an
+     * open file for the fast seek */
+    int(*seekIndex)(uintptr_t handle, uint32_t *table, uint32_t tableSize);
+    /* Function pointer of native file system to validate the free cluster
+     * count one step at a time */
+    int(*freeScan)(const char *path, uint32_t *remaining);
 } SYS_FS_FUNCTIONS;
 
 // *****************************************************************************
@@ -2763,6 +2769,75 @@ SYS_FS_RESULT SYS_FS_FileTruncate
     SYS_FS_HANDLE handle
 );
 
+//******************************************************************************
+/* Function:
+    SYS_FS_RESULT SYS_FS_FileSeekIndexBuild
+    (
+        SYS_FS_HANDLE handle,
+        uint32_t *table,
+        uint32_t tableSize
+    );
+
+    Summary:
+      Builds the cluster map of an open file for the fast seek.
+
+    Description:
+      This function maps the cluster chain of the file into the table supplied
+      by the caller and attaches the table to the file. From then on,
+      SYS_FS_FileSeek, SYS_FS_FileRead and SYS_FS_FileWrite find the cluster
+      of any file position from the table instead of following the chain on
+      the media, so a seek costs no media read for the FAT.
+
+      The table holds one pair of items for each contiguous fragment of the
+      file, plus 2 items: a file of N fragments needs (2 * N) + 2 items. If the
+      table is too small, the function fails with SYS_FS_ERROR_NOT_ENOUGH_CORE
+      and table[0] holds the required number of items. Passing a NULL table
+      leaves the fast seek mode.
+
+    Precondition:
+      A valid file handle has to be passed as input to the function.
+
+    Parameters:
+      handle    - A valid handle which was obtained while opening the file.
+      table     - Table of tableSize items, owned by the caller. It must stay
+                  valid while the file is open or until the function is called
+                  again with a NULL table.
+      tableSize - Number of items of the table, at least 4.
+
+    Returns:
+      SYS_FS_RES_SUCCESS - The cluster map is attached to the file.
+      SYS_FS_RES_FAILURE - The cluster map was not built. The reason for the
+                           failure can be retrieved with SYS_FS_Error or
+                           SYS_FS_FileError.
+
+    Example:
+      <code>
+        uint32_t seekTable[32];
+
+        fileHandle = SYS_FS_FileOpen("/mnt/myDrive/LOG.bin", (SYS_FS_FILE_OPEN_READ));
+
+        if(fileHandle != SYS_FS_HANDLE_INVALID)
+        {
+            if(SYS_FS_FileSeekIndexBuild(fileHandle, seekTable, 32) == SYS_FS_RES_FAILURE)
+            {
+                
+            }
+        }
+      </code>
+
+    Remarks:
+      The file cannot grow while the table is attached: a write past the
+      clusters of the file stops short, as on a full volume. Build the table
+      once the file has reached its size.
+*/
+
+SYS_FS_RESULT SYS_FS_FileSeekIndexBuild
+(
+    SYS_FS_HANDLE handle,
+    uint32_t *table,
+    uint32_t tableSize
+);
+
 //******************************************************************************
 /* Function:
     SYS_FS_RESULT SYS_FS_FileSync
@@ -3722,7 +3797,11 @@ SYS_FS_RESULT SYS_FS_DrivePartition
       </code>
 
     Remarks:
-      None.
+      On FAT32 the free cluster count is read from the FSInfo sector. FAT12
+      and FAT16 volumes have no such sector: their count is kept in RAM
+      across remounts only, and is lost at reset or power off. The first
+      call after a reset then reads the whole FAT, unless the background
+      scan run by SYS_FS_Tasks has already gone through it.
 */
 
 SYS_FS_RESULT SYS_FS_DriveSectorGet
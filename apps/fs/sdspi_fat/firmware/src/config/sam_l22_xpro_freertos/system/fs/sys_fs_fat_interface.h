@@ -106,6 +106,10 @@ int FATFS_fdisk (uint8_t pdrv, const uint32_t ptbl[], void* work);
 
 int FATFS_getclusters (const char *path, uint32_t *tot_sec, uint32_t *free_sec);
 
+int FATFS_freescan (const char *path, uint32_t *remaining);
+
+int FATFS_linkmap (uintptr_t handle, uint32_t *table, uint32_t tableSize);
+
 
 #ifdef __cplusplus
 }
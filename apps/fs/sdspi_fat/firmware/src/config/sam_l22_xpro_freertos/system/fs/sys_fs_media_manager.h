@@ -400,6 +400,41 @@ typedef struct SYS_FS_VOLUME_PROPERTY_T
     SYS_FS_FILE_SYSTEM_TYPE fsType;
 } SYS_FS_VOLUME_PROPERTY;
 
+// *****************************************************************************
+/* Media sector cache statistics
+
+  Summary:
+    Counters of the media manager sector cache.
+
+  Description:
+    This structure is filled by SYS_FS_MEDIA_MANAGER_CacheStatisticsGet. Only
+    single sector reads and writes go through the cache; multi-sector
+    transfers are not counted. Reads served from the read-ahead buffers are
+    counted as read-ahead hits only.
+
+  Remarks:
+    None.
+*/
+typedef struct
+{
+    /* Sector reads served from the cache */
+    uint32_t readHits;
+    /* Sector reads that had to read the media */
+    uint32_t readMisses;
+    /* Sector writes to a sector already in the cache */
+    uint32_t writeHits;
+    /* Sector writes that took a new cache entry */
+    uint32_t writeMisses;
+    /* Valid entries replaced by another sector */
+    uint32_t evictions;
+    /* Modified sectors written to the media */
+    uint32_t writeBacks;
+    /* Sector reads served from the read-ahead buffers */
+    uint32_t readAheadHits;
+    /* Read-ahead windows read from the media */
+    uint32_t readAheadFetches;
+} SYS_FS_MEDIA_CACHE_STATISTICS;
+
 // *****************************************************************************
 
 // *****************************************************************************
@@ -969,6 +1004,147 @@ void SYS_FS_MEDIA_MANAGER_Tasks
     void
 );
 
+//*****************************************************************************
+/* Function:
+    bool SYS_FS_MEDIA_MANAGER_CacheFlush
+    (
+        uint16_t diskNum
+    );
+
+  Summary:
+    Writes the modified cached sectors of a disk to the media.
+
+  Description:
+    The media manager keeps the last SYS_FS_MEDIA_MANAGER_CACHE_SECTORS
+    sectors read or written one at a time. Writes only update the cache; the
+    modified sectors reach the media when their entry is reused or when this
+    function is called. The disk io layer calls it for the CTRL_SYNC request
+    of the file system, which is issued when a file is synced or closed.
+
+  Precondition:
+    None
+
+  Parameters:
+    diskNum - disk number of the media
+
+  Returns:
+    true - All the modified sectors of the disk have been written.
+    false - A media write failed; the sectors that could not be written stay
+    modified in the cache.
+
+  Remarks:
+    Available when SYS_FS_MEDIA_MANAGER_CACHE_SECTORS is defined. The function
+    blocks until the writes complete.
+*/
+bool SYS_FS_MEDIA_MANAGER_CacheFlush
+(
+    uint16_t diskNum
+);
+
+//*****************************************************************************
+/* Function:
+    void SYS_FS_MEDIA_MANAGER_CacheSectorsPin
+    (
+        uint8_t volIndex,
+        uint16_t diskNum,
+        uint32_t startSector,
+        uint32_t numSectors
+    );
+
+  Summary:
+    Keeps a range of sectors of a volume in the cache.
+
+  Description:
+    Cached sectors of the range are never replaced by other sectors, so the
+    FAT of a mounted volume stays in the cache while file data streams
+    through it. The FAT file system interface pins the FAT of each volume it
+    mounts. At most SYS_FS_MEDIA_MANAGER_CACHE_SECTORS - 1 entries are pinned
+    at a time; further sectors of the range are cached like any other.
+
+  Precondition:
+    None
+
+  Parameters:
+    volIndex - volume owning the range, a volume has one range
+    diskNum - disk number of the media holding the volume
+    startSector - first sector of the range
+    numSectors - number of sectors of the range, 0 to unpin the volume
+
+  Returns:
+    None.
+
+  Remarks:
+    Available when SYS_FS_MEDIA_MANAGER_CACHE_SECTORS is defined.
+*/
+void SYS_FS_MEDIA_MANAGER_CacheSectorsPin
+(
+    uint8_t volIndex,
+    uint16_t diskNum,
+    uint32_t startSector,
+    uint32_t numSectors
+);
+
+//*****************************************************************************
+/* Function:
+    void SYS_FS_MEDIA_MANAGER_CacheStatisticsGet
+    (
+        SYS_FS_MEDIA_CACHE_STATISTICS *statistics
+    );
+
+  Summary:
+    Returns the counters of the sector cache.
+
+  Description:
+    This function copies the counters accumulated since the start or since
+    the last SYS_FS_MEDIA_MANAGER_CacheStatisticsReset call.
+
+  Precondition:
+    None
+
+  Parameters:
+    statistics - pointer to the structure to fill
+
+  Returns:
+    None.
+
+  Remarks:
+    Available when SYS_FS_MEDIA_MANAGER_CACHE_SECTORS is defined.
+*/
+void SYS_FS_MEDIA_MANAGER_CacheStatisticsGet
+(
+    SYS_FS_MEDIA_CACHE_STATISTICS *statistics
+);
+
+//*****************************************************************************
+/* Function:
+    void SYS_FS_MEDIA_MANAGER_CacheStatisticsReset
+    (
+        void
+    );
+
+  Summary:
+    Clears the counters of the sector cache.
+
+  Description:
+    This function clears the counters without changing the cache content.
+
+  Precondition:
+    None
+
+  Parameters:
+    None.
+
+  Returns:
+    None.
+
+  Remarks:
+    Available when SYS_FS_MEDIA_MANAGER_CACHE_SECTORS is defined.
+*/
+void SYS_FS_MEDIA_MANAGER_CacheStatisticsReset
+(
+    void
+);
+
 extern const SYS_FS_MEDIA_MOUNT_DATA sysfsMountTable[];
 //DOM-IGNORE-BEGIN
 #ifdef __cplusplus
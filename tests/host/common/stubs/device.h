@@ -0,0 +1,19 @@
+/* Host stand-in for the device header. Only the toolchain helpers used by the
+ * sources under test are provided. */
+#ifndef DEVICE_H
+#define DEVICE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define CACHE_ALIGN
+#define CACHE_LINE_SIZE                 (16U)
+#define CACHE_ALIGNED_SIZE_GET(size)    (size)
+#define __STATIC_INLINE                 static inline
+#define __WEAK                          __attribute__((weak))
+#define __NOP()                         do { } while (0)
+#define __DMB()                         do { } while (0)
+#define __DSB()                         do { } while (0)
+
+#endif // DEVICE_H
@@ -0,0 +1,137 @@
+/* Host stand-in for the OSAL. Mutexes and semaphores are counters; a lock
+ * that would block fails instead, which is what a try-lock caller expects and
+ * what a test needs to detect a missing unlock. */
+#ifndef OSAL_H
+#define OSAL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include "device.h"
+
+typedef enum
+{
+    OSAL_RESULT_FAIL = 0,
+    OSAL_RESULT_FALSE = 0,
+    OSAL_RESULT_SUCCESS = 1,
+    OSAL_RESULT_TRUE = 1
+
+} OSAL_RESULT;
+
+typedef enum
+{
+    OSAL_SEM_TYPE_BINARY,
+    OSAL_SEM_TYPE_COUNTING
+
+} OSAL_SEM_TYPE;
+
+typedef enum
+{
+    OSAL_CRIT_TYPE_LOW,
+    OSAL_CRIT_TYPE_HIGH
+
+} OSAL_CRIT_TYPE;
+
+typedef uint8_t OSAL_SEM_HANDLE_TYPE;
+typedef uint8_t OSAL_MUTEX_HANDLE_TYPE;
+typedef uint32_t OSAL_TICK_TYPE;
+typedef uint8_t OSAL_SEM_COUNT_TYPE;
+typedef bool OSAL_CRITSECT_DATA_TYPE;
+
+#define OSAL_WAIT_FOREVER               (OSAL_TICK_TYPE)~0UL
+#define OSAL_NO_WAIT                    (OSAL_TICK_TYPE)0
+#define OSAL_SEM_DECLARE(semID)         OSAL_SEM_HANDLE_TYPE semID
+#define OSAL_MUTEX_DECLARE(mutexID)     OSAL_MUTEX_HANDLE_TYPE mutexID
+
+static inline OSAL_RESULT OSAL_MUTEX_Create( OSAL_MUTEX_HANDLE_TYPE *mutexID )
+{
+    *mutexID = 1U;
+    return OSAL_RESULT_SUCCESS;
+}
+
+static inline OSAL_RESULT OSAL_MUTEX_Delete( OSAL_MUTEX_HANDLE_TYPE *mutexID )
+{
+    *mutexID = 0U;
+    return OSAL_RESULT_SUCCESS;
+}
+
+static inline OSAL_RESULT OSAL_MUTEX_Lock( OSAL_MUTEX_HANDLE_TYPE *mutexID, OSAL_TICK_TYPE waitMS )
+{
+    (void) waitMS;
+
+    if (*mutexID == 1U)
+    {
+        *mutexID = 0U;
+        return OSAL_RESULT_SUCCESS;
+    }
+
+    return OSAL_RESULT_FAIL;
+}
+
+static inline OSAL_RESULT OSAL_MUTEX_Unlock( OSAL_MUTEX_HANDLE_TYPE *mutexID )
+{
+    *mutexID = 1U;
+    return OSAL_RESULT_SUCCESS;
+}
+
+static inline OSAL_RESULT OSAL_SEM_Create( OSAL_SEM_HANDLE_TYPE *semID, OSAL_SEM_TYPE type, OSAL_SEM_COUNT_TYPE maxCount, OSAL_SEM_COUNT_TYPE initialCount )
+{
+    (void) type;
+    (void) maxCount;
+    *semID = initialCount;
+    return OSAL_RESULT_SUCCESS;
+}
+
+static inline OSAL_RESULT OSAL_SEM_Delete( OSAL_SEM_HANDLE_TYPE *semID )
+{
+    *semID = 0U;
+    return OSAL_RESULT_SUCCESS;
+}
+
+static inline OSAL_RESULT OSAL_SEM_Pend( OSAL_SEM_HANDLE_TYPE *semID, OSAL_TICK_TYPE waitMS )
+{
+    (void) waitMS;
+
+    if (*semID > 0U)
+    {
+        (*semID)--;
+        return OSAL_RESULT_SUCCESS;
+    }
+
+    return OSAL_RESULT_FAIL;
+}
+
+static inline OSAL_RESULT OSAL_SEM_Post( OSAL_SEM_HANDLE_TYPE *semID )
+{
+    (*semID)++;
+    return OSAL_RESULT_SUCCESS;
+}
+
+static inline OSAL_RESULT OSAL_SEM_PostISR( OSAL_SEM_HANDLE_TYPE *semID )
+{
+    return OSAL_SEM_Post(semID);
+}
+
+static inline OSAL_CRITSECT_DATA_TYPE OSAL_CRIT_Enter( OSAL_CRIT_TYPE severity )
+{
+    (void) severity;
+    return true;
+}
+
+static inline void OSAL_CRIT_Leave( OSAL_CRIT_TYPE severity, OSAL_CRITSECT_DATA_TYPE status )
+{
+    (void) severity;
+    (void) status;
+}
+
+static inline void *OSAL_Malloc( size_t size )
+{
+    return malloc(size);
+}
+
+static inline void OSAL_Free( void *pData )
+{
+    free(pData);
+}
+
+#endif // OSAL_H
@@ -0,0 +1,22 @@
+/* Host stand-in for SYS_DEBUG. Messages are dropped. */
+#ifndef SYS_DEBUG_H
+#define SYS_DEBUG_H
+
+#include "system/system.h"
+
+typedef enum
+{
+    SYS_ERROR_FATAL = 0,
+    SYS_ERROR_ERROR = 1,
+    SYS_ERROR_WARNING = 2,
+    SYS_ERROR_INFO = 3,
+    SYS_ERROR_DEBUG = 4
+
+} SYS_ERROR_LEVEL;
+
+#define SYS_DEBUG_MESSAGE(level, message)       do { } while (0)
+#define SYS_DEBUG_PRINT(level, ...)             do { } while (0)
+#define SYS_CONSOLE_MESSAGE(message)            do { } while (0)
+#define SYS_CONSOLE_PRINT(...)                  do { } while (0)
+
+#endif // SYS_DEBUG_H
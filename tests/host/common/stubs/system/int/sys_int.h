@@ -0,0 +1,44 @@
+/* Host stand-in for SYS_INT. The tests are single threaded; "interrupt"
+ * handlers are called from the test loop, so masking is a no-op that only
+ * tracks the nesting for checks. */
+#ifndef SYS_INT_H
+#define SYS_INT_H
+
+#include <stdbool.h>
+#include "device.h"
+
+typedef int IRQn_Type;
+typedef IRQn_Type INT_SOURCE;
+
+extern unsigned int gSysIntDisableDepth;
+
+static inline bool SYS_INT_Disable( void )
+{
+    gSysIntDisableDepth++;
+    return true;
+}
+
+static inline void SYS_INT_Restore( bool state )
+{
+    (void) state;
+    gSysIntDisableDepth--;
+}
+
+static inline bool SYS_INT_SourceDisable( IRQn_Type source )
+{
+    (void) source;
+    return true;
+}
+
+static inline void SYS_INT_SourceRestore( IRQn_Type source, bool status )
+{
+    (void) source;
+    (void) status;
+}
+
+static inline void SYS_INT_SourceEnable( IRQn_Type source )
+{
+    (void) source;
+}
+
+#endif // SYS_INT_H
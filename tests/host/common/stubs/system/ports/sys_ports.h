@@ -0,0 +1,17 @@
+/* Host stand-in for SYS_PORTS. Pin writes are forwarded to the test, which
+ * decides what a pin is connected to. */
+#ifndef SYS_PORTS_H
+#define SYS_PORTS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef uint32_t SYS_PORT_PIN;
+
+#define SYS_PORT_PIN_NONE               ((SYS_PORT_PIN)0xFFFFU)
+
+void SYS_PORT_PinSet( SYS_PORT_PIN pin );
+void SYS_PORT_PinClear( SYS_PORT_PIN pin );
+
+#endif // SYS_PORTS_H
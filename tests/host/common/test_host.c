@@ -0,0 +1,17 @@
+/*******************************************************************************
+  Host Test Support
+
+  File Name:
+    test_host.c
+
+  Summary:
+    Globals shared by the host-side tests and the stub headers.
+*******************************************************************************/
+
+#include "test_host.h"
+
+/* Number of failed checks of the test program */
+unsigned int gTestFailures = 0U;
+
+/* Nesting depth of SYS_INT_Disable() in the stub SYS_INT */
+unsigned int gSysIntDisableDepth = 0U;
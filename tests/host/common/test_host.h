@@ -0,0 +1,53 @@
+/*******************************************************************************
+  Host Test Support
+
+  File Name:
+    test_host.h
+
+  Summary:
+    Check macros shared by the host-side tests.
+
+  Description:
+    The host tests build firmware sources with the native compiler against
+    small stub headers. A test reports each failed check and returns the
+    number of failures from main(), so that make stops on the first failing
+    test program.
+*******************************************************************************/
+
+#ifndef TEST_HOST_H
+#define TEST_HOST_H
+
+#include <stdio.h>
+
+extern unsigned int gTestFailures;
+
+#define TEST_CHECK(cond)                                                        \
+    do                                                                          \
+    {                                                                           \
+        if (!(cond))                                                            \
+        {                                                                       \
+            gTestFailures++;                                                    \
+            (void) printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+        }                                                                       \
+    } while (0)
+
+#define TEST_CHECK_EQUAL(actual, expected)                                      \
+    do                                                                          \
+    {                                                                           \
+        unsigned long long testActual = (unsigned long long)(actual);           \
+        unsigned long long testExpected = (unsigned long long)(expected);       \
+        if (testActual != testExpected)                                         \
+        {                                                                       \
+            gTestFailures++;                                                    \
+            (void) printf("%s:%d: %s is %llu, expected %llu\n", __FILE__, __LINE__, \
+                    #actual, testActual, testExpected);                         \
+        }                                                                       \
+    } while (0)
+
+/* Prints the verdict and yields the exit status of the test program */
+#define TEST_RESULT(name)                                                       \
+    ((gTestFailures == 0U) ?                                                    \
+        ((void) printf("%s: PASS\n", (name)), 0) :                              \
+        ((void) printf("%s: FAIL (%u)\n", (name), gTestFailures), 1))
+
+#endif // TEST_HOST_H
@@ -0,0 +1,16 @@
+/* Configuration of the DMA CRC host test: the channel pool and the CRC
+ * service of the nvm_fat application. The memory service is left out. */
+#ifndef CONFIGURATION_H
+#define CONFIGURATION_H
+
+#include "device.h"
+
+/* DMA Channel Pool Configuration */
+#define SYS_DMA_CHANNEL_POOL_FIRST        SYS_DMA_CHANNEL_2
+#define SYS_DMA_CHANNEL_POOL_SIZE         (2U)
+
+/* DMA CRC Service Configuration */
+#define SYS_DMA_CRC_QUEUE_SIZE            (4U)
+#define SYS_DMA_CRC_PRIORITY              SYS_DMA_PRIORITY_LEVEL_0
+
+#endif // CONFIGURATION_H
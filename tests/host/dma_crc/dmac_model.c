@@ -0,0 +1,253 @@
+/*******************************************************************************
+  DMAC Model
+
+  File Name:
+    dmac_model.c
+
+  Summary:
+    DMAC PLIB functions of SYS_DMA backed by a model of the DMAC.
+*******************************************************************************/
+
+#include <string.h>
+#include "dmac_model.h"
+
+/* Beat size field of BTCTRL, as set by SYS_DMA_DataWidthSetup */
+#define DMAC_MODEL_BEATSIZE_Msk         (0x300U)
+#define DMAC_MODEL_BEATSIZE_Pos         (8U)
+
+/* Largest block transfer count */
+#define DMAC_MODEL_BTCNT_MAX            (0xFFFFU)
+
+DMAC_MODEL gDmacModel;
+
+static uint32_t dmacModelCRC32Table[256];
+static uint16_t dmacModelCRC16Table[256];
+
+static void lDMAC_MODEL_TablesBuild(void)
+{
+    uint32_t i;
+    uint32_t bit;
+    uint32_t crc32;
+    uint32_t crc16;
+
+    for (i = 0U; i < 256U; i++)
+    {
+        crc32 = i;
+        crc16 = i << 8;
+
+        for (bit = 0U; bit < 8U; bit++)
+        {
+            crc32 = ((crc32 & 1U) != 0U) ? ((crc32 >> 1) ^ 0xEDB88320U) : (crc32 >> 1);
+            crc16 = ((crc16 & 0x8000U) != 0U) ? ((crc16 << 1) ^ 0x1021U) : (crc16 << 1);
+        }
+
+        dmacModelCRC32Table[i] = crc32;
+        dmacModelCRC16Table[i] = (uint16_t)crc16;
+    }
+}
+
+static void lDMAC_MODEL_CRCByte(uint8_t data)
+{
+    uint32_t crc = gDmacModel.checksum;
+
+    if (gDmacModel.crcType == DMAC_CRC_TYPE_32)
+    {
+        crc = (crc >> 8) ^ dmacModelCRC32Table[(crc ^ data) & 0xFFU];
+    }
+    else
+    {
+        crc = ((crc << 8) ^ dmacModelCRC16Table[((crc >> 8) ^ data) & 0xFFU]) & 0xFFFFU;
+    }
+
+    gDmacModel.checksum = crc;
+}
+
+void DMAC_MODEL_Reset(void)
+{
+    (void) memset(&gDmacModel, 0, sizeof(gDmacModel));
+
+    gDmacModel.crcChannel = -1;
+
+    lDMAC_MODEL_TablesBuild();
+}
+
+uint32_t DMAC_MODEL_Service(void)
+{
+    DMAC_MODEL_CHANNEL *channel;
+    uint32_t beatSize;
+    uint32_t nBlocks = 0U;
+    uint32_t index;
+    size_t i;
+
+    for (index = 0U; index < DMAC_CHANNELS_NUMBER; index++)
+    {
+        channel = &gDmacModel.channel[index];
+
+        if (channel->isBusy == false)
+        {
+            continue;
+        }
+
+        beatSize = 1U << ((channel->settings & DMAC_MODEL_BEATSIZE_Msk) >> DMAC_MODEL_BEATSIZE_Pos);
+
+        if ((channel->blockSize / beatSize) > DMAC_MODEL_BTCNT_MAX)
+        {
+            gDmacModel.errBlockTooLong++;
+        }
+
+        /* Beats go through the CRC engine in memory order, which is the
+         * little endian order of the bytes of a beat */
+        if ((gDmacModel.isCRCEnabled == true) && (gDmacModel.crcChannel == (int32_t)index))
+        {
+            for (i = 0U; i < channel->blockSize; i++)
+            {
+                lDMAC_MODEL_CRCByte(channel->source[i]);
+            }
+        }
+
+        channel->isBusy = false;
+        channel->nBlocks++;
+        nBlocks++;
+
+        if (channel->callback != NULL)
+        {
+            channel->callback(DMAC_TRANSFER_EVENT_COMPLETE, channel->context);
+        }
+    }
+
+    return nBlocks;
+}
+
+uint32_t DMAC_MODEL_ChannelsInUse(void)
+{
+    uint32_t nChannels = 0U;
+    uint32_t index;
+
+    for (index = 0U; index < DMAC_CHANNELS_NUMBER; index++)
+    {
+        if (gDmacModel.channel[index].isSetup == true)
+        {
+            nChannels++;
+        }
+    }
+
+    return nChannels;
+}
+
+void DMAC_ChannelCallbackRegister(DMAC_CHANNEL channel, const DMAC_CHANNEL_CALLBACK eventHandler, const uintptr_t contextHandle)
+{
+    gDmacModel.channel[channel].callback = eventHandler;
+    gDmacModel.channel[channel].context = contextHandle;
+}
+
+void DMAC_ChannelSetup(DMAC_CHANNEL channel, uint32_t triggerSource, uint32_t priorityLevel)
+{
+    gDmacModel.channel[channel].isSetup = true;
+    gDmacModel.channel[channel].settings = 0U;
+}
+
+void DMAC_ChannelFree(DMAC_CHANNEL channel)
+{
+    gDmacModel.channel[channel].isSetup = false;
+    gDmacModel.channel[channel].isBusy = false;
+    gDmacModel.channel[channel].callback = NULL;
+}
+
+bool DMAC_ChannelTransfer(DMAC_CHANNEL channel, const void *srcAddr, const void *destAddr, size_t blockSize)
+{
+    DMAC_MODEL_CHANNEL *channelObj = &gDmacModel.channel[channel];
+
+    if (channelObj->isSetup == false)
+    {
+        gDmacModel.errTransferUnallocated++;
+        return false;
+    }
+
+    if (channelObj->isBusy == true)
+    {
+        gDmacModel.errTransferBusy++;
+        return false;
+    }
+
+    channelObj->source = (const uint8_t *)srcAddr;
+    channelObj->blockSize = blockSize;
+    channelObj->isBusy = true;
+
+    return true;
+}
+
+bool DMAC_ChannelIsBusy(DMAC_CHANNEL channel)
+{
+    return gDmacModel.channel[channel].isBusy;
+}
+
+void DMAC_ChannelDisable(DMAC_CHANNEL channel)
+{
+    gDmacModel.channel[channel].isBusy = false;
+}
+
+DMAC_CHANNEL_CONFIG DMAC_ChannelSettingsGet(DMAC_CHANNEL channel)
+{
+    return gDmacModel.channel[channel].settings;
+}
+
+bool DMAC_ChannelSettingsSet(DMAC_CHANNEL channel, DMAC_CHANNEL_CONFIG settings)
+{
+    gDmacModel.channel[channel].settings = settings;
+
+    return true;
+}
+
+void DMAC_ChannelCRCSetup(DMAC_CHANNEL channel, DMAC_CRC_SETUP CRCSetup)
+{
+    /* As the PLIB, the engine is disabled first. Setting it up while another
+     * user still has it enabled is a usage error of the callers. */
+    if (gDmacModel.isCRCEnabled == true)
+    {
+        gDmacModel.errCRCSetupWhileEnabled++;
+    }
+
+    if (gDmacModel.channel[channel].isBusy == true)
+    {
+        gDmacModel.errCRCSetupChannelBusy++;
+    }
+
+    gDmacModel.checksum = CRCSetup.seed;
+    gDmacModel.crcType = CRCSetup.polynomial_type;
+    gDmacModel.crcChannel = (int32_t)channel;
+    gDmacModel.isCRCEnabled = true;
+}
+
+uint32_t DMAC_CRCRead(void)
+{
+    return gDmacModel.checksum;
+}
+
+uint32_t DMAC_CRCCalculate(void *buffer, uint32_t length, DMAC_CRC_SETUP CRCSetup)
+{
+    const uint8_t *data = (const uint8_t *)buffer;
+    uint32_t i;
+
+    if (gDmacModel.isCRCEnabled == true)
+    {
+        gDmacModel.errCRCSetupWhileEnabled++;
+    }
+
+    gDmacModel.checksum = CRCSetup.seed;
+    gDmacModel.crcType = CRCSetup.polynomial_type;
+    gDmacModel.crcChannel = -1;
+
+    for (i = 0U; i < length; i++)
+    {
+        lDMAC_MODEL_CRCByte(data[i]);
+    }
+
+
+    return gDmacModel.checksum;
+}
+
+void DMAC_CRCDisable(void)
+{
+    gDmacModel.isCRCEnabled = false;
+    gDmacModel.crcChannel = -1;
+}
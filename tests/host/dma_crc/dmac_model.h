@@ -0,0 +1,72 @@
+/*******************************************************************************
+  DMAC Model
+
+  File Name:
+    dmac_model.h
+
+  Summary:
+    Model of the DMAC channels and CRC engine used by the SYS_DMA CRC service.
+
+  Description:
+    A block transfer started on a channel stays pending until the test calls
+    DMAC_MODEL_Service, which moves it beat by beat with the beat size of the
+    channel settings and feeds the beats to the CRC engine when the engine is
+    attached to that channel. The CRC engine is an independent table-driven
+    implementation: CRC-CCITT MSB first and reflected IEEE 802.3 CRC32, the
+    checksum register holding the running value without final XOR. The model
+    also checks the channel and CRC engine usage rules of the PLIB.
+*******************************************************************************/
+
+#ifndef DMAC_MODEL_H
+#define DMAC_MODEL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "peripheral/dmac/plib_dmac.h"
+
+typedef struct
+{
+    bool isSetup;
+    bool isBusy;
+    DMAC_CHANNEL_CONFIG settings;
+    DMAC_CHANNEL_CALLBACK callback;
+    uintptr_t context;
+
+    const uint8_t *source;
+    size_t blockSize;
+
+    uint32_t nBlocks;
+
+} DMAC_MODEL_CHANNEL;
+
+typedef struct
+{
+    DMAC_MODEL_CHANNEL channel[DMAC_CHANNELS_NUMBER];
+
+    /* CRC engine: CTRL.CRCENABLE, CRCCTRL.CRCSRC and CRCPOLY, CRCCHKSUM */
+    bool isCRCEnabled;
+    int32_t crcChannel;
+    DMAC_CRC_POLYNOMIAL_TYPE crcType;
+    uint32_t checksum;
+
+    /* Usage errors */
+    uint32_t errTransferUnallocated;
+    uint32_t errTransferBusy;
+    uint32_t errBlockTooLong;
+    uint32_t errCRCSetupWhileEnabled;
+    uint32_t errCRCSetupChannelBusy;
+
+} DMAC_MODEL;
+
+extern DMAC_MODEL gDmacModel;
+
+void DMAC_MODEL_Reset(void);
+
+/* Completes the pending block of every busy channel, calling the channel
+ * callbacks as the DMAC interrupt does. Returns the number of blocks done. */
+uint32_t DMAC_MODEL_Service(void);
+
+/* Number of channels currently set up */
+uint32_t DMAC_MODEL_ChannelsInUse(void);
+
+#endif // DMAC_MODEL_H
@@ -0,0 +1,24 @@
+/* Host stand-in for the device header. Adds the DMAC descriptor type, which
+ * SYS_DMA takes from the device header, to the common helpers. */
+#ifndef DEVICE_H
+#define DEVICE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define CACHE_ALIGN
+#define CACHE_LINE_SIZE                 (16U)
+#define CACHE_ALIGNED_SIZE_GET(size)    (size)
+#define __STATIC_INLINE                 static inline
+#define __NOP()                         do { } while (0)
+#define __DMB()                         do { } while (0)
+#define __DSB()                         do { } while (0)
+
+typedef struct
+{
+    uint16_t BTCTRL;
+
+} dmac_descriptor_registers_t;
+
+#endif // DEVICE_H
@@ -0,0 +1,63 @@
+/* Host stand-in for the DMAC PLIB used by SYS_DMA. The functions are
+ * implemented by the DMAC model of the test (dmac_model.c). */
+#ifndef PLIB_DMAC_H
+#define PLIB_DMAC_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define DMAC_IRQn                       (6)
+
+#define DMAC_CHANNELS_NUMBER            (4U)
+
+typedef enum
+{
+    DMAC_CHANNEL_0 = 0,
+    DMAC_CHANNEL_1 = 1,
+    DMAC_CHANNEL_2 = 2,
+    DMAC_CHANNEL_3 = 3,
+
+} DMAC_CHANNEL;
+
+typedef enum
+{
+    DMAC_TRANSFER_EVENT_NONE = 0,
+    DMAC_TRANSFER_EVENT_COMPLETE = 1,
+    DMAC_TRANSFER_EVENT_ERROR = 2
+
+} DMAC_TRANSFER_EVENT;
+
+typedef enum
+{
+    DMAC_CRC_TYPE_16 = 0x0,
+    DMAC_CRC_TYPE_32 = 0x1
+
+} DMAC_CRC_POLYNOMIAL_TYPE;
+
+typedef struct
+{
+    DMAC_CRC_POLYNOMIAL_TYPE polynomial_type;
+
+    uint32_t seed;
+
+} DMAC_CRC_SETUP;
+
+typedef uint32_t DMAC_CHANNEL_CONFIG;
+
+typedef void (*DMAC_CHANNEL_CALLBACK) (DMAC_TRANSFER_EVENT event, uintptr_t contextHandle);
+
+void DMAC_ChannelCallbackRegister (DMAC_CHANNEL channel, const DMAC_CHANNEL_CALLBACK eventHandler, const uintptr_t contextHandle);
+void DMAC_ChannelSetup ( DMAC_CHANNEL channel, uint32_t triggerSource, uint32_t priorityLevel );
+void DMAC_ChannelFree ( DMAC_CHANNEL channel );
+bool DMAC_ChannelTransfer (DMAC_CHANNEL channel, const void *srcAddr, const void *destAddr, size_t blockSize);
+bool DMAC_ChannelIsBusy ( DMAC_CHANNEL channel );
+void DMAC_ChannelDisable ( DMAC_CHANNEL channel );
+DMAC_CHANNEL_CONFIG DMAC_ChannelSettingsGet ( DMAC_CHANNEL channel );
+bool DMAC_ChannelSettingsSet ( DMAC_CHANNEL channel, DMAC_CHANNEL_CONFIG settings );
+void DMAC_ChannelCRCSetup(DMAC_CHANNEL channel, DMAC_CRC_SETUP CRCSetup);
+uint32_t DMAC_CRCRead( void );
+uint32_t DMAC_CRCCalculate(void *buffer, uint32_t length, DMAC_CRC_SETUP CRCSetup);
+void DMAC_CRCDisable( void );
+
+#endif // PLIB_DMAC_H
@@ -0,0 +1,309 @@
+/*******************************************************************************
+  DMA CRC Host Test
+
+  File Name:
+    test_dma_crc.c
+
+  Summary:
+    Runs the SYS_DMA CRC service and SYS_DMA_CRCReferenceCalculate against a
+    model of the DMAC.
+
+  Description:
+    SYS_DMA is the firmware source of the nvm_fat application. The software
+    reference is checked against the standard check values, then each
+    request of the CRC service is compared with the reference: every beat
+    width, requests longer than one DMA block, a full queue, a request queued
+    from a callback and a CRC engine owned by another user. The DMAC model
+    computes the CRC with its own table-driven implementation, checks the
+    channel and CRC engine usage, and the test checks that the service gives
+    the channel and the engine back when its queue is empty.
+*******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "configuration.h"
+#include "test_host.h"
+#include "dmac_model.h"
+#include "system/int/sys_int.h"
+#include "system/dma/sys_dma.h"
+
+#define TEST_BUFFER_SIZE            (300004U)
+#define TEST_MAX_STEPS              (100U)
+
+static uint8_t testBuffer[TEST_BUFFER_SIZE];
+
+static const SYS_DMA_CRC_SETUP testCRC16 = {SYS_DMA_CRC_TYPE_16, 0xFFFFU};
+static const SYS_DMA_CRC_SETUP testCRC32 = {SYS_DMA_CRC_TYPE_32, 0xFFFFFFFFU};
+
+// *****************************************************************************
+// Section: Request results
+// *****************************************************************************
+
+#define TEST_RESULTS_MAX            (8U)
+
+static struct
+{
+    uint32_t crc[TEST_RESULTS_MAX];
+    SYS_DMA_TRANSFER_EVENT event[TEST_RESULTS_MAX];
+    uintptr_t context[TEST_RESULTS_MAX];
+    uint32_t nResults;
+
+    /* Request queued by testChainCallback */
+    const uint8_t *chainBuffer;
+    size_t chainLength;
+    bool isChainQueued;
+
+} testResults;
+
+static void testCallback(SYS_DMA_TRANSFER_EVENT event, uint32_t crc, uintptr_t context)
+{
+    if (testResults.nResults < TEST_RESULTS_MAX)
+    {
+        testResults.crc[testResults.nResults] = crc;
+        testResults.event[testResults.nResults] = event;
+        testResults.context[testResults.nResults] = context;
+    }
+
+    testResults.nResults++;
+}
+
+static void testChainCallback(SYS_DMA_TRANSFER_EVENT event, uint32_t crc, uintptr_t context)
+{
+    testCallback(event, crc, context);
+
+    testResults.isChainQueued = SYS_DMA_CRCRequestAdd(testResults.chainBuffer, testResults.chainLength,
+            testCRC32, testCallback, context + 1U);
+}
+
+static void testResultsClear(void)
+{
+    (void) memset(&testResults, 0, sizeof(testResults));
+}
+
+/* Runs the DMAC until the service has no request left. Returns the number of
+ * blocks moved. */
+static uint32_t testRun(void)
+{
+    uint32_t nBlocks = 0U;
+    uint32_t step;
+    uint32_t nDone;
+
+    for (step = 0U; step < TEST_MAX_STEPS; step++)
+    {
+        nDone = DMAC_MODEL_Service();
+
+        if (nDone == 0U)
+        {
+            break;
+        }
+
+        nBlocks += nDone;
+    }
+
+    return nBlocks;
+}
+
+/* The service must have given the channel and the CRC engine back */
+static void testIdleCheck(void)
+{
+    TEST_CHECK_EQUAL(DMAC_MODEL_ChannelsInUse(), 0U);
+    TEST_CHECK(gDmacModel.isCRCEnabled == false);
+
+    TEST_CHECK(SYS_DMA_CRCEngineAcquire() == true);
+    SYS_DMA_CRCEngineRelease();
+}
+
+// *****************************************************************************
+// Section: Tests
+// *****************************************************************************
+
+static void testReference(void)
+{
+    static const uint8_t checkData[] = "123456789";
+    DMAC_CRC_SETUP dmacCRC16 = {DMAC_CRC_TYPE_16, 0xFFFFU};
+    DMAC_CRC_SETUP dmacCRC32 = {DMAC_CRC_TYPE_32, 0xFFFFFFFFU};
+
+    /* CRC-16/CCITT-FALSE and the complement of the IEEE 802.3 CRC32 */
+    TEST_CHECK_EQUAL(SYS_DMA_CRCReferenceCalculate(checkData, 9U, testCRC16), 0x29B1U);
+    TEST_CHECK_EQUAL(SYS_DMA_CRCReferenceCalculate(checkData, 9U, testCRC32), ~0xCBF43926U);
+
+    /* The model engine agrees with the standard values */
+    TEST_CHECK_EQUAL(DMAC_CRCCalculate((void *)checkData, 9U, dmacCRC16), 0x29B1U);
+    TEST_CHECK_EQUAL(DMAC_CRCCalculate((void *)checkData, 9U, dmacCRC32), ~0xCBF43926U);
+
+    TEST_CHECK_EQUAL(SYS_DMA_CRCReferenceCalculate(testBuffer, TEST_BUFFER_SIZE, testCRC32),
+            DMAC_CRCCalculate(testBuffer, TEST_BUFFER_SIZE, dmacCRC32));
+}
+
+typedef struct
+{
+    size_t offset;
+    size_t length;
+    /* Blocks the request takes: 65535 beats each */
+    uint32_t nBlocks;
+
+} TEST_SINGLE_REQUEST;
+
+static void testSingleRequests(void)
+{
+    static const TEST_SINGLE_REQUEST requests[] =
+    {
+        { 0U, 4096U, 1U },                  /* 32-bit beats */
+        { 2U, 1000U, 1U },                  /* 16-bit beats */
+        { 1U, 777U, 1U },                   /* 8-bit beats */
+        { 3U, 1U, 1U },
+        { 0U, 65535U * 4U, 1U },            /* One full 32-bit block */
+        { 0U, 300000U, 2U },
+        { 2U, 65535U * 2U + 2U, 2U },
+        { 1U, 70001U, 2U },
+        { 1U, 3U * 65535U, 3U },
+    };
+    const SYS_DMA_CRC_SETUP *setup;
+    uint32_t i;
+    uint32_t type;
+    uint32_t nBlocks;
+
+    for (i = 0U; i < (sizeof(requests) / sizeof(requests[0])); i++)
+    {
+        for (type = 0U; type < 2U; type++)
+        {
+            setup = (type == 0U) ? &testCRC16 : &testCRC32;
+
+            testResultsClear();
+
+            TEST_CHECK(SYS_DMA_CRCRequestAdd(&testBuffer[requests[i].offset], requests[i].length,
+                    *setup, testCallback, i) == true);
+
+            nBlocks = testRun();
+
+            TEST_CHECK_EQUAL(nBlocks, requests[i].nBlocks);
+            TEST_CHECK_EQUAL(testResults.nResults, 1U);
+            TEST_CHECK_EQUAL(testResults.event[0], SYS_DMA_TRANSFER_COMPLETE);
+            TEST_CHECK_EQUAL(testResults.context[0], i);
+            TEST_CHECK_EQUAL(testResults.crc[0],
+                    SYS_DMA_CRCReferenceCalculate(&testBuffer[requests[i].offset], requests[i].length, *setup));
+
+            testIdleCheck();
+        }
+    }
+
+    /* Invalid requests */
+    TEST_CHECK(SYS_DMA_CRCRequestAdd(NULL, 16U, testCRC32, testCallback, 0U) == false);
+    TEST_CHECK(SYS_DMA_CRCRequestAdd(testBuffer, 0U, testCRC32, testCallback, 0U) == false);
+    testIdleCheck();
+}
+
+static void testQueue(void)
+{
+    const SYS_DMA_CRC_SETUP *setup;
+    uint32_t i;
+
+    testResultsClear();
+
+    /* The queue holds SYS_DMA_CRC_QUEUE_SIZE requests of mixed types */
+    for (i = 0U; i < SYS_DMA_CRC_QUEUE_SIZE; i++)
+    {
+        setup = ((i & 1U) == 0U) ? &testCRC32 : &testCRC16;
+
+        TEST_CHECK(SYS_DMA_CRCRequestAdd(&testBuffer[i * 1000U + i], 5000U + i, *setup, testCallback, i) == true);
+    }
+
+    TEST_CHECK(SYS_DMA_CRCRequestAdd(testBuffer, 64U, testCRC32, testCallback, 99U) == false);
+    TEST_CHECK_EQUAL(DMAC_MODEL_ChannelsInUse(), 1U);
+
+    (void) testRun();
+
+    TEST_CHECK_EQUAL(testResults.nResults, SYS_DMA_CRC_QUEUE_SIZE);
+
+    for (i = 0U; i < SYS_DMA_CRC_QUEUE_SIZE; i++)
+    {
+        setup = ((i & 1U) == 0U) ? &testCRC32 : &testCRC16;
+
+        TEST_CHECK_EQUAL(testResults.context[i], i);
+        TEST_CHECK_EQUAL(testResults.event[i], SYS_DMA_TRANSFER_COMPLETE);
+        TEST_CHECK_EQUAL(testResults.crc[i],
+                SYS_DMA_CRCReferenceCalculate(&testBuffer[i * 1000U + i], 5000U + i, *setup));
+    }
+
+    testIdleCheck();
+}
+
+static void testChain(void)
+{
+    testResultsClear();
+
+    testResults.chainBuffer = &testBuffer[12345U];
+    testResults.chainLength = 4321U;
+
+    /* The last request of a burst completes with the queue empty: the
+     * callback starts a new burst */
+    TEST_CHECK(SYS_DMA_CRCRequestAdd(testBuffer, 100U, testCRC16, testChainCallback, 10U) == true);
+
+    (void) testRun();
+
+    TEST_CHECK(testResults.isChainQueued == true);
+    TEST_CHECK_EQUAL(testResults.nResults, 2U);
+    TEST_CHECK_EQUAL(testResults.crc[0], SYS_DMA_CRCReferenceCalculate(testBuffer, 100U, testCRC16));
+    TEST_CHECK_EQUAL(testResults.context[1], 11U);
+    TEST_CHECK_EQUAL(testResults.crc[1],
+            SYS_DMA_CRCReferenceCalculate(testResults.chainBuffer, testResults.chainLength, testCRC32));
+
+    testIdleCheck();
+}
+
+static void testEngineOwned(void)
+{
+    testResultsClear();
+
+    /* A driver computing the CRC of its own transfers owns the engine */
+    TEST_CHECK(SYS_DMA_CRCEngineAcquire() == true);
+    TEST_CHECK(SYS_DMA_CRCEngineAcquire() == false);
+
+    TEST_CHECK(SYS_DMA_CRCRequestAdd(testBuffer, 256U, testCRC32, testCallback, 0U) == false);
+    TEST_CHECK_EQUAL(DMAC_MODEL_ChannelsInUse(), 0U);
+
+    SYS_DMA_CRCEngineRelease();
+
+    /* The service takes the engine for its burst, other users are refused */
+    TEST_CHECK(SYS_DMA_CRCRequestAdd(testBuffer, 256U, testCRC32, testCallback, 0U) == true);
+    TEST_CHECK(SYS_DMA_CRCEngineAcquire() == false);
+
+    (void) testRun();
+
+    TEST_CHECK_EQUAL(testResults.nResults, 1U);
+    TEST_CHECK_EQUAL(testResults.crc[0], SYS_DMA_CRCReferenceCalculate(testBuffer, 256U, testCRC32));
+
+    testIdleCheck();
+}
+
+int main( int argc, char *argv[] )
+{
+    uint32_t i;
+    uint32_t seed = 0x12345678U;
+    int result;
+
+    for (i = 0U; i < TEST_BUFFER_SIZE; i++)
+    {
+        seed = seed * 1103515245U + 12345U;
+        testBuffer[i] = (uint8_t)(seed >> 16);
+    }
+
+    DMAC_MODEL_Reset();
+    SYS_DMA_CRCInitialize();
+
+    testReference();
+    testSingleRequests();
+    testQueue();
+    testChain();
+    testEngineOwned();
+
+    TEST_CHECK_EQUAL(gDmacModel.errTransferUnallocated, 0U);
+    TEST_CHECK_EQUAL(gDmacModel.errTransferBusy, 0U);
+    TEST_CHECK_EQUAL(gDmacModel.errBlockTooLong, 0U);
+    TEST_CHECK_EQUAL(gDmacModel.errCRCSetupWhileEnabled, 0U);
+    TEST_CHECK_EQUAL(gDmacModel.errCRCSetupChannelBusy, 0U);
+    TEST_CHECK_EQUAL(gSysIntDisableDepth, 0U);
+
+    result = TEST_RESULT("dma_crc");
+    return result;
+}
@@ -0,0 +1,208 @@
+/*******************************************************************************
+  RAM Disk Model
+
+  File Name:
+    ram_disk.c
+
+  Summary:
+    FatFs disk I/O layer over a sector array in host memory.
+
+  Description:
+    See ram_disk.h.
+*******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "ff.h"
+#include "diskio.h"
+#include "ram_disk.h"
+
+RAM_DISK gRamDisk;
+
+/* Drive 0, whole disk */
+PARTITION VolToPart[FF_VOLUMES] = {{0, 0}};
+
+bool RAM_DISK_Create( uint32_t nSectors )
+{
+    RAM_DISK_Destroy();
+
+    gRamDisk.data = calloc(nSectors, RAM_DISK_SECTOR_SIZE);
+
+    if (gRamDisk.data == NULL)
+    {
+        return false;
+    }
+
+    gRamDisk.nSectors = nSectors;
+
+    return true;
+}
+
+void RAM_DISK_Destroy( void )
+{
+    free(gRamDisk.data);
+    (void) memset(&gRamDisk, 0, sizeof(gRamDisk));
+}
+
+void RAM_DISK_StatisticsReset( void )
+{
+    gRamDisk.nReadCommands = 0U;
+    gRamDisk.nSectorsRead = 0U;
+    gRamDisk.nWriteCommands = 0U;
+    gRamDisk.nSectorsWritten = 0U;
+    gRamDisk.nTransfers = 0U;
+    gRamDisk.nTransferWaits = 0U;
+}
+
+static bool lRAM_DISK_RangeIsValid( uint8_t pdrv, uint32_t sector, uint32_t count )
+{
+    if ((pdrv != 0U) || (gRamDisk.data == NULL) || (sector >= gRamDisk.nSectors) ||
+            (count > (gRamDisk.nSectors - sector)))
+    {
+        gRamDisk.errOutOfRange++;
+        return false;
+    }
+
+    return true;
+}
+
+void RAM_DISK_TransferTasks( void )
+{
+    uint8_t *data = NULL;
+    uint32_t size = gRamDisk.transferCount * RAM_DISK_SECTOR_SIZE;
+
+    if (gRamDisk.isTransferBusy == false)
+    {
+        return;
+    }
+
+    data = &gRamDisk.data[gRamDisk.transferSector * RAM_DISK_SECTOR_SIZE];
+
+    if (gRamDisk.isTransferWrite == true)
+    {
+        (void) memcpy(data, gRamDisk.transferBuffer, size);
+        gRamDisk.nWriteCommands++;
+        gRamDisk.nSectorsWritten += gRamDisk.transferCount;
+    }
+    else
+    {
+        (void) memcpy(gRamDisk.transferBuffer, data, size);
+        gRamDisk.nReadCommands++;
+        gRamDisk.nSectorsRead += gRamDisk.transferCount;
+    }
+
+    gRamDisk.isTransferBusy = false;
+}
+
+static void lRAM_DISK_TransferWait( void )
+{
+    if (gRamDisk.isTransferBusy == true)
+    {
+        gRamDisk.nTransferWaits++;
+        RAM_DISK_TransferTasks();
+    }
+}
+
+DSTATUS disk_initialize( uint8_t pdrv )
+{
+    return (gRamDisk.data == NULL) ? STA_NOINIT : 0U;
+}
+
+DSTATUS disk_status( uint8_t pdrv )
+{
+    return (gRamDisk.data == NULL) ? STA_NOINIT : 0U;
+}
+
+DRESULT disk_read( uint8_t pdrv, uint8_t *buff, uint32_t sector, uint32_t count )
+{
+    lRAM_DISK_TransferWait();
+
+    if (lRAM_DISK_RangeIsValid(pdrv, sector, count) == false)
+    {
+        return RES_PARERR;
+    }
+
+    (void) memcpy(buff, &gRamDisk.data[sector * RAM_DISK_SECTOR_SIZE], count * RAM_DISK_SECTOR_SIZE);
+
+    gRamDisk.nReadCommands++;
+    gRamDisk.nSectorsRead += count;
+
+    return RES_OK;
+}
+
+DRESULT disk_write( uint8_t pdrv, const uint8_t *buff, uint32_t sector, uint32_t count )
+{
+    lRAM_DISK_TransferWait();
+
+    if (lRAM_DISK_RangeIsValid(pdrv, sector, count) == false)
+    {
+        return RES_PARERR;
+    }
+
+    (void) memcpy(&gRamDisk.data[sector * RAM_DISK_SECTOR_SIZE], buff, count * RAM_DISK_SECTOR_SIZE);
+
+    gRamDisk.nWriteCommands++;
+    gRamDisk.nSectorsWritten += count;
+
+    return RES_OK;
+}
+
+DRESULT disk_transfer( uint8_t pdrv, uint8_t *buff, uint32_t sector, uint32_t count, bool write )
+{
+    lRAM_DISK_TransferWait();
+
+    if (lRAM_DISK_RangeIsValid(pdrv, sector, count) == false)
+    {
+        return RES_PARERR;
+    }
+
+    gRamDisk.isTransferBusy = true;
+    gRamDisk.isTransferWrite = write;
+    gRamDisk.transferBuffer = buff;
+    gRamDisk.transferSector = sector;
+    gRamDisk.transferCount = count;
+    gRamDisk.nTransfers++;
+
+    return RES_OK;
+}
+
+DRESULT disk_transfer_status( uint8_t pdrv )
+{
+    return (gRamDisk.isTransferBusy == true) ? RES_NOTRDY : RES_OK;
+}
+
+DRESULT disk_ioctl( uint8_t pdrv, uint8_t cmd, void *buff )
+{
+    DRESULT result = RES_OK;
+
+    switch (cmd)
+    {
+        case CTRL_SYNC:
+            lRAM_DISK_TransferWait();
+            break;
+
+        case GET_SECTOR_COUNT:
+            *(LBA_t *)buff = gRamDisk.nSectors;
+            break;
+
+        case GET_SECTOR_SIZE:
+            *(WORD *)buff = (WORD)RAM_DISK_SECTOR_SIZE;
+            break;
+
+        case GET_BLOCK_SIZE:
+            *(DWORD *)buff = 1U;
+            break;
+
+        default:
+            result = RES_PARERR;
+            break;
+    }
+
+    return result;
+}
+
+DWORD get_fattime( void )
+{
+    /* 2020-01-01 00:00:00 */
+    return ((DWORD)(2020U - 1980U) << 25) | (1UL << 21) | (1UL << 16);
+}
@@ -0,0 +1,68 @@
+/*******************************************************************************
+  RAM Disk Model
+
+  File Name:
+    ram_disk.h
+
+  Summary:
+    FatFs disk I/O layer over a sector array in host memory.
+
+  Description:
+    The model implements the diskio.h functions for drive 0 with 512 byte
+    sectors and counts the sectors and the commands read and written, so that
+    a test can measure the media accesses of FatFs.
+
+    A transfer started by disk_transfer is done by RAM_DISK_TransferTasks,
+    which stands for the media driver tasks: the data is copied and the
+    transfer ends there. Like the disk layer of the application, disk_read,
+    disk_write and disk_transfer first finish a transfer in progress; each
+    time it happens is counted.
+*******************************************************************************/
+
+#ifndef RAM_DISK_H
+#define RAM_DISK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define RAM_DISK_SECTOR_SIZE            (512U)
+
+typedef struct
+{
+    uint8_t *data;
+    uint32_t nSectors;
+
+    /* Statistics */
+    uint32_t nReadCommands;
+    uint32_t nSectorsRead;
+    uint32_t nWriteCommands;
+    uint32_t nSectorsWritten;
+
+    /* Transfer started by disk_transfer */
+    bool isTransferBusy;
+    bool isTransferWrite;
+    uint8_t *transferBuffer;
+    uint32_t transferSector;
+    uint32_t transferCount;
+
+    /* Transfers started, transfers finished by another access */
+    uint32_t nTransfers;
+    uint32_t nTransferWaits;
+
+    /* Accesses past the end of the disk */
+    uint32_t errOutOfRange;
+
+} RAM_DISK;
+
+extern RAM_DISK gRamDisk;
+
+/* Allocates a zeroed disk and clears the counters */
+bool RAM_DISK_Create( uint32_t nSectors );
+void RAM_DISK_Destroy( void );
+
+void RAM_DISK_StatisticsReset( void );
+
+/* Does the transfer in progress, if any */
+void RAM_DISK_TransferTasks( void );
+
+#endif // RAM_DISK_H
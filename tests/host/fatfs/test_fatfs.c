@@ -0,0 +1,759 @@
+/*******************************************************************************
+  FatFs Host Test
+
+  File Name:
+    test_fatfs.c
+
+  Summary:
+    Runs the FatFs of the sdspi_fat and nvm_fat applications on a RAM disk.
+
+  Description:
+    ff.c and ffunicode.c, the same files in both applications, are built with
+    the ffconf.h of the nvm_fat configuration, together with the nvm_fat FAT
+    interface of SYS_FS. The test measures the sector reads of a path lookup with
+    the directory entry cache and checks that lookups stay exact while the
+    directory is changed by unlink, rename and mkdir. On FAT12, FAT16 and
+    FAT32 volumes it checks the free cluster count against the FAT of the disk
+    image: after a remount, while f_freescan runs between writes, and after
+    the image is changed behind a kept count.
+
+    Through FATFS_linkmap, the seek index of SYS_FS_FileSeekIndexBuild, it
+    seeks in a file of one-cluster fragments with and without the index and
+    checks the data and the sector reads. Through FATFS_expand, the allocation
+    of SYS_FS_FileAllocate, it allocates a contiguous block, writes it with
+    the index attached, and allocates a chain on a volume where no contiguous
+    run is left, checking the cluster chains in the FAT of the image.
+*******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "test_host.h"
+#include "ff.h"
+#include "system/fs/sys_fs.h"
+#include "system/fs/sys_fs_fat_interface.h"
+#include "ram_disk.h"
+
+#define TEST_DIR_DISK_SECTORS           (8192U)
+#define TEST_DIR_FILES                  (300U)
+#define TEST_DIR_CHURN_STEPS            (3000U)
+
+#define TEST_FREE_DISK_SECTORS          (140000U)
+#define TEST_FREE_CHURN_FILES           (20U)
+#define TEST_FREE_CHURN_STEPS           (40U)
+
+#define TEST_SEEK_DISK_SECTORS          (8192U)
+#define TEST_SEEK_FRAGMENTS             (1000U)
+#define TEST_SEEK_STEPS                 (200U)
+#define TEST_SEEK_TABLE_SIZE            (2U + (2U * TEST_SEEK_FRAGMENTS))
+
+#define TEST_EXPAND_DISK_SECTORS        (8192U)
+#define TEST_EXPAND_CLUSTER_SIZE        (4096U)
+#define TEST_EXPAND_SIZE                (16U * TEST_EXPAND_CLUSTER_SIZE)
+#define TEST_EXPAND_WRITTEN             (10U * TEST_EXPAND_CLUSTER_SIZE)
+#define TEST_EXPAND_CHAIN_CLUSTERS      (50U)
+
+static FATFS testFs;
+
+/* FAT layout of the formatted volume, for the checks of the disk image */
+static struct
+{
+    BYTE type;
+    BYTE nFats;
+    DWORD fatbase;
+    DWORD fsize;
+    DWORD nFatent;
+
+} testFat;
+static BYTE testWork[FF_MAX_SS * 8U];
+static uint32_t testSeed = 1U;
+
+static uint32_t testRandom(void)
+{
+    testSeed = testSeed * 1103515245U + 12345U;
+    return (testSeed >> 16) & 0x7FFFU;
+}
+
+static void testFileName(char *name, uint32_t index)
+{
+    (void) sprintf(name, "Dir1/FILE_TOO_LONG_NAME_EXAMPLE_%03u.JPG", (unsigned int)index);
+}
+
+static FRESULT testFileCreate(const char *path)
+{
+    FIL file;
+    FRESULT res = f_open(&file, path, FA_CREATE_NEW | FA_WRITE);
+
+    if (res == FR_OK)
+    {
+        res = f_close(&file);
+    }
+
+    return res;
+}
+
+static bool testFormat(uint32_t nSectors, BYTE format, DWORD clusterSize)
+{
+    MKFS_PARM opt = {format, 0U, 0U, 0U, clusterSize};
+
+    if (RAM_DISK_Create(nSectors) == false)
+    {
+        return false;
+    }
+
+    if ((f_mkfs("", &opt, testWork, sizeof(testWork)) != FR_OK) || (f_mount(&testFs, "", 1) != FR_OK))
+    {
+        return false;
+    }
+
+    testFat.type = testFs.fs_type;
+    testFat.nFats = testFs.n_fats;
+    testFat.fatbase = (DWORD)testFs.fatbase;
+    testFat.fsize = testFs.fsize;
+    testFat.nFatent = testFs.n_fatent;
+
+    return true;
+}
+
+// *****************************************************************************
+// Section: Directory entry cache
+// *****************************************************************************
+
+static void testDirectoryCache(void)
+{
+    static bool exists[TEST_DIR_FILES];
+    char name[64];
+    FILINFO info;
+    uint32_t coldReads;
+    uint32_t cachedReads;
+    uint32_t i;
+    uint32_t index;
+    FRESULT res;
+
+    TEST_CHECK(testFormat(TEST_DIR_DISK_SECTORS, FM_FAT, 0U) == true);
+    TEST_CHECK_EQUAL(f_mkdir("Dir1"), FR_OK);
+
+    for (i = 0U; i < TEST_DIR_FILES; i++)
+    {
+        testFileName(name, i);
+        TEST_CHECK_EQUAL(testFileCreate(name), FR_OK);
+        exists[i] = true;
+    }
+
+    /* The mount clears the cache: the first lookup scans the directory */
+    TEST_CHECK_EQUAL(f_unmount(""), FR_OK);
+    TEST_CHECK_EQUAL(f_mount(&testFs, "", 1), FR_OK);
+
+    testFileName(name, TEST_DIR_FILES - 1U);
+
+    RAM_DISK_StatisticsReset();
+    TEST_CHECK_EQUAL(f_stat(name, &info), FR_OK);
+    coldReads = gRamDisk.nSectorsRead;
+
+    /* The names are matched up-cased */
+    RAM_DISK_StatisticsReset();
+    TEST_CHECK_EQUAL(f_stat("dir1/file_too_long_name_example_299.jpg", &info), FR_OK);
+    cachedReads = gRamDisk.nSectorsRead;
+
+    (void) printf("fatfs: stat in a directory of %u long names: %u sector reads uncached, %u cached\n",
+            (unsigned int)TEST_DIR_FILES, (unsigned int)coldReads, (unsigned int)cachedReads);
+
+    TEST_CHECK(cachedReads * 10U <= coldReads);
+
+    /* Unlink, rename, mkdir and rmdir drop the items they make stale */
+    testFileName(name, 10U);
+    TEST_CHECK_EQUAL(f_stat(name, &info), FR_OK);
+    TEST_CHECK_EQUAL(f_unlink(name), FR_OK);
+    TEST_CHECK_EQUAL(f_stat(name, &info), FR_NO_FILE);
+
+    TEST_CHECK_EQUAL(f_rename("Dir1/FILE_TOO_LONG_NAME_EXAMPLE_299.JPG", name), FR_OK);
+    TEST_CHECK_EQUAL(f_stat("Dir1/FILE_TOO_LONG_NAME_EXAMPLE_299.JPG", &info), FR_NO_FILE);
+    TEST_CHECK_EQUAL(f_stat(name, &info), FR_OK);
+    exists[TEST_DIR_FILES - 1U] = false;
+
+    TEST_CHECK_EQUAL(f_mkdir("Dir1/Sub_Directory_Long"), FR_OK);
+    TEST_CHECK_EQUAL(testFileCreate("Dir1/Sub_Directory_Long/inner_long_file.txt"), FR_OK);
+    TEST_CHECK_EQUAL(f_stat("Dir1/Sub_Directory_Long/inner_long_file.txt", &info), FR_OK);
+    TEST_CHECK_EQUAL(f_unlink("Dir1/Sub_Directory_Long/inner_long_file.txt"), FR_OK);
+    TEST_CHECK_EQUAL(f_unlink("Dir1/Sub_Directory_Long"), FR_OK);
+    TEST_CHECK_EQUAL(f_stat("Dir1/Sub_Directory_Long/inner_long_file.txt", &info), FR_NO_PATH);
+    TEST_CHECK_EQUAL(f_mkdir("Dir1/Sub_Directory_Long"), FR_OK);
+    TEST_CHECK_EQUAL(f_stat("Dir1/Sub_Directory_Long/inner_long_file.txt", &info), FR_NO_FILE);
+
+    /* Lookups mixed with unlinks and re-creations, which move the entries */
+    for (i = 0U; i < TEST_DIR_CHURN_STEPS; i++)
+    {
+        index = testRandom() % TEST_DIR_FILES;
+        testFileName(name, index);
+
+        res = f_stat(name, &info);
+        TEST_CHECK_EQUAL(res, (exists[index] == true) ? FR_OK : FR_NO_FILE);
+
+        if ((testRandom() % 10U) == 0U)
+        {
+            if (exists[index] == true)
+            {
+                TEST_CHECK_EQUAL(f_unlink(name), FR_OK);
+                exists[index] = false;
+            }
+            else
+            {
+                TEST_CHECK_EQUAL(testFileCreate(name), FR_OK);
+                exists[index] = true;
+            }
+        }
+    }
+
+    /* The directory on the disk holds the same files */
+    TEST_CHECK_EQUAL(f_unmount(""), FR_OK);
+    TEST_CHECK_EQUAL(f_mount(&testFs, "", 1), FR_OK);
+
+    for (i = 0U; i < TEST_DIR_FILES; i++)
+    {
+        testFileName(name, i);
+        TEST_CHECK_EQUAL(f_stat(name, &info), (exists[i] == true) ? FR_OK : FR_NO_FILE);
+    }
+
+    TEST_CHECK_EQUAL(f_unmount(""), FR_OK);
+    TEST_CHECK_EQUAL(gRamDisk.errOutOfRange, 0U);
+}
+
+// *****************************************************************************
+// Section: Free cluster count
+// *****************************************************************************
+
+/* Reads a FAT entry from the first FAT of the disk image */
+static uint32_t testFATEntryGet(uint32_t cluster)
+{
+    const uint8_t *fat = &gRamDisk.data[testFat.fatbase * RAM_DISK_SECTOR_SIZE];
+    uint32_t offset;
+    uint32_t value;
+
+    switch (testFat.type)
+    {
+        case FS_FAT12:
+            offset = cluster + (cluster / 2U);
+            value = (uint32_t)fat[offset] | ((uint32_t)fat[offset + 1U] << 8);
+            value = ((cluster & 1U) != 0U) ? (value >> 4) : (value & 0xFFFU);
+            break;
+
+        case FS_FAT16:
+            offset = cluster * 2U;
+            value = (uint32_t)fat[offset] | ((uint32_t)fat[offset + 1U] << 8);
+            break;
+
+        default:
+            offset = cluster * 4U;
+            value = (uint32_t)fat[offset] | ((uint32_t)fat[offset + 1U] << 8) |
+                    ((uint32_t)fat[offset + 2U] << 16) | ((uint32_t)fat[offset + 3U] << 24);
+            value &= 0x0FFFFFFFU;
+            break;
+    }
+
+    return value;
+}
+
+/* Marks a cluster as the end of a chain in every FAT of the disk image */
+static void testFATEntryMarkUsed(uint32_t cluster)
+{
+    uint8_t *fat;
+    uint32_t offset;
+    uint32_t i;
+
+    for (i = 0U; i < testFat.nFats; i++)
+    {
+        fat = &gRamDisk.data[(testFat.fatbase + i * testFat.fsize) * RAM_DISK_SECTOR_SIZE];
+
+        switch (testFat.type)
+        {
+            case FS_FAT12:
+                offset = cluster + (cluster / 2U);
+                if ((cluster & 1U) != 0U)
+                {
+                    fat[offset] |= 0xF0U;
+                    fat[offset + 1U] = 0xFFU;
+                }
+                else
+                {
+                    fat[offset] = 0xFFU;
+                    fat[offset + 1U] |= 0x0FU;
+                }
+                break;
+
+            case FS_FAT16:
+                offset = cluster * 2U;
+                fat[offset] = 0xFFU;
+                fat[offset + 1U] = 0xFFU;
+                break;
+
+            default:
+                offset = cluster * 4U;
+                fat[offset] = 0xFFU;
+                fat[offset + 1U] = 0xFFU;
+                fat[offset + 2U] = 0xFFU;
+                fat[offset + 3U] = 0x0FU;
+                break;
+        }
+    }
+}
+
+/* Counts the free clusters in the FAT of the disk image */
+static uint32_t testFATFreeCount(uint32_t *lastFree)
+{
+    uint32_t cluster;
+    uint32_t count = 0U;
+
+    for (cluster = 2U; cluster < testFat.nFatent; cluster++)
+    {
+        if (testFATEntryGet(cluster) == 0U)
+        {
+            count++;
+
+            if (lastFree != NULL)
+            {
+                *lastFree = cluster;
+            }
+        }
+    }
+
+    return count;
+}
+
+static uint32_t testFreeCountGet(void)
+{
+    DWORD count = 0U;
+    FATFS *fs;
+
+    TEST_CHECK_EQUAL(f_getfree("", &count, &fs), FR_OK);
+
+    return (uint32_t)count;
+}
+
+/* Appends to and deletes files of random sizes */
+static void testFreeChurn(void)
+{
+    static BYTE data[8192];
+    char name[16];
+    FIL file;
+    UINT written;
+    uint32_t i;
+    FRESULT res;
+
+    for (i = 0U; i < TEST_FREE_CHURN_STEPS; i++)
+    {
+        (void) sprintf(name, "f%u", (unsigned int)(testRandom() % TEST_FREE_CHURN_FILES));
+
+        if ((testRandom() % 3U) == 0U)
+        {
+            res = f_unlink(name);
+            TEST_CHECK((res == FR_OK) || (res == FR_NO_FILE));
+        }
+        else
+        {
+            TEST_CHECK_EQUAL(f_open(&file, name, FA_OPEN_APPEND | FA_WRITE), FR_OK);
+            TEST_CHECK_EQUAL(f_write(&file, data, testRandom() % sizeof(data), &written), FR_OK);
+            TEST_CHECK_EQUAL(f_close(&file), FR_OK);
+        }
+    }
+}
+
+static void testRemount(void)
+{
+    TEST_CHECK_EQUAL(f_unmount(""), FR_OK);
+    TEST_CHECK_EQUAL(f_mount(&testFs, "", 1), FR_OK);
+}
+
+static uint32_t testFreeScanComplete(bool churn)
+{
+    DWORD remaining = 0U;
+    uint32_t steps = 0U;
+
+    do
+    {
+        TEST_CHECK_EQUAL(f_freescan("", &remaining), FR_OK);
+        steps++;
+
+        /* The writes move clusters on both sides of the scan cursor */
+        if ((churn == true) && ((steps % 3U) == 0U))
+        {
+            testFreeChurn();
+        }
+
+    } while ((remaining != 0U) && (steps < testFat.nFatent));
+
+    return steps;
+}
+
+static void testFreeCount(const char *name, BYTE format, DWORD clusterSize, BYTE fsType)
+{
+    uint32_t remountReads;
+    uint32_t steps;
+    uint32_t lastFree = 0U;
+    uint32_t truth;
+    uint32_t fsinfoCount;
+    uint32_t fsinfoSector;
+    const uint8_t *sector;
+
+    TEST_CHECK(testFormat(TEST_FREE_DISK_SECTORS, format, clusterSize) == true);
+    TEST_CHECK_EQUAL(testFs.fs_type, fsType);
+
+    TEST_CHECK_EQUAL(testFreeCountGet(), testFATFreeCount(NULL));
+
+    testFreeChurn();
+    TEST_CHECK_EQUAL(testFreeCountGet(), testFATFreeCount(NULL));
+
+    /* FSInfo (FAT32) or the count kept at the last sync (FAT12/16) */
+    testRemount();
+    RAM_DISK_StatisticsReset();
+    TEST_CHECK_EQUAL(testFreeCountGet(), testFATFreeCount(NULL));
+    remountReads = gRamDisk.nSectorsRead;
+    TEST_CHECK_EQUAL(remountReads, 0U);
+
+    /* The count stays exact while the scan runs between writes */
+    testRemount();
+    steps = testFreeScanComplete(true);
+    TEST_CHECK_EQUAL(testFreeCountGet(), testFATFreeCount(NULL));
+
+    /* A cluster taken behind the kept count is found by the scan */
+    TEST_CHECK_EQUAL(f_unmount(""), FR_OK);
+    truth = testFATFreeCount(&lastFree);
+    testFATEntryMarkUsed(lastFree);
+    TEST_CHECK_EQUAL(f_mount(&testFs, "", 1), FR_OK);
+
+    TEST_CHECK_EQUAL(testFreeCountGet(), truth);
+    (void) testFreeScanComplete(false);
+    TEST_CHECK_EQUAL(testFreeCountGet(), truth - 1U);
+    TEST_CHECK_EQUAL(testFATFreeCount(NULL), truth - 1U);
+
+    if (fsType == FS_FAT32)
+    {
+        /* The corrected count is written to the FSInfo sector */
+        sector = &gRamDisk.data[testFs.volbase * RAM_DISK_SECTOR_SIZE];
+        fsinfoSector = (uint32_t)testFs.volbase + ((uint32_t)sector[48] | ((uint32_t)sector[49] << 8));
+        sector = &gRamDisk.data[fsinfoSector * RAM_DISK_SECTOR_SIZE];
+        fsinfoCount = (uint32_t)sector[488] | ((uint32_t)sector[489] << 8) |
+                ((uint32_t)sector[490] << 16) | ((uint32_t)sector[491] << 24);
+        TEST_CHECK_EQUAL(fsinfoCount, truth - 1U);
+    }
+
+    /* A new filesystem object has no kept count: FAT12/16 scan the FAT */
+    TEST_CHECK_EQUAL(f_unmount(""), FR_OK);
+    (void) memset(&testFs, 0, sizeof(testFs));
+    TEST_CHECK_EQUAL(f_mount(&testFs, "", 1), FR_OK);
+    TEST_CHECK_EQUAL(testFreeCountGet(), testFATFreeCount(NULL));
+
+    (void) printf("fatfs: %s: %u clusters, getfree after remount %u sector reads, scan with writes %u steps\n",
+            name, (unsigned int)(testFat.nFatent - 2U), (unsigned int)remountReads, (unsigned int)steps);
+
+    TEST_CHECK_EQUAL(f_unmount(""), FR_OK);
+    TEST_CHECK_EQUAL(gRamDisk.errOutOfRange, 0U);
+}
+
+/* Follows a cluster chain in the FAT of the disk image */
+static uint32_t testChainLength(uint32_t cluster, uint32_t *fragments)
+{
+    uint32_t next;
+    uint32_t length = 0U;
+
+    *fragments = 0U;
+
+    while ((cluster >= 2U) && (cluster < testFat.nFatent) && (length < testFat.nFatent))
+    {
+        next = testFATEntryGet(cluster);
+        length++;
+
+        if (next != (cluster + 1U))
+        {
+            (*fragments)++;
+        }
+
+        cluster = next;
+    }
+
+    return length;
+}
+
+/* First cluster of a file, from its directory entry */
+static uint32_t testFileCluster(const char *path)
+{
+    FIL file;
+    uint32_t cluster = 0U;
+
+    TEST_CHECK_EQUAL(f_open(&file, path, FA_READ), FR_OK);
+    cluster = (uint32_t)file.obj.sclust;
+    TEST_CHECK_EQUAL(f_close(&file), FR_OK);
+
+    return cluster;
+}
+
+// *****************************************************************************
+// Section: Fast seek
+// *****************************************************************************
+
+static uint8_t testSeekByte(uint32_t offset)
+{
+    return (uint8_t)(((offset / RAM_DISK_SECTOR_SIZE) * 31U) + offset);
+}
+
+/* Appends one cluster to a file */
+static void testClusterAppend(const char *path, uint32_t offset)
+{
+    static BYTE data[RAM_DISK_SECTOR_SIZE];
+    FIL file;
+    UINT written = 0U;
+    uint32_t i;
+
+    for (i = 0U; i < sizeof(data); i++)
+    {
+        data[i] = testSeekByte(offset + i);
+    }
+
+    TEST_CHECK_EQUAL(f_open(&file, path, FA_OPEN_APPEND | FA_WRITE), FR_OK);
+    TEST_CHECK_EQUAL(f_write(&file, data, sizeof(data), &written), FR_OK);
+    TEST_CHECK_EQUAL(written, sizeof(data));
+    TEST_CHECK_EQUAL(f_close(&file), FR_OK);
+}
+
+/* Seeks to an offset and checks the bytes read there */
+static void testSeekRead(uintptr_t file, uint32_t offset)
+{
+    uint8_t data[16];
+    uint32_t count = 0U;
+    uint32_t i;
+
+    TEST_CHECK_EQUAL(FATFS_lseek(file, (FSIZE_t)offset), FR_OK);
+    TEST_CHECK_EQUAL(FATFS_read(file, data, sizeof(data), &count), FR_OK);
+    TEST_CHECK_EQUAL(count, sizeof(data));
+
+    for (i = 0U; i < count; i++)
+    {
+        TEST_CHECK_EQUAL(data[i], testSeekByte(offset + i));
+    }
+}
+
+/* Seeks backward from the end of the file, to a different sector each time,
+ * and returns the sectors read */
+static uint32_t testSeekBackward(uintptr_t file)
+{
+    uint32_t nSectors = (uint32_t)FATFS_size(file) / RAM_DISK_SECTOR_SIZE;
+    uint32_t step = nSectors / TEST_SEEK_STEPS;
+    uint32_t i;
+
+    RAM_DISK_StatisticsReset();
+
+    for (i = 0U; i < TEST_SEEK_STEPS; i++)
+    {
+        testSeekRead(file, ((nSectors - 1U - (i * step)) * RAM_DISK_SECTOR_SIZE) + 100U);
+    }
+
+    return gRamDisk.nSectorsRead;
+}
+
+static void testFastSeek(void)
+{
+    static uint32_t table[TEST_SEEK_TABLE_SIZE];
+    uint32_t small[4];
+    uintptr_t file = 0U;
+    uint32_t plainReads;
+    uint32_t indexedReads;
+    uint32_t fragments = 0U;
+    uint32_t i;
+
+    TEST_CHECK(testFormat(TEST_SEEK_DISK_SECTORS, FM_FAT, RAM_DISK_SECTOR_SIZE) == true);
+
+    /* Two files appended in turn: every cluster of SEEK.BIN is a fragment */
+    for (i = 0U; i < TEST_SEEK_FRAGMENTS; i++)
+    {
+        testClusterAppend("seek.bin", i * RAM_DISK_SECTOR_SIZE);
+        testClusterAppend("gap.bin", i * RAM_DISK_SECTOR_SIZE);
+    }
+
+    TEST_CHECK_EQUAL(testChainLength(testFileCluster("seek.bin"), &fragments), TEST_SEEK_FRAGMENTS);
+    TEST_CHECK_EQUAL(fragments, TEST_SEEK_FRAGMENTS);
+
+    TEST_CHECK_EQUAL(FATFS_open((uintptr_t)&file, "seek.bin", (uint8_t)SYS_FS_FILE_OPEN_READ), FR_OK);
+
+    /* A table too small gives the required size and leaves the file in
+     * normal mode */
+    TEST_CHECK_EQUAL(FATFS_linkmap(file, small, 4U), FR_NOT_ENOUGH_CORE);
+    TEST_CHECK_EQUAL(small[0], TEST_SEEK_TABLE_SIZE);
+
+    plainReads = testSeekBackward(file);
+
+    TEST_CHECK_EQUAL(FATFS_linkmap(file, table, TEST_SEEK_TABLE_SIZE), FR_OK);
+    TEST_CHECK_EQUAL(table[0], TEST_SEEK_TABLE_SIZE);
+
+    /* With the index a seek reads the data sector only */
+    indexedReads = testSeekBackward(file);
+    TEST_CHECK_EQUAL(indexedReads, TEST_SEEK_STEPS);
+    TEST_CHECK(plainReads > (2U * indexedReads));
+
+    (void) printf("fatfs: %u backward seeks in a file of %u fragments: %u sector reads without the seek index, %u with it\n",
+            (unsigned int)TEST_SEEK_STEPS, (unsigned int)TEST_SEEK_FRAGMENTS, (unsigned int)plainReads,
+            (unsigned int)indexedReads);
+
+    /* Seeks both ways, across the fragment boundaries */
+    for (i = 0U; i < TEST_SEEK_STEPS; i++)
+    {
+        testSeekRead(file, (testRandom() * 37U) % ((TEST_SEEK_FRAGMENTS * RAM_DISK_SECTOR_SIZE) - 16U));
+    }
+
+    testSeekRead(file, RAM_DISK_SECTOR_SIZE - 8U);
+    testSeekRead(file, (TEST_SEEK_FRAGMENTS * RAM_DISK_SECTOR_SIZE) - 16U);
+
+    /* A NULL table leaves the fast seek mode */
+    TEST_CHECK_EQUAL(FATFS_linkmap(file, NULL, 0U), FR_OK);
+    testSeekRead(file, 3U * RAM_DISK_SECTOR_SIZE - 8U);
+    testSeekRead(file, 0U);
+
+    TEST_CHECK_EQUAL(FATFS_close(file), FR_OK);
+    TEST_CHECK_EQUAL(f_unmount(""), FR_OK);
+    TEST_CHECK_EQUAL(gRamDisk.errOutOfRange, 0U);
+}
+
+// *****************************************************************************
+// Section: Contiguous allocation
+// *****************************************************************************
+
+/* Marks every other free cluster as used: no two free clusters are adjacent */
+static void testFreeSpaceFragment(void)
+{
+    uint32_t cluster;
+
+    for (cluster = 2U; cluster < testFat.nFatent; cluster += 2U)
+    {
+        if (testFATEntryGet(cluster) == 0U)
+        {
+            testFATEntryMarkUsed(cluster);
+        }
+    }
+}
+
+static void testExpand(void)
+{
+    static uint8_t data[TEST_EXPAND_CLUSTER_SIZE];
+    uint32_t table[4];
+    uintptr_t file = 0U;
+    uint32_t count = 0U;
+    uint32_t freeClusters;
+    uint32_t fragments = 0U;
+    uint32_t writeCommands;
+    uint32_t i;
+
+    TEST_CHECK(testFormat(TEST_EXPAND_DISK_SECTORS, FM_FAT, TEST_EXPAND_CLUSTER_SIZE) == true);
+
+    /* Some clusters in use ahead of the block */
+    testClusterAppend("head.bin", 0U);
+    freeClusters = testFATFreeCount(NULL);
+
+    for (i = 0U; i < sizeof(data); i++)
+    {
+        data[i] = testSeekByte(i);
+    }
+
+    /* One contiguous block: the size is set and the pointer is not moved */
+    TEST_CHECK_EQUAL(FATFS_open((uintptr_t)&file, "log.bin", (uint8_t)SYS_FS_FILE_OPEN_WRITE), FR_OK);
+    TEST_CHECK_EQUAL(FATFS_expand(file, TEST_EXPAND_SIZE, true), FR_OK);
+    TEST_CHECK_EQUAL(FATFS_size(file), TEST_EXPAND_SIZE);
+    TEST_CHECK_EQUAL(FATFS_tell(file), 0U);
+
+    /* One fragment fits the four-item table: the writes do not read the FAT
+     * and each cluster is written with one command */
+    TEST_CHECK_EQUAL(FATFS_linkmap(file, table, 4U), FR_OK);
+    TEST_CHECK_EQUAL(table[0], 4U);
+
+    RAM_DISK_StatisticsReset();
+
+    for (i = 0U; i < (TEST_EXPAND_WRITTEN / sizeof(data)); i++)
+    {
+        TEST_CHECK_EQUAL(FATFS_write(file, data, sizeof(data), &count), FR_OK);
+        TEST_CHECK_EQUAL(count, sizeof(data));
+    }
+
+    writeCommands = gRamDisk.nWriteCommands;
+    TEST_CHECK_EQUAL(gRamDisk.nSectorsRead, 0U);
+    TEST_CHECK_EQUAL(writeCommands, TEST_EXPAND_WRITTEN / TEST_EXPAND_CLUSTER_SIZE);
+
+    /* The unused end is dropped before closing */
+    TEST_CHECK_EQUAL(FATFS_linkmap(file, NULL, 0U), FR_OK);
+    TEST_CHECK_EQUAL(FATFS_truncate(file), FR_OK);
+    TEST_CHECK_EQUAL(FATFS_close(file), FR_OK);
+
+    TEST_CHECK_EQUAL(testChainLength(testFileCluster("log.bin"), &fragments), TEST_EXPAND_WRITTEN / TEST_EXPAND_CLUSTER_SIZE);
+    TEST_CHECK_EQUAL(fragments, 1U);
+    TEST_CHECK_EQUAL(testFATFreeCount(NULL), freeClusters - (TEST_EXPAND_WRITTEN / TEST_EXPAND_CLUSTER_SIZE));
+
+    /* A contiguous block is only given to an empty file */
+    TEST_CHECK_EQUAL(FATFS_open((uintptr_t)&file, "log.bin", (uint8_t)SYS_FS_FILE_OPEN_APPEND), FR_OK);
+    TEST_CHECK_EQUAL(FATFS_expand(file, 2U * TEST_EXPAND_WRITTEN, true), FR_DENIED);
+    TEST_CHECK_EQUAL(FATFS_size(file), TEST_EXPAND_WRITTEN);
+    TEST_CHECK_EQUAL(FATFS_close(file), FR_OK);
+
+    /* No contiguous run of two clusters is left */
+    TEST_CHECK_EQUAL(f_unmount(""), FR_OK);
+    testFreeSpaceFragment();
+    TEST_CHECK_EQUAL(f_mount(&testFs, "", 1), FR_OK);
+    freeClusters = testFATFreeCount(NULL);
+    TEST_CHECK(freeClusters > TEST_EXPAND_CHAIN_CLUSTERS);
+
+    TEST_CHECK_EQUAL(FATFS_open((uintptr_t)&file, "chain.bin", (uint8_t)SYS_FS_FILE_OPEN_WRITE), FR_OK);
+    TEST_CHECK_EQUAL(FATFS_expand(file, 2U * TEST_EXPAND_CLUSTER_SIZE, true), FR_DENIED);
+    TEST_CHECK_EQUAL(FATFS_size(file), 0U);
+    TEST_CHECK_EQUAL(testFATFreeCount(NULL), freeClusters);
+
+    /* The chain takes any free clusters, past the data already written */
+    TEST_CHECK_EQUAL(FATFS_write(file, data, 1000U, &count), FR_OK);
+    TEST_CHECK_EQUAL(FATFS_expand(file, TEST_EXPAND_CHAIN_CLUSTERS * TEST_EXPAND_CLUSTER_SIZE, false), FR_OK);
+    TEST_CHECK_EQUAL(FATFS_size(file), TEST_EXPAND_CHAIN_CLUSTERS * TEST_EXPAND_CLUSTER_SIZE);
+    TEST_CHECK_EQUAL(FATFS_tell(file), 1000U);
+
+    /* A smaller size leaves the file as it is */
+    TEST_CHECK_EQUAL(FATFS_expand(file, TEST_EXPAND_CLUSTER_SIZE, false), FR_OK);
+    TEST_CHECK_EQUAL(FATFS_size(file), TEST_EXPAND_CHAIN_CLUSTERS * TEST_EXPAND_CLUSTER_SIZE);
+    TEST_CHECK_EQUAL(FATFS_close(file), FR_OK);
+
+    TEST_CHECK_EQUAL(testChainLength(testFileCluster("chain.bin"), &fragments), TEST_EXPAND_CHAIN_CLUSTERS);
+    TEST_CHECK_EQUAL(fragments, TEST_EXPAND_CHAIN_CLUSTERS);
+    TEST_CHECK_EQUAL(testFATFreeCount(NULL), freeClusters - TEST_EXPAND_CHAIN_CLUSTERS);
+
+    (void) memset(data, 0, sizeof(data));
+    TEST_CHECK_EQUAL(FATFS_open((uintptr_t)&file, "chain.bin", (uint8_t)SYS_FS_FILE_OPEN_READ), FR_OK);
+    TEST_CHECK_EQUAL(FATFS_read(file, data, 1000U, &count), FR_OK);
+
+    for (i = 0U; i < 1000U; i++)
+    {
+        TEST_CHECK_EQUAL(data[i], testSeekByte(i));
+    }
+
+    TEST_CHECK_EQUAL(FATFS_close(file), FR_OK);
+
+    /* More than the free clusters: the volume is full */
+    freeClusters = testFATFreeCount(NULL);
+    TEST_CHECK_EQUAL(FATFS_open((uintptr_t)&file, "chain.bin", (uint8_t)SYS_FS_FILE_OPEN_APPEND), FR_OK);
+    TEST_CHECK_EQUAL(FATFS_expand(file, (TEST_EXPAND_CHAIN_CLUSTERS + freeClusters + 1U) * TEST_EXPAND_CLUSTER_SIZE, false), FR_DENIED);
+    TEST_CHECK_EQUAL(FATFS_tell(file), TEST_EXPAND_CHAIN_CLUSTERS * TEST_EXPAND_CLUSTER_SIZE);
+    TEST_CHECK_EQUAL(FATFS_close(file), FR_OK);
+
+    (void) printf("fatfs: %u KB allocated as one block: %u KB written in %u commands, no sector read\n",
+            (unsigned int)(TEST_EXPAND_SIZE / 1024U), (unsigned int)(TEST_EXPAND_WRITTEN / 1024U),
+            (unsigned int)writeCommands);
+
+    TEST_CHECK_EQUAL(f_unmount(""), FR_OK);
+    TEST_CHECK_EQUAL(gRamDisk.errOutOfRange, 0U);
+}
+
+int main( int argc, char *argv[] )
+{
+    int result;
+
+    testDirectoryCache();
+    testFreeCount("FAT12", FM_FAT, 64U * RAM_DISK_SECTOR_SIZE, FS_FAT12);
+    testFreeCount("FAT16", FM_FAT, 8U * RAM_DISK_SECTOR_SIZE, FS_FAT16);
+    testFreeCount("FAT32", FM_FAT32, RAM_DISK_SECTOR_SIZE, FS_FAT32);
+    testFastSeek();
+    testExpand();
+
+    RAM_DISK_Destroy();
+
+    result = TEST_RESULT("fatfs");
+    return result;
+}
@@ -0,0 +1,521 @@
+/*******************************************************************************
+  Asynchronous File Transfer Host Test
+
+  File Name:
+    test_file_async.c
+
+  Summary:
+    Runs the queued file transfers of the nvm_fat SYS_FS on a RAM disk.
+
+  Description:
+    sys_fs.c and the FAT interface of the nvm_fat application are built with
+    FatFs and mounted on a FAT volume of the RAM disk, with the media manager
+    functions of volume_model.c. The RAM disk does the transfers that SYS_FS
+    starts without waiting when SYS_FS_MEDIA_MANAGER_Tasks is called, the
+    way the media driver tasks do.
+
+    The test queues reads and writes with SYS_FS_FileReadAsync and
+    SYS_FS_FileWriteAsync and checks the queue limit, the order of the
+    callbacks, a request queued from a callback, the end of a read at the end
+    of the file, and the requests of a file closed while they are in the
+    queue. It checks that the calls of SYS_FS_Tasks that start a transfer
+    return with it in progress, that only the accesses of other modules to
+    the volume wait for it, and that the data on the volume and in the file
+    buffer of FatFs is right after each transfer.
+*******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "test_host.h"
+#include "ff.h"
+#include "system/fs/sys_fs.h"
+#include "system/fs/sys_fs_fat_interface.h"
+#include "ram_disk.h"
+#include "volume_model.h"
+
+#define TEST_DISK_SECTORS               (2048U)
+#define TEST_MOUNT_NAME                 "/mnt/myDrive"
+#define TEST_FILE_NAME                  TEST_MOUNT_NAME "/data.bin"
+#define TEST_OTHER_NAME                 TEST_MOUNT_NAME "/other.txt"
+#define TEST_DIR_NAME                   TEST_MOUNT_NAME "/Dir1"
+
+/* Two writes of the first test: the second starts inside a sector */
+#define TEST_WRITE_SIZE_1               (5000U)
+#define TEST_WRITE_SIZE_2               (3000U)
+#define TEST_FILE_SIZE                  (TEST_WRITE_SIZE_1 + TEST_WRITE_SIZE_2)
+
+/* Calls of SYS_FS_Tasks after which a request must have ended */
+#define TEST_TASKS_MAX                  (1000U)
+
+#define TEST_CALLBACKS_MAX              (8U)
+
+static const SYS_FS_FUNCTIONS testFatFsFunctions =
+{
+    .mount             = FATFS_mount,
+    .unmount           = FATFS_unmount,
+    .open              = FATFS_open,
+    .read_t            = FATFS_read,
+    .close             = FATFS_close,
+    .seek              = FATFS_lseek,
+    .fstat             = FATFS_stat,
+    .getlabel          = FATFS_getlabel,
+    .currWD            = FATFS_getcwd,
+    .getstrn           = FATFS_gets,
+    .openDir           = FATFS_opendir,
+    .readDir           = FATFS_readdir,
+    .closeDir          = FATFS_closedir,
+    .chdir             = FATFS_chdir,
+    .chdrive           = FATFS_chdrive,
+    .write_t           = FATFS_write,
+    .tell              = FATFS_tell,
+    .eof               = FATFS_eof,
+    .size              = FATFS_size,
+    .mkdir             = FATFS_mkdir,
+    .remove_t          = FATFS_unlink,
+    .setlabel          = FATFS_setlabel,
+    .truncate          = FATFS_truncate,
+    .chmode            = FATFS_chmod,
+    .chtime            = FATFS_utime,
+    .rename_t          = FATFS_rename,
+    .sync              = FATFS_sync,
+    .putchr            = FATFS_putc,
+    .putstrn           = FATFS_puts,
+    .formattedprint    = FATFS_printf,
+    .testerror         = FATFS_error,
+    .formatDisk        = (FORMAT_DISK)FATFS_mkfs,
+    .partitionDisk     = FATFS_fdisk,
+    .getCluster        = FATFS_getclusters,
+    .seekIndex         = FATFS_linkmap,
+    .allocate          = FATFS_expand,
+    .extentGet         = FATFS_extent,
+    .sectorTransfer    = FATFS_transfer,
+    .sectorTransferStatus = FATFS_transferstatus,
+    .freeScan          = FATFS_freescan
+};
+
+static const SYS_FS_REGISTRATION_TABLE testFsInit[SYS_FS_MAX_FILE_SYSTEM_TYPE] =
+{
+    {
+        .nativeFileSystemType = FAT,
+        .nativeFileSystemFunctions = &testFatFsFunctions
+    }
+};
+
+/* Callbacks in the order they were called */
+static struct
+{
+    SYS_FS_HANDLE handle;
+    SYS_FS_RESULT result;
+    size_t nbyte;
+    uintptr_t context;
+
+} testCallbacks[TEST_CALLBACKS_MAX];
+static uint32_t testNCallbacks;
+
+/* Request queued by the callback of the request with context 1, and its result */
+static struct
+{
+    uint8_t *buffer;
+    size_t nbyte;
+    SYS_FS_RESULT result;
+
+} testRequeue;
+
+static uint8_t testData[TEST_FILE_SIZE];
+static uint8_t testBuffer[TEST_FILE_SIZE + 2048U];
+static BYTE testWork[FF_MAX_SS * 8U];
+
+static uint8_t testByte(uint32_t offset, uint32_t seed)
+{
+    return (uint8_t)(((offset * 7U) + (offset >> 9) + seed) & 0xFFU);
+}
+
+static void testCallback(SYS_FS_HANDLE handle, SYS_FS_RESULT result, size_t nbyte, uintptr_t context)
+{
+    if (testNCallbacks < TEST_CALLBACKS_MAX)
+    {
+        testCallbacks[testNCallbacks].handle = handle;
+        testCallbacks[testNCallbacks].result = result;
+        testCallbacks[testNCallbacks].nbyte = nbyte;
+        testCallbacks[testNCallbacks].context = context;
+    }
+
+    testNCallbacks++;
+
+    if ((context == 1U) && (testRequeue.buffer != NULL))
+    {
+        /* The queue is full until the request of the callback is removed */
+        testRequeue.result = SYS_FS_FileReadAsync(handle, testRequeue.buffer, testRequeue.nbyte, testCallback, 2U);
+    }
+}
+
+static void testCallbacksReset(void)
+{
+    (void) memset(testCallbacks, 0, sizeof(testCallbacks));
+    testNCallbacks = 0U;
+    (void) memset(&testRequeue, 0, sizeof(testRequeue));
+}
+
+/* Runs SYS_FS_Tasks until nCallbacks callbacks were called. Counts the calls
+ * that return with a transfer in progress. */
+static uint32_t testTasksRun(uint32_t nCallbacks, uint32_t *nBusyReturns)
+{
+    uint32_t nTasks = 0U;
+
+    *nBusyReturns = 0U;
+
+    while ((testNCallbacks < nCallbacks) && (nTasks < TEST_TASKS_MAX))
+    {
+        SYS_FS_Tasks();
+        nTasks++;
+
+        if (gRamDisk.isTransferBusy == true)
+        {
+            (*nBusyReturns)++;
+        }
+    }
+
+    return nTasks;
+}
+
+static bool testMount(void)
+{
+    MKFS_PARM opt = {FM_FAT, 0U, 0U, 0U, 0U};
+
+    if ((RAM_DISK_Create(TEST_DISK_SECTORS) == false) || (f_mkfs("", &opt, testWork, sizeof(testWork)) != FR_OK))
+    {
+        return false;
+    }
+
+    if (SYS_FS_Initialize((const void *)testFsInit) != SYS_FS_RES_SUCCESS)
+    {
+        return false;
+    }
+
+    if (SYS_FS_Mount(VOLUME_MODEL_DEVICE_NAME, TEST_MOUNT_NAME, FAT, 0, NULL) != SYS_FS_RES_SUCCESS)
+    {
+        return false;
+    }
+
+    return (SYS_FS_DirectoryMake(TEST_DIR_NAME) == SYS_FS_RES_SUCCESS);
+}
+
+static bool testFileCheck(const char *path, uint32_t size, uint32_t seed)
+{
+    SYS_FS_HANDLE handle = SYS_FS_FileOpen(path, SYS_FS_FILE_OPEN_READ);
+    bool isEqual = false;
+    uint32_t i;
+
+    if (handle == SYS_FS_HANDLE_INVALID)
+    {
+        return false;
+    }
+
+    isEqual = ((uint32_t)SYS_FS_FileSize(handle) == size) &&
+            (SYS_FS_FileRead(handle, testBuffer, size) == size);
+
+    for (i = 0U; (i < size) && (isEqual == true); i++)
+    {
+        isEqual = (testBuffer[i] == testByte(i, seed));
+    }
+
+    (void) SYS_FS_FileClose(handle);
+
+    return isEqual;
+}
+
+// *****************************************************************************
+// Section: Queue
+// *****************************************************************************
+
+static void testQueue(void)
+{
+    SYS_FS_HANDLE handle;
+    uint32_t nBusyReturns = 0U;
+    uint32_t nTasks;
+    uint32_t i;
+
+    for (i = 0U; i < TEST_FILE_SIZE; i++)
+    {
+        testData[i] = testByte(i, 0U);
+    }
+
+    testCallbacksReset();
+    RAM_DISK_StatisticsReset();
+
+    handle = SYS_FS_FileOpen(TEST_FILE_NAME, SYS_FS_FILE_OPEN_WRITE);
+    TEST_CHECK(handle != SYS_FS_HANDLE_INVALID);
+
+    /* Two requests fill the queue */
+    TEST_CHECK_EQUAL(SYS_FS_FileWriteAsync(handle, testData, TEST_WRITE_SIZE_1, testCallback, 10U), SYS_FS_RES_SUCCESS);
+    TEST_CHECK_EQUAL(SYS_FS_FileWriteAsync(handle, &testData[TEST_WRITE_SIZE_1], TEST_WRITE_SIZE_2, testCallback, 11U), SYS_FS_RES_SUCCESS);
+    TEST_CHECK_EQUAL(SYS_FS_FileWriteAsync(handle, testData, 1U, testCallback, 12U), SYS_FS_RES_FAILURE);
+    TEST_CHECK_EQUAL(SYS_FS_Error(), SYS_FS_ERROR_NOT_ENOUGH_CORE);
+    TEST_CHECK_EQUAL(SYS_FS_FileReadAsync(SYS_FS_HANDLE_INVALID, testBuffer, 1U, testCallback, 12U), SYS_FS_RES_FAILURE);
+
+    /* Nothing is written before SYS_FS_Tasks runs */
+    TEST_CHECK_EQUAL(gRamDisk.nWriteCommands, 0U);
+
+    nTasks = testTasksRun(2U, &nBusyReturns);
+
+    /* In the order they were queued */
+    TEST_CHECK_EQUAL(testNCallbacks, 2U);
+    TEST_CHECK_EQUAL(testCallbacks[0].context, 10U);
+    TEST_CHECK_EQUAL(testCallbacks[0].result, SYS_FS_RES_SUCCESS);
+    TEST_CHECK_EQUAL(testCallbacks[0].nbyte, TEST_WRITE_SIZE_1);
+    TEST_CHECK(testCallbacks[0].handle == handle);
+    TEST_CHECK_EQUAL(testCallbacks[1].context, 11U);
+    TEST_CHECK_EQUAL(testCallbacks[1].result, SYS_FS_RES_SUCCESS);
+    TEST_CHECK_EQUAL(testCallbacks[1].nbyte, TEST_WRITE_SIZE_2);
+
+    /* 9 whole sectors of the first write; the second starts 392 bytes into
+     * its sector, 120 bytes reach the boundary, 5 whole sectors follow. Each
+     * transfer is in progress when the call that started it returns, and no
+     * access waits for one. */
+    TEST_CHECK_EQUAL(gRamDisk.nTransfers, 14U);
+    TEST_CHECK_EQUAL(nBusyReturns, gRamDisk.nTransfers);
+    TEST_CHECK_EQUAL(gRamDisk.nTransferWaits, 0U);
+    TEST_CHECK_EQUAL(SYS_FS_FileTell(handle), TEST_FILE_SIZE);
+    TEST_CHECK_EQUAL(SYS_FS_FileSize(handle), TEST_FILE_SIZE);
+
+    (void) printf("file_async: %u + %u bytes written in %u SYS_FS_Tasks calls, %u sector transfers\n",
+            TEST_WRITE_SIZE_1, TEST_WRITE_SIZE_2, (unsigned int)nTasks, (unsigned int)gRamDisk.nTransfers);
+
+    /* The queue is empty: SYS_FS_Tasks has nothing to do */
+    SYS_FS_Tasks();
+    TEST_CHECK_EQUAL(testNCallbacks, 2U);
+
+    TEST_CHECK_EQUAL(SYS_FS_FileClose(handle), SYS_FS_RES_SUCCESS);
+    TEST_CHECK(testFileCheck(TEST_FILE_NAME, TEST_FILE_SIZE, 0U) == true);
+}
+
+// *****************************************************************************
+// Section: Reads
+// *****************************************************************************
+
+static void testRead(void)
+{
+    SYS_FS_HANDLE handle;
+    uint32_t nBusyReturns = 0U;
+    uint32_t i;
+
+    testCallbacksReset();
+    RAM_DISK_StatisticsReset();
+    (void) memset(testBuffer, 0, sizeof(testBuffer));
+
+    handle = SYS_FS_FileOpen(TEST_FILE_NAME, SYS_FS_FILE_OPEN_READ);
+    TEST_CHECK(handle != SYS_FS_HANDLE_INVALID);
+
+    /* The callback of the first read queues the second one, past the end of
+     * the file */
+    testRequeue.buffer = &testBuffer[4096U];
+    testRequeue.nbyte = sizeof(testBuffer) - 4096U;
+    testRequeue.result = SYS_FS_RES_FAILURE;
+
+    TEST_CHECK_EQUAL(SYS_FS_FileReadAsync(handle, testBuffer, 4096U, testCallback, 1U), SYS_FS_RES_SUCCESS);
+    TEST_CHECK_EQUAL(SYS_FS_FileReadAsync(handle, testBuffer, 1U, testCallback, 3U), SYS_FS_RES_SUCCESS);
+
+    /* The third request of the queue is refused until the first ends */
+    TEST_CHECK_EQUAL(SYS_FS_FileReadAsync(handle, testBuffer, 1U, testCallback, 4U), SYS_FS_RES_FAILURE);
+
+    /* Request 3, queued before request 2, reads one byte between them:
+     * request 2 is the one that reaches the end of the file */
+    (void) testTasksRun(3U, &nBusyReturns);
+
+    TEST_CHECK_EQUAL(testRequeue.result, SYS_FS_RES_SUCCESS);
+    TEST_CHECK_EQUAL(testNCallbacks, 3U);
+    TEST_CHECK_EQUAL(testCallbacks[0].context, 1U);
+    TEST_CHECK_EQUAL(testCallbacks[0].nbyte, 4096U);
+    TEST_CHECK_EQUAL(testCallbacks[1].context, 3U);
+    TEST_CHECK_EQUAL(testCallbacks[1].nbyte, 1U);
+    TEST_CHECK_EQUAL(testCallbacks[2].context, 2U);
+    TEST_CHECK_EQUAL(testCallbacks[2].result, SYS_FS_RES_SUCCESS);
+    TEST_CHECK_EQUAL(testCallbacks[2].nbyte, TEST_FILE_SIZE - 4097U);
+
+    /* 8 sectors, 1 byte, 511 bytes to the boundary, 6 sectors and the 320
+     * bytes of the last sector */
+    TEST_CHECK_EQUAL(gRamDisk.nTransfers, 14U);
+    TEST_CHECK_EQUAL(nBusyReturns, gRamDisk.nTransfers);
+    TEST_CHECK_EQUAL(gRamDisk.nTransferWaits, 0U);
+    TEST_CHECK_EQUAL(testBuffer[0], testByte(4096U, 0U));
+
+    for (i = 1U; i < 4096U; i++)
+    {
+        if (testBuffer[i] != testByte(i, 0U))
+        {
+            break;
+        }
+    }
+
+    TEST_CHECK_EQUAL(i, 4096U);
+
+    for (i = 4096U; i < (TEST_FILE_SIZE - 1U); i++)
+    {
+        if (testBuffer[i] != testByte(i + 1U, 0U))
+        {
+            break;
+        }
+    }
+
+    TEST_CHECK_EQUAL(i, TEST_FILE_SIZE - 1U);
+    TEST_CHECK_EQUAL(testBuffer[TEST_FILE_SIZE - 1U], 0U);
+
+    TEST_CHECK_EQUAL(SYS_FS_FileClose(handle), SYS_FS_RES_SUCCESS);
+}
+
+// *****************************************************************************
+// Section: Overwrite and other accesses
+// *****************************************************************************
+
+static void testOverwrite(void)
+{
+    SYS_FS_HANDLE handle;
+    SYS_FS_FSTAT stat;
+    uint32_t nBusyReturns = 0U;
+    uint32_t i;
+
+    for (i = 0U; i < TEST_FILE_SIZE; i++)
+    {
+        testData[i] = testByte(i, 1U);
+    }
+
+    testCallbacksReset();
+    RAM_DISK_StatisticsReset();
+
+    handle = SYS_FS_FileOpen(TEST_FILE_NAME, SYS_FS_FILE_OPEN_READ_PLUS);
+    TEST_CHECK(handle != SYS_FS_HANDLE_INVALID);
+
+    /* The first sector is in the file buffer of FatFs */
+    TEST_CHECK_EQUAL(SYS_FS_FileRead(handle, testBuffer, 100U), 100U);
+    TEST_CHECK_EQUAL(SYS_FS_FileSeek(handle, 0, SYS_FS_SEEK_SET), 0);
+
+    TEST_CHECK_EQUAL(SYS_FS_FileWriteAsync(handle, testData, 2048U, testCallback, 20U), SYS_FS_RES_SUCCESS);
+
+    /* Another module looks up a file while the first sector is transferred:
+     * the read of the subdirectory waits for the transfer */
+    SYS_FS_Tasks();
+    TEST_CHECK(gRamDisk.isTransferBusy == true);
+    TEST_CHECK_EQUAL(SYS_FS_FileStat(TEST_DIR_NAME "/none.txt", &stat), SYS_FS_RES_FAILURE);
+    TEST_CHECK_EQUAL(SYS_FS_Error(), SYS_FS_ERROR_NO_FILE);
+    TEST_CHECK_EQUAL(gRamDisk.nTransferWaits, 1U);
+    TEST_CHECK(gRamDisk.isTransferBusy == false);
+
+    (void) testTasksRun(1U, &nBusyReturns);
+    TEST_CHECK_EQUAL(testNCallbacks, 1U);
+    TEST_CHECK_EQUAL(testCallbacks[0].result, SYS_FS_RES_SUCCESS);
+    TEST_CHECK_EQUAL(testCallbacks[0].nbyte, 2048U);
+    TEST_CHECK_EQUAL(gRamDisk.nTransfers, 4U);
+
+    /* The file is not stretched; the first sector is read again from the
+     * disk, not from the file buffer */
+    TEST_CHECK_EQUAL(SYS_FS_FileSize(handle), TEST_FILE_SIZE);
+    TEST_CHECK_EQUAL(SYS_FS_FileSeek(handle, 0, SYS_FS_SEEK_SET), 0);
+    TEST_CHECK_EQUAL(SYS_FS_FileRead(handle, testBuffer, 100U), 100U);
+
+    for (i = 0U; i < 100U; i++)
+    {
+        if (testBuffer[i] != testByte(i, 1U))
+        {
+            break;
+        }
+    }
+
+    TEST_CHECK_EQUAL(i, 100U);
+    TEST_CHECK_EQUAL(SYS_FS_FileClose(handle), SYS_FS_RES_SUCCESS);
+
+    /* The rest of the file is unchanged */
+    handle = SYS_FS_FileOpen(TEST_FILE_NAME, SYS_FS_FILE_OPEN_READ);
+    TEST_CHECK(handle != SYS_FS_HANDLE_INVALID);
+    TEST_CHECK_EQUAL(SYS_FS_FileRead(handle, testBuffer, TEST_FILE_SIZE), TEST_FILE_SIZE);
+
+    for (i = 0U; i < TEST_FILE_SIZE; i++)
+    {
+        if (testBuffer[i] != testByte(i, (i < 2048U) ? 1U : 0U))
+        {
+            break;
+        }
+    }
+
+    TEST_CHECK_EQUAL(i, TEST_FILE_SIZE);
+    TEST_CHECK_EQUAL(SYS_FS_FileClose(handle), SYS_FS_RES_SUCCESS);
+}
+
+// *****************************************************************************
+// Section: Cancel on close
+// *****************************************************************************
+
+static void testCancel(void)
+{
+    SYS_FS_HANDLE handle;
+    uint32_t nBusyReturns = 0U;
+    uint32_t i;
+
+    for (i = 0U; i < TEST_FILE_SIZE; i++)
+    {
+        testData[i] = testByte(i, 2U);
+    }
+
+    testCallbacksReset();
+    RAM_DISK_StatisticsReset();
+
+    handle = SYS_FS_FileOpen(TEST_OTHER_NAME, SYS_FS_FILE_OPEN_WRITE);
+    TEST_CHECK(handle != SYS_FS_HANDLE_INVALID);
+
+    TEST_CHECK_EQUAL(SYS_FS_FileWriteAsync(handle, testData, 4096U, testCallback, 30U), SYS_FS_RES_SUCCESS);
+    TEST_CHECK_EQUAL(SYS_FS_FileWriteAsync(handle, &testData[4096U], 4096U, testCallback, 31U), SYS_FS_RES_SUCCESS);
+
+    /* The first sector is allocated and its transfer is in progress */
+    SYS_FS_Tasks();
+    TEST_CHECK(gRamDisk.isTransferBusy == true);
+
+    /* The close calls no callback. The size of the file was written when
+     * the sector was allocated: the transfer is still in progress. */
+    TEST_CHECK_EQUAL(SYS_FS_FileClose(handle), SYS_FS_RES_SUCCESS);
+    TEST_CHECK_EQUAL(testNCallbacks, 0U);
+    TEST_CHECK(gRamDisk.isTransferBusy == true);
+
+    /* The transfer ends, then both requests end with a failure, in order */
+    SYS_FS_Tasks();
+    TEST_CHECK(gRamDisk.isTransferBusy == false);
+    TEST_CHECK_EQUAL(testNCallbacks, 1U);
+    SYS_FS_Tasks();
+    TEST_CHECK_EQUAL(testNCallbacks, 2U);
+    TEST_CHECK_EQUAL(testCallbacks[0].context, 30U);
+    TEST_CHECK_EQUAL(testCallbacks[0].result, SYS_FS_RES_FAILURE);
+    TEST_CHECK_EQUAL(testCallbacks[1].context, 31U);
+    TEST_CHECK_EQUAL(testCallbacks[1].result, SYS_FS_RES_FAILURE);
+    TEST_CHECK_EQUAL(gRamDisk.nTransfers, 1U);
+
+    /* The file holds the sector written before the close */
+    TEST_CHECK(testFileCheck(TEST_OTHER_NAME, 512U, 2U) == true);
+
+    /* The queue is free again */
+    handle = SYS_FS_FileOpen(TEST_OTHER_NAME, SYS_FS_FILE_OPEN_APPEND);
+    TEST_CHECK(handle != SYS_FS_HANDLE_INVALID);
+    TEST_CHECK_EQUAL(SYS_FS_FileWriteAsync(handle, &testData[512U], 1000U, testCallback, 32U), SYS_FS_RES_SUCCESS);
+    (void) testTasksRun(3U, &nBusyReturns);
+    TEST_CHECK_EQUAL(testNCallbacks, 3U);
+    TEST_CHECK_EQUAL(testCallbacks[2].result, SYS_FS_RES_SUCCESS);
+    TEST_CHECK_EQUAL(SYS_FS_FileClose(handle), SYS_FS_RES_SUCCESS);
+    TEST_CHECK(testFileCheck(TEST_OTHER_NAME, 1512U, 2U) == true);
+}
+
+int main( int argc, char *argv[] )
+{
+    int result;
+
+    TEST_CHECK(testMount() == true);
+
+    testQueue();
+    testRead();
+    testOverwrite();
+    testCancel();
+
+    TEST_CHECK_EQUAL(SYS_FS_Unmount(TEST_MOUNT_NAME), SYS_FS_RES_SUCCESS);
+    TEST_CHECK_EQUAL(gRamDisk.errOutOfRange, 0U);
+
+    result = TEST_RESULT("file_async");
+    RAM_DISK_Destroy();
+
+    return result;
+}
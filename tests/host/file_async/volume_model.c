@@ -0,0 +1,50 @@
+/*******************************************************************************
+  RAM Disk Volume Model
+
+  File Name:
+    volume_model.c
+
+  Summary:
+    Media manager functions called by SYS_FS, for one volume on the RAM disk.
+
+  Description:
+    See volume_model.h.
+*******************************************************************************/
+
+#include <string.h>
+#include "ram_disk.h"
+#include "volume_model.h"
+
+VOLUME_MODEL gVolumeModel;
+
+bool SYS_FS_MEDIA_MANAGER_MediaStatusGet( const char *volumeName )
+{
+    return ((strcmp(volumeName, VOLUME_MODEL_DEVICE_NAME) == 0) && (gRamDisk.data != NULL));
+}
+
+bool SYS_FS_MEDIA_MANAGER_VolumePropertyGet( const char *volumeName, SYS_FS_VOLUME_PROPERTY *property )
+{
+    if (SYS_FS_MEDIA_MANAGER_MediaStatusGet(volumeName) == false)
+    {
+        return false;
+    }
+
+    property->volNumber = 0U;
+    property->fsType = FAT;
+
+    return true;
+}
+
+void SYS_FS_MEDIA_MANAGER_Tasks( void )
+{
+    gVolumeModel.nTasks++;
+
+    RAM_DISK_TransferTasks();
+}
+
+uintptr_t SYS_FS_MEDIA_MANAGER_SectorAddressGet( uint16_t diskNum, uint32_t sector, uint32_t offset, uint32_t *nBytes )
+{
+    *nBytes = 0U;
+
+    return 0U;
+}
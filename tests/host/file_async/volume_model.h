@@ -0,0 +1,34 @@
+/*******************************************************************************
+  RAM Disk Volume Model
+
+  File Name:
+    volume_model.h
+
+  Summary:
+    Media manager functions called by SYS_FS, for one volume on the RAM disk.
+
+  Description:
+    SYS_FS mounts the volume VOLUME_MODEL_DEVICE_NAME, which is the FAT
+    volume of drive 0 of the RAM disk. SYS_FS_MEDIA_MANAGER_Tasks, called
+    first by SYS_FS_Tasks, stands for the media driver tasks: it does the
+    RAM disk transfer in progress. The RAM disk is not memory mapped.
+*******************************************************************************/
+
+#ifndef VOLUME_MODEL_H
+#define VOLUME_MODEL_H
+
+#include <stdint.h>
+#include "system/fs/sys_fs_media_manager.h"
+
+#define VOLUME_MODEL_DEVICE_NAME        "/dev/nvma1"
+
+typedef struct
+{
+    /* Calls of SYS_FS_MEDIA_MANAGER_Tasks */
+    uint32_t nTasks;
+
+} VOLUME_MODEL;
+
+extern VOLUME_MODEL gVolumeModel;
+
+#endif // VOLUME_MODEL_H
@@ -0,0 +1,45 @@
+/* Configuration of the file map host test: the SYS_FS settings of the
+ * nvm_fat application, with its media manager sector cache, on DRV_MEMORY
+ * instance 0 with the flash translation layer over the NVMCTRL, without the
+ * DMA memory service. */
+#ifndef CONFIGURATION_H
+#define CONFIGURATION_H
+
+#include "device.h"
+
+#define SYS_FS_MEDIA_NUMBER               (1U)
+#define SYS_FS_VOLUME_NUMBER              (1U)
+
+#define SYS_FS_AUTOMOUNT_ENABLE           false
+#define SYS_FS_MAX_FILES                  (1U)
+#define SYS_FS_FILE_ASYNC_QUEUE_SIZE      (2U)
+#define SYS_FS_FILE_ASYNC_CHUNK_SIZE      (512U)
+#define SYS_FS_MAX_FILE_SYSTEM_TYPE       (1U)
+#define SYS_FS_MEDIA_MAX_BLOCK_SIZE       (512U)
+#define SYS_FS_MEDIA_MANAGER_BUFFER_SIZE  (2048U)
+#define SYS_FS_MEDIA_MANAGER_CACHE_SECTORS (4U)
+#define SYS_FS_USE_LFN                    (1)
+#define SYS_FS_FILE_NAME_LEN              (255U)
+#define SYS_FS_CWD_STRING_LEN             (1024)
+
+#define SYS_FS_FAT_VERSION                "v0.15"
+#define SYS_FS_FAT_READONLY               false
+#define SYS_FS_FAT_CODE_PAGE              437
+#define SYS_FS_FAT_MAX_SS                 SYS_FS_MEDIA_MAX_BLOCK_SIZE
+
+#define DRV_MEMORY_INDEX_0                   0
+#define DRV_MEMORY_CLIENTS_NUMBER_IDX0       1
+#define DRV_MEMORY_BUF_Q_SIZE_IDX0           1
+#define DRV_MEMORY_DEVICE_START_ADDRESS      0x20000U
+#define DRV_MEMORY_DEVICE_MEDIA_SIZE         128UL
+#define DRV_MEMORY_DEVICE_MEDIA_SIZE_BYTES   (DRV_MEMORY_DEVICE_MEDIA_SIZE * 1024U)
+#define DRV_MEMORY_DEVICE_PROGRAM_SIZE       64U
+#define DRV_MEMORY_DEVICE_ERASE_SIZE         256U
+
+#define DRV_MEMORY_FTL_ENABLE
+#define DRV_MEMORY_FTL_SECTORS_IDX0          (192U)
+#define DRV_MEMORY_FTL_JOURNAL_BLOCKS_IDX0   (16U)
+
+#define DRV_MEMORY_INSTANCES_NUMBER          (1U)
+
+#endif // CONFIGURATION_H
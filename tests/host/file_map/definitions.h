@@ -0,0 +1,11 @@
+/* Host stand-in for the definitions header of the application. The NVMCTRL
+ * memory device driver only needs the NVMCTRL PLIB, provided by the flash
+ * model, and its own prototypes. */
+#ifndef DEFINITIONS_H
+#define DEFINITIONS_H
+
+#include "configuration.h"
+#include "peripheral/nvmctrl/plib_nvmctrl.h"
+#include "driver/memory/drv_memory_nvmctrl.h"
+
+#endif // DEFINITIONS_H
@@ -0,0 +1,188 @@
+/*******************************************************************************
+  NVMCTRL Flash Model
+
+  File Name:
+    nvm_model.c
+
+  Summary:
+    Model of the NVMCTRL peripheral library over the flash region that
+    DRV_MEMORY instance 0 of the nvm_fat application uses.
+
+  Description:
+    See nvm_model.h.
+*******************************************************************************/
+
+#include <string.h>
+#include "nvm_model.h"
+
+NVM_MODEL gNvmModel;
+
+void NVM_MODEL_Reset( void )
+{
+    (void) memset(&gNvmModel, 0, sizeof(gNvmModel));
+    (void) memset(gNvmModel.data, 0xFF, sizeof(gNvmModel.data));
+}
+
+void NVM_MODEL_StatisticsReset( void )
+{
+    gNvmModel.nReads = 0U;
+    gNvmModel.nPrograms = 0U;
+    gNvmModel.nErases = 0U;
+}
+
+const uint8_t *NVM_MODEL_Pointer( uintptr_t address, uint32_t length )
+{
+    if ((address < NVM_MODEL_START_ADDRESS) || ((address - NVM_MODEL_START_ADDRESS) > NVM_MODEL_SIZE) ||
+        (length > (NVM_MODEL_SIZE - (address - NVM_MODEL_START_ADDRESS))))
+    {
+        return NULL;
+    }
+
+    return &gNvmModel.data[address - NVM_MODEL_START_ADDRESS];
+}
+
+uint32_t NVM_MODEL_Errors( void )
+{
+    return gNvmModel.errOutOfRange + gNvmModel.errAlignment + gNvmModel.errCommandWhileBusy + gNvmModel.errProgramNotErased;
+}
+
+void NVM_MODEL_PowerCut( uint32_t operation, uint32_t length )
+{
+    gNvmModel.cutOperation = (operation == 0U) ? 0U : (gNvmModel.nOperations + operation);
+    gNvmModel.cutLength = length;
+}
+
+void NVM_MODEL_PowerOn( void )
+{
+    gNvmModel.cutOperation = 0U;
+    gNvmModel.isPowerLost = false;
+    gNvmModel.busyPolls = 0U;
+}
+
+/* Checks a command and returns its offset in the array */
+static bool lNVM_MODEL_CommandCheck( uint32_t address, uint32_t length, uint32_t alignment, uint32_t *offset )
+{
+    if (gNvmModel.isPowerLost == true)
+    {
+        return false;
+    }
+
+    if (gNvmModel.busyPolls != 0U)
+    {
+        gNvmModel.errCommandWhileBusy++;
+        return false;
+    }
+
+    if (NVM_MODEL_Pointer(address, length) == NULL)
+    {
+        gNvmModel.errOutOfRange++;
+        return false;
+    }
+
+    if ((address % alignment) != 0U)
+    {
+        gNvmModel.errAlignment++;
+        return false;
+    }
+
+    *offset = address - NVM_MODEL_START_ADDRESS;
+
+    return true;
+}
+
+/* Counts a program or erase operation and returns the number of bytes it
+ * changes, fewer than its size when the power is cut during it */
+static uint32_t lNVM_MODEL_OperationLength( uint32_t size )
+{
+    gNvmModel.nOperations++;
+
+    if (gNvmModel.nOperations != gNvmModel.cutOperation)
+    {
+        return size;
+    }
+
+    gNvmModel.isPowerLost = true;
+
+    return (gNvmModel.cutLength < size) ? gNvmModel.cutLength : size;
+}
+
+// *****************************************************************************
+// Section: NVMCTRL PLIB
+// *****************************************************************************
+
+bool NVMCTRL_Read( uint32_t *data, uint32_t length, const uint32_t address )
+{
+    uint32_t offset = 0U;
+
+    if (lNVM_MODEL_CommandCheck(address, length, 1U, &offset) == false)
+    {
+        return false;
+    }
+
+    (void) memcpy((void *)data, &gNvmModel.data[offset], length);
+    gNvmModel.nReads++;
+
+    return true;
+}
+
+bool NVMCTRL_PageWrite( uint32_t *data, const uint32_t address )
+{
+    const uint8_t *source = (const uint8_t *)data;
+    uint32_t offset = 0U;
+    uint32_t length;
+    uint32_t i;
+
+    if (lNVM_MODEL_CommandCheck(address, NVM_MODEL_PAGE_SIZE, NVM_MODEL_PAGE_SIZE, &offset) == false)
+    {
+        return false;
+    }
+
+    for (i = 0U; i < NVM_MODEL_PAGE_SIZE; i++)
+    {
+        if ((source[i] & (uint8_t)~gNvmModel.data[offset + i]) != 0U)
+        {
+            gNvmModel.errProgramNotErased++;
+            break;
+        }
+    }
+
+    length = lNVM_MODEL_OperationLength(NVM_MODEL_PAGE_SIZE);
+
+    for (i = 0U; i < length; i++)
+    {
+        gNvmModel.data[offset + i] &= source[i];
+    }
+
+    gNvmModel.nPrograms++;
+    gNvmModel.busyPolls = NVM_MODEL_PROGRAM_BUSY_POLLS;
+
+    return true;
+}
+
+bool NVMCTRL_RowErase( uint32_t address )
+{
+    uint32_t offset = 0U;
+
+    if (lNVM_MODEL_CommandCheck(address, NVM_MODEL_ROW_SIZE, NVM_MODEL_ROW_SIZE, &offset) == false)
+    {
+        return false;
+    }
+
+    (void) memset(&gNvmModel.data[offset], 0xFF, lNVM_MODEL_OperationLength(NVM_MODEL_ROW_SIZE));
+
+    gNvmModel.nErases++;
+    gNvmModel.busyPolls = NVM_MODEL_ERASE_BUSY_POLLS;
+
+    return true;
+}
+
+bool NVMCTRL_IsBusy( void )
+{
+    if ((gNvmModel.busyPolls != 0U) && (gNvmModel.isPowerLost == false))
+    {
+        gNvmModel.busyPolls--;
+        return true;
+    }
+
+    return false;
+}
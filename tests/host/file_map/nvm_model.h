@@ -0,0 +1,93 @@
+/*******************************************************************************
+  NVMCTRL Flash Model
+
+  File Name:
+    nvm_model.h
+
+  Summary:
+    Model of the NVMCTRL peripheral library over the flash region that
+    DRV_MEMORY instance 0 of the nvm_fat application uses.
+
+  Description:
+    The model provides the NVMCTRL PLIB functions called by the NVMCTRL
+    memory device driver (drv_memory_nvmctrl.c) on an array that stands for
+    the main flash from NVMCTRL_START_ADDRESS on. The flash is memory mapped
+    on the device: NVM_MODEL_Pointer gives the array location of a device
+    address, so that a test can read the data at an address returned by the
+    driver the way the CPU does.
+
+    A row erase sets a row to 0xFF and a page write can only clear bits;
+    both keep NVMCTRL busy for a number of status reads. Misaligned, out of
+    range and overlapping commands, and pages programmed over data that is
+    not erased, are counted instead of aborting so that a test can report
+    them.
+
+    A power cut can be set on a program or erase operation: the operation
+    only changes its first bytes and every command after it fails until
+    NVM_MODEL_PowerOn is called.
+*******************************************************************************/
+
+#ifndef NVM_MODEL_H
+#define NVM_MODEL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "peripheral/nvmctrl/plib_nvmctrl.h"
+
+#define NVM_MODEL_START_ADDRESS         NVMCTRL_START_ADDRESS
+#define NVM_MODEL_SIZE                  (NVMCTRL_MEDIA_SIZE * 1024U)
+#define NVM_MODEL_PAGE_SIZE             NVMCTRL_FLASH_PAGESIZE
+#define NVM_MODEL_ROW_SIZE              NVMCTRL_FLASH_ROWSIZE
+
+/* Status reads that return busy after a page write or a row erase */
+#define NVM_MODEL_PROGRAM_BUSY_POLLS    (2U)
+#define NVM_MODEL_ERASE_BUSY_POLLS      (5U)
+
+typedef struct
+{
+    uint8_t data[NVM_MODEL_SIZE];
+
+    uint32_t busyPolls;
+
+    /* Program and erase operations issued, operation torn by the power cut
+     * (0: none) and number of bytes it changes */
+    uint32_t nOperations;
+    uint32_t cutOperation;
+    uint32_t cutLength;
+    bool isPowerLost;
+
+    /* Statistics */
+    uint32_t nReads;
+    uint32_t nPrograms;
+    uint32_t nErases;
+
+    /* Misuse: commands out of the region, not aligned to a page or a row,
+     * issued while busy, pages programmed over bits that are not erased */
+    uint32_t errOutOfRange;
+    uint32_t errAlignment;
+    uint32_t errCommandWhileBusy;
+    uint32_t errProgramNotErased;
+
+} NVM_MODEL;
+
+extern NVM_MODEL gNvmModel;
+
+/* Erases the flash and clears the state and the counters */
+void NVM_MODEL_Reset( void );
+
+void NVM_MODEL_StatisticsReset( void );
+
+/* Array location of length bytes at a device address, NULL if the range is
+ * not in the region */
+const uint8_t *NVM_MODEL_Pointer( uintptr_t address, uint32_t length );
+
+uint32_t NVM_MODEL_Errors( void );
+
+/* Cuts the power during program or erase operation number operation (1 for
+ * the next one), after length bytes of the page or row have changed */
+void NVM_MODEL_PowerCut( uint32_t operation, uint32_t length );
+
+/* Restores the power, the flash keeps its contents */
+void NVM_MODEL_PowerOn( void );
+
+#endif // NVM_MODEL_H
@@ -0,0 +1,543 @@
+/*******************************************************************************
+  File Map Host Test
+
+  File Name:
+    test_file_map.c
+
+  Summary:
+    Maps files of a FAT volume on the nvm_fat NVM media for direct reads.
+
+  Description:
+    sys_fs.c, the FAT interface, FatFs, diskio.c and the media manager, with
+    its sector cache, run on DRV_MEMORY instance 0 of the nvm_fat
+    application: the flash translation layer over the NVMCTRL memory device
+    driver, on a model of the NVMCTRL whose flash is memory mapped. The
+    volume is formatted with two sectors per cluster.
+
+    Every range returned by SYS_FS_FileMap is read from the flash model at
+    the returned address and compared with SYS_FS_FileRead of the same
+    range. The test checks ranges crossing cluster boundaries in a
+    contiguous file, the end of each run of clusters in a fragmented file,
+    the clamp at the end of the file, the end of a range at a sector that
+    the translation layer moved to another slot, and the data of the file
+    buffer and of the media manager cache written to the flash before a
+    range is mapped. The mapped data must stay in place while the stale
+    slots are erased in the background.
+*******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "test_host.h"
+#include "definitions.h"
+#include "nvm_model.h"
+#include "driver/memory/drv_memory.h"
+#include "system/fs/sys_fs.h"
+#include "system/fs/sys_fs_media_manager.h"
+#include "system/fs/sys_fs_fat_interface.h"
+
+#define TEST_DEVICE_NAME                "/dev/nvma1"
+#define TEST_MOUNT_NAME                 "/mnt/myDrive"
+#define TEST_TABLE_NAME                 TEST_MOUNT_NAME "/table.bin"
+#define TEST_FRAG_NAME_A                TEST_MOUNT_NAME "/a.bin"
+#define TEST_FRAG_NAME_B                TEST_MOUNT_NAME "/b.bin"
+
+#define TEST_SECTOR_SIZE                (512U)
+#define TEST_CLUSTER_SIZE               (2U * TEST_SECTOR_SIZE)
+
+/* Five clusters and part of a sixth */
+#define TEST_TABLE_SIZE                 ((5U * TEST_CLUSTER_SIZE) + 300U)
+
+/* Clusters appended in turn to the two fragmented files */
+#define TEST_FRAG_CLUSTERS              (4U)
+#define TEST_FRAG_SIZE                  (TEST_FRAG_CLUSTERS * TEST_CLUSTER_SIZE)
+
+/* Sector of the table rewritten in place, the start of its third cluster */
+#define TEST_MOVED_OFFSET               (2U * TEST_CLUSTER_SIZE)
+
+/* Calls of the system tasks after which a step must have ended */
+#define TEST_TASKS_MAX                  (100000U)
+
+#define TEST_EXTENTS_MAX                (16U)
+
+/* Not used: the volume is mounted by the test */
+const SYS_FS_MEDIA_MOUNT_DATA sysfsMountTable[SYS_FS_VOLUME_NUMBER] =
+{
+    {NULL}
+};
+
+// *****************************************************************************
+// Section: DRV_MEMORY instance 0 of nvm_fat
+// *****************************************************************************
+
+static uint8_t testEraseBuffer[NVMCTRL_ERASE_BUFFER_SIZE];
+static DRV_MEMORY_CLIENT_OBJECT testClientObject[DRV_MEMORY_CLIENTS_NUMBER_IDX0];
+static DRV_MEMORY_BUFFER_OBJECT testBufferObject[DRV_MEMORY_BUF_Q_SIZE_IDX0];
+static uint16_t testFtlMap[DRV_MEMORY_FTL_SECTORS_IDX0];
+static uint32_t testFtlSlotMap[DRV_MEMORY_FTL_SLOT_MAP_SIZE(DRV_MEMORY_DEVICE_MEDIA_SIZE_BYTES)];
+static uint32_t testFtlPageBuffer[DRV_MEMORY_DEVICE_PROGRAM_SIZE / 4U];
+
+static DRV_MEMORY_FTL_OBJECT testFtlObject =
+{
+    .map                        = &testFtlMap[0],
+    .slotMap                    = &testFtlSlotMap[0],
+    .pageBuffer                 = (uint8_t *)&testFtlPageBuffer[0],
+    .nSectors                   = DRV_MEMORY_FTL_SECTORS_IDX0,
+    .journalBlocks              = DRV_MEMORY_FTL_JOURNAL_BLOCKS_IDX0
+};
+
+static const DRV_MEMORY_DEVICE_INTERFACE testDeviceAPI =
+{
+    .Open               = DRV_NVMCTRL_Open,
+    .Close              = DRV_NVMCTRL_Close,
+    .Status             = DRV_NVMCTRL_Status,
+    .SectorErase        = DRV_NVMCTRL_SectorErase,
+    .Read               = DRV_NVMCTRL_Read,
+    .PageWrite          = DRV_NVMCTRL_PageWrite,
+    .EventHandlerSet    = NULL,
+    .GeometryGet        = (DRV_MEMORY_DEVICE_GEOMETRY_GET)DRV_NVMCTRL_GeometryGet,
+    .TransferStatusGet  = (DRV_MEMORY_DEVICE_TRANSFER_STATUS_GET)DRV_NVMCTRL_TransferStatusGet
+};
+
+static const DRV_MEMORY_INIT testMemoryInit =
+{
+    .memDevIndex                = 0,
+    .memoryDevice               = &testDeviceAPI,
+    .isMemDevInterruptEnabled   = false,
+    .isFsEnabled                = true,
+    .deviceMediaType            = (uint8_t)SYS_FS_MEDIA_TYPE_NVM,
+    .ewBuffer                   = &testEraseBuffer[0],
+    .clientObjPool              = (uintptr_t)&testClientObject[0],
+    .bufferObj                  = (uintptr_t)&testBufferObject[0],
+    .queueSize                  = DRV_MEMORY_BUF_Q_SIZE_IDX0,
+    .nClientsMax                = DRV_MEMORY_CLIENTS_NUMBER_IDX0,
+    .ftlObj                     = (uintptr_t)&testFtlObject
+};
+
+static SYS_MODULE_OBJ testDrvMemory0 = SYS_MODULE_OBJ_INVALID;
+
+// *****************************************************************************
+// Section: SYS_FS
+// *****************************************************************************
+
+static const SYS_FS_FUNCTIONS testFatFsFunctions =
+{
+    .mount             = FATFS_mount,
+    .unmount           = FATFS_unmount,
+    .open              = FATFS_open,
+    .read_t            = FATFS_read,
+    .close             = FATFS_close,
+    .seek              = FATFS_lseek,
+    .fstat             = FATFS_stat,
+    .getlabel          = FATFS_getlabel,
+    .currWD            = FATFS_getcwd,
+    .getstrn           = FATFS_gets,
+    .openDir           = FATFS_opendir,
+    .readDir           = FATFS_readdir,
+    .closeDir          = FATFS_closedir,
+    .chdir             = FATFS_chdir,
+    .chdrive           = FATFS_chdrive,
+    .write_t           = FATFS_write,
+    .tell              = FATFS_tell,
+    .eof               = FATFS_eof,
+    .size              = FATFS_size,
+    .mkdir             = FATFS_mkdir,
+    .remove_t          = FATFS_unlink,
+    .setlabel          = FATFS_setlabel,
+    .truncate          = FATFS_truncate,
+    .chmode            = FATFS_chmod,
+    .chtime            = FATFS_utime,
+    .rename_t          = FATFS_rename,
+    .sync              = FATFS_sync,
+    .putchr            = FATFS_putc,
+    .putstrn           = FATFS_puts,
+    .formattedprint    = FATFS_printf,
+    .testerror         = FATFS_error,
+    .formatDisk        = (FORMAT_DISK)FATFS_mkfs,
+    .partitionDisk     = FATFS_fdisk,
+    .getCluster        = FATFS_getclusters,
+    .seekIndex         = FATFS_linkmap,
+    .allocate          = FATFS_expand,
+    .extentGet         = FATFS_extent,
+    .sectorTransfer    = FATFS_transfer,
+    .sectorTransferStatus = FATFS_transferstatus,
+    .freeScan          = FATFS_freescan
+};
+
+static const SYS_FS_REGISTRATION_TABLE testFsInit[SYS_FS_MAX_FILE_SYSTEM_TYPE] =
+{
+    {
+        .nativeFileSystemType = FAT,
+        .nativeFileSystemFunctions = &testFatFsFunctions
+    }
+};
+
+static uint8_t testTable[TEST_TABLE_SIZE];
+static uint8_t testFrag[2][TEST_FRAG_SIZE];
+static uint8_t testBuffer[TEST_TABLE_SIZE];
+static uint8_t testWork[FF_MAX_SS];
+
+static struct
+{
+    const uint8_t *ptr;
+    uint32_t offset;
+    uint32_t length;
+
+} testExtents[TEST_EXTENTS_MAX];
+static uint32_t testNExtents;
+
+static uint8_t testByte(uint32_t offset, uint32_t seed)
+{
+    return (uint8_t)(((offset * 13U) + (offset >> 8) + (seed * 101U)) & 0xFFU);
+}
+
+/* The system tasks of nvm_fat for the file system and DRV_MEMORY instance 0 */
+static void testTasks(void)
+{
+    SYS_FS_Tasks();
+    DRV_MEMORY_Tasks(testDrvMemory0);
+}
+
+/* Runs the tasks until the translation layer has erased its stale slots */
+static bool testGcDrain(void)
+{
+    uint32_t i;
+
+    for (i = 0U; i < TEST_TASKS_MAX; i++)
+    {
+        if ((testFtlObject.gcState == DRV_MEMORY_FTL_GC_IDLE) && (testFtlObject.staleSlots == 0U) &&
+            (testFtlObject.isInactiveErased == true))
+        {
+            return true;
+        }
+
+        testTasks();
+    }
+
+    return false;
+}
+
+static bool testMount(void)
+{
+    SYS_FS_FORMAT_PARAM opt = {SYS_FS_FORMAT_FAT | SYS_FS_FORMAT_SFD, 0U, 0U, 0U, TEST_CLUSTER_SIZE};
+    uint32_t i;
+
+    NVM_MODEL_Reset();
+
+    testDrvMemory0 = DRV_MEMORY_Initialize((SYS_MODULE_INDEX)DRV_MEMORY_INDEX_0, (SYS_MODULE_INIT *)&testMemoryInit);
+
+    if ((testDrvMemory0 == SYS_MODULE_OBJ_INVALID) || (SYS_FS_Initialize((const void *)testFsInit) != SYS_FS_RES_SUCCESS))
+    {
+        return false;
+    }
+
+    /* The media manager opens the driver, which mounts the translation layer
+     * on the blank flash, and finds no file system */
+    for (i = 0U; i < TEST_TASKS_MAX; i++)
+    {
+        testTasks();
+
+        if (SYS_FS_Mount(TEST_DEVICE_NAME, TEST_MOUNT_NAME, FAT, 0, NULL) == SYS_FS_RES_SUCCESS)
+        {
+            break;
+        }
+    }
+
+    if (i == TEST_TASKS_MAX)
+    {
+        return false;
+    }
+
+    return (SYS_FS_DriveFormat(TEST_MOUNT_NAME, &opt, testWork, sizeof(testWork)) == SYS_FS_RES_SUCCESS);
+}
+
+static bool testFileWrite(const char *name, SYS_FS_FILE_OPEN_ATTRIBUTES attributes, const uint8_t *data, uint32_t size)
+{
+    SYS_FS_HANDLE handle = SYS_FS_FileOpen(name, attributes);
+    bool isDone = false;
+
+    if (handle == SYS_FS_HANDLE_INVALID)
+    {
+        return false;
+    }
+
+    isDone = (SYS_FS_FileWrite(handle, data, size) == size);
+
+    return ((SYS_FS_FileClose(handle) == SYS_FS_RES_SUCCESS) && (isDone == true));
+}
+
+/* Maps a range and checks the data at the address returned against the
+ * expected contents and SYS_FS_FileRead of the same bytes. Records the range
+ * for the check after the background erases. Returns the mapped length. */
+static uint32_t testMapCheck(SYS_FS_HANDLE handle, const uint8_t *contents, uint32_t size, uint32_t offset, uint32_t nbyte)
+{
+    const void *ptr = NULL;
+    const uint8_t *data = NULL;
+    int32_t position = SYS_FS_FileTell(handle);
+    size_t length = SYS_FS_FileMap(handle, offset, nbyte, &ptr);
+
+    TEST_CHECK(length != (size_t)-1);
+
+    if (length == (size_t)-1)
+    {
+        return 0U;
+    }
+
+    /* The file pointer is not moved */
+    TEST_CHECK_EQUAL(SYS_FS_FileTell(handle), position);
+
+    TEST_CHECK(length <= nbyte);
+
+    if ((offset >= size) || (nbyte == 0U))
+    {
+        TEST_CHECK_EQUAL(length, 0U);
+        return 0U;
+    }
+
+    TEST_CHECK(length <= (size - offset));
+    TEST_CHECK(length != 0U);
+
+    /* A range shorter than asked ends where the next byte is elsewhere on
+     * the device: mapping across its end stops at the end */
+    if ((length != 0U) && (length < nbyte) && (length < (size - offset)))
+    {
+        const void *next = NULL;
+
+        TEST_CHECK_EQUAL(SYS_FS_FileMap(handle, offset + (uint32_t)length - 1U, 2U, &next), 1U);
+    }
+
+    data = NVM_MODEL_Pointer((uintptr_t)ptr, (uint32_t)length);
+    TEST_CHECK(data != NULL);
+
+    if ((data == NULL) || (length == 0U))
+    {
+        return 0U;
+    }
+
+    TEST_CHECK(memcmp(data, &contents[offset], length) == 0);
+
+    TEST_CHECK_EQUAL(SYS_FS_FileSeek(handle, (int32_t)offset, SYS_FS_SEEK_SET), (int32_t)offset);
+    TEST_CHECK_EQUAL(SYS_FS_FileRead(handle, testBuffer, length), length);
+    TEST_CHECK(memcmp(data, testBuffer, length) == 0);
+    TEST_CHECK_EQUAL(SYS_FS_FileSeek(handle, position, SYS_FS_SEEK_SET), position);
+
+    if (testNExtents < TEST_EXTENTS_MAX)
+    {
+        testExtents[testNExtents].ptr = data;
+        testExtents[testNExtents].offset = offset;
+        testExtents[testNExtents].length = (uint32_t)length;
+        testNExtents++;
+    }
+
+    return (uint32_t)length;
+}
+
+// *****************************************************************************
+// Section: Contiguous file
+// *****************************************************************************
+
+static void testContiguous(void)
+{
+    SYS_FS_HANDLE handle;
+    uint32_t i;
+
+    for (i = 0U; i < TEST_TABLE_SIZE; i++)
+    {
+        testTable[i] = testByte(i, 1U);
+    }
+
+    /* The clusters of the file follow each other on the volume and its
+     * whole sectors are written in order to the free slots. The last sector,
+     * written through the sector cache when the file is closed, takes a slot
+     * of its own */
+    TEST_CHECK(testGcDrain() == true);
+    TEST_CHECK(testFileWrite(TEST_TABLE_NAME, SYS_FS_FILE_OPEN_WRITE, testTable, TEST_TABLE_SIZE) == true);
+    TEST_CHECK(testGcDrain() == true);
+
+    handle = SYS_FS_FileOpen(TEST_TABLE_NAME, SYS_FS_FILE_OPEN_READ);
+    TEST_CHECK(handle != SYS_FS_HANDLE_INVALID);
+
+    /* The whole clusters in one range, across four cluster boundaries */
+    TEST_CHECK_EQUAL(testMapCheck(handle, testTable, TEST_TABLE_SIZE, 0U, TEST_TABLE_SIZE), 5U * TEST_CLUSTER_SIZE);
+
+    /* Unaligned ranges across a sector and a cluster boundary */
+    TEST_CHECK_EQUAL(testMapCheck(handle, testTable, TEST_TABLE_SIZE, 500U, 24U), 24U);
+    TEST_CHECK_EQUAL(testMapCheck(handle, testTable, TEST_TABLE_SIZE, TEST_CLUSTER_SIZE - 3U, 10U), 10U);
+    TEST_CHECK_EQUAL(testMapCheck(handle, testTable, TEST_TABLE_SIZE, (3U * TEST_CLUSTER_SIZE) + 7U, 2000U), 2000U);
+
+    /* Clamped at the end of the file */
+    TEST_CHECK_EQUAL(testMapCheck(handle, testTable, TEST_TABLE_SIZE, TEST_TABLE_SIZE - 20U, 4096U), 20U);
+    TEST_CHECK_EQUAL(testMapCheck(handle, testTable, TEST_TABLE_SIZE, 4U * TEST_CLUSTER_SIZE, 4096U), TEST_CLUSTER_SIZE);
+    TEST_CHECK_EQUAL(testMapCheck(handle, testTable, TEST_TABLE_SIZE, 5U * TEST_CLUSTER_SIZE, 4096U), TEST_TABLE_SIZE - (5U * TEST_CLUSTER_SIZE));
+    TEST_CHECK_EQUAL(testMapCheck(handle, testTable, TEST_TABLE_SIZE, TEST_TABLE_SIZE, 1U), 0U);
+    TEST_CHECK_EQUAL(testMapCheck(handle, testTable, TEST_TABLE_SIZE, TEST_TABLE_SIZE + 100U, 1U), 0U);
+    TEST_CHECK_EQUAL(testMapCheck(handle, testTable, TEST_TABLE_SIZE, 0U, 0U), 0U);
+
+    TEST_CHECK_EQUAL(SYS_FS_FileClose(handle), SYS_FS_RES_SUCCESS);
+}
+
+// *****************************************************************************
+// Section: Fragmented file
+// *****************************************************************************
+
+static void testFragmented(void)
+{
+    static const char *names[2] = { TEST_FRAG_NAME_A, TEST_FRAG_NAME_B };
+    SYS_FS_HANDLE handle;
+    uint32_t offset;
+    uint32_t length;
+    uint32_t cluster;
+    uint32_t file;
+    uint32_t i;
+
+    for (i = 0U; i < TEST_FRAG_SIZE; i++)
+    {
+        testFrag[0][i] = testByte(i, 2U);
+        testFrag[1][i] = testByte(i, 3U);
+    }
+
+    /* The clusters are appended to the two files in turn, each file takes
+     * every second cluster */
+    for (cluster = 0U; cluster < TEST_FRAG_CLUSTERS; cluster++)
+    {
+        for (file = 0U; file < 2U; file++)
+        {
+            TEST_CHECK(testFileWrite(names[file], (cluster == 0U) ? SYS_FS_FILE_OPEN_WRITE : SYS_FS_FILE_OPEN_APPEND,
+                    &testFrag[file][cluster * TEST_CLUSTER_SIZE], TEST_CLUSTER_SIZE) == true);
+        }
+    }
+
+    for (file = 0U; file < 2U; file++)
+    {
+        handle = SYS_FS_FileOpen(names[file], SYS_FS_FILE_OPEN_READ);
+        TEST_CHECK(handle != SYS_FS_HANDLE_INVALID);
+
+        /* No range goes past the end of its cluster. A cluster can also be
+         * split where the slots of the translation layer wrap around */
+        i = 0U;
+
+        for (offset = 0U; offset < TEST_FRAG_SIZE; offset += length)
+        {
+            length = testMapCheck(handle, testFrag[file], TEST_FRAG_SIZE, offset, TEST_FRAG_SIZE);
+            TEST_CHECK(((offset % TEST_CLUSTER_SIZE) + length) <= TEST_CLUSTER_SIZE);
+            i++;
+
+            if (length == 0U)
+            {
+                break;
+            }
+        }
+
+        TEST_CHECK(i >= TEST_FRAG_CLUSTERS);
+
+        /* From inside a cluster */
+        TEST_CHECK(testMapCheck(handle, testFrag[file], TEST_FRAG_SIZE, TEST_CLUSTER_SIZE + 600U, 4096U) <= (TEST_CLUSTER_SIZE - 600U));
+        TEST_CHECK_EQUAL(testMapCheck(handle, testFrag[file], TEST_FRAG_SIZE, TEST_FRAG_SIZE - 1U, 4096U), 1U);
+
+        TEST_CHECK_EQUAL(SYS_FS_FileClose(handle), SYS_FS_RES_SUCCESS);
+    }
+}
+
+// *****************************************************************************
+// Section: Sectors moved by the translation layer
+// *****************************************************************************
+
+static void testMoved(void)
+{
+    SYS_FS_HANDLE handle;
+    uint32_t i;
+
+    handle = SYS_FS_FileOpen(TEST_TABLE_NAME, SYS_FS_FILE_OPEN_READ_PLUS);
+    TEST_CHECK(handle != SYS_FS_HANDLE_INVALID);
+
+    /* A whole sector written in place goes to the sector cache of the media
+     * manager, the flash is not programmed yet */
+    for (i = TEST_MOVED_OFFSET; i < (TEST_MOVED_OFFSET + TEST_SECTOR_SIZE); i++)
+    {
+        testTable[i] = testByte(i, 4U);
+    }
+
+    NVM_MODEL_StatisticsReset();
+    TEST_CHECK_EQUAL(SYS_FS_FileSeek(handle, (int32_t)TEST_MOVED_OFFSET, SYS_FS_SEEK_SET), (int32_t)TEST_MOVED_OFFSET);
+    TEST_CHECK_EQUAL(SYS_FS_FileWrite(handle, &testTable[TEST_MOVED_OFFSET], TEST_SECTOR_SIZE), TEST_SECTOR_SIZE);
+    TEST_CHECK_EQUAL(gNvmModel.nPrograms, 0U);
+
+    /* The cache is written first, the sector takes a new slot: the cluster
+     * chain is contiguous but the range ends at the sector */
+    TEST_CHECK_EQUAL(testMapCheck(handle, testTable, TEST_TABLE_SIZE, 0U, TEST_TABLE_SIZE), TEST_MOVED_OFFSET);
+    TEST_CHECK(gNvmModel.nPrograms != 0U);
+    TEST_CHECK_EQUAL(testMapCheck(handle, testTable, TEST_TABLE_SIZE, TEST_MOVED_OFFSET, TEST_TABLE_SIZE), TEST_SECTOR_SIZE);
+    TEST_CHECK_EQUAL(testMapCheck(handle, testTable, TEST_TABLE_SIZE, TEST_MOVED_OFFSET + TEST_SECTOR_SIZE, TEST_TABLE_SIZE),
+            (5U * TEST_CLUSTER_SIZE) - (TEST_MOVED_OFFSET + TEST_SECTOR_SIZE));
+
+    /* A few bytes held in the file buffer of FatFs */
+    for (i = 100U; i < 110U; i++)
+    {
+        testTable[i] = testByte(i, 5U);
+    }
+
+    NVM_MODEL_StatisticsReset();
+    TEST_CHECK_EQUAL(SYS_FS_FileSeek(handle, 100, SYS_FS_SEEK_SET), 100);
+    TEST_CHECK_EQUAL(SYS_FS_FileWrite(handle, &testTable[100], 10U), 10U);
+    TEST_CHECK_EQUAL(gNvmModel.nPrograms, 0U);
+
+    TEST_CHECK_EQUAL(testMapCheck(handle, testTable, TEST_TABLE_SIZE, 96U, 32U), 32U);
+    TEST_CHECK(gNvmModel.nPrograms != 0U);
+    TEST_CHECK_EQUAL(testMapCheck(handle, testTable, TEST_TABLE_SIZE, 0U, TEST_TABLE_SIZE), TEST_SECTOR_SIZE);
+    TEST_CHECK_EQUAL(testMapCheck(handle, testTable, TEST_TABLE_SIZE, TEST_SECTOR_SIZE, TEST_TABLE_SIZE),
+            TEST_MOVED_OFFSET - TEST_SECTOR_SIZE);
+
+    TEST_CHECK_EQUAL(SYS_FS_FileClose(handle), SYS_FS_RES_SUCCESS);
+}
+
+// *****************************************************************************
+// Section: Background erases
+// *****************************************************************************
+
+static void testErased(void)
+{
+    SYS_FS_HANDLE handle;
+    uint32_t offset;
+    uint32_t length;
+    uint32_t i;
+
+    /* The ranges of the table, mapped while the slots of its rewritten
+     * sectors wait to be erased, stay in place once they are erased */
+    testNExtents = 0U;
+
+    handle = SYS_FS_FileOpen(TEST_TABLE_NAME, SYS_FS_FILE_OPEN_READ);
+    TEST_CHECK(handle != SYS_FS_HANDLE_INVALID);
+
+    for (offset = 0U; offset < TEST_TABLE_SIZE; offset += length)
+    {
+        length = testMapCheck(handle, testTable, TEST_TABLE_SIZE, offset, TEST_TABLE_SIZE);
+
+        if (length == 0U)
+        {
+            break;
+        }
+    }
+
+    TEST_CHECK_EQUAL(SYS_FS_FileClose(handle), SYS_FS_RES_SUCCESS);
+    TEST_CHECK(testFtlObject.staleSlots != 0U);
+    TEST_CHECK(testGcDrain() == true);
+
+    for (i = 0U; i < testNExtents; i++)
+    {
+        TEST_CHECK(memcmp(testExtents[i].ptr, &testTable[testExtents[i].offset], testExtents[i].length) == 0);
+    }
+}
+
+int main( int argc, char *argv[] )
+{
+    TEST_CHECK(testMount() == true);
+
+    testContiguous();
+    testFragmented();
+    testMoved();
+    testErased();
+
+    TEST_CHECK_EQUAL(SYS_FS_Unmount(TEST_MOUNT_NAME), SYS_FS_RES_SUCCESS);
+    TEST_CHECK_EQUAL(NVM_MODEL_Errors(), 0U);
+
+    return TEST_RESULT("file_map");
+}
@@ -0,0 +1,24 @@
+/* Configuration of the flash translation layer host test: DRV_MEMORY
+ * instance 0 of the nvm_fat application, with the flash translation layer
+ * over the NVMCTRL. */
+#ifndef CONFIGURATION_H
+#define CONFIGURATION_H
+
+#include "device.h"
+
+#define DRV_MEMORY_INDEX_0                   0
+#define DRV_MEMORY_CLIENTS_NUMBER_IDX0       1
+#define DRV_MEMORY_BUF_Q_SIZE_IDX0           1
+#define DRV_MEMORY_DEVICE_START_ADDRESS      0x20000U
+#define DRV_MEMORY_DEVICE_MEDIA_SIZE         128UL
+#define DRV_MEMORY_DEVICE_MEDIA_SIZE_BYTES   (DRV_MEMORY_DEVICE_MEDIA_SIZE * 1024U)
+#define DRV_MEMORY_DEVICE_PROGRAM_SIZE       64U
+#define DRV_MEMORY_DEVICE_ERASE_SIZE         256U
+
+#define DRV_MEMORY_FTL_ENABLE
+#define DRV_MEMORY_FTL_SECTORS_IDX0          (192U)
+#define DRV_MEMORY_FTL_JOURNAL_BLOCKS_IDX0   (16U)
+
+#define DRV_MEMORY_INSTANCES_NUMBER          (1U)
+
+#endif // CONFIGURATION_H
@@ -0,0 +1,14 @@
+/* Host stand-in for the definitions header of the application. The NVMCTRL
+ * memory device driver only needs the NVMCTRL PLIB, provided by the flash
+ * model, and its own prototypes. The disk image of the application is an
+ * ordinary array here instead of being placed at the start of the media. */
+#ifndef DEFINITIONS_H
+#define DEFINITIONS_H
+
+#include "configuration.h"
+#include "peripheral/nvmctrl/plib_nvmctrl.h"
+#include "driver/memory/drv_memory_nvmctrl.h"
+
+#define KEEP
+
+#endif // DEFINITIONS_H
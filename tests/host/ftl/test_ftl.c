@@ -0,0 +1,685 @@
+/*******************************************************************************
+  Flash Translation Layer Host Test
+
+  File Name:
+    test_ftl.c
+
+  Summary:
+    Cuts the power during every flash operation of the DRV_MEMORY flash
+    translation layer and checks the media after the next mount.
+
+  Description:
+    The flash translation layer of DRV_MEMORY instance 0 of the nvm_fat
+    application runs over the NVMCTRL memory device driver and a model of the
+    NVMCTRL flash. The test calls the layer the way the DRV_MEMORY tasks do:
+    an update or a read is called until it is no longer busy, and the
+    background maintenance runs between the requests.
+
+    A sequence of sector writes, trims and background maintenance covers the
+    sector updates, the slot erases, the journal area erases and the map
+    checkpoints, in the foreground and in the background. The sequence is
+    run once to count its program and erase operations, then once for every
+    operation with the power cut during it, with a few bytes changed and with
+    the operation complete. After each cut the layer is mounted again: every
+    sector must read its last written contents, or the previous ones for the
+    sectors of the request in flight, the map must be the one held in RAM at
+    the cut and the slot bitmaps must account for every slot once. A few
+    more sectors are then written and the layer is mounted once more to
+    check that no slot was handed out twice.
+
+    The same is done from the disk image of the application, which the
+    layer adopts with an identity map on its first mount.
+*******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "test_host.h"
+#include "definitions.h"
+#include "nvm_model.h"
+#include "driver/memory/drv_memory.h"
+#include "driver/memory/src/drv_memory_ftl.h"
+
+#define TEST_SECTORS                    DRV_MEMORY_FTL_SECTORS_IDX0
+#define TEST_SECTOR_SIZE                DRV_MEMORY_FTL_SECTOR_SIZE
+
+/* Disk image of the application (nvm_disk_images.c), programmed 1:1 at the
+ * start of the media */
+#define TEST_IMAGE_SIZE                 (64U * 1024U)
+#define TEST_IMAGE_SECTORS              (TEST_IMAGE_SIZE / TEST_SECTOR_SIZE)
+
+/* Bytes changed by a torn operation: part of a journal record or of a
+ * checkpoint header */
+#define TEST_TORN_LENGTH                (8U)
+
+/* Sectors in the largest request of the sequences */
+#define TEST_REQUEST_SECTORS_MAX        (8U)
+
+/* Calls after which an operation must have ended */
+#define TEST_CALLS_MAX                  (100000U)
+
+extern const char FAT_IMAGE[];
+
+// *****************************************************************************
+// Section: DRV_MEMORY instance 0 of nvm_fat
+// *****************************************************************************
+
+static uint16_t testFtlMap[DRV_MEMORY_FTL_SECTORS_IDX0];
+static uint32_t testFtlSlotMap[DRV_MEMORY_FTL_SLOT_MAP_SIZE(DRV_MEMORY_DEVICE_MEDIA_SIZE_BYTES)];
+static uint32_t testFtlPageBuffer[DRV_MEMORY_DEVICE_PROGRAM_SIZE / 4U];
+
+static DRV_MEMORY_FTL_OBJECT testFtlObject =
+{
+    .map                        = &testFtlMap[0],
+    .slotMap                    = &testFtlSlotMap[0],
+    .pageBuffer                 = (uint8_t *)&testFtlPageBuffer[0],
+    .nSectors                   = DRV_MEMORY_FTL_SECTORS_IDX0,
+    .journalBlocks              = DRV_MEMORY_FTL_JOURNAL_BLOCKS_IDX0
+};
+
+static const DRV_MEMORY_DEVICE_INTERFACE testDeviceAPI =
+{
+    .Open               = DRV_NVMCTRL_Open,
+    .Close              = DRV_NVMCTRL_Close,
+    .Status             = DRV_NVMCTRL_Status,
+    .SectorErase        = DRV_NVMCTRL_SectorErase,
+    .Read               = DRV_NVMCTRL_Read,
+    .PageWrite          = DRV_NVMCTRL_PageWrite,
+    .EventHandlerSet    = NULL,
+    .GeometryGet        = (DRV_MEMORY_DEVICE_GEOMETRY_GET)DRV_NVMCTRL_GeometryGet,
+    .TransferStatusGet  = (DRV_MEMORY_DEVICE_TRANSFER_STATUS_GET)DRV_NVMCTRL_TransferStatusGet
+};
+
+static DRV_MEMORY_OBJECT testObject;
+
+// *****************************************************************************
+// Section: Sequences
+// *****************************************************************************
+
+typedef enum
+{
+    TEST_STEP_WRITE,
+    TEST_STEP_TRIM,
+    TEST_STEP_GC
+
+} TEST_STEP_TYPE;
+
+/* count requests of nSectors each, from sector on */
+typedef struct
+{
+    TEST_STEP_TYPE type;
+    uint32_t sector;
+    uint32_t nSectors;
+    uint32_t count;
+
+} TEST_STEP;
+
+/* From an erased media */
+static const TEST_STEP testBlankSteps[] =
+{
+    /* The first update checkpoints the adopted map */
+    { TEST_STEP_WRITE,  0U, 8U, 1U },
+    { TEST_STEP_WRITE,  3U, 1U, 1U },
+    { TEST_STEP_TRIM,   5U, 2U, 1U },
+
+    /* Erase of the inactive area and of the stale slots */
+    { TEST_STEP_GC,     0U, 0U, 0U },
+
+    /* Fills the journal and runs out of free slots: checkpoint and slot
+     * erases in the foreground */
+    { TEST_STEP_WRITE, 10U, 1U, 60U },
+    { TEST_STEP_GC,     0U, 0U, 0U },
+
+    /* Past the threshold of the checkpoint in the background */
+    { TEST_STEP_WRITE, 100U, 1U, 32U },
+    { TEST_STEP_GC,     0U, 0U, 0U },
+};
+
+/* From the disk image of the application */
+static const TEST_STEP testImageSteps[] =
+{
+    /* First FAT sector */
+    { TEST_STEP_WRITE,  1U, 1U, 1U },
+    { TEST_STEP_GC,     0U, 0U, 0U },
+    { TEST_STEP_WRITE,  2U, 2U, 1U },
+};
+
+/* Written after the mount that follows a power cut */
+static const uint32_t testAfterSectors[] = { 0U, 3U, 5U, 10U, 69U, 100U, 131U, TEST_SECTORS - 1U };
+
+// *****************************************************************************
+// Section: Test state
+// *****************************************************************************
+
+/* Flash and sector contents the sequences start from */
+static uint8_t testBase[NVM_MODEL_SIZE];
+static uint8_t testBaseContents[TEST_SECTORS][TEST_SECTOR_SIZE];
+
+/* Last contents written to each sector */
+static uint8_t testContents[TEST_SECTORS][TEST_SECTOR_SIZE];
+
+/* Request in flight: its sectors may hold their new contents */
+static uint32_t testFlightSector;
+static uint32_t testFlightCount;
+static uint8_t testFlightContents[TEST_REQUEST_SECTORS_MAX][TEST_SECTOR_SIZE];
+
+/* Map held in RAM when the power was cut */
+static uint16_t testCutMap[TEST_SECTORS];
+
+/* Maintenance states entered during the updates and in the background */
+static uint32_t testForegroundStates;
+static uint32_t testBackgroundStates;
+
+/* Sectors of the request in flight read back with their old and new data */
+static uint32_t testNOld;
+static uint32_t testNNew;
+
+static uint8_t testBuffer[TEST_SECTOR_SIZE];
+
+static void testFill(uint8_t *buffer, uint32_t sector, uint32_t version)
+{
+    uint32_t i;
+
+    for (i = 0U; i < TEST_SECTOR_SIZE; i++)
+    {
+        buffer[i] = (uint8_t)((sector * 7U) + (version * 13U) + (i * 3U) + (i >> 8U));
+    }
+
+    (void) memcpy(&buffer[0], &sector, sizeof(sector));
+    (void) memcpy(&buffer[sizeof(sector)], &version, sizeof(version));
+}
+
+// *****************************************************************************
+// Section: Flash translation layer calls
+// *****************************************************************************
+
+/* Mounts the layer after a reset: the RAM of the layer is lost */
+static bool testMount(void)
+{
+    MEMORY_DEVICE_GEOMETRY geometry = { 0 };
+
+    (void) memset(&testObject, 0, sizeof(testObject));
+    (void) memset(testFtlMap, 0xA5, sizeof(testFtlMap));
+    (void) memset(testFtlSlotMap, 0xA5, sizeof(testFtlSlotMap));
+
+    testObject.memoryDevice = &testDeviceAPI;
+    testObject.memDevHandle = testDeviceAPI.Open(0, DRV_IO_INTENT_READWRITE);
+    testObject.ftl = &testFtlObject;
+
+    if (testDeviceAPI.GeometryGet(testObject.memDevHandle, &geometry) == false)
+    {
+        return false;
+    }
+
+    /* As DRV_MEMORY does before it mounts the layer */
+    testObject.mediaGeometryTable[SYS_MEDIA_GEOMETRY_TABLE_READ_ENTRY].blockSize = geometry.read_blockSize;
+    testObject.mediaGeometryTable[SYS_MEDIA_GEOMETRY_TABLE_READ_ENTRY].numBlocks = geometry.read_numBlocks;
+    testObject.mediaGeometryTable[SYS_MEDIA_GEOMETRY_TABLE_WRITE_ENTRY].blockSize = geometry.write_blockSize;
+    testObject.mediaGeometryTable[SYS_MEDIA_GEOMETRY_TABLE_WRITE_ENTRY].numBlocks = geometry.write_numBlocks;
+    testObject.mediaGeometryTable[SYS_MEDIA_GEOMETRY_TABLE_ERASE_ENTRY].blockSize = geometry.erase_blockSize;
+    testObject.mediaGeometryTable[SYS_MEDIA_GEOMETRY_TABLE_ERASE_ENTRY].numBlocks = geometry.erase_numBlocks;
+    testObject.writeBlockSize = geometry.write_blockSize;
+    testObject.eraseBlockSize = geometry.erase_blockSize;
+    testObject.blockStartAddress = geometry.blockStartAddress;
+
+    return DRV_MEMORY_FTL_Mount(&testObject);
+}
+
+static bool testRead(uint32_t sector, uint8_t *buffer)
+{
+    MEMORY_DEVICE_TRANSFER_STATUS transferStatus = MEMORY_DEVICE_TRANSFER_BUSY;
+    uint32_t calls;
+
+    testFtlObject.xferState = DRV_MEMORY_FTL_XFER_INIT;
+
+    for (calls = 0U; (calls < TEST_CALLS_MAX) && (transferStatus == MEMORY_DEVICE_TRANSFER_BUSY); calls++)
+    {
+        transferStatus = DRV_MEMORY_FTL_HandleRead(&testObject, buffer, sector * TEST_SECTOR_SIZE, TEST_SECTOR_SIZE);
+    }
+
+    return (transferStatus == MEMORY_DEVICE_TRANSFER_COMPLETED);
+}
+
+/* Returns false when the request fails or the power is cut */
+static bool testUpdate(uint8_t *data, uint32_t sector, uint32_t nSectors, bool isTrim)
+{
+    MEMORY_DEVICE_TRANSFER_STATUS transferStatus = MEMORY_DEVICE_TRANSFER_BUSY;
+    uint32_t calls;
+
+    testFtlObject.xferState = DRV_MEMORY_FTL_XFER_INIT;
+
+    for (calls = 0U; (calls < TEST_CALLS_MAX) && (transferStatus == MEMORY_DEVICE_TRANSFER_BUSY); calls++)
+    {
+        if (isTrim == true)
+        {
+            transferStatus = DRV_MEMORY_FTL_HandleErase(&testObject, data, sector, nSectors);
+        }
+        else
+        {
+            transferStatus = DRV_MEMORY_FTL_HandleWrite(&testObject, data, sector, nSectors);
+        }
+
+        testForegroundStates |= (1UL << (uint32_t)testFtlObject.gcState);
+
+        if (gNvmModel.isPowerLost == true)
+        {
+            return false;
+        }
+    }
+
+    return (transferStatus == MEMORY_DEVICE_TRANSFER_COMPLETED);
+}
+
+/* Runs the background maintenance until it has nothing left to do. Returns
+ * false when the power is cut. */
+static bool testGc(void)
+{
+    DRV_MEMORY_FTL_GC_STATE gcState;
+    uint32_t calls;
+
+    for (calls = 0U; calls < TEST_CALLS_MAX; calls++)
+    {
+        gcState = testFtlObject.gcState;
+
+        DRV_MEMORY_FTL_Tasks(&testObject);
+
+        testBackgroundStates |= (1UL << (uint32_t)testFtlObject.gcState);
+
+        if (gNvmModel.isPowerLost == true)
+        {
+            return false;
+        }
+
+        if ((gcState == DRV_MEMORY_FTL_GC_IDLE) && (testFtlObject.gcState == DRV_MEMORY_FTL_GC_IDLE))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// *****************************************************************************
+// Section: Checks
+// *****************************************************************************
+
+/* Every slot is mapped to one sector, free or stale, and the free slots are
+ * erased */
+static void testSlotsCheck(void)
+{
+    static uint32_t used[DRV_MEMORY_FTL_SLOT_MAP_SIZE(DRV_MEMORY_DEVICE_MEDIA_SIZE_BYTES)];
+    const uint32_t *freeMap = &testFtlSlotMap[0];
+    const uint32_t *staleMap = &testFtlSlotMap[testFtlObject.slotMapWords];
+    const uint8_t *data = NULL;
+    uint32_t nUsed = 0U;
+    uint32_t nFree = 0U;
+    uint32_t nStale = 0U;
+    uint32_t sector;
+    uint32_t slot;
+    uint32_t i;
+    bool isFree;
+    bool isStale;
+
+    (void) memset(used, 0, sizeof(used));
+
+    for (sector = 0U; sector < TEST_SECTORS; sector++)
+    {
+        slot = testFtlMap[sector];
+
+        if (slot == DRV_MEMORY_FTL_SLOT_UNMAPPED)
+        {
+            continue;
+        }
+
+        TEST_CHECK(slot < testFtlObject.nSlots);
+
+        if (slot >= testFtlObject.nSlots)
+        {
+            continue;
+        }
+
+        TEST_CHECK((used[slot >> 5U] & (1UL << (slot & 31U))) == 0U);
+        used[slot >> 5U] |= (1UL << (slot & 31U));
+        nUsed++;
+    }
+
+    for (slot = 0U; slot < testFtlObject.nSlots; slot++)
+    {
+        isFree = ((freeMap[slot >> 5U] & (1UL << (slot & 31U))) != 0U);
+        isStale = ((staleMap[slot >> 5U] & (1UL << (slot & 31U))) != 0U);
+
+        if ((used[slot >> 5U] & (1UL << (slot & 31U))) != 0U)
+        {
+            TEST_CHECK((isFree == false) && (isStale == false));
+            continue;
+        }
+
+        TEST_CHECK(isFree != isStale);
+
+        if (isFree == true)
+        {
+            nFree++;
+            data = NVM_MODEL_Pointer(testObject.blockStartAddress + (slot * TEST_SECTOR_SIZE), TEST_SECTOR_SIZE);
+
+            for (i = 0U; (data != NULL) && (i < TEST_SECTOR_SIZE); i++)
+            {
+                if (data[i] != 0xFFU)
+                {
+                    TEST_CHECK(data[i] == 0xFFU);
+                    break;
+                }
+            }
+        }
+        else
+        {
+            nStale++;
+        }
+    }
+
+    TEST_CHECK_EQUAL(nFree, testFtlObject.freeSlots);
+    TEST_CHECK_EQUAL(nStale, testFtlObject.staleSlots);
+    TEST_CHECK_EQUAL(nUsed + nFree + nStale, testFtlObject.nSlots);
+}
+
+static bool testIsFlight(uint32_t sector)
+{
+    return ((sector >= testFlightSector) && (sector < (testFlightSector + testFlightCount)));
+}
+
+/* Mounts the layer again and checks the map and the contents against the
+ * state at the power cut. The sectors of the request in flight take the
+ * contents read back. */
+static void testRemountCheck(void)
+{
+    uint32_t nBad = 0U;
+    uint32_t sector;
+    bool isRead;
+
+    (void) memcpy(testCutMap, testFtlMap, sizeof(testCutMap));
+
+    NVM_MODEL_PowerOn();
+    TEST_CHECK(testMount() == true);
+
+    for (sector = 0U; sector < TEST_SECTORS; sector++)
+    {
+        if (testIsFlight(sector) == false)
+        {
+            TEST_CHECK_EQUAL(testFtlMap[sector], testCutMap[sector]);
+        }
+    }
+
+    testSlotsCheck();
+
+    for (sector = 0U; sector < TEST_SECTORS; sector++)
+    {
+        isRead = testRead(sector, testBuffer);
+        TEST_CHECK(isRead == true);
+
+        if (isRead == false)
+        {
+            continue;
+        }
+
+        if (memcmp(testBuffer, testContents[sector], TEST_SECTOR_SIZE) == 0)
+        {
+            if (testIsFlight(sector) == true)
+            {
+                testNOld++;
+            }
+        }
+        else if ((testIsFlight(sector) == true) &&
+                 (memcmp(testBuffer, testFlightContents[sector - testFlightSector], TEST_SECTOR_SIZE) == 0))
+        {
+            (void) memcpy(testContents[sector], testBuffer, TEST_SECTOR_SIZE);
+            testNNew++;
+        }
+        else
+        {
+            nBad++;
+        }
+    }
+
+    TEST_CHECK_EQUAL(nBad, 0U);
+}
+
+/* Writes a few sectors after the mount that followed a power cut, and checks
+ * all sectors after the next mount */
+static void testAfterCheck(uint32_t version)
+{
+    uint32_t nBad = 0U;
+    uint32_t sector;
+    uint32_t i;
+
+    for (i = 0U; i < (sizeof(testAfterSectors) / sizeof(testAfterSectors[0])); i++)
+    {
+        sector = testAfterSectors[i];
+        testFill(testContents[sector], sector, version);
+        TEST_CHECK(testUpdate(testContents[sector], sector, 1U, false) == true);
+    }
+
+    TEST_CHECK(testGc() == true);
+    TEST_CHECK(testMount() == true);
+    testSlotsCheck();
+
+    for (sector = 0U; sector < TEST_SECTORS; sector++)
+    {
+        TEST_CHECK(testRead(sector, testBuffer) == true);
+
+        if (memcmp(testBuffer, testContents[sector], TEST_SECTOR_SIZE) != 0)
+        {
+            nBad++;
+        }
+    }
+
+    TEST_CHECK_EQUAL(nBad, 0U);
+}
+
+// *****************************************************************************
+// Section: Power cuts
+// *****************************************************************************
+
+/* Saves the flash and the sector contents the sequences start from */
+static void testBaseSave(void)
+{
+    uint32_t sector;
+
+    for (sector = 0U; sector < TEST_SECTORS; sector++)
+    {
+        TEST_CHECK(testRead(sector, testBaseContents[sector]) == true);
+    }
+
+    (void) memcpy(testBase, gNvmModel.data, sizeof(testBase));
+}
+
+static void testBaseRestore(void)
+{
+    (void) memcpy(gNvmModel.data, testBase, sizeof(testBase));
+    (void) memcpy(testContents, testBaseContents, sizeof(testContents));
+    NVM_MODEL_PowerOn();
+    TEST_CHECK(testMount() == true);
+}
+
+/* Runs the steps from the base. Returns false when the power is cut. */
+static bool testStepsRun(const TEST_STEP *steps, uint32_t nSteps)
+{
+    static uint8_t data[TEST_REQUEST_SECTORS_MAX * TEST_SECTOR_SIZE];
+    uint32_t version = 0U;
+    uint32_t sector;
+    uint32_t step;
+    uint32_t request;
+    uint32_t i;
+    bool isTrim;
+
+    for (step = 0U; step < nSteps; step++)
+    {
+        testFlightCount = 0U;
+
+        if (steps[step].type == TEST_STEP_GC)
+        {
+            if (testGc() == false)
+            {
+                return false;
+            }
+
+            continue;
+        }
+
+        isTrim = (steps[step].type == TEST_STEP_TRIM);
+
+        for (request = 0U; request < steps[step].count; request++)
+        {
+            version++;
+            testFlightSector = steps[step].sector + (request * steps[step].nSectors);
+            testFlightCount = steps[step].nSectors;
+
+            for (i = 0U; i < testFlightCount; i++)
+            {
+                sector = testFlightSector + i;
+
+                if (isTrim == true)
+                {
+                    (void) memset(testFlightContents[i], 0xFF, TEST_SECTOR_SIZE);
+                }
+                else
+                {
+                    testFill(testFlightContents[i], sector, version);
+                }
+
+                (void) memcpy(&data[i * TEST_SECTOR_SIZE], testFlightContents[i], TEST_SECTOR_SIZE);
+            }
+
+            if (testUpdate(data, testFlightSector, testFlightCount, isTrim) == false)
+            {
+                TEST_CHECK(gNvmModel.isPowerLost == true);
+                return false;
+            }
+
+            for (i = 0U; i < testFlightCount; i++)
+            {
+                (void) memcpy(testContents[testFlightSector + i], testFlightContents[i], TEST_SECTOR_SIZE);
+            }
+        }
+    }
+
+    testFlightCount = 0U;
+
+    return true;
+}
+
+/* Runs the steps once without a power cut, then once for every program and
+ * erase operation with the power cut during it */
+static void testPowerCuts(const char *name, const TEST_STEP *steps, uint32_t nSteps)
+{
+    static const uint32_t tornLengths[2] = { TEST_TORN_LENGTH, NVM_MODEL_SIZE };
+    uint32_t nOperations;
+    uint32_t operation;
+    uint32_t torn;
+    uint32_t nCuts = 0U;
+    uint32_t failures = gTestFailures;
+
+    testBaseRestore();
+    nOperations = gNvmModel.nOperations;
+    TEST_CHECK(testStepsRun(steps, nSteps) == true);
+    nOperations = gNvmModel.nOperations - nOperations;
+
+    /* The map of the completed sequence is found again */
+    testRemountCheck();
+    testAfterCheck(0x10000U);
+
+    testNOld = 0U;
+    testNNew = 0U;
+
+    for (operation = 1U; operation <= nOperations; operation++)
+    {
+        for (torn = 0U; torn < 2U; torn++)
+        {
+            testBaseRestore();
+            NVM_MODEL_PowerCut(operation, tornLengths[torn]);
+
+            TEST_CHECK(testStepsRun(steps, nSteps) == false);
+            testRemountCheck();
+            testAfterCheck(0x20000U + operation);
+            nCuts++;
+
+            /* One report per sequence is enough */
+            if (gTestFailures > (failures + 20U))
+            {
+                (void) printf("ftl: %s: stopped at operation %u\n", name, (unsigned int)operation);
+                return;
+            }
+        }
+    }
+
+    TEST_CHECK_EQUAL(NVM_MODEL_Errors(), 0U);
+
+    (void) printf("ftl: %s: %u program and erase operations, %u power cuts, request in flight read back %u times old, %u times new\n",
+            name, (unsigned int)nOperations, (unsigned int)nCuts, (unsigned int)testNOld, (unsigned int)testNNew);
+}
+
+// *****************************************************************************
+// Section: Erased media and disk image
+// *****************************************************************************
+
+static void testBlank(void)
+{
+    NVM_MODEL_Reset();
+    TEST_CHECK(testMount() == true);
+    testBaseSave();
+
+    testForegroundStates = 0U;
+    testBackgroundStates = 0U;
+    testPowerCuts("erased media", testBlankSteps, sizeof(testBlankSteps) / sizeof(testBlankSteps[0]));
+
+    /* The sequence covers every maintenance operation in the foreground and
+     * in the background */
+    TEST_CHECK((testForegroundStates & (1UL << (uint32_t)DRV_MEMORY_FTL_GC_ERASE_AREA)) != 0U);
+    TEST_CHECK((testForegroundStates & (1UL << (uint32_t)DRV_MEMORY_FTL_GC_CHECKPOINT)) != 0U);
+    TEST_CHECK((testForegroundStates & (1UL << (uint32_t)DRV_MEMORY_FTL_GC_ERASE_SLOT)) != 0U);
+    TEST_CHECK((testBackgroundStates & (1UL << (uint32_t)DRV_MEMORY_FTL_GC_ERASE_AREA)) != 0U);
+    TEST_CHECK((testBackgroundStates & (1UL << (uint32_t)DRV_MEMORY_FTL_GC_CHECKPOINT)) != 0U);
+    TEST_CHECK((testBackgroundStates & (1UL << (uint32_t)DRV_MEMORY_FTL_GC_ERASE_SLOT)) != 0U);
+}
+
+static void testImage(void)
+{
+    const uint8_t *image = (const uint8_t *)FAT_IMAGE;
+    uint32_t sector;
+
+    /* The boot sector of the image describes a volume that fits */
+    TEST_CHECK((image[510] == 0x55U) && (image[511] == 0xAAU));
+    TEST_CHECK_EQUAL(image[11] | ((uint32_t)image[12] << 8U), TEST_SECTOR_SIZE);
+    TEST_CHECK_EQUAL(image[19] | ((uint32_t)image[20] << 8U), TEST_IMAGE_SECTORS);
+    TEST_CHECK(TEST_IMAGE_SECTORS <= TEST_SECTORS);
+
+    NVM_MODEL_Reset();
+    (void) memcpy(gNvmModel.data, image, TEST_IMAGE_SIZE);
+
+    /* Adopted with an identity map, a checkpoint is due before the first
+     * update */
+    TEST_CHECK(testMount() == true);
+
+    for (sector = 0U; sector < TEST_SECTORS; sector++)
+    {
+        TEST_CHECK_EQUAL(testFtlMap[sector], sector);
+    }
+
+    TEST_CHECK_EQUAL(testFtlObject.freeSlots, testFtlObject.nSlots - TEST_SECTORS);
+    TEST_CHECK_EQUAL(testFtlObject.staleSlots, 0U);
+    TEST_CHECK_EQUAL(testFtlObject.journalIndex, testFtlObject.pagesPerArea);
+
+    for (sector = 0U; sector < TEST_IMAGE_SECTORS; sector++)
+    {
+        TEST_CHECK(testRead(sector, testBuffer) == true);
+        TEST_CHECK(memcmp(testBuffer, &image[sector * TEST_SECTOR_SIZE], TEST_SECTOR_SIZE) == 0);
+    }
+
+    testBaseSave();
+    testPowerCuts("disk image", testImageSteps, sizeof(testImageSteps) / sizeof(testImageSteps[0]));
+}
+
+int main( int argc, char *argv[] )
+{
+    testBlank();
+    testImage();
+
+    return TEST_RESULT("ftl");
+}
@@ -0,0 +1,216 @@
+/*******************************************************************************
+  Block Medium Model
+
+  File Name:
+    media_model.c
+
+  Summary:
+    Media driver model with 2 KB write blocks for the SYS_FS media manager.
+
+  Description:
+    See media_model.h.
+*******************************************************************************/
+
+#include <string.h>
+#include "media_model.h"
+
+#define MEDIA_MODEL_HANDLE              ((DRV_HANDLE)0x4D4DU)
+
+MEDIA_MODEL gMediaModel;
+
+static SYS_MEDIA_REGION_GEOMETRY gMediaModelRegions[3] =
+{
+    /* Read */
+    { 1U, MEDIA_MODEL_SIZE },
+    /* Write */
+    { MEDIA_MODEL_WRITE_BLOCK_SIZE, MEDIA_MODEL_SIZE / MEDIA_MODEL_WRITE_BLOCK_SIZE },
+    /* Erase */
+    { MEDIA_MODEL_WRITE_BLOCK_SIZE, MEDIA_MODEL_SIZE / MEDIA_MODEL_WRITE_BLOCK_SIZE },
+};
+
+static SYS_MEDIA_GEOMETRY gMediaModelGeometry =
+{
+    SYS_MEDIA_READ_IS_BLOCKING | SYS_MEDIA_WRITE_IS_BLOCKING,
+    1U, 1U, 1U,
+    gMediaModelRegions
+};
+
+void MEDIA_MODEL_Reset( void )
+{
+    (void) memset(&gMediaModel, 0, sizeof(gMediaModel));
+    (void) memset(gMediaModel.data, 0xFF, sizeof(gMediaModel.data));
+}
+
+void MEDIA_MODEL_StatisticsReset( void )
+{
+    gMediaModel.nReadCalls = 0U;
+    gMediaModel.nWriteCalls = 0U;
+    gMediaModel.nBytesRead = 0U;
+    gMediaModel.nBytesProgrammed = 0U;
+}
+
+uint32_t MEDIA_MODEL_Errors( void )
+{
+    return gMediaModel.errNotOpen + gMediaModel.errCommandWhileBusy + gMediaModel.errOutOfRange;
+}
+
+static bool lMEDIA_MODEL_CommandQueue
+(
+    DRV_HANDLE handle,
+    SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE *commandHandle,
+    uint32_t address,
+    uint32_t length
+)
+{
+    *commandHandle = SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE_INVALID;
+
+    if ((handle != MEDIA_MODEL_HANDLE) || (gMediaModel.isOpen == false))
+    {
+        gMediaModel.errNotOpen++;
+        return false;
+    }
+
+    if (gMediaModel.isBusy == true)
+    {
+        gMediaModel.errCommandWhileBusy++;
+        return false;
+    }
+
+    if ((length == 0U) || (address >= MEDIA_MODEL_SIZE) || (length > (MEDIA_MODEL_SIZE - address)))
+    {
+        gMediaModel.errOutOfRange++;
+        return false;
+    }
+
+    gMediaModel.isBusy = true;
+    gMediaModel.address = address;
+    gMediaModel.length = length;
+    gMediaModel.commandHandle++;
+    gMediaModel.commandStatus = SYS_FS_MEDIA_COMMAND_IN_PROGRESS;
+
+    *commandHandle = gMediaModel.commandHandle;
+
+    return true;
+}
+
+static DRV_HANDLE lMEDIA_MODEL_Open( SYS_MODULE_INDEX index, DRV_IO_INTENT intent )
+{
+    gMediaModel.isOpen = true;
+
+    return MEDIA_MODEL_HANDLE;
+}
+
+static void lMEDIA_MODEL_Close( DRV_HANDLE handle )
+{
+    gMediaModel.isOpen = false;
+}
+
+static bool lMEDIA_MODEL_IsAttached( DRV_HANDLE handle )
+{
+    return true;
+}
+
+static SYS_FS_MEDIA_GEOMETRY *lMEDIA_MODEL_GeometryGet( const DRV_HANDLE handle )
+{
+    return &gMediaModelGeometry;
+}
+
+static void lMEDIA_MODEL_EventHandlerSet( DRV_HANDLE handle, const void *eventHandler, const uintptr_t context )
+{
+    gMediaModel.eventHandler = (SYS_FS_MEDIA_EVENT_HANDLER)eventHandler;
+    gMediaModel.context = context;
+}
+
+static void lMEDIA_MODEL_Read
+(
+    DRV_HANDLE handle,
+    SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE *commandHandle,
+    void *buffer,
+    uint32_t blockStart,
+    uint32_t nBlock
+)
+{
+    if (lMEDIA_MODEL_CommandQueue(handle, commandHandle, blockStart, nBlock) == true)
+    {
+        gMediaModel.isWrite = false;
+        gMediaModel.readBuffer = buffer;
+        gMediaModel.nReadCalls++;
+    }
+}
+
+static void lMEDIA_MODEL_EraseWrite
+(
+    const DRV_HANDLE handle,
+    SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE *commandHandle,
+    void *buffer,
+    uint32_t blockStart,
+    uint32_t nBlock
+)
+{
+    if (lMEDIA_MODEL_CommandQueue(handle, commandHandle, blockStart * MEDIA_MODEL_WRITE_BLOCK_SIZE,
+            nBlock * MEDIA_MODEL_WRITE_BLOCK_SIZE) == true)
+    {
+        gMediaModel.isWrite = true;
+        gMediaModel.writeBuffer = buffer;
+        gMediaModel.nWriteCalls++;
+    }
+}
+
+static SYS_FS_MEDIA_COMMAND_STATUS lMEDIA_MODEL_CommandStatusGet
+(
+    DRV_HANDLE handle,
+    SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE commandHandle
+)
+{
+    if (commandHandle != gMediaModel.commandHandle)
+    {
+        return SYS_FS_MEDIA_COMMAND_UNKNOWN;
+    }
+
+    return gMediaModel.commandStatus;
+}
+
+/* Completes the queued command */
+static void lMEDIA_MODEL_Tasks( SYS_MODULE_OBJ obj )
+{
+    if (gMediaModel.isBusy == false)
+    {
+        return;
+    }
+
+    if (gMediaModel.isWrite == true)
+    {
+        (void) memcpy(&gMediaModel.data[gMediaModel.address], gMediaModel.writeBuffer, gMediaModel.length);
+        gMediaModel.nBytesProgrammed += gMediaModel.length;
+    }
+    else
+    {
+        (void) memcpy(gMediaModel.readBuffer, &gMediaModel.data[gMediaModel.address], gMediaModel.length);
+        gMediaModel.nBytesRead += gMediaModel.length;
+    }
+
+    gMediaModel.isBusy = false;
+    gMediaModel.commandStatus = SYS_FS_MEDIA_COMMAND_COMPLETED;
+
+    if (gMediaModel.eventHandler != NULL)
+    {
+        gMediaModel.eventHandler(SYS_MEDIA_EVENT_BLOCK_COMMAND_COMPLETE, gMediaModel.commandHandle, gMediaModel.context);
+    }
+}
+
+const SYS_FS_MEDIA_FUNCTIONS gMediaModelFunctions =
+{
+    .mediaStatusGet     = lMEDIA_MODEL_IsAttached,
+    .mediaGeometryGet   = lMEDIA_MODEL_GeometryGet,
+    .sectorRead         = lMEDIA_MODEL_Read,
+    .sectorWrite        = lMEDIA_MODEL_EraseWrite,
+    .eventHandlerset    = lMEDIA_MODEL_EventHandlerSet,
+    .commandStatusGet   = lMEDIA_MODEL_CommandStatusGet,
+    .Read               = lMEDIA_MODEL_Read,
+    .erase              = NULL,
+    .addressGet         = NULL,
+    .open               = lMEDIA_MODEL_Open,
+    .close              = lMEDIA_MODEL_Close,
+    .tasks              = lMEDIA_MODEL_Tasks,
+    .blockAddressGet    = NULL,
+};
@@ -0,0 +1,72 @@
+/*******************************************************************************
+  Block Medium Model
+
+  File Name:
+    media_model.h
+
+  Summary:
+    Media driver model with 2 KB write blocks for the SYS_FS media manager.
+
+  Description:
+    The model provides the SYS_FS_MEDIA_FUNCTIONS of a media driver in the way
+    DRV_MEMORY presents a flash device: reads are addressed in bytes, writes
+    in blocks of MEDIA_MODEL_WRITE_BLOCK_SIZE bytes which are erased and
+    programmed as a whole. One command is queued at a time; it completes, and
+    raises the event, on the next tasks call. The driver calls and the bytes
+    programmed are counted, and misuse of the driver is counted instead of
+    aborting so that a test can report it.
+*******************************************************************************/
+
+#ifndef MEDIA_MODEL_H
+#define MEDIA_MODEL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "system/fs/sys_fs_media_manager.h"
+
+#define MEDIA_MODEL_WRITE_BLOCK_SIZE    (2048U)
+#define MEDIA_MODEL_SIZE                (4U * 1024U * 1024U)
+
+typedef struct
+{
+    uint8_t data[MEDIA_MODEL_SIZE];
+
+    bool isOpen;
+    SYS_FS_MEDIA_EVENT_HANDLER eventHandler;
+    uintptr_t context;
+
+    /* Queued command */
+    bool isBusy;
+    bool isWrite;
+    uint8_t *readBuffer;
+    const uint8_t *writeBuffer;
+    uint32_t address;
+    uint32_t length;
+    SYS_FS_MEDIA_BLOCK_COMMAND_HANDLE commandHandle;
+    SYS_FS_MEDIA_COMMAND_STATUS commandStatus;
+
+    /* Statistics */
+    uint32_t nReadCalls;
+    uint32_t nWriteCalls;
+    uint64_t nBytesRead;
+    uint64_t nBytesProgrammed;
+
+    /* Driver misuse */
+    uint32_t errNotOpen;
+    uint32_t errCommandWhileBusy;
+    uint32_t errOutOfRange;
+
+} MEDIA_MODEL;
+
+extern MEDIA_MODEL gMediaModel;
+
+extern const SYS_FS_MEDIA_FUNCTIONS gMediaModelFunctions;
+
+/* Erases the medium and clears the state and the counters */
+void MEDIA_MODEL_Reset( void );
+
+void MEDIA_MODEL_StatisticsReset( void );
+
+uint32_t MEDIA_MODEL_Errors( void );
+
+#endif // MEDIA_MODEL_H
@@ -0,0 +1,395 @@
+/*******************************************************************************
+  Media Manager Host Test
+
+  File Name:
+    test_media_manager.c
+
+  Summary:
+    Writes through the FatFs disk layer and the SYS_FS media manager of the
+    nvm_fat application to a medium with 2 KB write blocks.
+
+  Description:
+    disk_write and disk_read of diskio.c go through the media manager, with
+    its sector cache, to a model of a media driver whose write block is four
+    sectors. Each scenario writes 1 MB with a different alignment and write
+    size and counts the driver calls. A multi-sector write must cost at most
+    two block reads and three block writes, and full blocks must not be read
+    back. The medium must hold the data written and read it back.
+
+    The read-ahead is checked with single sector reads: a sequential reader
+    must be detected on its second read and then served from windows read
+    four sectors at a time, scattered reads must not start a window, a write
+    must drop the windows it overlaps, and a stream reaching the last sector
+    must not read past the end of the medium. The driver reads of a 1 MB
+    stream are measured against scattered reads.
+
+    A transfer started by disk_transfer must be left in progress, end with
+    the driver tasks, and be finished first by a disk_read that follows it.
+*******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "configuration.h"
+#include "test_host.h"
+#include "media_model.h"
+#include "system/fs/sys_fs_media_manager.h"
+#include "system/fs/fat_fs/hardware_access/diskio.h"
+
+#define TEST_SECTOR_SIZE                (512U)
+#define TEST_SECTORS_PER_MB             (2048U)
+#define TEST_SECTORS_PER_BLOCK          (MEDIA_MODEL_WRITE_BLOCK_SIZE / TEST_SECTOR_SIZE)
+#define TEST_MEDIA_SECTORS              (MEDIA_MODEL_SIZE / TEST_SECTOR_SIZE)
+#define TEST_MAX_TASKS_CALLS            (100U)
+
+/* Not used: the test mounts no volume */
+const SYS_FS_MEDIA_MOUNT_DATA sysfsMountTable[SYS_FS_VOLUME_NUMBER] =
+{
+    {NULL}
+};
+
+static uint8_t testSource[TEST_SECTORS_PER_MB * TEST_SECTOR_SIZE];
+static uint8_t testReadBack[TEST_SECTORS_PER_MB * TEST_SECTOR_SIZE];
+static uint8_t testImage[MEDIA_MODEL_SIZE];
+static uint32_t testSeed = 1U;
+
+static uint32_t testRandom(void)
+{
+    testSeed = testSeed * 1103515245U + 12345U;
+    return (testSeed >> 16) & 0x7FFFU;
+}
+
+typedef struct
+{
+    const char *name;
+    /* First sector of the megabyte */
+    uint32_t startSector;
+    /* Sectors per disk_write call, 0 for random sizes of 1 to 16 */
+    uint32_t writeSectors;
+
+    /* Expected driver calls for the megabyte, 0 when not checked */
+    uint32_t nWriteCalls;
+    uint32_t nReadCalls;
+
+} TEST_SCENARIO;
+
+static const TEST_SCENARIO testScenarios[] =
+{
+    { "1 MB in one write, block aligned", 8U, TEST_SECTORS_PER_MB, 1U, 0U },
+    { "1 MB in one write, 1 sector off", 9U, TEST_SECTORS_PER_MB, 3U, 2U },
+    { "4 KB writes, block aligned", 8U, 8U, 256U, 0U },
+    { "4 KB writes, 1 sector off", 9U, 8U, 0U, 0U },
+    { "1.5 KB writes", 8U, 3U, 0U, 0U },
+    { "writes of 1 to 16 sectors", 8U, 0U, 0U, 0U },
+    { "512 byte writes", 8U, 1U, 0U, 0U },
+};
+
+// *****************************************************************************
+// Section: Test
+// *****************************************************************************
+
+static void testMediaStart(void)
+{
+    uint32_t i;
+
+    MEDIA_MODEL_Reset();
+    (void) memset(testImage, 0xFF, sizeof(testImage));
+
+    SYS_FS_MEDIA_MANAGER_Register((SYS_MODULE_OBJ)0, (SYS_MODULE_INDEX)0, &gMediaModelFunctions, SYS_FS_MEDIA_TYPE_NVM);
+
+    /* Opens the driver and analyzes the blank medium */
+    for (i = 0U; i < TEST_MAX_TASKS_CALLS; i++)
+    {
+        SYS_FS_MEDIA_MANAGER_Tasks();
+    }
+
+    TEST_CHECK(gMediaModel.isOpen == true);
+    TEST_CHECK(gMediaModel.isBusy == false);
+
+    TEST_CHECK_EQUAL(disk_initialize(0U), 0U);
+}
+
+static void testScenarioRun(const TEST_SCENARIO *scenario)
+{
+    uint32_t sector;
+    uint32_t count;
+    uint32_t writeCalls;
+    uint32_t readCalls;
+    uint32_t maxWriteCalls = 0U;
+    uint32_t maxReadCalls = 0U;
+    uint32_t nDiskWrites = 0U;
+    uint32_t i;
+
+    for (i = 0U; i < sizeof(testSource); i++)
+    {
+        testSource[i] = (uint8_t)testRandom();
+    }
+
+    MEDIA_MODEL_StatisticsReset();
+
+    for (sector = 0U; sector < TEST_SECTORS_PER_MB; sector += count)
+    {
+        count = (scenario->writeSectors != 0U) ? scenario->writeSectors : (1U + (testRandom() % 16U));
+
+        if (count > (TEST_SECTORS_PER_MB - sector))
+        {
+            count = TEST_SECTORS_PER_MB - sector;
+        }
+
+        writeCalls = gMediaModel.nWriteCalls;
+        readCalls = gMediaModel.nReadCalls;
+
+        TEST_CHECK_EQUAL(disk_write(0U, &testSource[sector * TEST_SECTOR_SIZE], scenario->startSector + sector, count), RES_OK);
+        nDiskWrites++;
+
+        /* Single sectors go to the sector cache; its write-backs are
+         * counted in the totals */
+        if (count > 1U)
+        {
+            writeCalls = gMediaModel.nWriteCalls - writeCalls;
+            readCalls = gMediaModel.nReadCalls - readCalls;
+            maxWriteCalls = (writeCalls > maxWriteCalls) ? writeCalls : maxWriteCalls;
+            maxReadCalls = (readCalls > maxReadCalls) ? readCalls : maxReadCalls;
+        }
+    }
+
+    /* f_sync: write the cached sectors */
+    TEST_CHECK_EQUAL(disk_ioctl(0U, CTRL_SYNC, NULL), RES_OK);
+
+    (void) printf("media_manager: %s: %u disk writes, %u driver writes, %u driver reads, %u KB programmed\n",
+            scenario->name, (unsigned int)nDiskWrites, (unsigned int)gMediaModel.nWriteCalls,
+            (unsigned int)gMediaModel.nReadCalls, (unsigned int)(gMediaModel.nBytesProgrammed / 1024U));
+
+    if (scenario->nWriteCalls != 0U)
+    {
+        TEST_CHECK_EQUAL(gMediaModel.nWriteCalls, scenario->nWriteCalls);
+        TEST_CHECK_EQUAL(gMediaModel.nReadCalls, scenario->nReadCalls);
+    }
+
+    TEST_CHECK(maxWriteCalls <= 3U);
+    TEST_CHECK(maxReadCalls <= 2U);
+
+    /* Block aligned writes of whole blocks program each block once */
+    if (((scenario->startSector % TEST_SECTORS_PER_BLOCK) == 0U) && (scenario->writeSectors != 0U) &&
+            ((scenario->writeSectors % TEST_SECTORS_PER_BLOCK) == 0U))
+    {
+        TEST_CHECK_EQUAL(gMediaModel.nBytesProgrammed, TEST_SECTORS_PER_MB * TEST_SECTOR_SIZE);
+        TEST_CHECK_EQUAL(gMediaModel.nReadCalls, 0U);
+    }
+
+    /* The medium holds the megabyte and nothing else changed */
+    (void) memcpy(&testImage[scenario->startSector * TEST_SECTOR_SIZE], testSource, sizeof(testSource));
+    TEST_CHECK(memcmp(gMediaModel.data, testImage, sizeof(testImage)) == 0);
+
+    for (sector = 0U; sector < TEST_SECTORS_PER_MB; sector += 16U)
+    {
+        TEST_CHECK_EQUAL(disk_read(0U, &testReadBack[sector * TEST_SECTOR_SIZE], scenario->startSector + sector, 16U), RES_OK);
+    }
+
+    TEST_CHECK(memcmp(testReadBack, testSource, sizeof(testSource)) == 0);
+}
+
+// *****************************************************************************
+// Section: Read-ahead
+// *****************************************************************************
+
+/* Reads single sectors from a sector on and checks them against the image */
+static void testSequentialRead(uint32_t startSector, uint32_t nSectors)
+{
+    uint8_t data[TEST_SECTOR_SIZE];
+    uint32_t sector;
+
+    for (sector = startSector; sector < (startSector + nSectors); sector++)
+    {
+        TEST_CHECK_EQUAL(disk_read(0U, data, sector, 1U), RES_OK);
+        TEST_CHECK(memcmp(data, &testImage[sector * TEST_SECTOR_SIZE], TEST_SECTOR_SIZE) == 0);
+    }
+}
+
+static void testReadAheadStatisticsGet(SYS_FS_MEDIA_CACHE_STATISTICS *statistics)
+{
+    SYS_FS_MEDIA_MANAGER_CacheStatisticsGet(statistics);
+    SYS_FS_MEDIA_MANAGER_CacheStatisticsReset();
+    MEDIA_MODEL_StatisticsReset();
+}
+
+static void testReadAhead(void)
+{
+    SYS_FS_MEDIA_CACHE_STATISTICS statistics;
+    uint8_t data[TEST_SECTOR_SIZE];
+    uint32_t streamReads;
+    uint32_t scatteredReads;
+    uint32_t sector;
+    uint32_t i;
+
+    /* A known image on the whole medium */
+    for (i = 0U; i < sizeof(testImage); i++)
+    {
+        testImage[i] = (uint8_t)testRandom();
+    }
+
+    for (sector = 0U; sector < TEST_MEDIA_SECTORS; sector += TEST_SECTORS_PER_MB)
+    {
+        TEST_CHECK_EQUAL(disk_write(0U, &testImage[sector * TEST_SECTOR_SIZE], sector, TEST_SECTORS_PER_MB), RES_OK);
+    }
+
+    TEST_CHECK_EQUAL(disk_ioctl(0U, CTRL_SYNC, NULL), RES_OK);
+    TEST_CHECK(memcmp(gMediaModel.data, testImage, sizeof(testImage)) == 0);
+
+    /* Scattered reads start no window */
+    testReadAheadStatisticsGet(&statistics);
+
+    for (i = 0U; i < TEST_SECTORS_PER_MB; i++)
+    {
+        sector = (i * 37U) % TEST_MEDIA_SECTORS;
+        TEST_CHECK_EQUAL(disk_read(0U, data, sector, 1U), RES_OK);
+        TEST_CHECK(memcmp(data, &testImage[sector * TEST_SECTOR_SIZE], TEST_SECTOR_SIZE) == 0);
+    }
+
+    scatteredReads = gMediaModel.nReadCalls;
+    testReadAheadStatisticsGet(&statistics);
+    TEST_CHECK_EQUAL(statistics.readAheadFetches, 0U);
+    TEST_CHECK_EQUAL(statistics.readAheadHits, 0U);
+
+    /* The second read of a sequence starts the stream: the first window is
+     * read, and the next one while the reader is in it */
+    testSequentialRead(1000U, 1U);
+    testReadAheadStatisticsGet(&statistics);
+    TEST_CHECK_EQUAL(statistics.readAheadFetches, 0U);
+
+    testSequentialRead(1001U, 1U);
+    testReadAheadStatisticsGet(&statistics);
+    TEST_CHECK_EQUAL(statistics.readAheadFetches, 2U);
+    TEST_CHECK_EQUAL(statistics.readAheadHits, 1U);
+
+    testSequentialRead(1002U, 7U);
+    testReadAheadStatisticsGet(&statistics);
+    TEST_CHECK_EQUAL(statistics.readAheadHits, 7U);
+    TEST_CHECK_EQUAL(statistics.readAheadFetches, 1U);
+
+    /* Reads of a window or more go to the media on their own */
+    TEST_CHECK_EQUAL(disk_read(0U, testReadBack, 1009U, 4U), RES_OK);
+    TEST_CHECK(memcmp(testReadBack, &testImage[1009U * TEST_SECTOR_SIZE], 4U * TEST_SECTOR_SIZE) == 0);
+    TEST_CHECK_EQUAL(gMediaModel.nReadCalls, 1U);
+    testReadAheadStatisticsGet(&statistics);
+    TEST_CHECK_EQUAL(statistics.readAheadHits, 0U);
+
+    /* Writes into the windows being read and into the next ones: the
+     * reader gets the new data */
+    testSequentialRead(2000U, 3U);
+
+    for (sector = 2002U; sector < 2012U; sector += 3U)
+    {
+        for (i = 0U; i < TEST_SECTOR_SIZE; i++)
+        {
+            testImage[(sector * TEST_SECTOR_SIZE) + i] = (uint8_t)testRandom();
+        }
+
+        TEST_CHECK_EQUAL(disk_write(0U, &testImage[sector * TEST_SECTOR_SIZE], sector, 1U), RES_OK);
+    }
+
+    testSequentialRead(2003U, 12U);
+
+    /* The same with a multi-sector write across both windows */
+    testSequentialRead(3000U, 3U);
+
+    for (i = 0U; i < (6U * TEST_SECTOR_SIZE); i++)
+    {
+        testImage[(3004U * TEST_SECTOR_SIZE) + i] = (uint8_t)testRandom();
+    }
+
+    TEST_CHECK_EQUAL(disk_write(0U, &testImage[3004U * TEST_SECTOR_SIZE], 3004U, 6U), RES_OK);
+    testSequentialRead(3003U, 10U);
+    testReadAheadStatisticsGet(&statistics);
+    TEST_CHECK(statistics.readAheadHits > 0U);
+
+    /* A stream up to the last sector of the medium, then from sector 0: no
+     * window is read past the end */
+    testSequentialRead(TEST_MEDIA_SECTORS - 10U, 10U);
+    testSequentialRead(0U, 10U);
+    testReadAheadStatisticsGet(&statistics);
+    TEST_CHECK_EQUAL(gMediaModel.errOutOfRange, 0U);
+    TEST_CHECK(statistics.readAheadHits > 0U);
+
+    /* A 1 MB stream of single sector reads */
+    testSequentialRead(4096U, TEST_SECTORS_PER_MB);
+    streamReads = gMediaModel.nReadCalls;
+    testReadAheadStatisticsGet(&statistics);
+    TEST_CHECK_EQUAL(statistics.readAheadHits, TEST_SECTORS_PER_MB - 1U);
+    TEST_CHECK(streamReads <= ((TEST_SECTORS_PER_MB / SYS_FS_MEDIA_MANAGER_READ_AHEAD_SECTORS) + 2U));
+
+    (void) printf("media_manager: 1 MB in 512 byte reads: %u driver reads streamed (%u bytes per read), %u scattered\n",
+            (unsigned int)streamReads, (unsigned int)((TEST_SECTORS_PER_MB * TEST_SECTOR_SIZE) / streamReads),
+            (unsigned int)scatteredReads);
+
+    TEST_CHECK(memcmp(gMediaModel.data, testImage, sizeof(testImage)) == 0);
+}
+
+// *****************************************************************************
+// Section: Transfers
+// *****************************************************************************
+
+static void testTransfer(void)
+{
+    uint8_t data[TEST_SECTORS_PER_BLOCK * TEST_SECTOR_SIZE];
+    uint32_t sector = TEST_SECTORS_PER_MB;
+    uint32_t i;
+
+    for (i = 0U; i < sizeof(data); i++)
+    {
+        data[i] = (uint8_t)testRandom();
+    }
+
+    (void) memcpy(&testImage[sector * TEST_SECTOR_SIZE], data, sizeof(data));
+
+    /* The write is submitted, not waited for */
+    TEST_CHECK_EQUAL(disk_transfer(0U, data, sector, TEST_SECTORS_PER_BLOCK, true), RES_OK);
+    TEST_CHECK_EQUAL(disk_transfer_status(0U), RES_NOTRDY);
+    TEST_CHECK(gMediaModel.isBusy == true);
+
+    /* A read of another sector finishes it first */
+    testSequentialRead(0U, 1U);
+    TEST_CHECK_EQUAL(disk_transfer_status(0U), RES_OK);
+    TEST_CHECK(memcmp(&gMediaModel.data[sector * TEST_SECTOR_SIZE], data, sizeof(data)) == 0);
+
+    /* A read ends with the driver tasks */
+    (void) memset(data, 0, sizeof(data));
+    TEST_CHECK_EQUAL(disk_transfer(0U, data, sector, TEST_SECTORS_PER_BLOCK, false), RES_OK);
+    TEST_CHECK_EQUAL(disk_transfer_status(0U), RES_NOTRDY);
+
+    for (i = 0U; (i < TEST_MAX_TASKS_CALLS) && (disk_transfer_status(0U) == RES_NOTRDY); i++)
+    {
+        SYS_FS_MEDIA_MANAGER_TransferTask(0U);
+    }
+
+    TEST_CHECK_EQUAL(disk_transfer_status(0U), RES_OK);
+    TEST_CHECK(memcmp(&testImage[sector * TEST_SECTOR_SIZE], data, sizeof(data)) == 0);
+
+    /* Out of the medium: the sector cache ends the read with an error event */
+    TEST_CHECK_EQUAL(disk_transfer(0U, data, TEST_MEDIA_SECTORS, 1U, false), RES_OK);
+    TEST_CHECK_EQUAL(disk_transfer_status(0U), RES_ERROR);
+    TEST_CHECK_EQUAL(gMediaModel.errOutOfRange, 1U);
+    gMediaModel.errOutOfRange = 0U;
+}
+
+int main( int argc, char *argv[] )
+{
+    uint32_t i;
+    int result;
+
+    testMediaStart();
+
+    for (i = 0U; i < (sizeof(testScenarios) / sizeof(testScenarios[0])); i++)
+    {
+        testScenarioRun(&testScenarios[i]);
+    }
+
+    testReadAhead();
+    testTransfer();
+
+    TEST_CHECK_EQUAL(gMediaModel.errNotOpen, 0U);
+    TEST_CHECK_EQUAL(gMediaModel.errCommandWhileBusy, 0U);
+    TEST_CHECK_EQUAL(gMediaModel.errOutOfRange, 0U);
+
+    result = TEST_RESULT("media_manager");
+    return result;
+}
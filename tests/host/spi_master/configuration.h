@@ -0,0 +1,19 @@
+/* Configuration of the SPI master host test: DRV_SPI instances in DMA mode
+ * with two clients, as instance 1 of spi_multi_instance. DRV_SPI cannot be
+ * deinitialized, so each scenario of the test uses an instance of its own. */
+#ifndef CONFIGURATION_H
+#define CONFIGURATION_H
+
+#include "device.h"
+
+#define DRV_SPI_INDEX_0                       0
+#define DRV_SPI_CLIENTS_NUMBER_IDX0           2
+#define DRV_SPI_DMA_MODE
+#define DRV_SPI_XMIT_DMA_CH_IDX0              SYS_DMA_CHANNEL_1
+#define DRV_SPI_RCV_DMA_CH_IDX0               SYS_DMA_CHANNEL_0
+#define DRV_SPI_QUEUE_SIZE_IDX0               4
+
+#define DRV_SPI_INSTANCES_NUMBER              (4U)
+#define DRV_SPI_PRIORITY_AGING_STEP           (4U)
+
+#endif // CONFIGURATION_H
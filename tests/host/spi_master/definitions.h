@@ -0,0 +1,11 @@
+/* Host stand-in for the definitions header of the application. DRV_SPI
+ * includes the system services itself and only needs the CPU clock, which
+ * times its wait statistics. */
+#ifndef DEFINITIONS_H
+#define DEFINITIONS_H
+
+#include "configuration.h"
+
+#define CPU_CLOCK_FREQUENCY 32000000U
+
+#endif // DEFINITIONS_H
@@ -0,0 +1,567 @@
+/*******************************************************************************
+  SPI Master Bus Model
+
+  File Name:
+    spi_model.c
+
+  Summary:
+    SYS_DMA, SYS_PORT and SERCOM SPI PLIB functions of DRV_SPI backed by a
+    model of the SERCOM, its two DMAC channels and two slave devices.
+*******************************************************************************/
+
+#include <string.h>
+#include "spi_model.h"
+
+SPI_MODEL gSpiModel;
+
+// *****************************************************************************
+// Section: Devices
+// *****************************************************************************
+
+static bool lSPI_MODEL_DeviceIsSelected(const SPI_MODEL_DEVICE* device)
+{
+    if (device->chipSelect == SYS_PORT_PIN_NONE)
+    {
+        return false;
+    }
+
+    if (device->chipSelect == gSpiModel.ssPadPin)
+    {
+        return ((gSpiModel.mssen == true) && (gSpiModel.ssAsserted == true));
+    }
+
+    /* Active low */
+    return (device->pinLevel == false);
+}
+
+/* Opens a frame on the devices that have just been selected and closes it on
+ * the ones that have just been deselected */
+static void lSPI_MODEL_SelectUpdate(void)
+{
+    SPI_MODEL_DEVICE* device;
+    uint32_t index;
+    bool isSelected;
+
+    for (index = 0U; index < SPI_MODEL_DEVICES; index++)
+    {
+        device = &gSpiModel.device[index];
+        isSelected = lSPI_MODEL_DeviceIsSelected(device);
+
+        if ((isSelected == true) && (device->isSelected == false))
+        {
+            if (device->nFrames < SPI_MODEL_FRAMES_MAX)
+            {
+                device->frameSize[device->nFrames] = 0U;
+            }
+
+            device->nFrames++;
+        }
+
+        device->isSelected = isSelected;
+    }
+}
+
+/* Shifts a character into the selected device and returns the character the
+ * device shifts out */
+static uint8_t lSPI_MODEL_DeviceShift(uint32_t index, uint8_t data)
+{
+    SPI_MODEL_DEVICE* device = &gSpiModel.device[index];
+    uint32_t frame = device->nFrames - 1U;
+    uint32_t position;
+
+    if (frame >= SPI_MODEL_FRAMES_MAX)
+    {
+        device->nOverflows++;
+        return 0xFFU;
+    }
+
+    position = device->frameSize[frame];
+
+    if (position >= SPI_MODEL_FRAME_SIZE_MAX)
+    {
+        device->nOverflows++;
+        return 0xFFU;
+    }
+
+    device->frames[frame][position] = data;
+    device->frameSize[frame]++;
+
+    return SPI_MODEL_DeviceByte(index, position);
+}
+
+uint8_t SPI_MODEL_DeviceByte(uint32_t device, uint32_t index)
+{
+    return (uint8_t)((device * 0x80U) + (index * 3U) + 0x11U);
+}
+
+// *****************************************************************************
+// Section: DMAC channels
+// *****************************************************************************
+
+static void lSPI_MODEL_DmaInterruptRaise(SPI_MODEL_DMA_CHANNEL* channel)
+{
+    channel->tcmplFlag = true;
+
+    if (gSpiModel.irqPending == false)
+    {
+        gSpiModel.irqPending = true;
+        gSpiModel.isrTicks = 0U;
+    }
+}
+
+static void lSPI_MODEL_DmaBlockLoad(SPI_MODEL_DMA_CHANNEL* channel, const SYS_DMA_DESCRIPTOR* descriptor)
+{
+    channel->block = *descriptor;
+    channel->count = 0U;
+
+    if ((descriptor->DMAC_BTCTRL & DMAC_BTCTRL_VALID_Msk) == 0U)
+    {
+        gSpiModel.errInvalidDescriptor++;
+        channel->enabled = false;
+    }
+
+    if ((descriptor->DMAC_BTCTRL & DMAC_BTCTRL_BEATSIZE_Msk) != 0U)
+    {
+        gSpiModel.errBeatSize++;
+    }
+}
+
+/* As DMAC_ChannelTransfer and DMAC_ChannelLinkedListTransfer: the channel
+ * descriptor is loaded and the flags are cleared */
+static bool lSPI_MODEL_DmaStart(SYS_DMA_CHANNEL channelId)
+{
+    SPI_MODEL_DMA_CHANNEL* channel = &gSpiModel.dma[channelId];
+
+    channel->tcmplFlag = false;
+    channel->enabled = true;
+    lSPI_MODEL_DmaBlockLoad(channel, &channel->descriptor);
+
+    return true;
+}
+
+static void lSPI_MODEL_DmaBlockEnd(SPI_MODEL_DMA_CHANNEL* channel)
+{
+    channel->nBlocks++;
+
+    if ((channel->block.DMAC_BTCTRL & DMAC_BTCTRL_BLOCKACT_Msk) == DMAC_BTCTRL_BLOCKACT_INT)
+    {
+        lSPI_MODEL_DmaInterruptRaise(channel);
+    }
+
+    if (channel->block.next != NULL)
+    {
+        channel->nFetches++;
+        lSPI_MODEL_DmaBlockLoad(channel, channel->block.next);
+    }
+    else
+    {
+        channel->enabled = false;
+    }
+}
+
+/* DRE trigger of the TX channel: moves one beat to the DATA register */
+static bool lSPI_MODEL_DmaTxBeat(uint8_t* data)
+{
+    SPI_MODEL_DMA_CHANNEL* channel = &gSpiModel.dma[gSpiModel.txChannel];
+    uint32_t offset = 0U;
+
+    if (channel->enabled == false)
+    {
+        return false;
+    }
+
+    if ((channel->block.dest != &gSpiModel.dataRegister) ||
+        ((channel->block.DMAC_BTCTRL & DMAC_BTCTRL_DSTINC_Msk) != 0U))
+    {
+        gSpiModel.errAddress++;
+    }
+
+    if ((channel->block.DMAC_BTCTRL & DMAC_BTCTRL_SRCINC_Msk) != 0U)
+    {
+        offset = channel->count;
+    }
+
+    *data = channel->block.src[offset];
+    channel->count++;
+
+    if (channel->count >= channel->block.DMAC_BTCNT)
+    {
+        lSPI_MODEL_DmaBlockEnd(channel);
+    }
+
+    return true;
+}
+
+/* RXC trigger of the RX channel: moves one beat from the DATA register */
+static bool lSPI_MODEL_DmaRxBeat(uint8_t data)
+{
+    SPI_MODEL_DMA_CHANNEL* channel = &gSpiModel.dma[gSpiModel.rxChannel];
+    uint32_t offset = 0U;
+
+    if (channel->enabled == false)
+    {
+        return false;
+    }
+
+    if ((channel->block.src != &gSpiModel.dataRegister) ||
+        ((channel->block.DMAC_BTCTRL & DMAC_BTCTRL_SRCINC_Msk) != 0U))
+    {
+        gSpiModel.errAddress++;
+    }
+
+    if ((channel->block.DMAC_BTCTRL & DMAC_BTCTRL_DSTINC_Msk) != 0U)
+    {
+        offset = channel->count;
+    }
+
+    channel->block.dest[offset] = data;
+    channel->count++;
+
+    if (channel->count >= channel->block.DMAC_BTCNT)
+    {
+        lSPI_MODEL_DmaBlockEnd(channel);
+    }
+
+    return true;
+}
+
+/* As DMAC_InterruptHandler */
+static void lSPI_MODEL_InterruptServe(void)
+{
+    SPI_MODEL_DMA_CHANNEL* channel;
+    uint32_t index;
+
+    gSpiModel.irqPending = false;
+
+    for (index = 0U; index < SPI_MODEL_DMA_CHANNELS; index++)
+    {
+        channel = &gSpiModel.dma[index];
+
+        if (channel->tcmplFlag == true)
+        {
+            channel->tcmplFlag = false;
+
+            if (channel->callback != NULL)
+            {
+                channel->callback(SYS_DMA_TRANSFER_COMPLETE, channel->context);
+            }
+        }
+    }
+}
+
+// *****************************************************************************
+// Section: Bus
+// *****************************************************************************
+
+void SPI_MODEL_Reset(SYS_PORT_PIN ssPadPin, SYS_PORT_PIN chipSelect0, SYS_PORT_PIN chipSelect1, uint32_t isrLatency)
+{
+    uint32_t index;
+
+    (void) memset(&gSpiModel, 0, sizeof(gSpiModel));
+
+    gSpiModel.txChannel = SYS_DMA_CHANNEL_1;
+    gSpiModel.rxChannel = SYS_DMA_CHANNEL_0;
+    gSpiModel.ssPadPin = ssPadPin;
+    gSpiModel.isrLatency = isrLatency;
+    gSpiModel.device[0].chipSelect = chipSelect0;
+    gSpiModel.device[1].chipSelect = chipSelect1;
+
+    for (index = 0U; index < SPI_MODEL_DEVICES; index++)
+    {
+        gSpiModel.device[index].pinLevel = true;
+    }
+
+    /* Channel settings of the DMAC PLIB for a SERCOM channel: byte beats,
+     * interrupt at the end of the block */
+    for (index = 0U; index < SPI_MODEL_DMA_CHANNELS; index++)
+    {
+        gSpiModel.dma[index].descriptor.DMAC_BTCTRL = DMAC_BTCTRL_VALID_Msk | DMAC_BTCTRL_BLOCKACT_INT;
+    }
+}
+
+void SPI_MODEL_StatisticsReset(void)
+{
+    uint32_t index;
+
+    for (index = 0U; index < SPI_MODEL_DEVICES; index++)
+    {
+        gSpiModel.device[index].nFrames = 0U;
+        gSpiModel.device[index].nOverflows = 0U;
+    }
+
+    for (index = 0U; index < SPI_MODEL_DMA_CHANNELS; index++)
+    {
+        gSpiModel.dma[index].nBlocks = 0U;
+        gSpiModel.dma[index].nFetches = 0U;
+    }
+
+    gSpiModel.nTicks = 0U;
+    gSpiModel.nCharacters = 0U;
+    gSpiModel.nSercomReEnables = 0U;
+    gSpiModel.nStallTicks = 0U;
+}
+
+void SPI_MODEL_Tick(void)
+{
+    uint32_t index;
+    uint32_t nSelected = 0U;
+    uint8_t txData;
+    uint8_t rxData = 0xFFU;
+
+    gSpiModel.nTicks++;
+
+    if (lSPI_MODEL_DmaTxBeat(&txData) == true)
+    {
+        if ((gSpiModel.mssen == true) && (gSpiModel.ssAsserted == false))
+        {
+            gSpiModel.ssAsserted = true;
+            lSPI_MODEL_SelectUpdate();
+        }
+
+        for (index = 0U; index < SPI_MODEL_DEVICES; index++)
+        {
+            if (gSpiModel.device[index].isSelected == true)
+            {
+                rxData = lSPI_MODEL_DeviceShift(index, txData);
+                nSelected++;
+            }
+        }
+
+        if (nSelected == 0U)
+        {
+            gSpiModel.errNoDevice++;
+        }
+        else if (nSelected > 1U)
+        {
+            gSpiModel.errContention++;
+        }
+        else
+        {
+            /* One device on the bus */
+        }
+
+        gSpiModel.nCharacters++;
+
+        if (lSPI_MODEL_DmaRxBeat(rxData) == false)
+        {
+            gSpiModel.errOverrun++;
+        }
+    }
+    else
+    {
+        /* The transmitter has run dry, the SERCOM releases the SS pad */
+        if (gSpiModel.ssAsserted == true)
+        {
+            gSpiModel.ssAsserted = false;
+            lSPI_MODEL_SelectUpdate();
+        }
+
+        for (index = 0U; index < SPI_MODEL_DEVICES; index++)
+        {
+            if (gSpiModel.device[index].isSelected == true)
+            {
+                gSpiModel.nStallTicks++;
+            }
+        }
+    }
+
+    if (gSpiModel.irqPending == true)
+    {
+        gSpiModel.isrTicks++;
+
+        if (gSpiModel.isrTicks >= gSpiModel.isrLatency)
+        {
+            lSPI_MODEL_InterruptServe();
+        }
+    }
+}
+
+bool SPI_MODEL_IsIdle(void)
+{
+    return ((gSpiModel.dma[SYS_DMA_CHANNEL_0].enabled == false) &&
+            (gSpiModel.dma[SYS_DMA_CHANNEL_1].enabled == false) &&
+            (gSpiModel.irqPending == false));
+}
+
+uint32_t SPI_MODEL_Errors(void)
+{
+    return gSpiModel.errNoDevice + gSpiModel.errContention + gSpiModel.errOverrun +
+           gSpiModel.errMssenWhileBusy + gSpiModel.errChannelBusy + gSpiModel.errAddress +
+           gSpiModel.errBeatSize + gSpiModel.errInvalidDescriptor + gSpiModel.errInterruptMode;
+}
+
+// *****************************************************************************
+// Section: SYS_DMA
+// *****************************************************************************
+
+void SYS_DMA_ChannelCallbackRegister(SYS_DMA_CHANNEL channel, const SYS_DMA_CHANNEL_CALLBACK eventHandler, const uintptr_t contextHandle)
+{
+    gSpiModel.dma[channel].callback = eventHandler;
+    gSpiModel.dma[channel].context = contextHandle;
+}
+
+bool SYS_DMA_ChannelTransfer(SYS_DMA_CHANNEL channel, const void* srcAddr, const void* destAddr, size_t blockSize)
+{
+    SYS_DMA_DESCRIPTOR* descriptor = &gSpiModel.dma[channel].descriptor;
+    uint32_t beatSize = ((uint32_t)descriptor->DMAC_BTCTRL & DMAC_BTCTRL_BEATSIZE_Msk) >> 8U;
+
+    if (gSpiModel.dma[channel].enabled == true)
+    {
+        gSpiModel.errChannelBusy++;
+        return false;
+    }
+
+    descriptor->src = (const uint8_t*)srcAddr;
+    descriptor->dest = (uint8_t*)destAddr;
+    descriptor->DMAC_BTCNT = (uint16_t)(blockSize >> beatSize);
+
+    /* Single block transfer, as DMAC_ChannelTransfer clears DESCADDR */
+    descriptor->next = NULL;
+
+    return lSPI_MODEL_DmaStart(channel);
+}
+
+bool SYS_DMA_ChannelLinkedListTransfer(SYS_DMA_CHANNEL channel, SYS_DMA_DESCRIPTOR* channelDesc)
+{
+    if (gSpiModel.dma[channel].enabled == true)
+    {
+        gSpiModel.errChannelBusy++;
+        return false;
+    }
+
+    gSpiModel.dma[channel].descriptor = *channelDesc;
+
+    return lSPI_MODEL_DmaStart(channel);
+}
+
+void SYS_DMA_LinkedListDescriptorSetup(SYS_DMA_DESCRIPTOR* currentDescriptor, SYS_DMA_CHANNEL_CONFIG setting,
+        const void* srcAddr, const void* destAddr, size_t blockSize, SYS_DMA_DESCRIPTOR* nextDescriptor)
+{
+    uint32_t beatSize = (setting & DMAC_BTCTRL_BEATSIZE_Msk) >> 8U;
+
+    currentDescriptor->DMAC_BTCTRL = (uint16_t)setting;
+    currentDescriptor->DMAC_BTCNT = (uint16_t)(blockSize >> beatSize);
+    currentDescriptor->src = (const uint8_t*)srcAddr;
+    currentDescriptor->dest = (uint8_t*)destAddr;
+    currentDescriptor->next = nextDescriptor;
+}
+
+SYS_DMA_CHANNEL_CONFIG SYS_DMA_ChannelSettingsGet(SYS_DMA_CHANNEL channel)
+{
+    return gSpiModel.dma[channel].descriptor.DMAC_BTCTRL;
+}
+
+void SYS_DMA_ChannelSettingsSet(SYS_DMA_CHANNEL channel, SYS_DMA_CHANNEL_CONFIG setting)
+{
+    gSpiModel.dma[channel].descriptor.DMAC_BTCTRL = (uint16_t)setting;
+}
+
+void SYS_DMA_AddressingModeSetup(SYS_DMA_CHANNEL channel, SYS_DMA_SOURCE_ADDRESSING_MODE sourceAddrMode, SYS_DMA_DESTINATION_ADDRESSING_MODE destAddrMode)
+{
+    SYS_DMA_DESCRIPTOR* descriptor = &gSpiModel.dma[channel].descriptor;
+
+    descriptor->DMAC_BTCTRL = (uint16_t)((descriptor->DMAC_BTCTRL & ~(DMAC_BTCTRL_SRCINC_Msk | DMAC_BTCTRL_DSTINC_Msk)) |
+            (uint32_t)sourceAddrMode | (uint32_t)destAddrMode);
+}
+
+void SYS_DMA_DataWidthSetup(SYS_DMA_CHANNEL channel, SYS_DMA_WIDTH dataWidth)
+{
+    SYS_DMA_DESCRIPTOR* descriptor = &gSpiModel.dma[channel].descriptor;
+
+    descriptor->DMAC_BTCTRL = (uint16_t)((descriptor->DMAC_BTCTRL & ~DMAC_BTCTRL_BEATSIZE_Msk) | (uint32_t)dataWidth);
+}
+
+/* The CRC engine is never available, DRV_SPI then runs without a CRC */
+void SYS_DMA_ChannelCRCSetup(SYS_DMA_CHANNEL channel, SYS_DMA_CRC_SETUP crcSetup)
+{
+}
+
+bool SYS_DMA_CRCEngineAcquire(void)
+{
+    return false;
+}
+
+void SYS_DMA_CRCEngineRelease(void)
+{
+}
+
+uint32_t SYS_DMA_CRCRead(void)
+{
+    return 0U;
+}
+
+// *****************************************************************************
+// Section: SYS_PORT
+// *****************************************************************************
+
+static void lSPI_MODEL_PinWrite(SYS_PORT_PIN pin, bool level)
+{
+    uint32_t index;
+
+    /* A pin given to the SS pad is not driven by PORT */
+    if (pin == gSpiModel.ssPadPin)
+    {
+        return;
+    }
+
+    for (index = 0U; index < SPI_MODEL_DEVICES; index++)
+    {
+        if (gSpiModel.device[index].chipSelect == pin)
+        {
+            gSpiModel.device[index].pinLevel = level;
+        }
+    }
+
+    lSPI_MODEL_SelectUpdate();
+}
+
+void SYS_PORT_PinSet(SYS_PORT_PIN pin)
+{
+    lSPI_MODEL_PinWrite(pin, true);
+}
+
+void SYS_PORT_PinClear(SYS_PORT_PIN pin)
+{
+    lSPI_MODEL_PinWrite(pin, false);
+}
+
+// *****************************************************************************
+// Section: SERCOM SPI PLIB
+// *****************************************************************************
+
+bool SPI_MODEL_PlibSetup(void* setup, uint32_t spiSourceClock)
+{
+    return true;
+}
+
+bool SPI_MODEL_PlibWriteRead(void* pTransmitData, size_t txSize, void* pReceiveData, size_t rxSize)
+{
+    gSpiModel.errInterruptMode++;
+    return false;
+}
+
+/* The shift register empties within the character time of a tick */
+bool SPI_MODEL_PlibIsTransmitterBusy(void)
+{
+    return false;
+}
+
+void SPI_MODEL_PlibCallbackRegister(void (*callback)(uintptr_t context), uintptr_t context)
+{
+    gSpiModel.errInterruptMode++;
+}
+
+/* As SERCOM1_SPI_HardwareChipSelectEnable: MSSEN is enable-protected, so the
+ * SERCOM is disabled and enabled again */
+void SPI_MODEL_PlibHardwareChipSelectEnable(bool enable)
+{
+    if ((gSpiModel.dma[SYS_DMA_CHANNEL_0].enabled == true) || (gSpiModel.dma[SYS_DMA_CHANNEL_1].enabled == true))
+    {
+        gSpiModel.errMssenWhileBusy++;
+    }
+
+    gSpiModel.nSercomReEnables++;
+    gSpiModel.mssen = enable;
+    gSpiModel.ssAsserted = false;
+    lSPI_MODEL_SelectUpdate();
+}
@@ -0,0 +1,163 @@
+/*******************************************************************************
+  SPI Master Bus Model
+
+  File Name:
+    spi_model.h
+
+  Summary:
+    Model of a SERCOM SPI master fed by a TX and an RX DMAC channel, with two
+    slave devices on the bus.
+
+  Description:
+    One call to SPI_MODEL_Tick is one character time on the bus. In a tick the
+    TX channel gives the SERCOM a character if it has one; the character is
+    shifted out to the devices that are selected, and the character shifted
+    in goes to the RX channel. The channels run their descriptors the way the
+    DMAC does: the channel descriptor is copied into the channel when a
+    transfer starts, a block interrupts only if its block action says so, and
+    the next descriptor of a chain is fetched with no CPU action.
+
+    With the hardware chip select (MSSEN) on, the SERCOM drives the SS pad:
+    it is asserted with the first character and released as soon as a
+    character time passes with no character from the TX channel. A transfer
+    that lets the transmitter run dry is therefore split into two frames on
+    the device. With the pad not given to the SERCOM, the chip selects are
+    the GPIO levels set through SYS_PORT.
+
+    The DMA interrupt is served a fixed number of ticks after it is raised,
+    to stand for the interrupt latency. Serving it mirrors
+    DMAC_InterruptHandler: the channels are checked in order and a channel
+    whose flag has been cleared by a new transfer gets no callback.
+*******************************************************************************/
+
+#ifndef SPI_MODEL_H
+#define SPI_MODEL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "system/dma/sys_dma.h"
+#include "system/ports/sys_ports.h"
+
+#define SPI_MODEL_DMA_CHANNELS          (2U)
+#define SPI_MODEL_DEVICES               (2U)
+#define SPI_MODEL_FRAMES_MAX            (16U)
+#define SPI_MODEL_FRAME_SIZE_MAX        (64U)
+
+typedef struct
+{
+    SYS_DMA_CHANNEL_CALLBACK callback;
+    uintptr_t context;
+
+    /* Channel descriptor (descriptor section) and the block being moved */
+    SYS_DMA_DESCRIPTOR descriptor;
+    SYS_DMA_DESCRIPTOR block;
+    uint16_t count;
+    bool enabled;
+
+    /* CHINTFLAG.TCMPL */
+    bool tcmplFlag;
+
+    /* Blocks moved, descriptors fetched from a chain */
+    uint32_t nBlocks;
+    uint32_t nFetches;
+
+} SPI_MODEL_DMA_CHANNEL;
+
+typedef struct
+{
+    /* Pin of the chip select */
+    SYS_PORT_PIN chipSelect;
+
+    /* GPIO level of the chip select pin */
+    bool pinLevel;
+
+    /* The device is selected, bytes of the frame in progress */
+    bool isSelected;
+
+    /* Frames received by the device, each as the bytes shifted in */
+    uint8_t frames[SPI_MODEL_FRAMES_MAX][SPI_MODEL_FRAME_SIZE_MAX];
+    uint32_t frameSize[SPI_MODEL_FRAMES_MAX];
+    uint32_t nFrames;
+
+    /* Frames longer than SPI_MODEL_FRAME_SIZE_MAX or beyond SPI_MODEL_FRAMES_MAX */
+    uint32_t nOverflows;
+
+} SPI_MODEL_DEVICE;
+
+typedef struct
+{
+    SPI_MODEL_DMA_CHANNEL dma[SPI_MODEL_DMA_CHANNELS];
+
+    /* Channels of the SERCOM, SERCOM DATA register */
+    SYS_DMA_CHANNEL txChannel;
+    SYS_DMA_CHANNEL rxChannel;
+    uint8_t dataRegister;
+
+    /* Pin routed to the SS pad of the SERCOM, SYS_PORT_PIN_NONE if it is a
+     * GPIO */
+    SYS_PORT_PIN ssPadPin;
+
+    /* CTRLB.MSSEN and the state of the SS pad (true: asserted) */
+    bool mssen;
+    bool ssAsserted;
+
+    SPI_MODEL_DEVICE device[SPI_MODEL_DEVICES];
+
+    /* DMA interrupt latency in ticks, ticks since it was raised */
+    uint32_t isrLatency;
+    uint32_t isrTicks;
+    bool irqPending;
+
+    /* Ticks, characters shifted, SERCOM disable/enable cycles of the MSSEN
+     * change, character times with no character while a device is selected */
+    uint32_t nTicks;
+    uint32_t nCharacters;
+    uint32_t nSercomReEnables;
+    uint32_t nStallTicks;
+
+    /* Errors: characters with no or more than one device selected, RX
+     * overrun, MSSEN changed while a channel is enabled, a channel started
+     * while enabled, a channel that does not address the DATA register, beat
+     * size not 8 bits, a descriptor without the valid bit, PLIB interrupt mode
+     * used */
+    uint32_t errNoDevice;
+    uint32_t errContention;
+    uint32_t errOverrun;
+    uint32_t errMssenWhileBusy;
+    uint32_t errChannelBusy;
+    uint32_t errAddress;
+    uint32_t errBeatSize;
+    uint32_t errInvalidDescriptor;
+    uint32_t errInterruptMode;
+
+} SPI_MODEL;
+
+extern SPI_MODEL gSpiModel;
+
+/* Clears the bus, the channels and the devices; ssPadPin is the pin given
+ * to the SERCOM SS pad or SYS_PORT_PIN_NONE */
+void SPI_MODEL_Reset(SYS_PORT_PIN ssPadPin, SYS_PORT_PIN chipSelect0, SYS_PORT_PIN chipSelect1, uint32_t isrLatency);
+
+/* Clears the frames and the counters, keeps the bus state */
+void SPI_MODEL_StatisticsReset(void);
+
+/* One character time */
+void SPI_MODEL_Tick(void);
+
+/* The bus, the channels and the DMA interrupt are idle */
+bool SPI_MODEL_IsIdle(void);
+
+/* Byte the device shifts out at position index of a frame */
+uint8_t SPI_MODEL_DeviceByte(uint32_t device, uint32_t index);
+
+/* Sum of the error counters */
+uint32_t SPI_MODEL_Errors(void);
+
+/* SERCOM SPI PLIB functions of DRV_SPI_PLIB_INTERFACE */
+bool SPI_MODEL_PlibSetup(void* setup, uint32_t spiSourceClock);
+bool SPI_MODEL_PlibWriteRead(void* pTransmitData, size_t txSize, void* pReceiveData, size_t rxSize);
+bool SPI_MODEL_PlibIsTransmitterBusy(void);
+void SPI_MODEL_PlibCallbackRegister(void (*callback)(uintptr_t context), uintptr_t context);
+void SPI_MODEL_PlibHardwareChipSelectEnable(bool enable);
+
+#endif // SPI_MODEL_H
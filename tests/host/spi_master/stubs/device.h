@@ -0,0 +1,35 @@
+/* Host stand-in for the device header. Adds the SysTick timer, which DRV_SPI
+ * reads to time the wait of the queued transfers, to the common helpers. The
+ * timer does not run on the host. */
+#ifndef DEVICE_H
+#define DEVICE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define CACHE_ALIGN
+#define CACHE_LINE_SIZE                 (16U)
+#define CACHE_ALIGNED_SIZE_GET(size)    (size)
+#define __ALIGNED(x)                    __attribute__((aligned(x)))
+#define __STATIC_INLINE                 static inline
+#define __NOP()                         do { } while (0)
+#define __DMB()                         do { } while (0)
+#define __DSB()                         do { } while (0)
+
+typedef struct
+{
+    uint32_t CTRL;
+    uint32_t LOAD;
+    uint32_t VAL;
+
+} SysTick_Type;
+
+extern SysTick_Type gSysTick;
+
+#define SysTick                         (&gSysTick)
+#define SysTick_CTRL_ENABLE_Msk         (0x1UL)
+#define SysTick_CTRL_CLKSOURCE_Msk      (0x4UL)
+#define SysTick_LOAD_RELOAD_Msk         (0xFFFFFFUL)
+
+#endif // DEVICE_H
@@ -0,0 +1,102 @@
+/* Host stand-in for the SYS_DMA calls of DRV_SPI. The functions are
+ * implemented by the SPI model of the test (spi_model.c), which runs the TX
+ * and RX channels of the SERCOM the way the DMAC does, descriptor chains
+ * included. The BTCTRL bits are the ones of the DMAC. */
+#ifndef SYS_DMA_H
+#define SYS_DMA_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define DMAC_BTCTRL_VALID_Msk           (0x0001U)
+#define DMAC_BTCTRL_BLOCKACT_Msk        (0x0018U)
+#define DMAC_BTCTRL_BLOCKACT_INT        (0x0008U)
+#define DMAC_BTCTRL_BEATSIZE_Msk        (0x0300U)
+#define DMAC_BTCTRL_SRCINC_Msk          (0x0400U)
+#define DMAC_BTCTRL_DSTINC_Msk          (0x0800U)
+
+typedef enum
+{
+    SYS_DMA_CHANNEL_0,
+    SYS_DMA_CHANNEL_1,
+    SYS_DMA_CHANNEL_NONE = 0xFFFFFFFFU
+
+} SYS_DMA_CHANNEL;
+
+typedef enum
+{
+    SYS_DMA_TRANSFER_COMPLETE = 1,
+    SYS_DMA_TRANSFER_ERROR
+
+} SYS_DMA_TRANSFER_EVENT;
+
+typedef enum
+{
+    SYS_DMA_SOURCE_ADDRESSING_MODE_FIXED = 0x0,
+    SYS_DMA_SOURCE_ADDRESSING_MODE_INCREMENTED = 0x400,
+    SYS_DMA_SOURCE_ADDRESSING_MODE_NONE = -1
+
+} SYS_DMA_SOURCE_ADDRESSING_MODE;
+
+typedef enum
+{
+    SYS_DMA_DESTINATION_ADDRESSING_MODE_FIXED = 0x0,
+    SYS_DMA_DESTINATION_ADDRESSING_MODE_INCREMENTED = 0x800,
+    SYS_DMA_DESTINATION_ADDRESSING_MODE_NONE = -1
+
+} SYS_DMA_DESTINATION_ADDRESSING_MODE;
+
+typedef enum
+{
+    SYS_DMA_WIDTH_8_BIT = 0x0,
+    SYS_DMA_WIDTH_16_BIT = 0x100,
+    SYS_DMA_WIDTH_32_BIT = 0x200,
+    SYS_DMA_WIDTH_NONE = -1
+
+} SYS_DMA_WIDTH;
+
+typedef enum
+{
+    SYS_DMA_CRC_TYPE_16 = 0x0,
+    SYS_DMA_CRC_TYPE_32 = 0x1
+
+} SYS_DMA_CRC_POLYNOMIAL_TYPE;
+
+typedef struct
+{
+    SYS_DMA_CRC_POLYNOMIAL_TYPE polynomialType;
+    uint32_t seed;
+
+} SYS_DMA_CRC_SETUP;
+
+typedef void (*SYS_DMA_CHANNEL_CALLBACK) (SYS_DMA_TRANSFER_EVENT event, uintptr_t contextHandle);
+
+typedef uint32_t SYS_DMA_CHANNEL_CONFIG;
+
+/* The block addresses and the next descriptor are host pointers */
+typedef struct SYS_DMA_DESCRIPTOR_S
+{
+    uint16_t DMAC_BTCTRL;
+    uint16_t DMAC_BTCNT;
+    const uint8_t* src;
+    uint8_t* dest;
+    struct SYS_DMA_DESCRIPTOR_S* next;
+
+} SYS_DMA_DESCRIPTOR;
+
+void SYS_DMA_ChannelCallbackRegister(SYS_DMA_CHANNEL channel, const SYS_DMA_CHANNEL_CALLBACK eventHandler, const uintptr_t contextHandle);
+bool SYS_DMA_ChannelTransfer(SYS_DMA_CHANNEL channel, const void* srcAddr, const void* destAddr, size_t blockSize);
+bool SYS_DMA_ChannelLinkedListTransfer(SYS_DMA_CHANNEL channel, SYS_DMA_DESCRIPTOR* channelDesc);
+void SYS_DMA_LinkedListDescriptorSetup(SYS_DMA_DESCRIPTOR* currentDescriptor, SYS_DMA_CHANNEL_CONFIG setting,
+        const void* srcAddr, const void* destAddr, size_t blockSize, SYS_DMA_DESCRIPTOR* nextDescriptor);
+SYS_DMA_CHANNEL_CONFIG SYS_DMA_ChannelSettingsGet(SYS_DMA_CHANNEL channel);
+void SYS_DMA_ChannelSettingsSet(SYS_DMA_CHANNEL channel, SYS_DMA_CHANNEL_CONFIG setting);
+void SYS_DMA_AddressingModeSetup(SYS_DMA_CHANNEL channel, SYS_DMA_SOURCE_ADDRESSING_MODE sourceAddrMode, SYS_DMA_DESTINATION_ADDRESSING_MODE destAddrMode);
+void SYS_DMA_DataWidthSetup(SYS_DMA_CHANNEL channel, SYS_DMA_WIDTH dataWidth);
+void SYS_DMA_ChannelCRCSetup(SYS_DMA_CHANNEL channel, SYS_DMA_CRC_SETUP crcSetup);
+bool SYS_DMA_CRCEngineAcquire(void);
+void SYS_DMA_CRCEngineRelease(void);
+uint32_t SYS_DMA_CRCRead(void);
+
+#endif // SYS_DMA_H
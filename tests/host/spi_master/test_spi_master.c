@@ -0,0 +1,409 @@
+/*******************************************************************************
+  SPI Master Host Test
+
+  File Name:
+    test_spi_master.c
+
+  Summary:
+    Runs the DMA transfers of DRV_SPI, with the chip select driven from GPIO
+    and by the SERCOM (hardware chip select), against a model of the SERCOM,
+    its DMAC channels and two slave devices.
+
+  Description:
+    DRV_SPI is the firmware source of the spi_multi_instance application,
+    configured as its instance 1 (DMA mode) with two clients. Transfers with
+    more bytes to send than to receive, and the other way round, are queued
+    in batches, so that most of them are started from the DMA interrupt. The
+    DMA interrupt is served a few character times after it is raised.
+
+    Each transfer must reach its device as one frame holding the transmit
+    buffer followed by dummy bytes, and the receive buffer must hold the
+    bytes the device shifted out. With the hardware chip select the SERCOM
+    releases the SS pad as soon as the transmitter runs dry, so a transfer
+    whose dummy phase waits for the DMA interrupt shows up as two frames;
+    the linked descriptor chains of DRV_SPI must keep the transmitter fed.
+
+    The SERCOM is disabled and enabled again to change MSSEN; the test
+    counts these cycles against the client switches. The model does not
+    time them; on the target each cycle is a disable and an enable of the
+    SERCOM, each waiting for the SYNCBUSY synchronization.
+*******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "configuration.h"
+#include "test_host.h"
+#include "spi_model.h"
+#include "system/int/sys_int.h"
+#include "driver/spi/drv_spi.h"
+
+#define TEST_PIN_PA17               ((SYS_PORT_PIN)17U)
+#define TEST_PIN_PB21               ((SYS_PORT_PIN)53U)
+#define TEST_ISR_LATENCY            (3U)
+#define TEST_BATCH_SIZE             DRV_SPI_QUEUE_SIZE_IDX0
+#define TEST_BUFFER_SIZE            SPI_MODEL_FRAME_SIZE_MAX
+#define TEST_TICKS_MAX              (10000U)
+
+SysTick_Type gSysTick;
+
+// *****************************************************************************
+// Section: Driver instance
+// *****************************************************************************
+
+static bool testPlibSetup( DRV_SPI_TRANSFER_SETUP *setup, uint32_t spiSourceClock )
+{
+    return SPI_MODEL_PlibSetup(setup, spiSourceClock);
+}
+
+static const DRV_SPI_PLIB_INTERFACE testPlibApi =
+{
+    .setup = testPlibSetup,
+    .writeRead = SPI_MODEL_PlibWriteRead,
+    .isTransmitterBusy = SPI_MODEL_PlibIsTransmitterBusy,
+    .callbackRegister = SPI_MODEL_PlibCallbackRegister,
+    .hardwareChipSelectEnable = SPI_MODEL_PlibHardwareChipSelectEnable,
+};
+
+static const uint32_t testRemapDataBits[] = { 0x0, 0x1, 0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU };
+static const uint32_t testRemapClockPolarity[] = { 0x0, 0x20000000 };
+static const uint32_t testRemapClockPhase[] = { 0x10000000, 0x0 };
+
+static const DRV_SPI_INTERRUPT_SOURCES testInterruptSources =
+{
+    .isSingleIntSrc = true,
+    .intSources.dmaInterrupt = 0,
+};
+
+/* DRV_SPI has no deinitialize, each scenario runs on an instance of its own */
+static DRV_SPI_CLIENT_OBJ testClientObjPool[DRV_SPI_INSTANCES_NUMBER][DRV_SPI_CLIENTS_NUMBER_IDX0];
+static DRV_SPI_TRANSFER_OBJ testTransferObjPool[DRV_SPI_INSTANCES_NUMBER][DRV_SPI_QUEUE_SIZE_IDX0];
+static SYS_MODULE_INDEX testInstance;
+
+static void testInitialize( SYS_PORT_PIN hardwareChipSelect )
+{
+    DRV_SPI_INIT init =
+    {
+        .spiPlib = &testPlibApi,
+        .remapDataBits = testRemapDataBits,
+        .remapClockPolarity = testRemapClockPolarity,
+        .remapClockPhase = testRemapClockPhase,
+        .numClients = DRV_SPI_CLIENTS_NUMBER_IDX0,
+        .clientObjPool = (uintptr_t)&testClientObjPool[testInstance][0],
+        .dmaChannelTransmit = DRV_SPI_XMIT_DMA_CH_IDX0,
+        .dmaChannelReceive = DRV_SPI_RCV_DMA_CH_IDX0,
+        .spiTransmitAddress = &gSpiModel.dataRegister,
+        .spiReceiveAddress = &gSpiModel.dataRegister,
+        .transferObjPoolSize = DRV_SPI_QUEUE_SIZE_IDX0,
+        .transferObjPool = (uintptr_t)&testTransferObjPool[testInstance][0],
+        .interruptSources = &testInterruptSources,
+        .hardwareChipSelect = hardwareChipSelect,
+    };
+    SYS_MODULE_OBJ object;
+
+    object = DRV_SPI_Initialize(testInstance, (const SYS_MODULE_INIT *)&init);
+    TEST_CHECK(object != SYS_MODULE_OBJ_INVALID);
+}
+
+// *****************************************************************************
+// Section: Clients
+// *****************************************************************************
+
+typedef struct
+{
+    /* Client, 0 for the device on PA17, 1 for the device on PB21 */
+    uint32_t client;
+    size_t txSize;
+    size_t rxSize;
+
+} TEST_TRANSFER;
+
+static DRV_HANDLE testHandle[SPI_MODEL_DEVICES];
+static uint32_t testNumCompleted;
+static uint32_t testNumErrors;
+
+static void testEventHandler( DRV_SPI_TRANSFER_EVENT event, DRV_SPI_TRANSFER_HANDLE transferHandle, uintptr_t context )
+{
+    if (event == DRV_SPI_TRANSFER_EVENT_COMPLETE)
+    {
+        testNumCompleted++;
+    }
+    else
+    {
+        testNumErrors++;
+    }
+}
+
+static void testOpen( uint32_t client, SYS_PORT_PIN chipSelect )
+{
+    DRV_SPI_TRANSFER_SETUP setup =
+    {
+        .baudRateInHz = 1000000U,
+        .clockPhase = DRV_SPI_CLOCK_PHASE_VALID_LEADING_EDGE,
+        .clockPolarity = DRV_SPI_CLOCK_POLARITY_IDLE_LOW,
+        .dataBits = DRV_SPI_DATA_BITS_8,
+        .chipSelect = chipSelect,
+        .csPolarity = DRV_SPI_CS_POLARITY_ACTIVE_LOW,
+    };
+
+    testHandle[client] = DRV_SPI_Open(testInstance, DRV_IO_INTENT_READWRITE);
+    TEST_CHECK(testHandle[client] != DRV_HANDLE_INVALID);
+
+    TEST_CHECK(DRV_SPI_TransferSetup(testHandle[client], &setup) == true);
+    DRV_SPI_TransferEventHandlerSet(testHandle[client], testEventHandler, (uintptr_t)client);
+}
+
+static void testClose( void )
+{
+    uint32_t client;
+
+    for (client = 0U; client < SPI_MODEL_DEVICES; client++)
+    {
+        if (testHandle[client] != DRV_HANDLE_INVALID)
+        {
+            DRV_SPI_Close(testHandle[client]);
+            testHandle[client] = DRV_HANDLE_INVALID;
+        }
+    }
+}
+
+// *****************************************************************************
+// Section: Transfers
+// *****************************************************************************
+
+static uint8_t testTxBuffer[TEST_BATCH_SIZE][TEST_BUFFER_SIZE];
+static uint8_t testRxBuffer[TEST_BATCH_SIZE][TEST_BUFFER_SIZE];
+
+/* Checks the frame of the transfer on its device and the receive buffer.
+ * Returns false if the transfer is not what the device saw. */
+static bool testTransferCheck( const TEST_TRANSFER* transfer, uint32_t slot, uint32_t frame )
+{
+    const SPI_MODEL_DEVICE* device = &gSpiModel.device[transfer->client];
+    size_t frameSize = (transfer->txSize > transfer->rxSize) ? transfer->txSize : transfer->rxSize;
+    uint8_t expected;
+    size_t index;
+
+    if ((frame >= device->nFrames) || (device->frameSize[frame] != frameSize))
+    {
+        return false;
+    }
+
+    for (index = 0U; index < frameSize; index++)
+    {
+        expected = (index < transfer->txSize) ? testTxBuffer[slot][index] : 0xFFU;
+
+        if (device->frames[frame][index] != expected)
+        {
+            return false;
+        }
+    }
+
+    for (index = 0U; index < TEST_BUFFER_SIZE; index++)
+    {
+        expected = (index < transfer->rxSize) ? SPI_MODEL_DeviceByte(transfer->client, (uint32_t)index) : 0xEEU;
+
+        if (testRxBuffer[slot][index] != expected)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/* Queues the transfers in batches and runs the bus until each batch is done.
+ * Returns the number of transfers that did not reach their device as one
+ * frame with the right data. */
+static uint32_t testTransfersRun( const TEST_TRANSFER* transfers, uint32_t nTransfers, uint32_t* nSercomReEnables,
+        uint32_t* nStallTicks )
+{
+    DRV_SPI_TRANSFER_HANDLE transferHandle;
+    uint32_t nFrames[SPI_MODEL_DEVICES];
+    uint32_t nBadTransfers = 0U;
+    uint32_t batch;
+    uint32_t slot;
+    uint32_t index;
+    uint32_t ticks;
+
+    *nSercomReEnables = 0U;
+    *nStallTicks = 0U;
+
+    for (batch = 0U; batch < nTransfers; batch += TEST_BATCH_SIZE)
+    {
+        SPI_MODEL_StatisticsReset();
+        testNumCompleted = 0U;
+        testNumErrors = 0U;
+
+        for (slot = 0U; (slot < TEST_BATCH_SIZE) && ((batch + slot) < nTransfers); slot++)
+        {
+            for (index = 0U; index < TEST_BUFFER_SIZE; index++)
+            {
+                testTxBuffer[slot][index] = (uint8_t)rand();
+                testRxBuffer[slot][index] = 0xEEU;
+            }
+
+            DRV_SPI_WriteReadTransferAdd(testHandle[transfers[batch + slot].client],
+                    testTxBuffer[slot], transfers[batch + slot].txSize,
+                    testRxBuffer[slot], transfers[batch + slot].rxSize, &transferHandle);
+            TEST_CHECK(transferHandle != DRV_SPI_TRANSFER_HANDLE_INVALID);
+        }
+
+        for (ticks = 0U; (ticks < TEST_TICKS_MAX) && ((testNumCompleted + testNumErrors) < slot); ticks++)
+        {
+            SPI_MODEL_Tick();
+        }
+
+        /* Let the SS pad be released after the last character */
+        SPI_MODEL_Tick();
+
+        TEST_CHECK_EQUAL(testNumCompleted, slot);
+        TEST_CHECK_EQUAL(testNumErrors, 0U);
+        TEST_CHECK(SPI_MODEL_IsIdle() == true);
+
+        /* The frames of each device come in the order of its transfers */
+        (void) memset(nFrames, 0, sizeof(nFrames));
+
+        for (index = 0U; index < slot; index++)
+        {
+            if (testTransferCheck(&transfers[batch + index], index, nFrames[transfers[batch + index].client]) == false)
+            {
+                nBadTransfers++;
+            }
+
+            nFrames[transfers[batch + index].client]++;
+        }
+
+        for (index = 0U; index < SPI_MODEL_DEVICES; index++)
+        {
+            TEST_CHECK_EQUAL(gSpiModel.device[index].nFrames, nFrames[index]);
+            TEST_CHECK_EQUAL(gSpiModel.device[index].nOverflows, 0U);
+        }
+
+        *nSercomReEnables += gSpiModel.nSercomReEnables;
+        *nStallTicks += gSpiModel.nStallTicks;
+    }
+
+    return nBadTransfers;
+}
+
+// *****************************************************************************
+// Section: Scenarios
+// *****************************************************************************
+
+/* Writes, reads with a command phase, and both lengths the other way round */
+static const TEST_TRANSFER testSingleClient[] =
+{
+    { 0U, 4U, 0U },
+    { 0U, 3U, 16U },
+    { 0U, 20U, 4U },
+    { 0U, 0U, 8U },
+    { 0U, 8U, 8U },
+    { 0U, 1U, 40U },
+    { 0U, 33U, 1U },
+    { 0U, 2U, 2U },
+};
+
+/* The two devices in turn, then one of them for a while */
+static const TEST_TRANSFER testTwoClients[] =
+{
+    { 0U, 3U, 16U },
+    { 1U, 20U, 4U },
+    { 0U, 20U, 4U },
+    { 1U, 3U, 16U },
+    { 0U, 8U, 0U },
+    { 0U, 2U, 12U },
+    { 0U, 12U, 2U },
+    { 0U, 4U, 4U },
+};
+
+/* Number of client switches between a hardware and a GPIO chip select along
+ * the transfers, starting from MSSEN off */
+static uint32_t testChipSelectSwitches( const TEST_TRANSFER* transfers, uint32_t nTransfers, uint32_t hardwareClient )
+{
+    uint32_t nSwitches = 0U;
+    bool isHardware = false;
+    uint32_t index;
+
+    for (index = 0U; index < nTransfers; index++)
+    {
+        if ((transfers[index].client == hardwareClient) != isHardware)
+        {
+            isHardware = !isHardware;
+            nSwitches++;
+        }
+    }
+
+    return nSwitches;
+}
+
+static void testScenarioRun( const char* name, SYS_PORT_PIN hardwareChipSelect, const TEST_TRANSFER* transfers,
+        uint32_t nTransfers, uint32_t nClients )
+{
+    uint32_t nBadTransfers;
+    uint32_t nSercomReEnables;
+    uint32_t nStallTicks;
+    uint32_t nExpectedReEnables = 0U;
+    SYS_DMA_CHANNEL_CONFIG txSettings;
+    SYS_DMA_CHANNEL_CONFIG rxSettings;
+
+    SPI_MODEL_Reset(hardwareChipSelect, TEST_PIN_PA17, TEST_PIN_PB21, TEST_ISR_LATENCY);
+    testHandle[0] = DRV_HANDLE_INVALID;
+    testHandle[1] = DRV_HANDLE_INVALID;
+
+    testInitialize(hardwareChipSelect);
+    testOpen(0U, TEST_PIN_PA17);
+
+    if (nClients > 1U)
+    {
+        testOpen(1U, TEST_PIN_PB21);
+    }
+
+    txSettings = gSpiModel.dma[SYS_DMA_CHANNEL_1].descriptor.DMAC_BTCTRL & DMAC_BTCTRL_BLOCKACT_Msk;
+    rxSettings = gSpiModel.dma[SYS_DMA_CHANNEL_0].descriptor.DMAC_BTCTRL & DMAC_BTCTRL_BLOCKACT_Msk;
+
+    nBadTransfers = testTransfersRun(transfers, nTransfers, &nSercomReEnables, &nStallTicks);
+
+    if (hardwareChipSelect != SYS_PORT_PIN_NONE)
+    {
+        nExpectedReEnables = testChipSelectSwitches(transfers, nTransfers, 0U);
+    }
+
+    (void) printf("spi_master: %s: %u transfers, %u bad, %u SERCOM re-enables, %u idle character times with a device selected\n",
+            name, nTransfers, nBadTransfers, nSercomReEnables, nStallTicks);
+
+    TEST_CHECK_EQUAL(nBadTransfers, 0U);
+    TEST_CHECK_EQUAL(nSercomReEnables, nExpectedReEnables);
+    TEST_CHECK_EQUAL(SPI_MODEL_Errors(), 0U);
+
+    /* The settings changed for the descriptor chains have been restored */
+    TEST_CHECK_EQUAL(gSpiModel.dma[SYS_DMA_CHANNEL_1].descriptor.DMAC_BTCTRL & DMAC_BTCTRL_BLOCKACT_Msk, txSettings);
+    TEST_CHECK_EQUAL(gSpiModel.dma[SYS_DMA_CHANNEL_0].descriptor.DMAC_BTCTRL & DMAC_BTCTRL_BLOCKACT_Msk, rxSettings);
+
+    testClose();
+    testInstance++;
+}
+
+int main( int argc, char *argv[] )
+{
+    int result;
+
+    srand(1U);
+
+    /* spi_multi_instance default: all chip selects from GPIO */
+    testScenarioRun("GPIO chip select", SYS_PORT_PIN_NONE, testSingleClient,
+            sizeof(testSingleClient) / sizeof(testSingleClient[0]), 1U);
+
+    /* DRV_SPI_HARDWARE_CS_PIN_IDX1 set to PA17, the pad given to the SERCOM */
+    testScenarioRun("hardware chip select", TEST_PIN_PA17, testSingleClient,
+            sizeof(testSingleClient) / sizeof(testSingleClient[0]), 1U);
+
+    testScenarioRun("GPIO chip select, two clients", SYS_PORT_PIN_NONE, testTwoClients,
+            sizeof(testTwoClients) / sizeof(testTwoClients[0]), 2U);
+
+    testScenarioRun("hardware and GPIO chip select, two clients", TEST_PIN_PA17, testTwoClients,
+            sizeof(testTwoClients) / sizeof(testTwoClients[0]), 2U);
+
+    TEST_CHECK_EQUAL(gSysIntDisableDepth, 0U);
+
+    result = TEST_RESULT("spi_master");
+    return result;
+}
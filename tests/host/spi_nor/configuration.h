@@ -0,0 +1,19 @@
+/* Configuration of the SPI NOR host test: one DRV_MEMORY instance on top of
+ * one SPI NOR instance, as DRV_MEMORY instance 1 of the nvm_fat application,
+ * without the flash translation layer and the DMA memory service. */
+#ifndef CONFIGURATION_H
+#define CONFIGURATION_H
+
+#include "device.h"
+
+#define DRV_MEMORY_INDEX_0                    0
+#define DRV_MEMORY_CLIENTS_NUMBER_IDX0        1
+#define DRV_MEMORY_BUF_Q_SIZE_IDX0            1
+#define DRV_MEMORY_INSTANCES_NUMBER           (1U)
+
+#define DRV_SPI_NOR_INDEX                     0
+#define DRV_SPI_NOR_INSTANCES_NUMBER          (1U)
+#define DRV_SPI_NOR_CLOCK_SPEED_HZ            8000000U
+#define DRV_SPI_NOR_ERASE_BUFFER_SIZE         4096U
+
+#endif // CONFIGURATION_H
@@ -0,0 +1,305 @@
+/*******************************************************************************
+  File-backed SPI NOR Flash Model
+
+  File Name:
+    flash_model.c
+
+  Summary:
+    Implementation of the SPI NOR flash model used by the SPI NOR host test.
+*******************************************************************************/
+
+#include <string.h>
+#include "flash_model.h"
+
+#define FLASH_CMD_WRITE_ENABLE          (0x06U)
+#define FLASH_CMD_READ_STATUS           (0x05U)
+#define FLASH_CMD_FAST_READ             (0x0BU)
+#define FLASH_CMD_PAGE_PROGRAM          (0x02U)
+#define FLASH_CMD_SECTOR_ERASE          (0x20U)
+#define FLASH_CMD_JEDEC_ID              (0x9FU)
+
+/* SST26VF016B */
+static const uint8_t flashJedecId[3] = { 0xBFU, 0x26U, 0x41U };
+
+static void flashArrayWrite( FLASH_MODEL *model, uint32_t address, const uint8_t *data, uint32_t length )
+{
+    (void) fseek(model->file, (long)address, SEEK_SET);
+    (void) fwrite(data, 1U, length, model->file);
+    (void) fflush(model->file);
+}
+
+void FLASH_MODEL_ArrayRead( FLASH_MODEL *model, uint32_t address, uint8_t *data, uint32_t length )
+{
+    (void) fseek(model->file, (long)address, SEEK_SET);
+
+    if (fread(data, 1U, length, model->file) != length)
+    {
+        (void) memset(data, 0, length);
+    }
+}
+
+bool FLASH_MODEL_Open( FLASH_MODEL *model, const char *path, uint32_t size )
+{
+    uint8_t erased[FLASH_MODEL_SECTOR_SIZE];
+    uint32_t offset;
+
+    (void) memset(model, 0, sizeof(*model));
+
+    model->size = size;
+    model->file = fopen(path, "w+b");
+
+    if (model->file == NULL)
+    {
+        return false;
+    }
+
+    (void) memset(erased, 0xFF, sizeof(erased));
+
+    for (offset = 0U; offset < size; offset += FLASH_MODEL_SECTOR_SIZE)
+    {
+        flashArrayWrite(model, offset, erased, FLASH_MODEL_SECTOR_SIZE);
+    }
+
+    return true;
+}
+
+void FLASH_MODEL_Close( FLASH_MODEL *model )
+{
+    if (model->file != NULL)
+    {
+        (void) fclose(model->file);
+        model->file = NULL;
+    }
+}
+
+bool FLASH_MODEL_Reopen( FLASH_MODEL *model, const char *path )
+{
+    FLASH_MODEL_Close(model);
+
+    model->file = fopen(path, "r+b");
+    model->selected = false;
+    model->wel = false;
+    model->busyPolls = 0U;
+
+    return (model->file != NULL);
+}
+
+void FLASH_MODEL_Select( FLASH_MODEL *model )
+{
+    model->selected = true;
+    model->index = 0U;
+    model->address = 0U;
+    model->pageBytes = 0U;
+}
+
+static void flashProgram( FLASH_MODEL *model )
+{
+    uint8_t current[FLASH_MODEL_PAGE_SIZE];
+    uint32_t pageBase = model->address & ~(FLASH_MODEL_PAGE_SIZE - 1U);
+    uint32_t offset = model->address & (FLASH_MODEL_PAGE_SIZE - 1U);
+    uint32_t i;
+
+    FLASH_MODEL_ArrayRead(model, pageBase, current, FLASH_MODEL_PAGE_SIZE);
+
+    for (i = 0U; i < model->pageBytes; i++)
+    {
+        /* Data beyond the end of the page wraps to its start */
+        uint32_t at = (offset + i) % FLASH_MODEL_PAGE_SIZE;
+        uint8_t data = model->page[i];
+
+        if ((data & (uint8_t)~current[at]) != 0U)
+        {
+            /* A 0 bit cannot be programmed back to 1 */
+            model->errProgramNotErased++;
+        }
+
+        current[at] &= data;
+    }
+
+    flashArrayWrite(model, pageBase, current, FLASH_MODEL_PAGE_SIZE);
+
+    model->nPrograms++;
+    model->busyPolls = FLASH_MODEL_PROGRAM_BUSY_POLLS;
+}
+
+static void flashErase( FLASH_MODEL *model )
+{
+    uint8_t erased[FLASH_MODEL_SECTOR_SIZE];
+
+    (void) memset(erased, 0xFF, sizeof(erased));
+    flashArrayWrite(model, model->address & ~(FLASH_MODEL_SECTOR_SIZE - 1U), erased, FLASH_MODEL_SECTOR_SIZE);
+
+    model->nErases++;
+    model->busyPolls = FLASH_MODEL_ERASE_BUSY_POLLS;
+}
+
+void FLASH_MODEL_Deselect( FLASH_MODEL *model )
+{
+    if ((model->selected == true) && (model->index > 0U))
+    {
+        switch (model->opcode)
+        {
+            case FLASH_CMD_WRITE_ENABLE:
+            {
+                model->wel = true;
+                break;
+            }
+
+            case FLASH_CMD_PAGE_PROGRAM:
+            {
+                if (model->index >= 4U)
+                {
+                    flashProgram(model);
+                }
+                model->wel = false;
+                break;
+            }
+
+            case FLASH_CMD_SECTOR_ERASE:
+            {
+                if (model->index == 4U)
+                {
+                    flashErase(model);
+                }
+                model->wel = false;
+                break;
+            }
+
+            default:
+            {
+                break;
+            }
+        }
+    }
+
+    model->selected = false;
+}
+
+uint8_t FLASH_MODEL_Transfer( FLASH_MODEL *model, uint8_t mosi )
+{
+    uint8_t miso = 0xFFU;
+    uint32_t index = model->index;
+
+    if (model->selected == false)
+    {
+        model->errClockWithoutSelect++;
+        return miso;
+    }
+
+    model->index++;
+
+    if (index == 0U)
+    {
+        model->opcode = mosi;
+
+        if ((model->busyPolls != 0U) && (mosi != FLASH_CMD_READ_STATUS))
+        {
+            model->errCommandWhileBusy++;
+        }
+
+        if (((mosi == FLASH_CMD_PAGE_PROGRAM) || (mosi == FLASH_CMD_SECTOR_ERASE)) && (model->wel == false))
+        {
+            model->errWriteWithoutWel++;
+        }
+
+        switch (mosi)
+        {
+            case FLASH_CMD_WRITE_ENABLE:
+            case FLASH_CMD_PAGE_PROGRAM:
+            case FLASH_CMD_SECTOR_ERASE:
+            case FLASH_CMD_JEDEC_ID:
+            {
+                break;
+            }
+
+            case FLASH_CMD_READ_STATUS:
+            {
+                break;
+            }
+
+            case FLASH_CMD_FAST_READ:
+            {
+                model->nReadCommands++;
+                break;
+            }
+
+            default:
+            {
+                model->errUnknownCommand++;
+                break;
+            }
+        }
+
+        return miso;
+    }
+
+    switch (model->opcode)
+    {
+        case FLASH_CMD_READ_STATUS:
+        {
+            miso = (uint8_t)(((model->busyPolls != 0U) ? 0x01U : 0x00U) | ((model->wel == true) ? 0x02U : 0x00U));
+
+            if (model->busyPolls != 0U)
+            {
+                model->busyPolls--;
+            }
+            break;
+        }
+
+        case FLASH_CMD_JEDEC_ID:
+        {
+            if (index <= 3U)
+            {
+                miso = flashJedecId[index - 1U];
+            }
+            break;
+        }
+
+        case FLASH_CMD_FAST_READ:
+        case FLASH_CMD_PAGE_PROGRAM:
+        case FLASH_CMD_SECTOR_ERASE:
+        {
+            if (index <= 3U)
+            {
+                model->address = (model->address << 8) | mosi;
+            }
+            else if (model->opcode == FLASH_CMD_FAST_READ)
+            {
+                /* Byte 4 is the dummy byte */
+                if (index >= 5U)
+                {
+                    uint32_t address = (model->address + (index - 5U)) % model->size;
+                    FLASH_MODEL_ArrayRead(model, address, &miso, 1U);
+                }
+            }
+            else if (model->opcode == FLASH_CMD_PAGE_PROGRAM)
+            {
+                if (model->pageBytes < FLASH_MODEL_PAGE_SIZE)
+                {
+                    model->page[model->pageBytes] = mosi;
+                    model->pageBytes++;
+                }
+            }
+            else
+            {
+                /* Extra bytes after the erase address cancel the command */
+                model->index = 5U;
+            }
+            break;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+
+    return miso;
+}
+
+uint32_t FLASH_MODEL_Errors( const FLASH_MODEL *model )
+{
+    return model->errClockWithoutSelect + model->errCommandWhileBusy +
+           model->errWriteWithoutWel + model->errProgramNotErased +
+           model->errUnknownCommand;
+}
@@ -0,0 +1,80 @@
+/*******************************************************************************
+  File-backed SPI NOR Flash Model
+
+  File Name:
+    flash_model.h
+
+  Summary:
+    Byte level model of a JEDEC SPI NOR flash whose array lives in a file.
+
+  Description:
+    The model decodes the command set used by DRV_SPI_NOR (WREN, RDSR, fast
+    read, page program, 4 KB sector erase, JEDEC ID) one byte at a time,
+    framed by the chip select. Programming can only clear bits and wraps
+    inside the 256 byte page; program and erase set WIP for a number of status
+    reads. Protocol violations are counted instead of aborting so that a test
+    can report them.
+*******************************************************************************/
+
+#ifndef FLASH_MODEL_H
+#define FLASH_MODEL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#define FLASH_MODEL_PAGE_SIZE           (256U)
+#define FLASH_MODEL_SECTOR_SIZE         (4096U)
+
+/* Status reads that return WIP after a program or an erase */
+#define FLASH_MODEL_PROGRAM_BUSY_POLLS  (2U)
+#define FLASH_MODEL_ERASE_BUSY_POLLS    (5U)
+
+typedef struct
+{
+    FILE *file;
+    uint32_t size;
+
+    bool selected;
+    bool wel;
+    uint32_t busyPolls;
+
+    /* Decoder state of the current command */
+    uint8_t opcode;
+    uint32_t index;
+    uint32_t address;
+    uint8_t page[FLASH_MODEL_PAGE_SIZE];
+    uint32_t pageBytes;
+
+    /* Statistics */
+    uint32_t nPrograms;
+    uint32_t nErases;
+    uint32_t nReadCommands;
+
+    /* Protocol violations */
+    uint32_t errClockWithoutSelect;
+    uint32_t errCommandWhileBusy;
+    uint32_t errWriteWithoutWel;
+    uint32_t errProgramNotErased;
+    uint32_t errUnknownCommand;
+
+} FLASH_MODEL;
+
+/* Creates the backing file with an erased (0xFF) array */
+bool FLASH_MODEL_Open( FLASH_MODEL *model, const char *path, uint32_t size );
+void FLASH_MODEL_Close( FLASH_MODEL *model );
+
+/* Closes and reopens the backing file, as across a power cycle. The
+ * statistics and violation counters are kept. */
+bool FLASH_MODEL_Reopen( FLASH_MODEL *model, const char *path );
+
+void FLASH_MODEL_Select( FLASH_MODEL *model );
+void FLASH_MODEL_Deselect( FLASH_MODEL *model );
+uint8_t FLASH_MODEL_Transfer( FLASH_MODEL *model, uint8_t mosi );
+
+/* Direct array access for the checks of the test */
+void FLASH_MODEL_ArrayRead( FLASH_MODEL *model, uint32_t address, uint8_t *data, uint32_t length );
+
+uint32_t FLASH_MODEL_Errors( const FLASH_MODEL *model );
+
+#endif // FLASH_MODEL_H
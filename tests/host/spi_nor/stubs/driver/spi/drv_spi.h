@@ -0,0 +1,75 @@
+/* Host stand-in for the DRV_SPI client interface used by DRV_SPI_NOR. The
+ * functions are implemented by the fake SPI bus of the test. */
+#ifndef DRV_SPI_H
+#define DRV_SPI_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "driver/driver_common.h"
+#include "system/system.h"
+#include "system/ports/sys_ports.h"
+
+typedef uintptr_t DRV_SPI_TRANSFER_HANDLE;
+
+#define DRV_SPI_TRANSFER_HANDLE_INVALID     ((DRV_SPI_TRANSFER_HANDLE)(-1))
+
+typedef enum
+{
+    DRV_SPI_TRANSFER_EVENT_PENDING = 0,
+    DRV_SPI_TRANSFER_EVENT_COMPLETE = 1,
+    DRV_SPI_TRANSFER_EVENT_HANDLE_EXPIRED = 2,
+    DRV_SPI_TRANSFER_EVENT_ERROR = -1,
+    DRV_SPI_TRANSFER_EVENT_HANDLE_INVALID = -2
+
+} DRV_SPI_TRANSFER_EVENT;
+
+typedef enum
+{
+    DRV_SPI_CLOCK_PHASE_VALID_TRAILING_EDGE = 0,
+    DRV_SPI_CLOCK_PHASE_VALID_LEADING_EDGE = 1
+
+} DRV_SPI_CLOCK_PHASE;
+
+typedef enum
+{
+    DRV_SPI_CLOCK_POLARITY_IDLE_LOW = 0,
+    DRV_SPI_CLOCK_POLARITY_IDLE_HIGH = 1
+
+} DRV_SPI_CLOCK_POLARITY;
+
+typedef enum
+{
+    DRV_SPI_DATA_BITS_8 = 0
+
+} DRV_SPI_DATA_BITS;
+
+typedef enum
+{
+    DRV_SPI_CS_POLARITY_ACTIVE_LOW = 0,
+    DRV_SPI_CS_POLARITY_ACTIVE_HIGH = 1
+
+} DRV_SPI_CS_POLARITY;
+
+typedef struct
+{
+    uint32_t                        baudRateInHz;
+    DRV_SPI_CLOCK_PHASE             clockPhase;
+    DRV_SPI_CLOCK_POLARITY          clockPolarity;
+    DRV_SPI_DATA_BITS               dataBits;
+    SYS_PORT_PIN                    chipSelect;
+    DRV_SPI_CS_POLARITY             csPolarity;
+
+} DRV_SPI_TRANSFER_SETUP;
+
+typedef void ( *DRV_SPI_TRANSFER_EVENT_HANDLER )( DRV_SPI_TRANSFER_EVENT event, DRV_SPI_TRANSFER_HANDLE transferHandle, uintptr_t context );
+
+DRV_HANDLE DRV_SPI_Open( const SYS_MODULE_INDEX drvIndex, const DRV_IO_INTENT ioIntent );
+void DRV_SPI_Close( const DRV_HANDLE handle );
+bool DRV_SPI_TransferSetup( const DRV_HANDLE handle, DRV_SPI_TRANSFER_SETUP *setup );
+void DRV_SPI_TransferEventHandlerSet( const DRV_HANDLE handle, const DRV_SPI_TRANSFER_EVENT_HANDLER eventHandler, uintptr_t context );
+void DRV_SPI_WriteReadTransferAdd( const DRV_HANDLE handle, void *pTransmitData, size_t txSize, void *pReceiveData, size_t rxSize, DRV_SPI_TRANSFER_HANDLE * const transferHandle );
+void DRV_SPI_WriteTransferAdd( const DRV_HANDLE handle, void *pTransmitData, size_t txSize, DRV_SPI_TRANSFER_HANDLE * const transferHandle );
+void DRV_SPI_ReadTransferAdd( const DRV_HANDLE handle, void *pReceiveData, size_t rxSize, DRV_SPI_TRANSFER_HANDLE * const transferHandle );
+
+#endif // DRV_SPI_H
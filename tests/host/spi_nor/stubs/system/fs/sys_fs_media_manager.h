@@ -0,0 +1,18 @@
+/* Host stand-in for the media manager interface. The test registers nothing
+ * with SYS_FS; DRV_MEMORY_RegisterWithSysFs() is provided by the test. */
+#ifndef SYS_FS_MEDIA_MANAGER_H
+#define SYS_FS_MEDIA_MANAGER_H
+
+#include "system/system_media.h"
+
+typedef enum
+{
+    SYS_FS_MEDIA_TYPE_NVM,
+    SYS_FS_MEDIA_TYPE_MSD,
+    SYS_FS_MEDIA_TYPE_SD_CARD,
+    SYS_FS_MEDIA_TYPE_RAM,
+    SYS_FS_MEDIA_TYPE_SPIFLASH
+
+} SYS_FS_MEDIA_TYPE;
+
+#endif // SYS_FS_MEDIA_MANAGER_H
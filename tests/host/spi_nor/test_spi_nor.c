@@ -0,0 +1,483 @@
+/*******************************************************************************
+  SPI NOR Host Test
+
+  File Name:
+    test_spi_nor.c
+
+  Summary:
+    Runs DRV_MEMORY on top of DRV_SPI_NOR against a file-backed flash model.
+
+  Description:
+    DRV_MEMORY and DRV_SPI_NOR are the firmware sources of the nvm_fat
+    application. DRV_SPI is replaced by a fake bus that completes one queued
+    transfer per service call, from the test loop, the way the SPI/DMA
+    interrupt completes them on the target. Every byte goes through the flash
+    model, which checks the command sequencing and persists the array in a
+    file. The test compares all reads with a shadow image, reopens the file
+    to check that the data survives, and fails on any protocol violation.
+*******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "test_host.h"
+#include "flash_model.h"
+#include "driver/spi/drv_spi.h"
+#include "driver/spi_nor/drv_spi_nor.h"
+#include "driver/memory/drv_memory.h"
+#include "system/fs/sys_fs_media_manager.h"
+
+#define TEST_FLASH_SIZE             (256U * 1024U)
+#define TEST_CS_PIN                 ((SYS_PORT_PIN)17U)
+#define TEST_QUEUE_SIZE             (8U)
+#define TEST_MAX_SPI_TRANSFER       (32768U)
+#define TEST_MAX_STEPS              (20000000U)
+
+static const char *testFilePath = "spi_nor_flash.bin";
+
+static FLASH_MODEL testFlash;
+static uint8_t shadow[TEST_FLASH_SIZE];
+static uint8_t scratch[TEST_FLASH_SIZE];
+
+// *****************************************************************************
+// Section: Fake DRV_SPI bus
+// *****************************************************************************
+
+typedef struct
+{
+    uint8_t *tx;
+    size_t txSize;
+    uint8_t *rx;
+    size_t rxSize;
+    DRV_SPI_TRANSFER_HANDLE handle;
+
+} TEST_SPI_TRANSFER;
+
+static struct
+{
+    bool opened;
+    bool exclusive;
+    DRV_SPI_TRANSFER_EVENT_HANDLER handler;
+    uintptr_t context;
+    TEST_SPI_TRANSFER queue[TEST_QUEUE_SIZE];
+    uint32_t head;
+    uint32_t count;
+    uint32_t nextHandle;
+    uint32_t nTransfers;
+    size_t maxTransfer;
+
+} testSpi;
+
+void SYS_PORT_PinSet( SYS_PORT_PIN pin )
+{
+    if (pin == TEST_CS_PIN)
+    {
+        FLASH_MODEL_Deselect(&testFlash);
+    }
+}
+
+void SYS_PORT_PinClear( SYS_PORT_PIN pin )
+{
+    if (pin == TEST_CS_PIN)
+    {
+        FLASH_MODEL_Select(&testFlash);
+    }
+}
+
+DRV_HANDLE DRV_SPI_Open( const SYS_MODULE_INDEX drvIndex, const DRV_IO_INTENT ioIntent )
+{
+    (void) drvIndex;
+
+    testSpi.opened = true;
+    testSpi.exclusive = (((uint32_t)ioIntent & (uint32_t)DRV_IO_INTENT_EXCLUSIVE) != 0U);
+
+    return (DRV_HANDLE)1;
+}
+
+void DRV_SPI_Close( const DRV_HANDLE handle )
+{
+    (void) handle;
+    testSpi.opened = false;
+}
+
+bool DRV_SPI_TransferSetup( const DRV_HANDLE handle, DRV_SPI_TRANSFER_SETUP *setup )
+{
+    (void) handle;
+    return ((setup->clockPolarity == DRV_SPI_CLOCK_POLARITY_IDLE_LOW) && (setup->dataBits == DRV_SPI_DATA_BITS_8));
+}
+
+void DRV_SPI_TransferEventHandlerSet( const DRV_HANDLE handle, const DRV_SPI_TRANSFER_EVENT_HANDLER eventHandler, uintptr_t context )
+{
+    (void) handle;
+    testSpi.handler = eventHandler;
+    testSpi.context = context;
+}
+
+void DRV_SPI_WriteReadTransferAdd( const DRV_HANDLE handle, void *pTransmitData, size_t txSize, void *pReceiveData, size_t rxSize, DRV_SPI_TRANSFER_HANDLE * const transferHandle )
+{
+    TEST_SPI_TRANSFER *xfer;
+
+    (void) handle;
+
+    if ((testSpi.opened == false) || (testSpi.count == TEST_QUEUE_SIZE))
+    {
+        *transferHandle = DRV_SPI_TRANSFER_HANDLE_INVALID;
+        return;
+    }
+
+    xfer = &testSpi.queue[(testSpi.head + testSpi.count) % TEST_QUEUE_SIZE];
+    xfer->tx = (uint8_t *)pTransmitData;
+    xfer->txSize = txSize;
+    xfer->rx = (uint8_t *)pReceiveData;
+    xfer->rxSize = rxSize;
+    xfer->handle = (DRV_SPI_TRANSFER_HANDLE)(++testSpi.nextHandle);
+    testSpi.count++;
+
+    *transferHandle = xfer->handle;
+}
+
+void DRV_SPI_WriteTransferAdd( const DRV_HANDLE handle, void *pTransmitData, size_t txSize, DRV_SPI_TRANSFER_HANDLE * const transferHandle )
+{
+    DRV_SPI_WriteReadTransferAdd(handle, pTransmitData, txSize, NULL, 0U, transferHandle);
+}
+
+void DRV_SPI_ReadTransferAdd( const DRV_HANDLE handle, void *pReceiveData, size_t rxSize, DRV_SPI_TRANSFER_HANDLE * const transferHandle )
+{
+    DRV_SPI_WriteReadTransferAdd(handle, NULL, 0U, pReceiveData, rxSize, transferHandle);
+}
+
+/* Completes the transfer at the head of the queue, as the SPI interrupt */
+static void testSpiService( void )
+{
+    TEST_SPI_TRANSFER xfer;
+    size_t length;
+    size_t i;
+
+    if (testSpi.count == 0U)
+    {
+        return;
+    }
+
+    xfer = testSpi.queue[testSpi.head];
+    testSpi.head = (testSpi.head + 1U) % TEST_QUEUE_SIZE;
+    testSpi.count--;
+
+    length = (xfer.txSize > xfer.rxSize) ? xfer.txSize : xfer.rxSize;
+
+    for (i = 0U; i < length; i++)
+    {
+        uint8_t mosi = ((xfer.tx != NULL) && (i < xfer.txSize)) ? xfer.tx[i] : 0xFFU;
+        uint8_t miso = FLASH_MODEL_Transfer(&testFlash, mosi);
+
+        if ((xfer.rx != NULL) && (i < xfer.rxSize))
+        {
+            xfer.rx[i] = miso;
+        }
+    }
+
+    testSpi.nTransfers++;
+
+    if (length > testSpi.maxTransfer)
+    {
+        testSpi.maxTransfer = length;
+    }
+
+    if (testSpi.handler != NULL)
+    {
+        testSpi.handler(DRV_SPI_TRANSFER_EVENT_COMPLETE, xfer.handle, testSpi.context);
+    }
+}
+
+// *****************************************************************************
+// Section: DRV_MEMORY harness
+// *****************************************************************************
+
+static const DRV_SPI_NOR_INIT testSpiNorInit =
+{
+    .spiDrvIndex                = 0,
+    .chipSelectPin              = TEST_CS_PIN,
+    .clockSpeedHz               = DRV_SPI_NOR_CLOCK_SPEED_HZ,
+    .flashSize                  = TEST_FLASH_SIZE,
+};
+
+static uint8_t testEraseBuffer[DRV_SPI_NOR_ERASE_BUFFER_SIZE];
+static DRV_MEMORY_CLIENT_OBJECT testClientObject[DRV_MEMORY_CLIENTS_NUMBER_IDX0];
+static DRV_MEMORY_BUFFER_OBJECT testBufferObject[DRV_MEMORY_BUF_Q_SIZE_IDX0];
+
+static const DRV_MEMORY_DEVICE_INTERFACE testDeviceApi =
+{
+    .Open               = DRV_SPI_NOR_Open,
+    .Close              = DRV_SPI_NOR_Close,
+    .Status             = DRV_SPI_NOR_Status,
+    .SectorErase        = DRV_SPI_NOR_SectorErase,
+    .Read               = DRV_SPI_NOR_Read,
+    .PageWrite          = DRV_SPI_NOR_PageWrite,
+    .EventHandlerSet    = NULL,
+    .GeometryGet        = (DRV_MEMORY_DEVICE_GEOMETRY_GET)DRV_SPI_NOR_GeometryGet,
+    .TransferStatusGet  = (DRV_MEMORY_DEVICE_TRANSFER_STATUS_GET)DRV_SPI_NOR_TransferStatusGet
+};
+
+static const DRV_MEMORY_INIT testMemoryInit =
+{
+    .memDevIndex                = DRV_SPI_NOR_INDEX,
+    .memoryDevice               = &testDeviceApi,
+    .isMemDevInterruptEnabled   = false,
+    .isFsEnabled                = true,
+    .deviceMediaType            = (uint8_t)SYS_FS_MEDIA_TYPE_SPIFLASH,
+    .ewBuffer                   = &testEraseBuffer[0],
+    .clientObjPool              = (uintptr_t)&testClientObject[0],
+    .bufferObj                  = (uintptr_t)&testBufferObject[0],
+    .queueSize                  = DRV_MEMORY_BUF_Q_SIZE_IDX0,
+    .nClientsMax                = DRV_MEMORY_CLIENTS_NUMBER_IDX0
+};
+
+static SYS_MODULE_OBJ testMemoryObj;
+static uint8_t testRegisteredMediaType = 0xFFU;
+
+void DRV_MEMORY_RegisterWithSysFs( const SYS_MODULE_INDEX drvIndex, uint8_t mediaType )
+{
+    (void) drvIndex;
+    testRegisteredMediaType = mediaType;
+}
+
+static void testStep( void )
+{
+    DRV_MEMORY_Tasks(testMemoryObj);
+    testSpiService();
+}
+
+/* Runs the system until the command ends. Returns true on success. */
+static bool testWait( DRV_HANDLE handle, DRV_MEMORY_COMMAND_HANDLE commandHandle )
+{
+    DRV_MEMORY_COMMAND_STATUS status;
+    uint32_t steps;
+
+    if (commandHandle == DRV_MEMORY_COMMAND_HANDLE_INVALID)
+    {
+        return false;
+    }
+
+    for (steps = 0U; steps < TEST_MAX_STEPS; steps++)
+    {
+        status = DRV_MEMORY_CommandStatusGet(handle, commandHandle);
+
+        if (status == DRV_MEMORY_COMMAND_COMPLETED)
+        {
+            return true;
+        }
+
+        if (status == DRV_MEMORY_COMMAND_ERROR_UNKNOWN)
+        {
+            return false;
+        }
+
+        testStep();
+    }
+
+    return false;
+}
+
+static bool testRead( DRV_HANDLE handle, uint8_t *data, uint32_t address, uint32_t length )
+{
+    DRV_MEMORY_COMMAND_HANDLE commandHandle;
+
+    DRV_MEMORY_AsyncRead(handle, &commandHandle, data, address, length);
+    return testWait(handle, commandHandle);
+}
+
+/* SYS_FS path: erase-write of whole pages, anywhere inside the erase sectors */
+static bool testEraseWrite( DRV_HANDLE handle, const uint8_t *data, uint32_t page, uint32_t nPages )
+{
+    DRV_MEMORY_COMMAND_HANDLE commandHandle;
+
+    DRV_MEMORY_AsyncEraseWrite(handle, &commandHandle, (void *)data, page, nPages);
+
+    if (testWait(handle, commandHandle) == false)
+    {
+        return false;
+    }
+
+    (void) memcpy(&shadow[page * FLASH_MODEL_PAGE_SIZE], data, nPages * FLASH_MODEL_PAGE_SIZE);
+    return true;
+}
+
+static DRV_HANDLE testOpen( void )
+{
+    DRV_HANDLE handle = DRV_HANDLE_INVALID;
+    uint32_t steps;
+
+    for (steps = 0U; (steps < 1000U) && (handle == DRV_HANDLE_INVALID); steps++)
+    {
+        testStep();
+        handle = DRV_MEMORY_Open(DRV_MEMORY_INDEX_0, DRV_IO_INTENT_READWRITE);
+    }
+
+    return handle;
+}
+
+static uint32_t testRandom( void )
+{
+    static uint32_t seed = 0x2545F491U;
+
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+
+    return seed;
+}
+
+// *****************************************************************************
+// Section: Test cases
+// *****************************************************************************
+
+static void testGeometry( DRV_HANDLE handle )
+{
+    SYS_MEDIA_GEOMETRY *geometry = DRV_MEMORY_GeometryGet(handle);
+
+    TEST_CHECK(geometry != NULL);
+
+    if (geometry != NULL)
+    {
+        TEST_CHECK_EQUAL(geometry->geometryTable[SYS_MEDIA_GEOMETRY_TABLE_READ_ENTRY].blockSize, 1U);
+        TEST_CHECK_EQUAL(geometry->geometryTable[SYS_MEDIA_GEOMETRY_TABLE_WRITE_ENTRY].blockSize, FLASH_MODEL_PAGE_SIZE);
+        TEST_CHECK_EQUAL(geometry->geometryTable[SYS_MEDIA_GEOMETRY_TABLE_ERASE_ENTRY].blockSize, FLASH_MODEL_SECTOR_SIZE);
+        TEST_CHECK_EQUAL(geometry->geometryTable[SYS_MEDIA_GEOMETRY_TABLE_WRITE_ENTRY].numBlocks, TEST_FLASH_SIZE / FLASH_MODEL_PAGE_SIZE);
+    }
+
+    TEST_CHECK_EQUAL(testRegisteredMediaType, SYS_FS_MEDIA_TYPE_SPIFLASH);
+    TEST_CHECK(testSpi.exclusive == true);
+}
+
+/* A write inside an erase sector keeps the rest of the sector */
+static void testPartialSector( DRV_HANDLE handle )
+{
+    uint8_t data[2U * FLASH_MODEL_PAGE_SIZE];
+    uint32_t i;
+
+    for (i = 0U; i < sizeof(data); i++)
+    {
+        data[i] = (uint8_t)(i * 7U);
+    }
+
+    /* Fill sector 1 first so that the second write needs a read-modify-write */
+    for (i = 0U; i < (FLASH_MODEL_SECTOR_SIZE / sizeof(data)); i++)
+    {
+        TEST_CHECK(testEraseWrite(handle, data, (FLASH_MODEL_SECTOR_SIZE / FLASH_MODEL_PAGE_SIZE) + (i * 2U), 2U));
+    }
+
+    (void) memset(data, 0x5A, sizeof(data));
+    TEST_CHECK(testEraseWrite(handle, data, (FLASH_MODEL_SECTOR_SIZE / FLASH_MODEL_PAGE_SIZE) + 3U, 2U));
+
+    TEST_CHECK(testRead(handle, scratch, 0U, 3U * FLASH_MODEL_SECTOR_SIZE));
+    TEST_CHECK(memcmp(scratch, shadow, 3U * FLASH_MODEL_SECTOR_SIZE) == 0);
+}
+
+/* Random page runs across erase sector boundaries */
+static void testRandomWrites( DRV_HANDLE handle )
+{
+    static uint8_t data[40U * FLASH_MODEL_PAGE_SIZE];
+    uint32_t nPagesTotal = TEST_FLASH_SIZE / FLASH_MODEL_PAGE_SIZE;
+    uint32_t iteration;
+    uint32_t i;
+
+    for (iteration = 0U; iteration < 150U; iteration++)
+    {
+        uint32_t nPages = 1U + (testRandom() % 40U);
+        uint32_t page = testRandom() % (nPagesTotal - nPages);
+        uint32_t readStart = testRandom() % TEST_FLASH_SIZE;
+        uint32_t readLength = 1U + (testRandom() % (TEST_FLASH_SIZE - readStart));
+
+        for (i = 0U; i < (nPages * FLASH_MODEL_PAGE_SIZE); i++)
+        {
+            data[i] = (uint8_t)testRandom();
+        }
+
+        TEST_CHECK(testEraseWrite(handle, data, page, nPages));
+
+        /* Unaligned read of any length */
+        if (readLength > 8192U)
+        {
+            readLength = 8192U;
+        }
+
+        TEST_CHECK(testRead(handle, scratch, readStart, readLength));
+        TEST_CHECK(memcmp(scratch, &shadow[readStart], readLength) == 0);
+    }
+}
+
+/* A read longer than one DMA block transfer is split under one command */
+static void testLongRead( DRV_HANDLE handle )
+{
+    uint32_t readCommands = testFlash.nReadCommands;
+
+    testSpi.maxTransfer = 0U;
+
+    TEST_CHECK(testRead(handle, scratch, 0U, TEST_FLASH_SIZE));
+    TEST_CHECK(memcmp(scratch, shadow, TEST_FLASH_SIZE) == 0);
+
+    TEST_CHECK_EQUAL(testFlash.nReadCommands - readCommands, 1U);
+    TEST_CHECK(testSpi.maxTransfer <= TEST_MAX_SPI_TRANSFER);
+}
+
+/* The array in the file is the one the driver wrote, also after a reopen */
+static void testPersistence( DRV_HANDLE handle )
+{
+    FLASH_MODEL_ArrayRead(&testFlash, 0U, scratch, TEST_FLASH_SIZE);
+    TEST_CHECK(memcmp(scratch, shadow, TEST_FLASH_SIZE) == 0);
+
+    TEST_CHECK(FLASH_MODEL_Reopen(&testFlash, testFilePath));
+
+    (void) memset(scratch, 0, TEST_FLASH_SIZE);
+    TEST_CHECK(testRead(handle, scratch, 0U, TEST_FLASH_SIZE));
+    TEST_CHECK(memcmp(scratch, shadow, TEST_FLASH_SIZE) == 0);
+}
+
+int main( int argc, char *argv[] )
+{
+    DRV_HANDLE handle;
+    int result;
+
+    if (argc > 1)
+    {
+        testFilePath = argv[1];
+    }
+
+    (void) memset(shadow, 0xFF, sizeof(shadow));
+
+    if (FLASH_MODEL_Open(&testFlash, testFilePath, TEST_FLASH_SIZE) == false)
+    {
+        (void) printf("cannot create %s\n", testFilePath);
+        return 1;
+    }
+
+    (void) DRV_SPI_NOR_Initialize((SYS_MODULE_INDEX)DRV_SPI_NOR_INDEX, (SYS_MODULE_INIT *)&testSpiNorInit);
+    testMemoryObj = DRV_MEMORY_Initialize((SYS_MODULE_INDEX)DRV_MEMORY_INDEX_0, (SYS_MODULE_INIT *)&testMemoryInit);
+
+    handle = testOpen();
+    TEST_CHECK(handle != DRV_HANDLE_INVALID);
+
+    if (handle != DRV_HANDLE_INVALID)
+    {
+        testGeometry(handle);
+        testPartialSector(handle);
+        testRandomWrites(handle);
+        testLongRead(handle);
+        testPersistence(handle);
+
+        DRV_MEMORY_Close(handle);
+    }
+
+    (void) printf("spi_nor: %u SPI transfers, %u page programs, %u sector erases\n",
+            testSpi.nTransfers, testFlash.nPrograms, testFlash.nErases);
+
+    TEST_CHECK_EQUAL(testFlash.errClockWithoutSelect, 0U);
+    TEST_CHECK_EQUAL(testFlash.errCommandWhileBusy, 0U);
+    TEST_CHECK_EQUAL(testFlash.errWriteWithoutWel, 0U);
+    TEST_CHECK_EQUAL(testFlash.errProgramNotErased, 0U);
+    TEST_CHECK_EQUAL(testFlash.errUnknownCommand, 0U);
+
+    FLASH_MODEL_Close(&testFlash);
+    (void) remove(testFilePath);
+
+    result = TEST_RESULT("spi_nor");
+    return result;
+}
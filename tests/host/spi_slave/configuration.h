@@ -0,0 +1,15 @@
+/* Configuration of the SPI slave host test: one DRV_SPI_SLAVE instance with a
+ * ping-pong pair of small receive buffers, so that frames cross buffer
+ * boundaries often. */
+#ifndef CONFIGURATION_H
+#define CONFIGURATION_H
+
+#include "device.h"
+
+#define DRV_SPI_SLAVE_INDEX_0                 0
+#define DRV_SPI_SLAVE_BUFFERS_NUMBER_IDX0     (2U)
+#define DRV_SPI_SLAVE_BUFFER_SIZE_IDX0        (16U)
+#define DRV_SPI_SLAVE_RCV_DMA_CH_IDX0         SYS_DMA_CHANNEL_0
+#define DRV_SPI_SLAVE_INSTANCES_NUMBER        (1U)
+
+#endif // CONFIGURATION_H
@@ -0,0 +1,130 @@
+/*******************************************************************************
+  DMA Receive Channel Model
+
+  File Name:
+    dma_model.c
+
+  Summary:
+    SYS_DMA functions of DRV_SPI_SLAVE backed by a model of one DMAC channel.
+*******************************************************************************/
+
+#include <string.h>
+#include "dma_model.h"
+#include "system/int/sys_int.h"
+
+DMA_MODEL gDmaModel;
+
+static void lDMA_MODEL_Fetch(SYS_DMA_DESCRIPTOR* descriptor)
+{
+    gDmaModel.current = descriptor;
+    gDmaModel.count = 0U;
+    gDmaModel.suspended = ((descriptor->DMAC_BTCTRL & DMAC_BTCTRL_VALID_Msk) == 0U);
+}
+
+void DMA_MODEL_Reset(void)
+{
+    (void) memset(&gDmaModel, 0, sizeof(gDmaModel));
+}
+
+void DMA_MODEL_Beat(uint8_t data)
+{
+    if ((gDmaModel.enabled == false) || (gDmaModel.suspended == true))
+    {
+        gDmaModel.nLostBytes++;
+        return;
+    }
+
+    gDmaModel.current->dest[gDmaModel.count] = data;
+    gDmaModel.count++;
+
+    if (gDmaModel.count == gDmaModel.current->DMAC_BTCNT)
+    {
+        gDmaModel.tcmplFlag = true;
+        gDmaModel.irqPending = true;
+
+        lDMA_MODEL_Fetch(gDmaModel.current->next);
+    }
+}
+
+void DMA_MODEL_InterruptServe(void)
+{
+    SYS_DMA_TRANSFER_EVENT event = SYS_DMA_TRANSFER_ERROR;
+
+    if (gDmaModel.irqPending == false)
+    {
+        return;
+    }
+
+    gDmaModel.irqPending = false;
+
+    if (gDmaModel.tcmplFlag == true)
+    {
+        gDmaModel.tcmplFlag = false;
+        event = SYS_DMA_TRANSFER_COMPLETE;
+    }
+
+    if (gDmaModel.callback != NULL)
+    {
+        gDmaModel.callback(event, gDmaModel.context);
+    }
+}
+
+void SYS_DMA_ChannelCallbackRegister(SYS_DMA_CHANNEL channel, const SYS_DMA_CHANNEL_CALLBACK eventHandler, const uintptr_t contextHandle)
+{
+    gDmaModel.callback = eventHandler;
+    gDmaModel.context = contextHandle;
+}
+
+bool SYS_DMA_ChannelLinkedListTransfer(SYS_DMA_CHANNEL channel, SYS_DMA_DESCRIPTOR* channelDesc)
+{
+    /* As DMAC_ChannelLinkedListTransfer, starting a transfer clears the flags */
+    gDmaModel.tcmplFlag = false;
+    gDmaModel.enabled = true;
+
+    lDMA_MODEL_Fetch(channelDesc);
+
+    return true;
+}
+
+void SYS_DMA_LinkedListDescriptorSetup(SYS_DMA_DESCRIPTOR* currentDescriptor, SYS_DMA_CHANNEL_CONFIG setting,
+        const void* srcAddr, const void* destAddr, size_t blockSize, SYS_DMA_DESCRIPTOR* nextDescriptor)
+{
+    currentDescriptor->DMAC_BTCTRL = (uint16_t)setting;
+    currentDescriptor->DMAC_BTCNT = (uint16_t)blockSize;
+    currentDescriptor->dest = (uint8_t*)destAddr;
+    currentDescriptor->next = nextDescriptor;
+}
+
+void SYS_DMA_ChannelDisable(SYS_DMA_CHANNEL channel)
+{
+    gDmaModel.enabled = false;
+}
+
+uint16_t SYS_DMA_ChannelGetTransferredCount(SYS_DMA_CHANNEL channel)
+{
+    if (gSysIntDisableDepth == 0U)
+    {
+        gDmaModel.nUnprotectedReads++;
+    }
+
+    return gDmaModel.count;
+}
+
+bool SYS_DMA_ChannelIsTransferComplete(SYS_DMA_CHANNEL channel)
+{
+    if (gSysIntDisableDepth == 0U)
+    {
+        gDmaModel.nUnprotectedReads++;
+    }
+
+    return gDmaModel.tcmplFlag;
+}
+
+void SYS_DMA_ChannelResume(SYS_DMA_CHANNEL channel)
+{
+    if ((gDmaModel.suspended == true) &&
+        ((gDmaModel.current->DMAC_BTCTRL & DMAC_BTCTRL_VALID_Msk) != 0U))
+    {
+        gDmaModel.suspended = false;
+    }
+}
@@ -0,0 +1,60 @@
+/*******************************************************************************
+  DMA Receive Channel Model
+
+  File Name:
+    dma_model.h
+
+  Summary:
+    Model of one DMAC channel moving received SPI bytes through a ring of
+    linked descriptors.
+
+  Description:
+    Each received byte is one beat. At the end of a block the channel sets its
+    transfer complete flag, raises the DMA interrupt and fetches the next
+    descriptor; a descriptor whose valid bit is cleared suspends the channel.
+    The interrupt is only served when the test calls DMA_MODEL_InterruptServe,
+    so a test can let it stay pending across a frame end. Serving it mirrors
+    DMAC_InterruptHandler: the callback gets an error event if the flag was
+    cleared in the meantime (a new transfer start clears it).
+*******************************************************************************/
+
+#ifndef DMA_MODEL_H
+#define DMA_MODEL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "system/dma/sys_dma.h"
+
+typedef struct
+{
+    SYS_DMA_CHANNEL_CALLBACK callback;
+    uintptr_t context;
+
+    bool enabled;
+    bool suspended;
+    SYS_DMA_DESCRIPTOR* current;
+    uint16_t count;
+
+    /* CHINTFLAG.TCMPL and the interrupt request to the NVIC */
+    bool tcmplFlag;
+    bool irqPending;
+
+    /* Bytes received while the channel was not moving data */
+    uint32_t nLostBytes;
+
+    /* Channel state read with the DMA interrupt enabled */
+    uint32_t nUnprotectedReads;
+
+} DMA_MODEL;
+
+extern DMA_MODEL gDmaModel;
+
+void DMA_MODEL_Reset(void);
+
+/* The SPI peripheral received a byte */
+void DMA_MODEL_Beat(uint8_t data);
+
+/* Serves the DMA interrupt if it is pending */
+void DMA_MODEL_InterruptServe(void);
+
+#endif // DMA_MODEL_H
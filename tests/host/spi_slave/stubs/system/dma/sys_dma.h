@@ -0,0 +1,54 @@
+/* Host stand-in for the SYS_DMA calls of DRV_SPI_SLAVE. The functions are
+ * implemented by the DMA model of the test (dma_model.c), which walks the
+ * linked descriptors the way the DMAC does. */
+#ifndef SYS_DMA_H
+#define SYS_DMA_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define DMAC_BTCTRL_VALID_Msk           (0x0001U)
+#define DMAC_BTCTRL_BLOCKACT_INT        (0x0010U)
+#define DMAC_BTCTRL_BEATSIZE_BYTE       (0x0000U)
+#define DMAC_BTCTRL_DSTINC_Msk          (0x0800U)
+
+typedef enum
+{
+    SYS_DMA_CHANNEL_0 = 0,
+    SYS_DMA_CHANNEL_NONE = -1
+
+} SYS_DMA_CHANNEL;
+
+typedef enum
+{
+    SYS_DMA_TRANSFER_COMPLETE = 1,
+    SYS_DMA_TRANSFER_ERROR
+
+} SYS_DMA_TRANSFER_EVENT;
+
+typedef void (*SYS_DMA_CHANNEL_CALLBACK) (SYS_DMA_TRANSFER_EVENT event, uintptr_t contextHandle);
+
+typedef uint32_t SYS_DMA_CHANNEL_CONFIG;
+
+/* The driver only touches DMAC_BTCTRL; the other members hold the block as
+ * host pointers */
+typedef struct SYS_DMA_DESCRIPTOR_S
+{
+    uint16_t DMAC_BTCTRL;
+    uint16_t DMAC_BTCNT;
+    uint8_t* dest;
+    struct SYS_DMA_DESCRIPTOR_S* next;
+
+} SYS_DMA_DESCRIPTOR;
+
+void SYS_DMA_ChannelCallbackRegister(SYS_DMA_CHANNEL channel, const SYS_DMA_CHANNEL_CALLBACK eventHandler, const uintptr_t contextHandle);
+bool SYS_DMA_ChannelLinkedListTransfer(SYS_DMA_CHANNEL channel, SYS_DMA_DESCRIPTOR* channelDesc);
+void SYS_DMA_LinkedListDescriptorSetup(SYS_DMA_DESCRIPTOR* currentDescriptor, SYS_DMA_CHANNEL_CONFIG setting,
+        const void* srcAddr, const void* destAddr, size_t blockSize, SYS_DMA_DESCRIPTOR* nextDescriptor);
+void SYS_DMA_ChannelDisable(SYS_DMA_CHANNEL channel);
+uint16_t SYS_DMA_ChannelGetTransferredCount(SYS_DMA_CHANNEL channel);
+bool SYS_DMA_ChannelIsTransferComplete(SYS_DMA_CHANNEL channel);
+void SYS_DMA_ChannelResume(SYS_DMA_CHANNEL channel);
+
+#endif // SYS_DMA_H
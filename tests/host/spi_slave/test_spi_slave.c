@@ -0,0 +1,370 @@
+/*******************************************************************************
+  SPI Slave Host Test
+
+  File Name:
+    test_spi_slave.c
+
+  Summary:
+    Runs the ping-pong buffer swap of DRV_SPI_SLAVE against a model of the
+    receive DMA channel.
+
+  Description:
+    DRV_SPI_SLAVE is the firmware source of the spi_slave_ping_pong
+    application, configured with two 16-byte buffers. The test plays the
+    master: it clocks frames into the DMA model byte by byte and ends each
+    frame with the slave select interrupt of the SERCOM PLIB. The DMA
+    interrupt can be left pending for a while, in particular across the end
+    of a frame, in either order with the slave select interrupt, as happens
+    on the target when the last byte of a frame completes a buffer. The
+    client queues the buffers it receives and copies them only when it
+    releases them, from the test task, so that a buffer overwritten while
+    the client owns it is caught. The frames rebuilt by the client must
+    match the frames sent, with no overrun and no byte lost by the DMA.
+*******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "configuration.h"
+#include "test_host.h"
+#include "dma_model.h"
+#include "system/int/sys_int.h"
+#include "driver/spi_slave/drv_spi_slave.h"
+
+#define TEST_NUM_BUFFERS            DRV_SPI_SLAVE_BUFFERS_NUMBER_IDX0
+#define TEST_BUFFER_SIZE            DRV_SPI_SLAVE_BUFFER_SIZE_IDX0
+#define TEST_FRAME_SIZE_MAX         (96U)
+#define TEST_EVENT_QUEUE_SIZE       (16U)
+#define TEST_TASK_PERIOD            (8U)
+
+// *****************************************************************************
+// Section: Fake SERCOM SPI slave PLIB
+// *****************************************************************************
+
+static struct
+{
+    DRV_SPI_SLAVE_PLIB_CALLBACK callback;
+    uintptr_t context;
+    bool isSelected;
+
+} testPlib;
+
+static void testPlibCallbackRegister( DRV_SPI_SLAVE_PLIB_CALLBACK callback, uintptr_t context )
+{
+    testPlib.callback = callback;
+    testPlib.context = context;
+}
+
+static bool testPlibIsBusy( void )
+{
+    return testPlib.isSelected;
+}
+
+static uint32_t testPlibErrorGet( void )
+{
+    return 0U;
+}
+
+static const DRV_SPI_SLAVE_PLIB_INTERFACE testPlibApi =
+{
+    .callbackRegister = testPlibCallbackRegister,
+    .isBusy = testPlibIsBusy,
+    .errorGet = testPlibErrorGet,
+};
+
+// *****************************************************************************
+// Section: Driver instance
+// *****************************************************************************
+
+static uint8_t testBufferPool[TEST_NUM_BUFFERS * TEST_BUFFER_SIZE];
+static SYS_DMA_DESCRIPTOR testDescriptorPool[TEST_NUM_BUFFERS];
+static DRV_SPI_SLAVE_BUFFER_OBJ testBufferObjPool[TEST_NUM_BUFFERS];
+static uint8_t testRxRegister;
+
+static const DRV_SPI_SLAVE_INIT testInit =
+{
+    .spiPlib = &testPlibApi,
+    .dmaChannelReceive = DRV_SPI_SLAVE_RCV_DMA_CH_IDX0,
+    .spiReceiveAddress = &testRxRegister,
+    .bufferPool = testBufferPool,
+    .bufferSize = TEST_BUFFER_SIZE,
+    .numBuffers = TEST_NUM_BUFFERS,
+    .descriptorPool = testDescriptorPool,
+    .bufferObjPool = (uintptr_t)testBufferObjPool,
+};
+
+// *****************************************************************************
+// Section: Client
+// *****************************************************************************
+
+typedef struct
+{
+    DRV_SPI_SLAVE_EVENT event;
+    uint8_t *pBuffer;
+    size_t nBytes;
+
+} TEST_EVENT;
+
+static struct
+{
+    DRV_HANDLE handle;
+
+    /* Events in the order of the driver, consumed by the task */
+    TEST_EVENT queue[TEST_EVENT_QUEUE_SIZE];
+    uint32_t head;
+    uint32_t count;
+    uint32_t nQueueFull;
+
+    /* Frame being rebuilt and the last complete frame */
+    uint8_t frame[TEST_FRAME_SIZE_MAX];
+    size_t frameSize;
+    uint8_t lastFrame[TEST_FRAME_SIZE_MAX];
+    size_t lastFrameSize;
+    uint32_t nFrames;
+    uint32_t nFrameOverflows;
+    uint32_t nOverruns;
+
+} testClient;
+
+static void testEventHandler( DRV_SPI_SLAVE_EVENT event, uint8_t *pBuffer, size_t nBytes, uintptr_t context )
+{
+    TEST_EVENT *entry;
+
+    if (event == DRV_SPI_SLAVE_EVENT_OVERRUN)
+    {
+        testClient.nOverruns++;
+        return;
+    }
+
+    if (testClient.count == TEST_EVENT_QUEUE_SIZE)
+    {
+        testClient.nQueueFull++;
+        return;
+    }
+
+    entry = &testClient.queue[(testClient.head + testClient.count) % TEST_EVENT_QUEUE_SIZE];
+    entry->event = event;
+    entry->pBuffer = pBuffer;
+    entry->nBytes = nBytes;
+
+    testClient.count++;
+}
+
+/* Consumes the queued buffers: copies each one into the frame, then gives it
+ * back to the driver */
+static void testTask( void )
+{
+    TEST_EVENT entry;
+    bool interruptState;
+
+    for (;;)
+    {
+        interruptState = SYS_INT_Disable();
+
+        if (testClient.count == 0U)
+        {
+            SYS_INT_Restore(interruptState);
+            break;
+        }
+
+        entry = testClient.queue[testClient.head];
+        testClient.head = (testClient.head + 1U) % TEST_EVENT_QUEUE_SIZE;
+        testClient.count--;
+
+        SYS_INT_Restore(interruptState);
+
+        if (entry.pBuffer != NULL)
+        {
+            if ((testClient.frameSize + entry.nBytes) <= TEST_FRAME_SIZE_MAX)
+            {
+                (void) memcpy(&testClient.frame[testClient.frameSize], entry.pBuffer, entry.nBytes);
+                testClient.frameSize += entry.nBytes;
+            }
+            else
+            {
+                testClient.nFrameOverflows++;
+            }
+
+            TEST_CHECK(DRV_SPI_SLAVE_BufferRelease(testClient.handle, entry.pBuffer) == true);
+        }
+
+        if (entry.event == DRV_SPI_SLAVE_EVENT_FRAME_END)
+        {
+            (void) memcpy(testClient.lastFrame, testClient.frame, testClient.frameSize);
+            testClient.lastFrameSize = testClient.frameSize;
+            testClient.frameSize = 0U;
+            testClient.nFrames++;
+        }
+    }
+}
+
+// *****************************************************************************
+// Section: Master
+// *****************************************************************************
+
+typedef struct
+{
+    const char *name;
+    uint32_t nFrames;
+    /* Frame sizes are (sizeMin + random % sizeRange) * sizeMultiple + sizeTail */
+    uint32_t sizeMin;
+    uint32_t sizeRange;
+    uint32_t sizeMultiple;
+    uint32_t sizeTail;
+    /* Percentage of DMA interrupts left pending after their beat */
+    uint32_t deferPercent;
+    /* Percentage of frame ends where slave select is served before a
+     * pending DMA interrupt */
+    uint32_t selectFirstPercent;
+    /* Run the task during the frames, otherwise only between frames */
+    bool isTaskInFrame;
+
+} TEST_SCENARIO;
+
+static uint32_t testRandomState = 0x2545F491U;
+
+static uint32_t testRandom( void )
+{
+    /* xorshift32 */
+    testRandomState ^= testRandomState << 13;
+    testRandomState ^= testRandomState >> 17;
+    testRandomState ^= testRandomState << 5;
+
+    return testRandomState;
+}
+
+static void testSelectEnd( void )
+{
+    testPlib.isSelected = false;
+    testPlib.callback(testPlib.context);
+}
+
+/* Sends one frame. Returns false if the client did not get it back intact. */
+static bool testFrameSend( const TEST_SCENARIO *scenario, const uint8_t *data, size_t size )
+{
+    size_t index;
+    uint32_t nFramesBefore = testClient.nFrames;
+    bool isFrameOk;
+
+    testPlib.isSelected = true;
+
+    for (index = 0U; index < size; index++)
+    {
+        /* The DMA interrupt latency stays below one buffer */
+        if ((gDmaModel.irqPending == true) && (gDmaModel.current != NULL) &&
+            ((uint32_t)gDmaModel.count + 1U == gDmaModel.current->DMAC_BTCNT))
+        {
+            DMA_MODEL_InterruptServe();
+        }
+
+        DMA_MODEL_Beat(data[index]);
+
+        if ((testRandom() % 100U) >= scenario->deferPercent)
+        {
+            DMA_MODEL_InterruptServe();
+        }
+
+        if ((scenario->isTaskInFrame == true) && (((index + 1U) % TEST_TASK_PERIOD) == 0U))
+        {
+            testTask();
+        }
+    }
+
+    if ((testRandom() % 100U) < scenario->selectFirstPercent)
+    {
+        testSelectEnd();
+        DMA_MODEL_InterruptServe();
+    }
+    else
+    {
+        DMA_MODEL_InterruptServe();
+        testSelectEnd();
+    }
+
+    testTask();
+
+    isFrameOk = ((testClient.nFrames == (nFramesBefore + 1U)) &&
+            (testClient.lastFrameSize == size) &&
+            (memcmp(testClient.lastFrame, data, size) == 0));
+
+    return isFrameOk;
+}
+
+static void testScenarioRun( const TEST_SCENARIO *scenario )
+{
+    uint8_t data[TEST_FRAME_SIZE_MAX];
+    uint32_t frame;
+    uint32_t nBadFrames = 0U;
+    size_t size;
+    size_t index;
+
+    for (frame = 0U; frame < scenario->nFrames; frame++)
+    {
+        size = (size_t)((scenario->sizeMin + (testRandom() % scenario->sizeRange)) *
+                scenario->sizeMultiple + scenario->sizeTail);
+
+        for (index = 0U; index < size; index++)
+        {
+            data[index] = (uint8_t)testRandom();
+        }
+
+        if (testFrameSend(scenario, data, size) == false)
+        {
+            nBadFrames++;
+        }
+    }
+
+    (void) printf("spi_slave: %s: %u frames, %u bad\n", scenario->name, scenario->nFrames, nBadFrames);
+
+    TEST_CHECK_EQUAL(nBadFrames, 0U);
+}
+
+static const TEST_SCENARIO testScenarios[] =
+{
+    /* Random sizes, random interrupt latency and order */
+    { "random frames", 400U, 1U, 80U, 1U, 0U, 50U, 50U, true },
+    /* The last byte of each frame completes a buffer, slave select first */
+    { "buffer-multiple frames", 100U, 1U, 5U, TEST_BUFFER_SIZE, 0U, 100U, 100U, true },
+    /* Full buffers and a tail with the DMA interrupt still pending */
+    { "buffer plus tail frames", 100U, 1U, 5U, TEST_BUFFER_SIZE, 5U, 100U, 100U, true },
+    /* The client holds all the buffers until the frame has ended */
+    { "held buffers", 200U, 1U, TEST_NUM_BUFFERS * TEST_BUFFER_SIZE, 1U, 0U, 50U, 50U, false },
+};
+
+int main( int argc, char *argv[] )
+{
+    SYS_MODULE_OBJ object;
+    uint32_t index;
+    int result;
+
+    DMA_MODEL_Reset();
+
+    object = DRV_SPI_SLAVE_Initialize(DRV_SPI_SLAVE_INDEX_0, (const SYS_MODULE_INIT *)&testInit);
+    TEST_CHECK(object != SYS_MODULE_OBJ_INVALID);
+
+    testClient.handle = DRV_SPI_SLAVE_Open(DRV_SPI_SLAVE_INDEX_0, DRV_IO_INTENT_READ);
+    TEST_CHECK(testClient.handle != DRV_HANDLE_INVALID);
+
+    if (testClient.handle != DRV_HANDLE_INVALID)
+    {
+        DRV_SPI_SLAVE_EventHandlerSet(testClient.handle, testEventHandler, 0U);
+
+        for (index = 0U; index < (sizeof(testScenarios) / sizeof(testScenarios[0])); index++)
+        {
+            testScenarioRun(&testScenarios[index]);
+        }
+
+        TEST_CHECK_EQUAL(DRV_SPI_SLAVE_OverrunCountGet(testClient.handle), 0U);
+
+        DRV_SPI_SLAVE_Close(testClient.handle);
+    }
+
+    TEST_CHECK_EQUAL(testClient.nOverruns, 0U);
+    TEST_CHECK_EQUAL(testClient.nQueueFull, 0U);
+    TEST_CHECK_EQUAL(testClient.nFrameOverflows, 0U);
+    TEST_CHECK_EQUAL(gDmaModel.nLostBytes, 0U);
+    TEST_CHECK_EQUAL(gDmaModel.nUnprotectedReads, 0U);
+    TEST_CHECK_EQUAL(gSysIntDisableDepth, 0U);
+
+    result = TEST_RESULT("spi_slave");
+    return result;
+}